@@ -7693,6 +7693,36 @@
    matexp( A )(1,2);         // Compilation error: It is not possible to access individual elements!
    \endcode
 
+// In case only the action of the matrix exponential on a vector is required, the \c expmv()
+// function computes \f$ e^{tA} v \f$ without forming \f$ e^{tA} \f$. Since it only relies on
+// matrix/vector multiplications, \c expmv() can be used for both dense and sparse matrices:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> u0, u;
+   // ... Resizing and initialization
+   u = expmv( A, u0, 0.5 );  // Compute exp(0.5*A)*u0
+   \endcode
+
+// Further matrix functions are the principal square root \c sqrtm(), the principal logarithm
+// \c logm(), and the (principal) power \c powm() of square dense matrices. For real symmetric
+// and Hermitian matrices these functions are evaluated via the eigendecomposition, which is also
+// available for arbitrary scalar functions via \c funm():
+
+   \code
+   blaze::DynamicMatrix<double> A, B;
+   blaze::SymmetricMatrix< blaze::DynamicMatrix<double> > C;
+   // ... Resizing and initialization
+   B = sqrtm( A );       // Compute the principal square root of A
+   B = logm( A );        // Compute the principal logarithm of A
+   B = powm( A, 0.3 );   // Compute A^0.3
+   B = powm( C, -0.5 );  // Compute the inverse square root of the symmetric matrix C
+   B = funm( C, []( double x ){ return std::tanh( x ); } );  // Compute tanh(C)
+   \endcode
+
+// \note These functions can only be used if a fitting LAPACK library is available and linked to
+// the executable.
+
 // \n \section matrix_operations_decomposition Matrix Decomposition
 // <hr>
 //
@@ -15572,6 +15602,110 @@
 // In case an error is encountered during (de-)serialization, a \c std::runtime_exception is
 // thrown.
 //
+// Large serialized matrices and vectors can also be loaded without copying via the
+// \c MappedArchive class. It maps the file into memory and binds custom matrices and vectors
+// (see \ref matrix_types_custom_matrix and \ref vector_types_custom_vector) directly to the
+// serialized elements:
+
+   \code
+   blaze::MappedArchive archive( "weights.blaze" );
+
+   blaze::CustomMatrix<const float,blaze::unaligned,blaze::unpadded,blaze::rowMajor> W;
+   blaze::CustomVector<const float,blaze::unaligned,blaze::unpadded,blaze::columnVector> b;
+
+   archive >> W >> b;  // No elements are copied
+   \endcode
+
+// Binding requires a dense serialized matrix or vector with the same element type (and for
+// matrices the same storage order) as the custom matrix or vector. The file is mapped
+// copy-on-write, i.e. all processes mapping the same file share its pages and modifications are
+// never written back. All other matrix and vector types are reconstituted by copying. Note that
+// all custom matrices and vectors bound to a \c MappedArchive become invalid as soon as the
+// archive is destroyed.
+//
+// The payload of all serialized matrices and vectors starts at a 64-byte boundary and the rows
+// (or columns) of dense matrices are padded to a multiple of 64 bytes. Therefore it is also
+// possible to bind aligned and padded custom matrices and vectors. Additionally, an archive can
+// be finalized with an index of all contained objects, which enables the direct access to any
+// object and to any range of rows of a row-major matrix:
+
+   \code
+   {
+      blaze::Archive<std::ofstream> archive( "layers.blaze", std::ofstream::trunc );
+      archive.setIndexing( true );
+      archive << W1 << W2 << W3;
+      archive.writeIndex();  // Appending the index of all three matrices
+   }
+
+   blaze::MappedArchive archive( "layers.blaze" );
+
+   blaze::CustomMatrix<const float,blaze::aligned,blaze::unpadded,blaze::rowMajor> W;
+   archive.seekObject( 2UL );  // Skipping W1 and W2 without reading them
+   archive >> W;
+
+   blaze::DynamicMatrix<float,blaze::rowMajor> R;
+   archive.seekObject( 0UL );
+   archive.readRows( R, 64UL, 32UL );  // Copying rows 64 to 95 of W1
+   \endcode
+
+// Files written by previous versions of \b Blaze remain readable, but do not provide alignment,
+// padding, or row pointers for sparse matrices.
+//
+// For large matrices and vectors of numeric element type it is possible to reduce the size of
+// the archive by enabling the built-in block compression. The elements are byte-shuffled and
+// compressed in independent blocks, which are (de-)compressed in parallel (see
+// \ref shared_memory_parallelization). The indices of sparse matrices and vectors are delta
+// encoded. Compressed objects are automatically recognized during deserialization:
+
+   \code
+   blaze::Archive<std::ofstream> archive( "weights.blaze", std::ofstream::trunc );
+   archive.setCompression( true );
+   archive << W << b;
+   \endcode
+
+// Note that compressed matrices and vectors cannot be bound by a \c MappedArchive, but have to
+// be reconstituted by copying.
+//
+// Additionally, \b Blaze can exchange matrices and vectors with other tools via the Matrix
+// Market exchange format and via the NumPy \c .npy and \c .npz formats. Dense matrices are
+// written to Matrix Market files in the array format, sparse matrices in the coordinate format.
+// Matrix Market files can be read into both dense and sparse matrices. The file is parsed in
+// parallel and sparse matrices are assembled without any insertion:
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+   blaze::readMatrixMarket( "matrix.mtx", A );
+   blaze::writeMatrixMarket( "copy.mtx", A );
+   \endcode
+
+// Dense matrices and vectors can be written to and read from \c .npy files. Row-major matrices
+// are stored in C order, column-major matrices in Fortran order. Similar to a \c MappedArchive,
+// a \c MappedNpy binds custom matrices and vectors directly to the elements of a \c .npy file:
+
+   \code
+   blaze::writeNpy( "weights.npy", W );
+
+   blaze::MappedNpy npy( "weights.npy" );
+   blaze::CustomMatrix<const float,blaze::unaligned,blaze::unpadded,blaze::rowMajor> V;
+   npy >> V;  // No elements are copied
+   \endcode
+
+// Several named matrices and vectors can be combined in a \c .npz archive. Archives written by
+// \c NpzWriter are uncompressed, whereas \c NpzReader also reads compressed archives (as for
+// instance created by \c numpy.savez_compressed()):
+
+   \code
+   {
+      blaze::NpzWriter npz( "model.npz" );
+      npz.write( "W", W );
+      npz.write( "b", b );
+   }
+
+   blaze::NpzReader npz( "model.npz" );
+   npz.read( "W", W );
+   npz.read( "b", b );
+   \endcode
+
 // \n Previous: \ref vector_serialization &nbsp; &nbsp; Next: \ref customization \n
 */
 //*************************************************************************************************
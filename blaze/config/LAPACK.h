@@ -0,0 +1,170 @@
+//=================================================================================================
+/*!
+//  \file blaze/config/LAPACK.h
+//  \brief Configuration of the LAPACK-based LU decomposition
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the LAPACK-based LU decomposition (getrf).
+// \ingroup config
+//
+// This compilation switch specifies whether the LU decomposition of general dense matrices and
+// all LU-based operations (i.e. the lu() decomposition, the computation of the determinant via
+// det(), the inversion via inv() and invert(), and the solution of linear systems via solve())
+// are computed by the getrf(), getrs(), and getri() functions of an external LAPACK library or
+// by the native blocked LU decomposition of the Blaze library. The native LU decomposition is
+// built on top of the Blaze dense matrix multiplication kernels and is parallelized by means
+// of the active shared memory parallelization backend. In case the switch is disabled, the
+// LU-based operations therefore neither require LAPACK at link time nor a fitting LAPACK
+// library at runtime.
+//
+// Possible settings for the switch:
+//  - Native blocked LU decomposition: \b 0
+//  - LAPACK LU decomposition        : \b 1 (default)
+//
+// \warning Changing the setting of this compilation switch requires a recompilation of all code
+// using the Blaze library!
+//
+// \note It is possible to (de-)activate the use of the LAPACK LU decomposition via command line
+// or by defining this symbol manually before including any Blaze header file:
+   \code
+   g++ ... -DBLAZE_USE_LAPACK_LU_DECOMPOSITION=0 ...
+   \endcode
+   \code
+   #define BLAZE_USE_LAPACK_LU_DECOMPOSITION 0
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_LAPACK_LU_DECOMPOSITION
+#define BLAZE_USE_LAPACK_LU_DECOMPOSITION 1
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the LAPACK-based Cholesky decomposition (potrf).
+// \ingroup config
+//
+// This compilation switch specifies whether the Cholesky decomposition of positive definite
+// dense matrices and all Cholesky-based operations (i.e. the llh() decomposition and the
+// inversion via inv() and invert()) are computed by the potrf() and potri() functions of an
+// external LAPACK library or by the native blocked Cholesky decomposition of the Blaze library
+// (see potrfBlocked()).
+//
+// Possible settings for the switch:
+//  - Native blocked Cholesky decomposition: \b 0
+//  - LAPACK Cholesky decomposition        : \b 1 (default)
+//
+// \warning Changing the setting of this compilation switch requires a recompilation of all code
+// using the Blaze library!
+//
+// \note It is possible to (de-)activate the use of the LAPACK Cholesky decomposition via command
+// line or by defining this symbol manually before including any Blaze header file:
+   \code
+   g++ ... -DBLAZE_USE_LAPACK_LLH_DECOMPOSITION=0 ...
+   \endcode
+   \code
+   #define BLAZE_USE_LAPACK_LLH_DECOMPOSITION 0
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_LAPACK_LLH_DECOMPOSITION
+#define BLAZE_USE_LAPACK_LLH_DECOMPOSITION 1
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the tiled native Cholesky decomposition.
+// \ingroup config
+//
+// This compilation switch specifies whether the native Cholesky decomposition (see
+// potrfBlocked()) uses the right-looking blocked algorithm, which parallelizes each single
+// trailing update, or the tile algorithm (see potrfTiled()), which executes all triangular
+// solves and trailing tile updates of a step as independent serial tasks. The tile algorithm
+// usually scales better on systems with many cores.
+//
+// Possible settings for the switch:
+//  - Blocked Cholesky decomposition: \b 0 (default)
+//  - Tiled Cholesky decomposition  : \b 1
+//
+// \warning Changing the setting of this compilation switch requires a recompilation of all code
+// using the Blaze library!
+//
+// \note It is possible to (de-)activate the tiled Cholesky decomposition via command line or by
+// defining this symbol manually before including any Blaze header file:
+   \code
+   g++ ... -DBLAZE_USE_TILED_LLH_DECOMPOSITION=1 ...
+   \endcode
+   \code
+   #define BLAZE_USE_TILED_LLH_DECOMPOSITION 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_TILED_LLH_DECOMPOSITION
+#define BLAZE_USE_TILED_LLH_DECOMPOSITION 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the LAPACK-based Bunch-Kaufman decomposition (sytrf/hetrf).
+// \ingroup config
+//
+// This compilation switch specifies whether the Bunch-Kaufman decomposition of symmetric and
+// Hermitian indefinite dense matrices and all according operations (i.e. the inversion via
+// inv() and invert() and the solution of symmetric and Hermitian linear systems via solve())
+// are computed by the sytrf()/hetrf() functions of an external LAPACK library or by the native
+// blocked Bunch-Kaufman decomposition of the Blaze library (see sytrfBlocked() and
+// hetrfBlocked()).
+//
+// Possible settings for the switch:
+//  - Native blocked Bunch-Kaufman decomposition: \b 0
+//  - LAPACK Bunch-Kaufman decomposition        : \b 1 (default)
+//
+// \warning Changing the setting of this compilation switch requires a recompilation of all code
+// using the Blaze library!
+//
+// \note It is possible to (de-)activate the use of the LAPACK Bunch-Kaufman decomposition via
+// command line or by defining this symbol manually before including any Blaze header file:
+   \code
+   g++ ... -DBLAZE_USE_LAPACK_LDLT_DECOMPOSITION=0 ...
+   \endcode
+   \code
+   #define BLAZE_USE_LAPACK_LDLT_DECOMPOSITION 0
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_LAPACK_LDLT_DECOMPOSITION
+#define BLAZE_USE_LAPACK_LDLT_DECOMPOSITION 1
+#endif
+//*************************************************************************************************
@@ -167,3 +167,35 @@
 #define BLAZE_USE_DEFAULT_INITIALIZATION 1
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Configuration of the software prefetch distance of the sparse matrix/vector kernels.
+// \ingroup config
+//
+// This configuration switch specifies the number of non-zero elements the optimized sparse
+// matrix/dense vector multiplication kernels look ahead in order to prefetch the irregularly
+// accessed dense vector elements into the cache. Since the dense vector is accessed via the
+// indices stored in the sparse matrix, hardware prefetchers are typically not able to predict
+// these accesses. A distance of 0 disables the software prefetching.
+//
+// Possible settings for the prefetch distance:
+//  - Disabled: \b 0
+//  - Distance: \b 1, \b 2, ...
+//
+// \note It is possible to configure the prefetch distance via command line or by defining
+// this symbol manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_SMVM_PREFETCH_DISTANCE=32 ...
+   \endcode
+
+   \code
+   #define BLAZE_SMVM_PREFETCH_DISTANCE 32
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMVM_PREFETCH_DISTANCE
+#define BLAZE_SMVM_PREFETCH_DISTANCE 16
+#endif
+//*************************************************************************************************
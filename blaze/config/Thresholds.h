@@ -2276,3 +2276,120 @@
 #define BLAZE_SMP_SMATREDUCE_THRESHOLD 180UL
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix assignment threshold.
+// \ingroup config
+//
+// This threshold specifies when an assignment to a sparse matrix that is evaluated by one of the
+// dedicated sparse matrix kernels (as for instance the pattern-reusing assignment via the
+// PatternPlan class or the conversion of a compressed matrix to the opposite storage order) can
+// be executed in parallel. In case the number of non-zero elements of the target matrix is larger
+// or equal to this threshold, the operation is executed in parallel. If the number of non-zero
+// elements is below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 40000. In case the threshold is set to 0, the operation
+// is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_SMP_SMATASSIGN_THRESHOLD=40000 ...
+   \endcode
+
+   \code
+   #define BLAZE_SMP_SMATASSIGN_THRESHOLD 40000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SMATASSIGN_THRESHOLD
+#define BLAZE_SMP_SMATASSIGN_THRESHOLD 40000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sampled dense matrix multiplication threshold.
+// \ingroup config
+//
+// This threshold specifies when the Schur product between a sparse matrix and a dense matrix
+// multiplication, which is only evaluated at the positions of the non-zero elements of the sparse
+// matrix (sampled dense-dense matrix multiplication), can be executed in parallel. In case the
+// number of non-zero elements of the sparse matrix times the inner dimension of the dense matrix
+// multiplication is larger or equal to this threshold, the operation is executed in parallel. If
+// the product is below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 100000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_SMP_SDDMM_THRESHOLD=100000 ...
+   \endcode
+
+   \code
+   #define BLAZE_SMP_SDDMM_THRESHOLD 100000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SDDMM_THRESHOLD
+#define BLAZE_SMP_SDDMM_THRESHOLD 100000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP semiring multiplication threshold.
+// \ingroup config
+//
+// This threshold specifies when a semiring multiplication between a sparse matrix and a vector or
+// between two sparse matrices (see the mult() functions in <blaze/math/sparse/Semiring.h>) can be
+// executed in parallel. In case the number of required multiply-add operations (i.e. the number of
+// non-zero elements of the sparse matrix for a sparse matrix/vector multiplication) is larger or
+// equal to this threshold, the operation is executed in parallel. If the number of operations is
+// below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 40000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_SMP_SEMIRINGMULT_THRESHOLD=40000 ...
+   \endcode
+
+   \code
+   #define BLAZE_SMP_SEMIRINGMULT_THRESHOLD 40000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SEMIRINGMULT_THRESHOLD
+#define BLAZE_SMP_SEMIRINGMULT_THRESHOLD 40000UL
+#endif
+//*************************************************************************************************
@@ -42,7 +42,14 @@
 
 #include <cmath>
 #include <vector>
+#include <blaze/math/sparse/AssemblyPlan.h>
 #include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/DeltaBuffer.h>
+#include <blaze/math/sparse/PatternPlan.h>
+#include <blaze/math/sparse/Reordering.h>
+#include <blaze/math/sparse/Semiring.h>
+#include <blaze/math/sparse/SparseCholesky.h>
+#include <blaze/math/sparse/SparseLU.h>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/IdentityMatrix.h>
@@ -45,16 +45,24 @@
 #include <blaze/math/adaptors/LowerMatrix.h>
 #include <blaze/math/adaptors/SymmetricMatrix.h>
 #include <blaze/math/adaptors/UpperMatrix.h>
+#include <blaze/math/dense/Batch.h>
+#include <blaze/math/dense/DenseCholesky.h>
+#include <blaze/math/dense/DenseLU.h>
 #include <blaze/math/dense/DenseMatrix.h>
+#include <blaze/math/dense/DenseQR.h>
 #include <blaze/math/dense/Eigen.h>
+#include <blaze/math/dense/ExpMV.h>
 #include <blaze/math/dense/Inversion.h>
 #include <blaze/math/dense/LLH.h>
 #include <blaze/math/dense/PLLHP.h>
 #include <blaze/math/dense/LQ.h>
 #include <blaze/math/dense/LSE.h>
 #include <blaze/math/dense/LU.h>
+#include <blaze/math/dense/MatrixFunctions.h>
+#include <blaze/math/dense/MixedPrecision.h>
 #include <blaze/math/dense/QL.h>
 #include <blaze/math/dense/QR.h>
+#include <blaze/math/dense/RandomizedSVD.h>
 #include <blaze/math/dense/RQ.h>
 #include <blaze/math/dense/SVD.h>
 #include <blaze/math/expressions/DenseMatrix.h>
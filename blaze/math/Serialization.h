@@ -40,7 +40,11 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/serialization/MappedArchive.h>
+#include <blaze/math/serialization/MatrixMarket.h>
 #include <blaze/math/serialization/MatrixSerializer.h>
+#include <blaze/math/serialization/Npy.h>
+#include <blaze/math/serialization/Npz.h>
 #include <blaze/math/serialization/VectorSerializer.h>
 
 #endif
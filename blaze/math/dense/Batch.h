@@ -0,0 +1,1137 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Batch.h
+//  \brief Header file for the batched decomposition, inversion and solver functions
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BATCH_H_
+#define _BLAZE_MATH_DENSE_BATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/math/dense/Jacobi.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/Restrict.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/constraints/Integral.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BATCH KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pivot search within a chunk of interleaved matrices.
+// \ingroup dense_matrix
+//
+// \param a Pointer to the first lane of the first element of the chunk.
+// \param ld The distance between two consecutive elements of the same matrix.
+// \param n The number of rows/columns of the matrices.
+// \param L The number of matrices (lanes) in the chunk.
+// \param k The current column.
+// \param p The resulting pivot rows per lane.
+// \return void
+//
+// This function determines the element of largest magnitude in the rows \f$[k..n)\f$ of
+// column \a k for every lane of the given chunk. All loops run over the lanes of the chunk,
+// i.e. the search is vectorized across the batch.
+*/
+template< typename ET >  // Element type of the matrices
+void batchPivot( const ET* a, size_t ld, size_t n, size_t L, size_t k, size_t* BLAZE_RESTRICT p )
+{
+   using std::abs;
+
+   using RT = decltype( abs( ET() ) );
+
+   std::array<RT,BATCH_CHUNK_SIZE> pmax;
+
+   const ET* BLAZE_RESTRICT akk( a + ( k*n+k )*ld );
+   for( size_t l=0UL; l<L; ++l ) {
+      p[l] = k;
+      pmax[l] = abs( akk[l] );
+   }
+
+   for( size_t i=k+1UL; i<n; ++i ) {
+      const ET* BLAZE_RESTRICT aik( a + ( i*n+k )*ld );
+      for( size_t l=0UL; l<L; ++l ) {
+         const RT tmp( abs( aik[l] ) );
+         const bool s( tmp > pmax[l] );
+         pmax[l] = s ? tmp : pmax[l];
+         p[l]    = s ? i   : p[l];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Lane-wise interchange of rows within a chunk of interleaved matrices.
+// \ingroup dense_matrix
+//
+// \param a Pointer to the first lane of the first element of the chunk.
+// \param ld The distance between two consecutive elements of the same matrix.
+// \param m The number of rows of the matrices.
+// \param n The number of columns of the matrices.
+// \param L The number of matrices (lanes) in the chunk.
+// \param k The row to be interchanged.
+// \param p The row to interchange row \a k with per lane (\f$ p[l] \ge k \f$).
+// \return void
+//
+// Since the pivot rows differ between the lanes, row \a k is blended with all candidate rows
+// instead of swapped via a gather. This keeps all loops branch-free and vectorizable.
+*/
+template< typename ET >  // Element type of the matrices
+void batchSwapRows( ET* a, size_t ld, size_t m, size_t n, size_t L, size_t k, const size_t* p )
+{
+   for( size_t i=k+1UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         ET* BLAZE_RESTRICT x( a + ( k*n+j )*ld );
+         ET* BLAZE_RESTRICT y( a + ( i*n+j )*ld );
+         for( size_t l=0UL; l<L; ++l ) {
+            const bool s( p[l] == i );
+            const ET tmp( x[l] );
+            x[l] = s ? y[l] : tmp;
+            y[l] = s ? tmp  : y[l];
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Lane-wise interchange of columns within a chunk of interleaved matrices.
+// \ingroup dense_matrix
+//
+// \param a Pointer to the first lane of the first element of the chunk.
+// \param ld The distance between two consecutive elements of the same matrix.
+// \param n The number of rows/columns of the matrices.
+// \param L The number of matrices (lanes) in the chunk.
+// \param k The column to be interchanged.
+// \param p The column to interchange column \a k with per lane (\f$ p[l] \ge k \f$).
+// \return void
+*/
+template< typename ET >  // Element type of the matrices
+void batchSwapColumns( ET* a, size_t ld, size_t n, size_t L, size_t k, const size_t* p )
+{
+   for( size_t j=k+1UL; j<n; ++j ) {
+      for( size_t i=0UL; i<n; ++i ) {
+         ET* BLAZE_RESTRICT x( a + ( i*n+k )*ld );
+         ET* BLAZE_RESTRICT y( a + ( i*n+j )*ld );
+         for( size_t l=0UL; l<L; ++l ) {
+            const bool s( p[l] == j );
+            const ET tmp( x[l] );
+            x[l] = s ? y[l] : tmp;
+            y[l] = s ? tmp  : y[l];
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the reciprocals of the pivots of column \a k of a chunk of interleaved matrices.
+// \ingroup dense_matrix
+//
+// \param akk Pointer to the first lane of the pivot element.
+// \param L The number of matrices (lanes) in the chunk.
+// \param inv The resulting reciprocals (zero for zero pivots).
+// \return \a true in case at least one pivot is zero, \a false if not.
+*/
+template< typename ET >  // Element type of the matrices
+bool batchInvertPivot( const ET* BLAZE_RESTRICT akk, size_t L, ET* BLAZE_RESTRICT inv )
+{
+   bool singular( false );
+
+   for( size_t l=0UL; l<L; ++l ) {
+      const bool zero( isDefault<strict>( akk[l] ) );
+      inv[l] = ET(1) / ( zero ? ET(1) : akk[l] );
+      inv[l] = zero ? ET(0) : inv[l];
+      singular |= zero;
+   }
+
+   return singular;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief LU decomposition of a chunk of interleaved matrices.
+// \ingroup dense_matrix
+//
+// \param a Pointer to the first lane of the first element of the chunk.
+// \param ld The distance between two consecutive elements of the same matrix.
+// \param n The number of rows/columns of the matrices.
+// \param L The number of matrices (lanes) in the chunk.
+// \param piv Pointer to the first lane of the pivot indices (\c nullptr if not requested).
+// \param ldp The distance between two consecutive pivot indices of the same matrix.
+// \param b Pointer to the first lane of the right-hand sides (\c nullptr if not requested).
+// \param ldb The distance between two consecutive elements of the same right-hand side.
+// \param m The number of right-hand sides.
+// \param det Pointer to the determinants of the lanes (\c nullptr if not requested).
+// \return \a true in case at least one of the matrices is singular, \a false if not.
+//
+// This function performs an LU decomposition with partial pivoting (\f$ PA = LU \f$) of all
+// matrices of the given chunk. The row interchanges and the elimination steps are optionally
+// applied to the given right-hand sides, which are finally overwritten by the solution of the
+// linear systems of equations. In case \a det is not \c nullptr, the determinants of the
+// matrices are computed from the diagonal of \a U and the row interchanges.
+*/
+template< typename ET    // Element type of the matrices
+        , typename PT >  // Type of the pivot indices
+bool batchLUKernel( ET* a, size_t ld, size_t n, size_t L, PT* piv, size_t ldp,
+                    ET* b, size_t ldb, size_t m, ET* det )
+{
+   std::array<size_t,BATCH_CHUNK_SIZE> p;
+   std::array<ET,BATCH_CHUNK_SIZE> inv;
+
+   bool singular( false );
+
+   if( det != nullptr ) {
+      for( size_t l=0UL; l<L; ++l ) {
+         det[l] = ET(1);
+      }
+   }
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      batchPivot( a, ld, n, L, k, p.data() );
+      batchSwapRows( a, ld, n, n, L, k, p.data() );
+
+      if( b != nullptr ) {
+         batchSwapRows( b, ldb, n, m, L, k, p.data() );
+      }
+
+      if( piv != nullptr ) {
+         for( size_t l=0UL; l<L; ++l ) {
+            piv[k*ldp+l] = static_cast<PT>( p[l] );
+         }
+      }
+
+      const ET* BLAZE_RESTRICT akk( a + ( k*n+k )*ld );
+
+      if( det != nullptr ) {
+         for( size_t l=0UL; l<L; ++l ) {
+            det[l] *= ( p[l] == k ) ? akk[l] : -akk[l];
+         }
+      }
+
+      singular |= batchInvertPivot( akk, L, inv.data() );
+
+      for( size_t i=k+1UL; i<n; ++i )
+      {
+         ET* BLAZE_RESTRICT aik( a + ( i*n+k )*ld );
+         for( size_t l=0UL; l<L; ++l ) {
+            aik[l] *= inv[l];
+         }
+
+         for( size_t j=k+1UL; j<n; ++j ) {
+            ET* BLAZE_RESTRICT aij( a + ( i*n+j )*ld );
+            const ET* BLAZE_RESTRICT akj( a + ( k*n+j )*ld );
+            for( size_t l=0UL; l<L; ++l ) {
+               aij[l] -= aik[l] * akj[l];
+            }
+         }
+
+         for( size_t j=0UL; j<m; ++j ) {
+            ET* BLAZE_RESTRICT bij( b + ( i*m+j )*ldb );
+            const ET* BLAZE_RESTRICT bkj( b + ( k*m+j )*ldb );
+            for( size_t l=0UL; l<L; ++l ) {
+               bij[l] -= aik[l] * bkj[l];
+            }
+         }
+      }
+   }
+
+   if( b != nullptr )
+   {
+      for( size_t k=n; k-- > 0UL; )
+      {
+         batchInvertPivot( a + ( k*n+k )*ld, L, inv.data() );
+
+         for( size_t j=0UL; j<m; ++j ) {
+            ET* BLAZE_RESTRICT bkj( b + ( k*m+j )*ldb );
+            for( size_t l=0UL; l<L; ++l ) {
+               bkj[l] *= inv[l];
+            }
+         }
+
+         for( size_t i=0UL; i<k; ++i ) {
+            const ET* BLAZE_RESTRICT aik( a + ( i*n+k )*ld );
+            for( size_t j=0UL; j<m; ++j ) {
+               ET* BLAZE_RESTRICT bij( b + ( i*m+j )*ldb );
+               const ET* BLAZE_RESTRICT bkj( b + ( k*m+j )*ldb );
+               for( size_t l=0UL; l<L; ++l ) {
+                  bij[l] -= aik[l] * bkj[l];
+               }
+            }
+         }
+      }
+   }
+
+   return singular;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cholesky decomposition of a chunk of interleaved matrices.
+// \ingroup dense_matrix
+//
+// \param a Pointer to the first lane of the first element of the chunk.
+// \param ld The distance between two consecutive elements of the same matrix.
+// \param n The number of rows/columns of the matrices.
+// \param L The number of matrices (lanes) in the chunk.
+// \return \a true in case at least one of the matrices is not positive definite, \a false if not.
+//
+// This function computes the lower Cholesky factor (\f$ A = LL^H \f$) of all matrices of the
+// given chunk by means of a left-looking algorithm. Only the lower part of the matrices is
+// referenced and overwritten, the strictly upper part is left untouched.
+*/
+template< typename ET >  // Element type of the matrices
+bool batchLLHKernel( ET* a, size_t ld, size_t n, size_t L )
+{
+   using std::sqrt;
+
+   using RT = decltype( real( ET() ) );
+
+   std::array<RT,BATCH_CHUNK_SIZE> d;
+   std::array<ET,BATCH_CHUNK_SIZE> inv;
+
+   bool failed( false );
+
+   for( size_t j=0UL; j<n; ++j )
+   {
+      ET* BLAZE_RESTRICT ajj( a + ( j*n+j )*ld );
+
+      for( size_t l=0UL; l<L; ++l ) {
+         d[l] = real( ajj[l] );
+      }
+
+      for( size_t k=0UL; k<j; ++k ) {
+         const ET* BLAZE_RESTRICT ajk( a + ( j*n+k )*ld );
+         for( size_t l=0UL; l<L; ++l ) {
+            d[l] -= real( ajk[l] * conj( ajk[l] ) );
+         }
+      }
+
+      for( size_t l=0UL; l<L; ++l ) {
+         const bool pd( d[l] > RT(0) );
+         ajj[l] = ET( pd ? sqrt( d[l] ) : RT(0) );
+         inv[l] = ET( pd ? RT(1) / real( ajj[l] ) : RT(0) );
+         failed |= !pd;
+      }
+
+      for( size_t i=j+1UL; i<n; ++i )
+      {
+         ET* BLAZE_RESTRICT aij( a + ( i*n+j )*ld );
+
+         for( size_t k=0UL; k<j; ++k ) {
+            const ET* BLAZE_RESTRICT aik( a + ( i*n+k )*ld );
+            const ET* BLAZE_RESTRICT ajk( a + ( j*n+k )*ld );
+            for( size_t l=0UL; l<L; ++l ) {
+               aij[l] -= aik[l] * conj( ajk[l] );
+            }
+         }
+
+         for( size_t l=0UL; l<L; ++l ) {
+            aij[l] *= inv[l];
+         }
+      }
+   }
+
+   return failed;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of a chunk of interleaved matrices.
+// \ingroup dense_matrix
+//
+// \param a Pointer to the first lane of the first element of the chunk.
+// \param ld The distance between two consecutive elements of the same matrix.
+// \param n The number of rows/columns of the matrices.
+// \param L The number of matrices (lanes) in the chunk.
+// \param piv Workspace for the pivot indices (at least \f$ n \cdot L \f$ elements).
+// \return \a true in case at least one of the matrices is singular, \a false if not.
+//
+// This function inverts all matrices of the given chunk by means of an in-place Gauss-Jordan
+// elimination with partial pivoting. The row interchanges are undone by according column
+// interchanges at the end of the elimination.
+*/
+template< typename ET >  // Element type of the matrices
+bool batchInvertKernel( ET* a, size_t ld, size_t n, size_t L, size_t* piv )
+{
+   std::array<ET,BATCH_CHUNK_SIZE> inv;
+   std::array<ET,BATCH_CHUNK_SIZE> f;
+
+   bool singular( false );
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      size_t* p( piv + k*L );
+
+      batchPivot( a, ld, n, L, k, p );
+      batchSwapRows( a, ld, n, n, L, k, p );
+
+      ET* BLAZE_RESTRICT akk( a + ( k*n+k )*ld );
+
+      singular |= batchInvertPivot( akk, L, inv.data() );
+
+      for( size_t l=0UL; l<L; ++l ) {
+         akk[l] = ET(1);
+      }
+
+      for( size_t j=0UL; j<n; ++j ) {
+         ET* BLAZE_RESTRICT akj( a + ( k*n+j )*ld );
+         for( size_t l=0UL; l<L; ++l ) {
+            akj[l] *= inv[l];
+         }
+      }
+
+      for( size_t i=0UL; i<n; ++i )
+      {
+         if( i == k ) continue;
+
+         ET* BLAZE_RESTRICT aik( a + ( i*n+k )*ld );
+         for( size_t l=0UL; l<L; ++l ) {
+            f[l] = aik[l];
+            aik[l] = ET(0);
+         }
+
+         for( size_t j=0UL; j<n; ++j ) {
+            ET* BLAZE_RESTRICT aij( a + ( i*n+j )*ld );
+            const ET* BLAZE_RESTRICT akj( a + ( k*n+j )*ld );
+            for( size_t l=0UL; l<L; ++l ) {
+               aij[l] -= f[l] * akj[l];
+            }
+         }
+      }
+   }
+
+   for( size_t k=n; k-- > 0UL; ) {
+      batchSwapColumns( a, ld, n, L, k, piv + k*L );
+   }
+
+   return singular;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cyclic Jacobi eigenvalue kernel for a chunk of interleaved symmetric matrices.
+// \ingroup dense_matrix
+//
+// \param a Pointer to the first lane of the first element of the chunk (full storage).
+// \param ld The distance between two consecutive elements of the same matrix.
+// \param n The number of rows/columns of the matrices.
+// \param L The number of matrices (lanes) in the chunk.
+// \param v Pointer to the first lane of the resulting eigenvectors (\c nullptr if not requested).
+// \param ldv The distance between two consecutive elements of the same eigenvector matrix.
+// \return void
+//
+// This function diagonalizes all symmetric matrices of the given chunk by cyclic sweeps of
+// Jacobi rotations (see jacobiEigen()). The rotation of every lane is computed branch-free,
+// lanes that do not require a rotation are rotated by the identity. The sweeps are stopped as
+// soon as all matrices of the chunk have converged. On exit, the diagonal elements contain the
+// eigenvalues in ascending order and element \f$ (i,j) \f$ of the eigenvector matrix contains
+// element \a i of the eigenvector \a j.
+*/
+template< typename ET >  // Element type of the matrices
+void batchJacobiKernel( ET* a, size_t ld, size_t n, size_t L, ET* v, size_t ldv )
+{
+   using std::sqrt;
+
+   std::array<ET,BATCH_CHUNK_SIZE> c, s, t;
+
+   if( v != nullptr ) {
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            ET* BLAZE_RESTRICT vij( v + ( i*n+j )*ldv );
+            for( size_t l=0UL; l<L; ++l ) {
+               vij[l] = ( i == j ) ? ET(1) : ET(0);
+            }
+         }
+      }
+   }
+
+   for( size_t sweep=0UL; sweep<JACOBI_MAX_SWEEPS; ++sweep )
+   {
+      bool rotated( false );
+
+      for( size_t p=0UL; p<n; ++p ) {
+         for( size_t q=p+1UL; q<n; ++q )
+         {
+            ET* BLAZE_RESTRICT app( a + ( p*n+p )*ld );
+            ET* BLAZE_RESTRICT aqq( a + ( q*n+q )*ld );
+            ET* BLAZE_RESTRICT apq( a + ( p*n+q )*ld );
+            ET* BLAZE_RESTRICT aqp( a + ( q*n+p )*ld );
+
+            bool active( false );
+
+            for( size_t l=0UL; l<L; ++l ) {
+               t[l] = jacobiTangent( app[l], aqq[l], apq[l] );
+               c[l] = ET(1) / sqrt( ET(1) + t[l]*t[l] );
+               s[l] = t[l]*c[l];
+               active |= ( t[l] != ET(0) );
+            }
+
+            if( !active ) continue;
+
+            for( size_t l=0UL; l<L; ++l ) {
+               app[l] -= t[l]*apq[l];
+               aqq[l] += t[l]*apq[l];
+               apq[l] = aqp[l] = ( t[l] != ET(0) ) ? ET(0) : apq[l];
+            }
+
+            for( size_t r=0UL; r<n; ++r )
+            {
+               if( r == p || r == q ) continue;
+
+               ET* BLAZE_RESTRICT arp( a + ( r*n+p )*ld );
+               ET* BLAZE_RESTRICT arq( a + ( r*n+q )*ld );
+               ET* BLAZE_RESTRICT apr( a + ( p*n+r )*ld );
+               ET* BLAZE_RESTRICT aqr( a + ( q*n+r )*ld );
+
+               for( size_t l=0UL; l<L; ++l ) {
+                  const ET xp( arp[l] );
+                  const ET xq( arq[l] );
+                  arp[l] = apr[l] = c[l]*xp - s[l]*xq;
+                  arq[l] = aqr[l] = s[l]*xp + c[l]*xq;
+               }
+            }
+
+            if( v != nullptr ) {
+               for( size_t r=0UL; r<n; ++r ) {
+                  ET* BLAZE_RESTRICT vrp( v + ( r*n+p )*ldv );
+                  ET* BLAZE_RESTRICT vrq( v + ( r*n+q )*ldv );
+                  for( size_t l=0UL; l<L; ++l ) {
+                     const ET xp( vrp[l] );
+                     const ET xq( vrq[l] );
+                     vrp[l] = c[l]*xp - s[l]*xq;
+                     vrq[l] = s[l]*xp + c[l]*xq;
+                  }
+               }
+            }
+
+            rotated = true;
+         }
+      }
+
+      if( !rotated ) break;
+   }
+
+   for( size_t pass=0UL; pass<n; ++pass ) {
+      for( size_t i=( pass & 1UL ); i+1UL<n; i+=2UL )
+      {
+         ET* BLAZE_RESTRICT wi( a + ( i*n+i )*ld );
+         ET* BLAZE_RESTRICT wj( a + ( (i+1UL)*n+i+1UL )*ld );
+
+         std::array<bool,BATCH_CHUNK_SIZE> swap;
+
+         for( size_t l=0UL; l<L; ++l ) {
+            const ET x( wi[l] );
+            const ET y( wj[l] );
+            swap[l] = ( y < x );
+            wi[l] = swap[l] ? y : x;
+            wj[l] = swap[l] ? x : y;
+         }
+
+         if( v != nullptr ) {
+            for( size_t r=0UL; r<n; ++r ) {
+               ET* BLAZE_RESTRICT vri( v + ( r*n+i )*ldv );
+               ET* BLAZE_RESTRICT vrj( v + ( r*n+i+1UL )*ldv );
+               for( size_t l=0UL; l<L; ++l ) {
+                  const ET x( vri[l] );
+                  const ET y( vrj[l] );
+                  vri[l] = swap[l] ? y : x;
+                  vrj[l] = swap[l] ? x : y;
+               }
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the order of the matrices of the given batch.
+// \ingroup dense_matrix
+//
+// \param A The batch of interleaved matrices.
+// \return The number of rows/columns of the matrices.
+// \exception std::invalid_argument Invalid batch of square matrices provided.
+*/
+template< typename MT >  // Type of the batch
+size_t batchOrder( const DenseMatrix<MT,rowMajor>& A )
+{
+   const size_t n( static_cast<size_t>( std::sqrt( static_cast<double>( (*A).rows() ) ) + 0.5 ) );
+
+   if( n*n != (*A).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid batch of square matrices provided" );
+   }
+
+   return n;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given kernel for all chunks of a batch of \a count matrices.
+// \ingroup dense_matrix
+//
+// \param count The total number of matrices.
+// \param kernel The kernel to be executed for every chunk.
+// \return \a true in case the kernel reported a failure for at least one chunk, \a false if not.
+//
+// The chunks of size BATCH_CHUNK_SIZE are distributed among the threads of the active shared
+// memory parallelization backend. Failures are collected per chunk and only reported after all
+// chunks have been processed, i.e. no exception is thrown from within a parallel section.
+*/
+template< typename Kernel >  // Type of the chunk kernel
+bool batchFor( size_t count, Kernel&& kernel )
+{
+   const size_t chunks( ( count + BATCH_CHUNK_SIZE - 1UL ) / BATCH_CHUNK_SIZE );
+
+   const std::unique_ptr<bool[]> failed( new bool[chunks] );
+
+   smpFor( chunks, [&]( size_t c ) {
+      const size_t b0( c*BATCH_CHUNK_SIZE );
+      failed[c] = kernel( b0, min( BATCH_CHUNK_SIZE, count-b0 ) );
+   } );
+
+   for( size_t c=0UL; c<chunks; ++c ) {
+      if( failed[c] ) return true;
+   }
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BATCH FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Batch functions */
+//@{
+template< typename MT1, typename MT2 >
+void batchLU( DenseMatrix<MT1,rowMajor>& A, DenseMatrix<MT2,rowMajor>& P );
+
+template< typename MT >
+void batchLLH( DenseMatrix<MT,rowMajor>& A );
+
+template< typename MT >
+void batchInvert( DenseMatrix<MT,rowMajor>& A );
+
+template< typename MT, typename VT, bool TF >
+void batchDet( const DenseMatrix<MT,rowMajor>& A, DenseVector<VT,TF>& d );
+
+template< typename MT1, typename MT2 >
+void batchSolve( DenseMatrix<MT1,rowMajor>& A, DenseMatrix<MT2,rowMajor>& B );
+
+template< typename MT1, typename MT2 >
+void batchEigen( const DenseMatrix<MT1,rowMajor>& A, DenseMatrix<MT2,rowMajor>& W );
+
+template< typename MT1, typename MT2, typename MT3 >
+void batchEigen( const DenseMatrix<MT1,rowMajor>& A, DenseMatrix<MT2,rowMajor>& W,
+                 DenseMatrix<MT3,rowMajor>& V );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LU decomposition of a batch of small dense matrices.
+// \ingroup dense_matrix
+//
+// \param A The batch of interleaved \f$ n \times n \f$ matrices to be decomposed.
+// \param P The resulting pivot indices (\f$ n \times count \f$).
+// \return void
+// \exception std::invalid_argument Invalid batch of square matrices provided.
+// \exception std::invalid_argument Invalid pivot matrix provided.
+//
+// This function computes the LU decompositions \f$ P_b A_b = L_b U_b \f$ with partial pivoting
+// of a batch of \a count small \f$ n \times n \f$ matrices. The batch is stored in interleaved
+// layout as row-major \f$ n^2 \times count \f$ matrix, i.e. element \f$ (i,j) \f$ of matrix
+// \a b is stored in element \f$ (i \cdot n + j, b) \f$. Therefore the same element of all
+// matrices is stored contiguously and all computations are vectorized across the batch instead
+// of within the (small) matrices:
+
+   \code
+   using blaze::DynamicMatrix;
+   using blaze::rowMajor;
+
+   const size_t n    ( 4UL );
+   const size_t count( 100000UL );
+
+   DynamicMatrix<double,rowMajor> A( n*n, count );  // Batch of 100000 interleaved 4x4 matrices
+   DynamicMatrix<int,rowMajor> P( n, count );       // Pivot indices of all matrices
+   // ... Initialization of element (i,j) of matrix b via A(i*n+j,b)
+
+   batchLU( A, P );
+   \endcode
+
+// On exit, the strictly lower part of every matrix contains the factor \a L (without its unit
+// diagonal) and the upper part contains \a U. Element \f$ (k,b) \f$ of \a P contains the
+// (0-based) row that has been interchanged with row \a k in step \a k of the decomposition of
+// matrix \a b. Similar to the LAPACK getrf() function, the decomposition does not fail for
+// singular matrices. The batch is processed in chunks of BATCH_CHUNK_SIZE matrices, which are
+// distributed among the threads of the active shared memory parallelization backend. No
+// memory is allocated per matrix.
+*/
+template< typename MT1  // Type of the batch
+        , typename MT2 > // Type of the pivot matrix
+void batchLU( DenseMatrix<MT1,rowMajor>& A, DenseMatrix<MT2,rowMajor>& P )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT1> );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT2 );
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE( ElementType_t<MT2> );
+
+   const size_t n( batchOrder( *A ) );
+   const size_t count( (*A).columns() );
+
+   if( (*P).rows() != n || (*P).columns() != count ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid pivot matrix provided" );
+   }
+
+   using ET = ElementType_t<MT1>;
+   using PT = ElementType_t<MT2>;
+
+   ET* const a( (*A).data() );
+   PT* const p( (*P).data() );
+
+   batchFor( count, [&,n]( size_t b0, size_t L ) {
+      return batchLUKernel<ET,PT>( a+b0, (*A).spacing(), n, L, p+b0, (*P).spacing(),
+                                   nullptr, 0UL, 0UL, nullptr );
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Cholesky decomposition of a batch of small dense positive definite matrices.
+// \ingroup dense_matrix
+//
+// \param A The batch of interleaved \f$ n \times n \f$ matrices to be decomposed.
+// \return void
+// \exception std::invalid_argument Invalid batch of square matrices provided.
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// This function computes the Cholesky decompositions \f$ A_b = L_b L_b^H \f$ of a batch of
+// small symmetric (Hermitian) positive definite \f$ n \times n \f$ matrices stored in
+// interleaved layout (see batchLU()). Only the lower part of the matrices is referenced and
+// overwritten by the factor \a L, the strictly upper part is not modified. In case any of the
+// matrices is not positive definite, a \a std::runtime_error exception is thrown after all
+// matrices have been processed.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A may already have been modified.
+*/
+template< typename MT >  // Type of the batch
+void batchLLH( DenseMatrix<MT,rowMajor>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   const size_t n( batchOrder( *A ) );
+
+   using ET = ElementType_t<MT>;
+
+   ET* const a( (*A).data() );
+
+   const bool failed = batchFor( (*A).columns(), [&,n]( size_t b0, size_t L ) {
+      return batchLLHKernel<ET>( a+b0, (*A).spacing(), n, L );
+   } );
+
+   if( failed ) {
+      BLAZE_THROW_LAPACK_ERROR( "Decomposition of non-positive-definite matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place inversion of a batch of small dense matrices.
+// \ingroup dense_matrix
+//
+// \param A The batch of interleaved \f$ n \times n \f$ matrices to be inverted.
+// \return void
+// \exception std::invalid_argument Invalid batch of square matrices provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function inverts a batch of small general \f$ n \times n \f$ matrices stored in
+// interleaved layout (see batchLU()) by means of a Gauss-Jordan elimination with partial
+// pivoting, which is vectorized across the batch. In case any of the matrices is singular,
+// a \a std::runtime_error exception is thrown after all matrices have been processed.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A may already have been modified.
+*/
+template< typename MT >  // Type of the batch
+void batchInvert( DenseMatrix<MT,rowMajor>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   const size_t n( batchOrder( *A ) );
+
+   using ET = ElementType_t<MT>;
+
+   ET* const a( (*A).data() );
+
+   const bool singular = batchFor( (*A).columns(), [&,n]( size_t b0, size_t L ) {
+      std::vector<size_t> piv( n*L );
+      return batchInvertKernel<ET>( a+b0, (*A).spacing(), n, L, piv.data() );
+   } );
+
+   if( singular ) {
+      BLAZE_THROW_LAPACK_ERROR( "Inversion of singular matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the determinants of a batch of small dense matrices.
+// \ingroup dense_matrix
+//
+// \param A The batch of interleaved \f$ n \times n \f$ matrices.
+// \param d The resulting determinants (one per matrix).
+// \return void
+// \exception std::invalid_argument Invalid batch of square matrices provided.
+// \exception std::invalid_argument Invalid determinant vector provided.
+//
+// This function computes the determinants of a batch of small \f$ n \times n \f$ matrices
+// stored in interleaved layout (see batchLU()) by means of LU decompositions with partial
+// pivoting. The given batch is not modified; every chunk of BATCH_CHUNK_SIZE matrices is
+// decomposed in a temporary workspace.
+*/
+template< typename MT  // Type of the batch
+        , typename VT  // Type of the determinant vector
+        , bool TF >    // Transpose flag of the determinant vector
+void batchDet( const DenseMatrix<MT,rowMajor>& A, DenseVector<VT,TF>& d )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_t<MT>, ElementType_t<VT> );
+
+   const size_t n( batchOrder( *A ) );
+   const size_t count( (*A).columns() );
+
+   if( (*d).size() != count ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid determinant vector provided" );
+   }
+
+   using ET = ElementType_t<MT>;
+
+   batchFor( count, [&,n]( size_t b0, size_t L ) {
+      std::vector<ET> work( n*n*L );
+      for( size_t i=0UL; i<n*n; ++i ) {
+         for( size_t l=0UL; l<L; ++l ) {
+            work[i*L+l] = (*A)(i,b0+l);
+         }
+      }
+      batchLUKernel<ET,size_t>( work.data(), L, n, L, nullptr, 0UL,
+                                nullptr, 0UL, 0UL, (*d).data()+b0 );
+      return false;
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solution of a batch of small dense linear systems of equations.
+// \ingroup dense_matrix
+//
+// \param A The batch of interleaved \f$ n \times n \f$ system matrices.
+// \param B The batch of interleaved \f$ n \times m \f$ right-hand sides.
+// \return void
+// \exception std::invalid_argument Invalid batch of square matrices provided.
+// \exception std::invalid_argument Invalid right-hand side batch provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function solves the linear systems of equations \f$ A_b X_b = B_b \f$ of a batch of
+// small general \f$ n \times n \f$ matrices stored in interleaved layout (see batchLU()). The
+// right-hand sides are stored in the same interleaved layout as row-major \f$ (n \cdot m)
+// \times count \f$ matrix, i.e. element \f$ (i,j) \f$ of right-hand side \a b is stored in
+// element \f$ (i \cdot m + j, b) \f$. For a single right-hand side vector per system (\f$ m=1
+// \f$) \a B is an \f$ n \times count \f$ matrix. On exit, \a A contains the LU decompositions
+// of the system matrices and \a B contains the solutions \f$ X_b \f$. In case any of the system
+// matrices is singular, a \a std::runtime_error exception is thrown after all systems have been
+// processed.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A and \a B may already have been modified.
+*/
+template< typename MT1  // Type of the system batch
+        , typename MT2 > // Type of the right-hand side batch
+void batchSolve( DenseMatrix<MT1,rowMajor>& A, DenseMatrix<MT2,rowMajor>& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT2 );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT1> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_t<MT1>, ElementType_t<MT2> );
+
+   const size_t n( batchOrder( *A ) );
+   const size_t count( (*A).columns() );
+
+   if( n == 0UL || (*B).rows() % n != 0UL || (*B).columns() != count ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side batch provided" );
+   }
+
+   const size_t m( (*B).rows() / n );
+
+   using ET = ElementType_t<MT1>;
+
+   ET* const a( (*A).data() );
+   ET* const b( (*B).data() );
+
+   const bool singular = batchFor( count, [&,n,m]( size_t b0, size_t L ) {
+      return batchLUKernel<ET,size_t>( a+b0, (*A).spacing(), n, L, nullptr, 0UL,
+                                       b+b0, (*B).spacing(), m, nullptr );
+   } );
+
+   if( singular ) {
+      BLAZE_THROW_LAPACK_ERROR( "Inversion of singular matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the eigenvalue computation of a batch of small symmetric matrices.
+// \ingroup dense_matrix
+//
+// \param A The batch of interleaved symmetric \f$ n \times n \f$ matrices.
+// \param W The resulting eigenvalues (\f$ n \times count \f$).
+// \param v Pointer to the resulting eigenvectors (\c nullptr if not requested).
+// \param ldv The spacing of the batch of eigenvectors.
+// \return void
+*/
+template< typename MT1    // Type of the batch
+        , typename MT2 >  // Type of the eigenvalue matrix
+void batchEigenBackend( const DenseMatrix<MT1,rowMajor>& A, DenseMatrix<MT2,rowMajor>& W,
+                        ElementType_t<MT1>* v, size_t ldv )
+{
+   using ET = ElementType_t<MT1>;
+
+   const size_t n( batchOrder( *A ) );
+   const size_t count( (*A).columns() );
+
+   if( (*W).rows() != n || (*W).columns() != count ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid eigenvalue matrix provided" );
+   }
+
+   batchFor( count, [&,n]( size_t b0, size_t L ) {
+      std::vector<ET> work( n*n*L );
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=0UL; j<=i; ++j ) {
+            for( size_t l=0UL; l<L; ++l ) {
+               work[(i*n+j)*L+l] = work[(j*n+i)*L+l] = (*A)(i*n+j,b0+l);
+            }
+         }
+      }
+      batchJacobiKernel<ET>( work.data(), L, n, L, ( v != nullptr ? v+b0 : nullptr ), ldv );
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t l=0UL; l<L; ++l ) {
+            (*W)(i,b0+l) = work[(i*n+i)*L+l];
+         }
+      }
+      return false;
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the eigenvalues of a batch of small dense symmetric matrices.
+// \ingroup dense_matrix
+//
+// \param A The batch of interleaved symmetric \f$ n \times n \f$ matrices.
+// \param W The resulting eigenvalues (\f$ n \times count \f$).
+// \return void
+// \exception std::invalid_argument Invalid batch of square matrices provided.
+// \exception std::invalid_argument Invalid eigenvalue matrix provided.
+//
+// This function computes the eigenvalues of a batch of small real symmetric \f$ n \times n
+// \f$ matrices stored in interleaved layout (see batchLU()) by means of the cyclic Jacobi
+// method. Only the lower part of the matrices is referenced, the given batch is not modified.
+// Element \f$ (i,b) \f$ of \a W contains the \a i-th eigenvalue of matrix \a b in ascending
+// order. All Jacobi rotations are vectorized across the batch, i.e. the chunk of matrices is
+// diagonalized simultaneously:
+
+   \code
+   using blaze::DynamicMatrix;
+   using blaze::rowMajor;
+
+   const size_t count( 1000000UL );
+
+   DynamicMatrix<double,rowMajor> C( 9UL, count );  // Batch of interleaved 3x3 covariance matrices
+   DynamicMatrix<double,rowMajor> W( 3UL, count );  // Eigenvalues of all matrices
+   DynamicMatrix<double,rowMajor> V( 9UL, count );  // Eigenvectors of all matrices
+   // ... Initialization of element (i,j) of matrix b via C(i*3+j,b)
+
+   batchEigen( C, W, V );
+   \endcode
+*/
+template< typename MT1    // Type of the batch
+        , typename MT2 >  // Type of the eigenvalue matrix
+void batchEigen( const DenseMatrix<MT1,rowMajor>& A, DenseMatrix<MT2,rowMajor>& W )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT2 );
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ElementType_t<MT1> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_t<MT1>, ElementType_t<MT2> );
+
+   batchEigenBackend( *A, *W, nullptr, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the eigenvalues and eigenvectors of a batch of small dense symmetric
+//        matrices.
+// \ingroup dense_matrix
+//
+// \param A The batch of interleaved symmetric \f$ n \times n \f$ matrices.
+// \param W The resulting eigenvalues (\f$ n \times count \f$).
+// \param V The resulting batch of interleaved \f$ n \times n \f$ eigenvector matrices.
+// \return void
+// \exception std::invalid_argument Invalid batch of square matrices provided.
+// \exception std::invalid_argument Invalid eigenvalue matrix provided.
+// \exception std::invalid_argument Invalid eigenvector batch provided.
+//
+// This function computes the eigenvalues and eigenvectors of a batch of small real symmetric
+// \f$ n \times n \f$ matrices stored in interleaved layout (see batchEigen()). Element \f$ (i,b)
+// \f$ of \a W contains the \a i-th eigenvalue of matrix \a b in ascending order, element \f$
+// (i \cdot n + j, b) \f$ of \a V contains element \a i of the according orthonormal
+// eigenvector \a j, i.e. the eigenvectors are stored in the columns of the interleaved
+// matrices.
+*/
+template< typename MT1    // Type of the batch
+        , typename MT2    // Type of the eigenvalue matrix
+        , typename MT3 >  // Type of the eigenvector batch
+void batchEigen( const DenseMatrix<MT1,rowMajor>& A, DenseMatrix<MT2,rowMajor>& W,
+                 DenseMatrix<MT3,rowMajor>& V )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT3 );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT3 );
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ElementType_t<MT1> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_t<MT1>, ElementType_t<MT2> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_t<MT1>, ElementType_t<MT3> );
+
+   if( (*V).rows() != (*A).rows() || (*V).columns() != (*A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid eigenvector batch provided" );
+   }
+
+   batchEigenBackend( *A, *W, (*V).data(), (*V).spacing() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1186 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BlockedLDLT.h
+//  \brief Header file for the native blocked Bunch-Kaufman decomposition of dense matrices
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BLOCKEDLDLT_H_
+#define _BLAZE_MATH_DENSE_BLOCKEDLDLT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/dense/BlockedLU.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Imaginary.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/NumericCast.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Conjugation of an element within the native Bunch-Kaufman kernels.
+// \ingroup dense_matrix
+//
+// \param x The given element.
+// \return The complex conjugate of \a x in case \a HERM is \a true, \a x itself otherwise.
+*/
+template< bool HERM      // Flag for the Hermitian decomposition
+        , typename T >   // Type of the element
+inline T ldltConj( const T& x )
+{
+   return ( HERM ? conj( x ) : x );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Projection of a diagonal element within the native Bunch-Kaufman kernels.
+// \ingroup dense_matrix
+//
+// \param x The given diagonal element.
+// \return The real part of \a x in case \a HERM is \a true, \a x itself otherwise.
+*/
+template< bool HERM      // Flag for the Hermitian decomposition
+        , typename T >   // Type of the element
+inline T ldltDiag( const T& x )
+{
+   return ( HERM ? T( real( x ) ) : x );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the absolute value measure used for the pivot search (\f$|Re(x)|+|Im(x)|\f$).
+// \ingroup dense_matrix
+//
+// \param x The given element.
+// \return The sum of the absolute values of the real and imaginary part of \a x.
+*/
+template< typename T >  // Type of the element
+inline auto ldltAbs( const T& x )
+{
+   using std::abs;
+
+   return abs( real( x ) ) + abs( imag( x ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the adjoint of the given workspace block within the Bunch-Kaufman kernels.
+// \ingroup dense_matrix
+//
+// \param W The given workspace block.
+// \return The conjugate transpose of the block.
+*/
+template< bool HERM      // Flag for the Hermitian decomposition
+        , typename MT >  // Type of the workspace block
+inline auto ldltAdjoint( const MT& W )
+   -> EnableIf_t< HERM && IsComplex_v< ElementType_t<MT> >, decltype( ctrans( W ) ) >
+{
+   return ctrans( W );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the transpose of the given workspace block within the Bunch-Kaufman kernels.
+// \ingroup dense_matrix
+//
+// \param W The given workspace block.
+// \return The transpose of the block.
+*/
+template< bool HERM      // Flag for the Hermitian decomposition
+        , typename MT >  // Type of the workspace block
+inline auto ldltAdjoint( const MT& W )
+   -> DisableIf_t< HERM && IsComplex_v< ElementType_t<MT> >, decltype( trans( W ) ) >
+{
+   return trans( W );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Trailing update of a column-major block within the native Bunch-Kaufman kernels.
+// \ingroup dense_matrix
+//
+// \param C The block to be updated.
+// \param P The block of the factor \a L.
+// \param W The according block of the workspace (\f$ W=L*D \f$).
+// \return void
+//
+// This function performs the update \f$ C=C-P*W^H \f$ (\f$ C=C-P*W^T \f$ in the symmetric
+// case) on the LAPACK views of the given blocks by means of a dense matrix multiplication.
+*/
+template< bool HERM      // Flag for the Hermitian decomposition
+        , typename MT1   // Type of the updated block
+        , typename MT2   // Type of the factor block
+        , typename MT3 > // Type of the workspace block
+inline void ldltUpdate( DenseMatrix<MT1,columnMajor>& C, const DenseMatrix<MT2,columnMajor>& P,
+                        const MT3& W )
+{
+   *C -= (*P) * ldltAdjoint<HERM>( W );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Trailing update of a row-major block within the native Bunch-Kaufman kernels.
+// \ingroup dense_matrix
+//
+// \param C The block to be updated.
+// \param P The block of the factor \a L.
+// \param W The according block of the workspace (\f$ W=L*D \f$).
+// \return void
+//
+// This function performs the update \f$ C^T=C^T-P^T*W^H \f$ (\f$ C^T=C^T-P^T*W^T \f$ in the
+// symmetric case) on the LAPACK views of the given blocks by means of a dense matrix
+// multiplication.
+*/
+template< bool HERM      // Flag for the Hermitian decomposition
+        , typename MT1   // Type of the updated block
+        , typename MT2   // Type of the factor block
+        , typename MT3 > // Type of the workspace block
+inline void ldltUpdate( DenseMatrix<MT1,rowMajor>& C, const DenseMatrix<MT2,rowMajor>& P,
+                        const MT3& W )
+{
+   *C -= trans( ldltAdjoint<HERM>( W ) ) * (*P);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked Bunch-Kaufman decomposition of a panel of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The dense matrix to be decomposed.
+// \param k0 The first row/column of the panel.
+// \param nb The maximum number of columns of the panel.
+// \param W The workspace matrix (at least \a n rows and \a nb columns).
+// \param ipiv The pivot indices (in LAPACK convention).
+// \param info The index of the first exactly zero diagonal block of \a D (in LAPACK convention).
+// \return The first row/column after the panel.
+//
+// This function is the native counterpart of the LAPACK lasyf()/lahef() functions for the lower
+// triangular part of the LAPACK view of \a A. It factorizes up to \a nb columns of the trailing
+// matrix starting at row/column \a k0 by means of the Bunch-Kaufman diagonal pivoting method
+// and delays all updates of the remaining trailing matrix. The delayed update is applied as
+// SYRK-style update of the lower triangular part by means of dense matrix multiplications.
+*/
+template< bool HERM      // Flag for the Hermitian decomposition
+        , bool SO        // Storage order of the dense matrix
+        , typename MT    // Type of the dense matrix
+        , typename WT >  // Type of the workspace matrix
+size_t ldltPanel( MT& A, size_t k0, size_t nb, WT& W, blas_int_t* ipiv, blas_int_t& info )
+{
+   using std::abs;
+   using std::sqrt;
+   using std::swap;
+
+   using ET = ElementType_t<MT>;
+   using RT = decltype( ldltAbs( ET() ) );
+
+   const size_t n( A.rows() );
+   const RT alpha( ( RT(1) + sqrt( RT(17) ) ) / RT(8) );
+
+   const auto a( [&A]( size_t i, size_t j ) -> decltype(auto) { return luAt<SO>( A, i, j ); } );
+
+   const auto diagAbs( []( const ET& x ) {
+      return ( HERM ? RT( abs( real( x ) ) ) : ldltAbs( x ) );
+   } );
+
+   const auto update( [&]( size_t k, size_t kw, size_t c )
+   {
+      for( size_t j=k0; j<k; ++j ) {
+         const ET x( ldltConj<HERM>( W(c,j-k0) ) );
+         for( size_t i=k; i<n; ++i ) {
+            W(i,kw) -= a(i,j) * x;
+         }
+      }
+      W(c,kw) = ldltDiag<HERM>( W(c,kw) );
+   } );
+
+   size_t k( k0 );
+
+   while( k < n && ( k-k0+1UL < nb || k0+nb >= n ) )
+   {
+      const size_t kw( k - k0 );
+      size_t kstep( 1UL );
+      size_t kp( k );
+
+      for( size_t i=k; i<n; ++i ) {
+         W(i,kw) = a(i,k);
+      }
+      update( k, kw, k );
+
+      const RT absakk( diagAbs( W(k,kw) ) );
+
+      size_t imax( k );
+      RT colmax( 0 );
+      for( size_t i=k+1UL; i<n; ++i ) {
+         if( ldltAbs( W(i,kw) ) > colmax ) {
+            imax = i;
+            colmax = ldltAbs( W(i,kw) );
+         }
+      }
+
+      if( max( absakk, colmax ) == RT(0) )
+      {
+         if( info == 0 ) info = numeric_cast<blas_int_t>( k + 1UL );
+         for( size_t i=k; i<n; ++i ) {
+            a(i,k) = W(i,kw);
+         }
+      }
+      else
+      {
+         if( absakk < alpha*colmax )
+         {
+            for( size_t i=k; i<imax; ++i ) {
+               W(i,kw+1UL) = ldltConj<HERM>( a(imax,i) );
+            }
+            W(imax,kw+1UL) = a(imax,imax);
+            for( size_t i=imax+1UL; i<n; ++i ) {
+               W(i,kw+1UL) = a(i,imax);
+            }
+            update( k, kw+1UL, imax );
+
+            RT rowmax( 0 );
+            for( size_t i=k; i<n; ++i ) {
+               if( i != imax ) rowmax = max( rowmax, ldltAbs( W(i,kw+1UL) ) );
+            }
+
+            if( absakk >= alpha*colmax*( colmax/rowmax ) ) {
+               kp = k;
+            }
+            else if( diagAbs( W(imax,kw+1UL) ) >= alpha*rowmax ) {
+               kp = imax;
+               for( size_t i=k; i<n; ++i ) {
+                  W(i,kw) = W(i,kw+1UL);
+               }
+            }
+            else {
+               kp = imax;
+               kstep = 2UL;
+            }
+         }
+
+         const size_t kk( k + kstep - 1UL );
+
+         if( kp != kk )
+         {
+            a(kp,kp) = ldltDiag<HERM>( a(kk,kk) );
+            for( size_t j=kk+1UL; j<kp; ++j ) {
+               a(kp,j) = ldltConj<HERM>( a(j,kk) );
+            }
+            for( size_t i=kp+1UL; i<n; ++i ) {
+               a(i,kp) = a(i,kk);
+            }
+
+            for( size_t j=k0; j<kk; ++j ) {
+               swap( a(kk,j), a(kp,j) );
+            }
+            for( size_t j=0UL; j<=kk-k0; ++j ) {
+               swap( W(kk,j), W(kp,j) );
+            }
+         }
+
+         if( kstep == 1UL )
+         {
+            for( size_t i=k; i<n; ++i ) {
+               a(i,k) = W(i,kw);
+            }
+
+            const ET d( a(k,k) );
+            for( size_t i=k+1UL; i<n; ++i ) {
+               a(i,k) /= d;
+            }
+         }
+         else
+         {
+            ET d21( W(k+1UL,kw) );
+            const ET d11( W(k+1UL,kw+1UL) / d21 );
+            const ET d22( W(k,kw) / ldltConj<HERM>( d21 ) );
+            const ET t( ET(1) / ( ldltDiag<HERM>( d11*d22 ) - ET(1) ) );
+            d21 = t / d21;
+
+            for( size_t i=k+2UL; i<n; ++i ) {
+               a(i,k      ) = ldltConj<HERM>( d21 ) * ( d11*W(i,kw) - W(i,kw+1UL) );
+               a(i,k+1UL) = d21 * ( d22*W(i,kw+1UL) - W(i,kw) );
+            }
+
+            a(k    ,k    ) = W(k    ,kw    );
+            a(k+1UL,k    ) = W(k+1UL,kw    );
+            a(k+1UL,k+1UL) = W(k+1UL,kw+1UL);
+         }
+      }
+
+      if( kstep == 1UL ) {
+         ipiv[k] = numeric_cast<blas_int_t>( kp + 1UL );
+      }
+      else {
+         ipiv[k] = ipiv[k+1UL] = -numeric_cast<blas_int_t>( kp + 1UL );
+      }
+
+      k += kstep;
+   }
+
+   const size_t kb( k - k0 );
+
+   for( size_t c=k; c<n; c+=LDLT_BLOCK_SIZE )
+   {
+      const size_t cb( min( LDLT_BLOCK_SIZE, n-c ) );
+
+      DynamicMatrix<ET,SO> D( cb, cb, ET(0) );
+      ldltUpdate<HERM>( D, luBlock<SO>( A, c, k0, cb, kb ),
+                        submatrix<unaligned>( W, c, 0UL, cb, kb ) );
+
+      for( size_t j=0UL; j<cb; ++j ) {
+         for( size_t i=j; i<cb; ++i ) {
+            a(c+i,c+j) += luAt<SO>( D, i, j );
+         }
+         a(c+j,c+j) = ldltDiag<HERM>( a(c+j,c+j) );
+      }
+
+      if( c+cb < n ) {
+         auto C( luBlock<SO>( A, c+cb, c, n-c-cb, cb ) );
+         ldltUpdate<HERM>( C, luBlock<SO>( A, c+cb, k0, n-c-cb, kb ),
+                           submatrix<unaligned>( W, c, 0UL, cb, kb ) );
+      }
+   }
+
+   size_t j( kb );
+   while( j > 1UL )
+   {
+      const size_t jj( k0 + j - 1UL );
+      blas_int_t jp( ipiv[jj] );
+      if( jp < 0 ) {
+         jp = -jp;
+         --j;
+      }
+      --j;
+
+      const size_t p( jp - 1 );
+      if( p != jj && j > 0UL ) {
+         for( size_t l=k0; l<k0+j; ++l ) {
+            swap( a(p,l), a(jj,l) );
+         }
+      }
+   }
+
+   return k;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked Bunch-Kaufman decomposition of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The dense matrix to be decomposed.
+// \param ipiv The pivot indices (in LAPACK convention).
+// \return 0 in case of success, \a i in case the \a i-th diagonal element of \a D is exactly zero.
+*/
+template< bool HERM      // Flag for the Hermitian decomposition
+        , bool SO        // Storage order of the dense matrix
+        , typename MT >  // Type of the dense matrix
+blas_int_t ldltFactor( MT& A, blas_int_t* ipiv )
+{
+   using ET = ElementType_t<MT>;
+
+   const size_t n( A.rows() );
+
+   DynamicMatrix<ET,columnMajor> W( n, min( n, LDLT_BLOCK_SIZE ) );
+   blas_int_t info( 0 );
+
+   size_t k( 0UL );
+   while( k < n ) {
+      k = ldltPanel<HERM,SO>( A, k, min( n, LDLT_BLOCK_SIZE ), W, ipiv, info );
+   }
+
+   return info;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Solution of a single right-hand side based on a Bunch-Kaufman decomposition.
+// \ingroup dense_matrix
+//
+// \param A The decomposed system matrix.
+// \param ipiv The pivot indices of the decomposition.
+// \param b Access function to the elements of the right-hand side.
+// \return void
+//
+// This function is the native counterpart of the LAPACK sytrs()/hetrs() functions for a single
+// right-hand side and the lower triangular part of the LAPACK view of \a A.
+*/
+template< bool HERM      // Flag for the Hermitian decomposition
+        , bool SO        // Storage order of the system matrix
+        , typename MT    // Type of the system matrix
+        , typename RHS > // Type of the access function
+void ldltSolve( const MT& A, const blas_int_t* ipiv, RHS&& b )
+{
+   using std::swap;
+
+   using ET = ElementType_t<MT>;
+
+   const size_t n( A.rows() );
+
+   const auto a( [&A]( size_t i, size_t j ) -> decltype(auto) { return luAt<SO>( A, i, j ); } );
+
+   for( size_t k=0UL; k<n; )
+   {
+      if( ipiv[k] > 0 )
+      {
+         const size_t kp( ipiv[k] - 1 );
+         if( kp != k ) swap( b(k), b(kp) );
+
+         const ET x( b(k) );
+         for( size_t i=k+1UL; i<n; ++i ) {
+            b(i) -= a(i,k) * x;
+         }
+         b(k) /= ldltDiag<HERM>( a(k,k) );
+
+         k += 1UL;
+      }
+      else
+      {
+         const size_t kp( -ipiv[k] - 1 );
+         if( kp != k+1UL ) swap( b(k+1UL), b(kp) );
+
+         const ET x1( b(k) );
+         const ET x2( b(k+1UL) );
+         for( size_t i=k+2UL; i<n; ++i ) {
+            b(i) -= a(i,k) * x1 + a(i,k+1UL) * x2;
+         }
+
+         const ET akm1k( a(k+1UL,k) );
+         const ET akm1 ( a(k,k) / ldltConj<HERM>( akm1k ) );
+         const ET ak   ( a(k+1UL,k+1UL) / akm1k );
+         const ET denom( akm1*ak - ET(1) );
+         const ET bkm1 ( x1 / ldltConj<HERM>( akm1k ) );
+         const ET bk   ( x2 / akm1k );
+
+         b(k      ) = ( ak*bkm1 - bk ) / denom;
+         b(k+1UL) = ( akm1*bk - bkm1 ) / denom;
+
+         k += 2UL;
+      }
+   }
+
+   for( size_t k=n; k-- > 0UL; )
+   {
+      ET x( b(k) );
+      for( size_t i=k+1UL; i<n; ++i ) {
+         x -= ldltConj<HERM>( a(i,k) ) * b(i);
+      }
+      b(k) = x;
+
+      if( ipiv[k] > 0 )
+      {
+         const size_t kp( ipiv[k] - 1 );
+         if( kp != k ) swap( b(k), b(kp) );
+      }
+      else
+      {
+         ET y( b(k-1UL) );
+         for( size_t i=k+1UL; i<n; ++i ) {
+            y -= ldltConj<HERM>( a(i,k-1UL) ) * b(i);
+         }
+         b(k-1UL) = y;
+
+         const size_t kp( -ipiv[k] - 1 );
+         if( kp != k ) swap( b(k), b(kp) );
+
+         --k;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Solution of multiple right-hand sides based on a Bunch-Kaufman decomposition.
+// \ingroup dense_matrix
+//
+// \param A The decomposed system matrix.
+// \param B The right-hand side matrix.
+// \param ipiv The pivot indices of the decomposition.
+// \return void
+//
+// This function solves all right-hand sides (i.e. all columns of the LAPACK view of \a B) in
+// parallel by means of the active shared memory parallelization backend.
+*/
+template< bool HERM      // Flag for the Hermitian decomposition
+        , bool SO1       // Storage order of the system matrix
+        , bool SO2       // Storage order of the right-hand side matrix
+        , typename MT1   // Type of the system matrix
+        , typename MT2 > // Type of the right-hand side matrix
+void ldltSolve( const MT1& A, MT2& B, const blas_int_t* ipiv )
+{
+   const size_t nrhs( SO2 ? B.columns() : B.rows() );
+
+   smpFor( nrhs, [&]( size_t j ) {
+      ldltSolve<HERM,SO1>( A, ipiv, [&B,j]( size_t i ) -> decltype(auto) {
+         return luAt<SO2>( B, i, j );
+      } );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Inversion of a dense matrix based on a Bunch-Kaufman decomposition.
+// \ingroup dense_matrix
+//
+// \param A The decomposed matrix to be inverted.
+// \param ipiv The pivot indices of the decomposition.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+*/
+template< bool HERM      // Flag for the Hermitian decomposition
+        , bool SO        // Storage order of the dense matrix
+        , typename MT >  // Type of the dense matrix
+void ldltInvert( MT& A, const blas_int_t* ipiv )
+{
+   using ET = ElementType_t<MT>;
+
+   const size_t n( A.rows() );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      if( ipiv[k] > 0 && isDefault<strict>( A(k,k) ) ) {
+         BLAZE_THROW_LAPACK_ERROR( "Inversion of singular matrix failed" );
+      }
+   }
+
+   DynamicMatrix<ET,columnMajor> X( n, n, ET(0) );
+   for( size_t i=0UL; i<n; ++i ) {
+      X(i,i) = ET(1);
+   }
+
+   ldltSolve<HERM,SO,columnMajor>( A, X, ipiv );
+
+   if( SO ) {
+      A = X;
+   }
+   else {
+      A = trans( X );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NATIVE BUNCH-KAUFMAN DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Native Bunch-Kaufman decomposition functions */
+//@{
+template< typename MT, bool SO >
+void sytrfBlocked( DenseMatrix<MT,SO>& A, blas_int_t* ipiv );
+
+template< typename MT, bool SO >
+void hetrfBlocked( DenseMatrix<MT,SO>& A, blas_int_t* ipiv );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+void sytrsBlocked( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& B, const blas_int_t* ipiv );
+
+template< typename MT, bool SO, typename VT, bool TF >
+void sytrsBlocked( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& b, const blas_int_t* ipiv );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+void hetrsBlocked( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& B, const blas_int_t* ipiv );
+
+template< typename MT, bool SO, typename VT, bool TF >
+void hetrsBlocked( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& b, const blas_int_t* ipiv );
+
+template< typename MT, bool SO >
+void sytriBlocked( DenseMatrix<MT,SO>& A, const blas_int_t* ipiv );
+
+template< typename MT, bool SO >
+void hetriBlocked( DenseMatrix<MT,SO>& A, const blas_int_t* ipiv );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+void sysvBlocked( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& B, blas_int_t* ipiv );
+
+template< typename MT, bool SO, typename VT, bool TF >
+void sysvBlocked( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& b, blas_int_t* ipiv );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+void hesvBlocked( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& B, blas_int_t* ipiv );
+
+template< typename MT, bool SO, typename VT, bool TF >
+void hesvBlocked( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& b, blas_int_t* ipiv );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native blocked Bunch-Kaufman decomposition of the given dense symmetric matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param ipiv Auxiliary array for the pivot indices; size >= n.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function is the native counterpart of the LAPACK sytrf() function (see
+// <tt><blaze/math/lapack/sytrf.h></tt>). It decomposes the lower triangular part of the LAPACK
+// view of \a A, i.e. the lower part of a column-major matrix and the upper part of a row-major
+// matrix, into \f$ A = L D L^{T} \f$ (\f$ A = U^{T} D U \f$ for row-major matrices), where
+// \a D is a block diagonal matrix with 1-by-1 and 2-by-2 diagonal blocks. The factors and the
+// pivot indices are stored in the same format as by the LAPACK sytrf() function for \a uplo
+// set to \c 'L' for column-major and \c 'U' for row-major matrices.
+//
+// The panels of size LDLT_BLOCK_SIZE are factorized by means of the Bunch-Kaufman diagonal
+// pivoting method, the trailing matrix updates only update the referenced triangular part and
+// are computed by means of dense matrix multiplications, which are parallelized by means of
+// the active shared memory parallelization backend. The function neither requires an external
+// LAPACK library nor an external BLAS library.
+//
+// \note The decomposition will never fail, even for singular matrices. However, in case of a
+// singular matrix the resulting decomposition cannot be used for a matrix inversion or solving
+// a linear system of equations.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void sytrfBlocked( DenseMatrix<MT,SO>& A, blas_int_t* ipiv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   ldltFactor<false,SO>( *A, ipiv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native blocked Bunch-Kaufman decomposition of the given dense Hermitian matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param ipiv Auxiliary array for the pivot indices; size >= n.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function is the native counterpart of the LAPACK hetrf() function (see
+// <tt><blaze/math/lapack/hetrf.h></tt>). It decomposes the lower triangular part of the LAPACK
+// view of \a A into \f$ A = L D L^{H} \f$ and stores the factors and the pivot indices in the
+// same format as the LAPACK hetrf() function (see sytrfBlocked() for details).
+//
+// \note The decomposition will never fail, even for singular matrices. However, in case of a
+// singular matrix the resulting decomposition cannot be used for a matrix inversion or solving
+// a linear system of equations.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void hetrfBlocked( DenseMatrix<MT,SO>& A, blas_int_t* ipiv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   ldltFactor<true,SO>( *A, ipiv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native solution of a symmetric linear system based on a Bunch-Kaufman decomposition.
+// \ingroup dense_matrix
+//
+// \param A The system matrix decomposed by sytrfBlocked().
+// \param B The right-hand side matrix.
+// \param ipiv The pivot indices of the decomposition.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+//
+// This function is the native counterpart of the LAPACK sytrs() function. It solves the system
+// \f$ A*X=B \f$ on the LAPACK views of \a A and \a B. The right-hand sides are solved in
+// parallel by means of the active shared memory parallelization backend.
+*/
+template< typename MT1  // Type of the system matrix
+        , bool SO1      // Storage order of the system matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void sytrsBlocked( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& B, const blas_int_t* ipiv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_t<MT1>, ElementType_t<MT2> );
+
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (*A).rows() != ( SO2 ? (*B).rows() : (*B).columns() ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   ldltSolve<false,SO1,SO2>( *A, *B, ipiv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native solution of a symmetric linear system based on a Bunch-Kaufman decomposition.
+// \ingroup dense_matrix
+//
+// \param A The system matrix decomposed by sytrfBlocked().
+// \param b The right-hand side vector.
+// \param ipiv The pivot indices of the decomposition.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+//
+// This function is the native counterpart of the LAPACK sytrs() function. It solves the system
+// \f$ A*x=b \f$ on the LAPACK view of \a A.
+*/
+template< typename MT  // Type of the system matrix
+        , bool SO      // Storage order of the system matrix
+        , typename VT  // Type of the right-hand side vector
+        , bool TF >    // Transpose flag of the right-hand side vector
+void sytrsBlocked( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& b, const blas_int_t* ipiv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_t<MT>, ElementType_t<VT> );
+
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (*b).size() != (*A).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   ldltSolve<false,SO>( *A, ipiv, [&b]( size_t i ) -> decltype(auto) { return (*b)[i]; } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native solution of a Hermitian linear system based on a Bunch-Kaufman decomposition.
+// \ingroup dense_matrix
+//
+// \param A The system matrix decomposed by hetrfBlocked().
+// \param B The right-hand side matrix.
+// \param ipiv The pivot indices of the decomposition.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+//
+// This function is the native counterpart of the LAPACK hetrs() function. It solves the system
+// \f$ A*X=B \f$ on the LAPACK views of \a A and \a B. The right-hand sides are solved in
+// parallel by means of the active shared memory parallelization backend.
+*/
+template< typename MT1  // Type of the system matrix
+        , bool SO1      // Storage order of the system matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void hetrsBlocked( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& B, const blas_int_t* ipiv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_t<MT1>, ElementType_t<MT2> );
+
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (*A).rows() != ( SO2 ? (*B).rows() : (*B).columns() ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   ldltSolve<true,SO1,SO2>( *A, *B, ipiv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native solution of a Hermitian linear system based on a Bunch-Kaufman decomposition.
+// \ingroup dense_matrix
+//
+// \param A The system matrix decomposed by hetrfBlocked().
+// \param b The right-hand side vector.
+// \param ipiv The pivot indices of the decomposition.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+//
+// This function is the native counterpart of the LAPACK hetrs() function. It solves the system
+// \f$ A*x=b \f$ on the LAPACK view of \a A.
+*/
+template< typename MT  // Type of the system matrix
+        , bool SO      // Storage order of the system matrix
+        , typename VT  // Type of the right-hand side vector
+        , bool TF >    // Transpose flag of the right-hand side vector
+void hetrsBlocked( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& b, const blas_int_t* ipiv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_t<MT>, ElementType_t<VT> );
+
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (*b).size() != (*A).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   ldltSolve<true,SO>( *A, ipiv, [&b]( size_t i ) -> decltype(auto) { return (*b)[i]; } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native inversion of a dense symmetric matrix based on a Bunch-Kaufman decomposition.
+// \ingroup dense_matrix
+//
+// \param A The matrix decomposed by sytrfBlocked().
+// \param ipiv The pivot indices of the decomposition.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function is the native counterpart of the LAPACK sytri() function (see
+// <tt><blaze/math/lapack/sytri.h></tt>). In contrast to sytri(), both triangular parts of
+// \a A are overwritten with the inverse. The columns of the inverse are computed in parallel
+// by means of the active shared memory parallelization backend.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void sytriBlocked( DenseMatrix<MT,SO>& A, const blas_int_t* ipiv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   ldltInvert<false,SO>( *A, ipiv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native inversion of a dense Hermitian matrix based on a Bunch-Kaufman decomposition.
+// \ingroup dense_matrix
+//
+// \param A The matrix decomposed by hetrfBlocked().
+// \param ipiv The pivot indices of the decomposition.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function is the native counterpart of the LAPACK hetri() function (see
+// <tt><blaze/math/lapack/hetri.h></tt>). In contrast to hetri(), both triangular parts of
+// \a A are overwritten with the inverse. The columns of the inverse are computed in parallel
+// by means of the active shared memory parallelization backend.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void hetriBlocked( DenseMatrix<MT,SO>& A, const blas_int_t* ipiv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   ldltInvert<true,SO>( *A, ipiv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native solution of a symmetric indefinite linear system (\f$ A*X=B \f$).
+// \ingroup dense_matrix
+//
+// \param A The symmetric system matrix.
+// \param B The right-hand side matrix.
+// \param ipiv Auxiliary array for the pivot indices; size >= n.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function is the native counterpart of the LAPACK sysv() function (see
+// <tt><blaze/math/lapack/sysv.h></tt>) for the lower triangular part of the LAPACK view of
+// \a A. On exit, \a A contains the decomposition computed by sytrfBlocked() and \a B contains
+// the solution of the system.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A may already have been modified.
+*/
+template< typename MT1  // Type of the system matrix
+        , bool SO1      // Storage order of the system matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void sysvBlocked( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& B, blas_int_t* ipiv )
+{
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (*A).rows() != ( SO2 ? (*B).rows() : (*B).columns() ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   if( ldltFactor<false,SO1>( *A, ipiv ) > 0 ) {
+      BLAZE_THROW_LAPACK_ERROR( "Inversion of singular matrix failed" );
+   }
+
+   sytrsBlocked( *A, *B, ipiv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native solution of a symmetric indefinite linear system (\f$ A*x=b \f$).
+// \ingroup dense_matrix
+//
+// \param A The symmetric system matrix.
+// \param b The right-hand side vector.
+// \param ipiv Auxiliary array for the pivot indices; size >= n.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function is the native counterpart of the LAPACK sysv() function (see
+// <tt><blaze/math/lapack/sysv.h></tt>) for the lower triangular part of the LAPACK view of
+// \a A. On exit, \a A contains the decomposition computed by sytrfBlocked() and \a b contains
+// the solution of the system.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A may already have been modified.
+*/
+template< typename MT  // Type of the system matrix
+        , bool SO      // Storage order of the system matrix
+        , typename VT  // Type of the right-hand side vector
+        , bool TF >    // Transpose flag of the right-hand side vector
+void sysvBlocked( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& b, blas_int_t* ipiv )
+{
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (*b).size() != (*A).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   if( ldltFactor<false,SO>( *A, ipiv ) > 0 ) {
+      BLAZE_THROW_LAPACK_ERROR( "Inversion of singular matrix failed" );
+   }
+
+   sytrsBlocked( *A, *b, ipiv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native solution of a Hermitian indefinite linear system (\f$ A*X=B \f$).
+// \ingroup dense_matrix
+//
+// \param A The Hermitian system matrix.
+// \param B The right-hand side matrix.
+// \param ipiv Auxiliary array for the pivot indices; size >= n.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function is the native counterpart of the LAPACK hesv() function (see
+// <tt><blaze/math/lapack/hesv.h></tt>) for the lower triangular part of the LAPACK view of
+// \a A. On exit, \a A contains the decomposition computed by hetrfBlocked() and \a B contains
+// the solution of the system.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A may already have been modified.
+*/
+template< typename MT1  // Type of the system matrix
+        , bool SO1      // Storage order of the system matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void hesvBlocked( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& B, blas_int_t* ipiv )
+{
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (*A).rows() != ( SO2 ? (*B).rows() : (*B).columns() ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   if( ldltFactor<true,SO1>( *A, ipiv ) > 0 ) {
+      BLAZE_THROW_LAPACK_ERROR( "Inversion of singular matrix failed" );
+   }
+
+   hetrsBlocked( *A, *B, ipiv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native solution of a Hermitian indefinite linear system (\f$ A*x=b \f$).
+// \ingroup dense_matrix
+//
+// \param A The Hermitian system matrix.
+// \param b The right-hand side vector.
+// \param ipiv Auxiliary array for the pivot indices; size >= n.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function is the native counterpart of the LAPACK hesv() function (see
+// <tt><blaze/math/lapack/hesv.h></tt>) for the lower triangular part of the LAPACK view of
+// \a A. On exit, \a A contains the decomposition computed by hetrfBlocked() and \a b contains
+// the solution of the system.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A may already have been modified.
+*/
+template< typename MT  // Type of the system matrix
+        , bool SO      // Storage order of the system matrix
+        , typename VT  // Type of the right-hand side vector
+        , bool TF >    // Transpose flag of the right-hand side vector
+void hesvBlocked( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& b, blas_int_t* ipiv )
+{
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (*b).size() != (*A).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   if( ldltFactor<true,SO>( *A, ipiv ) > 0 ) {
+      BLAZE_THROW_LAPACK_ERROR( "Inversion of singular matrix failed" );
+   }
+
+   hetrsBlocked( *A, *b, ipiv );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
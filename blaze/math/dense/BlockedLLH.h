@@ -0,0 +1,701 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BlockedLLH.h
+//  \brief Header file for the native blocked Cholesky (LLH) decomposition of dense matrices
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BLOCKEDLLH_H_
+#define _BLAZE_MATH_DENSE_BLOCKEDLLH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/dense/BlockedLU.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/LAPACK.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/NumericCast.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the conjugate transpose of the given dense matrix with complex element type.
+// \ingroup dense_matrix
+//
+// \param A The given dense matrix.
+// \return The conjugate transpose of the given matrix.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline auto llhAdjoint( const DenseMatrix<MT,SO>& A )
+   -> EnableIf_t< IsComplex_v< ElementType_t<MT> >, decltype( ctrans( *A ) ) >
+{
+   return ctrans( *A );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the transpose of the given dense matrix with real element type.
+// \ingroup dense_matrix
+//
+// \param A The given dense matrix.
+// \return The transpose of the given matrix.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline auto llhAdjoint( const DenseMatrix<MT,SO>& A )
+   -> DisableIf_t< IsComplex_v< ElementType_t<MT> >, decltype( trans( *A ) ) >
+{
+   return trans( *A );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Update of a block within the native Cholesky kernels (\f$ C=C-P*Q^H \f$).
+// \ingroup dense_matrix
+//
+// \param C The block to be updated.
+// \param P The left-hand side factor.
+// \param Q The right-hand side factor.
+// \return void
+//
+// The update is performed on the lower view of all three blocks, i.e. on the blocks themselves
+// in case \a T is set to \a true and on their transposes in case \a T is set to \a false. In
+// case \a SERIAL is set to \a false the update is computed by the dense matrix multiplication
+// kernels and parallelized by means of the active shared memory parallelization backend. In
+// case \a SERIAL is set to \a true the update is guaranteed to be computed by the calling
+// thread, which allows to use it within parallel tasks.
+*/
+template< bool T         // Flag for the lower view of the blocks
+        , bool SERIAL    // Flag for the serial computation of the update
+        , typename MT1   // Type of the updated block
+        , typename MT2   // Type of the left-hand side factor
+        , typename MT3 > // Type of the right-hand side factor
+inline auto llhUpdate( MT1& C, const MT2& P, const MT3& Q )
+   -> EnableIf_t< T && !SERIAL >
+{
+   C -= P * llhAdjoint( Q );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Update of a block within the native Cholesky kernels (\f$ C^T=C^T-P^T*\bar{Q} \f$).
+// \ingroup dense_matrix
+//
+// \param C The block to be updated.
+// \param P The left-hand side factor.
+// \param Q The right-hand side factor.
+// \return void
+*/
+template< bool T         // Flag for the lower view of the blocks
+        , bool SERIAL    // Flag for the serial computation of the update
+        , typename MT1   // Type of the updated block
+        , typename MT2   // Type of the left-hand side factor
+        , typename MT3 > // Type of the right-hand side factor
+inline auto llhUpdate( MT1& C, const MT2& P, const MT3& Q )
+   -> EnableIf_t< !T && !SERIAL >
+{
+   C -= llhAdjoint( Q ) * P;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial update of a block within the native Cholesky kernels (\f$ C=C-P*Q^H \f$).
+// \ingroup dense_matrix
+//
+// \param C The block to be updated.
+// \param P The left-hand side factor.
+// \param Q The right-hand side factor.
+// \return void
+*/
+template< bool T         // Flag for the lower view of the blocks
+        , bool SERIAL    // Flag for the serial computation of the update
+        , typename MT1   // Type of the updated block
+        , typename MT2   // Type of the left-hand side factor
+        , typename MT3 > // Type of the right-hand side factor
+inline auto llhUpdate( MT1& C, const MT2& P, const MT3& Q )
+   -> EnableIf_t< T && SERIAL >
+{
+   subAssign( C, P * llhAdjoint( Q ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial update of a block within the native Cholesky kernels (\f$ C^T=C^T-P^T*\bar{Q} \f$).
+// \ingroup dense_matrix
+//
+// \param C The block to be updated.
+// \param P The left-hand side factor.
+// \param Q The right-hand side factor.
+// \return void
+*/
+template< bool T         // Flag for the lower view of the blocks
+        , bool SERIAL    // Flag for the serial computation of the update
+        , typename MT1   // Type of the updated block
+        , typename MT2   // Type of the left-hand side factor
+        , typename MT3 > // Type of the right-hand side factor
+inline auto llhUpdate( MT1& C, const MT2& P, const MT3& Q )
+   -> EnableIf_t< !T && SERIAL >
+{
+   subAssign( C, llhAdjoint( Q ) * P );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unblocked Cholesky decomposition of a diagonal block within the native Cholesky kernels.
+// \ingroup dense_matrix
+//
+// \param A The dense matrix to be decomposed.
+// \param k The first row/column of the diagonal block.
+// \param n The size of the diagonal block.
+// \return 0 in case of success, \a i in case the leading minor of order \a i is not positive.
+//
+// This function computes the Cholesky decomposition of the diagonal block starting at row and
+// column \a k of the lower view of \a A (i.e. of \a A itself in case \a T is \a true and of its
+// transpose in case \a T is \a false). All contributions of the columns left of the block must
+// already have been applied.
+*/
+template< bool T         // Flag for the lower view of the matrix
+        , typename MT >  // Type of the dense matrix
+blas_int_t llhFactor( MT& A, size_t k, size_t n )
+{
+   using std::sqrt;
+
+   using ET = ElementType_t<MT>;
+
+   for( size_t j=k; j<k+n; ++j )
+   {
+      auto d( real( luAt<T>( A, j, j ) ) );
+      for( size_t l=k; l<j; ++l ) {
+         d -= real( luAt<T>( A, j, l ) * conj( luAt<T>( A, j, l ) ) );
+      }
+
+      if( !( d > decltype(d)(0) ) ) {
+         return numeric_cast<blas_int_t>( j + 1UL );
+      }
+
+      d = sqrt( d );
+      luAt<T>( A, j, j ) = ET( d );
+
+      for( size_t l=k; l<j; ++l ) {
+         const ET x( conj( luAt<T>( A, j, l ) ) );
+         for( size_t i=j+1UL; i<k+n; ++i ) {
+            luAt<T>( A, i, j ) -= luAt<T>( A, i, l ) * x;
+         }
+      }
+
+      for( size_t i=j+1UL; i<k+n; ++i ) {
+         luAt<T>( A, i, j ) /= d;
+      }
+   }
+
+   return 0;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Recursive triangular solve within the native Cholesky kernels (\f$ X=X*L^{-H} \f$).
+// \ingroup dense_matrix
+//
+// \param A The dense matrix containing both the triangular factor \a L and the block \a X.
+// \param k The first row/column of the triangular factor \a L.
+// \param n The size of the triangular factor \a L.
+// \param i The first row of the block \a X (columns \f$[k..k+n-1]\f$).
+// \param m The number of rows of the block \a X.
+// \return void
+//
+// This function overwrites the block \a X of the lower view of \a A with \f$ X*L^{-H} \f$, where
+// \a L is the lower triangular diagonal block starting at row/column \a k. The solve is
+// recursively split in halves, such that the bulk of the work is performed by dense matrix
+// multiplications.
+*/
+template< bool T         // Flag for the lower view of the matrix
+        , bool SERIAL    // Flag for the serial computation
+        , typename MT >  // Type of the dense matrix
+void llhTrsm( MT& A, size_t k, size_t n, size_t i, size_t m )
+{
+   using ET = ElementType_t<MT>;
+
+   if( n <= LLH_LEAF_SIZE )
+   {
+      for( size_t j=k; j<k+n; ++j )
+      {
+         for( size_t l=k; l<j; ++l ) {
+            const ET x( conj( luAt<T>( A, j, l ) ) );
+            for( size_t r=i; r<i+m; ++r ) {
+               luAt<T>( A, r, j ) -= luAt<T>( A, r, l ) * x;
+            }
+         }
+
+         const auto d( real( luAt<T>( A, j, j ) ) );
+         for( size_t r=i; r<i+m; ++r ) {
+            luAt<T>( A, r, j ) /= d;
+         }
+      }
+      return;
+   }
+
+   const size_t n1( n / 2UL );
+   const size_t n2( n - n1 );
+
+   llhTrsm<T,SERIAL>( A, k, n1, i, m );
+
+   auto C( luBlock<T>( A, i, k+n1, m, n2 ) );
+   llhUpdate<T,SERIAL>( C, luBlock<T>( A, i, k, m, n1 ), luBlock<T>( A, k+n1, k, n2, n1 ) );
+
+   llhTrsm<T,SERIAL>( A, k+n1, n2, i, m );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Recursive Hermitian rank-k update within the native Cholesky kernels.
+// \ingroup dense_matrix
+//
+// \param A The dense matrix containing both the updated block \a S and the factor \a P.
+// \param i The first row/column of the updated diagonal block \a S.
+// \param m The size of the updated diagonal block \a S.
+// \param k The first column of the factor \a P (rows \f$[i..i+m-1]\f$).
+// \param n The number of columns of the factor \a P.
+// \return void
+//
+// This function performs the update \f$ S=S-P*P^H \f$ on the lower triangular part of the
+// diagonal block \a S of the lower view of \a A. The strictly upper triangular part of \a S
+// is not modified. The diagonal block is recursively split in halves, such that the bulk of
+// the work is performed by dense matrix multiplications on the off-diagonal blocks.
+*/
+template< bool T         // Flag for the lower view of the matrix
+        , bool SERIAL    // Flag for the serial computation
+        , typename MT >  // Type of the dense matrix
+void llhSyrk( MT& A, size_t i, size_t m, size_t k, size_t n )
+{
+   using ET = ElementType_t<MT>;
+
+   if( m <= LLH_BLOCK_SIZE )
+   {
+      DynamicMatrix<ET,columnMajor> D( m, m, ET(0) );
+      llhUpdate<T,true>( D, luBlock<T>( A, i, k, m, n ), luBlock<T>( A, i, k, m, n ) );
+
+      for( size_t c=0UL; c<m; ++c ) {
+         for( size_t r=c; r<m; ++r ) {
+            luAt<T>( A, i+r, i+c ) += luAt<T>( D, r, c );
+         }
+      }
+      return;
+   }
+
+   const size_t m1( m / 2UL );
+   const size_t m2( m - m1 );
+
+   llhSyrk<T,SERIAL>( A, i, m1, k, n );
+
+   auto C( luBlock<T>( A, i+m1, i, m2, m1 ) );
+   llhUpdate<T,SERIAL>( C, luBlock<T>( A, i+m1, k, m2, n ), luBlock<T>( A, i, k, m1, n ) );
+
+   llhSyrk<T,SERIAL>( A, i+m1, m2, k, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked Cholesky decomposition of the lower view of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The dense matrix to be decomposed.
+// \return 0 in case of success, \a i in case the leading minor of order \a i is not positive.
+//
+// This function implements a right-looking blocked Cholesky decomposition. The trailing matrix
+// updates only update the lower triangular part (SYRK-style) and are computed by means of
+// dense matrix multiplications, which are parallelized by the active shared memory
+// parallelization backend.
+*/
+template< bool T         // Flag for the lower view of the matrix
+        , typename MT >  // Type of the dense matrix
+blas_int_t llhBlocked( MT& A )
+{
+   const size_t n( A.rows() );
+
+   for( size_t k=0UL; k<n; k+=LLH_BLOCK_SIZE )
+   {
+      const size_t kb( min( LLH_BLOCK_SIZE, n-k ) );
+
+      const blas_int_t info( llhFactor<T>( A, k, kb ) );
+      if( info > 0 ) return info;
+
+      if( k+kb < n ) {
+         llhTrsm<T,false>( A, k, kb, k+kb, n-k-kb );
+         llhSyrk<T,false>( A, k+kb, n-k-kb, k, kb );
+      }
+   }
+
+   return 0;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Tiled Cholesky decomposition of the lower view of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The dense matrix to be decomposed.
+// \return 0 in case of success, \a i in case the leading minor of order \a i is not positive.
+//
+// This function implements the tile Cholesky decomposition. The matrix is partitioned into
+// square tiles of size LLH_TILE_SIZE. In each step, the diagonal tile is decomposed, after
+// which all triangular solves of the tile column and all updates of the trailing tiles are
+// executed as independent tasks by means of the active shared memory parallelization backend.
+// Each single task is computed serially by the executing thread.
+*/
+template< bool T         // Flag for the lower view of the matrix
+        , typename MT >  // Type of the dense matrix
+blas_int_t llhTiled( MT& A )
+{
+   const size_t n( A.rows() );
+   const size_t tiles( ( n + LLH_TILE_SIZE - 1UL ) / LLH_TILE_SIZE );
+
+   const auto first( []( size_t t ) { return t * LLH_TILE_SIZE; } );
+   const auto size ( [n]( size_t t ) { return min( LLH_TILE_SIZE, n - t*LLH_TILE_SIZE ); } );
+
+   for( size_t k=0UL; k<tiles; ++k )
+   {
+      const size_t k0( first( k ) );
+      const size_t kb( size( k ) );
+
+      const blas_int_t info( llhFactor<T>( A, k0, kb ) );
+      if( info > 0 ) return info;
+
+      const size_t rest( tiles - k - 1UL );
+
+      smpFor( rest, [&]( size_t t ) {
+         const size_t i( k + 1UL + t );
+         llhTrsm<T,true>( A, k0, kb, first( i ), size( i ) );
+      } );
+
+      smpFor( rest*(rest+1UL)/2UL, [&]( size_t t )
+      {
+         size_t i( 0UL );
+         while( ( i+1UL )*( i+2UL )/2UL <= t ) ++i;
+         const size_t j( t - i*( i+1UL )/2UL );
+
+         const size_t i0( first( k+1UL+i ) ), ib( size( k+1UL+i ) );
+         const size_t j0( first( k+1UL+j ) ), jb( size( k+1UL+j ) );
+
+         if( i == j ) {
+            llhSyrk<T,true>( A, i0, ib, k0, kb );
+         }
+         else {
+            auto C( luBlock<T>( A, i0, j0, ib, jb ) );
+            llhUpdate<T,true>( C, luBlock<T>( A, i0, k0, ib, kb ),
+                                  luBlock<T>( A, j0, k0, jb, kb ) );
+         }
+      } );
+   }
+
+   return 0;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NATIVE CHOLESKY DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Native Cholesky decomposition functions */
+//@{
+template< typename MT, bool SO >
+void potrfBlocked( DenseMatrix<MT,SO>& A, char uplo );
+
+template< typename MT, bool SO >
+void potrfTiled( DenseMatrix<MT,SO>& A, char uplo );
+
+template< typename MT, bool SO >
+void potriBlocked( DenseMatrix<MT,SO>& A, char uplo );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native blocked Cholesky decomposition of the given dense positive definite matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// This function is the native counterpart of the LAPACK potrf() function (see
+// <tt><blaze/math/lapack/potrf.h></tt>) and provides the same semantics: The resulting
+// decomposition has the form \f$ A = L L^{H} \f$ in case \a uplo is set to \c 'L' and the form
+// \f$ A = U^{H} U \f$ in case \a uplo is set to \c 'U'. The factor is stored in the according
+// triangular part of \a A, the other triangular part is not referenced.
+//
+// The function implements a right-looking blocked Cholesky decomposition. Only the referenced
+// triangular part is updated, and all trailing updates are computed by means of dense matrix
+// multiplications, which are parallelized by means of the active shared memory parallelization
+// backend. In case the BLAZE_USE_TILED_LLH_DECOMPOSITION switch is activated, the tiled Cholesky
+// decomposition (see potrfTiled()) is used instead. The function neither requires an external
+// LAPACK library nor an external BLAS library.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A may already have been modified.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void potrfBlocked( DenseMatrix<MT,SO>& A, char uplo )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( uplo != 'L' && uplo != 'U' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid uplo argument provided" );
+   }
+
+#if BLAZE_USE_TILED_LLH_DECOMPOSITION
+   const blas_int_t info( ( uplo == 'L' )?( llhTiled<true>( *A ) ):( llhTiled<false>( *A ) ) );
+#else
+   const blas_int_t info( ( uplo == 'L' )?( llhBlocked<true>( *A ) ):( llhBlocked<false>( *A ) ) );
+#endif
+
+   if( info > 0 ) {
+      BLAZE_THROW_LAPACK_ERROR( "Decomposition of non-positive-definite matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native tiled Cholesky decomposition of the given dense positive definite matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// This function computes the same decomposition as potrfBlocked(), but implements the tile
+// Cholesky decomposition: The matrix is partitioned into square tiles of size LLH_TILE_SIZE
+// and in each step all triangular solves and all trailing tile updates are executed as
+// independent serial tasks. Compared to potrfBlocked(), which parallelizes every single
+// trailing update, this results in a coarser granularity of parallelism and usually scales
+// better on systems with many cores.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A may already have been modified.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void potrfTiled( DenseMatrix<MT,SO>& A, char uplo )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( uplo != 'L' && uplo != 'U' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid uplo argument provided" );
+   }
+
+   const blas_int_t info( ( uplo == 'L' )?( llhTiled<true>( *A ) ):( llhTiled<false>( *A ) ) );
+
+   if( info > 0 ) {
+      BLAZE_THROW_LAPACK_ERROR( "Decomposition of non-positive-definite matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native inversion of a dense positive definite matrix based on a Cholesky decomposition.
+// \ingroup dense_matrix
+//
+// \param A The Cholesky decomposed matrix to be inverted.
+// \param uplo \c 'L' in case the lower part of the matrix holds the factor, \c 'U' otherwise.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function is the native counterpart of the LAPACK potri() function (see
+// <tt><blaze/math/lapack/potri.h></tt>) for matrices that have already been decomposed by
+// potrfBlocked(). In contrast to potri(), both triangular parts of \a A are overwritten with
+// the inverse. The columns of the inverse are computed in parallel by means of the active
+// shared memory parallelization backend.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void potriBlocked( DenseMatrix<MT,SO>& A, char uplo )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   using ET = ElementType_t<MT>;
+
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( uplo != 'L' && uplo != 'U' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid uplo argument provided" );
+   }
+
+   const size_t n( (*A).rows() );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( isDefault<strict>( (*A)(i,i) ) ) {
+         BLAZE_THROW_LAPACK_ERROR( "Inversion of singular matrix failed" );
+      }
+   }
+
+   DynamicMatrix<ET,columnMajor> X( n, n );
+
+   const auto solve( [&]( auto lower, size_t j )
+   {
+      constexpr bool T( decltype( lower )::value );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         X(i,j) = ( i == j )?( ET(1) ):( ET(0) );
+      }
+
+      for( size_t l=j; l<n; ++l ) {
+         X(l,j) /= real( luAt<T>( *A, l, l ) );
+         const ET x( X(l,j) );
+         for( size_t i=l+1UL; i<n; ++i ) {
+            X(i,j) -= luAt<T>( *A, i, l ) * x;
+         }
+      }
+
+      for( size_t l=n; l-- > 0UL; ) {
+         ET x( X(l,j) );
+         for( size_t i=l+1UL; i<n; ++i ) {
+            x -= conj( luAt<T>( *A, i, l ) ) * X(i,j);
+         }
+         X(l,j) = x / real( luAt<T>( *A, l, l ) );
+      }
+   } );
+
+   smpFor( n, [&]( size_t j ) {
+      if( uplo == 'L' ) solve( TrueType(), j );
+      else solve( FalseType(), j );
+   } );
+
+   if( uplo == 'L' ) {
+      *A = X;
+   }
+   else {
+      *A = conj( X );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
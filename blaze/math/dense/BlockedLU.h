@@ -0,0 +1,780 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BlockedLU.h
+//  \brief Header file for the native blocked LU decomposition of dense matrices
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BLOCKEDLU_H_
+#define _BLAZE_MATH_DENSE_BLOCKEDLU_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/NumericCast.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Access to an element of the LAPACK view of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The given dense matrix.
+// \param i The row index of the element in the LAPACK view.
+// \param j The column index of the element in the LAPACK view.
+// \return Reference to the accessed element.
+//
+// LAPACK interprets the storage of any matrix as column-major storage. Therefore the LAPACK view
+// of a column-major matrix is the matrix itself, whereas the LAPACK view of a row-major matrix
+// is its transpose. All native LU kernels operate on the LAPACK view in order to provide the
+// same semantics as the according LAPACK functions.
+*/
+template< bool SO        // Storage order of the dense matrix
+        , typename MT >  // Type of the dense matrix
+inline decltype(auto) luAt( MT& A, size_t i, size_t j )
+{
+   return ( SO ? A(i,j) : A(j,i) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a submatrix corresponding to a block of the LAPACK view of a dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The given dense matrix.
+// \param i The first row of the block in the LAPACK view.
+// \param j The first column of the block in the LAPACK view.
+// \param m The number of rows of the block in the LAPACK view.
+// \param n The number of columns of the block in the LAPACK view.
+// \return View on the according block of the given matrix.
+*/
+template< bool SO        // Storage order of the dense matrix
+        , typename MT >  // Type of the dense matrix
+inline decltype(auto) luBlock( MT& A, size_t i, size_t j, size_t m, size_t n )
+{
+   return ( SO ? submatrix<unaligned>( A, i, j, m, n ) : submatrix<unaligned>( A, j, i, n, m ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the LAPACK view of the given column-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The given column-major dense matrix.
+// \return Reference to the given matrix.
+*/
+template< typename MT >  // Type of the dense matrix
+inline const MT& luOperand( const DenseMatrix<MT,columnMajor>& A )
+{
+   return *A;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the LAPACK view of the given row-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The given row-major dense matrix.
+// \return The transpose of the given matrix.
+*/
+template< typename MT >  // Type of the dense matrix
+inline decltype(auto) luOperand( const DenseMatrix<MT,rowMajor>& A )
+{
+   return trans( *A );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Update of a block of a column-major dense matrix within the native LU kernels.
+// \ingroup dense_matrix
+//
+// \param C The block to be updated.
+// \param P The left-hand side factor (block of the LU decomposition).
+// \param Q The right-hand side factor (block of the same matrix as \a C).
+// \return void
+//
+// This function performs the update \f$ C=C-P*Q \f$ on the LAPACK views of the three given
+// blocks. The update is performed by means of a dense matrix multiplication, i.e. it is
+// computed by the dense matrix multiplication kernels and is parallelized by means of the
+// active shared memory parallelization backend.
+*/
+template< typename MT1  // Type of the updated block
+        , typename MT2  // Type of the left-hand side factor
+        , bool SO       // Storage order of the left-hand side factor
+        , typename MT3 > // Type of the right-hand side factor
+inline void luUpdate( DenseMatrix<MT1,columnMajor>& C, const DenseMatrix<MT2,SO>& P,
+                      const DenseMatrix<MT3,columnMajor>& Q )
+{
+   *C -= luOperand( *P ) * (*Q);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Update of a block of a row-major dense matrix within the native LU kernels.
+// \ingroup dense_matrix
+//
+// \param C The block to be updated.
+// \param P The left-hand side factor (block of the LU decomposition).
+// \param Q The right-hand side factor (block of the same matrix as \a C).
+// \return void
+//
+// This function performs the update \f$ C^T=C^T-P^T*Q^T \f$ on the LAPACK views of the three
+// given blocks (i.e. \f$ C=C-Q*P \f$ in case \a P is a row-major block).
+*/
+template< typename MT1  // Type of the updated block
+        , typename MT2  // Type of the left-hand side factor
+        , bool SO       // Storage order of the left-hand side factor
+        , typename MT3 > // Type of the right-hand side factor
+inline void luUpdate( DenseMatrix<MT1,rowMajor>& C, const DenseMatrix<MT2,SO>& P,
+                      const DenseMatrix<MT3,rowMajor>& Q )
+{
+   *C -= (*Q) * trans( luOperand( *P ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Application of row interchanges to the LAPACK view of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param X The dense matrix to be permuted.
+// \param ipiv The pivot indices (in LAPACK convention, i.e. starting from 1).
+// \param k1 The index of the first applied pivot index.
+// \param k2 The index one past the last applied pivot index.
+// \param j1 The first column (of the LAPACK view) to be permuted.
+// \param j2 The column (of the LAPACK view) one past the last permuted column.
+// \return void
+//
+// This function implements the native counterpart of the LAPACK laswp() function.
+*/
+template< bool SO        // Storage order of the dense matrix
+        , typename MT >  // Type of the dense matrix
+void luSwap( MT& X, const blas_int_t* ipiv, size_t k1, size_t k2, size_t j1, size_t j2 )
+{
+   using std::swap;
+
+   for( size_t j=j1; j<j2; ++j ) {
+      for( size_t k=k1; k<k2; ++k ) {
+         const size_t p( ipiv[k] - 1 );
+         if( p != k ) {
+            swap( luAt<SO>( X, k, j ), luAt<SO>( X, p, j ) );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Recursive solution of a lower unitriangular system within the native LU kernels.
+// \ingroup dense_matrix
+//
+// \param A The LU decomposed dense matrix.
+// \param k The first row/column of the unitriangular factor within \a A.
+// \param n The size of the unitriangular factor.
+// \param X The right-hand side matrix.
+// \param i The first row (of the LAPACK view) of the right-hand side block.
+// \param j1 The first column (of the LAPACK view) of the right-hand side block.
+// \param j2 The column (of the LAPACK view) one past the last column of the right-hand side block.
+// \return void
+//
+// This function overwrites the given block of the LAPACK view of \a X with the solution of the
+// system \f$ L*Y=X \f$, where \a L is the lower unitriangular block of the LAPACK view of \a A
+// starting at row/column \a k. The system is recursively split in halves, such that the bulk
+// of the work is performed by dense matrix multiplications.
+*/
+template< bool SO1       // Storage order of the LU decomposed matrix
+        , bool SO2       // Storage order of the right-hand side matrix
+        , typename MT1   // Type of the LU decomposed matrix
+        , typename MT2 > // Type of the right-hand side matrix
+void luTrsmLower( const MT1& A, size_t k, size_t n, MT2& X, size_t i, size_t j1, size_t j2 )
+{
+   if( n <= LU_LEAF_SIZE )
+   {
+      for( size_t j=j1; j<j2; ++j ) {
+         for( size_t l=0UL; l<n; ++l ) {
+            const auto x( luAt<SO2>( X, i+l, j ) );
+            for( size_t r=l+1UL; r<n; ++r ) {
+               luAt<SO2>( X, i+r, j ) -= luAt<SO1>( A, k+r, k+l ) * x;
+            }
+         }
+      }
+      return;
+   }
+
+   const size_t n1( n / 2UL );
+   const size_t n2( n - n1 );
+
+   luTrsmLower<SO1,SO2>( A, k, n1, X, i, j1, j2 );
+
+   auto C( luBlock<SO2>( X, i+n1, j1, n2, j2-j1 ) );
+   luUpdate( C, luBlock<SO1>( A, k+n1, k, n2, n1 ), luBlock<SO2>( X, i, j1, n1, j2-j1 ) );
+
+   luTrsmLower<SO1,SO2>( A, k+n1, n2, X, i+n1, j1, j2 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Recursive solution of an upper triangular system within the native LU kernels.
+// \ingroup dense_matrix
+//
+// \param A The LU decomposed dense matrix.
+// \param k The first row/column of the triangular factor within \a A.
+// \param n The size of the triangular factor.
+// \param X The right-hand side matrix.
+// \param i The first row (of the LAPACK view) of the right-hand side block.
+// \param j1 The first column (of the LAPACK view) of the right-hand side block.
+// \param j2 The column (of the LAPACK view) one past the last column of the right-hand side block.
+// \return void
+//
+// This function overwrites the given block of the LAPACK view of \a X with the solution of the
+// system \f$ U*Y=X \f$, where \a U is the upper triangular block of the LAPACK view of \a A
+// starting at row/column \a k. The system is recursively split in halves, such that the bulk
+// of the work is performed by dense matrix multiplications.
+*/
+template< bool SO1       // Storage order of the LU decomposed matrix
+        , bool SO2       // Storage order of the right-hand side matrix
+        , typename MT1   // Type of the LU decomposed matrix
+        , typename MT2 > // Type of the right-hand side matrix
+void luTrsmUpper( const MT1& A, size_t k, size_t n, MT2& X, size_t i, size_t j1, size_t j2 )
+{
+   if( n <= LU_LEAF_SIZE )
+   {
+      for( size_t j=j1; j<j2; ++j ) {
+         for( size_t l=n; l-- > 0UL; ) {
+            luAt<SO2>( X, i+l, j ) /= luAt<SO1>( A, k+l, k+l );
+            const auto x( luAt<SO2>( X, i+l, j ) );
+            for( size_t r=0UL; r<l; ++r ) {
+               luAt<SO2>( X, i+r, j ) -= luAt<SO1>( A, k+r, k+l ) * x;
+            }
+         }
+      }
+      return;
+   }
+
+   const size_t n1( n / 2UL );
+   const size_t n2( n - n1 );
+
+   luTrsmUpper<SO1,SO2>( A, k+n1, n2, X, i+n1, j1, j2 );
+
+   auto C( luBlock<SO2>( X, i, j1, n1, j2-j1 ) );
+   luUpdate( C, luBlock<SO1>( A, k, k+n1, n1, n2 ), luBlock<SO2>( X, i+n1, j1, n2, j2-j1 ) );
+
+   luTrsmUpper<SO1,SO2>( A, k, n1, X, i, j1, j2 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Recursive LU decomposition of a panel within the native LU kernels.
+// \ingroup dense_matrix
+//
+// \param A The dense matrix to be decomposed.
+// \param k The first row/column of the panel.
+// \param n The number of columns of the panel.
+// \param ipiv The pivot indices (in LAPACK convention, i.e. starting from 1).
+// \param info The index of the first exactly zero pivot (in LAPACK convention).
+// \return void
+//
+// This function computes the LU decomposition with partial pivoting of the panel consisting of
+// the columns \f$[k..k+n-1]\f$ of the LAPACK view of \a A (starting at row \a k). Row
+// interchanges are only applied within the panel. The panel is recursively split in halves
+// (Gustavson, Toledo), such that the bulk of the work is performed by dense matrix
+// multiplications.
+*/
+template< bool SO        // Storage order of the dense matrix
+        , typename MT >  // Type of the dense matrix
+void luPanel( MT& A, size_t k, size_t n, blas_int_t* ipiv, blas_int_t& info )
+{
+   using std::abs;
+   using std::swap;
+
+   const size_t m( SO ? A.rows() : A.columns() );
+
+   if( n <= LU_LEAF_SIZE )
+   {
+      for( size_t j=k; j<k+n; ++j )
+      {
+         size_t p( j );
+         auto pmax( abs( luAt<SO>( A, j, j ) ) );
+         for( size_t i=j+1UL; i<m; ++i ) {
+            if( abs( luAt<SO>( A, i, j ) ) > pmax ) {
+               p = i;
+               pmax = abs( luAt<SO>( A, i, j ) );
+            }
+         }
+
+         ipiv[j] = numeric_cast<blas_int_t>( p + 1UL );
+
+         if( isDefault<strict>( luAt<SO>( A, p, j ) ) ) {
+            if( info == 0 ) info = numeric_cast<blas_int_t>( j + 1UL );
+            continue;
+         }
+
+         if( p != j ) {
+            for( size_t l=k; l<k+n; ++l ) {
+               swap( luAt<SO>( A, j, l ), luAt<SO>( A, p, l ) );
+            }
+         }
+
+         const auto pivot( luAt<SO>( A, j, j ) );
+         for( size_t i=j+1UL; i<m; ++i ) {
+            luAt<SO>( A, i, j ) /= pivot;
+         }
+
+         for( size_t l=j+1UL; l<k+n; ++l ) {
+            const auto u( luAt<SO>( A, j, l ) );
+            for( size_t i=j+1UL; i<m; ++i ) {
+               luAt<SO>( A, i, l ) -= luAt<SO>( A, i, j ) * u;
+            }
+         }
+      }
+      return;
+   }
+
+   const size_t n1( n / 2UL );
+   const size_t n2( n - n1 );
+
+   luPanel<SO>( A, k, n1, ipiv, info );
+
+   luSwap<SO>( A, ipiv, k, k+n1, k+n1, k+n );
+   luTrsmLower<SO,SO>( A, k, n1, A, k, k+n1, k+n );
+
+   auto C( luBlock<SO>( A, k+n1, k+n1, m-k-n1, n2 ) );
+   luUpdate( C, luBlock<SO>( A, k+n1, k, m-k-n1, n1 ), luBlock<SO>( A, k, k+n1, n1, n2 ) );
+
+   luPanel<SO>( A, k+n1, n2, ipiv, info );
+
+   luSwap<SO>( A, ipiv, k+n1, k+n, k, k+n1 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NATIVE LU DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Native LU decomposition functions */
+//@{
+template< typename MT, bool SO >
+blas_int_t getrfBlocked( DenseMatrix<MT,SO>& A, blas_int_t* ipiv );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+void getrsBlocked( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& B, const blas_int_t* ipiv );
+
+template< typename MT, bool SO, typename VT, bool TF >
+void getrsBlocked( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& b, const blas_int_t* ipiv );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+void gesvBlocked( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& B, blas_int_t* ipiv );
+
+template< typename MT, bool SO, typename VT, bool TF >
+void gesvBlocked( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& b, blas_int_t* ipiv );
+
+template< typename MT, bool SO >
+void getriBlocked( DenseMatrix<MT,SO>& A, const blas_int_t* ipiv );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native blocked LU decomposition of the given dense general matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \return 0 in case of success, \a i in case the \a i-th pivot is exactly zero.
+//
+// This function is the native counterpart of the LAPACK getrf() function (see
+// <tt><blaze/math/lapack/getrf.h></tt>) and provides exactly the same semantics: In case of
+// a column-major matrix the resulting decomposition has the form \f$ A = P \cdot L \cdot U \f$,
+// in case of a row-major matrix it has the form \f$ A = L \cdot U \cdot P \f$. Both factors are
+// stored within \a A and the pivot indices are stored in \a ipiv (starting from 1).
+//
+// The function implements a right-looking blocked LU decomposition with partial pivoting. The
+// panels of size LU_BLOCK_SIZE are decomposed recursively, the trailing matrix updates are
+// performed by means of dense matrix multiplications and are therefore parallelized by means of
+// the active shared memory parallelization backend. The function neither requires an external
+// LAPACK library nor an external BLAS library.
+//
+// \note The LU decomposition will never fail, even for singular matrices. However, in case of a
+// singular matrix the resulting decomposition cannot be used for a matrix inversion or solving
+// a linear system of equations.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+blas_int_t getrfBlocked( DenseMatrix<MT,SO>& A, blas_int_t* ipiv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   const size_t m( SO ? (*A).rows() : (*A).columns() );
+   const size_t n( SO ? (*A).columns() : (*A).rows() );
+   const size_t mindim( min( m, n ) );
+
+   blas_int_t info( 0 );
+
+   for( size_t k=0UL; k<mindim; k+=LU_BLOCK_SIZE )
+   {
+      const size_t nb( min( LU_BLOCK_SIZE, mindim-k ) );
+
+      luPanel<SO>( *A, k, nb, ipiv, info );
+
+      luSwap<SO>( *A, ipiv, k, k+nb, 0UL, k );
+
+      if( k+nb < n )
+      {
+         luSwap<SO>( *A, ipiv, k, k+nb, k+nb, n );
+         luTrsmLower<SO,SO>( *A, k, nb, *A, k, k+nb, n );
+
+         if( k+nb < m ) {
+            auto C( luBlock<SO>( *A, k+nb, k+nb, m-k-nb, n-k-nb ) );
+            luUpdate( C, luBlock<SO>( *A, k+nb, k, m-k-nb, nb ),
+                         luBlock<SO>( *A, k, k+nb, nb, n-k-nb ) );
+         }
+      }
+   }
+
+   return info;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native solution of a linear system based on a blocked LU decomposition.
+// \ingroup dense_matrix
+//
+// \param A The LU decomposed system matrix.
+// \param B The right-hand side matrix.
+// \param ipiv The pivot indices of the LU decomposition.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+//
+// This function is the native counterpart of the LAPACK getrs() function for non-transposed
+// systems. It solves the system \f$ A*X=B \f$ on the LAPACK views of \a A and \a B (i.e.
+// \f$ A^T*X=B \f$ in case \a A is a row-major matrix and \f$ A*X^T=B^T \f$ in case \a B is a
+// row-major matrix), where \a A has been decomposed by getrfBlocked(). On exit, \a B contains
+// the solution \a X.
+*/
+template< typename MT1  // Type of the system matrix
+        , bool SO1      // Storage order of the system matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void getrsBlocked( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& B, const blas_int_t* ipiv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_t<MT1>, ElementType_t<MT2> );
+
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const size_t n   ( (*A).rows() );
+   const size_t mrhs( SO2 ? (*B).rows() : (*B).columns() );
+   const size_t nrhs( SO2 ? (*B).columns() : (*B).rows() );
+
+   if( n != mrhs ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   if( n == 0UL || nrhs == 0UL ) {
+      return;
+   }
+
+   luSwap<SO2>( *B, ipiv, 0UL, n, 0UL, nrhs );
+   luTrsmLower<SO1,SO2>( *A, 0UL, n, *B, 0UL, 0UL, nrhs );
+   luTrsmUpper<SO1,SO2>( *A, 0UL, n, *B, 0UL, 0UL, nrhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native solution of a linear system based on a blocked LU decomposition.
+// \ingroup dense_matrix
+//
+// \param A The LU decomposed system matrix.
+// \param b The right-hand side vector.
+// \param ipiv The pivot indices of the LU decomposition.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+//
+// This function is the native counterpart of the LAPACK getrs() function for non-transposed
+// systems. It solves the system \f$ A*x=b \f$ on the LAPACK view of \a A (i.e. \f$ A^T*x=b \f$
+// in case \a A is a row-major matrix), where \a A has been decomposed by getrfBlocked(). On
+// exit, \a b contains the solution \a x.
+*/
+template< typename MT  // Type of the system matrix
+        , bool SO      // Storage order of the system matrix
+        , typename VT  // Type of the right-hand side vector
+        , bool TF >    // Transpose flag of the right-hand side vector
+void getrsBlocked( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& b, const blas_int_t* ipiv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_t<MT>, ElementType_t<VT> );
+
+   using std::swap;
+
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (*b).size() != (*A).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   const size_t n( (*A).rows() );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      const size_t p( ipiv[k] - 1 );
+      if( p != k ) {
+         swap( (*b)[k], (*b)[p] );
+      }
+   }
+
+   for( size_t j=0UL; j<n; ++j ) {
+      const auto x( (*b)[j] );
+      for( size_t i=j+1UL; i<n; ++i ) {
+         (*b)[i] -= luAt<SO>( *A, i, j ) * x;
+      }
+   }
+
+   for( size_t j=n; j-- > 0UL; ) {
+      (*b)[j] /= luAt<SO>( *A, j, j );
+      const auto x( (*b)[j] );
+      for( size_t i=0UL; i<j; ++i ) {
+         (*b)[i] -= luAt<SO>( *A, i, j ) * x;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native solution of a general linear system based on a blocked LU decomposition.
+// \ingroup dense_matrix
+//
+// \param A The system matrix.
+// \param B The right-hand side matrix.
+// \param ipiv Auxiliary array for the pivot indices; size >= n.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function is the native counterpart of the LAPACK gesv() function (see
+// <tt><blaze/math/lapack/gesv.h></tt>) and provides the same semantics. On exit, \a A contains
+// the LU decomposition computed by getrfBlocked() and \a B contains the solution of the system.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A may already have been modified.
+*/
+template< typename MT1  // Type of the system matrix
+        , bool SO1      // Storage order of the system matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void gesvBlocked( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& B, blas_int_t* ipiv )
+{
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (*A).rows() != ( SO2 ? (*B).rows() : (*B).columns() ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   if( getrfBlocked( *A, ipiv ) > 0 ) {
+      BLAZE_THROW_LAPACK_ERROR( "Inversion of singular matrix failed" );
+   }
+
+   getrsBlocked( *A, *B, ipiv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native solution of a general linear system based on a blocked LU decomposition.
+// \ingroup dense_matrix
+//
+// \param A The system matrix.
+// \param b The right-hand side vector.
+// \param ipiv Auxiliary array for the pivot indices; size >= n.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function is the native counterpart of the LAPACK gesv() function (see
+// <tt><blaze/math/lapack/gesv.h></tt>) and provides the same semantics. On exit, \a A contains
+// the LU decomposition computed by getrfBlocked() and \a b contains the solution of the system.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A may already have been modified.
+*/
+template< typename MT  // Type of the system matrix
+        , bool SO      // Storage order of the system matrix
+        , typename VT  // Type of the right-hand side vector
+        , bool TF >    // Transpose flag of the right-hand side vector
+void gesvBlocked( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& b, blas_int_t* ipiv )
+{
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (*b).size() != (*A).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   if( getrfBlocked( *A, ipiv ) > 0 ) {
+      BLAZE_THROW_LAPACK_ERROR( "Inversion of singular matrix failed" );
+   }
+
+   getrsBlocked( *A, *b, ipiv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native inversion of a dense general matrix based on a blocked LU decomposition.
+// \ingroup dense_matrix
+//
+// \param A The LU decomposed matrix to be inverted.
+// \param ipiv The pivot indices of the LU decomposition.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function is the native counterpart of the LAPACK getri() function (see
+// <tt><blaze/math/lapack/getri.h></tt>) for matrices that have already been decomposed by
+// getrfBlocked(). The inverse is computed by solving the system \f$ A*X=I \f$.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void getriBlocked( DenseMatrix<MT,SO>& A, const blas_int_t* ipiv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = ElementType_t<MT>;
+
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const size_t n( (*A).rows() );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( isDefault<strict>( (*A)(i,i) ) ) {
+         BLAZE_THROW_LAPACK_ERROR( "Inversion of singular matrix failed" );
+      }
+   }
+
+   DynamicMatrix<ET,SO> X( n, n, ET(0) );
+   for( size_t i=0UL; i<n; ++i ) {
+      X(i,i) = ET(1);
+   }
+
+   getrsBlocked( *A, X, ipiv );
+
+   *A = X;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
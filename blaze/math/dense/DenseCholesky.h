@@ -0,0 +1,776 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/DenseCholesky.h
+//  \brief Header file for the updatable dense Cholesky decomposition
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_DENSECHOLESKY_H_
+#define _BLAZE_MATH_DENSE_DENSECHOLESKY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/LLH.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/system/Restrict.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Updatable Cholesky decomposition of dense symmetric (Hermitian) positive definite
+//        matrices.
+// \ingroup dense_matrix
+//
+// The DenseCholesky class template stores the decomposition \f$ A = LL^H \f$ of a dense
+// symmetric (Hermitian) positive definite \a n-by-\a n matrix \a A, where \a L is a lower
+// triangular matrix with positive real diagonal. In contrast to the llh() function the factor
+// is kept and can be modified in \f$ O(n^2) \f$ operations whenever \a A changes by a low-rank
+// term or by a row and column:
+//
+//  - update() and downdate() compute the factor of \f$ A \pm xx^H \f$ (or \f$ A \pm XX^H \f$
+//    for a rank-\a k modification) by means of plane (Givens) rotations;
+//  - insert() computes the factor of \a A extended by a row and column at the given index;
+//  - remove() computes the factor of \a A without the row and column at the given index.
+//
+// All modifications provide the strong exception guarantee, i.e. in case a downdate or an
+// insertion would result in a matrix that is not positive definite, a \a std::runtime_error
+// exception is thrown and the stored factor is unchanged. The stored factor can be used for
+// any number of solves (see solve()). The template argument specifies the element type of the
+// factor, which has to be \c float, \c double, \c complex<float>, or \c complex<double>. A
+// default constructed decomposition represents an empty 0-by-0 matrix, which can be grown by
+// means of insert().
+
+   \code
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+
+   DynamicMatrix<double> A;
+   DynamicVector<double> b, x, v;
+   // ... Resizing and initialization
+
+   blaze::DenseCholesky<double> chol( A );  // O(n^3) initial decomposition
+   x = chol.solve( b );                     // O(n^2) solve of A*x=b
+
+   chol.update( v );                        // O(n^2) update to A + v*v^H
+   x = chol.solve( b );                     // O(n^2) solve of (A + v*v^H)*x=b
+   \endcode
+*/
+template< typename Type >  // Data type of the factor
+class DenseCholesky
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;                             //!< Data type of the factor.
+   using FactorType  = DynamicMatrix<Type,columnMajor>;  //!< Type of the factor.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline DenseCholesky();
+
+   template< typename MT, bool SO >
+   explicit DenseCholesky( const DenseMatrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t            rows() const noexcept;
+   inline const FactorType& L   () const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Decomposition functions*********************************************************************
+   /*!\name Decomposition functions */
+   //@{
+   template< typename MT, bool SO > void compute( const DenseMatrix<MT,SO>& A );
+
+   template< typename VT, bool TF > void update  ( const DenseVector<VT,TF>& x );
+   template< typename VT, bool TF > void downdate( const DenseVector<VT,TF>& x );
+   template< typename MT, bool SO > void update  ( const DenseMatrix<MT,SO>& X );
+   template< typename MT, bool SO > void downdate( const DenseMatrix<MT,SO>& X );
+
+   template< typename VT, bool TF > void insert( size_t k, const DenseVector<VT,TF>& a );
+   void remove( size_t k );
+   //@}
+   //**********************************************************************************************
+
+   //**Solve functions*****************************************************************************
+   /*!\name Solve functions */
+   //@{
+   template< typename VT, bool TF >
+   DynamicVector<Type,TF> solve( const DenseVector<VT,TF>& b ) const;
+
+   template< typename MT, bool SO >
+   DynamicMatrix<Type,SO> solve( const DenseMatrix<MT,SO>& B ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using RT = UnderlyingBuiltin_t<Type>;  //!< Real data type of the factor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static void rankOneUpdate  ( Type* L, size_t ld, size_t n, Type* x ) noexcept;
+   static bool rankOneDowndate( Type* L, size_t ld, size_t n, Type* x, Type* p ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   FactorType L_;  //!< The lower triangular factor.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for DenseCholesky.
+//
+// The default constructor creates the decomposition of an empty 0-by-0 matrix.
+*/
+template< typename Type >  // Data type of the factor
+inline DenseCholesky<Type>::DenseCholesky()
+   : L_()  // The lower triangular factor
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the Cholesky decomposition of the given dense matrix.
+//
+// \param A The symmetric (Hermitian) positive definite dense matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Decomposition of singular matrix failed.
+*/
+template< typename Type >  // Data type of the factor
+template< typename MT      // Type of the dense matrix
+        , bool SO >        // Storage order of the dense matrix
+DenseCholesky<Type>::DenseCholesky( const DenseMatrix<MT,SO>& A )
+   : DenseCholesky()
+{
+   compute( *A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows/columns of the decomposed matrix.
+//
+// \return The number of rows/columns of the decomposed matrix.
+*/
+template< typename Type >  // Data type of the factor
+inline size_t DenseCholesky<Type>::rows() const noexcept
+{
+   return L_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the lower triangular factor \a L.
+//
+// \return Reference to the lower triangular factor (the strictly upper part is zero).
+*/
+template< typename Type >  // Data type of the factor
+inline const typename DenseCholesky<Type>::FactorType& DenseCholesky<Type>::L() const noexcept
+{
+   return L_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Cholesky decomposition of the given dense matrix.
+//
+// \param A The symmetric (Hermitian) positive definite dense matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Decomposition of singular matrix failed.
+//
+// This function computes the decomposition of the given matrix by means of the llh() function
+// (in \f$ O(n^3) \f$ operations) and replaces the previously stored factor. Only the lower part
+// of \a A is referenced. In case of an exception the previously stored factor is unchanged.
+*/
+template< typename Type >  // Data type of the factor
+template< typename MT      // Type of the dense matrix
+        , bool SO >        // Storage order of the dense matrix
+void DenseCholesky<Type>::compute( const DenseMatrix<MT,SO>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   FactorType L;
+   llh( *A, L );
+
+   L_ = std::move( L );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Rank-1 update of the decomposition (\f$ A + xx^H \f$).
+//
+// \param x The update vector.
+// \return void
+// \exception std::invalid_argument Invalid update vector provided.
+//
+// This function updates the stored factor to the decomposition of \f$ A + xx^H \f$ in
+// \f$ O(n^2) \f$ operations.
+*/
+template< typename Type >  // Data type of the factor
+template< typename VT      // Type of the update vector
+        , bool TF >        // Transpose flag of the update vector
+void DenseCholesky<Type>::update( const DenseVector<VT,TF>& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*x).size() != rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid update vector provided" );
+   }
+
+   DynamicVector<Type> w( *x );
+   rankOneUpdate( L_.data(), L_.spacing(), rows(), w.data() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Rank-1 downdate of the decomposition (\f$ A - xx^H \f$).
+//
+// \param x The downdate vector.
+// \return void
+// \exception std::invalid_argument Invalid downdate vector provided.
+// \exception std::runtime_error Downdate of positive definite matrix failed.
+//
+// This function updates the stored factor to the decomposition of \f$ A - xx^H \f$ in
+// \f$ O(n^2) \f$ operations. In case \f$ A - xx^H \f$ is not positive definite, a
+// \a std::runtime_error exception is thrown and the stored factor is unchanged.
+*/
+template< typename Type >  // Data type of the factor
+template< typename VT      // Type of the downdate vector
+        , bool TF >        // Transpose flag of the downdate vector
+void DenseCholesky<Type>::downdate( const DenseVector<VT,TF>& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*x).size() != rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid downdate vector provided" );
+   }
+
+   DynamicVector<Type> w( *x ), p( rows() );
+
+   if( !rankOneDowndate( L_.data(), L_.spacing(), rows(), w.data(), p.data() ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Downdate of positive definite matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Rank-\a k update of the decomposition (\f$ A + XX^H \f$).
+//
+// \param X The \a n-by-\a k update matrix.
+// \return void
+// \exception std::invalid_argument Invalid update matrix provided.
+//
+// This function updates the stored factor to the decomposition of \f$ A + XX^H \f$ by means of
+// \a k successive rank-1 updates, i.e. in \f$ O(kn^2) \f$ operations.
+*/
+template< typename Type >  // Data type of the factor
+template< typename MT      // Type of the update matrix
+        , bool SO >        // Storage order of the update matrix
+void DenseCholesky<Type>::update( const DenseMatrix<MT,SO>& X )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*X).rows() != rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid update matrix provided" );
+   }
+
+   DynamicVector<Type> w( rows() );
+
+   for( size_t j=0UL; j<(*X).columns(); ++j ) {
+      w = column( *X, j );
+      rankOneUpdate( L_.data(), L_.spacing(), rows(), w.data() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Rank-\a k downdate of the decomposition (\f$ A - XX^H \f$).
+//
+// \param X The \a n-by-\a k downdate matrix.
+// \return void
+// \exception std::invalid_argument Invalid downdate matrix provided.
+// \exception std::runtime_error Downdate of positive definite matrix failed.
+//
+// This function updates the stored factor to the decomposition of \f$ A - XX^H \f$ by means of
+// \a k successive rank-1 downdates, i.e. in \f$ O(kn^2) \f$ operations. In case any of the
+// intermediate matrices is not positive definite, a \a std::runtime_error exception is thrown
+// and the stored factor is unchanged.
+*/
+template< typename Type >  // Data type of the factor
+template< typename MT      // Type of the downdate matrix
+        , bool SO >        // Storage order of the downdate matrix
+void DenseCholesky<Type>::downdate( const DenseMatrix<MT,SO>& X )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*X).rows() != rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid downdate matrix provided" );
+   }
+
+   FactorType L( L_ );
+   DynamicVector<Type> w( rows() ), p( rows() );
+
+   for( size_t j=0UL; j<(*X).columns(); ++j ) {
+      w = column( *X, j );
+      if( !rankOneDowndate( L.data(), L.spacing(), rows(), w.data(), p.data() ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Downdate of positive definite matrix failed" );
+      }
+   }
+
+   L_ = std::move( L );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Insertion of a row and column into the decomposed matrix.
+//
+// \param k The index of the new row and column \f$ [0..n] \f$.
+// \param a The new column \a k of the \f$ (n+1) \f$-by-\f$ (n+1) \f$ matrix.
+// \return void
+// \exception std::invalid_argument Invalid insertion index.
+// \exception std::invalid_argument Invalid column vector provided.
+// \exception std::runtime_error Insertion into positive definite matrix failed.
+//
+// This function updates the stored factor to the decomposition of the matrix that results from
+// inserting a new row and column at index \a k, where \a a specifies the new column (and by
+// symmetry the new row) including the new diagonal element \a a[k]. The update requires
+// \f$ O(n^2) \f$ operations. In case the resulting matrix is not positive definite, a
+// \a std::runtime_error exception is thrown and the stored factor is unchanged.
+*/
+template< typename Type >  // Data type of the factor
+template< typename VT      // Type of the column vector
+        , bool TF >        // Transpose flag of the column vector
+void DenseCholesky<Type>::insert( size_t k, const DenseVector<VT,TF>& a )
+{
+   using std::sqrt;
+
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t n( rows() );
+
+   if( k > n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid insertion index" );
+   }
+
+   if( (*a).size() != n+1UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid column vector provided" );
+   }
+
+   DynamicVector<Type> y( *a );
+
+   // Forward substitution with the leading k-by-k block (L11*y=a1)
+   for( size_t j=0UL; j<k; ++j ) {
+      y[j] /= L_(j,j);
+      for( size_t i=j+1UL; i<k; ++i ) {
+         y[i] -= L_(i,j) * y[j];
+      }
+   }
+
+   RT d( real( y[k] ) );
+   for( size_t j=0UL; j<k; ++j ) {
+      d -= real( conj( y[j] ) * y[j] );
+   }
+
+   if( !( d > RT(0) ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Insertion into positive definite matrix failed" );
+   }
+
+   const RT l22( sqrt( d ) );
+
+   // Computation of the new column below the diagonal (l32=(a3-L31*y1)/l22)
+   for( size_t j=0UL; j<k; ++j ) {
+      for( size_t i=k; i<n; ++i ) {
+         y[i+1UL] -= L_(i,j) * y[j];
+      }
+   }
+
+   FactorType L( n+1UL, n+1UL, Type(0) );
+
+   for( size_t j=0UL; j<k; ++j ) {
+      for( size_t i=j; i<k; ++i ) {
+         L(i,j) = L_(i,j);
+      }
+      L(k,j) = conj( y[j] );
+      for( size_t i=k; i<n; ++i ) {
+         L(i+1UL,j) = L_(i,j);
+      }
+   }
+
+   L(k,k) = l22;
+   for( size_t i=k+1UL; i<=n; ++i ) {
+      L(i,k) = y[i] / l22;
+   }
+
+   for( size_t j=k; j<n; ++j ) {
+      for( size_t i=j; i<n; ++i ) {
+         L(i+1UL,j+1UL) = L_(i,j);
+      }
+   }
+
+   // Downdate of the trailing block (L33*L33^H - l32*l32^H)
+   const size_t m( n-k );
+   DynamicVector<Type> w( m ), p( m );
+   for( size_t i=0UL; i<m; ++i ) {
+      w[i] = L(k+1UL+i,k);
+   }
+
+   const size_t ld( L.spacing() );
+   if( !rankOneDowndate( L.data()+(k+1UL)*ld+k+1UL, ld, m, w.data(), p.data() ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Insertion into positive definite matrix failed" );
+   }
+
+   L_ = std::move( L );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removal of a row and column from the decomposed matrix.
+//
+// \param k The index of the row and column to be removed \f$ [0..n-1] \f$.
+// \return void
+// \exception std::invalid_argument Invalid removal index.
+//
+// This function updates the stored factor to the decomposition of the matrix that results from
+// removing the row and column at index \a k. The update requires \f$ O(n^2) \f$ operations.
+*/
+template< typename Type >  // Data type of the factor
+void DenseCholesky<Type>::remove( size_t k )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t n( rows() );
+
+   if( k >= n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid removal index" );
+   }
+
+   FactorType L( n-1UL, n-1UL, Type(0) );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      if( j == k ) continue;
+      const size_t jj( j < k ? j : j-1UL );
+      for( size_t i=j; i<n; ++i ) {
+         if( i == k ) continue;
+         L( i < k ? i : i-1UL, jj ) = L_(i,j);
+      }
+   }
+
+   // Update of the trailing block (L33*L33^H + l32*l32^H)
+   const size_t m( n-k-1UL );
+   DynamicVector<Type> w( m );
+   for( size_t i=0UL; i<m; ++i ) {
+      w[i] = L_(k+1UL+i,k);
+   }
+
+   const size_t ld( L.spacing() );
+   rankOneUpdate( L.data()+k*ld+k, ld, m, w.data() );
+
+   L_ = std::move( L );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Rank-1 update kernel of a column-major lower triangular factor.
+//
+// \param L Pointer to the first element of the factor.
+// \param ld The spacing between two columns of the factor.
+// \param n The number of rows/columns of the factor.
+// \param x The update vector; destroyed on exit.
+// \return void
+//
+// This function overwrites the factor \a L with the factor of \f$ LL^H + xx^H \f$. The columns
+// of \a L are combined with \a x by plane rotations, which keep the diagonal real and positive.
+*/
+template< typename Type >  // Data type of the factor
+void DenseCholesky<Type>::rankOneUpdate( Type* L, size_t ld, size_t n, Type* x ) noexcept
+{
+   using std::abs;
+   using std::hypot;
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      if( isDefault<strict>( x[k] ) ) continue;
+
+      Type* BLAZE_RESTRICT lk( L + k*ld );
+
+      const RT lkk( real( lk[k] ) );
+      const RT r( hypot( lkk, abs( x[k] ) ) );
+      const RT c( r / lkk );
+      const RT cinv( lkk / r );
+      const Type s( x[k] / lkk );
+
+      lk[k] = r;
+
+      for( size_t i=k+1UL; i<n; ++i ) {
+         lk[i] = ( lk[i] + conj( s ) * x[i] ) * cinv;
+         x[i]  = c * x[i] - s * lk[i];
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Rank-1 downdate kernel of a column-major lower triangular factor.
+//
+// \param L Pointer to the first element of the factor.
+// \param ld The spacing between two columns of the factor.
+// \param n The number of rows/columns of the factor.
+// \param x The downdate vector; destroyed on exit.
+// \param p Work array of size \a n.
+// \return \a true in case of success, \a false if \f$ LL^H - xx^H \f$ is not positive definite.
+//
+// This function overwrites the factor \a L with the factor of \f$ LL^H - xx^H \f$ by means of
+// the orthogonal downdating algorithm of LINPACK: With \f$ p = L^{-1}x \f$ the downdated matrix
+// is \f$ L(I-pp^H)L^H \f$, which is positive definite if and only if \f$ \|p\|_2 < 1 \f$. The
+// plane rotations that reduce \f$ (p,\sqrt{1-\|p\|_2^2}) \f$ to a unit vector are applied to
+// the columns of \a L from right to left. In case the downdated matrix is not positive definite,
+// the factor is not modified.
+*/
+template< typename Type >  // Data type of the factor
+bool DenseCholesky<Type>::rankOneDowndate( Type* L, size_t ld, size_t n, Type* x, Type* p ) noexcept
+{
+   using std::abs;
+   using std::hypot;
+   using std::sqrt;
+
+   // Forward substitution (L*p=x)
+   RT norm( 0 );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      const Type* BLAZE_RESTRICT lj( L + j*ld );
+      p[j] = x[j] / lj[j];
+      norm += real( conj( p[j] ) * p[j] );
+      for( size_t i=j+1UL; i<n; ++i ) {
+         x[i] -= lj[i] * p[j];
+      }
+   }
+
+   if( !( norm < RT(1) ) ) {
+      return false;
+   }
+
+   // Application of the plane rotations
+   RT rho( sqrt( RT(1) - norm ) );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      reset( x[i] );
+   }
+
+   for( size_t k=n; k-- > 0UL; )
+   {
+      const RT t( hypot( rho, abs( p[k] ) ) );
+      const RT c( rho / t );
+      const Type s( p[k] / t );
+
+      rho = t;
+
+      Type* BLAZE_RESTRICT lk( L + k*ld );
+
+      for( size_t i=k; i<n; ++i ) {
+         const Type tmp( lk[i] );
+         lk[i] = c * tmp - conj( s ) * x[i];
+         x[i]  = s * tmp + c * x[i];
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solution of the linear system \f$ Ax = b \f$.
+//
+// \param b The right-hand side vector.
+// \return The solution vector \a x.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+//
+// This function solves the linear system by forward and backward substitution with the stored
+// factor in \f$ O(n^2) \f$ operations.
+*/
+template< typename Type >  // Data type of the factor
+template< typename VT      // Type of the right-hand side vector
+        , bool TF >        // Transpose flag of the right-hand side vector
+DynamicVector<Type,TF> DenseCholesky<Type>::solve( const DenseVector<VT,TF>& b ) const
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t n( rows() );
+
+   if( (*b).size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   DynamicVector<Type,TF> x( *b );
+
+   // Forward substitution (L*y=b)
+   for( size_t j=0UL; j<n; ++j ) {
+      x[j] /= L_(j,j);
+      const Type xj( x[j] );
+      for( size_t i=j+1UL; i<n; ++i ) {
+         x[i] -= L_(i,j) * xj;
+      }
+   }
+
+   // Backward substitution (L^H*x=y)
+   for( size_t j=n; j-- > 0UL; ) {
+      Type xj( x[j] );
+      for( size_t i=j+1UL; i<n; ++i ) {
+         xj -= conj( L_(i,j) ) * x[i];
+      }
+      x[j] = xj / L_(j,j);
+   }
+
+   return x;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solution of the linear system \f$ AX = B \f$ with multiple right-hand sides.
+//
+// \param B The right-hand side matrix (one right-hand side per column).
+// \return The solution matrix \a X.
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+*/
+template< typename Type >  // Data type of the factor
+template< typename MT      // Type of the right-hand side matrix
+        , bool SO >        // Storage order of the right-hand side matrix
+DynamicMatrix<Type,SO> DenseCholesky<Type>::solve( const DenseMatrix<MT,SO>& B ) const
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*B).rows() != rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   DynamicMatrix<Type,SO> X( (*B).rows(), (*B).columns() );
+
+   for( size_t j=0UL; j<(*B).columns(); ++j ) {
+      column( X, j ) = solve( column( *B, j ) );
+   }
+
+   return X;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
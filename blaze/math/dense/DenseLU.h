@@ -0,0 +1,784 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/DenseLU.h
+//  \brief Header file for the updatable dense LU decomposition
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_DENSELU_H_
+#define _BLAZE_MATH_DENSE_DENSELU_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/BlockedLU.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/lapack/getrf.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/system/LAPACK.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Updatable LU decomposition of dense square matrices.
+// \ingroup dense_matrix
+//
+// The DenseLU class template stores the decomposition \f$ PA = LU \f$ of a dense square
+// \a n-by-\a n matrix \a A, where \a P is a row permutation, \a L is a unit lower triangular
+// matrix and \a U is an upper triangular matrix. In contrast to the lu() function the factors
+// and the permutation are kept and can be modified in \f$ O(n^2) \f$ operations whenever \a A
+// changes by a low-rank term:
+//
+//  - update() computes the factors of \f$ A + xy^H \f$ (or \f$ A + XY^H \f$ for a rank-\a k
+//    modification); a downdate is an update with a negated vector;
+//  - replaceColumn() and replaceRow() compute the factors of \a A with a single column or row
+//    replaced by a new one (as for instance required by active set and simplex methods).
+//
+// The updates follow the stabilized elimination scheme of Gill, Golub, Murray, and Saunders:
+// The update vector \f$ L^{-1}Px \f$ is reduced to a multiple of the first unit vector and the
+// resulting upper Hessenberg matrix is reduced to triangular form again by means of 2-by-2
+// elementary transformations, where each transformation is combined with a row interchange
+// whenever this results in a smaller multiplier. The stored factors can be used for any number
+// of solves (see solve()). The template argument specifies the element type of the factors,
+// which has to be \c float, \c double, \c complex<float>, or \c complex<double>.
+
+   \code
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+
+   DynamicMatrix<double> A;
+   DynamicVector<double> b, x, c;
+   // ... Resizing and initialization
+
+   blaze::DenseLU<double> lu( A );  // O(n^3) initial decomposition
+   x = lu.solve( b );               // O(n^2) solve of A*x=b
+
+   lu.replaceColumn( 3UL, c );      // O(n^2) replacement of column 3 of A by c
+   x = lu.solve( b );
+   \endcode
+*/
+template< typename Type >  // Data type of the factors
+class DenseLU
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;                             //!< Data type of the factors.
+   using LowerType   = DynamicMatrix<Type,columnMajor>;  //!< Type of the lower factor.
+   using UpperType   = DynamicMatrix<Type,rowMajor>;     //!< Type of the upper factor.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline DenseLU();
+
+   template< typename MT, bool SO >
+   explicit DenseLU( const DenseMatrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t                     rows       () const noexcept;
+   inline const LowerType&           L          () const noexcept;
+   inline const UpperType&           U          () const noexcept;
+   inline const std::vector<size_t>& permutation() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Decomposition functions*********************************************************************
+   /*!\name Decomposition functions */
+   //@{
+   template< typename MT, bool SO > void compute( const DenseMatrix<MT,SO>& A );
+
+   template< typename VT1, bool TF1, typename VT2, bool TF2 >
+   void update( const DenseVector<VT1,TF1>& x, const DenseVector<VT2,TF2>& y );
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   void update( const DenseMatrix<MT1,SO1>& X, const DenseMatrix<MT2,SO2>& Y );
+
+   template< typename VT, bool TF > void replaceColumn( size_t k, const DenseVector<VT,TF>& c );
+   template< typename VT, bool TF > void replaceRow   ( size_t k, const DenseVector<VT,TF>& r );
+   //@}
+   //**********************************************************************************************
+
+   //**Solve functions*****************************************************************************
+   /*!\name Solve functions */
+   //@{
+   template< typename VT, bool TF >
+   DynamicVector<Type,TF> solve( const DenseVector<VT,TF>& b ) const;
+
+   template< typename MT, bool SO >
+   DynamicMatrix<Type,SO> solve( const DenseMatrix<MT,SO>& B ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void rankOneUpdate( DynamicVector<Type>& w, const DynamicVector<Type>& v ) noexcept;
+   void eliminate( size_t i, const Type& a, const Type& b, Type* w ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   LowerType L_;               //!< The unit lower triangular factor.
+   UpperType U_;               //!< The upper triangular factor.
+   std::vector<size_t> perm_;  //!< The row permutation.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for DenseLU.
+//
+// The default constructor creates the decomposition of an empty 0-by-0 matrix.
+*/
+template< typename Type >  // Data type of the factors
+inline DenseLU<Type>::DenseLU()
+   : L_   ()  // The unit lower triangular factor
+   , U_   ()  // The upper triangular factor
+   , perm_()  // The row permutation
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the LU decomposition of the given dense matrix.
+//
+// \param A The square dense matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+*/
+template< typename Type >  // Data type of the factors
+template< typename MT      // Type of the dense matrix
+        , bool SO >        // Storage order of the dense matrix
+DenseLU<Type>::DenseLU( const DenseMatrix<MT,SO>& A )
+   : DenseLU()
+{
+   compute( *A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows/columns of the decomposed matrix.
+//
+// \return The number of rows/columns of the decomposed matrix.
+*/
+template< typename Type >  // Data type of the factors
+inline size_t DenseLU<Type>::rows() const noexcept
+{
+   return U_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the unit lower triangular factor \a L.
+//
+// \return Reference to the unit lower triangular factor (including the unit diagonal).
+*/
+template< typename Type >  // Data type of the factors
+inline const typename DenseLU<Type>::LowerType& DenseLU<Type>::L() const noexcept
+{
+   return L_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the upper triangular factor \a U.
+//
+// \return Reference to the upper triangular factor (the strictly lower part is zero).
+*/
+template< typename Type >  // Data type of the factors
+inline const typename DenseLU<Type>::UpperType& DenseLU<Type>::U() const noexcept
+{
+   return U_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the row permutation.
+//
+// \return The row permutation (\a perm[i] is the index of the row of \a A that is row \a i of
+//         \f$ PA \f$).
+*/
+template< typename Type >  // Data type of the factors
+inline const std::vector<size_t>& DenseLU<Type>::permutation() const noexcept
+{
+   return perm_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief LU decomposition of the given dense matrix.
+//
+// \param A The square dense matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes the decomposition of the given matrix with partial pivoting (in
+// \f$ O(n^3) \f$ operations) and replaces the previously stored factors. The decomposition is
+// computed by the LAPACK function getrf() or, in case the BLAZE_USE_LAPACK_LU_DECOMPOSITION
+// switch is deactivated, by the native blocked LU decomposition (see getrfBlocked()). The
+// decomposition never fails, but the factors of a singular matrix cannot be used to solve a
+// linear system.
+*/
+template< typename Type >  // Data type of the factors
+template< typename MT      // Type of the dense matrix
+        , bool SO >        // Storage order of the dense matrix
+void DenseLU<Type>::compute( const DenseMatrix<MT,SO>& A )
+{
+   using std::swap;
+
+   BLAZE_FUNCTION_TRACE;
+
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const size_t n( (*A).rows() );
+
+   DynamicMatrix<Type,columnMajor> LU( *A );
+   const std::unique_ptr<blas_int_t[]> ipiv( new blas_int_t[n] );
+
+#if BLAZE_USE_LAPACK_LU_DECOMPOSITION
+   getrf( LU, ipiv.get() );
+#else
+   getrfBlocked( LU, ipiv.get() );
+#endif
+
+   LowerType L( n, n, Type(0) );
+   UpperType U( n, n, Type(0) );
+   std::vector<size_t> perm( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      perm[i] = i;
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      swap( perm[i], perm[ipiv[i]-1] );
+   }
+
+   for( size_t j=0UL; j<n; ++j ) {
+      for( size_t i=0UL; i<=j; ++i ) {
+         U(i,j) = LU(i,j);
+      }
+      L(j,j) = Type(1);
+      for( size_t i=j+1UL; i<n; ++i ) {
+         L(i,j) = LU(i,j);
+      }
+   }
+
+   L_    = std::move( L );
+   U_    = std::move( U );
+   perm_ = std::move( perm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Rank-1 update of the decomposition (\f$ A + xy^H \f$).
+//
+// \param x The left update vector.
+// \param y The right update vector.
+// \return void
+// \exception std::invalid_argument Invalid update vector provided.
+//
+// This function updates the stored factors to the decomposition of \f$ A + xy^H \f$ in
+// \f$ O(n^2) \f$ operations.
+*/
+template< typename Type >  // Data type of the factors
+template< typename VT1     // Type of the left update vector
+        , bool TF1         // Transpose flag of the left update vector
+        , typename VT2     // Type of the right update vector
+        , bool TF2 >       // Transpose flag of the right update vector
+void DenseLU<Type>::update( const DenseVector<VT1,TF1>& x, const DenseVector<VT2,TF2>& y )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t n( rows() );
+
+   if( (*x).size() != n || (*y).size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid update vector provided" );
+   }
+
+   DynamicVector<Type> w( n ), v( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      w[i] = (*x)[perm_[i]];
+      v[i] = conj( (*y)[i] );
+   }
+
+   rankOneUpdate( w, v );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Rank-\a k update of the decomposition (\f$ A + XY^H \f$).
+//
+// \param X The \a n-by-\a k left update matrix.
+// \param Y The \a n-by-\a k right update matrix.
+// \return void
+// \exception std::invalid_argument Invalid update matrix provided.
+//
+// This function updates the stored factors to the decomposition of \f$ A + XY^H \f$ by means of
+// \a k successive rank-1 updates, i.e. in \f$ O(kn^2) \f$ operations.
+*/
+template< typename Type >  // Data type of the factors
+template< typename MT1     // Type of the left update matrix
+        , bool SO1         // Storage order of the left update matrix
+        , typename MT2     // Type of the right update matrix
+        , bool SO2 >       // Storage order of the right update matrix
+void DenseLU<Type>::update( const DenseMatrix<MT1,SO1>& X, const DenseMatrix<MT2,SO2>& Y )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t n( rows() );
+
+   if( (*X).rows() != n || (*Y).rows() != n || (*X).columns() != (*Y).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid update matrix provided" );
+   }
+
+   DynamicVector<Type> w( n ), v( n );
+
+   for( size_t j=0UL; j<(*X).columns(); ++j )
+   {
+      for( size_t i=0UL; i<n; ++i ) {
+         w[i] = (*X)(perm_[i],j);
+         v[i] = conj( (*Y)(i,j) );
+      }
+
+      rankOneUpdate( w, v );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Replacement of a column of the decomposed matrix.
+//
+// \param k The index of the column to be replaced \f$ [0..n-1] \f$.
+// \param c The new column \a k.
+// \return void
+// \exception std::invalid_argument Invalid column index.
+// \exception std::invalid_argument Invalid column vector provided.
+//
+// This function updates the stored factors to the decomposition of the matrix that results from
+// replacing column \a k by the given vector \a c. The update requires \f$ O(n^2) \f$ operations.
+*/
+template< typename Type >  // Data type of the factors
+template< typename VT      // Type of the column vector
+        , bool TF >        // Transpose flag of the column vector
+void DenseLU<Type>::replaceColumn( size_t k, const DenseVector<VT,TF>& c )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t n( rows() );
+
+   if( k >= n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid column index" );
+   }
+
+   if( (*c).size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid column vector provided" );
+   }
+
+   DynamicVector<Type> w( n ), v( n, Type(0) );
+
+   // Computation of P*(c - A*e_k) = P*c - L*U*e_k
+   for( size_t i=0UL; i<n; ++i ) {
+      w[i] = (*c)[perm_[i]];
+   }
+
+   for( size_t j=0UL; j<=k; ++j ) {
+      const Type ujk( U_(j,k) );
+      for( size_t i=j; i<n; ++i ) {
+         w[i] -= L_(i,j) * ujk;
+      }
+   }
+
+   v[k] = Type(1);
+
+   rankOneUpdate( w, v );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Replacement of a row of the decomposed matrix.
+//
+// \param k The index of the row to be replaced \f$ [0..n-1] \f$.
+// \param r The new row \a k.
+// \return void
+// \exception std::invalid_argument Invalid row index.
+// \exception std::invalid_argument Invalid row vector provided.
+//
+// This function updates the stored factors to the decomposition of the matrix that results from
+// replacing row \a k by the given vector \a r (i.e. element \a j of the new row is \a r[j]).
+// The update requires \f$ O(n^2) \f$ operations.
+*/
+template< typename Type >  // Data type of the factors
+template< typename VT      // Type of the row vector
+        , bool TF >        // Transpose flag of the row vector
+void DenseLU<Type>::replaceRow( size_t k, const DenseVector<VT,TF>& r )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t n( rows() );
+
+   if( k >= n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid row index" );
+   }
+
+   if( (*r).size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid row vector provided" );
+   }
+
+   size_t p( 0UL );
+   while( perm_[p] != k ) ++p;
+
+   DynamicVector<Type> w( n, Type(0) ), v( n );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      v[j] = (*r)[j];
+   }
+
+   // Computation of r - e_k^T*A = r - e_p^T*L*U
+   for( size_t i=0UL; i<=p; ++i ) {
+      const Type lpi( L_(p,i) );
+      for( size_t j=i; j<n; ++j ) {
+         v[j] -= lpi * U_(i,j);
+      }
+   }
+
+   w[p] = Type(1);
+
+   rankOneUpdate( w, v );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Rank-1 update kernel of the stored factors.
+//
+// \param w The permuted and transformed left update vector \f$ L^{-1}Px \f$; destroyed on exit.
+// \param v The right update vector \f$ \overline{y} \f$.
+// \return void
+//
+// This function updates the stored factors to the factors of \f$ LU + L w v^T \f$. First, \a w
+// is reduced to a multiple of the first unit vector from bottom to top, which turns \a U into an
+// upper Hessenberg matrix. After adding the update to the first row, the subdiagonal of the
+// Hessenberg matrix is eliminated from top to bottom.
+*/
+template< typename Type >  // Data type of the factors
+void DenseLU<Type>::rankOneUpdate( DynamicVector<Type>& w, const DynamicVector<Type>& v ) noexcept
+{
+   const size_t n( rows() );
+
+   if( n == 0UL ) return;
+
+   // Forward substitution (L*w=P*x)
+   for( size_t j=0UL; j<n; ++j ) {
+      const Type wj( w[j] );
+      for( size_t i=j+1UL; i<n; ++i ) {
+         w[i] -= L_(i,j) * wj;
+      }
+   }
+
+   // Reduction of w to a multiple of the first unit vector
+   for( size_t i=n-1UL; i-- > 0UL; ) {
+      if( !isDefault<strict>( w[i+1UL] ) ) {
+         eliminate( i, w[i], w[i+1UL], w.data() );
+      }
+   }
+
+   for( size_t j=0UL; j<n; ++j ) {
+      U_(0UL,j) += w[0UL] * v[j];
+   }
+
+   // Reduction of the upper Hessenberg matrix to triangular form
+   for( size_t i=0UL; i+1UL<n; ++i ) {
+      if( !isDefault<strict>( U_(i+1UL,i) ) ) {
+         eliminate( i, U_(i,i), U_(i+1UL,i), nullptr );
+         reset( U_(i+1UL,i) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Stabilized elimination of an element of row \a i+1 by means of row \a i.
+//
+// \param i The index of the pivot row.
+// \param a The element of the pivot row.
+// \param b The element of row \a i+1 to be eliminated.
+// \param w The update vector to be transformed alongside \a U (\c nullptr if there is none).
+// \return void
+//
+// This function applies a 2-by-2 transformation \a T to rows \a i and \a i+1 of \a U (and of
+// \a w) that eliminates \a b and replaces the according 2-by-2 block of \a L by a unit lower
+// triangular block, i.e. \f$ LU = (LT^{-1})(TU) \f$. With \f$ z = (a, l a + b) \f$, where
+// \a l is the subdiagonal element of the block of \a L, the transformation uses the larger
+// element of \a z as pivot. In case the second element is larger, rows \a i and \a i+1 of \a L
+// and of the permutation are interchanged. Therefore the new subdiagonal element of \a L is
+// bounded by 1 in magnitude.
+*/
+template< typename Type >  // Data type of the factors
+void DenseLU<Type>::eliminate( size_t i, const Type& a, const Type& b, Type* w ) noexcept
+{
+   using std::abs;
+   using std::swap;
+
+   const size_t n( rows() );
+   const size_t k( i+1UL );
+
+   const Type l ( L_(k,i) );
+   const Type z1( a );
+   const Type z2( l*a + b );
+
+   if( abs( z1 ) >= abs( z2 ) )
+   {
+      const Type q( isDefault<strict>( z1 ) ? Type(0) : z2 / z1 );
+      const Type f( l - q );
+
+      for( size_t j=i; j<n; ++j ) {
+         U_(k,j) += f * U_(i,j);
+      }
+
+      if( w != nullptr ) {
+         w[k] = Type(0);
+      }
+
+      for( size_t r=k+1UL; r<n; ++r ) {
+         L_(r,i) -= f * L_(r,k);
+      }
+
+      L_(k,i) = q;
+   }
+   else
+   {
+      const Type q( z1 / z2 );
+      const Type g( Type(1) - q*l );
+
+      for( size_t j=i; j<n; ++j ) {
+         const Type u1( U_(i,j) );
+         const Type u2( U_(k,j) );
+         U_(i,j) = l*u1 + u2;
+         U_(k,j) = g*u1 - q*u2;
+      }
+
+      if( w != nullptr ) {
+         w[i] = z2;
+         w[k] = Type(0);
+      }
+
+      for( size_t r=k+1UL; r<n; ++r ) {
+         const Type l1( L_(r,i) );
+         const Type l2( L_(r,k) );
+         L_(r,i) = q*l1 + g*l2;
+         L_(r,k) = l1 - l*l2;
+      }
+
+      for( size_t j=0UL; j<i; ++j ) {
+         swap( L_(i,j), L_(k,j) );
+      }
+
+      L_(k,i) = q;
+      swap( perm_[i], perm_[k] );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solution of the linear system \f$ Ax = b \f$.
+//
+// \param b The right-hand side vector.
+// \return The solution vector \a x.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::runtime_error Solving LSE with singular system matrix failed.
+//
+// This function solves the linear system by forward and backward substitution with the stored
+// factors in \f$ O(n^2) \f$ operations.
+*/
+template< typename Type >  // Data type of the factors
+template< typename VT      // Type of the right-hand side vector
+        , bool TF >        // Transpose flag of the right-hand side vector
+DynamicVector<Type,TF> DenseLU<Type>::solve( const DenseVector<VT,TF>& b ) const
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t n( rows() );
+
+   if( (*b).size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( isDefault<strict>( U_(i,i) ) ) {
+         BLAZE_THROW_DIVISION_BY_ZERO( "Solving LSE with singular system matrix failed" );
+      }
+   }
+
+   DynamicVector<Type,TF> x( n );
+
+   // Forward substitution (L*y=P*b)
+   for( size_t i=0UL; i<n; ++i ) {
+      x[i] = (*b)[perm_[i]];
+   }
+
+   for( size_t j=0UL; j<n; ++j ) {
+      const Type xj( x[j] );
+      for( size_t i=j+1UL; i<n; ++i ) {
+         x[i] -= L_(i,j) * xj;
+      }
+   }
+
+   // Backward substitution (U*x=y)
+   for( size_t i=n; i-- > 0UL; ) {
+      Type xi( x[i] );
+      for( size_t j=i+1UL; j<n; ++j ) {
+         xi -= U_(i,j) * x[j];
+      }
+      x[i] = xi / U_(i,i);
+   }
+
+   return x;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solution of the linear system \f$ AX = B \f$ with multiple right-hand sides.
+//
+// \param B The right-hand side matrix (one right-hand side per column).
+// \return The solution matrix \a X.
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+// \exception std::runtime_error Solving LSE with singular system matrix failed.
+*/
+template< typename Type >  // Data type of the factors
+template< typename MT      // Type of the right-hand side matrix
+        , bool SO >        // Storage order of the right-hand side matrix
+DynamicMatrix<Type,SO> DenseLU<Type>::solve( const DenseMatrix<MT,SO>& B ) const
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*B).rows() != rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   DynamicMatrix<Type,SO> X( (*B).rows(), (*B).columns() );
+
+   for( size_t j=0UL; j<(*B).columns(); ++j ) {
+      column( X, j ) = solve( column( *B, j ) );
+   }
+
+   return X;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
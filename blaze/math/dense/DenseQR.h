@@ -0,0 +1,960 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/DenseQR.h
+//  \brief Header file for the updatable dense QR decomposition
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_DENSEQR_H_
+#define _BLAZE_MATH_DENSE_DENSEQR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <memory>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/QR.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/lapack/geqrf.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Updatable full QR decomposition of dense matrices.
+// \ingroup dense_matrix
+//
+// The DenseQR class template stores the full decomposition \f$ A = QR \f$ of a dense \a m-by-\a n
+// matrix \a A, where \a Q is an \a m-by-\a m unitary matrix and \a R is an \a m-by-\a n upper
+// trapezoidal matrix. In contrast to the qr() function the factors are kept and can be modified
+// in \f$ O(m^2 + mn) \f$ operations whenever \a A changes by a low-rank term or by a single row
+// or column:
+//
+//  - update() computes the factors of \f$ A + uv^H \f$ (or \f$ A + UV^H \f$ for a rank-\a k
+//    modification); a downdate is an update with a negated vector;
+//  - insertColumn() and removeColumn() insert or remove a single column of \a A;
+//  - insertRow() and removeRow() insert or remove a single row of \a A.
+//
+// All modifications are based on sequences of Givens rotations (see Golub and Van Loan, Matrix
+// Computations, Section 6.5). The stored factors can be used for any number of (least squares)
+// solves (see solve()). The template argument specifies the element type of the factors, which
+// has to be \c float, \c double, \c complex<float>, or \c complex<double>.
+
+   \code
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+
+   DynamicMatrix<double> A;
+   DynamicVector<double> b, x, a;
+   // ... Resizing and initialization
+
+   blaze::DenseQR<double> qr( A );  // Initial decomposition
+   x = qr.solve( b );               // Least squares solution of A*x=b
+
+   qr.insertRow( 0UL, a );          // Insertion of a new first row of A
+   qr.removeColumn( 2UL );          // Removal of column 2 of A
+   \endcode
+
+// Note that the initial decomposition (see compute()) requires the LAPACK library. In case no
+// LAPACK library is available, the use of compute() results in a linker error.
+*/
+template< typename Type >  // Data type of the factors
+class DenseQR
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;                             //!< Data type of the factors.
+   using UnitaryType = DynamicMatrix<Type,columnMajor>;  //!< Type of the unitary factor.
+   using UpperType   = DynamicMatrix<Type,rowMajor>;     //!< Type of the upper trapezoidal factor.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline DenseQR();
+
+   template< typename MT, bool SO >
+   explicit DenseQR( const DenseMatrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t             rows   () const noexcept;
+   inline size_t             columns() const noexcept;
+   inline const UnitaryType& Q      () const noexcept;
+   inline const UpperType&   R      () const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Decomposition functions*********************************************************************
+   /*!\name Decomposition functions */
+   //@{
+   template< typename MT, bool SO > void compute( const DenseMatrix<MT,SO>& A );
+
+   template< typename VT1, bool TF1, typename VT2, bool TF2 >
+   void update( const DenseVector<VT1,TF1>& u, const DenseVector<VT2,TF2>& v );
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   void update( const DenseMatrix<MT1,SO1>& U, const DenseMatrix<MT2,SO2>& V );
+
+   template< typename VT, bool TF > void insertColumn( size_t j, const DenseVector<VT,TF>& x );
+   template< typename VT, bool TF > void insertRow   ( size_t i, const DenseVector<VT,TF>& a );
+
+   void removeColumn( size_t j );
+   void removeRow   ( size_t i );
+   //@}
+   //**********************************************************************************************
+
+   //**Solve functions*****************************************************************************
+   /*!\name Solve functions */
+   //@{
+   template< typename VT, bool TF >
+   DynamicVector<Type,TF> solve( const DenseVector<VT,TF>& b ) const;
+
+   template< typename MT, bool SO >
+   DynamicMatrix<Type,SO> solve( const DenseMatrix<MT,SO>& B ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using RT = UnderlyingBuiltin_t<Type>;  //!< Underlying builtin data type.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename VT >
+   void rankOneUpdate( DynamicVector<Type>& w, const VT& v );
+
+   static bool givens( const Type& a, const Type& b, RT& c, Type& s ) noexcept;
+
+   static void rotateRows( UpperType& R, size_t i, size_t k, size_t first,
+                           RT c, const Type& s ) noexcept;
+
+   static void rotateColumns( UnitaryType& Q, size_t i, size_t k, RT c, const Type& s ) noexcept;
+
+   static void triangularize( UnitaryType& Q, UpperType& R, size_t first ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   UnitaryType Q_;  //!< The unitary factor.
+   UpperType   R_;  //!< The upper trapezoidal factor.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for DenseQR.
+//
+// The default constructor creates the decomposition of an empty 0-by-0 matrix.
+*/
+template< typename Type >  // Data type of the factors
+inline DenseQR<Type>::DenseQR()
+   : Q_()  // The unitary factor
+   , R_()  // The upper trapezoidal factor
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the QR decomposition of the given dense matrix.
+//
+// \param A The dense matrix.
+*/
+template< typename Type >  // Data type of the factors
+template< typename MT      // Type of the dense matrix
+        , bool SO >        // Storage order of the dense matrix
+DenseQR<Type>::DenseQR( const DenseMatrix<MT,SO>& A )
+   : DenseQR()
+{
+   compute( *A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the decomposed matrix.
+//
+// \return The number of rows of the decomposed matrix.
+*/
+template< typename Type >  // Data type of the factors
+inline size_t DenseQR<Type>::rows() const noexcept
+{
+   return R_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns of the decomposed matrix.
+//
+// \return The number of columns of the decomposed matrix.
+*/
+template< typename Type >  // Data type of the factors
+inline size_t DenseQR<Type>::columns() const noexcept
+{
+   return R_.columns();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the unitary factor \a Q.
+//
+// \return Reference to the \a m-by-\a m unitary factor.
+*/
+template< typename Type >  // Data type of the factors
+inline const typename DenseQR<Type>::UnitaryType& DenseQR<Type>::Q() const noexcept
+{
+   return Q_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the upper trapezoidal factor \a R.
+//
+// \return Reference to the \a m-by-\a n upper trapezoidal factor.
+*/
+template< typename Type >  // Data type of the factors
+inline const typename DenseQR<Type>::UpperType& DenseQR<Type>::R() const noexcept
+{
+   return R_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief QR decomposition of the given dense matrix.
+//
+// \param A The dense matrix.
+// \return void
+//
+// This function computes the full QR decomposition of the given matrix by means of the LAPACK
+// functions geqrf() and orgqr() (or ungqr() for complex matrices) and replaces the previously
+// stored factors. In case of an exception the previously stored factors are unchanged.
+*/
+template< typename Type >  // Data type of the factors
+template< typename MT      // Type of the dense matrix
+        , bool SO >        // Storage order of the dense matrix
+void DenseQR<Type>::compute( const DenseMatrix<MT,SO>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t m( (*A).rows() );
+   const size_t n( (*A).columns() );
+   const size_t k( min( m, n ) );
+
+   DynamicMatrix<Type,columnMajor> F( *A );
+   UnitaryType Q( m, m, Type(0) );
+   UpperType   R( m, n, Type(0) );
+
+   if( k > 0UL )
+   {
+      const std::unique_ptr<Type[]> tau( new Type[m] );
+
+      geqrf( F, tau.get() );
+
+      for( size_t i=k; i<m; ++i ) {
+         reset( tau[i] );
+      }
+
+      for( size_t i=0UL; i<k; ++i ) {
+         for( size_t j=i; j<n; ++j ) {
+            R(i,j) = F(i,j);
+         }
+      }
+
+      for( size_t j=0UL; j<k; ++j ) {
+         for( size_t i=j+1UL; i<m; ++i ) {
+            Q(i,j) = F(i,j);
+         }
+      }
+
+      qr_backend( Q, tau.get() );
+   }
+   else
+   {
+      for( size_t i=0UL; i<m; ++i ) {
+         Q(i,i) = Type(1);
+      }
+   }
+
+   Q_ = std::move( Q );
+   R_ = std::move( R );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Rank-1 update of the decomposition (\f$ A + uv^H \f$).
+//
+// \param u The left update vector of size \a m.
+// \param v The right update vector of size \a n.
+// \return void
+// \exception std::invalid_argument Invalid update vector provided.
+//
+// This function updates the stored factors to the decomposition of \f$ A + uv^H \f$ in
+// \f$ O(m^2 + mn) \f$ operations.
+*/
+template< typename Type >  // Data type of the factors
+template< typename VT1     // Type of the left update vector
+        , bool TF1         // Transpose flag of the left update vector
+        , typename VT2     // Type of the right update vector
+        , bool TF2 >       // Transpose flag of the right update vector
+void DenseQR<Type>::update( const DenseVector<VT1,TF1>& u, const DenseVector<VT2,TF2>& v )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*u).size() != rows() || (*v).size() != columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid update vector provided" );
+   }
+
+   DynamicVector<Type> w( rows() );
+   const DynamicVector<Type,TF2> y( *v );
+
+   for( size_t i=0UL; i<rows(); ++i ) {
+      w[i] = (*u)[i];
+   }
+
+   rankOneUpdate( w, y );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Rank-\a k update of the decomposition (\f$ A + UV^H \f$).
+//
+// \param U The \a m-by-\a k left update matrix.
+// \param V The \a n-by-\a k right update matrix.
+// \return void
+// \exception std::invalid_argument Invalid update matrix provided.
+//
+// This function updates the stored factors to the decomposition of \f$ A + UV^H \f$ by means of
+// \a k successive rank-1 updates.
+*/
+template< typename Type >  // Data type of the factors
+template< typename MT1     // Type of the left update matrix
+        , bool SO1         // Storage order of the left update matrix
+        , typename MT2     // Type of the right update matrix
+        , bool SO2 >       // Storage order of the right update matrix
+void DenseQR<Type>::update( const DenseMatrix<MT1,SO1>& U, const DenseMatrix<MT2,SO2>& V )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*U).rows() != rows() || (*V).rows() != columns() || (*U).columns() != (*V).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid update matrix provided" );
+   }
+
+   DynamicVector<Type> w( rows() ), y( columns() );
+
+   for( size_t j=0UL; j<(*U).columns(); ++j ) {
+      w = column( *U, j );
+      y = column( *V, j );
+      rankOneUpdate( w, y );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Insertion of a column into the decomposed matrix.
+//
+// \param j The index of the new column \f$ [0..n] \f$.
+// \param x The new column of size \a m.
+// \return void
+// \exception std::invalid_argument Invalid insertion index.
+// \exception std::invalid_argument Invalid column vector provided.
+//
+// This function updates the stored factors to the decomposition of the \a m-by-(\a n+1) matrix
+// that results from inserting \a x as column \a j. The update requires \f$ O(m^2 + mn) \f$
+// operations.
+*/
+template< typename Type >  // Data type of the factors
+template< typename VT      // Type of the column vector
+        , bool TF >        // Transpose flag of the column vector
+void DenseQR<Type>::insertColumn( size_t j, const DenseVector<VT,TF>& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t m( rows() );
+   const size_t n( columns() );
+
+   if( j > n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid insertion index" );
+   }
+
+   if( (*x).size() != m ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid column vector provided" );
+   }
+
+   const DynamicVector<Type,TF> y( *x );
+   UpperType R( m, n+1UL );
+
+   // Computation of Q^H*x as new column j of R
+   for( size_t i=0UL; i<m; ++i )
+   {
+      Type tmp{};
+      for( size_t l=0UL; l<m; ++l ) {
+         tmp += conj( Q_(l,i) ) * y[l];
+      }
+
+      for( size_t l=0UL; l<j; ++l ) {
+         R(i,l) = R_(i,l);
+      }
+      R(i,j) = tmp;
+      for( size_t l=j; l<n; ++l ) {
+         R(i,l+1UL) = R_(i,l);
+      }
+   }
+
+   // Elimination of the new column below the diagonal
+   RT c;
+   Type s;
+
+   for( size_t k=m-1UL; k>j && k<m; --k ) {
+      if( givens( R(k-1UL,j), R(k,j), c, s ) ) {
+         rotateRows( R, k-1UL, k, j, c, s );
+         rotateColumns( Q_, k-1UL, k, c, s );
+      }
+      reset( R(k,j) );
+   }
+
+   R_ = std::move( R );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removal of a column from the decomposed matrix.
+//
+// \param j The index of the column to be removed \f$ [0..n-1] \f$.
+// \return void
+// \exception std::invalid_argument Invalid removal index.
+//
+// This function updates the stored factors to the decomposition of the \a m-by-(\a n-1) matrix
+// that results from removing column \a j. The update requires \f$ O(m^2 + mn) \f$ operations.
+*/
+template< typename Type >  // Data type of the factors
+void DenseQR<Type>::removeColumn( size_t j )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t m( rows() );
+   const size_t n( columns() );
+
+   if( j >= n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid removal index" );
+   }
+
+   UpperType R( m, n-1UL );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t l=0UL; l<j; ++l ) {
+         R(i,l) = R_(i,l);
+      }
+      for( size_t l=j+1UL; l<n; ++l ) {
+         R(i,l-1UL) = R_(i,l);
+      }
+   }
+
+   triangularize( Q_, R, j );
+
+   R_ = std::move( R );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Insertion of a row into the decomposed matrix.
+//
+// \param i The index of the new row \f$ [0..m] \f$.
+// \param a The new row of size \a n.
+// \return void
+// \exception std::invalid_argument Invalid insertion index.
+// \exception std::invalid_argument Invalid row vector provided.
+//
+// This function updates the stored factors to the decomposition of the (\a m+1)-by-\a n matrix
+// that results from inserting \a a as row \a i (i.e. element \a j of the new row is \a a[j]).
+// The update requires \f$ O(m^2 + mn) \f$ operations.
+*/
+template< typename Type >  // Data type of the factors
+template< typename VT      // Type of the row vector
+        , bool TF >        // Transpose flag of the row vector
+void DenseQR<Type>::insertRow( size_t i, const DenseVector<VT,TF>& a )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t m( rows() );
+   const size_t n( columns() );
+
+   if( i > m ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid insertion index" );
+   }
+
+   if( (*a).size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid row vector provided" );
+   }
+
+   UnitaryType Q( m+1UL, m+1UL, Type(0) );
+   UpperType   R( m+1UL, n );
+
+   // Decomposition of the matrix with the new row on top, permuted to row i
+   Q(i,0UL) = Type(1);
+   for( size_t l=0UL; l<m; ++l ) {
+      const size_t row( l < i ? l : l+1UL );
+      for( size_t k=0UL; k<m; ++k ) {
+         Q(row,k+1UL) = Q_(l,k);
+      }
+   }
+
+   for( size_t l=0UL; l<n; ++l ) {
+      R(0UL,l) = (*a)[l];
+   }
+   for( size_t l=0UL; l<m; ++l ) {
+      for( size_t k=0UL; k<n; ++k ) {
+         R(l+1UL,k) = R_(l,k);
+      }
+   }
+
+   triangularize( Q, R, 0UL );
+
+   Q_ = std::move( Q );
+   R_ = std::move( R );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removal of a row from the decomposed matrix.
+//
+// \param i The index of the row to be removed \f$ [0..m-1] \f$.
+// \return void
+// \exception std::invalid_argument Invalid removal index.
+//
+// This function updates the stored factors to the decomposition of the (\a m-1)-by-\a n matrix
+// that results from removing row \a i. The update requires \f$ O(m^2 + mn) \f$ operations.
+*/
+template< typename Type >  // Data type of the factors
+void DenseQR<Type>::removeRow( size_t i )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t m( rows() );
+   const size_t n( columns() );
+
+   if( i >= m ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid removal index" );
+   }
+
+   UnitaryType Q( m-1UL, m-1UL );
+   UpperType   R( m-1UL, n );
+   DynamicVector<Type> z( m );
+
+   for( size_t k=0UL; k<m; ++k ) {
+      z[k] = conj( Q_(i,k) );
+   }
+
+   // Reduction of row i of Q to a multiple of the first unit vector
+   RT c;
+   Type s;
+
+   for( size_t k=m-1UL; k>0UL; --k ) {
+      if( givens( z[k-1UL], z[k], c, s ) ) {
+         z[k-1UL] = c*z[k-1UL] + s*z[k];
+         rotateRows( R_, k-1UL, k, min( k-1UL, n ), c, s );
+         rotateColumns( Q_, k-1UL, k, c, s );
+      }
+      reset( z[k] );
+   }
+
+   // Removal of row i and the first column of Q and of the first row of R
+   for( size_t l=0UL; l<m; ++l ) {
+      if( l == i ) continue;
+      const size_t row( l < i ? l : l-1UL );
+      for( size_t k=1UL; k<m; ++k ) {
+         Q(row,k-1UL) = Q_(l,k);
+      }
+   }
+
+   for( size_t l=1UL; l<m; ++l ) {
+      for( size_t k=0UL; k<n; ++k ) {
+         R(l-1UL,k) = R_(l,k);
+      }
+   }
+
+   Q_ = std::move( Q );
+   R_ = std::move( R );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Rank-1 update kernel of the stored factors.
+//
+// \param w The left update vector \a u; destroyed on exit.
+// \param v The right update vector \a v.
+// \return void
+//
+// This function updates the stored factors to the factors of \f$ A + uv^H \f$. The vector
+// \f$ Q^H u \f$ is reduced to a multiple of the first unit vector from bottom to top, which
+// turns \a R into an upper Hessenberg matrix. After adding the update to the first row, the
+// Hessenberg matrix is reduced to triangular form again from top to bottom.
+*/
+template< typename Type >  // Data type of the factors
+template< typename VT >    // Type of the right update vector
+void DenseQR<Type>::rankOneUpdate( DynamicVector<Type>& w, const VT& v )
+{
+   const size_t m( rows() );
+   const size_t n( columns() );
+
+   if( m == 0UL ) return;
+
+   DynamicVector<Type> u( w );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      Type tmp{};
+      for( size_t l=0UL; l<m; ++l ) {
+         tmp += conj( Q_(l,i) ) * u[l];
+      }
+      w[i] = tmp;
+   }
+
+   RT c;
+   Type s;
+
+   for( size_t k=m-1UL; k>0UL; --k ) {
+      if( givens( w[k-1UL], w[k], c, s ) ) {
+         w[k-1UL] = c*w[k-1UL] + s*w[k];
+         rotateRows( R_, k-1UL, k, min( k-1UL, n ), c, s );
+         rotateColumns( Q_, k-1UL, k, c, s );
+      }
+      reset( w[k] );
+   }
+
+   for( size_t j=0UL; j<n; ++j ) {
+      R_(0UL,j) += w[0UL] * conj( v[j] );
+   }
+
+   triangularize( Q_, R_, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of a Givens rotation.
+//
+// \param a The first element.
+// \param b The element to be eliminated.
+// \param c The resulting (real) cosine.
+// \param s The resulting sine.
+// \return \a false in case \a b is already zero, \a true otherwise.
+//
+// This function computes a rotation \f$ G = \left(\begin{array}{cc} c & s \\ -\overline{s} & c
+// \end{array}\right) \f$ with real \a c such that \f$ G (a,b)^T = (r,0)^T \f$.
+*/
+template< typename Type >  // Data type of the factors
+bool DenseQR<Type>::givens( const Type& a, const Type& b, RT& c, Type& s ) noexcept
+{
+   using std::abs;
+   using std::hypot;
+
+   if( isDefault<strict>( b ) ) {
+      return false;
+   }
+
+   const RT absa( abs( a ) );
+   const RT absb( abs( b ) );
+
+   if( isDefault<strict>( absa ) ) {
+      c = RT(0);
+      s = conj( b ) / absb;
+   }
+   else {
+      const RT t( hypot( absa, absb ) );
+      c = absa / t;
+      s = ( a / absa ) * conj( b ) / t;
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Application of a Givens rotation to two rows of \a R (\f$ R = GR \f$).
+//
+// \param R The upper trapezoidal factor.
+// \param i The index of the first row.
+// \param k The index of the second row.
+// \param first The index of the first column to be rotated.
+// \param c The cosine of the rotation.
+// \param s The sine of the rotation.
+// \return void
+*/
+template< typename Type >  // Data type of the factors
+void DenseQR<Type>::rotateRows( UpperType& R, size_t i, size_t k, size_t first,
+                                RT c, const Type& s ) noexcept
+{
+   const Type cs( conj( s ) );
+
+   for( size_t j=first; j<R.columns(); ++j ) {
+      const Type ri( R(i,j) );
+      const Type rk( R(k,j) );
+      R(i,j) = c*ri + s*rk;
+      R(k,j) = c*rk - cs*ri;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Application of the inverse of a Givens rotation to two columns of \a Q
+//        (\f$ Q = QG^H \f$).
+//
+// \param Q The unitary factor.
+// \param i The index of the first column.
+// \param k The index of the second column.
+// \param c The cosine of the rotation.
+// \param s The sine of the rotation.
+// \return void
+*/
+template< typename Type >  // Data type of the factors
+void DenseQR<Type>::rotateColumns( UnitaryType& Q, size_t i, size_t k,
+                                   RT c, const Type& s ) noexcept
+{
+   const Type cs( conj( s ) );
+
+   for( size_t j=0UL; j<Q.rows(); ++j ) {
+      const Type qi( Q(j,i) );
+      const Type qk( Q(j,k) );
+      Q(j,i) = c*qi + cs*qk;
+      Q(j,k) = c*qk - s*qi;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduction of an upper Hessenberg matrix \a R to upper trapezoidal form.
+//
+// \param Q The unitary factor.
+// \param R The upper Hessenberg factor.
+// \param first The index of the first column with a nonzero subdiagonal element.
+// \return void
+*/
+template< typename Type >  // Data type of the factors
+void DenseQR<Type>::triangularize( UnitaryType& Q, UpperType& R, size_t first ) noexcept
+{
+   if( R.rows() == 0UL ) return;
+
+   const size_t kend( min( R.rows()-1UL, R.columns() ) );
+
+   RT c;
+   Type s;
+
+   for( size_t k=first; k<kend; ++k ) {
+      if( givens( R(k,k), R(k+1UL,k), c, s ) ) {
+         rotateRows( R, k, k+1UL, k, c, s );
+         rotateColumns( Q, k, k+1UL, c, s );
+      }
+      reset( R(k+1UL,k) );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Least squares solution of the linear system \f$ Ax = b \f$.
+//
+// \param b The right-hand side vector of size \a m.
+// \return The solution vector \a x of size \a n.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::invalid_argument Invalid underdetermined system provided.
+// \exception std::runtime_error Solving LSE with singular system matrix failed.
+//
+// This function computes the solution \a x that minimizes \f$ \|Ax-b\|_2 \f$ for a decomposed
+// matrix with full column rank and \f$ m \ge n \f$. For square matrices this is the solution of
+// the linear system. The solve requires \f$ O(mn) \f$ operations.
+*/
+template< typename Type >  // Data type of the factors
+template< typename VT      // Type of the right-hand side vector
+        , bool TF >        // Transpose flag of the right-hand side vector
+DynamicVector<Type,TF> DenseQR<Type>::solve( const DenseVector<VT,TF>& b ) const
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t m( rows() );
+   const size_t n( columns() );
+
+   if( (*b).size() != m ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   if( m < n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid underdetermined system provided" );
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( isDefault<strict>( R_(i,i) ) ) {
+         BLAZE_THROW_DIVISION_BY_ZERO( "Solving LSE with singular system matrix failed" );
+      }
+   }
+
+   const DynamicVector<Type,TF> y( *b );
+   DynamicVector<Type,TF> x( n );
+
+   // Computation of Q1^H*b
+   for( size_t j=0UL; j<n; ++j ) {
+      Type tmp{};
+      for( size_t i=0UL; i<m; ++i ) {
+         tmp += conj( Q_(i,j) ) * y[i];
+      }
+      x[j] = tmp;
+   }
+
+   // Backward substitution (R1*x=Q1^H*b)
+   for( size_t i=n; i-- > 0UL; ) {
+      Type xi( x[i] );
+      for( size_t j=i+1UL; j<n; ++j ) {
+         xi -= R_(i,j) * x[j];
+      }
+      x[i] = xi / R_(i,i);
+   }
+
+   return x;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Least squares solution of the linear system \f$ AX = B \f$ with multiple right-hand
+//        sides.
+//
+// \param B The right-hand side matrix (one right-hand side per column).
+// \return The solution matrix \a X.
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+// \exception std::invalid_argument Invalid underdetermined system provided.
+// \exception std::runtime_error Solving LSE with singular system matrix failed.
+*/
+template< typename Type >  // Data type of the factors
+template< typename MT      // Type of the right-hand side matrix
+        , bool SO >        // Storage order of the right-hand side matrix
+DynamicMatrix<Type,SO> DenseQR<Type>::solve( const DenseMatrix<MT,SO>& B ) const
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*B).rows() != rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   DynamicMatrix<Type,SO> X( columns(), (*B).columns() );
+
+   for( size_t j=0UL; j<(*B).columns(); ++j ) {
+      column( X, j ) = solve( column( *B, j ) );
+   }
+
+   return X;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -45,11 +45,13 @@
 #include <blaze/math/constraints/BLASCompatible.h>
 #include <blaze/math/constraints/Computation.h>
 #include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/math/dense/Jacobi.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/lapack/geev.h>
 #include <blaze/math/lapack/heevd.h>
 #include <blaze/math/lapack/syevd.h>
+#include <blaze/math/StorageOrder.h>
 #include <blaze/math/typetraits/IsContiguous.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
 #include <blaze/math/typetraits/IsHermitian.h>
@@ -108,7 +110,8 @@ template< typename MT  // Type of the matrix A
         , typename VT  // Type of the vector w
         , bool TF >    // Transpose flag of the vector w
 inline auto eigen_backend( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w )
-   -> EnableIf_t< IsSymmetric_v<MT> && !IsDiagonal_v<MT> && IsFloatingPoint_v< ElementType_t<MT> > >
+   -> EnableIf_t< IsSymmetric_v<MT> && !IsDiagonal_v<MT> && IsFloatingPoint_v< ElementType_t<MT> > &&
+                  !IsJacobiCompatible_v<MT> >
 {
    using ATmp = RemoveAdaptor_t< ResultType_t<MT> >;
 
@@ -127,6 +130,62 @@ inline auto eigen_backend( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend for the eigenvalue computation of the given tiny dense symmetric matrix.
+// \ingroup dense_matrix
+//
+// \param A The given symmetric matrix.
+// \param w The resulting vector of eigenvalues.
+// \return void
+// \exception std::invalid_argument Vector cannot be resized.
+//
+// This function is the backend implementation for computing the eigenvalues of the given
+// dense symmetric matrix, whose maximum size is known at compile time and does not exceed
+// JACOBI_MAX_SIZE. Instead of calling the according LAPACK function it uses the cyclic
+// Jacobi method, which does not require any dynamic memory.\n
+// This function must \b NOT be called explicitly! It is used internally for the dispatch to
+// the correct LAPACK function. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors. Instead of using this function use the according
+// eigen() function.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector w
+        , bool TF >    // Transpose flag of the vector w
+inline auto eigen_backend( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w )
+   -> EnableIf_t< IsSymmetric_v<MT> && !IsDiagonal_v<MT> && IsJacobiCompatible_v<MT> >
+{
+   using RT = ElementType_t<MT>;
+
+   constexpr size_t N( JacobiSize_v<MT> );
+
+   BLAZE_INTERNAL_ASSERT( isSquare( *A ), "Non-square matrix detected" );
+
+   const size_t n( (*A).rows() );
+
+   CompositeType_t<MT> Atmp( *A );
+
+   RT a[N][N], wtmp[N], v[N][N];
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         a[i][j] = Atmp(i,j);
+      }
+   }
+
+   jacobiEigen( a, wtmp, v, n, false );
+
+   resize( *w, n, false );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      (*w)[i] = wtmp[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Backend for the eigenvalue computation of the given dense Hermitian matrix.
@@ -339,7 +398,11 @@ inline auto eigen_backend( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w )
 // element type results in a compile time error!
 //
 // \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a call to this function will result in a linker error.
+// the executable. Otherwise a call to this function will result in a linker error. The only
+// exception are symmetric matrices with \c float or \c double element type, whose maximum
+// size is known at compile time and does not exceed 4x4 (as for instance \c StaticMatrix and
+// \c HybridMatrix). These are decomposed by the cyclic Jacobi method without any dynamic
+// memory allocation and without calling LAPACK.
 //
 // \note Further options for computing eigenvalues and eigenvectors are available via the geev(),
 // syev(), syevd(), syevx(), heev(), heevd(), and heevx() functions.
@@ -367,7 +430,7 @@ inline void eigen( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w )
 
    eigen_backend( *A, wtmp );
 
-   if( IsContiguous_v<VT> ) {
+   if( !IsContiguous_v<VT> ) {
       (*w) = wtmp;
    }
 }
@@ -402,7 +465,8 @@ template< typename MT1  // Type of the matrix A
         , typename MT2  // Type of the matrix V
         , bool SO2 >    // Storage order of the matrix V
 inline auto eigen_backend( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& V )
-   -> EnableIf_t< IsSymmetric_v<MT1> && !IsDiagonal_v<MT1> && IsFloatingPoint_v< ElementType_t<MT1> > >
+   -> EnableIf_t< IsSymmetric_v<MT1> && !IsDiagonal_v<MT1> && IsFloatingPoint_v< ElementType_t<MT1> > &&
+                  !IsJacobiCompatible_v<MT1> >
 {
    using ATmp = RemoveAdaptor_t< ResultType_t<MT1> >;
 
@@ -426,6 +490,73 @@ inline auto eigen_backend( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w,
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend for the eigenvalue computation of the given tiny dense symmetric matrix.
+// \ingroup dense_matrix
+//
+// \param A The given symmetric matrix.
+// \param w The resulting vector of eigenvalues.
+// \param V The resulting matrix of eigenvectors.
+// \return void
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+//
+// This function is the backend implementation for computing the eigenvalues and eigenvectors
+// of the given dense symmetric matrix, whose maximum size is known at compile time and does
+// not exceed JACOBI_MAX_SIZE. Instead of calling the according LAPACK function it uses the
+// cyclic Jacobi method, which does not require any dynamic memory.\n
+// This function must \b NOT be called explicitly! It is used internally for the dispatch to
+// the correct LAPACK function. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors. Instead of using this function use the according
+// eigen() function.
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO1      // Storage order of the matrix A
+        , typename VT   // Type of the vector w
+        , bool TF       // Transpose flag of the vector w
+        , typename MT2  // Type of the matrix V
+        , bool SO2 >    // Storage order of the matrix V
+inline auto eigen_backend( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& V )
+   -> EnableIf_t< IsSymmetric_v<MT1> && !IsDiagonal_v<MT1> && IsJacobiCompatible_v<MT1> >
+{
+   using RT = ElementType_t<MT1>;
+
+   constexpr size_t N( JacobiSize_v<MT1> );
+
+   BLAZE_INTERNAL_ASSERT( isSquare( *A ), "Non-square matrix detected" );
+
+   const size_t n( (*A).rows() );
+
+   CompositeType_t<MT1> Atmp( *A );
+
+   RT a[N][N], wtmp[N], v[N][N];
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         a[i][j] = Atmp(i,j);
+      }
+   }
+
+   jacobiEigen( a, wtmp, v, n, true );
+
+   resize( *w, n, false );
+   resize( *V, n, n, false );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      (*w)[j] = wtmp[j];
+      for( size_t i=0UL; i<n; ++i ) {
+         if( SO2 == rowMajor )
+            (*V)(j,i) = v[j][i];
+         else
+            (*V)(i,j) = v[j][i];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Backend for the eigenvalue computation of the given dense Hermitian matrix.
@@ -675,7 +806,11 @@ inline auto eigen_backend( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w,
 // element type results in a compile time error!
 //
 // \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a call to this function will result in a linker error.
+// the executable. Otherwise a call to this function will result in a linker error. The only
+// exception are symmetric matrices with \c float or \c double element type, whose maximum
+// size is known at compile time and does not exceed 4x4 (as for instance \c StaticMatrix and
+// \c HybridMatrix). These are decomposed by the cyclic Jacobi method without any dynamic
+// memory allocation and without calling LAPACK.
 //
 // \note Further options for computing eigenvalues and eigenvectors are available via the geev(),
 // syev(), syevd(), syevx(), heev(), heevd(), and heevx() functions.
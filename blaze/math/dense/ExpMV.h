@@ -0,0 +1,284 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/ExpMV.h
+//  \brief Header file for the action of the matrix exponential on a vector
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_EXPMV_H_
+#define _BLAZE_MATH_DENSE_EXPMV_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DMatReduceExpr.h>
+#include <blaze/math/expressions/DVecNormExpr.h>
+#include <blaze/math/expressions/DVecReduceExpr.h>
+#include <blaze/math/expressions/SMatReduceExpr.h>
+#include <blaze/math/Matrix.h>
+#include <blaze/math/ReductionFlag.h>
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/shims/Exp.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the 1-norm of the shifted matrix \f$ A - \mu I \f$.
+// \ingroup dense_vector
+//
+// \param A The given square matrix.
+// \param mu The shift.
+// \return The 1-norm (i.e. the maximum absolute column sum) of \f$ A - \mu I \f$.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO      // Storage order of the matrix
+        , typename ET >  // Type of the shift
+auto expmvNorm1( const Matrix<MT,SO>& A, const ET& mu )
+{
+   using BT = UnderlyingBuiltin_t<ET>;
+
+   DynamicVector<BT,rowVector> sums( sum<columnwise>( abs( *A ) ) );
+
+   for( size_t j=0UL; j<sums.size(); ++j ) {
+      const auto ajj( (*A)(j,j) );
+      sums[j] += abs( ajj - mu ) - abs( ajj );
+   }
+
+   return sums.size() > 0UL ? max( sums ) : BT();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Selects the degree of the Taylor polynomial and the number of scaling steps for expmv().
+// \ingroup dense_vector
+//
+// \param norm The 1-norm of the (shifted and scaled) matrix \f$ tA \f$.
+// \param m The selected degree of the truncated Taylor series.
+// \param s The selected number of scaling steps.
+// \return void
+//
+// This function selects the pair \f$ (m,s) \f$ that minimizes the number \f$ ms \f$ of matrix/
+// vector multiplications subject to \f$ \|tA\|_1 / s \leq \theta_m \f$, where the bounds
+// \f$ \theta_m \f$ guarantee a backward error of at most \f$ 2^{-53} \f$ (see A.H. Al-Mohy and
+// N.J. Higham, "Computing the Action of the Matrix Exponential, with an Application to
+// Exponential Integrators", SIAM J. Sci. Comput. 33(2), 2011, Table 3.1).
+*/
+inline void expmvDegree( double norm, size_t& m, size_t& s )
+{
+   static constexpr size_t degrees[35] = {
+       1UL,  2UL,  3UL,  4UL,  5UL,  6UL,  7UL,  8UL,  9UL, 10UL, 11UL, 12UL, 13UL, 14UL, 15UL,
+      16UL, 17UL, 18UL, 19UL, 20UL, 21UL, 22UL, 23UL, 24UL, 25UL, 26UL, 27UL, 28UL, 29UL, 30UL,
+      35UL, 40UL, 45UL, 50UL, 55UL
+   };
+
+   static constexpr double theta[35] = {
+      2.29e-16, 2.58e-8, 1.39e-5, 3.40e-4, 2.40e-3, 9.07e-3, 2.38e-2, 5.00e-2, 8.96e-2, 1.44e-1,
+      2.14e-1, 3.00e-1, 4.00e-1, 5.14e-1, 6.41e-1, 7.81e-1, 9.31e-1, 1.09, 1.26, 1.44,
+      1.62, 1.82, 2.01, 2.22, 2.43, 2.64, 2.86, 3.08, 3.31, 3.54,
+      4.7, 6.0, 7.2, 8.5, 9.9
+   };
+
+   m = 0UL;
+   s = 1UL;
+
+   if( !( norm > 0.0 ) ) return;
+
+   double cost( std::numeric_limits<double>::max() );
+
+   for( size_t i=0UL; i<35UL; ++i ) {
+      const double steps( std::max( 1.0, std::ceil( norm / theta[i] ) ) );
+      if( degrees[i] * steps < cost ) {
+         cost = degrees[i] * steps;
+         m    = degrees[i];
+         s    = static_cast<size_t>( steps );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPMV FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the action of the matrix exponential \f$ e^{tA} v \f$.
+// \ingroup dense_vector
+//
+// \param A The square (dense or sparse) matrix \f$ A \f$.
+// \param v The dense vector \f$ v \f$.
+// \param t The real scalar factor \f$ t \f$.
+// \return The vector \f$ e^{tA} v \f$.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function computes \f$ e^{tA} v \f$ without forming \f$ e^{tA} \f$. It implements the
+// truncated Taylor series algorithm by Al-Mohy and Higham (SIAM J. Sci. Comput. 33(2), 2011):
+// The matrix is shifted by \f$ \mu = trace(A)/n \f$, the interval \f$ [0,t] \f$ is split into
+// \a s steps and in every step a Taylor polynomial of degree of at most \a m is applied, where
+// \a m and \a s are selected from the 1-norm of \f$ t(A - \mu I) \f$. The only operations on
+// \a A are matrix/vector multiplications, which are performed by means of the (potentially
+// parallel) dense or sparse matrix/vector multiplication kernels. Therefore the function is
+// particularly well suited for large sparse matrices and for exponential time integrators:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> u0, u;
+   // ... Resizing and initialization
+
+   u = expmv( A, u0, 0.1 );  // Computes the solution of u' = Au at time 0.1
+   \endcode
+
+// \note The function only uses the 1-norm of \a A to select the parameters \a m and \a s. For
+// highly non-normal matrices this may result in more matrix/vector multiplications than the
+// estimates of \f$ \|A^p\|_1^{1/p} \f$ used by the original algorithm.
+*/
+template< typename MT    // Type of the matrix
+        , bool SO        // Storage order of the matrix
+        , typename VT    // Type of the dense vector
+        , typename ST >  // Type of the real scalar factor
+auto expmv( const Matrix<MT,SO>& A, const DenseVector<VT,columnVector>& v, ST t )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using RT = MultTrait_t< ResultType_t<MT>, ResultType_t<VT> >;
+   using ET = ElementType_t<RT>;
+   using BT = UnderlyingBuiltin_t<ET>;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ET );
+
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (*A).columns() != (*v).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   const size_t n( (*v).size() );
+
+   RT F( *v );
+
+   if( n == 0UL ) {
+      return F;
+   }
+
+   const BT tau( t );
+   const ET mu( ET( trace( *A ) ) / BT( n ) );
+
+   size_t m, s;
+   expmvDegree( abs( tau ) * expmvNorm1( *A, mu ), m, s );
+
+   const BT tol( std::numeric_limits<BT>::epsilon() / BT(2) );
+   const ET eta( exp( tau * mu / BT( s ) ) );
+
+   RT b( F ), w( n );
+
+   for( size_t i=0UL; i<s; ++i )
+   {
+      BT c1( maxNorm( b ) );
+
+      for( size_t j=0UL; j<m; ++j )
+      {
+         w = *A * b;
+         b = ( tau / BT( s*(j+1UL) ) ) * ( w - mu * b );
+
+         const BT c2( maxNorm( b ) );
+         F += b;
+
+         if( c1 + c2 <= tol * maxNorm( F ) ) break;
+         c1 = c2;
+      }
+
+      F *= eta;
+      b = F;
+   }
+
+   return F;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the action of the matrix exponential \f$ e^{A} v \f$.
+// \ingroup dense_vector
+//
+// \param A The square (dense or sparse) matrix \f$ A \f$.
+// \param v The dense vector \f$ v \f$.
+// \return The vector \f$ e^{A} v \f$.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function computes \f$ e^{A} v \f$ without forming \f$ e^{A} \f$. For details see the
+// expmv() overload with scalar factor.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO      // Storage order of the matrix
+        , typename VT >  // Type of the dense vector
+auto expmv( const Matrix<MT,SO>& A, const DenseVector<VT,columnVector>& v )
+{
+   return expmv( *A, *v, 1.0 );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -46,6 +46,9 @@
 #include <blaze/math/constraints/BLASCompatible.h>
 #include <blaze/math/constraints/StrictlyTriangular.h>
 #include <blaze/math/constraints/Uniform.h>
+#include <blaze/math/dense/BlockedLDLT.h>
+#include <blaze/math/dense/BlockedLLH.h>
+#include <blaze/math/dense/BlockedLU.h>
 #include <blaze/math/dense/StaticMatrix.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
@@ -70,6 +73,7 @@
 #include <blaze/math/typetraits/IsUniLower.h>
 #include <blaze/math/typetraits/IsUniUpper.h>
 #include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/system/LAPACK.h>
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
@@ -3327,7 +3331,9 @@ inline void invert6x6( DenseMatrix<MT,SO>& dm )
 // matrices of any other element type results in a compile time error!
 //
 // \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a linker error will be created.
+// the executable. Otherwise a linker error will be created. In case the
+// BLAZE_USE_LAPACK_LU_DECOMPOSITION switch is deactivated, the inversion is computed by the
+// native blocked LU decomposition and no LAPACK library is required.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a dm may already have been modified.
@@ -3342,8 +3348,13 @@ inline void invertByLU( DenseMatrix<MT,SO>& dm )
    const size_t n( min( (*dm).rows(), (*dm).columns() ) );
    const std::unique_ptr<blas_int_t[]> ipiv( new blas_int_t[n] );
 
+#if BLAZE_USE_LAPACK_LU_DECOMPOSITION
    getrf( *dm, ipiv.get() );
    getri( *dm, ipiv.get() );
+#else
+   getrfBlocked( *dm, ipiv.get() );
+   getriBlocked( *dm, ipiv.get() );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3372,7 +3383,9 @@ inline void invertByLU( DenseMatrix<MT,SO>& dm )
 // matrices of any other element type results in a compile time error!
 //
 // \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a linker error will be created.
+// the executable. Otherwise a linker error will be created. In case the
+// BLAZE_USE_LAPACK_LDLT_DECOMPOSITION switch is deactivated, the inversion is computed by the
+// native blocked Bunch-Kaufman decomposition and no LAPACK library is required.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a dm may already have been modified.
@@ -3386,11 +3399,16 @@ inline void invertByLDLT( DenseMatrix<MT,SO>& dm )
 
    BLAZE_USER_ASSERT( isSymmetric( *dm ), "Invalid non-symmetric matrix detected" );
 
-   const char uplo( ( SO )?( 'L' ):( 'U' ) );
    const std::unique_ptr<blas_int_t[]> ipiv( new blas_int_t[(*dm).rows()] );
 
+#if BLAZE_USE_LAPACK_LDLT_DECOMPOSITION
+   const char uplo( ( SO )?( 'L' ):( 'U' ) );
    sytrf( *dm, uplo, ipiv.get() );
    sytri( *dm, uplo, ipiv.get() );
+#else
+   sytrfBlocked( *dm, ipiv.get() );
+   sytriBlocked( *dm, ipiv.get() );
+#endif
 
    if( SO ) {
       for( size_t i=1UL; i<(*dm).rows(); ++i ) {
@@ -3434,7 +3452,9 @@ inline void invertByLDLT( DenseMatrix<MT,SO>& dm )
 // matrices of any other element type results in a compile time error!
 //
 // \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a linker error will be created.
+// the executable. Otherwise a linker error will be created. In case the
+// BLAZE_USE_LAPACK_LDLT_DECOMPOSITION switch is deactivated, the inversion is computed by the
+// native blocked Bunch-Kaufman decomposition and no LAPACK library is required.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a dm may already have been modified.
@@ -3473,7 +3493,9 @@ inline auto invertByLDLH( DenseMatrix<MT,SO>& dm )
 // matrices of any other element type results in a compile time error!
 //
 // \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a linker error will be created.
+// the executable. Otherwise a linker error will be created. In case the
+// BLAZE_USE_LAPACK_LDLT_DECOMPOSITION switch is deactivated, the inversion is computed by the
+// native blocked Bunch-Kaufman decomposition and no LAPACK library is required.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a dm may already have been modified.
@@ -3488,11 +3510,16 @@ inline auto invertByLDLH( DenseMatrix<MT,SO>& dm )
 
    BLAZE_USER_ASSERT( isHermitian( *dm ), "Invalid non-Hermitian matrix detected" );
 
-   const char uplo( ( SO )?( 'L' ):( 'U' ) );
    const std::unique_ptr<blas_int_t[]> ipiv( new blas_int_t[(*dm).rows()] );
 
+#if BLAZE_USE_LAPACK_LDLT_DECOMPOSITION
+   const char uplo( ( SO )?( 'L' ):( 'U' ) );
    hetrf( *dm, uplo, ipiv.get() );
    hetri( *dm, uplo, ipiv.get() );
+#else
+   hetrfBlocked( *dm, ipiv.get() );
+   hetriBlocked( *dm, ipiv.get() );
+#endif
 
    if( SO ) {
       for( size_t i=1UL; i<(*dm).rows(); ++i ) {
@@ -3536,7 +3563,9 @@ inline auto invertByLDLH( DenseMatrix<MT,SO>& dm )
 // matrices of any other element type results in a compile time error!
 //
 // \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a linker error will be created.
+// the executable. Otherwise a linker error will be created. In case the
+// BLAZE_USE_LAPACK_LLH_DECOMPOSITION switch is deactivated, the inversion is computed by the
+// native blocked Cholesky decomposition and no LAPACK library is required.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a dm may already have been modified.
@@ -3552,8 +3581,13 @@ inline void invertByLLH( DenseMatrix<MT,SO>& dm )
 
    const char uplo( ( SO )?( 'L' ):( 'U' ) );
 
+#if BLAZE_USE_LAPACK_LLH_DECOMPOSITION
    potrf( *dm, uplo );
    potri( *dm, uplo );
+#else
+   potrfBlocked( *dm, uplo );
+   potriBlocked( *dm, uplo );
+#endif
 
    if( SO ) {
       for( size_t i=1UL; i<(*dm).rows(); ++i ) {
@@ -0,0 +1,446 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Jacobi.h
+//  \brief Header file for the Jacobi eigenvalue and singular value kernels for tiny matrices
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_JACOBI_H_
+#define _BLAZE_MATH_DENSE_JACOBI_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/typetraits/MaxSize.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  TYPE TRAITS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The maximum number of rows and columns of matrices decomposed by the Jacobi kernels.
+// \ingroup dense_matrix
+*/
+constexpr size_t JACOBI_MAX_SIZE = 4UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The maximum number of sweeps of the Jacobi kernels.
+// \ingroup dense_matrix
+//
+// The Jacobi kernels converge quadratically, i.e. a tiny matrix is usually diagonalized
+// within 4 to 6 sweeps. The limit only guards against infinite loops for non-finite input.
+*/
+constexpr size_t JACOBI_MAX_SWEEPS = 30UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compile time check whether the given matrix type is decomposed by the Jacobi kernels.
+// \ingroup dense_matrix
+//
+// This variable template evaluates to \a true in case the given matrix type has a real floating
+// point element type and in case the maximum number of rows and columns is known at compile
+// time and does not exceed JACOBI_MAX_SIZE (as for instance in case of StaticMatrix and
+// HybridMatrix, adaptors thereof and expressions on them). For these matrices the eigen() and
+// svd() functions use the heap-free Jacobi kernels instead of the according LAPACK functions.
+*/
+template< typename MT >
+constexpr bool IsJacobiCompatible_v =
+   ( IsFloatingPoint_v< ElementType_t<MT> > &&
+     MaxSize_v<MT,0UL> != DefaultMaxSize_v && MaxSize_v<MT,0UL> <= ptrdiff_t( JACOBI_MAX_SIZE ) &&
+     MaxSize_v<MT,1UL> != DefaultMaxSize_v && MaxSize_v<MT,1UL> <= ptrdiff_t( JACOBI_MAX_SIZE ) );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The size of the local work arrays of the Jacobi kernels for the given matrix type.
+// \ingroup dense_matrix
+*/
+template< typename MT >
+constexpr size_t JacobiSize_v =
+   ( MaxSize_v<MT,0UL> >= MaxSize_v<MT,1UL> )
+   ?( MaxSize_v<MT,0UL> > 0L ? size_t( MaxSize_v<MT,0UL> ) : 1UL )
+   :( size_t( MaxSize_v<MT,1UL> ) );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  JACOBI KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the Jacobi rotation annihilating the off-diagonal element of a
+//        symmetric 2x2 matrix.
+// \ingroup dense_matrix
+//
+// \param app The first diagonal element.
+// \param aqq The second diagonal element.
+// \param apq The off-diagonal element.
+// \return The tangent \f$ t \f$ of the rotation angle (0 in case no rotation is required).
+//
+// This function computes the tangent of the rotation \f$ J = \left(\begin{array}{cc} c & s \\
+// -s & c \end{array}\right) \f$ with \f$ c = 1/\sqrt{1+t^2} \f$ and \f$ s = tc \f$, which
+// diagonalizes the given symmetric 2x2 matrix (i.e. the closed form solution of the 2x2
+// problem). The diagonal elements of \f$ J^T A J \f$ are \f$ a_{pp} - t a_{pq} \f$ and
+// \f$ a_{qq} + t a_{pq} \f$. In case the off-diagonal element is negligible in comparison to
+// the geometric mean of the diagonal elements, no rotation is required and 0 is returned. The
+// function does not branch, i.e. it can be vectorized across a batch of matrices.
+*/
+template< typename RT >  // Type of the matrix elements
+inline RT jacobiTangent( RT app, RT aqq, RT apq ) noexcept
+{
+   using std::abs;
+   using std::sqrt;
+
+   const bool rotate( abs( apq ) > std::numeric_limits<RT>::epsilon() * sqrt( abs( app*aqq ) ) );
+
+   const RT d( aqq - app );
+   const RT r( abs( d ) + sqrt( d*d + RT(4)*apq*apq ) );
+   const RT t( RT(2) * apq / ( rotate ? r : RT(1) ) );
+
+   return rotate ? ( d < RT(0) ? -t : t ) : RT(0);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cyclic Jacobi eigenvalue kernel for a tiny symmetric matrix.
+// \ingroup dense_matrix
+//
+// \param a The symmetric \a n-by-\a n matrix (full storage); destroyed on exit.
+// \param w The resulting \a n eigenvalues in ascending order.
+// \param v The resulting eigenvectors (\f$ v[j][i] \f$ is element \a i of eigenvector \a j).
+// \param n The number of rows and columns of the matrix.
+// \param vectors \a true in case the eigenvectors are requested, \a false if not.
+// \return void
+//
+// This function diagonalizes the given symmetric matrix by means of cyclic sweeps of Jacobi
+// rotations. In contrast to the LAPACK based decomposition it performs no memory allocation
+// and the eigenvalues are computed to high relative accuracy.
+*/
+template< size_t N       // Size of the work arrays
+        , typename RT >  // Type of the matrix elements
+void jacobiEigen( RT (&a)[N][N], RT (&w)[N], RT (&v)[N][N], size_t n, bool vectors )
+{
+   using std::sqrt;
+
+   if( vectors ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         for( size_t i=0UL; i<n; ++i ) {
+            v[j][i] = ( i == j ) ? RT(1) : RT(0);
+         }
+      }
+   }
+
+   for( size_t sweep=0UL; sweep<JACOBI_MAX_SWEEPS; ++sweep )
+   {
+      bool rotated( false );
+
+      for( size_t p=0UL; p<n; ++p ) {
+         for( size_t q=p+1UL; q<n; ++q )
+         {
+            const RT apq( a[p][q] );
+            const RT t( jacobiTangent( a[p][p], a[q][q], apq ) );
+
+            if( isDefault<strict>( t ) ) continue;
+
+            const RT c( RT(1) / sqrt( RT(1) + t*t ) );
+            const RT s( t*c );
+
+            a[p][p] -= t*apq;
+            a[q][q] += t*apq;
+            a[p][q] = a[q][p] = RT(0);
+
+            for( size_t r=0UL; r<n; ++r ) {
+               if( r == p || r == q ) continue;
+               const RT arp( a[r][p] );
+               const RT arq( a[r][q] );
+               a[r][p] = a[p][r] = c*arp - s*arq;
+               a[r][q] = a[q][r] = s*arp + c*arq;
+            }
+
+            if( vectors ) {
+               for( size_t r=0UL; r<n; ++r ) {
+                  const RT vp( v[p][r] );
+                  const RT vq( v[q][r] );
+                  v[p][r] = c*vp - s*vq;
+                  v[q][r] = s*vp + c*vq;
+               }
+            }
+
+            rotated = true;
+         }
+      }
+
+      if( !rotated ) break;
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      w[i] = a[i][i];
+   }
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      size_t k( i );
+      for( size_t j=i+1UL; j<n; ++j ) {
+         if( w[j] < w[k] ) k = j;
+      }
+
+      if( k == i ) continue;
+
+      std::swap( w[i], w[k] );
+      if( vectors ) {
+         for( size_t r=0UL; r<n; ++r ) {
+            std::swap( v[i][r], v[k][r] );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Completion of a set of orthonormal vectors to a larger orthonormal set.
+// \ingroup dense_matrix
+//
+// \param q The vectors (\f$ q[j][i] \f$ is element \a i of vector \a j).
+// \param first The number of given orthonormal vectors.
+// \param last The total number of requested orthonormal vectors.
+// \param len The length of the vectors.
+// \return void
+//
+// This function replaces the vectors \f$ q[first..last) \f$ by unit vectors, which are
+// orthogonal to all previous vectors. Each new vector is the Gram-Schmidt orthogonalized
+// (twice) canonical unit vector with the largest remaining component.
+*/
+template< size_t N       // Size of the work arrays
+        , typename RT >  // Type of the vector elements
+void jacobiComplete( RT (&q)[N][N], size_t first, size_t last, size_t len )
+{
+   using std::sqrt;
+
+   RT y[N];
+
+   for( size_t j=first; j<last; ++j )
+   {
+      RT best( -1 );
+
+      for( size_t e=0UL; e<len; ++e )
+      {
+         for( size_t i=0UL; i<len; ++i ) {
+            y[i] = ( i == e ) ? RT(1) : RT(0);
+         }
+
+         for( size_t pass=0UL; pass<2UL; ++pass ) {
+            for( size_t k=0UL; k<j; ++k ) {
+               RT h( 0 );
+               for( size_t i=0UL; i<len; ++i ) h += q[k][i] * y[i];
+               for( size_t i=0UL; i<len; ++i ) y[i] -= h * q[k][i];
+            }
+         }
+
+         RT norm( 0 );
+         for( size_t i=0UL; i<len; ++i ) norm += y[i] * y[i];
+
+         if( norm > best ) {
+            best = norm;
+            for( size_t i=0UL; i<len; ++i ) q[j][i] = y[i];
+         }
+      }
+
+      const RT scale( RT(1) / sqrt( best ) );
+      for( size_t i=0UL; i<len; ++i ) {
+         q[j][i] *= scale;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief One-sided Jacobi singular value kernel for a tiny matrix.
+// \ingroup dense_matrix
+//
+// \param x The \a nv vectors of length \a len to be orthogonalized (\f$ x[j][i] \f$ is element
+//          \a i of vector \a j); on exit the left singular vectors.
+// \param r The resulting right singular vectors (\f$ r[j][i] \f$ is element \a i of vector \a j).
+// \param s The resulting \a nv singular values in descending order.
+// \param nv The number of vectors (\f$ nv \leq len \f$).
+// \param len The length of the vectors.
+// \param vectors \a true in case the singular vectors are requested, \a false if not.
+// \param total The total number of requested left singular vectors (\f$ nv \leq total \leq len
+//              \f$).
+// \return void
+//
+// This function computes the singular value decomposition \f$ X^T = U S R^T \f$ of the
+// \a len-by-\a nv matrix \f$ X^T \f$ by means of the one-sided Jacobi method (Hestenes), i.e.
+// by cyclic sweeps of plane rotations that orthogonalize the vectors of \a x. On exit, the first
+// \a total vectors of \a x contain orthonormal left singular vectors, where the vectors of
+// (numerically) zero singular values and the additional \f$ total-nv \f$ vectors complete the
+// basis. No memory is allocated.
+*/
+template< size_t N       // Size of the work arrays
+        , typename RT >  // Type of the matrix elements
+void jacobiSVD( RT (&x)[N][N], RT (&r)[N][N], RT (&s)[N],
+                size_t nv, size_t len, bool vectors, size_t total )
+{
+   using std::sqrt;
+
+   if( vectors ) {
+      for( size_t j=0UL; j<nv; ++j ) {
+         for( size_t i=0UL; i<nv; ++i ) {
+            r[j][i] = ( i == j ) ? RT(1) : RT(0);
+         }
+      }
+   }
+
+   for( size_t sweep=0UL; sweep<JACOBI_MAX_SWEEPS; ++sweep )
+   {
+      bool rotated( false );
+
+      for( size_t p=0UL; p<nv; ++p ) {
+         for( size_t q=p+1UL; q<nv; ++q )
+         {
+            RT alpha( 0 ), beta( 0 ), gamma( 0 );
+            for( size_t i=0UL; i<len; ++i ) {
+               alpha += x[p][i] * x[p][i];
+               beta  += x[q][i] * x[q][i];
+               gamma += x[p][i] * x[q][i];
+            }
+
+            const RT t( jacobiTangent( alpha, beta, gamma ) );
+
+            if( isDefault<strict>( t ) ) continue;
+
+            const RT c( RT(1) / sqrt( RT(1) + t*t ) );
+            const RT sn( t*c );
+
+            for( size_t i=0UL; i<len; ++i ) {
+               const RT xp( x[p][i] );
+               const RT xq( x[q][i] );
+               x[p][i] = c*xp - sn*xq;
+               x[q][i] = sn*xp + c*xq;
+            }
+
+            if( vectors ) {
+               for( size_t i=0UL; i<nv; ++i ) {
+                  const RT rp( r[p][i] );
+                  const RT rq( r[q][i] );
+                  r[p][i] = c*rp - sn*rq;
+                  r[q][i] = sn*rp + c*rq;
+               }
+            }
+
+            rotated = true;
+         }
+      }
+
+      if( !rotated ) break;
+   }
+
+   for( size_t j=0UL; j<nv; ++j ) {
+      RT norm( 0 );
+      for( size_t i=0UL; i<len; ++i ) norm += x[j][i] * x[j][i];
+      s[j] = sqrt( norm );
+   }
+
+   for( size_t i=0UL; i<nv; ++i )
+   {
+      size_t k( i );
+      for( size_t j=i+1UL; j<nv; ++j ) {
+         if( s[j] > s[k] ) k = j;
+      }
+
+      if( k == i ) continue;
+
+      std::swap( s[i], s[k] );
+      if( vectors ) {
+         for( size_t j=0UL; j<len; ++j ) std::swap( x[i][j], x[k][j] );
+         for( size_t j=0UL; j<nv ; ++j ) std::swap( r[i][j], r[k][j] );
+      }
+   }
+
+   if( !vectors ) return;
+
+   const RT tol( ( nv > 0UL )?( RT(len) * std::numeric_limits<RT>::epsilon() * s[0] ):( RT(0) ) );
+
+   size_t rank( 0UL );
+
+   for( ; rank<nv && s[rank] > tol; ++rank ) {
+      const RT scale( RT(1) / s[rank] );
+      for( size_t i=0UL; i<len; ++i ) {
+         x[rank][i] *= scale;
+      }
+   }
+
+   jacobiComplete( x, rank, total, len );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -47,11 +47,13 @@
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/constraints/UniTriangular.h>
 #include <blaze/math/constraints/Upper.h>
+#include <blaze/math/dense/BlockedLLH.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/potrf.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/LAPACK.h>
 
 
 namespace blaze {
@@ -115,7 +117,9 @@ void llh( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& L );
 // element type results in a compile time error!
 //
 // \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a call to this function will result in a linker error.
+// the executable. Otherwise a call to this function will result in a linker error. In case the
+// BLAZE_USE_LAPACK_LLH_DECOMPOSITION switch is deactivated, the decomposition is computed by the
+// native blocked Cholesky decomposition (see potrfBlocked()) and no LAPACK library is required.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a L may already have been modified.
@@ -165,7 +169,11 @@ void llh( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& L )
       }
    }
 
+#if BLAZE_USE_LAPACK_LLH_DECOMPOSITION
    potrf( l, 'L' );
+#else
+   potrfBlocked( l, 'L' );
+#endif
 }
 //*************************************************************************************************
 
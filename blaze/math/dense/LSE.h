@@ -46,6 +46,8 @@
 #include <blaze/math/constraints/ColumnMajorMatrix.h>
 #include <blaze/math/constraints/StrictlyTriangular.h>
 #include <blaze/math/constraints/Uniform.h>
+#include <blaze/math/dense/BlockedLDLT.h>
+#include <blaze/math/dense/BlockedLU.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
@@ -64,6 +66,7 @@
 #include <blaze/math/typetraits/IsUniUpper.h>
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/typetraits/RemoveAdaptor.h>
+#include <blaze/system/LAPACK.h>
 #include <blaze/system/MacroDisable.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/SameType.h>
@@ -5253,7 +5256,11 @@ void solveNxN( const DenseMatrix<MT,SO>& A, DenseVector<VT1,TF1>& x, const Dense
 
    const std::unique_ptr<blas_int_t[]> ipiv( new blas_int_t[N] );
 
+#if BLAZE_USE_LAPACK_LU_DECOMPOSITION
    gesv( Atmp, *x, ipiv.get() );
+#else
+   gesvBlocked( Atmp, *x, ipiv.get() );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -5314,7 +5321,11 @@ void solveNxN( const DenseMatrix<MT,SO>& A, DenseVector<VT1,TF1>& x, const Dense
 
    const std::unique_ptr<blas_int_t[]> ipiv( new blas_int_t[N] );
 
+#if BLAZE_USE_LAPACK_LDLT_DECOMPOSITION
    sysv( Atmp, *x, 'L', ipiv.get() );
+#else
+   sysvBlocked( Atmp, *x, ipiv.get() );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -5375,7 +5386,11 @@ void solveNxN( const DenseMatrix<MT,SO>& A, DenseVector<VT1,TF1>& x, const Dense
 
    const std::unique_ptr<blas_int_t[]> ipiv( new blas_int_t[N] );
 
+#if BLAZE_USE_LAPACK_LDLT_DECOMPOSITION
    hesv( Atmp, *x, 'L', ipiv.get() );
+#else
+   hesvBlocked( Atmp, *x, ipiv.get() );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -5760,7 +5775,11 @@ void solveNxN( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& X, const Den
 
    const std::unique_ptr<blas_int_t[]> ipiv( new blas_int_t[N] );
 
+#if BLAZE_USE_LAPACK_LU_DECOMPOSITION
    gesv( Atmp, Xtmp, ipiv.get() );
+#else
+   gesvBlocked( Atmp, Xtmp, ipiv.get() );
+#endif
 
    resize( *X, Xtmp.rows(), Xtmp.columns() );
    smpAssign( *X, Xtmp );
@@ -5827,7 +5846,11 @@ void solveNxN( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& X, const Den
 
    const std::unique_ptr<blas_int_t[]> ipiv( new blas_int_t[N] );
 
+#if BLAZE_USE_LAPACK_LDLT_DECOMPOSITION
    sysv( Atmp, Xtmp, 'L', ipiv.get() );
+#else
+   sysvBlocked( Atmp, Xtmp, ipiv.get() );
+#endif
 
    resize( *X, Xtmp.rows(), Xtmp.columns() );
    smpAssign( *X, Xtmp );
@@ -5894,7 +5917,11 @@ void solveNxN( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& X, const Den
 
    const std::unique_ptr<blas_int_t[]> ipiv( new blas_int_t[N] );
 
+#if BLAZE_USE_LAPACK_LDLT_DECOMPOSITION
    hesv( Atmp, Xtmp, 'L', ipiv.get() );
+#else
+   hesvBlocked( Atmp, Xtmp, ipiv.get() );
+#endif
 
    resize( *X, Xtmp.rows(), Xtmp.columns() );
    smpAssign( *X, Xtmp );
@@ -51,12 +51,14 @@
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/constraints/UniTriangular.h>
 #include <blaze/math/constraints/Upper.h>
+#include <blaze/math/dense/BlockedLU.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/getrf.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsSquare.h>
 #include <blaze/util/algorithms/Min.h>
+#include <blaze/system/LAPACK.h>
 #include <blaze/util/NumericCast.h>
 
 
@@ -114,7 +116,11 @@ void lu( DenseMatrix<MT1,SO1>& A, Matrix<MT2,SO2>& P )
    blas_int_t* ipiv  ( helper.get() );
    blas_int_t* permut( ipiv + mindim );
 
+#if BLAZE_USE_LAPACK_LU_DECOMPOSITION
    getrf( *A, ipiv );
+#else
+   getrfBlocked( *A, ipiv );
+#endif
 
    for( int i=0; i<size; ++i ) {
       permut[i] = i;
@@ -207,7 +213,9 @@ void lu( DenseMatrix<MT1,SO1>& A, Matrix<MT2,SO2>& P )
 // element type results in a compile time error!
 //
 // \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a call to this function will result in a linker error.
+// the executable. Otherwise a call to this function will result in a linker error. In case the
+// BLAZE_USE_LAPACK_LU_DECOMPOSITION switch is deactivated, the decomposition is computed by the
+// native blocked LU decomposition (see getrfBlocked()) and no LAPACK library is required.
 //
 // \note The LU decomposition will never fail, even for singular matrices. However, in case of a
 // singular matrix the resulting decomposition cannot be used for a matrix inversion or solving
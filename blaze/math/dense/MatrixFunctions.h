@@ -0,0 +1,917 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/MatrixFunctions.h
+//  \brief Header file for the dense matrix square root, logarithm, and power functions
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_MATRIXFUNCTIONS_H_
+#define _BLAZE_MATH_DENSE_MATRIXFUNCTIONS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/BlockedLU.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/Eigen.h>
+#include <blaze/math/dense/ExpMV.h>
+#include <blaze/math/dense/Inversion.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DMatExpExpr.h>
+#include <blaze/math/lapack/getrf.h>
+#include <blaze/math/lapack/getri.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/typetraits/IsDiagonal.h>
+#include <blaze/math/typetraits/IsHermitian.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
+#include <blaze/math/typetraits/RemoveAdaptor.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/system/LAPACK.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compile time check whether the matrix functions use the eigendecomposition.
+// \ingroup dense_matrix
+//
+// This variable template evaluates to \a true for real symmetric and for Hermitian matrix types
+// (as for instance SymmetricMatrix and HermitianMatrix), which have an orthonormal basis of
+// eigenvectors and real eigenvalues.
+*/
+template< typename MT >
+constexpr bool IsSelfAdjoint_v =
+   ( IsHermitian_v<MT> || ( IsSymmetric_v<MT> && IsFloatingPoint_v< ElementType_t<MT> > ) );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Principal square root of a single eigenvalue.
+// \ingroup dense_matrix
+//
+// \param a The eigenvalue.
+// \return The principal square root of \a a.
+// \exception std::invalid_argument Invalid matrix with negative eigenvalues provided.
+*/
+template< typename T >
+T sqrtmScalar( const T& a )
+{
+   using std::sqrt;
+
+   if( !IsComplex_v<T> && real( a ) < decltype( real( a ) )(0) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid matrix with negative eigenvalues provided" );
+   }
+
+   return sqrt( a );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Principal logarithm of a single eigenvalue.
+// \ingroup dense_matrix
+//
+// \param a The eigenvalue.
+// \return The principal logarithm of \a a.
+// \exception std::invalid_argument Invalid matrix with non-positive eigenvalues provided.
+*/
+template< typename T >
+T logmScalar( const T& a )
+{
+   using std::log;
+
+   if( isDefault<strict>( a ) || ( !IsComplex_v<T> && real( a ) < decltype( real( a ) )(0) ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid matrix with non-positive eigenvalues provided" );
+   }
+
+   return log( a );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Principal power of a single eigenvalue.
+// \ingroup dense_matrix
+//
+// \param a The eigenvalue.
+// \param p The (non-integer) exponent.
+// \return The principal power \f$ a^p \f$.
+// \exception std::invalid_argument Invalid matrix with negative eigenvalues provided.
+// \exception std::invalid_argument Invalid matrix with non-positive eigenvalues provided.
+*/
+template< typename T     // Type of the eigenvalue
+        , typename BT >  // Type of the exponent
+T powmScalar( const T& a, BT p )
+{
+   using std::pow;
+
+   if( p < BT(0) && isDefault<strict>( a ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid matrix with non-positive eigenvalues provided" );
+   }
+
+   if( !IsComplex_v<T> && real( a ) < decltype( real( a ) )(0) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid matrix with negative eigenvalues provided" );
+   }
+
+   return pow( a, p );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluation of a matrix function for diagonal matrices.
+// \ingroup dense_matrix
+//
+// \param A The diagonal matrix.
+// \param op The scalar function.
+// \return The matrix function \f$ f(A) \f$.
+//
+// This function is the backend implementation of the matrix functions for diagonal matrices,
+// which applies the given function to each diagonal element.
+*/
+template< typename MT    // Type of the matrix
+        , bool SO        // Storage order of the matrix
+        , typename OP >  // Type of the scalar function
+auto funm_backend( const DenseMatrix<MT,SO>& A, OP op )
+   -> EnableIf_t< IsDiagonal_v<MT>, RemoveAdaptor_t< ResultType_t<MT> > >
+{
+   RemoveAdaptor_t< ResultType_t<MT> > R( *A );
+
+   for( size_t i=0UL; i<R.rows(); ++i ) {
+      R(i,i) = op( R(i,i) );
+   }
+
+   return R;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluation of a matrix function for symmetric and Hermitian matrices.
+// \ingroup dense_matrix
+//
+// \param A The real symmetric or Hermitian matrix.
+// \param op The scalar function.
+// \return The matrix function \f$ f(A) \f$.
+//
+// This function is the backend implementation of the matrix functions for real symmetric and
+// Hermitian matrices. It computes the eigendecomposition \f$ A = V^H \Lambda V \f$ (see eigen())
+// and evaluates \f$ f(A) = V^H f(\Lambda) V \f$ by means of a single matrix multiplication.
+// Eigenvalues that are negative only due to rounding errors (i.e. by less than \f$ n \epsilon
+// \max|\lambda| \f$) are set to zero.
+*/
+template< typename MT    // Type of the matrix
+        , bool SO        // Storage order of the matrix
+        , typename OP >  // Type of the scalar function
+auto funm_backend( const DenseMatrix<MT,SO>& A, OP op )
+   -> EnableIf_t< IsSelfAdjoint_v<MT> && !IsDiagonal_v<MT>, RemoveAdaptor_t< ResultType_t<MT> > >
+{
+   using std::abs;
+
+   using ET = ElementType_t<MT>;
+   using BT = UnderlyingBuiltin_t<ET>;
+
+   const size_t n( (*A).rows() );
+
+   DynamicVector<BT,columnVector> w( n );
+   DynamicMatrix<ET,rowMajor> V( n, n );
+
+   eigen( *A, w, V );
+
+   BT wmax{};
+   for( size_t i=0UL; i<n; ++i ) {
+      if( abs( w[i] ) > wmax ) wmax = abs( w[i] );
+   }
+
+   const BT tol( BT( n ) * std::numeric_limits<BT>::epsilon() * wmax );
+
+   DynamicMatrix<ET,rowMajor> W( V );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const BT fi( op( w[i] < BT(0) && -w[i] <= tol ? BT(0) : w[i] ) );
+      for( size_t j=0UL; j<n; ++j ) {
+         W(i,j) *= fi;
+      }
+   }
+
+   return RemoveAdaptor_t< ResultType_t<MT> >( ctrans( V ) * W );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place LU-based inversion of a general dense matrix that also returns the logarithm
+//        of the absolute value of its determinant.
+// \ingroup dense_matrix
+//
+// \param dm The general dense matrix to be inverted.
+// \return The logarithm of the absolute value of the determinant of the given matrix.
+// \exception std::runtime_error Inversion of singular matrix failed.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+auto invertLogDet( DenseMatrix<MT,SO>& dm )
+{
+   using std::abs;
+   using std::log;
+
+   using BT = UnderlyingBuiltin_t< ElementType_t<MT> >;
+
+   const size_t n( (*dm).rows() );
+   const std::unique_ptr<blas_int_t[]> ipiv( new blas_int_t[n] );
+
+#if BLAZE_USE_LAPACK_LU_DECOMPOSITION
+   getrf( *dm, ipiv.get() );
+#else
+   getrfBlocked( *dm, ipiv.get() );
+#endif
+
+   BT logdet{};
+   for( size_t i=0UL; i<n; ++i ) {
+      logdet += log( abs( (*dm)(i,i) ) );
+   }
+
+#if BLAZE_USE_LAPACK_LU_DECOMPOSITION
+   getri( *dm, ipiv.get() );
+#else
+   getriBlocked( *dm, ipiv.get() );
+#endif
+
+   return logdet;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Principal square root of a general dense matrix by the Denman-Beavers iteration.
+// \ingroup dense_matrix
+//
+// \param A The general square matrix.
+// \return The principal square root of \a A.
+// \exception std::runtime_error Inversion of singular matrix failed.
+// \exception std::runtime_error Matrix square root computation failed.
+//
+// This function computes the principal square root by the product form of the Denman-Beavers
+// iteration with determinant scaling (see N.J. Higham, "Functions of Matrices: Theory and
+// Computation", SIAM, 2008, Section 6.3):
+
+      \f[ M_{k+1} = \frac{1}{2} \left( I + \frac{\mu_k^2 M_k + \mu_k^{-2} M_k^{-1}}{2} \right),
+          \quad Y_{k+1} = \frac{\mu_k}{2} Y_k \left( I + \mu_k^{-2} M_k^{-1} \right), \f]
+
+// where \f$ M_0 = Y_0 = A \f$ and \f$ \mu_k = |\det(M_k)|^{-1/(2n)} \f$. Each step requires one
+// LU-based inversion and one matrix multiplication. \f$ Y_k \f$ converges quadratically to
+// \f$ A^{1/2} \f$ in case \a A has no eigenvalues on the closed negative real axis. In case the
+// iteration does not converge, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the matrix
+MT sqrtm_general( const MT& A )
+{
+   using std::exp;
+   using std::sqrt;
+
+   using ET = ElementType_t<MT>;
+   using BT = UnderlyingBuiltin_t<ET>;
+
+   const size_t n( A.rows() );
+   const BT tol( sqrt( BT( n ) ) * std::numeric_limits<BT>::epsilon() );
+
+   MT M( A ), Y( A ), Minv( A );
+
+   bool scale( true );
+   BT res( std::numeric_limits<BT>::max() );
+
+   for( size_t k=0UL; k<100UL; ++k )
+   {
+      Minv = M;
+      const BT logdet( invertLogDet( Minv ) );
+
+      const BT mu2( scale ? exp( -logdet / BT( n ) ) : BT(1) );
+      const BT mu ( sqrt( mu2 ) );
+
+      Y = ( mu / BT(2) ) * ( Y + ( BT(1) / mu2 ) * ( Y * Minv ) );
+      M = ( mu2 / BT(4) ) * M + ( BT(1) / ( BT(4) * mu2 ) ) * Minv;
+
+      for( size_t i=0UL; i<n; ++i ) {
+         M(i,i) += BT(0.5);
+      }
+
+      const BT prev( res );
+      res = expmvNorm1( M, ET(1) );
+
+      if( res <= tol || ( !scale && res <= sqrt( tol ) && res > prev / BT(2) ) ) {
+         return Y;
+      }
+
+      if( res < BT(1E-2) ) {
+         scale = false;
+      }
+   }
+
+   BLAZE_THROW_RUNTIME_ERROR( "Matrix square root computation failed" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the nodes and weights of the Gauss-Legendre quadrature on \f$ [0,1] \f$.
+// \ingroup dense_matrix
+//
+// \param m The number of nodes.
+// \param x The array for the \a m nodes.
+// \param w The array for the \a m weights.
+// \return void
+*/
+inline void gaussLegendre( size_t m, double* x, double* w )
+{
+   const double pi( 3.14159265358979323846 );
+
+   for( size_t i=0UL; i<m; ++i )
+   {
+      double z( std::cos( pi * ( i + 0.75 ) / ( m + 0.5 ) ) );
+      double dp( 1.0 );
+
+      for( size_t iter=0UL; iter<100UL; ++iter )
+      {
+         double p1( 1.0 ), p2( 0.0 );
+
+         for( size_t j=1UL; j<=m; ++j ) {
+            const double p3( p2 );
+            p2 = p1;
+            p1 = ( ( 2.0*j - 1.0 ) * z * p2 - ( j - 1.0 ) * p3 ) / j;
+         }
+
+         dp = m * ( z*p1 - p2 ) / ( z*z - 1.0 );
+
+         const double dz( p1 / dp );
+         z -= dz;
+
+         if( std::abs( dz ) <= 1E-15 ) break;
+      }
+
+      x[i] = 0.5 * ( 1.0 - z );
+      w[i] = 1.0 / ( ( 1.0 - z*z ) * dp * dp );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Principal logarithm of a general dense matrix by inverse scaling and squaring.
+// \ingroup dense_matrix
+//
+// \param A The general square matrix.
+// \return The principal logarithm of \a A.
+// \exception std::runtime_error Inversion of singular matrix failed.
+// \exception std::runtime_error Matrix square root computation failed.
+//
+// This function computes the principal logarithm by the inverse scaling and squaring method
+// (see N.J. Higham, "Functions of Matrices: Theory and Computation", SIAM, 2008, Section 11.5):
+// Square roots are taken until \f$ \|A^{1/2^s} - I\|_1 \f$ is small enough for the [m/m] Padé
+// approximant to \f$ \log(I+X) \f$ to be accurate to double precision. The Padé approximant is
+// evaluated in partial fraction form via the \a m point Gauss-Legendre quadrature rule
+
+      \f[ r_m(X) = \sum_{j=1}^m w_j X (I + x_j X)^{-1}, \f]
+
+// which requires one inversion and one matrix multiplication per node. Finally, the result is
+// scaled by \f$ 2^s \f$.
+*/
+template< typename MT >  // Type of the matrix
+MT logm_general( const MT& A )
+{
+   using ET = ElementType_t<MT>;
+   using BT = UnderlyingBuiltin_t<ET>;
+
+   static constexpr double theta[7] = {
+      1.10e-5, 1.82e-3, 1.62e-2, 5.39e-2, 1.14e-1, 1.87e-1, 2.64e-1
+   };
+
+   const size_t n( A.rows() );
+
+   MT X( A );
+   size_t s( 0UL );
+
+   while( expmvNorm1( X, ET(1) ) > BT( theta[6] ) ) {
+      if( s == 64UL ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Matrix logarithm computation failed" );
+      }
+      X = sqrtm_general( X );
+      ++s;
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      X(i,i) -= BT(1);
+   }
+
+   const double norm( expmvNorm1( X, ET(0) ) );
+
+   size_t m( 1UL );
+   while( m < 7UL && norm > theta[m-1UL] ) {
+      ++m;
+   }
+
+   double nodes[7], weights[7];
+   gaussLegendre( m, nodes, weights );
+
+   MT L( X ), B( X );
+   reset( L );
+
+   for( size_t j=0UL; j<m; ++j )
+   {
+      B = BT( nodes[j] ) * X;
+      for( size_t i=0UL; i<n; ++i ) {
+         B(i,i) += BT(1);
+      }
+
+      invert( B );
+      L += BT( weights[j] ) * ( B * X );
+   }
+
+   L *= std::ldexp( BT(1), static_cast<int>( s ) );
+
+   return L;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the matrix square root for symmetric, Hermitian, and
+//        diagonal matrices.
+// \ingroup dense_matrix
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order of the matrix
+auto sqrtm_backend( const DenseMatrix<MT,SO>& A )
+   -> EnableIf_t< IsSelfAdjoint_v<MT> || IsDiagonal_v<MT>, RemoveAdaptor_t< ResultType_t<MT> > >
+{
+   return funm_backend( *A, []( const auto& a ){ return sqrtmScalar( a ); } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the matrix square root for general matrices.
+// \ingroup dense_matrix
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order of the matrix
+auto sqrtm_backend( const DenseMatrix<MT,SO>& A )
+   -> DisableIf_t< IsSelfAdjoint_v<MT> || IsDiagonal_v<MT>, RemoveAdaptor_t< ResultType_t<MT> > >
+{
+   using RT = RemoveAdaptor_t< ResultType_t<MT> >;
+
+   RT R( *A );
+
+   if( R.rows() < 2UL ) {
+      for( size_t i=0UL; i<R.rows(); ++i ) {
+         R(i,i) = sqrtmScalar( R(i,i) );
+      }
+      return R;
+   }
+
+   return sqrtm_general( R );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the matrix logarithm for symmetric, Hermitian, and diagonal
+//        matrices.
+// \ingroup dense_matrix
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order of the matrix
+auto logm_backend( const DenseMatrix<MT,SO>& A )
+   -> EnableIf_t< IsSelfAdjoint_v<MT> || IsDiagonal_v<MT>, RemoveAdaptor_t< ResultType_t<MT> > >
+{
+   return funm_backend( *A, []( const auto& a ){ return logmScalar( a ); } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the matrix logarithm for general matrices.
+// \ingroup dense_matrix
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order of the matrix
+auto logm_backend( const DenseMatrix<MT,SO>& A )
+   -> DisableIf_t< IsSelfAdjoint_v<MT> || IsDiagonal_v<MT>, RemoveAdaptor_t< ResultType_t<MT> > >
+{
+   using RT = RemoveAdaptor_t< ResultType_t<MT> >;
+
+   RT R( *A );
+
+   if( R.rows() < 2UL ) {
+      for( size_t i=0UL; i<R.rows(); ++i ) {
+         R(i,i) = logmScalar( R(i,i) );
+      }
+      return R;
+   }
+
+   return logm_general( R );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the non-integer matrix power for symmetric, Hermitian, and
+//        diagonal matrices.
+// \ingroup dense_matrix
+*/
+template< typename MT    // Type of the matrix
+        , bool SO        // Storage order of the matrix
+        , typename BT >  // Type of the exponent
+auto powm_backend( const DenseMatrix<MT,SO>& A, BT p )
+   -> EnableIf_t< IsSelfAdjoint_v<MT> || IsDiagonal_v<MT>, RemoveAdaptor_t< ResultType_t<MT> > >
+{
+   return funm_backend( *A, [p]( const auto& a ){ return powmScalar( a, p ); } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the non-integer matrix power for general matrices.
+// \ingroup dense_matrix
+//
+// This function splits the exponent into \f$ p = k + f \f$ with integer \a k and \f$ 0 < f < 1
+// \f$ and computes \f$ A^p = A^k e^{f \log(A)} \f$. In case of \f$ f = 1/2 \f$ the square root
+// is used instead of the exponential of the logarithm.
+*/
+template< typename MT    // Type of the matrix
+        , bool SO        // Storage order of the matrix
+        , typename BT >  // Type of the exponent
+auto powm_backend( const DenseMatrix<MT,SO>& A, BT p )
+   -> DisableIf_t< IsSelfAdjoint_v<MT> || IsDiagonal_v<MT>, RemoveAdaptor_t< ResultType_t<MT> > >
+{
+   using RT = RemoveAdaptor_t< ResultType_t<MT> >;
+
+   RT R( *A );
+
+   if( R.rows() < 2UL ) {
+      for( size_t i=0UL; i<R.rows(); ++i ) {
+         R(i,i) = powmScalar( R(i,i), p );
+      }
+      return R;
+   }
+
+   const BT k( std::floor( p ) );
+   const BT f( p - k );
+
+   RT F( f == BT(0.5) ? sqrtm_general( R ) : RT( matexp( f * logm_general( R ) ) ) );
+
+   if( k != BT(0) ) {
+      F = powm( R, k ) * F;
+   }
+
+   return F;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the principal square root of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The given square dense matrix.
+// \return The principal square root \f$ A^{1/2} \f$.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid matrix with negative eigenvalues provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+// \exception std::runtime_error Matrix square root computation failed.
+//
+// This function computes the principal square root \f$ X = A^{1/2} \f$ of the given matrix,
+// i.e. the unique solution of \f$ X^2 = A \f$ whose eigenvalues have positive real part:
+
+   \code
+   blaze::DynamicMatrix<double> A, X;
+   blaze::SymmetricMatrix< blaze::DynamicMatrix<double> > S;
+   // ... Resizing and initialization
+
+   X = sqrtm( A );  // Denman-Beavers iteration
+   X = sqrtm( S );  // Eigendecomposition of the symmetric matrix
+   \endcode
+
+// For real symmetric and Hermitian matrices (as for instance SymmetricMatrix and HermitianMatrix)
+// the square root is computed via the eigendecomposition of \a A. In this case all eigenvalues
+// have to be non-negative, else a \a std::invalid_argument exception is thrown. Diagonal matrices
+// are handled element-wise. For all other matrices the square root is computed by the scaled
+// Denman-Beavers iteration, which requires one LU-based inversion and one (parallel) matrix
+// multiplication per step. In case \a A is singular or has eigenvalues on the negative real axis
+// (in which case no principal square root exists), a \a std::runtime_error exception is thrown.
+//
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+auto sqrtm( const DenseMatrix<MT,SO>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   return sqrtm_backend( *A );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the principal logarithm of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The given square dense matrix.
+// \return The principal logarithm \f$ \log(A) \f$.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid matrix with non-positive eigenvalues provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+// \exception std::runtime_error Matrix square root computation failed.
+//
+// This function computes the principal logarithm \f$ X = \log(A) \f$ of the given matrix, i.e.
+// the unique solution of \f$ e^X = A \f$ whose eigenvalues have imaginary parts in
+// \f$ (-\pi,\pi) \f$:
+
+   \code
+   blaze::DynamicMatrix<double> A, X;
+   blaze::SymmetricMatrix< blaze::DynamicMatrix<double> > C;
+   // ... Resizing and initialization
+
+   X = logm( A );  // Inverse scaling and squaring
+   X = logm( C );  // Eigendecomposition of the symmetric positive definite matrix
+   \endcode
+
+// For real symmetric and Hermitian matrices the logarithm is computed via the eigendecomposition
+// of \a A. In this case all eigenvalues have to be positive, else a \a std::invalid_argument
+// exception is thrown. Diagonal matrices are handled element-wise. For all other matrices the
+// logarithm is computed by the inverse scaling and squaring method based on the square roots
+// of sqrtm() and on Padé approximants. In case \a A is singular or has eigenvalues on the
+// negative real axis, a \a std::runtime_error exception is thrown.
+//
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+auto logm( const DenseMatrix<MT,SO>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   return logm_backend( *A );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the (principal) power of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The given square dense matrix.
+// \param p The real exponent.
+// \return The (principal) power \f$ A^p \f$.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid matrix with negative eigenvalues provided.
+// \exception std::invalid_argument Invalid matrix with non-positive eigenvalues provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+// \exception std::runtime_error Matrix square root computation failed.
+//
+// This function computes the power \f$ A^p \f$ of the given matrix for the real exponent \a p:
+
+   \code
+   blaze::DynamicMatrix<double> A, X;
+   blaze::SymmetricMatrix< blaze::DynamicMatrix<double> > S;
+   // ... Resizing and initialization
+
+   X = powm( A, 3 );     // Repeated squaring
+   X = powm( A, -2 );    // Repeated squaring of the inverse
+   X = powm( A, 1.5 );   // A * sqrtm( A )
+   X = powm( S, 0.25 );  // Eigendecomposition of the symmetric matrix
+   \endcode
+
+// For integer exponents the power is computed by repeated squaring (of \f$ A^{-1} \f$ in case
+// of negative exponents) and is defined for any (for negative exponents invertible) matrix.
+// For non-integer exponents the principal power is computed. In case of real symmetric and
+// Hermitian matrices the eigendecomposition of \a A is used, which requires non-negative
+// eigenvalues (positive eigenvalues for negative exponents), else a \a std::invalid_argument
+// exception is thrown. Diagonal matrices are handled element-wise. For all other matrices the
+// exponent is split into \f$ p = k + f \f$ with integer \a k and \f$ 0 < f < 1 \f$ and the power
+// is computed as \f$ A^k e^{f \log(A)} \f$ (see logm() and matexp()).
+//
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order of the dense matrix
+        , typename ST >  // Type of the exponent
+auto powm( const DenseMatrix<MT,SO>& A, ST p )
+   -> EnableIf_t< IsNumeric_v<ST>, RemoveAdaptor_t< ResultType_t<MT> > >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using RT = RemoveAdaptor_t< ResultType_t<MT> >;
+   using BT = UnderlyingBuiltin_t< ElementType_t<MT> >;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const BT q( p );
+
+   if( std::floor( q ) != q || std::abs( q ) > BT( 1UL << 30 ) ) {
+      return powm_backend( *A, q );
+   }
+
+   RT B( *A );
+
+   if( q < BT(0) ) {
+      invert( B );
+   }
+
+   RT R( B );
+   bool first( true );
+
+   for( size_t e=static_cast<size_t>( std::abs( q ) ); e!=0UL; e/=2UL )
+   {
+      if( e & 1UL ) {
+         if( first ) R = B;
+         else R = R * B;
+         first = false;
+      }
+
+      if( e > 1UL ) {
+         B = B * B;
+      }
+   }
+
+   if( first ) {
+      reset( R );
+      for( size_t i=0UL; i<R.rows(); ++i ) {
+         R(i,i) = BT(1);
+      }
+   }
+
+   return R;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a general function of the given real symmetric or Hermitian matrix.
+// \ingroup dense_matrix
+//
+// \param A The given real symmetric or Hermitian matrix.
+// \param f The real scalar function.
+// \return The matrix function \f$ f(A) \f$.
+//
+// This function computes \f$ f(A) = V^H f(\Lambda) V \f$ via the eigendecomposition
+// \f$ A = V^H \Lambda V \f$ of the given real symmetric or Hermitian matrix (see eigen()). The
+// given function is applied to each (real) eigenvalue and has to return a real value:
+
+   \code
+   blaze::SymmetricMatrix< blaze::DynamicMatrix<double> > C;
+   blaze::DynamicMatrix<double> X;
+   // ... Resizing and initialization
+
+   X = funm( C, []( double x ){ return std::exp( -x ); } );  // Computes exp(-C)
+   \endcode
+
+// Eigenvalues that are negative only due to rounding errors are passed as zero. The function
+// can only be used for symmetric matrices with real element type (as for instance
+// SymmetricMatrix< DynamicMatrix<double> >) and for Hermitian matrices (as for instance
+// HermitianMatrix< DynamicMatrix< complex<double> > >). The attempt to use it with any other
+// matrix type results in a compilation error.
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order of the dense matrix
+        , typename OP >  // Type of the scalar function
+auto funm( const DenseMatrix<MT,SO>& A, OP f )
+   -> EnableIf_t< IsSelfAdjoint_v<MT>, RemoveAdaptor_t< ResultType_t<MT> > >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   return funm_backend( *A, f );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,467 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/MixedPrecision.h
+//  \brief Header file for the mixed-precision solution of dense linear systems
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_MIXEDPRECISION_H_
+#define _BLAZE_MATH_DENSE_MIXEDPRECISION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/BlockedLU.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/LSE.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DMatMapExpr.h>
+#include <blaze/math/expressions/DMatReduceExpr.h>
+#include <blaze/math/expressions/DVecMapExpr.h>
+#include <blaze/math/expressions/DVecReduceExpr.h>
+#include <blaze/math/expressions/DVecTransExpr.h>
+#include <blaze/math/lapack/getrf.h>
+#include <blaze/math/lapack/getrs.h>
+#include <blaze/math/ReductionFlag.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/system/LAPACK.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  MIXED-PRECISION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief LU decomposition of the single precision copy of a system matrix.
+// \ingroup dense_matrix
+//
+// \param A The column-major single precision matrix to be decomposed.
+// \param ipiv The pivot indices of the LU decomposition.
+// \return \a true in case the decomposition can be used for solving, \a false if not.
+//
+// The function returns \a false in case the upper triangular factor has a zero or a non-finite
+// diagonal element, i.e. in case the matrix is singular in single precision or the single
+// precision decomposition overflowed.
+*/
+template< typename MT >  // Type of the single precision matrix
+bool mixedGetrf( MT& A, blas_int_t* ipiv )
+{
+   using std::abs;
+
+#if BLAZE_USE_LAPACK_LU_DECOMPOSITION
+   getrf( A, ipiv );
+#else
+   getrfBlocked( A, ipiv );
+#endif
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      if( isDefault<strict>( A(i,i) ) ||
+          !( abs( A(i,i) ) <= std::numeric_limits<float>::max() ) ) {
+         return false;
+      }
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Solution of a linear system with the single precision LU decomposition.
+// \ingroup dense_matrix
+//
+// \param A The LU decomposed column-major single precision matrix.
+// \param X The right-hand side(s) on entry, the solution(s) on exit.
+// \param ipiv The pivot indices of the LU decomposition.
+// \return void
+*/
+template< typename MT    // Type of the single precision matrix
+        , typename XT >  // Type of the right-hand side(s)
+void mixedGetrs( const MT& A, XT& X, const blas_int_t* ipiv )
+{
+#if BLAZE_USE_LAPACK_LU_DECOMPOSITION
+   getrs( A, X, 'N', ipiv );
+#else
+   getrsBlocked( A, X, ipiv );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Convergence test of the iterative refinement for a single right-hand side.
+// \ingroup dense_matrix
+//
+// \param r The current residual.
+// \param x The current solution.
+// \param tol The relative tolerance.
+// \return \a true in case the residual is small enough, \a false if not.
+*/
+template< typename VT >  // Type of the vectors
+bool mixedConverged( const DenseVector<VT,columnVector>& r, const DenseVector<VT,columnVector>& x,
+                     double tol )
+{
+   return max( abs( *r ) ) <= max( abs( *x ) ) * tol;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Convergence test of the iterative refinement for multiple right-hand sides.
+// \ingroup dense_matrix
+//
+// \param R The current residuals.
+// \param X The current solutions.
+// \param tol The relative tolerance.
+// \return \a true in case all residuals are small enough, \a false if not.
+*/
+template< typename MT >  // Type of the matrices
+bool mixedConverged( const DenseMatrix<MT,columnMajor>& R, const DenseMatrix<MT,columnMajor>& X,
+                     double tol )
+{
+   for( size_t j=0UL; j<(*R).columns(); ++j ) {
+      if( !mixedConverged( column( *R, j ), column( *X, j ), tol ) ) {
+         return false;
+      }
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Mixed-precision iterative refinement of the solution of a linear system.
+// \ingroup dense_matrix
+//
+// \param A The double precision system matrix.
+// \param X The solution(s).
+// \param B The right-hand side(s).
+// \return The number of refinement steps, -1 in case the refinement failed.
+//
+// This function decomposes a single precision copy of \a A and refines the single precision
+// solution(s) by means of double precision residuals (see solveMixed()). The refinement fails
+// in case \a A cannot be represented in single precision, in case the single precision matrix
+// is singular, in case the residual does not decrease by at least a factor of two per step, or
+// in case no convergence is reached within 30 steps.
+*/
+template< typename MT    // Type of the system matrix
+        , typename XT >  // Type of the solution(s) and right-hand side(s)
+int mixedRefine( const MT& A, XT& X, const XT& B )
+{
+   using std::sqrt;
+
+   using ET = ElementType_t<MT>;
+   using LT = If_t< IsComplex_v<ET>, complex<float>, float >;
+   using WT = typename XT::template Rebind<LT>::Other;
+
+   constexpr int maxIterations( 30 );
+
+   const size_t n( A.rows() );
+
+   if( !( max( abs( A ) ) <= std::numeric_limits<float>::max() ) ) {
+      return -1;
+   }
+
+   DynamicMatrix<LT,columnMajor> L( A );
+   const std::unique_ptr<blas_int_t[]> ipiv( new blas_int_t[n] );
+
+   if( !mixedGetrf( L, ipiv.get() ) ) {
+      return -1;
+   }
+
+   const double tol( max( sum<rowwise>( abs( A ) ) ) *
+                     std::numeric_limits<double>::epsilon() * sqrt( double( n ) ) );
+
+   WT W( B );
+   mixedGetrs( L, W, ipiv.get() );
+   X = W;
+
+   XT R( B - A * X );
+   double previous( std::numeric_limits<double>::infinity() );
+
+   for( int iteration=0; ; ++iteration )
+   {
+      if( mixedConverged( R, X, tol ) ) {
+         return iteration;
+      }
+
+      const double residual( max( abs( R ) ) );
+
+      if( iteration == maxIterations || !( residual < 0.5 * previous ) ) {
+         return -1;
+      }
+
+      previous = residual;
+
+      W = R;
+      mixedGetrs( L, W, ipiv.get() );
+      X += W;
+      R = B - A * X;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MIXED-PRECISION SOLVE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Mixed-precision solve functions */
+//@{
+template< typename MT, bool SO, typename VT1, bool TF1, typename VT2, bool TF2 >
+int solveMixed( const DenseMatrix<MT,SO>& A, DenseVector<VT1,TF1>& x,
+                const DenseVector<VT2,TF2>& b );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3 >
+int solveMixed( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& X,
+                const DenseMatrix<MT3,SO3>& B );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Mixed-precision solution of the given linear system of equations (\f$ A*x=b \f$).
+// \ingroup dense_matrix
+//
+// \param A The NxN dense double precision system matrix.
+// \param x The dense solution vector.
+// \param b The N-dimensional dense right-hand side vector.
+// \return The number of refinement steps, -1 in case of a double precision fallback.
+// \exception std::invalid_argument Invalid non-square system matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::runtime_error Solving LSE with singular system matrix failed.
+//
+// This function computes the solution of the linear system of equations \f$ A*x=b \f$ with the
+// same accuracy as solve(), but computes the LU decomposition of \a A in single precision. The
+// single precision solution is subsequently improved by iterative refinement: In each step the
+// residual \f$ r=b-A*x \f$ is computed in double precision, the correction is computed by means
+// of the single precision decomposition, and the solution is updated in double precision. Since
+// the \f$ O(N^3) \f$ decomposition dominates the runtime and single precision halves the memory
+// traffic and doubles the SIMD width, the function is up to twice as fast as solve() for large
+// matrices.
+
+   \code
+   blaze::DynamicMatrix<double> A;  // The square general system matrix
+   blaze::DynamicVector<double> b;  // The right-hand side vector
+   // ... Resizing and initialization
+
+   blaze::DynamicVector<double> x;  // The solution vector
+   const int steps = solveMixed( A, x, b );
+   \endcode
+
+// The refinement stops as soon as the residual is of the order of the double precision machine
+// accuracy relative to \a A and \a x (i.e. \f$ \|r\|_\infty \le \|x\|_\infty \|A\|_\infty
+// \epsilon \sqrt{N} \f$) and the function returns the number of performed refinement steps. In
+// case the refinement stagnates (i.e. the residual doesn't decrease by at least a factor of two
+// per step, which happens for matrices with a condition number of about \f$ 10^7 \f$ and above),
+// in case \a A cannot be represented in single precision, or in case the single precision
+// decomposition fails, the function falls back to the double precision solve() and returns -1.
+//
+// The function fails if ...
+//
+//  - ... the given system matrix is not a square matrix;
+//  - ... the size of the right-hand side vector doesn't match the dimensions of the system matrix;
+//  - ... the given system matrix is singular.
+//
+// In all failure cases an exception is thrown.
+//
+// \note This function can only be used for dense matrices and vectors with \c double or
+// \c complex<double> element type. The attempt to call the function with matrices and vectors
+// of any other element type results in a compile time error!
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a x may already have been modified.
+*/
+template< typename MT   // Type of the system matrix
+        , bool SO       // Storage order of the system matrix
+        , typename VT1  // Type of the solution vector
+        , bool TF1      // Transpose flag of the solution vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+int solveMixed( const DenseMatrix<MT,SO>& A, DenseVector<VT1,TF1>& x,
+                const DenseVector<VT2,TF2>& b )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = ElementType_t<MT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ET );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( UnderlyingBuiltin_t<ET>, double );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ET, ElementType_t<VT1> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ET, ElementType_t<VT2> );
+
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square system matrix provided" );
+   }
+   else if( (*A).rows() != (*b).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   CompositeType_t<MT> a( *A );  // Evaluation of the system matrix
+
+   const DynamicVector<ET,columnVector> rhs( transTo<columnVector>( *b ) );
+   DynamicVector<ET,columnVector> y( rhs.size() );
+
+   int iterations( 0 );
+
+   if( rhs.size() > 0UL ) {
+      iterations = mixedRefine( a, y, rhs );
+   }
+
+   if( iterations < 0 ) {
+      solve( a, y, rhs );
+   }
+
+   resize( *x, y.size(), false );
+   *x = transTo<TF1>( y );
+
+   return iterations;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Mixed-precision solution of the given linear system of equations (\f$ A*X=B \f$).
+// \ingroup dense_matrix
+//
+// \param A The NxN dense double precision system matrix.
+// \param X The dense solution matrix.
+// \param B The N-dimensional dense right-hand side matrix.
+// \return The number of refinement steps, -1 in case of a double precision fallback.
+// \exception std::invalid_argument Invalid non-square system matrix provided.
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+// \exception std::runtime_error Solving LSE with singular system matrix failed.
+//
+// This function computes the solution of the linear system of equations \f$ A*X=B \f$, where
+// the columns of \a X are the solution vectors and the columns of \a B are the right-hand side
+// vectors, by means of a single precision LU decomposition and iterative refinement in double
+// precision. The refinement is performed simultaneously for all right-hand sides and stops as
+// soon as all residuals are of the order of the double precision machine accuracy. For details
+// about the refinement and the fallback to double precision see the single right-hand side
+// version of solveMixed().
+//
+// \note This function can only be used for dense matrices with \c double or \c complex<double>
+// element type. The attempt to call the function with matrices of any other element type results
+// in a compile time error!
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a X may already have been modified.
+*/
+template< typename MT1  // Type of the system matrix
+        , bool SO1      // Storage order of the system matrix
+        , typename MT2  // Type of the solution matrix
+        , bool SO2      // Storage order of the solution matrix
+        , typename MT3  // Type of the right-hand side matrix
+        , bool SO3 >    // Storage order of the right-hand side matrix
+int solveMixed( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& X,
+                const DenseMatrix<MT3,SO3>& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = ElementType_t<MT1>;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ET );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( UnderlyingBuiltin_t<ET>, double );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ET, ElementType_t<MT2> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ET, ElementType_t<MT3> );
+
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square system matrix provided" );
+   }
+   else if( (*A).rows() != (*B).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   CompositeType_t<MT1> a( *A );  // Evaluation of the system matrix
+
+   const DynamicMatrix<ET,columnMajor> rhs( *B );
+   DynamicMatrix<ET,columnMajor> Y( rhs.rows(), rhs.columns() );
+
+   int iterations( 0 );
+
+   if( rhs.rows() > 0UL && rhs.columns() > 0UL ) {
+      iterations = mixedRefine( a, Y, rhs );
+   }
+
+   if( iterations < 0 ) {
+      solve( a, Y, rhs );
+   }
+
+   resize( *X, Y.rows(), Y.columns(), false );
+   *X = Y;
+
+   return iterations;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,354 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/RandomizedSVD.h
+//  \brief Header file for the randomized truncated singular value decomposition
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_RANDOMIZEDSVD_H_
+#define _BLAZE_MATH_DENSE_RANDOMIZEDSVD_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/QR.h>
+#include <blaze/math/dense/SVD.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Matrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of an orthonormal basis for the approximate range of the given matrix.
+// \ingroup dense_matrix
+//
+// \param A The given general \a m-by-\a n matrix.
+// \param l The number of basis vectors (\f$ 1 \le l \le \min(m,n) \f$).
+// \param powerIterations The number of power iterations.
+// \return The \a m-by-\a l matrix \c Q with orthonormal columns.
+//
+// This auxiliary function implements the randomized range finder: The range of \a A is sampled
+// by the product of \a A with an \a n-by-\a l random matrix, optionally sharpened by \a q power
+// iterations with \f$ (A A^H)^q \f$, and orthonormalized by means of a QR decomposition. The
+// basis is re-orthonormalized after each multiplication to preserve the information associated
+// with the small singular values. The random matrix is drawn from the random number generator of
+// the Blaze library, i.e. the result is reproducible for a given seed (see setSeed()).
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO >    // Storage order of the matrix A
+auto rsvdRange( const Matrix<MT,SO>& A, size_t l, size_t powerIterations )
+{
+   using ET = ElementType_t<MT>;
+   using BT = UnderlyingBuiltin_t<ET>;
+   using Basis = DynamicMatrix<ET,columnMajor>;
+
+   Basis Omega( (*A).columns(), l );
+   randomize( Omega, BT(-1), BT(1) );
+
+   Basis Y( (*A) * Omega );
+   Basis Q, Z, R;
+
+   qr( Y, Q, R );
+
+   for( size_t i=0UL; i<powerIterations; ++i ) {
+      Y = ctrans( *A ) * Q;
+      qr( Y, Z, R );
+      Y = (*A) * Z;
+      qr( Y, Q, R );
+   }
+
+   return Q;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the arguments of the randomized truncated singular value decomposition.
+// \ingroup dense_matrix
+//
+// \param A The given general \a m-by-\a n matrix.
+// \param k The number of requested singular values.
+// \param oversampling The number of additional samples of the range of \a A.
+// \return The total number of samples of the range of \a A.
+// \exception std::invalid_argument Invalid number of singular values requested.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO >    // Storage order of the matrix A
+size_t rsvdSamples( const Matrix<MT,SO>& A, size_t k, size_t oversampling )
+{
+   const size_t mindim( min( (*A).rows(), (*A).columns() ) );
+
+   if( k > mindim ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of singular values requested" );
+   }
+
+   return ( oversampling < mindim - k )?( k + oversampling ):( mindim );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RANDOMIZED SINGULAR VALUE DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Randomized singular value decomposition functions */
+//@{
+template< typename MT, bool SO, typename VT, bool TF >
+void rsvd( const Matrix<MT,SO>& A, DenseVector<VT,TF>& s, size_t k,
+           size_t oversampling = 10UL, size_t powerIterations = 2UL );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename VT, bool TF, typename MT3 >
+void rsvd( const Matrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& U,
+           DenseVector<VT,TF>& s, DenseMatrix<MT3,SO2>& V, size_t k,
+           size_t oversampling = 10UL, size_t powerIterations = 2UL );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Randomized truncated singular value decomposition of the given general matrix.
+// \ingroup dense_matrix
+//
+// \param A The given general matrix.
+// \param s The resulting vector of the \a k largest singular values.
+// \param k The number of requested singular values (\f$ k \le \min(m,n) \f$).
+// \param oversampling The number of additional samples of the range of \a A (default: 10).
+// \param powerIterations The number of power iterations (default: 2).
+// \return void
+// \exception std::invalid_argument Invalid number of singular values requested.
+// \exception std::invalid_argument Size of fixed size vector does not match.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function computes approximations of the \a k largest singular values of the given dense
+// or sparse \a m-by-\a n matrix \a A by means of the randomized range finder (Halko, Martinsson,
+// and Tropp, 2011). The resulting singular values are stored in descending order in the given
+// vector \a s, which is resized to \a k (if possible and necessary). In contrast to svd(), which
+// computes the full decomposition with a cost of \f$ O(mn \min(m,n)) \f$, the cost of this
+// function is dominated by \f$ 2q+2 \f$ products of \a A with tall and skinny matrices of
+// \f$ l = \min(k+p,\min(m,n)) \f$ columns, where \a p is the \a oversampling and \a q is the
+// number of \a powerIterations. Each power iteration significantly improves the accuracy for
+// matrices with a slowly decaying spectrum.
+
+   \code
+   blaze::CompressedMatrix<double> A( 100000UL, 10000UL );
+   // ... Initialization
+
+   blaze::DynamicVector<double> s;
+
+   blaze::setSeed( 42U );  // Fixing the seed for reproducible results
+   blaze::rsvd( A, s, 20UL );
+   \endcode
+
+// The random test matrix is drawn from the random number generator of the Blaze library. Thus
+// the result is reproducible for a fixed seed (see setSeed()).
+//
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector s
+        , bool TF >    // Transpose flag of the vector s
+void rsvd( const Matrix<MT,SO>& A, DenseVector<VT,TF>& s, size_t k,
+           size_t oversampling, size_t powerIterations )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<VT> );
+
+   using ET = ElementType_t<MT>;
+   using BT = UnderlyingBuiltin_t<ET>;
+
+   const size_t l( rsvdSamples( *A, k, oversampling ) );
+
+   resize( *s, k, false );
+
+   if( k == 0UL ) {
+      return;
+   }
+
+   const DynamicMatrix<ET,columnMajor> Q( rsvdRange( *A, l, powerIterations ) );
+   DynamicMatrix<ET,columnMajor> B( ctrans( Q ) * (*A) );
+   DynamicVector<BT,columnVector> sigma;
+
+   svd( B, sigma );
+
+   (*s) = subvector( sigma, 0UL, k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Randomized truncated singular value decomposition of the given general matrix.
+// \ingroup dense_matrix
+//
+// \param A The given general matrix.
+// \param U The resulting \a m-by-\a k matrix of left singular vectors.
+// \param s The resulting vector of the \a k largest singular values.
+// \param V The resulting \a k-by-\a n matrix of right singular vectors.
+// \param k The number of requested singular triplets (\f$ k \le \min(m,n) \f$).
+// \param oversampling The number of additional samples of the range of \a A (default: 10).
+// \param powerIterations The number of power iterations (default: 2).
+// \return void
+// \exception std::invalid_argument Invalid number of singular values requested.
+// \exception std::invalid_argument Dimensions of fixed size matrix U do not match.
+// \exception std::invalid_argument Size of fixed size vector does not match.
+// \exception std::invalid_argument Dimensions of fixed size matrix V do not match.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function computes a rank-\a k approximation \f$ A \approx U \cdot diag(s) \cdot V \f$
+// of the given dense or sparse \a m-by-\a n matrix \a A by means of the randomized range finder
+// (Halko, Martinsson, and Tropp, 2011). The \a k largest singular values are stored in
+// descending order in the given vector \a s, the corresponding left singular vectors are stored
+// in the columns of \a U, and the corresponding right singular vectors are stored in the rows
+// of \a V (in accordance with svd()). \a U, \a s, and \a V are resized to the correct
+// dimensions (if possible and necessary).
+
+   \code
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 100000UL, 10000UL );
+   // ... Initialization
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> U;  // The matrix for the left singular vectors
+   blaze::DynamicVector<double> s;                  // The vector for the singular values
+   blaze::DynamicMatrix<double,blaze::rowMajor> V;  // The matrix for the right singular vectors
+
+   blaze::rsvd( A, U, s, V, 20UL, 10UL, 2UL );
+   \endcode
+
+// The cost of the function is dominated by \f$ 2q+3 \f$ products of \a A or \a U with tall and
+// skinny matrices of \f$ l = \min(k+p,\min(m,n)) \f$ columns, where \a p is the \a oversampling
+// and \a q is the number of \a powerIterations, which are executed by the (parallel) dense or
+// sparse matrix multiplication kernels. The random test matrix is drawn from the random number
+// generator of the Blaze library. Thus the result is reproducible for a fixed seed (see
+// setSeed()).
+//
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT1    // Type of the matrix A
+        , bool SO1        // Storage order of the matrix A
+        , typename MT2    // Type of the matrix U
+        , bool SO2        // Storage order of the matrices U and V
+        , typename VT     // Type of the vector s
+        , bool TF         // Transpose flag of the vector s
+        , typename MT3 >  // Type of the matrix V
+void rsvd( const Matrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& U,
+           DenseVector<VT,TF>& s, DenseMatrix<MT3,SO2>& V, size_t k,
+           size_t oversampling, size_t powerIterations )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT1> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT2> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<VT> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT3 );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT3> );
+
+   using ET = ElementType_t<MT1>;
+   using BT = UnderlyingBuiltin_t<ET>;
+
+   const size_t m( (*A).rows() );
+   const size_t n( (*A).columns() );
+   const size_t l( rsvdSamples( *A, k, oversampling ) );
+
+   resize( *U, m, k, false );
+   resize( *s, k, false );
+   resize( *V, k, n, false );
+
+   if( k == 0UL ) {
+      return;
+   }
+
+   const DynamicMatrix<ET,columnMajor> Q( rsvdRange( *A, l, powerIterations ) );
+   DynamicMatrix<ET,columnMajor> B( ctrans( Q ) * (*A) );
+   DynamicMatrix<ET,columnMajor> W, Z;
+   DynamicVector<BT,columnVector> sigma;
+
+   svd( B, W, sigma, Z );
+
+   (*U) = Q * submatrix( W, 0UL, 0UL, l, k );
+   (*s) = subvector( sigma, 0UL, k );
+   (*V) = submatrix( Z, 0UL, 0UL, k, n );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -44,12 +44,16 @@
 #include <blaze/math/constraints/BLASCompatible.h>
 #include <blaze/math/constraints/Computation.h>
 #include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/math/dense/Jacobi.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/lapack/gesdd.h>
 #include <blaze/math/lapack/gesvdx.h>
 #include <blaze/math/typetraits/IsContiguous.h>
 #include <blaze/math/typetraits/RemoveAdaptor.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/EnableIf.h>
 #include <blaze/util/mpl/If.h>
 
 
@@ -81,6 +85,231 @@ inline size_t svd( const DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend for the singular value decomposition of the given dense general matrix.
+// \ingroup dense_matrix
+//
+// \param A The given general matrix.
+// \param s The resulting vector of singular values.
+// \return void
+// \exception std::invalid_argument Size of fixed size vector does not match.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function is the backend implementation for computing the singular values of the given
+// dense general matrix by means of the LAPACK gesdd() function.\n
+// This function must \b NOT be called explicitly! It is used internally for the dispatch to
+// the correct LAPACK function. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors. Instead of using this function use the according
+// svd() function.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector s
+        , bool TF >    // Transpose flag of the vector s
+inline auto svd_backend( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s )
+   -> DisableIf_t< IsJacobiCompatible_v<MT> >
+{
+   using ATmp = ResultType_t< RemoveAdaptor_t<MT> >;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( ATmp );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( ATmp );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( ATmp );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<ATmp> );
+
+   ATmp Atmp( *A );
+
+   gesdd( Atmp, *s );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend for the singular value decomposition of the given tiny dense general matrix.
+// \ingroup dense_matrix
+//
+// \param A The given general matrix.
+// \param s The resulting vector of singular values.
+// \return void
+// \exception std::invalid_argument Size of fixed size vector does not match.
+//
+// This function is the backend implementation for computing the singular values of the given
+// dense general matrix, whose maximum size is known at compile time and does not exceed
+// JACOBI_MAX_SIZE. Instead of calling the according LAPACK function it uses the one-sided
+// Jacobi method, which does not require any dynamic memory.\n
+// This function must \b NOT be called explicitly! It is used internally for the dispatch to
+// the correct LAPACK function. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors. Instead of using this function use the according
+// svd() function.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector s
+        , bool TF >    // Transpose flag of the vector s
+inline auto svd_backend( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s )
+   -> EnableIf_t< IsJacobiCompatible_v<MT> >
+{
+   using RT = ElementType_t<MT>;
+
+   constexpr size_t N( JacobiSize_v<MT> );
+
+   const size_t m( (*A).rows() );
+   const size_t n( (*A).columns() );
+   const size_t k( min( m, n ) );
+
+   resize( *s, k, false );
+
+   CompositeType_t<MT> Atmp( *A );
+
+   RT x[N][N], r[N][N], stmp[N];
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         if( m >= n ) x[j][i] = Atmp(i,j);
+         else         x[i][j] = Atmp(i,j);
+      }
+   }
+
+   jacobiSVD( x, r, stmp, k, max( m, n ), false, k );
+
+   for( size_t i=0UL; i<k; ++i ) {
+      (*s)[i] = stmp[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend for the singular value decomposition of the given dense general matrix.
+// \ingroup dense_matrix
+//
+// \param A The given general matrix.
+// \param U The resulting matrix of left singular vectors.
+// \param s The resulting vector of singular values.
+// \param V The resulting matrix of right singular vectors.
+// \param square If \a true, \a U and \a V are computed as square matrices.
+// \return void
+// \exception std::invalid_argument Dimensions of fixed size matrix U do not match.
+// \exception std::invalid_argument Size of fixed size vector does not match.
+// \exception std::invalid_argument Dimensions of fixed size matrix V do not match.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function is the backend implementation for computing the singular value decomposition
+// of the given dense general matrix by means of the LAPACK gesdd() function.\n
+// This function must \b NOT be called explicitly! It is used internally for the dispatch to
+// the correct LAPACK function. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors. Instead of using this function use the according
+// svd() function.
+*/
+template< typename MT1    // Type of the matrix A
+        , bool SO         // Storage order of all matrices
+        , typename VT     // Type of the vector s
+        , bool TF         // Transpose flag of the vector s
+        , typename MT2    // Type of the matrix U
+        , typename MT3 >  // Type of the matrix V
+inline auto svd_backend( const DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+                         DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, bool square )
+   -> DisableIf_t< IsJacobiCompatible_v<MT1> >
+{
+   using ATmp = ResultType_t< RemoveAdaptor_t<MT1> >;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( ATmp );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( ATmp );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( ATmp );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<ATmp> );
+
+   ATmp Atmp( *A );
+
+   gesdd( Atmp, *U, *s, *V, (square) ? 'A' : 'S' );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend for the singular value decomposition of the given tiny dense general matrix.
+// \ingroup dense_matrix
+//
+// \param A The given general matrix.
+// \param U The resulting matrix of left singular vectors.
+// \param s The resulting vector of singular values.
+// \param V The resulting matrix of right singular vectors.
+// \param square If \a true, \a U and \a V are computed as square matrices.
+// \return void
+// \exception std::invalid_argument Dimensions of fixed size matrix U do not match.
+// \exception std::invalid_argument Size of fixed size vector does not match.
+// \exception std::invalid_argument Dimensions of fixed size matrix V do not match.
+//
+// This function is the backend implementation for computing the singular value decomposition
+// of the given dense general matrix, whose maximum size is known at compile time and does not
+// exceed JACOBI_MAX_SIZE. Instead of calling the according LAPACK function it uses the
+// one-sided Jacobi method, which does not require any dynamic memory.\n
+// This function must \b NOT be called explicitly! It is used internally for the dispatch to
+// the correct LAPACK function. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors. Instead of using this function use the according
+// svd() function.
+*/
+template< typename MT1    // Type of the matrix A
+        , bool SO         // Storage order of all matrices
+        , typename VT     // Type of the vector s
+        , bool TF         // Transpose flag of the vector s
+        , typename MT2    // Type of the matrix U
+        , typename MT3 >  // Type of the matrix V
+inline auto svd_backend( const DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+                         DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, bool square )
+   -> EnableIf_t< IsJacobiCompatible_v<MT1> >
+{
+   using RT = ElementType_t<MT1>;
+
+   constexpr size_t N( JacobiSize_v<MT1> );
+
+   const size_t m( (*A).rows() );
+   const size_t n( (*A).columns() );
+   const size_t k( min( m, n ) );
+   const bool tall( m >= n );
+
+   resize( *U, m, ( square ? m : k ), false );
+   resize( *s, k, false );
+   resize( *V, ( square ? n : k ), n, false );
+
+   CompositeType_t<MT1> Atmp( *A );
+
+   RT x[N][N], r[N][N], stmp[N];
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         if( tall ) x[j][i] = Atmp(i,j);
+         else       x[i][j] = Atmp(i,j);
+      }
+   }
+
+   jacobiSVD( x, r, stmp, k, max( m, n ), true, ( square ? max( m, n ) : k ) );
+
+   for( size_t i=0UL; i<k; ++i ) {
+      (*s)[i] = stmp[i];
+   }
+
+   for( size_t j=0UL; j<(*U).columns(); ++j ) {
+      for( size_t i=0UL; i<m; ++i ) {
+         (*U)(i,j) = ( tall ? x[j][i] : r[j][i] );
+      }
+   }
+
+   for( size_t i=0UL; i<(*V).rows(); ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         (*V)(i,j) = ( tall ? r[i][j] : x[i][j] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Singular value decomposition (SVD) of the given dense general matrix.
 // \ingroup dense_matrix
@@ -123,12 +352,15 @@ inline size_t svd( const DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
 // element type results in a compile time error!
 //
 // \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a call to this function will result in a linker error.
+// the executable. Otherwise a call to this function will result in a linker error. The only
+// exception are matrices with \c float or \c double element type, whose maximum size is known
+// at compile time and does not exceed 4x4 (as for instance \c StaticMatrix and \c HybridMatrix).
+// These are decomposed by the one-sided Jacobi method without any dynamic memory allocation
+// and without calling LAPACK.
 //
 // \note Further options for computing singular values and singular vectors are available via the
 // gesvd(), gesdd(), and gesvdx() functions.
-*/
-template< typename MT  // Type of the matrix A
+*/template< typename MT  // Type of the matrix A
         , bool SO      // Storage order of the matrix A
         , typename VT  // Type of the vector s
         , bool TF >    // Transpose flag of the vector s
@@ -141,18 +373,11 @@ inline void svd( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s )
    BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<VT> );
 
-   using ATmp = ResultType_t< RemoveAdaptor_t<MT> >;
    using STmp = If_t< IsContiguous_v<VT>, VT&, ResultType_t<VT> >;
 
-   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( ATmp );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( ATmp );
-   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( ATmp );
-   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<ATmp> );
-
-   ATmp Atmp( *A );
    STmp stmp( *s );
 
-   gesdd( Atmp, stmp );
+   svd_backend( *A, stmp );
 
    if( !IsContiguous_v<VT> ) {
       (*s) = stmp;
@@ -214,12 +439,15 @@ inline void svd( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s )
 // element type results in a compile time error!
 //
 // \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a call to this function will result in a linker error.
+// the executable. Otherwise a call to this function will result in a linker error. The only
+// exception are matrices with \c float or \c double element type, whose maximum size is known
+// at compile time and does not exceed 4x4 (as for instance \c StaticMatrix and \c HybridMatrix).
+// These are decomposed by the one-sided Jacobi method without any dynamic memory allocation
+// and without calling LAPACK.
 //
 // \note Further options for computing singular values and singular vectors are available via the
 // gesvd(), gesdd(), and gesvdx() functions.
-*/
-template< typename MT1    // Type of the matrix A
+*/template< typename MT1    // Type of the matrix A
         , bool SO         // Storage order of all matrices
         , typename VT     // Type of the vector s
         , bool TF         // Transpose flag of the vector s
@@ -245,22 +473,15 @@ inline void svd( const DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
    BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT3 );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT3> );
 
-   using ATmp = ResultType_t< RemoveAdaptor_t<MT1> >;
    using UTmp = If_t< IsContiguous_v<MT2>, MT2&, ResultType_t<MT2> >;
    using STmp = If_t< IsContiguous_v<VT>, VT&, ResultType_t<VT> >;
    using VTmp = If_t< IsContiguous_v<MT3>, MT3&, ResultType_t<MT3> >;
 
-   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( ATmp );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( ATmp );
-   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( ATmp );
-   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<ATmp> );
-
-   ATmp Atmp( *A );
    UTmp Utmp( *U );
    STmp stmp( *s );
    VTmp Vtmp( *V );
 
-   gesdd( Atmp, Utmp, stmp, Vtmp, (square) ? 'A' : 'S' );
+   svd_backend( *A, Utmp, stmp, Vtmp, square );
 
    if( !IsContiguous_v<MT2> ) {
       (*U) = Utmp;
@@ -46,6 +46,7 @@
 #include <blaze/math/constraints/DenseMatrix.h>
 #include <blaze/math/constraints/MutableDataAccess.h>
 #include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/dense/BlockedLU.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/getrf.h>
@@ -54,6 +55,7 @@
 #include <blaze/math/typetraits/IsTriangular.h>
 #include <blaze/math/typetraits/IsUniTriangular.h>
 #include <blaze/math/typetraits/RemoveAdaptor.h>
+#include <blaze/system/LAPACK.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/NumericCast.h>
 #include <blaze/util/Types.h>
@@ -336,13 +338,17 @@ ElementType_t<MT> detNxN( const DenseMatrix<MT,SO>& dm )
 
    URT A( *dm );
 
-   blas_int_t n   ( numeric_cast<blas_int_t>( A.rows()    ) );
-   blas_int_t lda ( numeric_cast<blas_int_t>( A.spacing() ) );
+   blas_int_t n   ( numeric_cast<blas_int_t>( A.rows() ) );
    blas_int_t info( 0 );
 
    const std::unique_ptr<blas_int_t[]> ipiv( new blas_int_t[n] );
 
+#if BLAZE_USE_LAPACK_LU_DECOMPOSITION
+   blas_int_t lda( numeric_cast<blas_int_t>( A.spacing() ) );
    getrf( n, n, A.data(), lda, ipiv.get(), &info );
+#else
+   info = getrfBlocked( A, ipiv.get() );
+#endif
 
    if( info > 0 ) {
       return ET(0);
@@ -377,7 +383,8 @@ ElementType_t<MT> detNxN( const DenseMatrix<MT,SO>& dm )
 // not guarantee that it is possible to compute the determinant with the given matrix!
 //
 // \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a linker error will be created.
+// the executable. Otherwise a linker error will be created. In case the
+// BLAZE_USE_LAPACK_LU_DECOMPOSITION switch is deactivated, no LAPACK library is required.
 */
 template< typename MT  // Type of the dense matrix
         , bool SO >    // Storage order of the dense matrix
@@ -40,20 +40,22 @@
 // Includes
 //*************************************************************************************************
 
+#include <cmath>
+#include <memory>
 #include <blaze/math/Aliases.h>
+#include <blaze/math/blas/Types.h>
 #include <blaze/math/constraints/BLASCompatible.h>
 #include <blaze/math/constraints/DenseMatrix.h>
 #include <blaze/math/constraints/RequiresEvaluation.h>
 #include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/dense/BlockedLU.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatExpExpr.h>
+#include <blaze/math/shims/Abs.h>
 #include <blaze/math/shims/Exp.h>
-#include <blaze/math/shims/Frexp.h>
-#include <blaze/math/shims/Pow.h>
-#include <blaze/math/shims/Serial.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/RemoveAdaptor.h>
@@ -63,6 +65,7 @@
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsFloat.h>
 
 
 namespace blaze {
@@ -88,12 +91,9 @@ class DMatExpExpr
 {
  private:
    //**Type definitions****************************************************************************
-   using RT = ResultType_t<MT>;   //!< Result type of the dense matrix expression.
-   using ET = ElementType_t<MT>;  //!< Element type of the dense matrix expression.
-   //**********************************************************************************************
-
-   //**********************************************************************************************
-   static constexpr size_t K = 18;  //!< The approximation limit for the exponential computation.
+   using RT = ResultType_t<MT>;          //!< Result type of the dense matrix expression.
+   using ET = ElementType_t<MT>;         //!< Element type of the dense matrix expression.
+   using BT = UnderlyingBuiltin_t<ET>;   //!< Underlying builtin type of the element type.
    //**********************************************************************************************
 
  public:
@@ -196,6 +196,167 @@ class DMatExpExpr
    Operand dm_;  //!< Dense matrix of the exponential expression.
    //**********************************************************************************************
 
+   //**1-norm computation**************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Computes the 1-norm (i.e. the maximum absolute column sum) of the given matrix.
+   //
+   // \param A The given dense matrix.
+   // \return The 1-norm of the matrix.
+   */
+   static BT norm1( const ResultType& A )
+   {
+      BT norm{};
+
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         BT sum{};
+         for( size_t i=0UL; i<A.rows(); ++i ) {
+            sum += abs( A(i,j) );
+         }
+         norm = max( norm, sum );
+      }
+
+      return norm;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Padé approximation**************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Computes the diagonal Padé approximant of degree \a m to the exponential of \a A.
+   //
+   // \param A The given dense matrix.
+   // \param m The degree of the Padé approximant (3, 5, 7, 9, or 13).
+   // \return The Padé approximant \f$ r_m(A) = q_m(A)^{-1} p_m(A) \f$.
+   //
+   // The odd and even parts \f$ U \f$ and \f$ V \f$ of \f$ p_m(A) = V + U \f$ are evaluated
+   // from the even powers of \a A, which requires \f$ (m+1)/2 \f$ matrix multiplications for
+   // \f$ m \leq 9 \f$ and 6 matrix multiplications for \f$ m = 13 \f$. For row-major
+   // matrices gesvBlocked() computes \f$ p_m(A) q_m(A)^{-1} \f$ instead, which is identical
+   // since \f$ q_m(A) = V - U \f$ and \f$ p_m(A) \f$ commute.
+   */
+   static ResultType pade( const ResultType& A, size_t m )
+   {
+      static constexpr double b[5][14] = {
+         { 120.0, 60.0, 12.0, 1.0 },
+         { 30240.0, 15120.0, 3360.0, 420.0, 30.0, 1.0 },
+         { 17297280.0, 8648640.0, 1995840.0, 277200.0, 25200.0, 1512.0, 56.0, 1.0 },
+         { 17643225600.0, 8821612800.0, 2075673600.0, 302702400.0, 30270240.0, 2162160.0,
+           110880.0, 3960.0, 90.0, 1.0 },
+         { 64764752532480000.0, 32382376266240000.0, 7771770303897600.0, 1187353796428800.0,
+           129060195264000.0, 10559470521600.0, 670442572800.0, 33522128640.0, 1323241920.0,
+           40840800.0, 960960.0, 16380.0, 182.0, 1.0 }
+      };
+
+      const double* c( b[ m == 13UL ? 4UL : ( m - 3UL ) / 2UL ] );
+      const size_t N( A.rows() );
+
+      const ResultType A2( A * A );
+      ResultType U, V;
+
+      if( m == 13UL )
+      {
+         const ResultType A4( A2 * A2 );
+         const ResultType A6( A4 * A2 );
+
+         ResultType T( BT(c[13]) * A6 + BT(c[11]) * A4 + BT(c[9]) * A2 );
+         ResultType W( A6 * T );
+         W += BT(c[7]) * A6 + BT(c[5]) * A4 + BT(c[3]) * A2;
+         for( size_t i=0UL; i<N; ++i ) {
+            W(i,i) += BT(c[1]);
+         }
+         U = A * W;
+
+         T = BT(c[12]) * A6 + BT(c[10]) * A4 + BT(c[8]) * A2;
+         V = A6 * T;
+         V += BT(c[6]) * A6 + BT(c[4]) * A4 + BT(c[2]) * A2;
+      }
+      else
+      {
+         ResultType P( A2 );
+         ResultType W( BT(c[3]) * A2 );
+         V = BT(c[2]) * A2;
+
+         for( size_t k=4UL; k<m; k+=2UL ) {
+            P *= A2;
+            W += BT(c[k+1UL]) * P;
+            V += BT(c[k]) * P;
+         }
+         for( size_t i=0UL; i<N; ++i ) {
+            W(i,i) += BT(c[1]);
+         }
+         U = A * W;
+      }
+
+      for( size_t i=0UL; i<N; ++i ) {
+         V(i,i) += BT(c[0]);
+      }
+
+      ResultType Q( V - U );
+      V += U;
+
+      const std::unique_ptr<blas_int_t[]> ipiv( new blas_int_t[N] );
+      gesvBlocked( Q, V, ipiv.get() );
+
+      return V;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Exponential computation*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Computes the exponential of the given dense matrix by scaling and squaring.
+   //
+   // \param dm The given dense matrix.
+   // \return The exponential of the matrix.
+   //
+   // This function implements the scaling and squaring algorithm by Higham (SIAM J. Matrix Anal.
+   // Appl. 26(4), 2005). Based on the 1-norm of \a dm it selects the cheapest diagonal Padé
+   // approximant that guarantees full accuracy in the given precision. If no approximant of
+   // degree \f$ m \leq 9 \f$ (or \f$ m \leq 5 \f$ in single precision) suffices, the
+   // matrix is scaled by \f$ 2^{-s} \f$, the degree 13 (single precision: degree 7) approximant
+   // is evaluated and the result is squared \a s times. All matrix products are evaluated by
+   // means of the (potentially parallel) dense matrix multiplication kernels.
+   */
+   static ResultType compute( const MT& dm )
+   {
+      static constexpr size_t degrees[5] = { 3UL, 5UL, 7UL, 9UL, 13UL };
+      static constexpr double theta[2][5] = {
+         { 1.495585217958292e-2, 2.539398330063230e-1, 9.504178996162932e-1,
+           2.097847961257068e0, 5.371920351148152e0 },
+         { 4.258730016922831e-1, 1.880152677804762e0, 3.925724783138660e0, 0.0, 0.0 }
+      };
+
+      constexpr size_t single( IsFloat_v<BT> ? 1UL : 0UL );
+      constexpr size_t top( IsFloat_v<BT> ? 2UL : 4UL );
+
+      ResultType A( dm );
+
+      const double norm( norm1( A ) );
+
+      for( size_t i=0UL; i<top; ++i ) {
+         if( norm <= theta[single][i] ) {
+            return pade( A, degrees[i] );
+         }
+      }
+
+      const double ratio( norm / theta[single][top] );
+      const int s( ratio > 1.0 ? static_cast<int>( std::ceil( std::log2( ratio ) ) ) : 0 );
+
+      if( s > 0 ) {
+         A *= BT( std::ldexp( 1.0, -s ) );
+      }
+
+      ResultType B( pade( A, degrees[top] ) );
+
+      for( int i=0; i<s; ++i ) {
+         B *= B;
+      }
+
+      return B;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to dense matrices****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a dense matrix exponential expression to a dense matrix.
@@ -228,33 +389,7 @@ class DMatExpExpr
       }
       else
       {
-         using BT = UnderlyingBuiltin_t<ET>;
-
-         const BT norm( maxNorm( rhs.dm_ ) );
-
-         int exponent( 0 );
-         frexp( norm, &exponent );
-         exponent = max( 0, exponent );
-
-         ResultType R( rhs.dm_ / pow( 2.0, double(exponent) ) );
-         ResultType A( R );
-         ResultType B( R );
-
-         for( size_t i=0UL; i<N; ++i ) {
-            B(i,i) += BT(1);
-         }
-
-         BT factor( 1 );
-         for( size_t k=2UL; k<K; ++k ) {
-            factor *= BT( k );
-            A *= R;
-            addAssign( B, ( A / factor ) );
-         }
-
-         for( int i=0; i<exponent; ++i ) {
-            B *= B;
-         }
-
+         const ResultType B( compute( rhs.dm_ ) );
          assign( *lhs, B );
       }
    }
@@ -286,7 +421,7 @@ class DMatExpExpr
       BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const ResultType tmp( serial( rhs ) );
+      const ResultType tmp( rhs );
       assign( *lhs, tmp );
    }
    /*! \endcond */
@@ -324,33 +459,7 @@ class DMatExpExpr
       }
       else
       {
-         using BT = UnderlyingBuiltin_t<ET>;
-
-         const BT norm( maxNorm( rhs.dm_ ) );
-
-         int exponent( 0 );
-         frexp( norm, &exponent );
-         exponent = max( 0, exponent );
-
-         ResultType R( rhs.dm_ / pow( 2.0, double(exponent) ) );
-         ResultType A( R );
-         ResultType B( R );
-
-         for( size_t i=0UL; i<N; ++i ) {
-            B(i,i) += BT(1);
-         }
-
-         BT factor( 1 );
-         for( size_t k=2UL; k<K; ++k ) {
-            factor *= BT( k );
-            A *= R;
-            addAssign( B, ( A / factor ) );
-         }
-
-         for( int i=0; i<exponent; ++i ) {
-            B *= B;
-         }
-
+         const ResultType B( compute( rhs.dm_ ) );
          addAssign( *lhs, B );
       }
    }
@@ -393,33 +502,7 @@ class DMatExpExpr
       }
       else
       {
-         using BT = UnderlyingBuiltin_t<ET>;
-
-         const BT norm( maxNorm( rhs.dm_ ) );
-
-         int exponent( 0 );
-         frexp( norm, &exponent );
-         exponent = max( 0, exponent );
-
-         ResultType R( rhs.dm_ / pow( 2.0, double(exponent) ) );
-         ResultType A( R );
-         ResultType B( R );
-
-         for( size_t i=0UL; i<N; ++i ) {
-            B(i,i) += BT(1);
-         }
-
-         BT factor( 1 );
-         for( size_t k=2UL; k<K; ++k ) {
-            factor *= BT( k );
-            A *= R;
-            addAssign( B, ( A / factor ) );
-         }
-
-         for( int i=0; i<exponent; ++i ) {
-            B *= B;
-         }
-
+         const ResultType B( compute( rhs.dm_ ) );
          subAssign( *lhs, B );
       }
    }
@@ -462,33 +545,7 @@ class DMatExpExpr
       }
       else
       {
-         using BT = UnderlyingBuiltin_t<ET>;
-
-         const BT norm( maxNorm( rhs.dm_ ) );
-
-         int exponent( 0 );
-         frexp( norm, &exponent );
-         exponent = max( 0, exponent );
-
-         ResultType R( rhs.dm_ / pow( 2.0, double(exponent) ) );
-         ResultType A( R );
-         ResultType B( R );
-
-         for( size_t i=0UL; i<N; ++i ) {
-            B(i,i) += BT(1);
-         }
-
-         BT factor( 1 );
-         for( size_t k=2UL; k<K; ++k ) {
-            factor *= BT( k );
-            A *= R;
-            addAssign( B, ( A / factor ) );
-         }
-
-         for( int i=0; i<exponent; ++i ) {
-            B *= B;
-         }
-
+         const ResultType B( compute( rhs.dm_ ) );
          schurAssign( *lhs, B );
       }
    }
@@ -536,6 +593,14 @@ class DMatExpExpr
 
                   \f[ e^X = \sum\limits_{k=0}^\infty \frac{1}{k!} X^k \f]
 
+// The exponential is computed by means of the scaling and squaring algorithm based on diagonal
+// Padé approximants of degree 3 to 13, where the degree and the number of squarings are selected
+// from the 1-norm of the matrix (see N.J. Higham, "The Scaling and Squaring Method for the Matrix
+// Exponential Revisited", SIAM J. Matrix Anal. Appl. 26(4), 2005). The computation requires at
+// most six matrix multiplications plus one linear solve and the squarings, which are performed
+// by the (potentially parallel) dense matrix multiplication kernels. No LAPACK library is
+// required.
+//
 // Example:
 
    \code
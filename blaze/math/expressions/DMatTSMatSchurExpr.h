@@ -52,13 +52,17 @@
 #include <blaze/math/constraints/Zero.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DMatSerialExpr.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/SchurExpr.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/SDDMM.h>
+#include <blaze/math/sparse/SMVM.h>
 #include <blaze/math/sparse/ValueIndexPair.h>
 #include <blaze/math/traits/SchurTrait.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsLower.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
@@ -107,7 +111,6 @@ class DMatTSMatSchurExpr
    using RT2 = ResultType_t<MT2>;     //!< Result type of the right-hand side sparse matrix expression.
    using RN1 = ReturnType_t<MT1>;     //!< Return type of the left-hand side dense matrix expression.
    using RN2 = ReturnType_t<MT2>;     //!< Return type of the right-hand side sparse matrix expression.
-   using CT1 = CompositeType_t<MT1>;  //!< Composite type of the left-hand side dense matrix expression.
    using CT2 = CompositeType_t<MT2>;  //!< Composite type of the right-hand side sparse matrix expression.
    //**********************************************************************************************
 
@@ -131,14 +134,39 @@ class DMatTSMatSchurExpr
        the sparse matrix operand requires an intermediate evaluation, \a useAssign will be set
        to \a true and the Schur product expression will be evaluated via the \a assign function
        family. Otherwise \a useAssign will be set to \a false and the expression will be
-       evaluated via the function call operator. */
-   static constexpr bool useAssign = ( RequiresEvaluation_v<MT1> || RequiresEvaluation_v<MT2> );
+       evaluated via the function call operator. Note that a dense matrix multiplication that
+       can be sampled at the non-zero elements of the sparse matrix (see \a useSDDMM) does not
+       require an intermediate evaluation. */
+   static constexpr bool useAssign =
+      ( RequiresEvaluation_v<MT2> || ( RequiresEvaluation_v<MT1> && !IsSDDMMCompatible_v<MT1> ) );
 
    /*! \cond BLAZE_INTERNAL */
    //! Helper variable template for the explicit application of the SFINAE principle.
    template< typename MT >
    static constexpr bool UseAssign_v = useAssign;
    /*! \endcond */
+
+   //! Compilation switch for the sampled dense matrix multiplication (SDDMM).
+   /*! The \a useSDDMM compile time constant expression represents a compilation switch for the
+       evaluation of a Schur product with a dense matrix multiplication. In case the dense matrix
+       operand is a multiplication of two dense matrices that don't require an intermediate
+       evaluation, \a useSDDMM will be set to \a true and the multiplication is only evaluated
+       at the positions of the non-zero elements of the sparse matrix. Otherwise \a useSDDMM
+       will be set to \a false. */
+   static constexpr bool useSDDMM = IsSDDMMCompatible_v<MT1>;
+
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT >
+   static constexpr bool UseSDDMMKernel_v = ( useSDDMM && IsSMVMCompatible_v<MT> );
+   /*! \endcond */
+
+   //! Composite type of the left-hand side dense matrix expression.
+   /*! In case \a useSDDMM is set to \a true, the dense matrix multiplication is not evaluated,
+       but its elements are computed on demand. */
+   using CT1 = If_t< useSDDMM
+                 , const DMatSerialExpr< MT1, IsColumnMajorMatrix_v<MT1> >
+                 , CompositeType_t<MT1> >;
    //**********************************************************************************************
 
  public:
@@ -619,7 +647,7 @@ class DMatTSMatSchurExpr
    */
    template< typename MT >  // Type of the target sparse matrix
    friend inline auto assign( SparseMatrix<MT,true>& lhs, const DMatTSMatSchurExpr& rhs )
-      -> EnableIf_t< UseAssign_v<MT> >
+      -> EnableIf_t< UseAssign_v<MT> && !UseSDDMMKernel_v<MT> >
    {
       BLAZE_FUNCTION_TRACE;
 
@@ -649,6 +677,53 @@ class DMatTSMatSchurExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Assignment to column-major sparse matrices (SDDMM)******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SDDMM-based assignment of a dense matrix-transpose sparse matrix Schur product to a
+   //        column-major sparse matrix.
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side Schur product expression to be assigned.
+   // \return void
+   //
+   // This function implements the assignment of a dense matrix-transpose sparse matrix Schur
+   // product expression with a dense matrix multiplication to a column-major compressed sparse
+   // matrix. Instead of evaluating the dense matrix multiplication as a whole, the non-zero
+   // elements of the sparse matrix are copied to the target matrix and are subsequently scaled by
+   // the according elements of the dense matrix multiplication, which are computed in place
+   // (sampled dense-dense matrix multiplication).
+   */
+   template< typename MT >  // Type of the target sparse matrix
+   friend inline auto assign( SparseMatrix<MT,true>& lhs, const DMatTSMatSchurExpr& rhs )
+      -> EnableIf_t< UseSDDMMKernel_v<MT> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      CT2 B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side sparse matrix operand
+
+      BLAZE_INTERNAL_ASSERT( B.rows()    == (*lhs).rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (*lhs).columns(), "Invalid number of columns" );
+
+      // Final memory allocation (based on the evaluated operand)
+      (*lhs).reserve( B.nonZeros() );
+
+      // Copying the sparsity pattern and the values of the sparse matrix operand
+      for( size_t j=0UL; j<(*lhs).columns(); ++j ) {
+         for( auto element=B.begin(j); element!=B.end(j); ++element )
+            (*lhs).append( element->index(), j, element->value() );
+         (*lhs).finalize( j );
+      }
+
+      // Sampling the dense matrix multiplication at the non-zero elements
+      sddmm( *lhs, rhs.lhs_ );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Addition assignment to dense matrices*******************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Addition assignment of a dense matrix-transpose sparse matrix Schur product to a
@@ -850,8 +925,13 @@ class DMatTSMatSchurExpr
       BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      smpSchurAssign( *lhs, rhs.lhs_ );
-      smpSchurAssign( *lhs, rhs.rhs_ );
+      if( useSDDMM ) {
+         schurAssign( *lhs, rhs );
+      }
+      else {
+         smpSchurAssign( *lhs, rhs.lhs_ );
+         smpSchurAssign( *lhs, rhs.rhs_ );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
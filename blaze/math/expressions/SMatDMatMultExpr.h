@@ -54,17 +54,23 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatMatMultExpr.h>
+#include <blaze/math/functors/AddAssign.h>
+#include <blaze/math/functors/Assign.h>
 #include <blaze/math/functors/DeclDiag.h>
 #include <blaze/math/functors/DeclHerm.h>
 #include <blaze/math/functors/DeclLow.h>
 #include <blaze/math/functors/DeclSym.h>
 #include <blaze/math/functors/DeclUpp.h>
 #include <blaze/math/functors/Noop.h>
+#include <blaze/math/functors/SubAssign.h>
 #include <blaze/math/shims/Conjugate.h>
 #include <blaze/math/shims/PrevMultiple.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/sparse/SMMM.h>
 #include <blaze/math/traits/DeclDiagTrait.h>
 #include <blaze/math/traits/DeclHermTrait.h>
 #include <blaze/math/traits/DeclLowTrait.h>
@@ -83,6 +89,7 @@
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
 #include <blaze/math/typetraits/IsTriangular.h>
@@ -168,6 +175,22 @@ class SMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the sparse matrix operand provides direct access to its compressed storage, both
+       dense matrices provide direct access to their data and all element types are identical
+       vectorizable types, the variable will be set to 1 and the blocked SMMM kernels are used.
+       Otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   static constexpr bool UseSMMMKernel_v =
+      ( useOptimizedKernels &&
+        !( SYM || HERM || LOW || UPP ) &&
+        !IsDiagonal_v<T3> &&
+        IsSMMMCompatible_v<T1,T2,T3> );
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper variable template for the explicit application of the SFINAE principle.
@@ -176,6 +199,7 @@ class SMatDMatMultExpr
    template< typename T1, typename T2, typename T3 >
    static constexpr bool UseVectorizedKernel_v =
       ( useOptimizedKernels &&
+        !UseSMMMKernel_v<T1,T2,T3> &&
         !IsDiagonal_v<T3> &&
         T1::simdEnabled && T3::simdEnabled &&
         IsRowMajorMatrix_v<T1> &&
@@ -196,6 +220,7 @@ class SMatDMatMultExpr
    template< typename T1, typename T2, typename T3 >
    static constexpr bool UseOptimizedKernel_v =
       ( useOptimizedKernels &&
+        !UseSMMMKernel_v<T1,T2,T3> &&
         !UseVectorizedKernel_v<T1,T2,T3> &&
         !IsDiagonal_v<T3> &&
         !IsResizable_v< ElementType_t<T1> > &&
@@ -206,11 +231,12 @@ class SMatDMatMultExpr
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper variable template for the explicit application of the SFINAE principle.
-   /*! In case neither a vectorized nor optimized computation is possible, the variable will be
-       set to 1, otherwise it will be 0. */
+   /*! In case neither a blocked, vectorized, nor optimized computation is possible, the variable
+       will be set to 1, otherwise it will be 0. */
    template< typename T1, typename T2, typename T3 >
    static constexpr bool UseDefaultKernel_v =
-      ( !UseVectorizedKernel_v<T1,T2,T3> &&
+      ( !UseSMMMKernel_v<T1,T2,T3> &&
+        !UseVectorizedKernel_v<T1,T2,T3> &&
         !UseOptimizedKernel_v<T1,T2,T3> );
    /*! \endcond */
    //**********************************************************************************************
@@ -464,6 +490,41 @@ class SMatDMatMultExpr
    RightOperand rhs_;  //!< Right-hand side dense matrix of the multiplication expression.
    //**********************************************************************************************
 
+   //**SMMM-based SMP compute kernel***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMMM-based SMP compute kernel for a sparse matrix-dense matrix multiplication
+   //        (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression.
+   // \param op The assignment operation (plain, addition, or subtraction assignment).
+   // \return void
+   //
+   // This function splits the rows of the sparse matrix operand into ranges containing roughly
+   // the same number of non-zero elements and evaluates the ranges in parallel via the blocked
+   // SMMM kernels.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename OP >   // Type of the assignment operation
+   static inline void smpSmmmKernel( MT3& C, const SMatDMatMultExpr& rhs, OP op )
+   {
+      LT A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == C.rows()    , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == C.columns() , "Invalid number of columns" );
+
+      const size_t parts( ( IsSMPAssignable_v<MT3> && rhs.canSMPAssign() )
+                          ? min( getNumThreads(), A.rows() ) : 1UL );
+
+      smpFor( parts, [&]( size_t part ) {
+         smmm( C, A, B, smvmSplit( A, part, parts ), smvmSplit( A, part+1UL, parts ), op );
+      } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to dense matrices****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a sparse matrix-dense matrix multiplication to a dense matrix
@@ -840,6 +901,33 @@ class SMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMMM-based assignment to dense matrices*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMMM-based assignment of a sparse matrix-dense matrix multiplication to dense
+   //        matrices (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function implements the assignment kernel for the sparse matrix-dense matrix
+   // multiplication based on the blocked SMMM kernels. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case the sparse
+   // matrix operand provides direct access to its compressed storage.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline auto selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
+      -> EnableIf_t< UseSMMMKernel_v<MT3,MT4,MT5> >
+   {
+      smmm( C, A, B, 0UL, A.rows(), Assign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse matrices***************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a sparse matrix-dense matrix multiplication to a sparse matrix
@@ -1232,6 +1320,33 @@ class SMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMMM-based addition assignment to dense matrices********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMMM-based addition assignment of a sparse matrix-dense matrix multiplication to
+   //        dense matrices (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function implements the addition assignment kernel for the sparse matrix-dense matrix
+   // multiplication based on the blocked SMMM kernels. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case the sparse
+   // matrix operand provides direct access to its compressed storage.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline auto selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+      -> EnableIf_t< UseSMMMKernel_v<MT3,MT4,MT5> >
+   {
+      smmm( C, A, B, 0UL, A.rows(), AddAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Addition assignment to sparse matrices******************************************************
    // No special implementation for the addition assignment to sparse matrices.
    //**********************************************************************************************
@@ -1589,6 +1704,33 @@ class SMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMMM-based subtraction assignment to dense matrices*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMMM-based subtraction assignment of a sparse matrix-dense matrix multiplication
+   //        to dense matrices (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function implements the subtraction assignment kernel for the sparse matrix-dense matrix
+   // multiplication based on the blocked SMMM kernels. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case the sparse
+   // matrix operand provides direct access to its compressed storage.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline auto selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+      -> EnableIf_t< UseSMMMKernel_v<MT3,MT4,MT5> >
+   {
+      smmm( C, A, B, 0UL, A.rows(), SubAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse matrices***************************************************
    // No special implementation for the subtraction assignment to sparse matrices.
    //**********************************************************************************************
@@ -1677,6 +1819,37 @@ class SMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMMM-based SMP assignment to dense matrices*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMMM-based SMP assignment of a sparse matrix-dense matrix multiplication to a
+   //        dense matrix (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the SMP assignment of a sparse matrix-dense matrix multiplication
+   // expression to a dense matrix via the blocked SMMM kernels, where each thread computes a
+   // range of rows with approximately the same number of non-zero elements. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler in
+   // case the sparse matrix operand provides direct access to its compressed storage.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline auto smpAssign( DenseMatrix<MT,SO>& lhs, const SMatDMatMultExpr& rhs )
+      -> EnableIf_t< !IsEvaluationRequired_v<MT,MT1,MT2> && UseSMMMKernel_v<MT,MT1,MT2> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      SMatDMatMultExpr::smpSmmmKernel( *lhs, rhs, Assign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to sparse matrices***********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a sparse matrix-dense matrix multiplication to a sparse matrix
@@ -1760,6 +1933,37 @@ class SMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMMM-based SMP addition assignment to dense matrices****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMMM-based SMP addition assignment of a sparse matrix-dense matrix multiplication
+   //        to a dense matrix (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the SMP addition assignment of a sparse matrix-dense matrix
+   // multiplication expression to a dense matrix via the blocked SMMM kernels, where each thread
+   // computes a range of rows with approximately the same number of non-zero elements. Due to the
+   // explicit application of the SFINAE principle, this function can only be selected by the
+   // compiler in case the sparse matrix operand provides direct access to its compressed storage.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline auto smpAddAssign( DenseMatrix<MT,SO>& lhs, const SMatDMatMultExpr& rhs )
+      -> EnableIf_t< !IsEvaluationRequired_v<MT,MT1,MT2> && UseSMMMKernel_v<MT,MT1,MT2> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      SMatDMatMultExpr::smpSmmmKernel( *lhs, rhs, AddAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP addition assignment to sparse matrices**************************************************
    // No special implementation for the SMP addition assignment to sparse matrices.
    //**********************************************************************************************
@@ -1805,6 +2009,37 @@ class SMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMMM-based SMP subtraction assignment to dense matrices*************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMMM-based SMP subtraction assignment of a sparse matrix-dense matrix
+   //        multiplication to a dense matrix (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the SMP subtraction assignment of a sparse matrix-dense matrix
+   // multiplication expression to a dense matrix via the blocked SMMM kernels, where each thread
+   // computes a range of rows with approximately the same number of non-zero elements. Due to the
+   // explicit application of the SFINAE principle, this function can only be selected by the
+   // compiler in case the sparse matrix operand provides direct access to its compressed storage.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline auto smpSubAssign( DenseMatrix<MT,SO>& lhs, const SMatDMatMultExpr& rhs )
+      -> EnableIf_t< !IsEvaluationRequired_v<MT,MT1,MT2> && UseSMMMKernel_v<MT,MT1,MT2> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      SMatDMatMultExpr::smpSmmmKernel( *lhs, rhs, SubAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP subtraction assignment to sparse matrices***********************************************
    // No special implementation for the SMP subtraction assignment to sparse matrices.
    //**********************************************************************************************
@@ -54,24 +54,36 @@
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatVecMultExpr.h>
+#include <blaze/math/functors/AddAssign.h>
+#include <blaze/math/functors/Assign.h>
+#include <blaze/math/functors/SubAssign.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/sparse/SMVM.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsContiguous.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsIdentity.h>
 #include <blaze/math/typetraits/IsZero.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/views/Check.h>
 #include <blaze/system/MacroDisable.h>
+#include <blaze/system/Optimizations.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/MaybeUnused.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
 
 
 namespace blaze {
@@ -143,6 +155,23 @@ class SMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the sparse matrix operand provides direct access to its compressed storage, the
+       dense vector operand is contiguous in memory and all element types are identical built-in
+       types, the variable will be set to 1 and the optimized SMVM kernels are used. Otherwise
+       it will be 0. */
+   template< typename T1 >
+   static constexpr bool UseOptimizedKernel_v =
+      ( useOptimizedKernels && !useAssign &&
+        IsSMVMCompatible_v<MT> &&
+        IsContiguous_v<VT> && HasConstDataAccess_v<VT> &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<MT> > &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<VT> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    //! Type of this SMatDVecMultExpr instance.
@@ -302,6 +331,69 @@ class SMatDVecMultExpr
    RightOperand vec_;  //!< Right-hand side dense vector of the multiplication expression.
    //**********************************************************************************************
 
+   //**Optimized compute kernel********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Optimized compute kernel for a range of rows of a sparse matrix-dense vector
+   //        multiplication (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param first The first row of the range.
+   // \param last The row one past the end of the range.
+   // \param op The assignment operation (plain, addition, or subtraction assignment).
+   // \return void
+   //
+   // This function computes the rows \f$[first..last)\f$ of the sparse matrix-dense vector
+   // multiplication via the optimized SMVM kernels.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename OP >   // Type of the assignment operation
+   static inline void smvmKernel( VT1& y, const MT& A, const VT& x,
+                                  size_t first, size_t last, OP op )
+   {
+      const auto* data( x.data() );
+
+      for( size_t i=first; i<last; ++i ) {
+         op( y[i], smvmDot( A.begin(i), A.end(i), data ) );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Optimized SMP compute kernel****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Optimized SMP compute kernel for a sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression.
+   // \param op The assignment operation (plain, addition, or subtraction assignment).
+   // \return void
+   //
+   // This function splits the rows of the sparse matrix operand into ranges containing roughly
+   // the same number of non-zero elements and evaluates the ranges in parallel via the optimized
+   // SMVM kernels.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename OP >   // Type of the assignment operation
+   static inline void smpSmvmKernel( VT1& y, const SMatDVecMultExpr& rhs, OP op )
+   {
+      const MT& A( rhs.mat_ );
+      const VT& x( rhs.vec_ );
+
+      const size_t parts( ( IsSMPAssignable_v<VT1> && rhs.canSMPAssign() )
+                          ? min( getNumThreads(), A.rows() ) : 1UL );
+
+      smpFor( parts, [&]( size_t part ) {
+         smvmKernel( y, A, x, smvmSplit( A, part, parts ), smvmSplit( A, part+1UL, parts ), op );
+      } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to dense vectors*****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a sparse matrix-dense vector multiplication to a dense vector
@@ -344,6 +436,34 @@ class SMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Optimized assignment to dense vectors*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Optimized assignment of a sparse matrix-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression.
+   // \return void
+   //
+   // This function implements the assignment of a sparse matrix-dense vector multiplication
+   // expression to a dense vector via the optimized SMVM kernels. Due to the explicit application
+   // of the SFINAE principle, this function can only be selected by the compiler in case the
+   // sparse matrix operand provides direct access to its compressed storage.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline auto assign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+      -> EnableIf_t< UseOptimizedKernel_v<VT1> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      SMatDVecMultExpr::smvmKernel( *lhs, rhs.mat_, rhs.vec_, 0UL, rhs.size(), Assign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse vectors****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a sparse matrix-dense vector multiplication to a sparse vector
@@ -419,6 +539,34 @@ class SMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Optimized addition assignment to dense vectors**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Optimized addition assignment of a sparse matrix-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression.
+   // \return void
+   //
+   // This function implements the addition assignment of a sparse matrix-dense vector
+   // multiplication expression to a dense vector via the optimized SMVM kernels. Due to the
+   // explicit application of the SFINAE principle, this function can only be selected by the
+   // compiler in case the sparse matrix operand provides direct access to its compressed storage.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline auto addAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+      -> EnableIf_t< UseOptimizedKernel_v<VT1> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      SMatDVecMultExpr::smvmKernel( *lhs, rhs.mat_, rhs.vec_, 0UL, rhs.size(), AddAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Addition assignment to sparse vectors*******************************************************
    // No special implementation for the addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -464,6 +612,34 @@ class SMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Optimized subtraction assignment to dense vectors*******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Optimized subtraction assignment of a sparse matrix-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression.
+   // \return void
+   //
+   // This function implements the subtraction assignment of a sparse matrix-dense vector
+   // multiplication expression to a dense vector via the optimized SMVM kernels. Due to the
+   // explicit application of the SFINAE principle, this function can only be selected by the
+   // compiler in case the sparse matrix operand provides direct access to its compressed storage.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline auto subAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+      -> EnableIf_t< UseOptimizedKernel_v<VT1> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      SMatDVecMultExpr::smvmKernel( *lhs, rhs.mat_, rhs.vec_, 0UL, rhs.size(), SubAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse vectors****************************************************
    // No special implementation for the subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -585,6 +761,34 @@ class SMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Optimized SMP assignment to dense vectors***************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Optimized SMP assignment of a sparse matrix-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression.
+   // \return void
+   //
+   // This function implements the SMP assignment of a sparse matrix-dense vector multiplication
+   // expression to a dense vector via the optimized SMVM kernels. Due to the explicit application
+   // of the SFINAE principle, this function can only be selected by the compiler in case the
+   // sparse matrix operand provides direct access to its compressed storage.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline auto smpAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+      -> EnableIf_t< UseOptimizedKernel_v<VT1> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      SMatDVecMultExpr::smpSmvmKernel( *lhs, rhs, Assign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to sparse vectors************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a sparse matrix-dense vector multiplication to a sparse vector
@@ -658,6 +862,34 @@ class SMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Optimized SMP addition assignment to dense vectors******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Optimized SMP addition assignment of a sparse matrix-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression.
+   // \return void
+   //
+   // This function implements the SMP addition assignment of a sparse matrix-dense vector
+   // multiplication expression to a dense vector via the optimized SMVM kernels. Due to the
+   // explicit application of the SFINAE principle, this function can only be selected by the
+   // compiler in case the sparse matrix operand provides direct access to its compressed storage.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline auto smpAddAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+      -> EnableIf_t< UseOptimizedKernel_v<VT1> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      SMatDVecMultExpr::smpSmvmKernel( *lhs, rhs, AddAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP addition assignment to sparse vectors***************************************************
    // No special implementation for the SMP addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -702,6 +934,34 @@ class SMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Optimized SMP subtraction assignment to dense vectors***************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Optimized SMP subtraction assignment of a sparse matrix-dense vector multiplication
+   //        to a dense vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression.
+   // \return void
+   //
+   // This function implements the SMP subtraction assignment of a sparse matrix-dense vector
+   // multiplication expression to a dense vector via the optimized SMVM kernels. Due to the
+   // explicit application of the SFINAE principle, this function can only be selected by the
+   // compiler in case the sparse matrix operand provides direct access to its compressed storage.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline auto smpSubAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+      -> EnableIf_t< UseOptimizedKernel_v<VT1> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      SMatDVecMultExpr::smpSmvmKernel( *lhs, rhs, SubAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP subtraction assignment to sparse vectors************************************************
    // No special implementation for the SMP subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -54,16 +54,22 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatMatMultExpr.h>
+#include <blaze/math/functors/AddAssign.h>
+#include <blaze/math/functors/Assign.h>
 #include <blaze/math/functors/DeclDiag.h>
 #include <blaze/math/functors/DeclHerm.h>
 #include <blaze/math/functors/DeclLow.h>
 #include <blaze/math/functors/DeclSym.h>
 #include <blaze/math/functors/DeclUpp.h>
 #include <blaze/math/functors/Noop.h>
+#include <blaze/math/functors/SubAssign.h>
 #include <blaze/math/shims/Conjugate.h>
 #include <blaze/math/shims/PrevMultiple.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/sparse/SMMM.h>
 #include <blaze/math/traits/DeclDiagTrait.h>
 #include <blaze/math/traits/DeclHermTrait.h>
 #include <blaze/math/traits/DeclLowTrait.h>
@@ -77,6 +83,7 @@
 #include <blaze/math/typetraits/IsIdentity.h>
 #include <blaze/math/typetraits/IsLower.h>
 #include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
 #include <blaze/math/typetraits/IsSymmetric.h>
@@ -176,6 +183,22 @@ class SMatTDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the sparse matrix operand provides direct access to its compressed storage, the
+       target matrix and a row-major copy of the dense matrix operand provide direct access to
+       their data and all element types are identical vectorizable types, the variable will be
+       set to 1 and the blocked SMMM kernels are used. Otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   static constexpr bool UseSMMMKernel_v =
+      ( useOptimizedKernels &&
+        !( SYM || HERM || LOW || UPP ) &&
+        !IsDiagonal_v<T3> &&
+        IsSMMMCompatible_v< T1, T2, OppositeType_t<T3> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper variable template for the explicit application of the SFINAE principle.
@@ -184,6 +207,7 @@ class SMatTDMatMultExpr
    template< typename T1, typename T2, typename T3 >
    static constexpr bool UseOptimizedKernel_v =
       ( useOptimizedKernels &&
+        !UseSMMMKernel_v<T1,T2,T3> &&
         !IsDiagonal_v<T3> &&
         !IsResizable_v< ElementType_t<T1> > &&
         !IsResizable_v<ET1> );
@@ -429,6 +453,43 @@ class SMatTDMatMultExpr
    RightOperand rhs_;  //!< Right-hand side dense matrix of the multiplication expression.
    //**********************************************************************************************
 
+   //**SMMM-based SMP compute kernel***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMMM-based SMP compute kernel for a sparse matrix-transpose dense matrix
+   //        multiplication (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression.
+   // \param op The assignment operation (plain, addition, or subtraction assignment).
+   // \return void
+   //
+   // This function copies the column-major dense matrix operand into a row-major temporary,
+   // splits the rows of the sparse matrix operand into ranges containing roughly the same number
+   // of non-zero elements and evaluates the ranges in parallel via the blocked SMMM kernels.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename OP >   // Type of the assignment operation
+   static inline void smpSmmmKernel( MT3& C, const SMatTDMatMultExpr& rhs, OP op )
+   {
+      LT A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == C.rows()    , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == C.columns() , "Invalid number of columns" );
+
+      const OppositeType_t<MT2> tmp( serial( B ) );
+
+      const size_t parts( ( IsSMPAssignable_v<MT3> && rhs.canSMPAssign() )
+                          ? min( getNumThreads(), A.rows() ) : 1UL );
+
+      smpFor( parts, [&]( size_t part ) {
+         smmm( C, A, tmp, smvmSplit( A, part, parts ), smvmSplit( A, part+1UL, parts ), op );
+      } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to dense matrices****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a sparse matrix-transpose dense matrix multiplication to a dense matrix
@@ -485,7 +546,7 @@ class SMatTDMatMultExpr
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
    static inline auto selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
-      -> DisableIf_t< UseOptimizedKernel_v<MT3,MT4,MT5> >
+      -> DisableIf_t< UseSMMMKernel_v<MT3,MT4,MT5> || UseOptimizedKernel_v<MT3,MT4,MT5> >
    {
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
@@ -784,6 +845,37 @@ class SMatTDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMMM-based assignment to dense matrices*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMMM-based assignment of a sparse matrix-transpose dense matrix multiplication
+   //        (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function implements the assignment kernel for the sparse matrix-transpose dense matrix
+   // multiplication based on the blocked SMMM kernels. For that purpose the column-major dense
+   // matrix operand is copied into a row-major temporary, which enables a vectorized computation
+   // of each row of the target matrix. Due to the explicit application of the SFINAE principle,
+   // this function can only be selected by the compiler in case the sparse matrix operand provides
+   // direct access to its compressed storage.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline auto selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
+      -> EnableIf_t< UseSMMMKernel_v<MT3,MT4,MT5> >
+   {
+      const OppositeType_t<MT5> tmp( serial( B ) );
+
+      smmm( C, A, tmp, 0UL, A.rows(), Assign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse matrices***************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a sparse matrix-transpose dense matrix multiplication to a sparse matrix
@@ -912,7 +1004,7 @@ class SMatTDMatMultExpr
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
    static inline auto selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
-      -> DisableIf_t< UseOptimizedKernel_v<MT3,MT4,MT5> >
+      -> DisableIf_t< UseSMMMKernel_v<MT3,MT4,MT5> || UseOptimizedKernel_v<MT3,MT4,MT5> >
    {
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
@@ -1150,6 +1242,37 @@ class SMatTDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMMM-based addition assignment to dense matrices********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMMM-based addition assignment of a sparse matrix-transpose dense matrix
+   //        multiplication (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function implements the addition assignment kernel for the sparse matrix-transpose dense
+   // matrix multiplication based on the blocked SMMM kernels. For that purpose the column-major
+   // dense matrix operand is copied into a row-major temporary, which enables a vectorized
+   // computation of each row of the target matrix. Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case the sparse matrix
+   // operand provides direct access to its compressed storage.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline auto selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+      -> EnableIf_t< UseSMMMKernel_v<MT3,MT4,MT5> >
+   {
+      const OppositeType_t<MT5> tmp( serial( B ) );
+
+      smmm( C, A, tmp, 0UL, A.rows(), AddAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Restructuring addition assignment***********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Restructuring addition assignment of a sparse matrix-transpose dense matrix
@@ -1226,8 +1349,8 @@ class SMatTDMatMultExpr
 
    //**Default subtraction assignment to dense matrices********************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Default subtraction assignment of a sparse matrix-transpose dense matrix multiplication
-   //        (\f$ C-=A*B \f$).
+   /*!\brief Default subtraction assignment of a sparse matrix-transpose dense matrix
+   //        multiplication (\f$ C-=A*B \f$).
    // \ingroup dense_matrix
    //
    // \param C The target left-hand side dense matrix.
@@ -1242,7 +1365,7 @@ class SMatTDMatMultExpr
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
    static inline auto selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
-      -> DisableIf_t< UseOptimizedKernel_v<MT3,MT4,MT5> >
+      -> DisableIf_t< UseSMMMKernel_v<MT3,MT4,MT5> || UseOptimizedKernel_v<MT3,MT4,MT5> >
    {
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
@@ -1480,6 +1603,37 @@ class SMatTDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMMM-based subtraction assignment to dense matrices*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMMM-based subtraction assignment of a sparse matrix-transpose dense matrix
+   //        multiplication (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function implements the subtraction assignment kernel for the sparse matrix-transpose
+   // dense matrix multiplication based on the blocked SMMM kernels. For that purpose the
+   // column-major dense matrix operand is copied into a row-major temporary, which enables a
+   // vectorized computation of each row of the target matrix. Due to the explicit application of
+   // the SFINAE principle, this function can only be selected by the compiler in case the sparse
+   // matrix operand provides direct access to its compressed storage.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline auto selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+      -> EnableIf_t< UseSMMMKernel_v<MT3,MT4,MT5> >
+   {
+      const OppositeType_t<MT5> tmp( serial( B ) );
+
+      smmm( C, A, tmp, 0UL, A.rows(), SubAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Restructuring subtraction assignment********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Restructuring subtraction assignment of a sparse matrix-transpose dense matrix
@@ -1570,10 +1724,11 @@ class SMatTDMatMultExpr
    // \param rhs The right-hand side multiplication expression to be assigned.
    // \return void
    //
-   // This function implements the performance optimized SMP assignment of a sparse matrix-transpose
-   // dense matrix multiplication expression to a dense matrix. Due to the explicit application of
-   // the SFINAE principle this function can only be selected by the compiler in case either of the
-   // two matrix operands requires an intermediate evaluation and no symmetry can be exploited.
+   // This function implements the performance optimized SMP assignment of a sparse
+   // matrix-transpose dense matrix multiplication expression to a dense matrix. Due to the
+   // explicit application of the SFINAE principle this function can only be selected by the
+   // compiler in case either of the two matrix operands requires an intermediate evaluation and no
+   // symmetry can be exploited.
    */
    template< typename MT  // Type of the target dense matrix
            , bool SO >    // Storage order of the target dense matrix
@@ -1600,6 +1755,38 @@ class SMatTDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMMM-based SMP assignment to dense matrices*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMMM-based SMP assignment of a sparse matrix-transpose dense matrix multiplication to
+   //        a dense matrix (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the SMP assignment of a sparse matrix-transpose dense matrix
+   // multiplication expression to a dense matrix via the blocked SMMM kernels, where each thread
+   // computes a range of rows with approximately the same number of non-zero elements. Due to the
+   // explicit application of the SFINAE principle, this function can only be selected by the
+   // compiler in case the sparse matrix operand provides direct access to its compressed storage
+   // and no symmetry can be exploited.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline auto smpAssign( DenseMatrix<MT,SO>& lhs, const SMatTDMatMultExpr& rhs )
+      -> EnableIf_t< !CanExploitSymmetry_v<MT,MT1,MT2> && UseSMMMKernel_v<MT,MT1,MT2> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      SMatTDMatMultExpr::smpSmmmKernel( *lhs, rhs, Assign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to sparse matrices***********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a sparse matrix-transpose dense matrix multiplication to a sparse
@@ -1610,10 +1797,11 @@ class SMatTDMatMultExpr
    // \param rhs The right-hand side multiplication expression to be assigned.
    // \return void
    //
-   // This function implements the performance optimized SMP assignment of a sparse matrix-transpose
-   // dense matrix multiplication expression to a sparse matrix. Due to the explicit application of
-   // the SFINAE principle this function can only be selected by the compiler in case either of the
-   // two matrix operands requires an intermediate evaluation and no symmetry can be exploited.
+   // This function implements the performance optimized SMP assignment of a sparse
+   // matrix-transpose dense matrix multiplication expression to a sparse matrix. Due to the
+   // explicit application of the SFINAE principle this function can only be selected by the
+   // compiler in case either of the two matrix operands requires an intermediate evaluation and no
+   // symmetry can be exploited.
    */
    template< typename MT  // Type of the target sparse matrix
            , bool SO >    // Storage order of the target sparse matrix
@@ -1715,6 +1903,38 @@ class SMatTDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMMM-based SMP addition assignment to dense matrices****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMMM-based SMP addition assignment of a sparse matrix-transpose dense matrix
+   //        multiplication to a dense matrix (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the SMP addition assignment of a sparse matrix-transpose dense
+   // matrix multiplication expression to a dense matrix via the blocked SMMM kernels, where each
+   // thread computes a range of rows with approximately the same number of non-zero elements. Due
+   // to the explicit application of the SFINAE principle, this function can only be selected by
+   // the compiler in case the sparse matrix operand provides direct access to its compressed
+   // storage and no symmetry can be exploited.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline auto smpAddAssign( DenseMatrix<MT,SO>& lhs, const SMatTDMatMultExpr& rhs )
+      -> EnableIf_t< !CanExploitSymmetry_v<MT,MT1,MT2> && UseSMMMKernel_v<MT,MT1,MT2> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      SMatTDMatMultExpr::smpSmmmKernel( *lhs, rhs, AddAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Restructuring SMP addition assignment*******************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Restructuring SMP addition assignment of a sparse matrix-transpose dense matrix
@@ -1792,6 +2012,38 @@ class SMatTDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMMM-based SMP subtraction assignment to dense matrices*************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMMM-based SMP subtraction assignment of a sparse matrix-transpose dense matrix
+   //        multiplication to a dense matrix (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the SMP subtraction assignment of a sparse matrix-transpose dense
+   // matrix multiplication expression to a dense matrix via the blocked SMMM kernels, where each
+   // thread computes a range of rows with approximately the same number of non-zero elements. Due
+   // to the explicit application of the SFINAE principle, this function can only be selected by
+   // the compiler in case the sparse matrix operand provides direct access to its compressed
+   // storage and no symmetry can be exploited.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline auto smpSubAssign( DenseMatrix<MT,SO>& lhs, const SMatTDMatMultExpr& rhs )
+      -> EnableIf_t< !CanExploitSymmetry_v<MT,MT1,MT2> && UseSMMMKernel_v<MT,MT1,MT2> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      SMatTDMatMultExpr::smpSmmmKernel( *lhs, rhs, SubAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Restructuring SMP subtraction assignment****************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Restructuring SMP subtraction assignment of a sparse matrix-transpose dense matrix
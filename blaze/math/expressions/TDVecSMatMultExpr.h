@@ -58,9 +58,12 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/SMVM.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsContiguous.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsIdentity.h>
@@ -74,6 +77,7 @@
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/views/Check.h>
 #include <blaze/system/MacroDisable.h>
+#include <blaze/system/Optimizations.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
@@ -81,6 +85,7 @@
 #include <blaze/util/MaybeUnused.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
 
 
 namespace blaze {
@@ -133,6 +138,23 @@ class TDVecSMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the target vector is contiguous in memory, the sparse matrix operand provides
+       direct access to its compressed storage and all element types are identical built-in
+       types, the variable will be set to 1 and the optimized SMVM kernels are used. Otherwise
+       it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   static constexpr bool UseOptimizedKernel_v =
+      ( useOptimizedKernels &&
+        IsContiguous_v<T1> && HasMutableDataAccess_v<T1> &&
+        IsSMVMCompatible_v<T3> &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T2> > &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T3> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    //! Type of this TDVecSMatMultExpr instance.
@@ -360,7 +382,8 @@ class TDVecSMatMultExpr
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
            , typename MT1 >  // Type of the right-hand side matrix operand
-   static inline void selectAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   static inline auto selectAssignKernel( VT1& y, const VT2& x, const MT1& A )
+      -> DisableIf_t< UseOptimizedKernel_v<VT1,VT2,MT1> >
    {
       for( size_t i=0UL; i<x.size(); ++i )
       {
@@ -379,6 +402,37 @@ class TDVecSMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMVM-based assignment to dense vectors******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMVM-based assignment of a transpose dense vector-sparse matrix multiplication
+   //        (\f$ \vec{y}^T=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side sparse matrix operand.
+   // \return void
+   //
+   // This function implements the serial assignment kernel for the transpose dense vector-sparse
+   // matrix multiplication based on the optimized SMVM scatter kernel. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler in
+   // case the sparse matrix operand provides direct access to its compressed storage.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline auto selectAssignKernel( VT1& y, const VT2& x, const MT1& A )
+      -> EnableIf_t< UseOptimizedKernel_v<VT1,VT2,MT1> >
+   {
+      auto* data( y.data() );
+
+      for( size_t i=0UL; i<x.size(); ++i ) {
+         smvmScatter( A.begin(i), A.end(i), x[i], data );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse vectors****************************************************************
    /*!\brief Assignment of a transpose dense vector-sparse matrix multiplication to a sparse
    //        vector (\f$ \vec{y}^T=\vec{x}^T*A \f$).
@@ -442,7 +496,7 @@ class TDVecSMatMultExpr
    }
    //**********************************************************************************************
 
-   //**Optimized addition assignment to dense vectors*************************************************
+   //**Optimized addition assignment to dense vectors**********************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Optimized addition assignment of a transpose dense vector-sparse matrix
    //        multiplication (\f$ \vec{y}^T+=\vec{x}^T*A \f$).
@@ -459,7 +513,8 @@ class TDVecSMatMultExpr
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
            , typename MT1 >  // Type of the right-hand side matrix operand
-   static inline void selectAddAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   static inline auto selectAddAssignKernel( VT1& y, const VT2& x, const MT1& A )
+      -> DisableIf_t< UseOptimizedKernel_v<VT1,VT2,MT1> >
    {
       for( size_t i=0UL; i<x.size(); ++i )
       {
@@ -474,6 +529,37 @@ class TDVecSMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMVM-based addition assignment to dense vectors*********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMVM-based addition assignment of a transpose dense vector-sparse matrix
+   //        multiplication (\f$ \vec{y}^T+=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side sparse matrix operand.
+   // \return void
+   //
+   // This function implements the serial addition assignment kernel for the transpose dense
+   // vector-sparse matrix multiplication based on the optimized SMVM scatter kernel. Due to the
+   // explicit application of the SFINAE principle, this function can only be selected by the
+   // compiler in case the sparse matrix operand provides direct access to its compressed storage.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline auto selectAddAssignKernel( VT1& y, const VT2& x, const MT1& A )
+      -> EnableIf_t< UseOptimizedKernel_v<VT1,VT2,MT1> >
+   {
+      auto* data( y.data() );
+
+      for( size_t i=0UL; i<x.size(); ++i ) {
+         smvmScatter( A.begin(i), A.end(i), x[i], data );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Addition assignment to sparse vectors*******************************************************
    // No special implementation for the addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -513,7 +599,7 @@ class TDVecSMatMultExpr
    }
    //**********************************************************************************************
 
-   //**Optimized subtraction assignment to dense vectors**********************************************
+   //**Optimized subtraction assignment to dense vectors*******************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Optimized subtraction assignment of a transpose dense vector-sparse matrix
    //        multiplication (\f$ \vec{y}^T-=\vec{x}^T*A \f$).
@@ -530,7 +616,8 @@ class TDVecSMatMultExpr
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
            , typename MT1 >  // Type of the right-hand side matrix operand
-   static inline void selectSubAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   static inline auto selectSubAssignKernel( VT1& y, const VT2& x, const MT1& A )
+      -> DisableIf_t< UseOptimizedKernel_v<VT1,VT2,MT1> >
    {
       for( size_t i=0UL; i<x.size(); ++i )
       {
@@ -545,6 +632,37 @@ class TDVecSMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMVM-based subtraction assignment to dense vectors******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMVM-based subtraction assignment of a transpose dense vector-sparse matrix
+   //        multiplication (\f$ \vec{y}^T-=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side sparse matrix operand.
+   // \return void
+   //
+   // This function implements the serial subtraction assignment kernel for the transpose dense
+   // vector-sparse matrix multiplication based on the optimized SMVM scatter kernel. Due to the
+   // explicit application of the SFINAE principle, this function can only be selected by the
+   // compiler in case the sparse matrix operand provides direct access to its compressed storage.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline auto selectSubAssignKernel( VT1& y, const VT2& x, const MT1& A )
+      -> EnableIf_t< UseOptimizedKernel_v<VT1,VT2,MT1> >
+   {
+      auto* data( y.data() );
+
+      for( size_t i=0UL; i<x.size(); ++i ) {
+         smvmScatter( A.begin(i), A.end(i), -x[i], data );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse vectors****************************************************
    // No special implementation for the subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -59,9 +59,12 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/SMVM.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsContiguous.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsIdentity.h>
@@ -75,6 +78,7 @@
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/views/Check.h>
 #include <blaze/system/MacroDisable.h>
+#include <blaze/system/Optimizations.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
@@ -82,6 +86,7 @@
 #include <blaze/util/MaybeUnused.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
 
 
 namespace blaze {
@@ -134,6 +139,23 @@ class TSMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the target vector is contiguous in memory, the sparse matrix operand provides
+       direct access to its compressed storage and all element types are identical built-in
+       types, the variable will be set to 1 and the optimized SMVM kernels are used. Otherwise
+       it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   static constexpr bool UseOptimizedKernel_v =
+      ( useOptimizedKernels &&
+        IsContiguous_v<T1> && HasMutableDataAccess_v<T1> &&
+        IsSMVMCompatible_v<T2> &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T2> > &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T3> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    //! Type of this TSMatDVecMultExpr instance.
@@ -366,7 +388,8 @@ class TSMatDVecMultExpr
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline auto selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> DisableIf_t< UseOptimizedKernel_v<VT1,MT1,VT2> >
    {
       for( size_t j=0UL; j<A.columns(); ++j )
       {
@@ -385,6 +408,37 @@ class TSMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMVM-based assignment to dense vectors******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMVM-based assignment of a transpose sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the serial assignment kernel for the transpose sparse matrix-dense
+   // vector multiplication based on the optimized SMVM scatter kernel. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler in
+   // case the sparse matrix operand provides direct access to its compressed storage.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> EnableIf_t< UseOptimizedKernel_v<VT1,MT1,VT2> >
+   {
+      auto* data( y.data() );
+
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         smvmScatter( A.begin(j), A.end(j), x[j], data );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse vectors****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a transpose sparse matrix-dense vector multiplication to a sparse
@@ -467,7 +521,8 @@ class TSMatDVecMultExpr
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline auto selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> DisableIf_t< UseOptimizedKernel_v<VT1,MT1,VT2> >
    {
       for( size_t j=0UL; j<A.columns(); ++j )
       {
@@ -482,6 +537,37 @@ class TSMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMVM-based addition assignment to dense vectors*********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMVM-based addition assignment of a transpose sparse matrix-dense vector
+   //        multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the serial addition assignment kernel for the transpose sparse
+   // matrix-dense vector multiplication based on the optimized SMVM scatter kernel. Due to the
+   // explicit application of the SFINAE principle, this function can only be selected by the
+   // compiler in case the sparse matrix operand provides direct access to its compressed storage.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> EnableIf_t< UseOptimizedKernel_v<VT1,MT1,VT2> >
+   {
+      auto* data( y.data() );
+
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         smvmScatter( A.begin(j), A.end(j), x[j], data );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Addition assignment to sparse vectors*******************************************************
    // No special implementation for the addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -538,7 +624,8 @@ class TSMatDVecMultExpr
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline auto selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> DisableIf_t< UseOptimizedKernel_v<VT1,MT1,VT2> >
    {
       for( size_t j=0UL; j<A.columns(); ++j )
       {
@@ -553,6 +640,37 @@ class TSMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMVM-based subtraction assignment to dense vectors******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMVM-based subtraction assignment of a transpose sparse matrix-dense vector
+   //        multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the serial subtraction assignment kernel for the transpose sparse
+   // matrix-dense vector multiplication based on the optimized SMVM scatter kernel. Due to the
+   // explicit application of the SFINAE principle, this function can only be selected by the
+   // compiler in case the sparse matrix operand provides direct access to its compressed storage.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> EnableIf_t< UseOptimizedKernel_v<VT1,MT1,VT2> >
+   {
+      auto* data( y.data() );
+
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         smvmScatter( A.begin(j), A.end(j), -x[j], data );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse vectors****************************************************
    // No special implementation for the subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -0,0 +1,709 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/BlockCodec.h
+//  \brief Block-parallel compression of serialized vectors and matrices
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SERIALIZATION_BLOCKCODEC_H_
+#define _BLAZE_MATH_SERIALIZATION_BLOCKCODEC_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <vector>
+#include <blaze/math/Exception.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Block-parallel codec for the compressed serialization of vectors and matrices.
+// \ingroup math_serialization
+//
+// The BlockCodec class implements the compressed representation of the payload of vectors and
+// matrices used by the VectorSerializer and the MatrixSerializer. A payload of \a size bytes,
+// which consists of elements of \a elementSize bytes each, is split into independent blocks of
+// approximately 1 MiB. The bytes of each block are shuffled such that the first bytes of all
+// elements are followed by the second bytes of all elements and so on, which groups the slowly
+// changing bytes of numeric values (as for instance the exponent of floating point values). The
+// shuffled block is subsequently compressed by means of a byte-oriented LZ77 codec in the style
+// of LZ4. Blocks that cannot be compressed are stored as they are. The resulting stream has the
+// following layout:
+
+   \code
+   uint64_t  blockSize          // The number of uncompressed bytes per block
+   uint64_t  sizes[blocks]      // The number of compressed bytes of each block
+   byte_t    data[...]          // The compressed blocks
+   \endcode
+
+// A block whose compressed size equals its uncompressed size is stored uncompressed. Since all
+// blocks are independent of each other, they are compressed and decompressed in parallel in
+// case shared memory parallelization is enabled (see \ref shared_memory_parallelization).
+//
+// Additionally, the BlockCodec provides the variable-length encoding of unsigned integers (LEB128)
+// that is used for the delta-encoded indices of sparse vectors and matrices.
+*/
+class BlockCodec
+{
+ private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! The nominal number of uncompressed bytes per block.
+   static constexpr size_t blockSize = 1048576UL;
+
+   //! The maximum accepted number of uncompressed bytes per block during decompression.
+   static constexpr size_t maxBlockSize = 67108864UL;
+
+   //! The minimum length of a match.
+   static constexpr size_t minMatch = 4UL;
+
+   //! The maximum distance of a match.
+   static constexpr size_t maxOffset = 65535UL;
+
+   //! The number of literals at the end of a block that are never part of a match.
+   static constexpr size_t lastLiterals = 5UL;
+
+   //! The minimum distance of the beginning of a match from the end of a block.
+   static constexpr size_t matchMargin = 12UL;
+
+   //! The number of bits of the hash values used for the match search.
+   static constexpr size_t hashBits = 14UL;
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Compression functions***********************************************************************
+   /*!\name Compression functions */
+   //@{
+   template< typename Archive, typename Fill >
+   static void compress( Archive& archive, size_t size, size_t elementSize, Fill&& fill );
+
+   template< typename Archive, typename Store >
+   static void decompress( Archive& archive, size_t size, size_t elementSize, Store&& store );
+   //@}
+   //**********************************************************************************************
+
+   //**Variable-length encoding functions**********************************************************
+   /*!\name Variable-length encoding functions */
+   //@{
+   static inline void encodeVarint( std::vector<byte_t>& buffer, uint64_t value );
+   static inline bool decodeVarint( const byte_t*& pos, const byte_t* end,
+                                    uint64_t& value ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline void shuffle  ( const byte_t* src, byte_t* dst,
+                                 size_t size, size_t width ) noexcept;
+   static inline void unshuffle( const byte_t* src, byte_t* dst,
+                                 size_t size, size_t width ) noexcept;
+
+   static inline size_t encodeBound( size_t size ) noexcept;
+   static inline size_t encodeBlock( const byte_t* src, size_t size, byte_t* dst );
+   static inline bool   decodeBlock( const byte_t* src, size_t csize,
+                                     byte_t* dst, size_t size ) noexcept;
+
+   static inline byte_t* writeLength( byte_t* dst, size_t length ) noexcept;
+   static inline bool    readLength ( const byte_t*& pos, const byte_t* end,
+                                      size_t& length ) noexcept;
+   static inline byte_t* writeSequence( byte_t* dst, const byte_t* literals, size_t number,
+                                        size_t offset, size_t length ) noexcept;
+   static inline byte_t* writeLiterals( byte_t* dst, const byte_t* literals,
+                                        size_t number ) noexcept;
+
+   static inline uint32_t load32( const byte_t* src ) noexcept;
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPRESSION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writes the given payload in compressed form to the archive.
+//
+// \param archive The archive to be written.
+// \param size The total number of bytes of the payload.
+// \param elementSize The number of bytes of a single element of the payload.
+// \param fill The function that provides the elements of the payload.
+// \return void
+//
+// This function compresses a payload of \a size bytes and writes the resulting stream to the
+// given archive. The elements of the payload are requested block by block via the given \a fill
+// function, which is called as \c fill(dst,first,count) and has to copy the \a count elements
+// starting at element \a first to the memory pointed to by \a dst. Since the blocks are
+// compressed in parallel, the \a fill function has to be safe to be called concurrently.
+*/
+template< typename Archive  // Type of the archive
+        , typename Fill >   // Type of the fill function
+void BlockCodec::compress( Archive& archive, size_t size, size_t elementSize, Fill&& fill )
+{
+   BLAZE_INTERNAL_ASSERT( elementSize > 0UL && elementSize <= blockSize, "Invalid element size" );
+   BLAZE_INTERNAL_ASSERT( size % elementSize == 0UL, "Invalid payload size" );
+
+   const size_t block ( ( blockSize / elementSize ) * elementSize );
+   const size_t blocks( ( size + block - 1UL ) / block );
+
+   std::vector< std::vector<byte_t> > buffers( blocks );
+
+   smpFor( blocks, [&]( size_t b )
+   {
+      const size_t offset( b*block );
+      const size_t bytes ( std::min( block, size - offset ) );
+
+      std::vector<byte_t> raw( 2UL*bytes );
+      byte_t* const shuffled( raw.data() + bytes );
+
+      fill( raw.data(), offset / elementSize, bytes / elementSize );
+      shuffle( raw.data(), shuffled, bytes, elementSize );
+
+      std::vector<byte_t>& buffer( buffers[b] );
+      buffer.resize( encodeBound( bytes ) );
+
+      const size_t csize( encodeBlock( shuffled, bytes, buffer.data() ) );
+
+      if( csize < bytes ) {
+         buffer.resize( csize );
+      }
+      else {
+         buffer.assign( shuffled, shuffled + bytes );
+      }
+   } );
+
+   archive << uint64_t( block );
+
+   for( size_t b=0UL; b<blocks; ++b ) {
+      archive << uint64_t( buffers[b].size() );
+   }
+
+   for( size_t b=0UL; b<blocks && archive; ++b ) {
+      archive.write( buffers[b].data(), buffers[b].size() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads a compressed payload from the archive.
+//
+// \param archive The archive to be read from.
+// \param size The total number of bytes of the payload.
+// \param elementSize The number of bytes of a single element of the payload.
+// \param store The function that consumes the elements of the payload.
+// \return void
+// \exception std::runtime_error Invalid block size detected.
+// \exception std::runtime_error Corrupt archive detected.
+//
+// This function reads a compressed stream of a payload of \a size bytes from the given archive.
+// The decompressed elements are passed block by block to the given \a store function, which is
+// called as \c store(src,first,count) with the \a count elements starting at element \a first.
+// Since the blocks are decompressed in parallel, the \a store function has to be safe to be
+// called concurrently. In case the archive fails during the read operations, the function
+// returns without any further checks. Otherwise a \a std::runtime_error is thrown in case the
+// stream is inconsistent.
+*/
+template< typename Archive  // Type of the archive
+        , typename Store >  // Type of the store function
+void BlockCodec::decompress( Archive& archive, size_t size, size_t elementSize, Store&& store )
+{
+   BLAZE_INTERNAL_ASSERT( elementSize > 0UL, "Invalid element size" );
+
+   uint64_t block( 0UL );
+
+   if( !( archive >> block ) ) return;
+
+   if( block == 0UL || block % elementSize != 0UL || block > maxBlockSize ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid block size detected" );
+   }
+
+   const size_t blocks( ( size + block - 1UL ) / block );
+
+   std::vector<uint64_t> sizes( blocks );
+   std::vector<size_t> starts( blocks+1UL, 0UL );
+
+   archive.read( sizes.data(), blocks );
+
+   if( !archive ) return;
+
+   for( size_t b=0UL; b<blocks; ++b ) {
+      if( sizes[b] > std::min<size_t>( block, size - b*block ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+      }
+      starts[b+1UL] = starts[b] + sizes[b];
+   }
+
+   std::vector<byte_t> data( starts[blocks] );
+
+   archive.read( data.data(), data.size() );
+
+   if( !archive ) return;
+
+   std::atomic<bool> corrupt( false );
+
+   smpFor( blocks, [&]( size_t b )
+   {
+      const size_t offset( b*block );
+      const size_t bytes ( std::min<size_t>( block, size - offset ) );
+
+      std::vector<byte_t> raw( 2UL*bytes );
+      byte_t* const shuffled( raw.data() + bytes );
+
+      if( sizes[b] == bytes ) {
+         std::copy( data.data() + starts[b], data.data() + starts[b+1UL], shuffled );
+      }
+      else if( !decodeBlock( data.data() + starts[b], sizes[b], shuffled, bytes ) ) {
+         corrupt = true;
+         return;
+      }
+
+      unshuffle( shuffled, raw.data(), bytes, elementSize );
+      store( raw.data(), offset / elementSize, bytes / elementSize );
+   } );
+
+   if( corrupt ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  VARIABLE-LENGTH ENCODING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Appends the variable-length encoding of the given value to the buffer.
+//
+// \param buffer The buffer to be extended.
+// \param value The value to be encoded.
+// \return void
+//
+// This function appends the given value in LEB128 format to the given buffer, i.e. in groups of
+// 7 bits, starting with the least significant group. The most significant bit of each byte is
+// set in case further bytes follow.
+*/
+inline void BlockCodec::encodeVarint( std::vector<byte_t>& buffer, uint64_t value )
+{
+   while( value >= 0x80UL ) {
+      buffer.push_back( static_cast<byte_t>( value | 0x80UL ) );
+      value >>= 7;
+   }
+
+   buffer.push_back( static_cast<byte_t>( value ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Decodes a single variable-length encoded value.
+//
+// \param pos The current position within the encoded data; advanced past the decoded value.
+// \param end The end of the encoded data.
+// \param value The decoded value.
+// \return \a true in case the value was decoded successfully, \a false in case of invalid data.
+*/
+inline bool BlockCodec::decodeVarint( const byte_t*& pos, const byte_t* end,
+                                      uint64_t& value ) noexcept
+{
+   value = 0UL;
+
+   for( size_t shift=0UL; shift<64UL && pos != end; shift+=7UL ) {
+      const byte_t byte( *pos++ );
+      value |= static_cast<uint64_t>( byte & 0x7FU ) << shift;
+      if( ( byte & 0x80U ) == 0U ) return true;
+   }
+
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Shuffles the bytes of the elements of a block.
+//
+// \param src The unshuffled block.
+// \param dst The shuffled block.
+// \param size The number of bytes of the block.
+// \param width The number of bytes of a single element.
+// \return void
+//
+// This function stores the \a j-th byte of the \a k-th element at position \a j*count+k of the
+// destination, where \a count is the number of elements in the block.
+*/
+inline void BlockCodec::shuffle( const byte_t* src, byte_t* dst,
+                                 size_t size, size_t width ) noexcept
+{
+   const size_t count( size / width );
+
+   for( size_t k=0UL; k<count; ++k ) {
+      for( size_t j=0UL; j<width; ++j ) {
+         dst[j*count+k] = src[k*width+j];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reverts the shuffling of the bytes of the elements of a block.
+//
+// \param src The shuffled block.
+// \param dst The unshuffled block.
+// \param size The number of bytes of the block.
+// \param width The number of bytes of a single element.
+// \return void
+*/
+inline void BlockCodec::unshuffle( const byte_t* src, byte_t* dst,
+                                   size_t size, size_t width ) noexcept
+{
+   const size_t count( size / width );
+
+   for( size_t k=0UL; k<count; ++k ) {
+      for( size_t j=0UL; j<width; ++j ) {
+         dst[k*width+j] = src[j*count+k];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the maximum number of compressed bytes of a block.
+//
+// \param size The number of uncompressed bytes of the block.
+// \return The maximum number of bytes written by encodeBlock().
+*/
+inline size_t BlockCodec::encodeBound( size_t size ) noexcept
+{
+   return size + size/255UL + 16UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compresses a single block.
+//
+// \param src The uncompressed block.
+// \param size The number of bytes of the uncompressed block.
+// \param dst The destination of at least encodeBound(size) bytes.
+// \return The number of compressed bytes.
+//
+// This function compresses the given block into a sequence of literal runs and back-references.
+// Each sequence starts with a token byte, whose upper four bits hold the number of literals and
+// whose lower four bits hold the length of the match minus 4. The value 15 indicates additional
+// length bytes, which are added until a byte different from 255 is encountered. The literals
+// are followed by the 16-bit little-endian distance of the match. The last sequence consists of
+// literals only. Matches are found via a hash table of the positions of 4-byte sequences.
+*/
+inline size_t BlockCodec::encodeBlock( const byte_t* src, size_t size, byte_t* dst )
+{
+   std::vector<uint32_t> table( 1UL << hashBits, 0U );
+
+   const byte_t* const end( src + size );
+   const byte_t* const matchLimit ( ( size > lastLiterals )?( end - lastLiterals ):( src ) );
+   const byte_t* const searchLimit( ( size > matchMargin  )?( end - matchMargin  ):( src ) );
+
+   const byte_t* pos   ( src );
+   const byte_t* anchor( src );
+   byte_t* out( dst );
+
+   while( pos < searchLimit )
+   {
+      const uint32_t sequence( load32( pos ) );
+      const size_t hash( ( sequence * 2654435761U ) >> ( 32UL - hashBits ) );
+      const byte_t* const candidate( src + table[hash] );
+
+      table[hash] = static_cast<uint32_t>( pos - src );
+
+      if( candidate < pos && static_cast<size_t>( pos - candidate ) <= maxOffset &&
+          load32( candidate ) == sequence )
+      {
+         size_t length( minMatch );
+         while( pos + length < matchLimit && candidate[length] == pos[length] ) {
+            ++length;
+         }
+
+         out = writeSequence( out, anchor, pos - anchor, pos - candidate, length );
+         pos += length;
+         anchor = pos;
+      }
+      else {
+         pos += 1UL + ( static_cast<size_t>( pos - anchor ) >> 6 );
+      }
+   }
+
+   out = writeLiterals( out, anchor, end - anchor );
+
+   return out - dst;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Decompresses a single block.
+//
+// \param src The compressed block.
+// \param csize The number of bytes of the compressed block.
+// \param dst The destination of the uncompressed block.
+// \param size The number of bytes of the uncompressed block.
+// \return \a true in case the block was decompressed successfully, \a false if not.
+//
+// This function reverts the compression performed by encodeBlock(). All lengths and distances
+// are checked against the bounds of the source and destination such that corrupt data results
+// in a return value of \a false instead of an out-of-bounds access.
+*/
+inline bool BlockCodec::decodeBlock( const byte_t* src, size_t csize,
+                                     byte_t* dst, size_t size ) noexcept
+{
+   const byte_t* pos( src );
+   const byte_t* const end( src + csize );
+   byte_t* out( dst );
+   byte_t* const last( dst + size );
+
+   while( pos != end )
+   {
+      const size_t token( *pos++ );
+
+      size_t number( token >> 4 );
+      if( number == 15UL && !readLength( pos, end, number ) ) return false;
+      if( number > static_cast<size_t>( end - pos ) ||
+          number > static_cast<size_t>( last - out ) ) return false;
+
+      std::copy( pos, pos + number, out );
+      pos += number;
+      out += number;
+
+      if( pos == end ) break;
+      if( end - pos < 2 ) return false;
+
+      const size_t offset( pos[0] | ( static_cast<size_t>( pos[1] ) << 8 ) );
+      pos += 2;
+
+      if( offset == 0UL || offset > static_cast<size_t>( out - dst ) ) return false;
+
+      size_t length( token & 15UL );
+      if( length == 15UL && !readLength( pos, end, length ) ) return false;
+      length += minMatch;
+
+      if( length > static_cast<size_t>( last - out ) ) return false;
+
+      const byte_t* match( out - offset );
+      for( size_t k=0UL; k<length; ++k ) {
+         out[k] = match[k];
+      }
+      out += length;
+   }
+
+   return out == last;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the additional bytes of a length of at least 15.
+//
+// \param dst The destination of the length bytes.
+// \param length The length to be written.
+// \return The position behind the written bytes.
+*/
+inline byte_t* BlockCodec::writeLength( byte_t* dst, size_t length ) noexcept
+{
+   length -= 15UL;
+
+   while( length >= 255UL ) {
+      *dst++ = 255U;
+      length -= 255UL;
+   }
+
+   *dst++ = static_cast<byte_t>( length );
+
+   return dst;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads the additional bytes of a length of at least 15.
+//
+// \param pos The current position within the compressed data; advanced past the length bytes.
+// \param end The end of the compressed data.
+// \param length The length to be extended.
+// \return \a true in case the length was read successfully, \a false in case of invalid data.
+*/
+inline bool BlockCodec::readLength( const byte_t*& pos, const byte_t* end, size_t& length ) noexcept
+{
+   byte_t byte( 0U );
+
+   do {
+      if( pos == end ) return false;
+      byte = *pos++;
+      length += byte;
+   } while( byte == 255U );
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes a sequence of literals followed by a match.
+//
+// \param dst The destination of the sequence.
+// \param literals The literals of the sequence.
+// \param number The number of literals.
+// \param offset The distance of the match.
+// \param length The length of the match.
+// \return The position behind the written sequence.
+*/
+inline byte_t* BlockCodec::writeSequence( byte_t* dst, const byte_t* literals, size_t number,
+                                          size_t offset, size_t length ) noexcept
+{
+   length -= minMatch;
+
+   byte_t* const token( dst++ );
+   *token = static_cast<byte_t>( ( std::min( number, 15UL ) << 4 ) | std::min( length, 15UL ) );
+
+   if( number >= 15UL ) {
+      dst = writeLength( dst, number );
+   }
+
+   std::copy( literals, literals + number, dst );
+   dst += number;
+
+   *dst++ = static_cast<byte_t>( offset & 0xFFUL );
+   *dst++ = static_cast<byte_t>( offset >> 8 );
+
+   if( length >= 15UL ) {
+      dst = writeLength( dst, length );
+   }
+
+   return dst;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the final sequence consisting of literals only.
+//
+// \param dst The destination of the sequence.
+// \param literals The literals of the sequence.
+// \param number The number of literals.
+// \return The position behind the written sequence.
+*/
+inline byte_t* BlockCodec::writeLiterals( byte_t* dst, const byte_t* literals,
+                                          size_t number ) noexcept
+{
+   *dst++ = static_cast<byte_t>( std::min( number, 15UL ) << 4 );
+
+   if( number >= 15UL ) {
+      dst = writeLength( dst, number );
+   }
+
+   std::copy( literals, literals + number, dst );
+
+   return dst + number;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Loads four bytes from the given unaligned position.
+//
+// \param src The position of the four bytes.
+// \return The four bytes as 32-bit unsigned integer in native byte order.
+*/
+inline uint32_t BlockCodec::load32( const byte_t* src ) noexcept
+{
+   uint32_t value;
+   std::memcpy( &value, src, sizeof( value ) );
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,537 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/Inflater.h
+//  \brief Header file for the Inflater class
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SERIALIZATION_INFLATER_H_
+#define _BLAZE_MATH_SERIALIZATION_INFLATER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstring>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Decoder for raw DEFLATE streams (RFC 1951).
+// \ingroup math_serialization
+//
+// The Inflater class decodes raw DEFLATE streams as they are stored in ZIP archives (as for
+// instance in the NumPy .npz files created by \c numpy.savez_compressed()). Stored, fixed, and
+// dynamic Huffman blocks are supported. All codes of up to \a fastBits bits are decoded by means
+// of a single table lookup, longer codes are decoded canonically. The decoder validates all
+// lengths and distances against the bounds of the source and destination such that corrupt
+// data results in an error instead of an out-of-bounds access.
+*/
+class Inflater
+{
+ public:
+   //**Decoding functions**************************************************************************
+   /*!\name Decoding functions */
+   //@{
+   static inline bool decode( const byte_t* src, size_t size, byte_t* dst, size_t capacity );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Private constants***************************************************************************
+   static constexpr size_t maxBits  = 15UL;  //!< The maximum length of a Huffman code.
+   static constexpr size_t fastBits = 10UL;  //!< The number of bits decoded by table lookup.
+   //**********************************************************************************************
+
+   //**Private struct Huffman**********************************************************************
+   /*!\brief Canonical Huffman code.
+   */
+   struct Huffman
+   {
+      uint16_t counts [maxBits+1UL];      //!< The number of codes of each length.
+      uint16_t symbols[288UL];            //!< The symbols ordered by their codes.
+      uint16_t table  [1UL << fastBits];  //!< Lookup table (symbol << 4 | length, 0 if longer).
+   };
+   //**********************************************************************************************
+
+   //**Private struct State************************************************************************
+   /*!\brief State of the decoder.
+   */
+   struct State
+   {
+      const byte_t* src;       //!< The DEFLATE stream.
+      size_t        size;      //!< The size of the DEFLATE stream in bytes.
+      size_t        pos;       //!< The position of the next byte of the stream.
+      size_t        padding;   //!< The number of zero bytes read beyond the end of the stream.
+      uint64_t      buffer;    //!< The bit buffer.
+      size_t        bits;      //!< The number of bits in the bit buffer.
+      byte_t*       dst;       //!< The decoded data.
+      size_t        capacity;  //!< The size of the decoded data in bytes.
+      size_t        out;       //!< The number of decoded bytes.
+   };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline void     refill      ( State& s ) noexcept;
+   static inline uint32_t take        ( State& s, size_t n ) noexcept;
+   static inline bool     build       ( Huffman& h, const uint8_t* lengths, size_t n ) noexcept;
+   static inline int      decodeSymbol( State& s, const Huffman& h ) noexcept;
+   static inline bool     stored      ( State& s ) noexcept;
+   static inline bool     fixed       ( State& s ) noexcept;
+   static inline bool     dynamic     ( State& s ) noexcept;
+
+   static inline bool codes( State& s, const Huffman& lencode, const Huffman& distcode ) noexcept;
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECODING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Decodes the given raw DEFLATE stream.
+//
+// \param src The DEFLATE stream.
+// \param size The size of the DEFLATE stream in bytes.
+// \param dst The destination for the decoded data.
+// \param capacity The expected size of the decoded data in bytes.
+// \return \a true in case the stream decodes to exactly \a capacity bytes, \a false if not.
+*/
+inline bool Inflater::decode( const byte_t* src, size_t size, byte_t* dst, size_t capacity )
+{
+   State s{ src, size, 0UL, 0UL, 0UL, 0UL, dst, capacity, 0UL };
+
+   bool last( false );
+
+   while( !last )
+   {
+      last = ( take( s, 1UL ) != 0U );
+
+      const uint32_t type( take( s, 2UL ) );
+      bool success( false );
+
+      if     ( type == 0U ) success = stored ( s );
+      else if( type == 1U ) success = fixed  ( s );
+      else if( type == 2U ) success = dynamic( s );
+
+      if( !success || 8UL*s.padding > s.bits ) {
+         return false;
+      }
+   }
+
+   return s.out == capacity;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Refills the bit buffer.
+//
+// \param s The state of the decoder.
+// \return void
+//
+// This function fills the bit buffer with at least 57 bits. Beyond the end of the stream zero
+// bytes are used, which are counted in order to detect truncated streams.
+*/
+inline void Inflater::refill( State& s ) noexcept
+{
+   while( s.bits <= 56UL ) {
+      if( s.pos < s.size ) s.buffer |= static_cast<uint64_t>( s.src[s.pos++] ) << s.bits;
+      else ++s.padding;
+      s.bits += 8UL;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Takes the given number of bits from the bit buffer.
+//
+// \param s The state of the decoder.
+// \param n The number of bits \f$[0..16]\f$.
+// \return The bits (the first bit of the stream in the least significant bit).
+*/
+inline uint32_t Inflater::take( State& s, size_t n ) noexcept
+{
+   if( s.bits < n ) refill( s );
+
+   const uint32_t value( static_cast<uint32_t>( s.buffer & ( ( 1ULL << n ) - 1ULL ) ) );
+   s.buffer >>= n;
+   s.bits    -= n;
+
+   return value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Builds the canonical Huffman code for the given code lengths.
+//
+// \param h The Huffman code to be built.
+// \param lengths The code lengths of all symbols.
+// \param n The number of symbols.
+// \return \a false in case the code lengths are over-subscribed, \a true if not.
+//
+// Incomplete codes are accepted, since a DEFLATE stream may contain incomplete distance codes.
+// Codes that are not assigned are rejected during decoding.
+*/
+inline bool Inflater::build( Huffman& h, const uint8_t* lengths, size_t n ) noexcept
+{
+   std::fill( h.counts, h.counts+maxBits+1UL, uint16_t( 0U ) );
+   std::fill( h.table, h.table+( 1UL << fastBits ), uint16_t( 0U ) );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      ++h.counts[lengths[k]];
+   }
+
+   h.counts[0] = 0U;
+
+   int left( 1 );
+   for( size_t len=1UL; len<=maxBits; ++len ) {
+      left = 2*left - h.counts[len];
+      if( left < 0 ) return false;
+   }
+
+   uint16_t offsets[maxBits+1UL];
+   uint32_t codes  [maxBits+1UL];
+
+   offsets[1] = 0U;
+   codes  [1] = 0U;
+   for( size_t len=1UL; len<maxBits; ++len ) {
+      offsets[len+1UL] = offsets[len] + h.counts[len];
+      codes  [len+1UL] = ( codes[len] + h.counts[len] ) << 1U;
+   }
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      const size_t len( lengths[k] );
+
+      if( len == 0UL ) continue;
+
+      h.symbols[offsets[len]++] = static_cast<uint16_t>( k );
+
+      const uint32_t code( codes[len]++ );
+
+      if( len > fastBits ) continue;
+
+      uint32_t reversed( 0U );
+      for( size_t b=0UL; b<len; ++b ) {
+         reversed |= ( ( code >> b ) & 1U ) << ( len-1UL-b );
+      }
+
+      for( uint32_t r=reversed; r<( 1U << fastBits ); r+=( 1U << len ) ) {
+         h.table[r] = static_cast<uint16_t>( ( k << 4U ) | len );
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Decodes a single symbol.
+//
+// \param s The state of the decoder.
+// \param h The Huffman code.
+// \return The decoded symbol, -1 in case of an invalid code.
+*/
+inline int Inflater::decodeSymbol( State& s, const Huffman& h ) noexcept
+{
+   if( s.bits < maxBits ) refill( s );
+
+   const uint16_t entry( h.table[s.buffer & ( ( 1ULL << fastBits ) - 1ULL )] );
+
+   if( entry != 0U ) {
+      s.buffer >>= ( entry & 15U );
+      s.bits    -= ( entry & 15U );
+      return entry >> 4U;
+   }
+
+   int code ( 0 );
+   int first( 0 );
+   int index( 0 );
+
+   for( size_t len=1UL; len<=maxBits; ++len )
+   {
+      code |= static_cast<int>( take( s, 1UL ) );
+
+      const int count( h.counts[len] );
+
+      if( code - count < first ) {
+         return h.symbols[index + ( code - first )];
+      }
+
+      index += count;
+      first += count;
+      first <<= 1;
+      code  <<= 1;
+   }
+
+   return -1;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Decodes a stored block.
+//
+// \param s The state of the decoder.
+// \return \a true in case the block could be decoded, \a false if not.
+*/
+inline bool Inflater::stored( State& s ) noexcept
+{
+   take( s, s.bits % 8UL );
+
+   const uint32_t length ( take( s, 16UL ) );
+   const uint32_t inverse( take( s, 16UL ) );
+
+   if( ( length ^ 0xFFFFU ) != inverse || length > s.capacity - s.out ) {
+      return false;
+   }
+
+   size_t remaining( length );
+
+   while( remaining > 0UL && s.bits > 8UL*s.padding ) {
+      s.dst[s.out++] = static_cast<byte_t>( take( s, 8UL ) );
+      --remaining;
+   }
+
+   if( remaining > s.size - s.pos ) {
+      return false;
+   }
+
+   std::memcpy( s.dst + s.out, s.src + s.pos, remaining );
+   s.out += remaining;
+   s.pos += remaining;
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Decodes the literals and matches of a Huffman block.
+//
+// \param s The state of the decoder.
+// \param lencode The literal/length code.
+// \param distcode The distance code.
+// \return \a true in case the block could be decoded, \a false if not.
+*/
+inline bool Inflater::codes( State& s, const Huffman& lencode, const Huffman& distcode ) noexcept
+{
+   static constexpr uint16_t lengthBase[29] = {
+      3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+      35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+   static constexpr uint8_t lengthExtra[29] = {
+      0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+   static constexpr uint16_t distBase[30] = {
+      1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769,
+      1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+   static constexpr uint8_t distExtra[30] = {
+      0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12,
+      13, 13 };
+
+   while( true )
+   {
+      int symbol( decodeSymbol( s, lencode ) );
+
+      if( symbol < 0 || 8UL*s.padding > s.bits ) {
+         return false;
+      }
+      else if( symbol < 256 ) {
+         if( s.out == s.capacity ) return false;
+         s.dst[s.out++] = static_cast<byte_t>( symbol );
+      }
+      else if( symbol == 256 ) {
+         return true;
+      }
+      else {
+         symbol -= 257;
+         if( symbol >= 29 ) return false;
+
+         const size_t length( lengthBase[symbol] + take( s, lengthExtra[symbol] ) );
+
+         symbol = decodeSymbol( s, distcode );
+         if( symbol < 0 || symbol >= 30 ) return false;
+
+         const size_t dist( distBase[symbol] + take( s, distExtra[symbol] ) );
+
+         if( dist > s.out || length > s.capacity - s.out ) {
+            return false;
+         }
+
+         const byte_t* from( s.dst + s.out - dist );
+         byte_t* to( s.dst + s.out );
+
+         for( size_t k=0UL; k<length; ++k ) {
+            to[k] = from[k];
+         }
+
+         s.out += length;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Decodes a block with fixed Huffman codes.
+//
+// \param s The state of the decoder.
+// \return \a true in case the block could be decoded, \a false if not.
+*/
+inline bool Inflater::fixed( State& s ) noexcept
+{
+   uint8_t lengths[288];
+
+   std::fill( lengths      , lengths+144, uint8_t( 8U ) );
+   std::fill( lengths + 144, lengths+256, uint8_t( 9U ) );
+   std::fill( lengths + 256, lengths+280, uint8_t( 7U ) );
+   std::fill( lengths + 280, lengths+288, uint8_t( 8U ) );
+
+   Huffman lencode, distcode;
+   build( lencode, lengths, 288UL );
+
+   std::fill( lengths, lengths+30, uint8_t( 5U ) );
+   build( distcode, lengths, 30UL );
+
+   return codes( s, lencode, distcode );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Decodes a block with dynamic Huffman codes.
+//
+// \param s The state of the decoder.
+// \return \a true in case the block could be decoded, \a false if not.
+*/
+inline bool Inflater::dynamic( State& s ) noexcept
+{
+   static constexpr uint8_t order[19] = {
+      16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+   const size_t nlen ( take( s, 5UL ) + 257UL );
+   const size_t ndist( take( s, 5UL ) + 1UL );
+   const size_t ncode( take( s, 4UL ) + 4UL );
+
+   if( nlen > 286UL || ndist > 30UL ) {
+      return false;
+   }
+
+   uint8_t lengths[320] = {};
+
+   for( size_t k=0UL; k<ncode; ++k ) {
+      lengths[order[k]] = static_cast<uint8_t>( take( s, 3UL ) );
+   }
+
+   Huffman lencode, distcode;
+
+   if( !build( lencode, lengths, 19UL ) ) {
+      return false;
+   }
+
+   for( size_t k=0UL; k<nlen+ndist; )
+   {
+      const int symbol( decodeSymbol( s, lencode ) );
+
+      if( symbol < 0 ) {
+         return false;
+      }
+      else if( symbol < 16 ) {
+         lengths[k++] = static_cast<uint8_t>( symbol );
+         continue;
+      }
+
+      uint8_t length( 0U );
+      size_t  repeat( 0UL );
+
+      if( symbol == 16 ) {
+         if( k == 0UL ) return false;
+         length = lengths[k-1UL];
+         repeat = 3UL + take( s, 2UL );
+      }
+      else if( symbol == 17 ) {
+         repeat = 3UL + take( s, 3UL );
+      }
+      else {
+         repeat = 11UL + take( s, 7UL );
+      }
+
+      if( k + repeat > nlen + ndist ) {
+         return false;
+      }
+
+      std::fill( lengths+k, lengths+k+repeat, length );
+      k += repeat;
+   }
+
+   if( lengths[256] == 0U ||
+       !build( lencode, lengths, nlen ) || !build( distcode, lengths+nlen, ndist ) ) {
+      return false;
+   }
+
+   return codes( s, lencode, distcode );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,894 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/MappedArchive.h
+//  \brief Header file for the MappedArchive class
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SERIALIZATION_MAPPEDARCHIVE_H_
+#define _BLAZE_MATH_SERIALIZATION_MAPPEDARCHIVE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <istream>
+#include <streambuf>
+#include <string>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/CustomVector.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/serialization/MatrixSerializer.h>
+#include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/serialization/VectorSerializer.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/serialization/Archive.h>
+#include <blaze/util/serialization/MappedFile.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Read-only archive on top of a memory-mapped file.
+// \ingroup math_serialization
+//
+// The MappedArchive class maps a file containing serialized vectors and matrices (see the
+// Archive, VectorSerializer, and MatrixSerializer classes) into memory. Dense vectors and
+// matrices can be reconstituted as CustomVector and CustomMatrix instances, which are bound
+// directly to the mapped file contents, i.e. without copying any element. Thus loading is
+// independent of the size of the file and all processes mapping the same file share the same
+// physical pages:
+
+   \code
+   using blaze::unaligned;
+   using blaze::unpadded;
+   using blaze::rowMajor;
+
+   // Creating the archive by mapping the file "weights.blaze" into memory
+   blaze::MappedArchive archive( "weights.blaze" );
+
+   // Binding the first two serialized matrices and the subsequent vector to the mapped file
+   blaze::CustomMatrix<const float,unaligned,unpadded,rowMajor> W1, W2;
+   blaze::CustomVector<const float,unaligned,unpadded> b;
+   archive >> W1 >> W2 >> b;
+   \endcode
+
+// In order to be bound to the mapped file, the serialized vector or matrix has to be dense and
+// has to have the element type of the custom vector or matrix. Additionally the storage order
+// of a serialized matrix has to match the storage order of the custom matrix. Since version 3
+// of the format the payload of all vectors and matrices starts at a 64-byte boundary and the
+// rows (or columns) are padded to a multiple of 64 bytes. Therefore aligned and padded custom
+// vectors and matrices can be bound directly. In archives of version 1 and 2 the payload is
+// neither aligned nor padded. In this case a padded custom vector or matrix can only be bound
+// in case its size (number of columns for row-major matrices, number of rows for column-major
+// matrices) is a multiple of the SIMD width, and an aligned custom vector or matrix can only be
+// bound in case the payload happens to be properly aligned. Any other kind of vector or matrix
+// is reconstituted by means of the regular deserialization, which copies the elements out of
+// the mapped file.
+//
+// In case indexing has been enabled for the archive (see Archive::setIndexing()) and the archive
+// has been finalized by means of the Archive::writeIndex() function, the MappedArchive provides
+// random access to all serialized objects. Additionally, it is possible to read a range of rows
+// of a row-major matrix without touching any other part of the file:
+
+   \code
+   // Writing three matrices and the object index
+   {
+      blaze::Archive<std::ofstream> archive( "matrices.blaze", std::ofstream::trunc );
+      archive.setIndexing( true );
+      archive << A << B << C;
+      archive.writeIndex();
+   }
+
+   // Reading rows 100 to 199 of the third matrix
+   {
+      blaze::MappedArchive archive( "matrices.blaze" );
+      blaze::DynamicMatrix<double,rowMajor> rows;
+      archive.seekObject( 2UL );
+      archive.readRows( rows, 100UL, 100UL );
+   }
+   \endcode
+
+// Row ranges can be read from row-major dense matrices of any version of the format and from
+// row-major sparse matrices in version 3 of the format, whose row pointers are stored in the
+// archive.
+//
+// The file is mapped copy-on-write: pages are shared with other processes as long as they are
+// only read, and modifications of bound vectors and matrices are private to the process and
+// never written back to the file. The mapping is released when the archive is destroyed. Thus
+// all custom vectors and matrices bound to the archive must not be used beyond the lifetime of
+// the archive.
+*/
+class MappedArchive
+   : private NonCopyable
+{
+ private:
+   //**Private class MappedBuffer******************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Stream buffer on top of the mapped memory.
+   //
+   // The MappedBuffer provides the mapped memory as the get area of a stream buffer. It is used
+   // to run the regular deserialization directly on the mapped file contents.
+   */
+   struct MappedBuffer
+      : public std::streambuf
+   {
+      MappedBuffer( byte_t* begin, byte_t* end ) {
+         char* ptr( reinterpret_cast<char*>( begin ) );
+         setg( ptr, ptr, ptr + ( end - begin ) );
+      }
+
+      size_t consumed() const { return static_cast<size_t>( gptr() - eback() ); }
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MappedArchive( const std::string& filename );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size      () const noexcept;
+   inline size_t position  () const noexcept;
+   inline void   seek      ( size_t pos );
+   inline size_t objects   () const noexcept;
+   inline void   seekObject( size_t index );
+   //@}
+   //**********************************************************************************************
+
+   //**Deserialization functions*******************************************************************
+   /*!\name Deserialization functions */
+   //@{
+   template< typename Type, AlignmentFlag AF, PaddingFlag PF, bool TF, typename Tag, typename RT >
+   MappedArchive& operator>>( CustomVector<Type,AF,PF,TF,Tag,RT>& vec );
+
+   template< typename Type, AlignmentFlag AF, PaddingFlag PF, bool SO, typename Tag, typename RT >
+   MappedArchive& operator>>( CustomMatrix<Type,AF,PF,SO,Tag,RT>& mat );
+
+   template< typename T >
+   MappedArchive& operator>>( T& value );
+
+   template< typename MT, bool SO >
+   void readRows( Matrix<MT,SO>& mat, size_t row, size_t m ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename T >
+   inline T get( size_t pos ) const noexcept;
+
+   template< typename Type >
+   Type* payload( size_t pos, uint64_t number ) const;
+
+   template< typename Type >
+   void checkElementType( size_t pos ) const;
+
+   inline void readIndex() noexcept;
+
+   template< typename Type, AlignmentFlag AF, bool TF, typename Tag, typename RT >
+   static void bind( CustomVector<Type,AF,unpadded,TF,Tag,RT>& vec,
+                     Type* ptr, size_t n, size_t nn );
+
+   template< typename Type, AlignmentFlag AF, bool TF, typename Tag, typename RT >
+   static void bind( CustomVector<Type,AF,padded,TF,Tag,RT>& vec,
+                     Type* ptr, size_t n, size_t nn );
+
+   template< typename ET >
+   void readDenseRows( DynamicMatrix<ET,rowMajor>& tmp, size_t row, size_t m ) const;
+
+   template< typename ET >
+   void readSparseRows( CompressedMatrix<ET,rowMajor>& tmp, size_t row, size_t m ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MappedFile file_;     //!< The mapped file.
+   byte_t*    data_;     //!< The first byte of the mapped file.
+   size_t     size_;     //!< The size of the mapped file in bytes.
+   size_t     pos_;      //!< The current read position within the mapped file.
+   size_t     objects_;  //!< The number of objects in the object index.
+   size_t     index_;    //!< The position of the object index within the mapped file.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creating an archive by mapping the given file into memory.
+//
+// \param filename The name of the file to be mapped.
+// \exception std::runtime_error File could not be mapped.
+//
+// In case the file ends with an object index (see Archive::writeIndex()), the index is made
+// available via the objects() and seekObject() functions.
+*/
+inline MappedArchive::MappedArchive( const std::string& filename )
+   : file_   ( filename )      // The mapped file
+   , data_   ( file_.data() )  // The first byte of the mapped file
+   , size_   ( file_.size() )  // The size of the mapped file in bytes
+   , pos_    ( 0UL )           // The current read position within the mapped file
+   , objects_( 0UL )           // The number of objects in the object index
+   , index_  ( 0UL )           // The position of the object index within the mapped file
+{
+   readIndex();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the size of the mapped file.
+//
+// \return The size of the mapped file in bytes.
+*/
+inline size_t MappedArchive::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current read position within the mapped file.
+//
+// \return The current read position in bytes from the beginning of the file.
+*/
+inline size_t MappedArchive::position() const noexcept
+{
+   return pos_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the read position within the mapped file.
+//
+// \param pos The new read position in bytes from the beginning of the file.
+// \return void
+// \exception std::invalid_argument Invalid read position.
+//
+// This function sets the position of the next object to be deserialized. The position is
+// expected to be the start of a serialized object, which can for instance be determined by
+// means of the position() function during a previous pass over the file.
+*/
+inline void MappedArchive::seek( size_t pos )
+{
+   if( pos > size_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid read position" );
+   }
+
+   pos_ = pos;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of objects in the object index of the mapped file.
+//
+// \return The number of indexed objects, or 0 in case the file does not contain an index.
+*/
+inline size_t MappedArchive::objects() const noexcept
+{
+   return objects_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the read position to the given object of the mapped file.
+//
+// \param index The index of the object \f$[0..objects())\f$.
+// \return void
+// \exception std::invalid_argument Invalid object index.
+// \exception std::runtime_error Corrupt archive index detected.
+//
+// This function sets the read position to the beginning of the object with the given index,
+// i.e. to the \a index-th object that has been written to the archive. It requires the file to
+// contain an object index (see Archive::writeIndex()).
+*/
+inline void MappedArchive::seekObject( size_t index )
+{
+   if( index >= objects_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid object index" );
+   }
+
+   const uint64_t pos( get<uint64_t>( index_ + index*sizeof( uint64_t ) ) );
+
+   if( pos >= index_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive index detected" );
+   }
+
+   pos_ = pos;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Locates the object index at the end of the mapped file.
+//
+// \return void
+//
+// This function checks whether the mapped file ends with an object index. An index consists of
+// the offsets of all objects, followed by the number of objects and the \c archiveIndexTag. In
+// case no (or an inconsistent) index is found, the file is treated as a file without index.
+*/
+inline void MappedArchive::readIndex() noexcept
+{
+   constexpr size_t trailerSize( 2UL*sizeof( uint64_t ) );
+
+   if( size_ < trailerSize || get<uint64_t>( size_-sizeof( uint64_t ) ) != archiveIndexTag ) {
+      return;
+   }
+
+   const uint64_t number( get<uint64_t>( size_-trailerSize ) );
+
+   if( number > ( size_-trailerSize ) / sizeof( uint64_t ) ) {
+      return;
+   }
+
+   objects_ = number;
+   index_   = size_ - trailerSize - number*sizeof( uint64_t );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads a value of built-in data type from the given position of the mapped file.
+//
+// \param pos The position of the value in bytes from the beginning of the file.
+// \return The value at the given position.
+*/
+template< typename T >  // Type of the value
+inline T MappedArchive::get( size_t pos ) const noexcept
+{
+   T value{};
+   std::memcpy( &value, data_ + pos, sizeof( T ) );
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the element type and element size of a serialized vector or matrix.
+//
+// \param pos The position of the header in bytes from the beginning of the file.
+// \return void
+// \exception std::runtime_error Invalid element type or element size detected.
+*/
+template< typename Type >  // Data type of the elements
+void MappedArchive::checkElementType( size_t pos ) const
+{
+   using ET = RemoveConst_t<Type>;
+
+   if( get<uint8_t>( pos+2UL ) != TypeValueMapping<ET>::value ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element type detected" );
+   }
+   else if( get<uint8_t>( pos+3UL ) != sizeof( ET ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element size detected" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a pointer to the elements of a dense payload within the mapped file.
+//
+// \param pos The position of the payload in bytes from the beginning of the file.
+// \param number The number of elements of the payload.
+// \return Pointer to the first element of the payload.
+// \exception std::runtime_error Corrupt archive detected.
+// \exception std::runtime_error Invalid payload alignment detected.
+*/
+template< typename Type >  // Data type of the elements
+Type* MappedArchive::payload( size_t pos, uint64_t number ) const
+{
+   if( number > ( size_ - pos ) / sizeof( Type ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+
+   if( reinterpret_cast<size_t>( data_ + pos ) % alignof( Type ) != 0UL ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid payload alignment detected" );
+   }
+
+   return reinterpret_cast<Type*>( data_ + pos );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Binds the given unpadded custom vector to the given array of elements.
+//
+// \param vec The custom vector to be bound.
+// \param ptr The array of elements.
+// \param n The number of elements.
+// \param nn The total number of elements including padding (ignored).
+// \return void
+// \exception std::invalid_argument Invalid setup of custom vector.
+*/
+template< typename Type     // Data type of the vector
+        , AlignmentFlag AF  // Alignment flag
+        , bool TF           // Transpose flag
+        , typename Tag      // Type tag
+        , typename RT >     // Result type
+void MappedArchive::bind( CustomVector<Type,AF,unpadded,TF,Tag,RT>& vec,
+                          Type* ptr, size_t n, size_t nn )
+{
+   MAYBE_UNUSED( nn );
+
+   vec.reset( ptr, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Binds the given padded custom vector to the given array of elements.
+//
+// \param vec The custom vector to be bound.
+// \param ptr The array of elements.
+// \param n The number of elements.
+// \param nn The total number of elements including padding.
+// \return void
+// \exception std::invalid_argument Invalid setup of custom vector.
+*/
+template< typename Type     // Data type of the vector
+        , AlignmentFlag AF  // Alignment flag
+        , bool TF           // Transpose flag
+        , typename Tag      // Type tag
+        , typename RT >     // Result type
+void MappedArchive::bind( CustomVector<Type,AF,padded,TF,Tag,RT>& vec,
+                          Type* ptr, size_t n, size_t nn )
+{
+   vec.reset( ptr, n, nn );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies a range of rows of a serialized row-major dense matrix.
+//
+// \param tmp The matrix for the copied rows.
+// \param row The index of the first row.
+// \param m The number of rows.
+// \return void
+// \exception std::runtime_error Corrupt archive detected.
+// \exception std::runtime_error Invalid spacing detected.
+*/
+template< typename ET >  // Type of the elements
+void MappedArchive::readDenseRows( DynamicMatrix<ET,rowMajor>& tmp, size_t row, size_t m ) const
+{
+   const uint8_t  version( get<uint8_t>( pos_ ) );
+   const uint64_t rows   ( get<uint64_t>( pos_+ 4UL ) );
+   const uint64_t columns( get<uint64_t>( pos_+12UL ) );
+
+   uint64_t spacing( columns );
+   uint64_t offset ( 4UL + 3UL*sizeof( uint64_t ) );
+
+   if( version > 2U ) {
+      if( size_ - pos_ < offset + 2UL*sizeof( uint64_t ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+      }
+      spacing = get<uint64_t>( pos_+28UL );
+      offset  = get<uint64_t>( pos_+36UL );
+   }
+
+   if( spacing < columns ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid spacing detected" );
+   }
+
+   if( offset > size_ - pos_ ||
+       ( spacing != 0UL && rows > ( size_ - pos_ - offset ) / sizeof( ET ) / spacing ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+
+   tmp.resize( m, columns, false );
+
+   const byte_t* first( data_ + pos_ + offset + row*spacing*sizeof( ET ) );
+
+   for( size_t i=0UL; i<m && columns != 0UL; ++i ) {
+      std::memcpy( tmp.data(i), first + i*spacing*sizeof( ET ), columns*sizeof( ET ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies a range of rows of a serialized row-major sparse matrix.
+//
+// \param tmp The matrix for the copied rows.
+// \param row The index of the first row.
+// \param m The number of rows.
+// \return void
+// \exception std::runtime_error Corrupt archive detected.
+// \exception std::runtime_error Invalid number of elements detected.
+// \exception std::runtime_error Invalid element index detected.
+//
+// This function uses the row pointers of the serialized matrix to access the non-zero elements
+// of the given rows. Therefore only the pointers, indices, and values of the requested rows are
+// touched.
+*/
+template< typename ET >  // Type of the elements
+void MappedArchive::readSparseRows( CompressedMatrix<ET,rowMajor>& tmp, size_t row, size_t m ) const
+{
+   if( size_ - pos_ < 4UL + 6UL*sizeof( uint64_t ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+
+   const uint64_t rows    ( get<uint64_t>( pos_+ 4UL ) );
+   const uint64_t columns ( get<uint64_t>( pos_+12UL ) );
+   const uint64_t number  ( get<uint64_t>( pos_+20UL ) );
+   const uint64_t pointers( get<uint64_t>( pos_+28UL ) );
+   const uint64_t indices ( get<uint64_t>( pos_+36UL ) );
+   const uint64_t values  ( get<uint64_t>( pos_+44UL ) );
+   const size_t   bytes   ( size_ - pos_ );
+
+   if( values > bytes || number > ( bytes - values ) / sizeof( ET ) ||
+       indices > values || number > ( values - indices ) / sizeof( uint64_t ) ||
+       pointers > indices || rows >= ( indices - pointers ) / sizeof( uint64_t ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+
+   const size_t pointerPos( pos_ + pointers + row*sizeof( uint64_t ) );
+   const size_t indexPos  ( pos_ + indices );
+   const size_t valuePos  ( pos_ + values );
+
+   const uint64_t begin( get<uint64_t>( pointerPos ) );
+   const uint64_t end  ( get<uint64_t>( pointerPos + m*sizeof( uint64_t ) ) );
+
+   if( begin > end || end > number ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
+   }
+
+   tmp.resize( m, columns, false );
+   tmp.reserve( end - begin );
+
+   uint64_t first( begin );
+
+   for( size_t i=0UL; i<m; ++i )
+   {
+      const uint64_t last( get<uint64_t>( pointerPos + ( i+1UL )*sizeof( uint64_t ) ) );
+
+      if( last < first || last > end ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
+      }
+
+      for( uint64_t k=first; k<last; ++k ) {
+         const uint64_t index( get<uint64_t>( indexPos + k*sizeof( uint64_t ) ) );
+         if( index >= columns ) {
+            BLAZE_THROW_RUNTIME_ERROR( "Invalid element index detected" );
+         }
+         tmp.append( i, index, get<ET>( valuePos + k*sizeof( ET ) ) );
+      }
+
+      tmp.finalize( i );
+      first = last;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESERIALIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Binds the given custom vector to the next serialized vector in the mapped file.
+//
+// \param vec The custom vector to be bound to the mapped file.
+// \return Reference to the archive.
+// \exception std::runtime_error Error during deserialization.
+// \exception std::invalid_argument Invalid alignment or padding of the serialized vector.
+//
+// This function binds the given custom vector to the elements of the next serialized vector
+// without copying any element. The serialized vector must be a dense vector with the element
+// type of the custom vector. In case of a padded custom vector, the padding elements of the
+// serialized vector are used as padding of the custom vector.
+*/
+template< typename Type     // Data type of the vector
+        , AlignmentFlag AF  // Alignment flag
+        , PaddingFlag PF    // Padding flag
+        , bool TF           // Transpose flag
+        , typename Tag      // Type tag
+        , typename RT >     // Result type
+MappedArchive& MappedArchive::operator>>( CustomVector<Type,AF,PF,TF,Tag,RT>& vec )
+{
+   constexpr size_t headerSize( 4UL + 2UL*sizeof( uint64_t ) );
+
+   if( size_ - pos_ < headerSize ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+
+   const uint8_t version( get<uint8_t>( pos_ ) );
+
+   if( version < 1U || version > 3U ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid version detected" );
+   }
+   else if( get<uint8_t>( pos_+1UL ) != 0U ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid vector type detected" );
+   }
+
+   checkElementType<Type>( pos_ );
+
+   const uint64_t n( get<uint64_t>( pos_+4UL ) );
+
+   uint64_t spacing( n );
+   uint64_t offset ( headerSize );
+
+   if( version == 3U ) {
+      if( size_ - pos_ < headerSize + 2UL*sizeof( uint64_t ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+      }
+      spacing = get<uint64_t>( pos_+20UL );
+      offset  = get<uint64_t>( pos_+28UL );
+   }
+
+   if( spacing < n || offset > size_ - pos_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+
+   bind( vec, payload<Type>( pos_+offset, spacing ), n, spacing );
+
+   pos_ += offset + spacing*sizeof( Type );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Binds the given custom matrix to the next serialized matrix in the mapped file.
+//
+// \param mat The custom matrix to be bound to the mapped file.
+// \return Reference to the archive.
+// \exception std::runtime_error Error during deserialization.
+// \exception std::invalid_argument Invalid alignment or padding of the serialized matrix.
+//
+// This function binds the given custom matrix to the elements of the next serialized matrix
+// without copying any element. The serialized matrix must be a dense matrix with the element
+// type and the storage order of the custom matrix. The spacing of the custom matrix is the
+// spacing of the serialized matrix, i.e. for archives of version 3 the padding elements of the
+// serialized matrix are used as padding of the custom matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , AlignmentFlag AF  // Alignment flag
+        , PaddingFlag PF    // Padding flag
+        , bool SO           // Storage order
+        , typename Tag      // Type tag
+        , typename RT >     // Result type
+MappedArchive& MappedArchive::operator>>( CustomMatrix<Type,AF,PF,SO,Tag,RT>& mat )
+{
+   constexpr size_t headerSize( 4UL + 3UL*sizeof( uint64_t ) );
+
+   if( size_ - pos_ < headerSize ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+
+   const uint8_t version( get<uint8_t>( pos_ ) );
+
+   if( version < 1U || version > 3U ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid version detected" );
+   }
+   else if( get<uint8_t>( pos_+1UL ) != ( SO == rowMajor ? 1U : 5U ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid matrix type detected" );
+   }
+
+   checkElementType<Type>( pos_ );
+
+   const uint64_t m( get<uint64_t>( pos_+ 4UL ) );
+   const uint64_t n( get<uint64_t>( pos_+12UL ) );
+
+   const uint64_t major( SO == rowMajor ? m : n );
+   const uint64_t minor( SO == rowMajor ? n : m );
+
+   uint64_t spacing( minor );
+   uint64_t offset ( headerSize );
+
+   if( version == 3U ) {
+      if( size_ - pos_ < headerSize + 2UL*sizeof( uint64_t ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+      }
+      spacing = get<uint64_t>( pos_+28UL );
+      offset  = get<uint64_t>( pos_+36UL );
+   }
+
+   if( spacing < minor || offset > size_ - pos_ ||
+       ( spacing != 0UL && major > ( size_ - pos_ - offset ) / spacing ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+
+   mat.reset( payload<Type>( pos_+offset, major*spacing ), m, n, spacing );
+
+   pos_ += offset + major*spacing*sizeof( Type );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes the next object in the mapped file.
+//
+// \param value The object to be deserialized.
+// \return Reference to the archive.
+// \exception std::runtime_error Error during deserialization.
+//
+// This function deserializes the next object in the mapped file by means of the regular
+// deserialization process, i.e. by copying the serialized data into the given object.
+*/
+template< typename T >  // Type of the object
+MappedArchive& MappedArchive::operator>>( T& value )
+{
+   MappedBuffer buffer( data_ + pos_, data_ + size_ );
+   std::istream stream( &buffer );
+   Archive<std::istream> archive( stream );
+
+   if( !( archive >> value ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+
+   pos_ += buffer.consumed();
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads a range of rows of the serialized matrix at the current read position.
+//
+// \param mat The matrix for the rows to be read.
+// \param row The index of the first row to be read.
+// \param m The number of rows to be read.
+// \return void
+// \exception std::invalid_argument Invalid row range.
+// \exception std::runtime_error Error during deserialization.
+//
+// This function copies the \a m rows starting at row \a row of the serialized matrix at the
+// current read position into the given matrix, which is resized accordingly. Only the part of
+// the mapped file that contains the requested rows is accessed. The serialized matrix must be
+// a row-major dense matrix or a row-major sparse matrix in version 3 of the format and must
+// have the element type of the given matrix. In contrast to the deserialization operators the
+// function does not change the read position, which allows to read several ranges of rows of
+// the same matrix.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+void MappedArchive::readRows( Matrix<MT,SO>& mat, size_t row, size_t m ) const
+{
+   using ET = ElementType_t<MT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ET );
+
+   constexpr size_t headerSize( 4UL + 3UL*sizeof( uint64_t ) );
+
+   if( size_ - pos_ < headerSize ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+
+   const uint8_t version( get<uint8_t>( pos_ ) );
+   const uint8_t type   ( get<uint8_t>( pos_+1UL ) );
+
+   if( version < 1U || version > 3U ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid version detected" );
+   }
+   else if( type != 1U && ( type != 3U || version != 3U ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid matrix type detected" );
+   }
+
+   checkElementType<ET>( pos_ );
+
+   const uint64_t rows( get<uint64_t>( pos_+4UL ) );
+
+   if( row > rows || m > rows - row ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid row range" );
+   }
+
+   if( type == 1U ) {
+      DynamicMatrix<ET,rowMajor> tmp;
+      readDenseRows( tmp, row, m );
+      (*mat) = tmp;
+   }
+   else {
+      CompressedMatrix<ET,rowMajor> tmp;
+      readSparseRows( tmp, row, m );
+      (*mat) = tmp;
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
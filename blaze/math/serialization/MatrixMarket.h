@@ -0,0 +1,1301 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/MatrixMarket.h
+//  \brief Header file for the Matrix Market file format
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SERIALIZATION_MATRIXMARKET_H_
+#define _BLAZE_MATH_SERIALIZATION_MATRIXMARKET_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsHermitian.h>
+#include <blaze/math/typetraits/IsRestricted.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/serialization/MappedFile.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+#include <blaze/util/typetraits/IsSigned.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS MATRIXMARKETREADER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parser for files in the Matrix Market exchange format.
+// \ingroup math_serialization
+//
+// The MatrixMarketReader class implements the readMatrixMarket() function. The file is mapped
+// into memory and the part following the size line is split into chunks of complete lines,
+// which are parsed in parallel (see \ref shared_memory_parallelization). Coordinate files are
+// parsed into one list of entries per chunk. The entries are subsequently sorted into the rows
+// (or columns) of a compressed sparse row (or column) structure, which is appended to a sparse
+// matrix without any insertion. Array files are parsed directly into the elements of a dense
+// matrix, since the position of every value follows from the number of values in all preceding
+// chunks.
+*/
+class MatrixMarketReader
+   : private NonCopyable
+{
+ private:
+   //**Enumerations********************************************************************************
+   //! The format of the stored matrix.
+   enum Format { coordinate, array };
+
+   //! The type of the stored values.
+   enum Field { realField, complexField, integerField, patternField };
+
+   //! The symmetry of the stored matrix.
+   enum Symmetry { general, symmetric, skewSymmetric, hermitian };
+
+   //! The result of parsing a chunk.
+   enum Error { noError, invalidFormat, invalidIndex };
+   //**********************************************************************************************
+
+   //**Private constants***************************************************************************
+   static constexpr size_t chunkSize = 1048576UL;  //!< The minimum size of a chunk in bytes.
+   //**********************************************************************************************
+
+   //**Private struct Entries**********************************************************************
+   /*!\brief The entries of a chunk of a coordinate file.
+   */
+   template< typename ET >  // Type of the elements
+   struct Entries
+   {
+      std::vector<size_t> rows;     //!< The row indices of all entries.
+      std::vector<size_t> columns;  //!< The column indices of all entries.
+      std::vector<ET>     values;   //!< The values of all entries.
+      Error               error;    //!< The result of parsing the chunk.
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MatrixMarketReader( const std::string& filename );
+   //@}
+   //**********************************************************************************************
+
+   //**Read functions******************************************************************************
+   /*!\name Read functions */
+   //@{
+   template< typename MT, bool SO >
+   void read( Matrix<MT,SO>& mat );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Header functions****************************************************************************
+   /*!\name Header functions */
+   //@{
+   inline void parseHeader();
+   inline std::vector<const char*> split() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Parse functions*****************************************************************************
+   /*!\name Parse functions */
+   //@{
+   static inline const char* skipBlanks( const char* pos, const char* end ) noexcept;
+   static inline bool isLineEnd( const char* pos, const char* end ) noexcept;
+   static inline std::string parseWord( const char*& pos, const char* end );
+   static inline bool parseIndex( const char*& pos, const char* end, size_t& index ) noexcept;
+
+   template< typename T >
+   static inline bool parseNumber( const char*& pos, const char* end, T& value ) noexcept;
+
+   template< typename ET >
+   inline bool parseValue( const char*& pos, const char* end, ET& value ) const noexcept;
+
+   template< typename ET >
+   static inline bool parseComplex( const char*& pos, const char* end, ET& value, TrueType );
+
+   template< typename ET >
+   static inline bool parseComplex( const char*& pos, const char* end, ET& value, FalseType );
+
+   template< typename ET >
+   inline ET mirror( const ET& value ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Coordinate functions************************************************************************
+   /*!\name Coordinate functions */
+   //@{
+   template< typename ET >
+   void parseEntries( const char* pos, const char* end, Entries<ET>& entries ) const;
+
+   template< typename MT, bool SO >
+   void readCoordinate( Matrix<MT,SO>& mat );
+
+   template< typename MT, bool SO, typename ET >
+   void assemble( DenseMatrix<MT,SO>& mat, const std::vector< Entries<ET> >& chunks ) const;
+
+   template< typename MT, bool SO, typename ET >
+   void assemble( SparseMatrix<MT,SO>& mat, const std::vector< Entries<ET> >& chunks ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Array functions*****************************************************************************
+   /*!\name Array functions */
+   //@{
+   inline size_t countValues( const char* pos, const char* end ) const noexcept;
+
+   template< typename MT >
+   Error parseValues( const char* pos, const char* end, size_t index, MT& mat ) const;
+
+   template< typename MT, bool SO >
+   void readArray( Matrix<MT,SO>& mat );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MappedFile  file_;      //!< The mapped Matrix Market file.
+   const char* first_;     //!< The first character following the size line.
+   const char* last_;      //!< One past the last character of the file.
+   Format      format_;    //!< The format of the stored matrix.
+   Field       field_;     //!< The type of the stored values.
+   Symmetry    symmetry_;  //!< The symmetry of the stored matrix.
+   size_t      rows_;      //!< The number of rows of the stored matrix.
+   size_t      columns_;   //!< The number of columns of the stored matrix.
+   size_t      number_;    //!< The number of stored entries.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Maps the given Matrix Market file into memory and parses its header.
+//
+// \param filename The name of the Matrix Market file.
+// \exception std::runtime_error File could not be mapped.
+// \exception std::runtime_error Invalid file format detected.
+*/
+inline MatrixMarketReader::MatrixMarketReader( const std::string& filename )
+   : file_    ( filename )    // The mapped Matrix Market file
+   , first_   ( nullptr )     // The first character following the size line
+   , last_    ( nullptr )     // One past the last character of the file
+   , format_  ( coordinate )  // The format of the stored matrix
+   , field_   ( realField )   // The type of the stored values
+   , symmetry_( general )     // The symmetry of the stored matrix
+   , rows_    ( 0UL )         // The number of rows of the stored matrix
+   , columns_ ( 0UL )         // The number of columns of the stored matrix
+   , number_  ( 0UL )         // The number of stored entries
+{
+   parseHeader();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HEADER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Parses the banner, the comments, and the size line of the Matrix Market file.
+//
+// \return void
+// \exception std::runtime_error Invalid file format detected.
+*/
+inline void MatrixMarketReader::parseHeader()
+{
+   const char* pos( reinterpret_cast<const char*>( file_.data() ) );
+   last_ = pos + file_.size();
+
+   const std::string banner( "%%MatrixMarket" );
+
+   if( static_cast<size_t>( last_ - pos ) < banner.size() ||
+       !std::equal( banner.begin(), banner.end(), pos ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid file format detected" );
+   }
+
+   pos += banner.size();
+
+   const std::string object  ( parseWord( pos, last_ ) );
+   const std::string format  ( parseWord( pos, last_ ) );
+   const std::string field   ( parseWord( pos, last_ ) );
+   const std::string symmetry( parseWord( pos, last_ ) );
+
+   if( object != "matrix" || !isLineEnd( pos, last_ ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid file format detected" );
+   }
+
+   if     ( format == "coordinate" ) format_ = coordinate;
+   else if( format == "array"      ) format_ = array;
+   else BLAZE_THROW_RUNTIME_ERROR( "Invalid file format detected" );
+
+   if     ( field == "real" || field == "double" ) field_ = realField;
+   else if( field == "complex" ) field_ = complexField;
+   else if( field == "integer" ) field_ = integerField;
+   else if( field == "pattern" && format_ == coordinate ) field_ = patternField;
+   else BLAZE_THROW_RUNTIME_ERROR( "Invalid file format detected" );
+
+   if     ( symmetry == "general"        ) symmetry_ = general;
+   else if( symmetry == "symmetric"      ) symmetry_ = symmetric;
+   else if( symmetry == "skew-symmetric" ) symmetry_ = skewSymmetric;
+   else if( symmetry == "hermitian"      ) symmetry_ = hermitian;
+   else BLAZE_THROW_RUNTIME_ERROR( "Invalid file format detected" );
+
+   // Skipping the comments and empty lines in front of the size line
+   while( pos != last_ ) {
+      pos = std::find( pos, last_, '\n' );
+      if( pos != last_ ) ++pos;
+      const char* const next( skipBlanks( pos, last_ ) );
+      if( next != last_ && *next != '%' && *next != '\n' ) break;
+   }
+
+   // Parsing the size line
+   if( !parseIndex( pos, last_, rows_ ) || !parseIndex( pos, last_, columns_ ) ||
+       ( format_ == coordinate && !parseIndex( pos, last_, number_ ) ) ||
+       !isLineEnd( pos, last_ ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid file format detected" );
+   }
+
+   if( symmetry_ != general && rows_ != columns_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid file format detected" );
+   }
+
+   first_ = std::find( pos, last_, '\n' );
+   if( first_ != last_ ) ++first_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Splits the data of the Matrix Market file into chunks of complete lines.
+//
+// \return The boundaries of all chunks (the first chunk starts at the first and ends at the
+//         second boundary, etc.).
+*/
+inline std::vector<const char*> MatrixMarketReader::split() const
+{
+   const size_t bytes ( static_cast<size_t>( last_ - first_ ) );
+   const size_t chunks( std::max( bytes / chunkSize, size_t( 1UL ) ) );
+
+   std::vector<const char*> bounds( chunks+1UL, last_ );
+   bounds[0] = first_;
+
+   for( size_t c=1UL; c<chunks; ++c ) {
+      const char* const pos( std::max( first_ + c*( bytes / chunks ), bounds[c-1UL] ) );
+      bounds[c] = std::find( pos, last_, '\n' );
+      if( bounds[c] != last_ ) ++bounds[c];
+   }
+
+   return bounds;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PARSE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Skips all blanks (spaces, tabs, and carriage returns).
+//
+// \param pos The current position.
+// \param end The end of the chunk.
+// \return The first position that is not a blank.
+*/
+inline const char* MatrixMarketReader::skipBlanks( const char* pos, const char* end ) noexcept
+{
+   while( pos != end && ( *pos == ' ' || *pos == '\t' || *pos == '\r' ) ) ++pos;
+   return pos;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks whether only blanks remain in the current line.
+//
+// \param pos The current position.
+// \param end The end of the chunk.
+// \return \a true in case the rest of the line is blank, \a false if not.
+*/
+inline bool MatrixMarketReader::isLineEnd( const char* pos, const char* end ) noexcept
+{
+   pos = skipBlanks( pos, end );
+   return pos == end || *pos == '\n';
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parses the next word of the current line and converts it to lower case.
+//
+// \param pos The current position (updated to the end of the word).
+// \param end The end of the chunk.
+// \return The parsed word.
+*/
+inline std::string MatrixMarketReader::parseWord( const char*& pos, const char* end )
+{
+   pos = skipBlanks( pos, end );
+
+   std::string word;
+   for( ; pos != end && !std::isspace( static_cast<unsigned char>( *pos ) ); ++pos ) {
+      word += static_cast<char>( std::tolower( static_cast<unsigned char>( *pos ) ) );
+   }
+
+   return word;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parses the next non-negative integral value of the current line.
+//
+// \param pos The current position (updated to the end of the value).
+// \param end The end of the chunk.
+// \param index The parsed value.
+// \return \a true in case a valid value has been parsed, \a false if not.
+*/
+inline bool
+   MatrixMarketReader::parseIndex( const char*& pos, const char* end, size_t& index ) noexcept
+{
+   pos = skipBlanks( pos, end );
+
+   const char* const first( pos );
+   index = 0UL;
+
+   for( ; pos != end && *pos >= '0' && *pos <= '9'; ++pos ) {
+      if( index > ( std::numeric_limits<size_t>::max() - 9UL ) / 10UL ) return false;
+      index = index*10UL + static_cast<size_t>( *pos - '0' );
+   }
+
+   return pos != first && ( pos == end || std::isspace( static_cast<unsigned char>( *pos ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parses the next floating point or integral number of the current line.
+//
+// \param pos The current position (updated to the end of the number).
+// \param end The end of the chunk.
+// \param value The parsed number.
+// \return \a true in case a valid number has been parsed, \a false if not.
+//
+// The number is copied into a zero-terminated buffer, since the mapped file is not terminated.
+*/
+template< typename T >  // Type of the number (double or long long)
+inline bool MatrixMarketReader::parseNumber( const char*& pos, const char* end, T& value ) noexcept
+{
+   pos = skipBlanks( pos, end );
+
+   char token[128];
+   size_t length( 0UL );
+
+   for( ; pos != end && !std::isspace( static_cast<unsigned char>( *pos ) ); ++pos ) {
+      if( length == sizeof( token ) - 1UL ) return false;
+      token[length++] = *pos;
+   }
+
+   token[length] = '\0';
+
+   char* stop( nullptr );
+   value = IsIntegral_v<T> ? static_cast<T>( std::strtoll( token, &stop, 10 ) )
+                           : static_cast<T>( std::strtod( token, &stop ) );
+
+   return length > 0UL && stop == token + length;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parses the next value of the current line.
+//
+// \param pos The current position (updated to the end of the value).
+// \param end The end of the chunk.
+// \param value The parsed value.
+// \return \a true in case a valid value has been parsed, \a false if not.
+*/
+template< typename ET >  // Type of the elements
+inline bool
+   MatrixMarketReader::parseValue( const char*& pos, const char* end, ET& value ) const noexcept
+{
+   switch( field_ )
+   {
+      case realField: {
+         double number{};
+         if( !parseNumber( pos, end, number ) ) return false;
+         value = static_cast<ET>( number );
+         return true;
+      }
+      case integerField: {
+         long long number{};
+         if( !parseNumber( pos, end, number ) ) return false;
+         value = static_cast<ET>( number );
+         return true;
+      }
+      case complexField:
+         return parseComplex( pos, end, value, BoolConstant< IsComplex_v<ET> >() );
+      default:
+         value = ET( 1 );
+         return true;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parses the next complex value of the current line.
+//
+// \param pos The current position (updated to the end of the value).
+// \param end The end of the chunk.
+// \param value The parsed value.
+// \return \a true in case a valid value has been parsed, \a false if not.
+*/
+template< typename ET >  // Type of the elements
+inline bool MatrixMarketReader::parseComplex( const char*& pos, const char* end,
+                                              ET& value, TrueType )
+{
+   using BT = UnderlyingBuiltin_t<ET>;
+
+   double real{}, imag{};
+
+   if( !parseNumber( pos, end, real ) || !parseNumber( pos, end, imag ) ) {
+      return false;
+   }
+
+   value = ET( static_cast<BT>( real ), static_cast<BT>( imag ) );
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Rejects a complex value for a real element type.
+//
+// \param pos The current position.
+// \param end The end of the chunk.
+// \param value The value.
+// \return \a false since a complex value cannot be represented by a real element type.
+*/
+template< typename ET >  // Type of the elements
+inline bool MatrixMarketReader::parseComplex( const char*& pos, const char* end,
+                                              ET& value, FalseType )
+{
+   MAYBE_UNUSED( pos, end, value );
+
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the value of the mirrored element of a symmetric, skew-symmetric, or Hermitian
+//        matrix.
+//
+// \param value The value of the stored element.
+// \return The value of the mirrored element.
+*/
+template< typename ET >  // Type of the elements
+inline ET MatrixMarketReader::mirror( const ET& value ) const
+{
+   if( symmetry_ == skewSymmetric ) return -value;
+   if( symmetry_ == hermitian     ) return conj( value );
+   return value;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COORDINATE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Parses the entries of a chunk of a coordinate file.
+//
+// \param pos The beginning of the chunk.
+// \param end The end of the chunk.
+// \param entries The parsed entries (zero-based indices).
+// \return void
+*/
+template< typename ET >  // Type of the elements
+void MatrixMarketReader::parseEntries( const char* pos, const char* end,
+                                       Entries<ET>& entries ) const
+{
+   entries.error = noError;
+
+   while( pos != end )
+   {
+      pos = skipBlanks( pos, end );
+
+      if( pos == end ) break;
+
+      if( *pos == '\n' || *pos == '%' ) {
+         pos = std::find( pos, end, '\n' );
+         if( pos != end ) ++pos;
+         continue;
+      }
+
+      size_t i( 0UL ), j( 0UL );
+      ET value{};
+
+      if( !parseIndex( pos, end, i ) || !parseIndex( pos, end, j ) ||
+          !parseValue( pos, end, value ) || !isLineEnd( pos, end ) ) {
+         entries.error = invalidFormat;
+         return;
+      }
+
+      if( i == 0UL || i > rows_ || j == 0UL || j > columns_ ) {
+         entries.error = invalidIndex;
+         return;
+      }
+
+      entries.rows.push_back( i-1UL );
+      entries.columns.push_back( j-1UL );
+      entries.values.push_back( value );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads a coordinate file into the given matrix.
+//
+// \param mat The target matrix.
+// \return void
+// \exception std::runtime_error Invalid file format detected.
+// \exception std::runtime_error Invalid element index detected.
+// \exception std::runtime_error Invalid number of elements detected.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+void MatrixMarketReader::readCoordinate( Matrix<MT,SO>& mat )
+{
+   using ET = ElementType_t<MT>;
+
+   const std::vector<const char*> bounds( split() );
+   std::vector< Entries<ET> > chunks( bounds.size()-1UL );
+
+   smpFor( chunks.size(), [&]( size_t c )
+   {
+      parseEntries( bounds[c], bounds[c+1UL], chunks[c] );
+   } );
+
+   size_t number( 0UL );
+
+   for( const Entries<ET>& entries : chunks ) {
+      if( entries.error == invalidFormat ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid file format detected" );
+      }
+      else if( entries.error == invalidIndex ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid element index detected" );
+      }
+      number += entries.values.size();
+   }
+
+   if( number != number_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
+   }
+
+   assemble( *mat, chunks );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assembles a dense matrix from the parsed entries of a coordinate file.
+//
+// \param mat The target matrix.
+// \param chunks The parsed entries of all chunks.
+// \return void
+//
+// Duplicate entries are summed up. In case the target matrix is restricted (as for instance a
+// symmetric matrix), the entries are assembled in a temporary matrix, which is subsequently
+// assigned.
+*/
+template< typename MT    // Type of the matrix
+        , bool SO        // Storage order
+        , typename ET >  // Type of the elements
+void MatrixMarketReader::assemble( DenseMatrix<MT,SO>& mat,
+                                   const std::vector< Entries<ET> >& chunks ) const
+{
+   if( IsRestricted_v<MT> ) {
+      DynamicMatrix<ET,SO> tmp;
+      assemble( tmp, chunks );
+      (*mat) = tmp;
+      return;
+   }
+
+   resize( *mat, rows_, columns_, false );
+   reset( *mat );
+
+   for( const Entries<ET>& entries : chunks ) {
+      for( size_t k=0UL; k<entries.values.size(); ++k ) {
+         const size_t i( entries.rows[k] );
+         const size_t j( entries.columns[k] );
+         (*mat)(i,j) += entries.values[k];
+         if( symmetry_ != general && i != j ) {
+            (*mat)(j,i) += mirror( entries.values[k] );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assembles a sparse matrix from the parsed entries of a coordinate file.
+//
+// \param mat The target matrix.
+// \param chunks The parsed entries of all chunks.
+// \return void
+//
+// The entries are sorted into a compressed sparse row (for row-major matrices) or compressed
+// sparse column (for column-major matrices) structure by means of a counting sort. The rows
+// (or columns) are sorted in parallel and are subsequently appended to the matrix. Duplicate
+// entries are summed up. In case the target matrix is restricted (as for instance a symmetric
+// matrix), the entries are appended to a temporary matrix, which is subsequently assigned.
+*/
+template< typename MT    // Type of the matrix
+        , bool SO        // Storage order
+        , typename ET >  // Type of the elements
+void MatrixMarketReader::assemble( SparseMatrix<MT,SO>& mat,
+                                   const std::vector< Entries<ET> >& chunks ) const
+{
+   if( IsRestricted_v<MT> ) {
+      CompressedMatrix<ET,SO> tmp;
+      assemble( tmp, chunks );
+      (*mat) = tmp;
+      return;
+   }
+
+   const bool   mirrored( symmetry_ != general );
+   const size_t m( SO == rowMajor ? rows_ : columns_ );
+
+   // Counting the entries per row/column
+   std::vector<size_t> pointers( m+1UL, 0UL );
+
+   for( const Entries<ET>& entries : chunks ) {
+      for( size_t k=0UL; k<entries.values.size(); ++k ) {
+         const size_t i( SO == rowMajor ? entries.rows[k] : entries.columns[k] );
+         const size_t j( SO == rowMajor ? entries.columns[k] : entries.rows[k] );
+         ++pointers[i+1UL];
+         if( mirrored && i != j ) ++pointers[j+1UL];
+      }
+   }
+
+   for( size_t i=0UL; i<m; ++i ) {
+      pointers[i+1UL] += pointers[i];
+   }
+
+   // Sorting the entries into their rows/columns
+   std::vector< ValueIndexPair<ET> > elements( pointers[m] );
+   std::vector<size_t> next( pointers.begin(), pointers.end()-1L );
+
+   for( const Entries<ET>& entries : chunks ) {
+      for( size_t k=0UL; k<entries.values.size(); ++k ) {
+         const size_t i( SO == rowMajor ? entries.rows[k] : entries.columns[k] );
+         const size_t j( SO == rowMajor ? entries.columns[k] : entries.rows[k] );
+         elements[next[i]++] = ValueIndexPair<ET>( entries.values[k], j );
+         if( mirrored && i != j ) {
+            elements[next[j]++] = ValueIndexPair<ET>( mirror( entries.values[k] ), i );
+         }
+      }
+   }
+
+   // Sorting the elements of all rows/columns
+   const size_t lines ( std::max( chunkSize / 256UL, size_t( 1UL ) ) );
+   const size_t blocks( ( m + lines - 1UL ) / lines );
+
+   smpFor( blocks, [&]( size_t block )
+   {
+      for( size_t i=block*lines; i<std::min( m, ( block+1UL )*lines ); ++i ) {
+         std::sort( elements.begin()+pointers[i], elements.begin()+pointers[i+1UL],
+                    []( const ValueIndexPair<ET>& a, const ValueIndexPair<ET>& b ) {
+                       return a.index() < b.index();
+                    } );
+      }
+   } );
+
+   // Appending the elements to the sparse matrix
+   resize( *mat, rows_, columns_, false );
+   (*mat).reserve( pointers[m] );
+   reset( *mat );
+
+   for( size_t i=0UL; i<m; ++i )
+   {
+      for( size_t k=pointers[i]; k<pointers[i+1UL]; )
+      {
+         const size_t j( elements[k].index() );
+         ET value( elements[k].value() );
+
+         for( ++k; k<pointers[i+1UL] && elements[k].index() == j; ++k ) {
+            value += elements[k].value();
+         }
+
+         if( SO == rowMajor ) (*mat).append( i, j, value, false );
+         else                 (*mat).append( j, i, value, false );
+      }
+
+      (*mat).finalize( i );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ARRAY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Counts the values in a chunk of an array file.
+//
+// \param pos The beginning of the chunk.
+// \param end The end of the chunk.
+// \return The number of lines containing a value.
+*/
+inline size_t MatrixMarketReader::countValues( const char* pos, const char* end ) const noexcept
+{
+   size_t number( 0UL );
+
+   while( pos != end )
+   {
+      pos = skipBlanks( pos, end );
+
+      if( pos != end && *pos != '\n' && *pos != '%' ) {
+         ++number;
+      }
+
+      pos = std::find( pos, end, '\n' );
+      if( pos != end ) ++pos;
+   }
+
+   return number;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parses the values of a chunk of an array file directly into the given dense matrix.
+//
+// \param pos The beginning of the chunk.
+// \param end The end of the chunk.
+// \param index The index of the first value of the chunk.
+// \param mat The target dense matrix.
+// \return The result of parsing the chunk.
+//
+// The values of an array file are stored in column-major order. For symmetric and Hermitian
+// matrices only the lower triangular part (including the diagonal) is stored, for skew-symmetric
+// matrices only the strictly lower triangular part is stored.
+*/
+template< typename MT >  // Type of the dense matrix
+MatrixMarketReader::Error
+   MatrixMarketReader::parseValues( const char* pos, const char* end, size_t index, MT& mat ) const
+{
+   using ET = ElementType_t<MT>;
+
+   const size_t m( rows_ );
+   const size_t offset( symmetry_ == skewSymmetric ? 1UL : 0UL );
+
+   // Determining the position of the first value
+   size_t i( 0UL ), j( 0UL );
+
+   if( symmetry_ == general ) {
+      i = ( m > 0UL ? index % m : 0UL );
+      j = ( m > 0UL ? index / m : 0UL );
+   }
+   else {
+      while( j < columns_ && index >= m - j - offset ) {
+         index -= m - j - offset;
+         ++j;
+      }
+      i = j + offset + index;
+   }
+
+   while( pos != end )
+   {
+      pos = skipBlanks( pos, end );
+
+      if( pos == end ) break;
+
+      if( *pos == '\n' || *pos == '%' ) {
+         pos = std::find( pos, end, '\n' );
+         if( pos != end ) ++pos;
+         continue;
+      }
+
+      ET value{};
+
+      if( !parseValue( pos, end, value ) || !isLineEnd( pos, end ) ) {
+         return invalidFormat;
+      }
+
+      mat(i,j) = value;
+
+      if( symmetry_ != general && i != j ) {
+         mat(j,i) = mirror( value );
+      }
+
+      if( ++i == m ) {
+         ++j;
+         i = ( symmetry_ == general ? 0UL : j + offset );
+      }
+   }
+
+   return noError;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads an array file into the given matrix.
+//
+// \param mat The target matrix.
+// \return void
+// \exception std::runtime_error Invalid file format detected.
+// \exception std::runtime_error Invalid number of elements detected.
+//
+// In a first parallel pass the values of every chunk are counted. In a second parallel pass the
+// values are parsed directly into the target matrix. In case the target matrix is not a dense,
+// unrestricted matrix, the values are parsed into a temporary dense matrix, which is
+// subsequently assigned.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+void MatrixMarketReader::readArray( Matrix<MT,SO>& mat )
+{
+   using ET = ElementType_t<MT>;
+
+   if( !IsDenseMatrix_v<MT> || IsRestricted_v<MT> ) {
+      DynamicMatrix<ET,SO> tmp;
+      readArray( tmp );
+      (*mat) = tmp;
+      return;
+   }
+
+   const std::vector<const char*> bounds( split() );
+   const size_t chunks( bounds.size()-1UL );
+
+   std::vector<size_t> starts( chunks+1UL, 0UL );
+
+   smpFor( chunks, [&]( size_t c )
+   {
+      starts[c+1UL] = countValues( bounds[c], bounds[c+1UL] );
+   } );
+
+   for( size_t c=0UL; c<chunks; ++c ) {
+      starts[c+1UL] += starts[c];
+   }
+
+   if( rows_ != 0UL && columns_ > std::numeric_limits<size_t>::max() / rows_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
+   }
+
+   const size_t n( rows_ );
+   const size_t expected( symmetry_ == general       ? rows_ * columns_
+                        : symmetry_ == skewSymmetric ? n*( n > 0UL ? n-1UL : 0UL ) / 2UL
+                        :                              n*( n+1UL ) / 2UL );
+
+   if( starts[chunks] != expected ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
+   }
+
+   resize( *mat, rows_, columns_, false );
+   reset( *mat );
+
+   std::vector<Error> errors( chunks, noError );
+
+   smpFor( chunks, [&]( size_t c )
+   {
+      errors[c] = parseValues( bounds[c], bounds[c+1UL], starts[c], *mat );
+   } );
+
+   if( std::find( errors.begin(), errors.end(), invalidFormat ) != errors.end() ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid file format detected" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  READ FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reads the Matrix Market file into the given matrix.
+//
+// \param mat The target matrix.
+// \return void
+// \exception std::runtime_error Invalid element type detected.
+// \exception std::runtime_error Error while reading the file.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+void MatrixMarketReader::read( Matrix<MT,SO>& mat )
+{
+   using ET = ElementType_t<MT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ET );
+
+   if( field_ == complexField && !IsComplex_v<ET> ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element type detected" );
+   }
+
+   if( format_ == coordinate ) readCoordinate( *mat );
+   else                        readArray( *mat );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX MARKET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the Matrix Market field of the given element type.
+// \ingroup math_serialization
+//
+// \return The Matrix Market field.
+*/
+template< typename ET >  // Type of the elements
+inline const char* matrixMarketField() noexcept
+{
+   return IsComplex_v<ET>  ? "complex"
+        : IsIntegral_v<ET> ? "integer"
+        :                    "real";
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes a real element to a Matrix Market file.
+// \ingroup math_serialization
+//
+// \param os The output stream.
+// \param value The element to be written.
+// \return void
+*/
+template< typename ET >  // Type of the element
+inline DisableIf_t< IsComplex_v<ET> > writeMatrixMarketValue( std::ostream& os, const ET& value )
+{
+   os << value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes a complex element to a Matrix Market file.
+// \ingroup math_serialization
+//
+// \param os The output stream.
+// \param value The element to be written.
+// \return void
+*/
+template< typename ET >  // Type of the element
+inline EnableIf_t< IsComplex_v<ET> > writeMatrixMarketValue( std::ostream& os, const ET& value )
+{
+   os << value.real() << ' ' << value.imag();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the elements of a dense matrix in the array format.
+// \ingroup math_serialization
+//
+// \param os The output stream.
+// \param mat The dense matrix to be written.
+// \param lower \a true in case only the lower triangular part is written, \a false if not.
+// \return void
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+void writeMatrixMarketElements( std::ostream& os, const DenseMatrix<MT,SO>& mat, bool lower )
+{
+   for( size_t j=0UL; j<(*mat).columns(); ++j ) {
+      for( size_t i=( lower ? j : 0UL ); i<(*mat).rows(); ++i ) {
+         writeMatrixMarketValue( os, (*mat)(i,j) );
+         os << '\n';
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the non-zero elements of a row-major sparse matrix in the coordinate format.
+// \ingroup math_serialization
+//
+// \param os The output stream.
+// \param mat The sparse matrix to be written.
+// \param lower \a true in case only the lower triangular part is written, \a false if not.
+// \return void
+*/
+template< typename MT >  // Type of the sparse matrix
+void writeMatrixMarketElements( std::ostream& os, const SparseMatrix<MT,rowMajor>& mat,
+                                bool lower )
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<(*mat).rows(); ++i ) {
+      for( auto element=(*mat).begin(i); element!=(*mat).end(i); ++element ) {
+         if( !lower || element->index() <= i ) ++nonzeros;
+      }
+   }
+
+   os << (*mat).rows() << ' ' << (*mat).columns() << ' ' << nonzeros << '\n';
+
+   for( size_t i=0UL; i<(*mat).rows(); ++i ) {
+      for( auto element=(*mat).begin(i); element!=(*mat).end(i); ++element ) {
+         if( lower && element->index() > i ) continue;
+         os << i+1UL << ' ' << element->index()+1UL << ' ';
+         writeMatrixMarketValue( os, element->value() );
+         os << '\n';
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the non-zero elements of a column-major sparse matrix in the coordinate format.
+// \ingroup math_serialization
+//
+// \param os The output stream.
+// \param mat The sparse matrix to be written.
+// \param lower \a true in case only the lower triangular part is written, \a false if not.
+// \return void
+*/
+template< typename MT >  // Type of the sparse matrix
+void writeMatrixMarketElements( std::ostream& os, const SparseMatrix<MT,columnMajor>& mat,
+                                bool lower )
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t j=0UL; j<(*mat).columns(); ++j ) {
+      for( auto element=(*mat).begin(j); element!=(*mat).end(j); ++element ) {
+         if( !lower || element->index() >= j ) ++nonzeros;
+      }
+   }
+
+   os << (*mat).rows() << ' ' << (*mat).columns() << ' ' << nonzeros << '\n';
+
+   for( size_t j=0UL; j<(*mat).columns(); ++j ) {
+      for( auto element=(*mat).begin(j); element!=(*mat).end(j); ++element ) {
+         if( lower && element->index() < j ) continue;
+         os << element->index()+1UL << ' ' << j+1UL << ' ';
+         writeMatrixMarketValue( os, element->value() );
+         os << '\n';
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads a matrix from a file in the Matrix Market exchange format.
+// \ingroup math_serialization
+//
+// \param filename The name of the Matrix Market file.
+// \param mat The target matrix.
+// \return void
+// \exception std::runtime_error File could not be mapped.
+// \exception std::runtime_error Invalid file format detected.
+// \exception std::runtime_error Invalid element type detected.
+// \exception std::runtime_error Invalid element index detected.
+// \exception std::runtime_error Invalid number of elements detected.
+// \exception std::invalid_argument Matrix cannot be resized.
+//
+// This function reads a matrix stored in the Matrix Market exchange format
+// (see https://math.nist.gov/MatrixMarket/formats.html) into the given dense or sparse matrix.
+// Both the coordinate and the array format are supported, as are the real, integer, complex,
+// and pattern fields and the general, symmetric, skew-symmetric, and Hermitian symmetries.
+// For symmetric, skew-symmetric, and Hermitian files the stored triangular part is mirrored.
+// Duplicate entries of coordinate files are summed up.
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+   blaze::readMatrixMarket( "matrix.mtx", A );
+   \endcode
+
+// The file is mapped into memory and parsed in parallel (see \ref shared_memory_parallelization).
+// Sparse matrices are assembled by appending the sorted rows (or columns) without any insertion.
+// In case the file cannot be read, the file content is invalid or the file contains complex
+// values and the element type of the matrix is not complex, a \a std::runtime_error exception
+// is thrown. In case the given matrix cannot be resized to the size of the stored matrix or the
+// stored matrix violates the invariants of a restricted matrix (as for instance a symmetric
+// matrix), a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+void readMatrixMarket( const std::string& filename, Matrix<MT,SO>& mat )
+{
+   MatrixMarketReader reader( filename );
+   reader.read( *mat );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes a matrix to a file in the Matrix Market exchange format.
+// \ingroup math_serialization
+//
+// \param filename The name of the Matrix Market file.
+// \param mat The matrix to be written.
+// \return void
+// \exception std::runtime_error File could not be written.
+//
+// This function writes the given matrix to a file in the Matrix Market exchange format. Dense
+// matrices are written in the array format, sparse matrices in the coordinate format. Complex
+// element types result in the complex field, integral element types in the integer field and
+// all other element types in the real field. For symmetric and Hermitian matrices (see
+// \ref adaptors) only the lower triangular part is written. Floating point values are written
+// with the precision required to restore them exactly.
+
+   \code
+   blaze::SymmetricMatrix< blaze::CompressedMatrix<double> > A;
+   // ... Resizing and initialization
+   blaze::writeMatrixMarket( "matrix.mtx", A );
+   \endcode
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+void writeMatrixMarket( const std::string& filename, const Matrix<MT,SO>& mat )
+{
+   using ET = ElementType_t<MT>;
+   using BT = UnderlyingBuiltin_t<ET>;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ET );
+
+   const bool lower( IsSymmetric_v<MT> || IsHermitian_v<MT> );
+
+   std::ofstream os( filename.c_str(), std::ofstream::out | std::ofstream::trunc );
+
+   os.precision( std::numeric_limits<BT>::max_digits10 );
+
+   os << "%%MatrixMarket matrix "
+      << ( IsDenseMatrix_v<MT> ? "array " : "coordinate " )
+      << matrixMarketField<ET>()
+      << ( !lower ? " general" : IsSymmetric_v<MT> ? " symmetric" : " hermitian" )
+      << '\n';
+
+   if( IsDenseMatrix_v<MT> ) {
+      os << (*mat).rows() << ' ' << (*mat).columns() << '\n';
+   }
+
+   writeMatrixMarketElements( os, *mat, lower );
+
+   if( !os ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be written" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
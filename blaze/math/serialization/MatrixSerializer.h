@@ -40,20 +40,30 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Matrix.h>
 #include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/serialization/BlockCodec.h>
 #include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/shims/NextMultiple.h>
 #include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsContiguous.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/MaybeUnused.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 
@@ -153,6 +163,27 @@ namespace blaze {
 //
 // In case an error is encountered during (de-)serialization, a \a std::runtime_exception is
 // thrown.
+//
+// Matrices are written in version 3 of the format. In this format the payload of each matrix
+// starts at a 64-byte boundary relative to the beginning of the archive. The rows (or columns in
+// case of column-major matrices) of dense matrices with numeric elements are padded with zeros
+// to a multiple of 64 bytes. Sparse matrices are stored in compressed row (or column) format,
+// i.e. as the array of row pointers, followed by the array of all indices and the array of all
+// values, each of which again starts at a 64-byte boundary. The spacing of dense matrices and
+// the offsets of all payload arrays are stored in the header, which enables a direct access to
+// the data of a matrix (see for instance the MappedArchive class). Archives written in version 1
+// (index/value pairs) or version 2 (blocks of indices and values per row) of the format can
+// still be deserialized.
+//
+// In case compression is enabled for the archive (see Archive::setCompression()), matrices with
+// numeric elements are written in compressed format instead, which is marked by an additional
+// type flag in the header. The elements of dense matrices are compressed in storage order. For
+// sparse matrices the number of non-zero elements per row (or column) and the distances between
+// consecutive indices are stored as variable-length integers, followed by the values of all
+// non-zero elements. Both parts are compressed in independent blocks by the BlockCodec, which
+// allows a parallel compression and decompression. Compressed matrices are detected and
+// decompressed automatically during deserialization, but cannot be accessed directly via the
+// MappedArchive class.
 */
 class MatrixSerializer
 {
@@ -169,6 +200,7 @@ class MatrixSerializer
       0x01 - Vector/Matrix flag
       0x02 - Dense/Sparse flag
       0x04 - Row-/Column-major flag
+      0x08 - Compression flag
       \endcode
    */
    template< bool IsDenseMatrix, bool IsRowMajorMatrix >
@@ -193,6 +225,22 @@ class MatrixSerializer
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! The maximum number of sparse matrix elements that are buffered for a single block write.
+   static constexpr size_t blockSize = 1024UL;
+
+   //! The alignment in bytes of the payload of a matrix in version 3 of the format.
+   static constexpr size_t alignment = 64UL;
+
+   //! The size in bytes of the header of a dense matrix in version 3 of the format.
+   static constexpr size_t denseHeaderSize = 44UL;
+
+   //! The size in bytes of the header of a sparse matrix in version 3 of the format.
+   static constexpr size_t sparseHeaderSize = 52UL;
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Constructors********************************************************************************
    /*!\name Constructors */
@@ -225,10 +273,47 @@ class MatrixSerializer
    void serializeHeader( Archive& archive, const MT& mat );
 
    template< typename Archive, typename MT, bool SO >
-   void serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat );
+   DisableIf_t< IsContiguous_v<MT> && HasConstDataAccess_v<MT> && IsNumeric_v< ElementType_t<MT> > >
+      serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   EnableIf_t< IsContiguous_v<MT> && HasConstDataAccess_v<MT> && IsNumeric_v< ElementType_t<MT> > >
+      serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat );
 
    template< typename Archive, typename MT, bool SO >
    void serializeMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   void serializeSparsePointers( Archive& archive, const SparseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   void serializeSparseIndices( Archive& archive, const SparseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   EnableIf_t< IsNumeric_v< ElementType_t<MT> > >
+      serializeSparseValues( Archive& archive, const SparseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   DisableIf_t< IsNumeric_v< ElementType_t<MT> > >
+      serializeSparseValues( Archive& archive, const SparseMatrix<MT,SO>& mat );
+
+   template< typename Archive >
+   void serializePadding( Archive& archive, size_t bytes );
+
+   template< typename Archive, typename MT >
+   DisableIf_t< IsNumeric_v< ElementType_t<MT> > >
+      serializeCompressed( Archive& archive, const MT& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   EnableIf_t< IsNumeric_v< ElementType_t<MT> > >
+      serializeCompressed( Archive& archive, const DenseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   EnableIf_t< IsNumeric_v< ElementType_t<MT> > >
+      serializeCompressed( Archive& archive, const SparseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT >
+   void serializeCompressedHeader( Archive& archive, const MT& mat );
    //@}
    //**********************************************************************************************
 
@@ -250,6 +335,21 @@ class MatrixSerializer
    template< typename Archive, typename MT >
    void deserializeMatrix( Archive& archive, MT& mat );
 
+   template< typename Archive >
+   void deserializeSparseStructure( Archive& archive );
+
+   template< typename Archive, typename ET >
+   void deserializeSparseElements( Archive& archive, size_t i, size_t dim,
+                                   DynamicVector<uint64_t>& indices, DynamicVector<ET>& values );
+
+   template< typename Archive, typename ET >
+   EnableIf_t< IsNumeric_v<ET> >
+      deserializeSparseValues( Archive& archive, DynamicVector<ET>& values );
+
+   template< typename Archive, typename ET >
+   DisableIf_t< IsNumeric_v<ET> >
+      deserializeSparseValues( Archive& archive, DynamicVector<ET>& values );
+
    template< typename Archive, typename MT >
    EnableIf_t< MT::simdEnabled >
       deserializeDenseRowMatrix( Archive& archive, DenseMatrix<MT,rowMajor>& mat );
@@ -297,6 +397,54 @@ class MatrixSerializer
 
    template< typename Archive, typename MT >
    void deserializeSparseColumnMatrix( Archive& archive, SparseMatrix<MT,columnMajor>& mat );
+
+   template< typename Archive >
+   void skipPadding( Archive& archive, size_t bytes );
+
+   template< typename Archive, typename MT >
+   DisableIf_t< IsNumeric_v< ElementType_t<MT> > >
+      deserializeCompressed( Archive& archive, MT& mat );
+
+   template< typename Archive, typename MT >
+   EnableIf_t< IsNumeric_v< ElementType_t<MT> > >
+      deserializeCompressed( Archive& archive, MT& mat );
+
+   template< bool PSO, typename Archive, typename MT >
+   EnableIf_t< IsDenseMatrix_v<MT> && IsContiguous_v<MT> && HasMutableDataAccess_v<MT> &&
+               IsRowMajorMatrix_v<MT> == ( PSO == rowMajor ) >
+      deserializeCompressedDense( Archive& archive, MT& mat );
+
+   template< bool PSO, typename Archive, typename MT >
+   DisableIf_t< IsDenseMatrix_v<MT> && IsContiguous_v<MT> && HasMutableDataAccess_v<MT> &&
+                IsRowMajorMatrix_v<MT> == ( PSO == rowMajor ) >
+      deserializeCompressedDense( Archive& archive, MT& mat );
+
+   template< typename Archive, typename ET >
+   void deserializeCompressedSparse( Archive& archive, DynamicVector<ET>& values );
+
+   template< typename MT, bool SO, typename ET >
+   void assembleSparseMatrix( DenseMatrix<MT,SO>& mat, const DynamicVector<ET>& values );
+
+   template< typename MT, bool SO, typename ET >
+   void assembleSparseMatrix( SparseMatrix<MT,SO>& mat, const DynamicVector<ET>& values );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename ET >
+   static inline size_t paddedSize( size_t n ) noexcept;
+
+   static inline size_t alignedOffset( size_t start, size_t offset ) noexcept;
+
+   template< typename MT, bool SO >
+   static inline EnableIf_t< IsContiguous_v<MT> && HasConstDataAccess_v<MT> >
+      gatherElements( const DenseMatrix<MT,SO>& mat, size_t i, size_t j, size_t k, byte_t* dst );
+
+   template< typename MT, bool SO >
+   static inline DisableIf_t< IsContiguous_v<MT> && HasConstDataAccess_v<MT> >
+      gatherElements( const DenseMatrix<MT,SO>& mat, size_t i, size_t j, size_t k, byte_t* dst );
    //@}
    //**********************************************************************************************
 
@@ -310,6 +458,12 @@ class MatrixSerializer
    uint64_t rows_;         //!< The number of rows of the matrix.
    uint64_t columns_;      //!< The number of columns of the matrix.
    uint64_t number_;       //!< The total number of elements contained in the matrix.
+   uint64_t spacing_;      //!< The number of elements between two rows/columns of a dense matrix.
+   uint64_t offsets_[3];   //!< The offsets of the payload arrays relative to the header.
+   bool     compressed_;   //!< Compression flag of the matrix.
+
+   DynamicVector<uint64_t> pointers_;  //!< The row/column pointers of a sparse matrix.
+   DynamicVector<uint64_t> indices_;   //!< The indices of all non-zero elements of a sparse matrix.
    //@}
    //**********************************************************************************************
 };
@@ -335,6 +489,11 @@ MatrixSerializer::MatrixSerializer()
    , rows_       ( 0UL )  // The number of rows of the matrix
    , columns_    ( 0UL )  // The number of columns of the matrix
    , number_     ( 0UL )  // The total number of elements contained in the matrix
+   , spacing_    ( 0UL )  // The number of elements between two rows/columns of a dense matrix
+   , offsets_    ()       // The offsets of the payload arrays relative to the header
+   , compressed_ ( false )  // Compression flag of the matrix
+   , pointers_   ()       // The row/column pointers of a sparse matrix
+   , indices_    ()       // The indices of all non-zero elements of a sparse matrix
 {}
 //*************************************************************************************************
 
@@ -364,8 +523,13 @@ void MatrixSerializer::serialize( Archive& archive, const Matrix<MT,SO>& mat )
       BLAZE_THROW_RUNTIME_ERROR( "Faulty archive detected" );
    }
 
-   serializeHeader( archive, *mat );
-   serializeMatrix( archive, *mat );
+   if( archive.getCompression() ) {
+      serializeCompressed( archive, *mat );
+   }
+   else {
+      serializeHeader( archive, *mat );
+      serializeMatrix( archive, *mat );
+   }
 }
 //*************************************************************************************************
 
@@ -377,6 +541,13 @@ void MatrixSerializer::serialize( Archive& archive, const Matrix<MT,SO>& mat )
 // \param mat The matrix to be serialized.
 // \return void
 // \exception std::runtime_error File header could not be serialized.
+//
+// In addition to the type and size information, the header contains the layout of the payload.
+// For dense matrices this is the spacing between two rows (or columns) and the offset of the
+// first element, for sparse matrices it is the offset of the row (or column) pointers, of the
+// indices, and of the values. All offsets are relative to the beginning of the header and are
+// chosen such that each array starts at a 64-byte boundary relative to the beginning of the
+// archive.
 */
 template< typename Archive  // Type of the archive
         , typename MT >     // Type of the matrix
@@ -384,13 +555,39 @@ void MatrixSerializer::serializeHeader( Archive& archive, const MT& mat )
 {
    using ET = ElementType_t<MT>;
 
-   archive << uint8_t ( 1U );
+   const size_t start( archive.bytesWritten() );
+   const size_t m( IsRowMajorMatrix_v<MT> ? mat.rows() : mat.columns() );
+   const size_t n( IsRowMajorMatrix_v<MT> ? mat.columns() : mat.rows() );
+
+   if( IsDenseMatrix_v<MT> ) {
+      number_     = m*n;
+      spacing_    = paddedSize<ET>( n );
+      offsets_[0] = alignedOffset( start, denseHeaderSize );
+   }
+   else {
+      number_ = 0UL;
+      for( size_t i=0UL; i<m; ++i ) {
+         number_ += mat.nonZeros( i );
+      }
+      offsets_[0] = alignedOffset( start, sparseHeaderSize );
+      offsets_[1] = alignedOffset( start, offsets_[0] + ( m+1UL )*sizeof( uint64_t ) );
+      offsets_[2] = alignedOffset( start, offsets_[1] + number_*sizeof( uint64_t ) );
+   }
+
+   archive << uint8_t ( 3U );
    archive << uint8_t ( MatrixValueMapping<MT>::value );
    archive << uint8_t ( TypeValueMapping<ET>::value );
    archive << uint8_t ( sizeof( ET ) );
    archive << uint64_t( mat.rows() );
    archive << uint64_t( mat.columns() );
-   archive << uint64_t( ( IsDenseMatrix_v<MT> ) ? ( mat.rows()*mat.columns() ) : ( mat.nonZeros() ) );
+   archive << number_;
+
+   if( IsDenseMatrix_v<MT> ) {
+      archive << spacing_ << offsets_[0];
+   }
+   else {
+      archive << offsets_[0] << offsets_[1] << offsets_[2];
+   }
 
    if( !archive ) {
       BLAZE_THROW_RUNTIME_ERROR( "File header could not be serialized" );
@@ -410,20 +607,75 @@ void MatrixSerializer::serializeHeader( Archive& archive, const MT& mat )
 template< typename Archive  // Type of the archive
         , typename MT       // Type of the matrix
         , bool SO >         // Storage order
-void MatrixSerializer::serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat )
+DisableIf_t< IsContiguous_v<MT> && HasConstDataAccess_v<MT> && IsNumeric_v< ElementType_t<MT> > >
+   MatrixSerializer::serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat )
 {
+   using ET = ElementType_t<MT>;
+
+   serializePadding( archive, offsets_[0] - denseHeaderSize );
+
    if( IsRowMajorMatrix_v<MT> ) {
+      const size_t padding( ( spacing_ - (*mat).columns() )*sizeof( ET ) );
       for( size_t i=0UL; i<(*mat).rows(); ++i ) {
          for( size_t j=0UL; j<(*mat).columns(); ++j ) {
             archive << (*mat)(i,j);
          }
+         serializePadding( archive, padding );
       }
    }
    else {
+      const size_t padding( ( spacing_ - (*mat).rows() )*sizeof( ET ) );
       for( size_t j=0UL; j<(*mat).columns(); ++j ) {
          for( size_t i=0UL; i<(*mat).rows(); ++i ) {
             archive << (*mat)(i,j);
          }
+         serializePadding( archive, padding );
+      }
+   }
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense matrix could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the elements of a dense matrix with contiguous rows or columns.
+//
+// \param archive The archive to be written.
+// \param mat The matrix to be serialized.
+// \return void
+// \exception std::runtime_error Dense matrix could not be serialized.
+//
+// This function writes the elements of the given dense matrix by means of block writes. In case
+// neither the matrix nor the serialized representation is padded, all elements are written at
+// once, else each row (or column in case of a column-major matrix) is written separately and
+// followed by the according padding. In both cases the resulting representation is the same as
+// the one of the elementwise serialization.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+EnableIf_t< IsContiguous_v<MT> && HasConstDataAccess_v<MT> && IsNumeric_v< ElementType_t<MT> > >
+   MatrixSerializer::serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat )
+{
+   const size_t m( ( SO == rowMajor )?( (*mat).rows() ):( (*mat).columns() ) );
+   const size_t n( ( SO == rowMajor )?( (*mat).columns() ):( (*mat).rows() ) );
+
+   serializePadding( archive, offsets_[0] - denseHeaderSize );
+
+   if( m != 0UL && n != 0UL )
+   {
+      if( spacing_ == n && (*mat).spacing() == n ) {
+         archive.write( (*mat).data(), m*n );
+      }
+      else {
+         const size_t padding( ( spacing_ - n )*sizeof( ElementType_t<MT> ) );
+         for( size_t i=0UL; i<m && archive; ++i ) {
+            archive.write( (*mat).data(i), n );
+            serializePadding( archive, padding );
+         }
       }
    }
 
@@ -441,29 +693,318 @@ void MatrixSerializer::serializeMatrix( Archive& archive, const DenseMatrix<MT,S
 // \param mat The matrix to be serialized.
 // \return void
 // \exception std::runtime_error Sparse matrix could not be serialized.
+//
+// This function writes the given sparse matrix in compressed row (or column in case of a
+// column-major matrix) format, i.e. as the array of row pointers, the array of indices, and
+// the array of values. Each array is preceded by the padding required by the offsets in the
+// header.
 */
 template< typename Archive  // Type of the archive
         , typename MT       // Type of the matrix
         , bool SO >         // Storage order
 void MatrixSerializer::serializeMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat )
 {
-   if( IsRowMajorMatrix_v<MT> ) {
-      for( size_t i=0UL; i<(*mat).rows(); ++i ) {
-         archive << uint64_t( (*mat).nonZeros( i ) );
-         for( auto element=(*mat).begin(i); element!=(*mat).end(i); ++element ) {
-            archive << element->index() << element->value();
+   const size_t m( IsRowMajorMatrix_v<MT> ? (*mat).rows() : (*mat).columns() );
+
+   serializePadding( archive, offsets_[0] - sparseHeaderSize );
+   serializeSparsePointers( archive, *mat );
+   serializePadding( archive, offsets_[1] - offsets_[0] - ( m+1UL )*sizeof( uint64_t ) );
+   serializeSparseIndices( archive, *mat );
+   serializePadding( archive, offsets_[2] - offsets_[1] - number_*sizeof( uint64_t ) );
+   serializeSparseValues( archive, *mat );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Sparse matrix could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the row/column pointers of a sparse matrix.
+//
+// \param archive The archive to be written.
+// \param mat The sparse matrix to be serialized.
+// \return void
+//
+// This function writes the \f$ m+1 \f$ row (or column) pointers of the given sparse matrix,
+// i.e. the offsets of the first non-zero element of each row (or column) within the arrays of
+// indices and values, followed by the total number of non-zero elements. The pointers are
+// gathered into a buffer of at most \a blockSize elements such that they can be written by
+// means of block writes.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the sparse matrix
+        , bool SO >         // Storage order
+void MatrixSerializer::serializeSparsePointers( Archive& archive, const SparseMatrix<MT,SO>& mat )
+{
+   const size_t m( IsRowMajorMatrix_v<MT> ? (*mat).rows() : (*mat).columns() );
+
+   uint64_t pointers[blockSize];
+   uint64_t total( 0UL );
+
+   pointers[0] = total;
+   size_t k( 1UL );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      if( k == blockSize ) {
+         archive.write( pointers, k );
+         k = 0UL;
+      }
+      total += (*mat).nonZeros( i );
+      pointers[k++] = total;
+   }
+
+   archive.write( pointers, k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the indices of all non-zero elements of a sparse matrix.
+//
+// \param archive The archive to be written.
+// \param mat The sparse matrix to be serialized.
+// \return void
+//
+// This function writes the indices of all non-zero elements of the given sparse matrix. The
+// indices are gathered into a buffer of at most \a blockSize elements such that they can be
+// written by means of block writes.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the sparse matrix
+        , bool SO >         // Storage order
+void MatrixSerializer::serializeSparseIndices( Archive& archive, const SparseMatrix<MT,SO>& mat )
+{
+   const size_t m( IsRowMajorMatrix_v<MT> ? (*mat).rows() : (*mat).columns() );
+
+   uint64_t indices[blockSize];
+   size_t k( 0UL );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      const auto end( (*mat).end(i) );
+      for( auto element=(*mat).begin(i); element!=end; ++element ) {
+         if( k == blockSize ) {
+            archive.write( indices, k );
+            k = 0UL;
          }
+         indices[k++] = element->index();
       }
    }
-   else {
-      for( size_t j=0UL; j<(*mat).columns(); ++j ) {
-         archive << uint64_t( (*mat).nonZeros( j ) );
-         for( auto element=(*mat).begin(j); element!=(*mat).end(j); ++element ) {
-            archive << element->index() << element->value();
+
+   archive.write( indices, k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the values of all numeric non-zero elements of a sparse matrix.
+//
+// \param archive The archive to be written.
+// \param mat The sparse matrix to be serialized.
+// \return void
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the sparse matrix
+        , bool SO >         // Storage order
+EnableIf_t< IsNumeric_v< ElementType_t<MT> > >
+   MatrixSerializer::serializeSparseValues( Archive& archive, const SparseMatrix<MT,SO>& mat )
+{
+   const size_t m( IsRowMajorMatrix_v<MT> ? (*mat).rows() : (*mat).columns() );
+
+   ElementType_t<MT> values[blockSize];
+   size_t k( 0UL );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      const auto end( (*mat).end(i) );
+      for( auto element=(*mat).begin(i); element!=end; ++element ) {
+         if( k == blockSize ) {
+            archive.write( values, k );
+            k = 0UL;
          }
+         values[k++] = element->value();
       }
    }
 
+   archive.write( values, k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the values of all non-numeric non-zero elements of a sparse matrix.
+//
+// \param archive The archive to be written.
+// \param mat The sparse matrix to be serialized.
+// \return void
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the sparse matrix
+        , bool SO >         // Storage order
+DisableIf_t< IsNumeric_v< ElementType_t<MT> > >
+   MatrixSerializer::serializeSparseValues( Archive& archive, const SparseMatrix<MT,SO>& mat )
+{
+   const size_t m( IsRowMajorMatrix_v<MT> ? (*mat).rows() : (*mat).columns() );
+
+   for( size_t i=0UL; i<m && archive; ++i ) {
+      for( auto element=(*mat).begin(i); element!=(*mat).end(i) && archive; ++element ) {
+         archive << element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given number of padding bytes to the archive.
+//
+// \param archive The archive to be written.
+// \param bytes The number of padding bytes \f$[0..alignment)\f$.
+// \return void
+*/
+template< typename Archive >  // Type of the archive
+void MatrixSerializer::serializePadding( Archive& archive, size_t bytes )
+{
+   BLAZE_INTERNAL_ASSERT( bytes < alignment, "Invalid number of padding bytes" );
+
+   const uint8_t padding[alignment] = {};
+   archive.write( padding, bytes );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes a matrix with non-numeric elements in case compression is requested.
+//
+// \param archive The archive to be written.
+// \param mat The matrix to be serialized.
+// \return void
+//
+// Matrices with non-numeric elements are never compressed. Therefore this function serializes
+// the given matrix in the default format. Note that numeric matrix elements are nevertheless
+// compressed individually.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT >     // Type of the matrix
+DisableIf_t< IsNumeric_v< ElementType_t<MT> > >
+   MatrixSerializer::serializeCompressed( Archive& archive, const MT& mat )
+{
+   serializeHeader( archive, mat );
+   serializeMatrix( archive, mat );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the elements of a dense matrix in compressed format.
+//
+// \param archive The archive to be written.
+// \param mat The matrix to be serialized.
+// \return void
+// \exception std::runtime_error Dense matrix could not be serialized.
+//
+// This function compresses the elements of the given dense matrix in storage order, i.e. row by
+// row for a row-major matrix and column by column for a column-major matrix, without padding.
+// The elements are gathered and compressed block-wise in parallel.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+EnableIf_t< IsNumeric_v< ElementType_t<MT> > >
+   MatrixSerializer::serializeCompressed( Archive& archive, const DenseMatrix<MT,SO>& mat )
+{
+   using ET = ElementType_t<MT>;
+
+   const size_t n( ( SO == rowMajor )?( (*mat).columns() ):( (*mat).rows() ) );
+
+   number_ = (*mat).rows() * (*mat).columns();
+
+   serializeCompressedHeader( archive, *mat );
+
+   BlockCodec::compress( archive, number_*sizeof( ET ), sizeof( ET ),
+                         [&mat,n]( byte_t* dst, size_t first, size_t count )
+   {
+      size_t i( first / n );
+      size_t j( first % n );
+
+      while( count > 0UL ) {
+         const size_t k( std::min( n - j, count ) );
+         gatherElements( *mat, i, j, k, dst );
+         dst += k*sizeof( ET );
+         count -= k;
+         ++i;
+         j = 0UL;
+      }
+   } );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense matrix could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the elements of a sparse matrix in compressed format.
+//
+// \param archive The archive to be written.
+// \param mat The matrix to be serialized.
+// \return void
+// \exception std::runtime_error Sparse matrix could not be serialized.
+//
+// This function writes the structure and the values of the given sparse matrix in compressed
+// format. The structure consists of the number of non-zero elements of each row (or column in
+// case of a column-major matrix) and the distances between the indices of consecutive non-zero
+// elements, all of which are encoded as variable-length integers. It is preceded by its size in
+// bytes and followed by the values of all non-zero elements.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+EnableIf_t< IsNumeric_v< ElementType_t<MT> > >
+   MatrixSerializer::serializeCompressed( Archive& archive, const SparseMatrix<MT,SO>& mat )
+{
+   using ET = ElementType_t<MT>;
+
+   const size_t m( ( SO == rowMajor )?( (*mat).rows() ):( (*mat).columns() ) );
+
+   number_ = 0UL;
+   for( size_t i=0UL; i<m; ++i ) {
+      number_ += (*mat).nonZeros( i );
+   }
+
+   serializeCompressedHeader( archive, *mat );
+
+   std::vector<byte_t> structure;
+   DynamicVector<ET> values( number_ );
+
+   structure.reserve( m + number_ );
+
+   for( size_t i=0UL, k=0UL; i<m; ++i )
+   {
+      BlockCodec::encodeVarint( structure, (*mat).nonZeros( i ) );
+
+      size_t next( 0UL );
+      const auto end( (*mat).end(i) );
+      for( auto element=(*mat).begin(i); element!=end; ++element, ++k ) {
+         BlockCodec::encodeVarint( structure, element->index() - next );
+         next = element->index() + 1UL;
+         values[k] = element->value();
+      }
+   }
+
+   archive << uint64_t( structure.size() );
+
+   BlockCodec::compress( archive, structure.size(), 1UL,
+                         [&structure]( byte_t* dst, size_t first, size_t count ) {
+      std::copy( structure.data() + first, structure.data() + first + count, dst );
+   } );
+
+   BlockCodec::compress( archive, number_*sizeof( ET ), sizeof( ET ),
+                         [&values]( byte_t* dst, size_t first, size_t count ) {
+      std::memcpy( dst, values.data() + first, count*sizeof( ET ) );
+   } );
+
    if( !archive ) {
       BLAZE_THROW_RUNTIME_ERROR( "Sparse matrix could not be serialized" );
    }
@@ -471,6 +1012,38 @@ void MatrixSerializer::serializeMatrix( Archive& archive, const SparseMatrix<MT,
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Serializes all meta information about the given compressed matrix.
+//
+// \param archive The archive to be written.
+// \param mat The matrix to be serialized.
+// \return void
+// \exception std::runtime_error File header could not be serialized.
+//
+// The header of a compressed matrix consists of the type and size information only. The type
+// of the matrix is marked by the compression flag.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT >     // Type of the matrix
+void MatrixSerializer::serializeCompressedHeader( Archive& archive, const MT& mat )
+{
+   using ET = ElementType_t<MT>;
+
+   archive << uint8_t ( 3U );
+   archive << uint8_t ( MatrixValueMapping<MT>::value | 8U );
+   archive << uint8_t ( TypeValueMapping<ET>::value );
+   archive << uint8_t ( sizeof( ET ) );
+   archive << uint64_t( mat.rows() );
+   archive << uint64_t( mat.columns() );
+   archive << number_;
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File header could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -510,6 +1083,9 @@ void MatrixSerializer::deserialize( Archive& archive, Matrix<MT,SO>& mat )
 // \param mat The matrix to be deserialized.
 // \return void
 // \exception std::runtime_error Error during deserialization.
+//
+// This function reads the header of any version of the format. In case of uncompressed archives
+// of version 3 it also reads and validates the layout of the payload.
 */
 template< typename Archive  // Type of the archive
         , typename MT >     // Type of the matrix
@@ -520,10 +1096,11 @@ void MatrixSerializer::deserializeHeader( Archive& archive, const MT& mat )
    if( !( archive >> version_ >> type_ >> elementType_ >> elementSize_ >> rows_ >> columns_ >> number_ ) ) {
       BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
    }
-   else if( version_ != 1UL ) {
+   else if( version_ < 1U || version_ > 3U ) {
       BLAZE_THROW_RUNTIME_ERROR( "Invalid version detected" );
    }
-   else if( ( type_ & 1U ) != 1U || ( type_ & (~7U) ) != 0U ) {
+   else if( ( type_ & 1U ) != 1U || ( type_ & (~15U) ) != 0U ||
+            ( version_ < 3U && ( type_ & 8U ) != 0U ) ) {
       BLAZE_THROW_RUNTIME_ERROR( "Invalid matrix type detected" );
    }
    else if( elementType_ != TypeValueMapping<ET>::value ) {
@@ -538,6 +1115,39 @@ void MatrixSerializer::deserializeHeader( Archive& archive, const MT& mat )
    else if( number_ > rows_*columns_ ) {
       BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
    }
+
+   compressed_ = ( ( type_ & 8U ) != 0U );
+   type_ &= 7U;
+
+   const size_t m( ( type_ & 4U ) ? columns_ : rows_ );
+   const size_t n( ( type_ & 4U ) ? rows_ : columns_ );
+
+   if( version_ < 3U || compressed_ ) {
+      spacing_ = n;
+   }
+   else if( ( type_ & 2U ) == 0U ) {
+      if( !( archive >> spacing_ >> offsets_[0] ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+      }
+      else if( spacing_ < n ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid spacing detected" );
+      }
+      else if( offsets_[0] < denseHeaderSize ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid payload offset detected" );
+      }
+   }
+   else {
+      if( !( archive >> offsets_[0] >> offsets_[1] >> offsets_[2] ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+      }
+      else if( offsets_[0] < sparseHeaderSize || offsets_[1] < offsets_[0] || offsets_[2] < offsets_[1] ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid payload offset detected" );
+      }
+      else if( ( offsets_[1] - offsets_[0] ) / sizeof( uint64_t ) <= m ||
+               ( offsets_[2] - offsets_[1] ) / sizeof( uint64_t ) < number_ ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid payload offset detected" );
+      }
+   }
 }
 //*************************************************************************************************
 
@@ -579,46 +1189,220 @@ DisableIf_t< IsResizable_v<MT> > MatrixSerializer::prepareMatrix( SparseMatrix<M
 // \param mat The matrix to be prepared.
 // \return void
 */
-template< typename MT >  // Type of the matrix
-EnableIf_t< IsResizable_v<MT> > MatrixSerializer::prepareMatrix( MT& mat )
+template< typename MT >  // Type of the matrix
+EnableIf_t< IsResizable_v<MT> > MatrixSerializer::prepareMatrix( MT& mat )
+{
+   mat.resize ( rows_, columns_, false );
+   mat.reserve( number_ );
+   reset( mat );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a matrix from the archive.
+//
+// \param archive The archive to be read from.
+// \param mat The matrix to be reconstituted.
+// \return void
+// \exception std::runtime_error Error during deserialization.
+//
+// This function deserializes the contents of the matrix from the archive and reconstitutes the
+// given matrix. In case of archives of version 3, the padding in front of the elements of a
+// dense matrix is skipped and the row/column pointers and indices of a sparse matrix are read
+// up front. Compressed matrices are handled by deserializeCompressed().
+*/
+template< typename Archive  // Type of the archive
+        , typename MT >     // Type of the matrix
+void MatrixSerializer::deserializeMatrix( Archive& archive, MT& mat )
+{
+   if( compressed_ ) {
+      deserializeCompressed( archive, mat );
+      return;
+   }
+
+   if( version_ > 2U && ( type_ & 2U ) == 0U ) {
+      skipPadding( archive, offsets_[0] - denseHeaderSize );
+   }
+   else if( version_ > 2U ) {
+      deserializeSparseStructure( archive );
+   }
+
+   if( type_ == 1U ) {
+      deserializeDenseRowMatrix( archive, *mat );
+   }
+   else if( type_ == 5UL ) {
+      deserializeDenseColumnMatrix( archive, *mat );
+   }
+   else if( type_ == 3UL ) {
+      deserializeSparseRowMatrix( archive, *mat );
+   }
+   else if( type_ == 7UL ) {
+      deserializeSparseColumnMatrix( archive, *mat );
+   }
+   else {
+      BLAZE_INTERNAL_ASSERT( false, "Undefined type flag" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes the row/column pointers and the indices of a sparse matrix.
+//
+// \param archive The archive to be read from.
+// \return void
+// \exception std::runtime_error Invalid number of elements detected.
+// \exception std::runtime_error Invalid element index detected.
+//
+// This function reads the row (or column) pointers and the indices of all non-zero elements of
+// a sparse matrix in version 3 of the format, including the padding in front of each array. In
+// case the archive fails during the read operations, the function returns without any further
+// checks. Otherwise a \a std::runtime_error is thrown in case the pointers are inconsistent or
+// any index exceeds the size of the row/column.
+*/
+template< typename Archive >  // Type of the archive
+void MatrixSerializer::deserializeSparseStructure( Archive& archive )
+{
+   const size_t m( ( type_ & 4U ) ? columns_ : rows_ );
+   const size_t n( ( type_ & 4U ) ? rows_ : columns_ );
+
+   pointers_.resize( m+1UL, false );
+   indices_.resize( number_, false );
+
+   skipPadding( archive, offsets_[0] - sparseHeaderSize );
+   archive.read( pointers_.data(), m+1UL );
+   skipPadding( archive, offsets_[1] - offsets_[0] - ( m+1UL )*sizeof( uint64_t ) );
+   archive.read( indices_.data(), number_ );
+   skipPadding( archive, offsets_[2] - offsets_[1] - number_*sizeof( uint64_t ) );
+
+   if( !archive ) return;
+
+   if( pointers_[0] != 0UL || pointers_[m] != number_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
+   }
+
+   for( size_t i=0UL; i<m; ++i ) {
+      if( pointers_[i+1UL] < pointers_[i] || pointers_[i+1UL] - pointers_[i] > n ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
+      }
+   }
+
+   for( size_t k=0UL; k<number_; ++k ) {
+      if( indices_[k] >= n ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid element index detected" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes the non-zero elements of a single row or column of a sparse matrix.
+//
+// \param archive The archive to be read from.
+// \param i The index of the row/column.
+// \param dim The size of the row/column.
+// \param indices The buffer for the indices of the non-zero elements.
+// \param values The buffer for the values of the non-zero elements.
+// \return void
+// \exception std::runtime_error Invalid number of elements detected.
+// \exception std::runtime_error Invalid element index detected.
+//
+// This function reads the number of non-zero elements of a single row or column of a sparse
+// matrix and all according indices and values into the two given buffers. Archives of version
+// 1 contain index/value pairs, archives of version 2 contain a block of indices followed by a
+// block of values. In case the archive fails during the read operations, the function returns
+// without any further checks. Otherwise a \a std::runtime_error is thrown in case the number
+// of elements or any index exceeds the size of the row/column. In archives of version 3 the
+// indices have already been read by deserializeSparseStructure() and only the values of the
+// row/column are read from the archive.
+*/
+template< typename Archive  // Type of the archive
+        , typename ET >     // Type of the elements
+void MatrixSerializer::deserializeSparseElements( Archive& archive, size_t i, size_t dim,
+                                                  DynamicVector<uint64_t>& indices,
+                                                  DynamicVector<ET>& values )
+{
+   if( version_ > 2U )
+   {
+      const size_t begin ( pointers_[i] );
+      const size_t number( pointers_[i+1UL] - begin );
+
+      indices.resize( number, false );
+      values.resize ( number, false );
+
+      for( size_t k=0UL; k<number; ++k ) {
+         indices[k] = indices_[begin+k];
+      }
+
+      deserializeSparseValues( archive, values );
+      return;
+   }
+
+   uint64_t number( 0UL );
+
+   if( !( archive >> number ) ) return;
+
+   if( number > dim ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
+   }
+
+   indices.resize( number, false );
+   values.resize ( number, false );
+
+   if( version_ == 1U ) {
+      size_t index( 0UL );
+      for( size_t k=0UL; k<number && ( archive >> index >> values[k] ); ++k ) {
+         indices[k] = index;
+      }
+   }
+   else if( number != 0UL ) {
+      archive.read( indices.data(), number );
+      deserializeSparseValues( archive, values );
+   }
+
+   if( !archive ) return;
+
+   for( size_t k=0UL; k<number; ++k ) {
+      if( indices[k] >= dim ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid element index detected" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a block of numeric values of sparse matrix elements.
+//
+// \param archive The archive to be read from.
+// \param values The buffer for the values of the non-zero elements.
+// \return void
+*/
+template< typename Archive  // Type of the archive
+        , typename ET >     // Type of the elements
+EnableIf_t< IsNumeric_v<ET> >
+   MatrixSerializer::deserializeSparseValues( Archive& archive, DynamicVector<ET>& values )
 {
-   mat.resize ( rows_, columns_, false );
-   mat.reserve( number_ );
-   reset( mat );
+   archive.read( values.data(), values.size() );
 }
 //*************************************************************************************************
 
 
 //*************************************************************************************************
-/*!\brief Deserializes a matrix from the archive.
+/*!\brief Deserializes a block of non-numeric values of sparse matrix elements.
 //
 // \param archive The archive to be read from.
-// \param mat The matrix to be reconstituted.
+// \param values The buffer for the values of the non-zero elements.
 // \return void
-// \exception std::runtime_error Error during deserialization.
-//
-// This function deserializes the contents of the matrix from the archive and reconstitutes the
-// given matrix.
 */
 template< typename Archive  // Type of the archive
-        , typename MT >     // Type of the matrix
-void MatrixSerializer::deserializeMatrix( Archive& archive, MT& mat )
+        , typename ET >     // Type of the elements
+DisableIf_t< IsNumeric_v<ET> >
+   MatrixSerializer::deserializeSparseValues( Archive& archive, DynamicVector<ET>& values )
 {
-   if( type_ == 1U ) {
-      deserializeDenseRowMatrix( archive, *mat );
-   }
-   else if( type_ == 5UL ) {
-      deserializeDenseColumnMatrix( archive, *mat );
-   }
-   else if( type_ == 3UL ) {
-      deserializeSparseRowMatrix( archive, *mat );
-   }
-   else if( type_ == 7UL ) {
-      deserializeSparseColumnMatrix( archive, *mat );
-   }
-   else {
-      BLAZE_INTERNAL_ASSERT( false, "Undefined type flag" );
-   }
+   for( size_t k=0UL; k<values.size() && ( archive >> values[k] ); ++k ) {}
 }
 //*************************************************************************************************
 
@@ -642,8 +1426,11 @@ EnableIf_t< MT::simdEnabled >
 {
    if( columns_ == 0UL ) return;
 
+   const size_t padding( ( spacing_ - columns_ )*sizeof( ElementType_t<MT> ) );
+
    for( size_t i=0UL; i<rows_; ++i ) {
       archive.read( &(*mat)(i,0), columns_ );
+      skipPadding( archive, padding );
    }
 
    if( !archive ) {
@@ -674,12 +1461,15 @@ void MatrixSerializer::deserializeDenseRowMatrix( Archive& archive, DenseMatrix<
 
    ET value{};
 
+   const size_t padding( ( spacing_ - columns_ )*sizeof( ET ) );
+
    for( size_t i=0UL; i<rows_; ++i ) {
       size_t j( 0UL );
       while( ( j != columns_ ) && ( archive >> value ) ) {
          (*mat)(i,j) = value;
          ++j;
       }
+      skipPadding( archive, padding );
    }
 
    if( !archive ) {
@@ -747,12 +1537,15 @@ DisableIf_t< IsNumeric_v< ElementType_t<MT> > >
       (*mat).reserve( i, dim2 );
    }
 
+   const size_t padding( ( spacing_ - columns_ )*sizeof( ET ) );
+
    for( size_t i=0UL; i<rows_; ++i ) {
       size_t j( 0UL );
       while( ( j != columns_ ) && ( archive >> value ) ) {
          (*mat).append( i, j, value, false );
          ++j;
       }
+      skipPadding( archive, padding );
    }
 
    if( !archive ) {
@@ -781,8 +1574,11 @@ EnableIf_t< MT::simdEnabled >
 {
    if( rows_ == 0UL ) return;
 
+   const size_t padding( ( spacing_ - rows_ )*sizeof( ElementType_t<MT> ) );
+
    for( size_t j=0UL; j<columns_; ++j ) {
       archive.read( &(*mat)(0,j), rows_ );
+      skipPadding( archive, padding );
    }
 
    if( !archive ) {
@@ -813,12 +1609,15 @@ void MatrixSerializer::deserializeDenseColumnMatrix( Archive& archive, DenseMatr
 
    ET value{};
 
+   const size_t padding( ( spacing_ - rows_ )*sizeof( ET ) );
+
    for( size_t j=0UL; j<columns_; ++j ) {
       size_t i( 0UL );
       while( ( i != rows_ ) && ( archive >> value ) ) {
          (*mat)(i,j) = value;
          ++i;
       }
+      skipPadding( archive, padding );
    }
 
    if( !archive ) {
@@ -886,12 +1685,15 @@ DisableIf_t< IsNumeric_v< ElementType_t<MT> > >
       (*mat).reserve( i, dim2 );
    }
 
+   const size_t padding( ( spacing_ - rows_ )*sizeof( ET ) );
+
    for( size_t j=0UL; j<columns_; ++j ) {
       size_t i( 0UL );
       while( ( i != rows_ ) && ( archive >> value ) ) {
          (*mat).append( i, j, value, false );
          ++i;
       }
+      skipPadding( archive, padding );
    }
 
    if( !archive ) {
@@ -920,16 +1722,13 @@ void MatrixSerializer::deserializeSparseRowMatrix( Archive& archive, DenseMatrix
 {
    using ET = ElementType_t<MT>;
 
-   uint64_t number( 0UL );
-   size_t   index ( 0UL );
-   ET       value {};
+   DynamicVector<uint64_t> indices;
+   DynamicVector<ET> values;
 
-   for( size_t i=0UL; i<rows_; ++i ) {
-      archive >> number;
-      size_t j( 0UL );
-      while( ( j != number ) && ( archive >> index >> value ) ) {
-         (*mat)(i,index) = value;
-         ++j;
+   for( size_t i=0UL; i<rows_ && archive; ++i ) {
+      deserializeSparseElements( archive, i, columns_, indices, values );
+      for( size_t k=0UL; k<indices.size() && archive; ++k ) {
+         (*mat)(i,indices[k]) = values[k];
       }
    }
 
@@ -958,18 +1757,15 @@ void MatrixSerializer::deserializeSparseRowMatrix( Archive& archive, SparseMatri
 {
    using ET = ElementType_t<MT>;
 
-   uint64_t number( 0UL );
-   size_t   index ( 0UL );
-   ET       value {};
+   DynamicVector<uint64_t> indices;
+   DynamicVector<ET> values;
 
-   for( size_t i=0UL; i<rows_; ++i )
+   for( size_t i=0UL; i<rows_ && archive; ++i )
    {
-      archive >> number;
+      deserializeSparseElements( archive, i, columns_, indices, values );
 
-      size_t j( 0UL );
-      while( ( j != number ) && ( archive >> index >> value ) ) {
-         (*mat).append( i, index, value, false );
-         ++j;
+      for( size_t k=0UL; k<indices.size() && archive; ++k ) {
+         (*mat).append( i, indices[k], values[k], false );
       }
 
       (*mat).finalize( i );
@@ -1028,16 +1824,13 @@ void MatrixSerializer::deserializeSparseColumnMatrix( Archive& archive, DenseMat
 {
    using ET = ElementType_t<MT>;
 
-   uint64_t number( 0UL );
-   size_t   index ( 0UL );
-   ET       value {};
+   DynamicVector<uint64_t> indices;
+   DynamicVector<ET> values;
 
-   for( size_t j=0UL; j<columns_; ++j ) {
-      archive >> number;
-      size_t i( 0UL );
-      while( ( i != number ) && ( archive >> index >> value ) ) {
-         (*mat)(index,j) = value;
-         ++i;
+   for( size_t j=0UL; j<columns_ && archive; ++j ) {
+      deserializeSparseElements( archive, j, rows_, indices, values );
+      for( size_t k=0UL; k<indices.size() && archive; ++k ) {
+         (*mat)(indices[k],j) = values[k];
       }
    }
 
@@ -1093,18 +1886,15 @@ void MatrixSerializer::deserializeSparseColumnMatrix( Archive& archive, SparseMa
 {
    using ET = ElementType_t<MT>;
 
-   uint64_t number( 0UL );
-   size_t   index ( 0UL );
-   ET       value {};
+   DynamicVector<uint64_t> indices;
+   DynamicVector<ET> values;
 
-   for( size_t j=0UL; j<columns_; ++j )
+   for( size_t j=0UL; j<columns_ && archive; ++j )
    {
-      archive >> number;
+      deserializeSparseElements( archive, j, rows_, indices, values );
 
-      size_t i( 0UL );
-      while( ( i != number ) && ( archive >> index >> value ) ) {
-         (*mat).append( index, j, value, false );
-         ++i;
+      for( size_t k=0UL; k<indices.size() && archive; ++k ) {
+         (*mat).append( indices[k], j, values[k], false );
       }
 
       (*mat).finalize( j );
@@ -1117,6 +1907,403 @@ void MatrixSerializer::deserializeSparseColumnMatrix( Archive& archive, SparseMa
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Skips the given number of padding bytes in the archive.
+//
+// \param archive The archive to be read from.
+// \param bytes The number of padding bytes to be skipped.
+// \return void
+*/
+template< typename Archive >  // Type of the archive
+void MatrixSerializer::skipPadding( Archive& archive, size_t bytes )
+{
+   uint8_t padding[alignment];
+
+   while( bytes > 0UL && archive ) {
+      const size_t k( ( bytes < alignment )?( bytes ):( alignment ) );
+      archive.read( padding, k );
+      bytes -= k;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a compressed matrix with non-numeric elements.
+//
+// \param archive The archive to be read from.
+// \param mat The matrix to be reconstituted.
+// \return void
+// \exception std::runtime_error Invalid matrix type detected.
+//
+// Since matrices with non-numeric elements are never compressed, this function always throws
+// a \a std::runtime_error exception.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT >     // Type of the matrix
+DisableIf_t< IsNumeric_v< ElementType_t<MT> > >
+   MatrixSerializer::deserializeCompressed( Archive& archive, MT& mat )
+{
+   MAYBE_UNUSED( archive, mat );
+
+   BLAZE_THROW_RUNTIME_ERROR( "Invalid matrix type detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a compressed matrix from the archive.
+//
+// \param archive The archive to be read from.
+// \param mat The matrix to be reconstituted.
+// \return void
+// \exception std::runtime_error Matrix could not be deserialized.
+//
+// This function decompresses a dense or sparse matrix from the archive and reconstitutes the
+// given matrix. In case any error is detected during the deserialization process, a
+// \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT >     // Type of the matrix
+EnableIf_t< IsNumeric_v< ElementType_t<MT> > >
+   MatrixSerializer::deserializeCompressed( Archive& archive, MT& mat )
+{
+   if( type_ == 1U ) {
+      deserializeCompressedDense<rowMajor>( archive, mat );
+   }
+   else if( type_ == 5U ) {
+      deserializeCompressedDense<columnMajor>( archive, mat );
+   }
+   else {
+      DynamicVector< ElementType_t<MT> > values;
+      deserializeCompressedSparse( archive, values );
+      if( archive ) {
+         assembleSparseMatrix( mat, values );
+      }
+   }
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Matrix could not be deserialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Decompresses the elements of a dense matrix directly into the given dense matrix.
+//
+// \param archive The archive to be read from.
+// \param mat The dense matrix to be reconstituted.
+// \return void
+//
+// This function decompresses the elements of a dense matrix with storage order \a PSO into the
+// given contiguous dense matrix with the same storage order. The decompressed blocks are copied
+// in parallel into the according rows (or columns) of the matrix.
+*/
+template< bool PSO          // Storage order of the serialized matrix
+        , typename Archive  // Type of the archive
+        , typename MT >     // Type of the matrix
+EnableIf_t< IsDenseMatrix_v<MT> && IsContiguous_v<MT> && HasMutableDataAccess_v<MT> &&
+            IsRowMajorMatrix_v<MT> == ( PSO == rowMajor ) >
+   MatrixSerializer::deserializeCompressedDense( Archive& archive, MT& mat )
+{
+   using ET = ElementType_t<MT>;
+
+   const size_t n( ( PSO == rowMajor )?( columns_ ):( rows_ ) );
+
+   BlockCodec::decompress( archive, rows_*columns_*sizeof( ET ), sizeof( ET ),
+                           [&mat,n]( const byte_t* src, size_t first, size_t count )
+   {
+      size_t i( first / n );
+      size_t j( first % n );
+
+      while( count > 0UL ) {
+         const size_t k( std::min( n - j, count ) );
+         std::memcpy( mat.data(i) + j, src, k*sizeof( ET ) );
+         src += k*sizeof( ET );
+         count -= k;
+         ++i;
+         j = 0UL;
+      }
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Decompresses the elements of a dense matrix into the given matrix.
+//
+// \param archive The archive to be read from.
+// \param mat The matrix to be reconstituted.
+// \return void
+//
+// This function decompresses the elements of a dense matrix with storage order \a PSO into a
+// temporary dense matrix, which is subsequently assigned to the given matrix.
+*/
+template< bool PSO          // Storage order of the serialized matrix
+        , typename Archive  // Type of the archive
+        , typename MT >     // Type of the matrix
+DisableIf_t< IsDenseMatrix_v<MT> && IsContiguous_v<MT> && HasMutableDataAccess_v<MT> &&
+             IsRowMajorMatrix_v<MT> == ( PSO == rowMajor ) >
+   MatrixSerializer::deserializeCompressedDense( Archive& archive, MT& mat )
+{
+   DynamicMatrix< ElementType_t<MT>, PSO > tmp( rows_, columns_ );
+   deserializeCompressedDense<PSO>( archive, tmp );
+
+   if( archive ) {
+      mat = tmp;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Decompresses the structure and the values of a sparse matrix.
+//
+// \param archive The archive to be read from.
+// \param values The buffer for the values of all non-zero elements.
+// \return void
+// \exception std::runtime_error Corrupt archive detected.
+// \exception std::runtime_error Invalid number of elements detected.
+// \exception std::runtime_error Invalid element index detected.
+//
+// This function decompresses the structure of a sparse matrix into the row/column pointers and
+// the indices of all non-zero elements and the values of all non-zero elements into the given
+// buffer. In case the archive fails during the read operations, the function returns without
+// any further checks. Otherwise a \a std::runtime_error is thrown in case the structure is
+// inconsistent or any index exceeds the size of the row/column.
+*/
+template< typename Archive  // Type of the archive
+        , typename ET >     // Type of the elements
+void MatrixSerializer::deserializeCompressedSparse( Archive& archive, DynamicVector<ET>& values )
+{
+   const size_t m( ( type_ & 4U ) ? columns_ : rows_ );
+   const size_t n( ( type_ & 4U ) ? rows_ : columns_ );
+
+   uint64_t size( 0UL );
+
+   if( !( archive >> size ) ) return;
+
+   if( size > ( m + number_ )*10UL ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+
+   std::vector<byte_t> structure( size );
+
+   BlockCodec::decompress( archive, size, 1UL,
+                           [&structure]( const byte_t* src, size_t first, size_t count ) {
+      std::copy( src, src + count, structure.data() + first );
+   } );
+
+   values.resize( number_, false );
+
+   BlockCodec::decompress( archive, number_*sizeof( ET ), sizeof( ET ),
+                           [&values]( const byte_t* src, size_t first, size_t count ) {
+      std::memcpy( values.data() + first, src, count*sizeof( ET ) );
+   } );
+
+   if( !archive ) return;
+
+   pointers_.resize( m+1UL, false );
+   indices_.resize( number_, false );
+
+   const byte_t* pos( structure.data() );
+   const byte_t* const end( pos + size );
+
+   size_t k( 0UL );
+   pointers_[0] = 0UL;
+
+   for( size_t i=0UL; i<m; ++i )
+   {
+      uint64_t nonzeros( 0UL );
+
+      if( !BlockCodec::decodeVarint( pos, end, nonzeros ) ||
+          nonzeros > n || nonzeros > number_ - k ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
+      }
+
+      size_t next( 0UL );
+
+      for( size_t l=0UL; l<nonzeros; ++l, ++k )
+      {
+         uint64_t delta( 0UL );
+
+         if( !BlockCodec::decodeVarint( pos, end, delta ) ) {
+            BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+         }
+         else if( delta >= n - next ) {
+            BLAZE_THROW_RUNTIME_ERROR( "Invalid element index detected" );
+         }
+
+         indices_[k] = next + delta;
+         next = indices_[k] + 1UL;
+      }
+
+      pointers_[i+1UL] = k;
+   }
+
+   if( k != number_ || pos != end ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assembles a dense matrix from the decompressed elements of a sparse matrix.
+//
+// \param mat The dense matrix to be reconstituted.
+// \param values The values of all non-zero elements.
+// \return void
+*/
+template< typename MT    // Type of the matrix
+        , bool SO        // Storage order
+        , typename ET >  // Type of the elements
+void MatrixSerializer::assembleSparseMatrix( DenseMatrix<MT,SO>& mat,
+                                             const DynamicVector<ET>& values )
+{
+   const bool byRow( ( type_ & 4U ) == 0U );
+   const size_t m( byRow ? rows_ : columns_ );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t k=pointers_[i]; k<pointers_[i+1UL]; ++k ) {
+         if( byRow ) (*mat)(i,indices_[k]) = values[k];
+         else       (*mat)(indices_[k],i) = values[k];
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assembles a sparse matrix from the decompressed elements of a sparse matrix.
+//
+// \param mat The sparse matrix to be reconstituted.
+// \param values The values of all non-zero elements.
+// \return void
+//
+// In case the storage order of the given sparse matrix matches the storage order of the
+// serialized matrix, the non-zero elements are appended directly. Otherwise the elements are
+// appended to a temporary sparse matrix, which is subsequently assigned to the given matrix.
+*/
+template< typename MT    // Type of the matrix
+        , bool SO        // Storage order
+        , typename ET >  // Type of the elements
+void MatrixSerializer::assembleSparseMatrix( SparseMatrix<MT,SO>& mat,
+                                             const DynamicVector<ET>& values )
+{
+   const bool byRow( ( type_ & 4U ) == 0U );
+
+   if( byRow != ( SO == rowMajor ) ) {
+      CompressedMatrix< ET, !SO > tmp( rows_, columns_, number_ );
+      assembleSparseMatrix( tmp, values );
+      (*mat) = tmp;
+      return;
+   }
+
+   const size_t m( byRow ? rows_ : columns_ );
+
+   for( size_t i=0UL; i<m; ++i )
+   {
+      for( size_t k=pointers_[i]; k<pointers_[i+1UL]; ++k ) {
+         if( SO == rowMajor ) (*mat).append( i, indices_[k], values[k], false );
+         else                 (*mat).append( indices_[k], i, values[k], false );
+      }
+
+      (*mat).finalize( i );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the number of serialized elements per row/column of a dense matrix.
+//
+// \param n The number of elements per row/column.
+// \return The number of elements including padding.
+//
+// In version 3 of the format the rows (or columns) of dense matrices with numeric elements are
+// padded to a multiple of \a alignment bytes. For all other element types no padding is used.
+*/
+template< typename ET >  // Type of the elements
+inline size_t MatrixSerializer::paddedSize( size_t n ) noexcept
+{
+   return ( IsNumeric_v<ET> && alignment % sizeof( ET ) == 0UL )
+          ?( nextMultiple( n, alignment / sizeof( ET ) ) )
+          :( n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the next aligned offset relative to the header of a matrix.
+//
+// \param start The position of the header relative to the beginning of the archive.
+// \param offset The minimum offset relative to the header.
+// \return The smallest offset that is aligned relative to the beginning of the archive.
+*/
+inline size_t MatrixSerializer::alignedOffset( size_t start, size_t offset ) noexcept
+{
+   return nextMultiple( start + offset, alignment ) - start;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copies a part of a row/column of a dense matrix with contiguous rows or columns.
+//
+// \param mat The dense matrix.
+// \param i The index of the row (or column in case of a column-major matrix).
+// \param j The index of the first element within the row/column.
+// \param k The number of elements to be copied.
+// \param dst The destination of the elements.
+// \return void
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+inline EnableIf_t< IsContiguous_v<MT> && HasConstDataAccess_v<MT> >
+   MatrixSerializer::gatherElements( const DenseMatrix<MT,SO>& mat, size_t i, size_t j,
+                                     size_t k, byte_t* dst )
+{
+   std::memcpy( dst, (*mat).data(i) + j, k*sizeof( ElementType_t<MT> ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copies a part of a row/column of a dense matrix.
+//
+// \param mat The dense matrix.
+// \param i The index of the row (or column in case of a column-major matrix).
+// \param j The index of the first element within the row/column.
+// \param k The number of elements to be copied.
+// \param dst The destination of the elements.
+// \return void
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+inline DisableIf_t< IsContiguous_v<MT> && HasConstDataAccess_v<MT> >
+   MatrixSerializer::gatherElements( const DenseMatrix<MT,SO>& mat, size_t i, size_t j,
+                                     size_t k, byte_t* dst )
+{
+   using ET = ElementType_t<MT>;
+
+   for( size_t l=0UL; l<k; ++l ) {
+      const ET value( ( SO == rowMajor )?( (*mat)(i,j+l) ):( (*mat)(j+l,i) ) );
+      std::memcpy( dst + l*sizeof( ET ), &value, sizeof( ET ) );
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
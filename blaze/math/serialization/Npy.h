@@ -0,0 +1,1391 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/Npy.h
+//  \brief Header file for the NumPy .npy file format
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SERIALIZATION_NPY_H_
+#define _BLAZE_MATH_SERIALIZATION_NPY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <complex>
+#include <cstring>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/CustomVector.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/shims/NextMultiple.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsDenseVector.h>
+#include <blaze/math/typetraits/UnderlyingElement.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/serialization/MappedFile.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/IsSigned.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NPY ARRAY DESCRIPTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Description of an array stored in the NumPy .npy format.
+// \ingroup math_serialization
+//
+// The NpyArray structure represents the information contained in the header of a .npy file,
+// i.e. the element type, the memory layout, and the shape of the stored array. Additionally it
+// contains the offset of the first element from the beginning of the file.
+*/
+struct NpyArray
+{
+   char   kind;               //!< The kind of the elements ('b', 'i', 'u', 'f', or 'c').
+   size_t size;               //!< The size of a single element in bytes.
+   bool   swap;               //!< \a true in case the byte order is not the native byte order.
+   bool   fortran;            //!< \a true in case the elements are stored in column-major order.
+   std::vector<size_t> shape; //!< The extents of all dimensions of the array.
+   size_t offset;             //!< The offset of the first element from the beginning of the file.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NPY HEADER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the platform stores multi-byte values in little endian byte order.
+// \ingroup math_serialization
+//
+// \return \a true in case of a little endian platform, \a false if not.
+*/
+inline bool isLittleEndian() noexcept
+{
+   const uint16_t probe( 1U );
+   uint8_t first( 0U );
+   std::memcpy( &first, &probe, 1UL );
+   return first == 1U;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the NumPy type descriptor of the given element type.
+// \ingroup math_serialization
+//
+// \return The type descriptor (as for instance "<f8" for \c double on little endian platforms).
+*/
+template< typename ET >  // Type of the elements
+std::string npyDescr()
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ET );
+
+   const char order( sizeof( ET ) == 1UL ? '|' : ( isLittleEndian() ? '<' : '>' ) );
+   const char kind ( IsComplex_v<ET>       ? 'c'
+                   : IsFloatingPoint_v<ET> ? 'f'
+                   : IsSigned_v<ET>        ? 'i'
+                   :                         'u' );
+
+   return std::string( 1UL, order ) + kind + std::to_string( sizeof( ET ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates the header of a .npy file.
+// \ingroup math_serialization
+//
+// \param descr The type descriptor of the elements.
+// \param fortran \a true in case the elements are stored in column-major order.
+// \param shape The extents of all dimensions of the array.
+// \return The complete header including the magic string and the format version.
+//
+// The header is padded such that the first element starts at a 64-byte boundary. In case the
+// header does not fit into a version 1.0 header, a version 2.0 header is created.
+*/
+inline std::string npyHeader( const std::string& descr, bool fortran,
+                              const std::vector<size_t>& shape )
+{
+   std::string dict( "{'descr': '" + descr + "', 'fortran_order': " +
+                     ( fortran ? "True" : "False" ) + ", 'shape': (" );
+
+   for( size_t k=0UL; k<shape.size(); ++k ) {
+      if( k > 0UL ) dict += ", ";
+      dict += std::to_string( shape[k] );
+   }
+
+   dict += ( shape.size() == 1UL ? ",), }" : "), }" );
+
+   const size_t prefix( dict.size() + 64UL > 65535UL ? 12UL : 10UL );
+   const size_t length( nextMultiple( prefix + dict.size() + 1UL, 64UL ) - prefix );
+
+   dict.append( length - dict.size() - 1UL, ' ' );
+   dict += '\n';
+
+   std::string header( "\x93NUMPY" );
+   header += static_cast<char>( prefix == 10UL ? 1 : 2 );
+   header += '\0';
+
+   for( size_t k=0UL; k<prefix-8UL; ++k ) {
+      header += static_cast<char>( ( length >> ( 8UL*k ) ) & 0xFFUL );
+   }
+
+   return header + dict;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Locates the value of the given key within the header dictionary of a .npy file.
+// \ingroup math_serialization
+//
+// \param first The first character of the dictionary.
+// \param last One past the last character of the dictionary.
+// \param key The key to be located.
+// \return Pointer to the first character of the value, \a last in case the key is not found.
+*/
+inline const char* findNpyValue( const char* first, const char* last, const std::string& key )
+{
+   for( const char quote : { '\'', '"' } )
+   {
+      const std::string pattern( quote + key + quote );
+      const char* pos( std::search( first, last, pattern.begin(), pattern.end() ) );
+
+      if( pos != last ) {
+         pos += pattern.size();
+         while( pos != last && ( *pos == ' ' || *pos == ':' ) ) ++pos;
+         return pos;
+      }
+   }
+
+   return last;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parses the header of a .npy file.
+// \ingroup math_serialization
+//
+// \param data The first byte of the .npy file.
+// \param size The size of the .npy file in bytes.
+// \return The description of the stored array.
+// \exception std::runtime_error Invalid file format detected.
+// \exception std::runtime_error Invalid version detected.
+// \exception std::runtime_error Invalid element type detected.
+// \exception std::runtime_error Corrupt file detected.
+//
+// This function parses and validates the header of a .npy file of version 1.0, 2.0, or 3.0. It
+// checks that the file is large enough to hold all elements of the stored array.
+*/
+inline NpyArray parseNpy( const byte_t* data, size_t size )
+{
+   if( size < 10UL || std::memcmp( data, "\x93NUMPY", 6UL ) != 0 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid file format detected" );
+   }
+
+   const size_t prefix( data[6] == 1U ? 10UL : 12UL );
+
+   if( data[6] < 1U || data[6] > 3U ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid version detected" );
+   }
+   else if( size < prefix ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt file detected" );
+   }
+
+   size_t length( 0UL );
+   for( size_t k=8UL; k<prefix; ++k ) {
+      length |= static_cast<size_t>( data[k] ) << ( 8UL*( k-8UL ) );
+   }
+
+   if( length > size - prefix ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt file detected" );
+   }
+
+   const char* const first( reinterpret_cast<const char*>( data + prefix ) );
+   const char* const last ( first + length );
+
+   NpyArray array{};
+   array.offset = prefix + length;
+
+   // Parsing the type descriptor
+   const char* pos( findNpyValue( first, last, "descr" ) );
+
+   if( pos == last || ( *pos != '\'' && *pos != '"' ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element type detected" );
+   }
+
+   const char* const end( std::find( pos+1, last, *pos ) );
+   std::string descr( pos+1, end );
+
+   if( !descr.empty() && std::string( "<>|=" ).find( descr[0] ) != std::string::npos ) {
+      array.swap = ( descr[0] == '<' && !isLittleEndian() ) ||
+                   ( descr[0] == '>' &&  isLittleEndian() );
+      descr.erase( 0UL, 1UL );
+   }
+
+   const auto isDigit( []( char c ){ return c >= '0' && c <= '9'; } );
+
+   if( descr.size() < 2UL || descr.size() > 3UL ||
+       !std::all_of( descr.begin()+1, descr.end(), isDigit ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element type detected" );
+   }
+
+   array.kind = descr[0];
+   array.size = std::stoul( descr.substr( 1UL ) );
+
+   const size_t bytes( array.size );
+
+   const bool valid( ( array.kind == 'b' && bytes == 1UL ) ||
+                     ( ( array.kind == 'i' || array.kind == 'u' ) &&
+                       ( bytes == 1UL || bytes == 2UL || bytes == 4UL || bytes == 8UL ) ) ||
+                     ( array.kind == 'f' && ( bytes == 4UL || bytes == 8UL ) ) ||
+                     ( array.kind == 'c' && ( bytes == 8UL || bytes == 16UL ) ) );
+
+   if( !valid ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element type detected" );
+   }
+
+   // Parsing the memory layout
+   pos = findNpyValue( first, last, "fortran_order" );
+
+   if( last - pos >= 4 && std::string( pos, pos+4 ) == "True" ) {
+      array.fortran = true;
+   }
+   else if( last - pos < 5 || std::string( pos, pos+5 ) != "False" ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid file format detected" );
+   }
+
+   // Parsing the shape
+   pos = findNpyValue( first, last, "shape" );
+
+   if( pos == last || *pos != '(' ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid file format detected" );
+   }
+
+   size_t number( 1UL );
+
+   for( ++pos; pos != last && *pos != ')'; )
+   {
+      if( *pos == ' ' || *pos == ',' || *pos == 'L' ) {
+         ++pos;
+         continue;
+      }
+
+      size_t extent( 0UL );
+      const char* const digits( pos );
+
+      for( ; pos != last && *pos >= '0' && *pos <= '9'; ++pos ) {
+         if( extent > ( size_t(-1) - 9UL ) / 10UL ) {
+            BLAZE_THROW_RUNTIME_ERROR( "Invalid file format detected" );
+         }
+         extent = extent*10UL + static_cast<size_t>( *pos - '0' );
+      }
+
+      if( pos == digits ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid file format detected" );
+      }
+
+      if( extent != 0UL && number > size_t(-1) / extent ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Corrupt file detected" );
+      }
+
+      number *= extent;
+      array.shape.push_back( extent );
+   }
+
+   if( pos == last ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid file format detected" );
+   }
+
+   if( number > ( size - array.offset ) / array.size ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt file detected" );
+   }
+
+   return array;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NPY ELEMENT CONVERSION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Loads a single element of a .npy file.
+// \ingroup math_serialization
+//
+// \param src The first byte of the element.
+// \param swap \a true in case the byte order of the element has to be reversed.
+// \return The loaded element.
+//
+// In case of complex elements the byte order of the real and the imaginary part is reversed
+// separately.
+*/
+template< typename ST >  // Type of the stored element
+inline ST loadNpyElement( const byte_t* src, bool swap ) noexcept
+{
+   byte_t bytes[sizeof( ST )];
+   std::memcpy( bytes, src, sizeof( ST ) );
+
+   if( swap ) {
+      constexpr size_t width( IsComplex_v<ST> ? sizeof( ST ) / 2UL : sizeof( ST ) );
+      for( size_t k=0UL; k<sizeof( ST ); k+=width ) {
+         std::reverse( bytes+k, bytes+k+width );
+      }
+   }
+
+   ST value;
+   std::memcpy( &value, bytes, sizeof( ST ) );
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts a real element of a .npy file to the given element type.
+// \ingroup math_serialization
+//
+// \param value The stored element.
+// \return The converted element.
+*/
+template< typename ET    // Type of the target element
+        , typename ST >  // Type of the stored element
+inline EnableIf_t< !IsComplex_v<ST>, ET > npyCast( const ST& value )
+{
+   return static_cast<ET>( value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts a complex element of a .npy file to the given complex element type.
+// \ingroup math_serialization
+//
+// \param value The stored element.
+// \return The converted element.
+*/
+template< typename ET    // Type of the target element
+        , typename ST >  // Type of the stored element
+inline EnableIf_t< IsComplex_v<ST>, ET > npyCast( const ST& value )
+{
+   using BT = UnderlyingElement_t<ET>;
+
+   return ET( static_cast<BT>( value.real() ), static_cast<BT>( value.imag() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts a range of elements of a .npy file.
+// \ingroup math_serialization
+//
+// \param src The first byte of the first element.
+// \param n The number of elements.
+// \param swap \a true in case the byte order of the elements has to be reversed.
+// \param dst The first target element.
+// \return void
+*/
+template< typename ST    // Type of the stored elements
+        , typename ET >  // Type of the target elements
+void convertNpyElements( const byte_t* src, size_t n, bool swap, ET* dst )
+{
+   if( IsSame_v<ST,ET> && !swap ) {
+      if( n > 0UL ) std::memcpy( dst, src, n*sizeof( ET ) );
+      return;
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      dst[i] = npyCast<ET>( loadNpyElement<ST>( src + i*sizeof( ST ), swap ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts a range of complex elements of a .npy file to a complex element type.
+// \ingroup math_serialization
+//
+// \param array The description of the stored array.
+// \param src The first byte of the first element.
+// \param n The number of elements.
+// \param dst The first target element.
+// \return void
+*/
+template< typename ET >  // Type of the target elements
+void convertNpyComplex( const NpyArray& array, const byte_t* src, size_t n, ET* dst, TrueType )
+{
+   if( array.size == 8UL ) convertNpyElements< complex<float>  >( src, n, array.swap, dst );
+   else                    convertNpyElements< complex<double> >( src, n, array.swap, dst );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Rejects the conversion of complex elements of a .npy file to a real element type.
+// \ingroup math_serialization
+//
+// \param array The description of the stored array.
+// \param src The first byte of the first element.
+// \param n The number of elements.
+// \param dst The first target element.
+// \return void
+// \exception std::runtime_error Invalid element type detected.
+*/
+template< typename ET >  // Type of the target elements
+void convertNpyComplex( const NpyArray& array, const byte_t* src, size_t n, ET* dst, FalseType )
+{
+   MAYBE_UNUSED( array, src, n, dst );
+
+   BLAZE_THROW_RUNTIME_ERROR( "Invalid element type detected" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts a range of elements of a .npy file to the given element type.
+// \ingroup math_serialization
+//
+// \param array The description of the stored array.
+// \param src The first byte of the first element.
+// \param n The number of elements.
+// \param dst The first target element.
+// \return void
+// \exception std::runtime_error Invalid element type detected.
+//
+// This function converts the elements of any supported NumPy element type to the given target
+// element type. Complex elements can only be converted to a complex target element type.
+*/
+template< typename ET >  // Type of the target elements
+void convertNpy( const NpyArray& array, const byte_t* src, size_t n, ET* dst )
+{
+   const bool swap( array.swap );
+
+   switch( array.kind )
+   {
+      case 'b':
+         convertNpyElements<bool>( src, n, swap, dst );
+         break;
+      case 'i':
+         if     ( array.size == 1UL ) convertNpyElements<int8_t >( src, n, swap, dst );
+         else if( array.size == 2UL ) convertNpyElements<int16_t>( src, n, swap, dst );
+         else if( array.size == 4UL ) convertNpyElements<int32_t>( src, n, swap, dst );
+         else                         convertNpyElements<int64_t>( src, n, swap, dst );
+         break;
+      case 'u':
+         if     ( array.size == 1UL ) convertNpyElements<uint8_t >( src, n, swap, dst );
+         else if( array.size == 2UL ) convertNpyElements<uint16_t>( src, n, swap, dst );
+         else if( array.size == 4UL ) convertNpyElements<uint32_t>( src, n, swap, dst );
+         else                         convertNpyElements<uint64_t>( src, n, swap, dst );
+         break;
+      case 'f':
+         if( array.size == 4UL ) convertNpyElements<float >( src, n, swap, dst );
+         else                    convertNpyElements<double>( src, n, swap, dst );
+         break;
+      default:
+         convertNpyComplex( array, src, n, dst, BoolConstant< IsComplex_v<ET> >() );
+         break;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NPY READ FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies the elements of a .npy file into a dense vector with direct data access.
+// \ingroup math_serialization
+//
+// \param data The first byte of the .npy file.
+// \param array The description of the stored array.
+// \param vec The target vector.
+// \return void
+*/
+template< typename VT  // Type of the vector
+        , bool TF >    // Transpose flag
+EnableIf_t< IsDenseVector_v<VT> && IsContiguous_v<VT> && HasMutableDataAccess_v<VT> >
+   readNpyElements( const byte_t* data, const NpyArray& array, Vector<VT,TF>& vec )
+{
+   resize( *vec, array.shape[0], false );
+   convertNpy( array, data + array.offset, array.shape[0], (*vec).data() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies the elements of a .npy file into a vector without direct data access.
+// \ingroup math_serialization
+//
+// \param data The first byte of the .npy file.
+// \param array The description of the stored array.
+// \param vec The target vector.
+// \return void
+*/
+template< typename VT  // Type of the vector
+        , bool TF >    // Transpose flag
+DisableIf_t< IsDenseVector_v<VT> && IsContiguous_v<VT> && HasMutableDataAccess_v<VT> >
+   readNpyElements( const byte_t* data, const NpyArray& array, Vector<VT,TF>& vec )
+{
+   DynamicVector< ElementType_t<VT>, TF > tmp;
+   readNpyElements( data, array, tmp );
+   (*vec) = tmp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies the elements of a .npy file into a dense matrix with direct data access.
+// \ingroup math_serialization
+//
+// \param data The first byte of the .npy file.
+// \param array The description of the stored array.
+// \param mat The target matrix.
+// \return void
+//
+// In case the storage order of the stored array matches the storage order of the matrix, all
+// elements are converted directly into the rows (or columns) of the matrix. Otherwise the
+// elements are converted into a temporary matrix, which is subsequently assigned.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+EnableIf_t< IsDenseMatrix_v<MT> && IsContiguous_v<MT> && HasMutableDataAccess_v<MT> >
+   readNpyElements( const byte_t* data, const NpyArray& array, Matrix<MT,SO>& mat )
+{
+   if( array.fortran != ( SO == columnMajor ) ) {
+      DynamicMatrix< ElementType_t<MT>, !SO > tmp;
+      readNpyElements( data, array, tmp );
+      (*mat) = tmp;
+      return;
+   }
+
+   const size_t m( array.shape[0] );
+   const size_t n( array.shape[1] );
+
+   resize( *mat, m, n, false );
+
+   const size_t major( SO == rowMajor ? m : n );
+   const size_t minor( SO == rowMajor ? n : m );
+
+   for( size_t i=0UL; i<major; ++i ) {
+      convertNpy( array, data + array.offset + i*minor*array.size, minor, (*mat).data(i) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies the elements of a .npy file into a matrix without direct data access.
+// \ingroup math_serialization
+//
+// \param data The first byte of the .npy file.
+// \param array The description of the stored array.
+// \param mat The target matrix.
+// \return void
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+DisableIf_t< IsDenseMatrix_v<MT> && IsContiguous_v<MT> && HasMutableDataAccess_v<MT> >
+   readNpyElements( const byte_t* data, const NpyArray& array, Matrix<MT,SO>& mat )
+{
+   if( array.fortran ) {
+      DynamicMatrix< ElementType_t<MT>, columnMajor > tmp;
+      readNpyElements( data, array, tmp );
+      (*mat) = tmp;
+   }
+   else {
+      DynamicMatrix< ElementType_t<MT>, rowMajor > tmp;
+      readNpyElements( data, array, tmp );
+      (*mat) = tmp;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies the one-dimensional array of a .npy file into the given vector.
+// \ingroup math_serialization
+//
+// \param data The first byte of the .npy file.
+// \param array The description of the stored array.
+// \param vec The target vector.
+// \return void
+// \exception std::runtime_error Invalid number of dimensions detected.
+// \exception std::runtime_error Invalid element type detected.
+*/
+template< typename VT  // Type of the vector
+        , bool TF >    // Transpose flag
+void readNpyArray( const byte_t* data, const NpyArray& array, Vector<VT,TF>& vec )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ElementType_t<VT> );
+
+   if( array.shape.size() != 1UL ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of dimensions detected" );
+   }
+
+   readNpyElements( data, array, *vec );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies the two-dimensional array of a .npy file into the given matrix.
+// \ingroup math_serialization
+//
+// \param data The first byte of the .npy file.
+// \param array The description of the stored array.
+// \param mat The target matrix.
+// \return void
+// \exception std::runtime_error Invalid number of dimensions detected.
+// \exception std::runtime_error Invalid element type detected.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+void readNpyArray( const byte_t* data, const NpyArray& array, Matrix<MT,SO>& mat )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ElementType_t<MT> );
+
+   if( array.shape.size() != 2UL ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of dimensions detected" );
+   }
+
+   readNpyElements( data, array, *mat );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NPY WRITE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the elements of a dense vector with direct data access.
+// \ingroup math_serialization
+//
+// \param os The output stream.
+// \param vec The vector to be written.
+// \return void
+*/
+template< typename VT  // Type of the vector
+        , bool TF >    // Transpose flag
+EnableIf_t< IsDenseVector_v<VT> && IsContiguous_v<VT> && HasConstDataAccess_v<VT> >
+   writeNpyElements( std::ostream& os, const Vector<VT,TF>& vec )
+{
+   using ET = ElementType_t<VT>;
+
+   os.write( reinterpret_cast<const char*>( (*vec).data() ),
+             static_cast<std::streamsize>( size( *vec )*sizeof( ET ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the elements of a vector without direct data access.
+// \ingroup math_serialization
+//
+// \param os The output stream.
+// \param vec The vector to be written.
+// \return void
+*/
+template< typename VT  // Type of the vector
+        , bool TF >    // Transpose flag
+DisableIf_t< IsDenseVector_v<VT> && IsContiguous_v<VT> && HasConstDataAccess_v<VT> >
+   writeNpyElements( std::ostream& os, const Vector<VT,TF>& vec )
+{
+   const DynamicVector< ElementType_t<VT>, TF > tmp( *vec );
+   writeNpyElements( os, tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the elements of a dense matrix with direct data access.
+// \ingroup math_serialization
+//
+// \param os The output stream.
+// \param mat The matrix to be written.
+// \return void
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+EnableIf_t< IsDenseMatrix_v<MT> && IsContiguous_v<MT> && HasConstDataAccess_v<MT> >
+   writeNpyElements( std::ostream& os, const Matrix<MT,SO>& mat )
+{
+   using ET = ElementType_t<MT>;
+
+   const size_t major( SO == rowMajor ? rows( *mat ) : columns( *mat ) );
+   const size_t minor( SO == rowMajor ? columns( *mat ) : rows( *mat ) );
+
+   for( size_t i=0UL; i<major; ++i ) {
+      os.write( reinterpret_cast<const char*>( (*mat).data(i) ),
+                static_cast<std::streamsize>( minor*sizeof( ET ) ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the elements of a matrix without direct data access.
+// \ingroup math_serialization
+//
+// \param os The output stream.
+// \param mat The matrix to be written.
+// \return void
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+DisableIf_t< IsDenseMatrix_v<MT> && IsContiguous_v<MT> && HasConstDataAccess_v<MT> >
+   writeNpyElements( std::ostream& os, const Matrix<MT,SO>& mat )
+{
+   const DynamicMatrix< ElementType_t<MT>, SO > tmp( *mat );
+   writeNpyElements( os, tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the given vector as one-dimensional array in the .npy format.
+// \ingroup math_serialization
+//
+// \param os The output stream.
+// \param vec The vector to be written.
+// \return void
+*/
+template< typename VT  // Type of the vector
+        , bool TF >    // Transpose flag
+void writeNpyArray( std::ostream& os, const Vector<VT,TF>& vec )
+{
+   const std::string header( npyHeader( npyDescr< ElementType_t<VT> >(), false,
+                                        { size( *vec ) } ) );
+
+   os.write( header.data(), static_cast<std::streamsize>( header.size() ) );
+   writeNpyElements( os, *vec );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the given matrix as two-dimensional array in the .npy format.
+// \ingroup math_serialization
+//
+// \param os The output stream.
+// \param mat The matrix to be written.
+// \return void
+//
+// Row-major matrices are written in C order, column-major matrices are written in Fortran order.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+void writeNpyArray( std::ostream& os, const Matrix<MT,SO>& mat )
+{
+   const std::string header( npyHeader( npyDescr< ElementType_t<MT> >(), SO == columnMajor,
+                                        { rows( *mat ), columns( *mat ) } ) );
+
+   os.write( header.data(), static_cast<std::streamsize>( header.size() ) );
+   writeNpyElements( os, *mat );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name NumPy .npy functions */
+//@{
+template< typename VT, bool TF >
+void readNpy( const std::string& filename, Vector<VT,TF>& vec );
+
+template< typename MT, bool SO >
+void readNpy( const std::string& filename, Matrix<MT,SO>& mat );
+
+template< typename VT, bool TF >
+void writeNpy( const std::string& filename, const Vector<VT,TF>& vec );
+
+template< typename MT, bool SO >
+void writeNpy( const std::string& filename, const Matrix<MT,SO>& mat );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads a vector from a NumPy .npy file.
+// \ingroup math_serialization
+//
+// \param filename The name of the .npy file.
+// \param vec The vector to be read.
+// \return void
+// \exception std::runtime_error Error while reading the file.
+//
+// This function reads the one-dimensional array stored in the given .npy file into the given
+// vector. Arrays of any boolean, integral, floating point, and complex NumPy element type of
+// any byte order can be read. The elements are converted to the element type of the vector,
+// where complex elements can only be read into vectors with complex element type. The file is
+// mapped into memory, i.e. the elements are converted directly from the file contents.
+*/
+template< typename VT  // Type of the vector
+        , bool TF >    // Transpose flag
+void readNpy( const std::string& filename, Vector<VT,TF>& vec )
+{
+   const MappedFile file( filename );
+
+   readNpyArray( file.data(), parseNpy( file.data(), file.size() ), *vec );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads a matrix from a NumPy .npy file.
+// \ingroup math_serialization
+//
+// \param filename The name of the .npy file.
+// \param mat The matrix to be read.
+// \return void
+// \exception std::runtime_error Error while reading the file.
+//
+// This function reads the two-dimensional array stored in the given .npy file into the given
+// matrix. Arrays of any boolean, integral, floating point, and complex NumPy element type of
+// any byte order can be read. Both C and Fortran order are supported. In case the order of the
+// stored array matches the storage order of a dense matrix with direct data access, the rows
+// (or columns) are converted directly into the matrix.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+void readNpy( const std::string& filename, Matrix<MT,SO>& mat )
+{
+   const MappedFile file( filename );
+
+   readNpyArray( file.data(), parseNpy( file.data(), file.size() ), *mat );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes a vector to a NumPy .npy file.
+// \ingroup math_serialization
+//
+// \param filename The name of the .npy file.
+// \param vec The vector to be written.
+// \return void
+// \exception std::runtime_error File could not be written.
+//
+// This function writes the given vector as one-dimensional array to the given .npy file, which
+// can be loaded via \c numpy.load(). The first element is stored at a 64-byte boundary.
+*/
+template< typename VT  // Type of the vector
+        , bool TF >    // Transpose flag
+void writeNpy( const std::string& filename, const Vector<VT,TF>& vec )
+{
+   std::ofstream os( filename, std::ofstream::binary | std::ofstream::trunc );
+
+   writeNpyArray( os, *vec );
+   os.close();
+
+   if( !os ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be written" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes a matrix to a NumPy .npy file.
+// \ingroup math_serialization
+//
+// \param filename The name of the .npy file.
+// \param mat The matrix to be written.
+// \return void
+// \exception std::runtime_error File could not be written.
+//
+// This function writes the given matrix as two-dimensional array to the given .npy file, which
+// can be loaded via \c numpy.load(). Row-major matrices are written in C order, column-major
+// matrices are written in Fortran order. The first element is stored at a 64-byte boundary.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+void writeNpy( const std::string& filename, const Matrix<MT,SO>& mat )
+{
+   std::ofstream os( filename, std::ofstream::binary | std::ofstream::trunc );
+
+   writeNpyArray( os, *mat );
+   os.close();
+
+   if( !os ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be written" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS MAPPEDNPY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Memory-mapped NumPy .npy file.
+// \ingroup math_serialization
+//
+// The MappedNpy class maps a NumPy .npy file into memory. The stored array can be bound to a
+// CustomVector or CustomMatrix without copying any element, which makes loading independent of
+// the size of the file:
+
+   \code
+   using blaze::unaligned;
+   using blaze::unpadded;
+   using blaze::rowMajor;
+
+   blaze::MappedNpy npy( "weights.npy" );
+
+   blaze::CustomMatrix<const float,unaligned,unpadded,rowMajor> W;
+   npy >> W;  // No elements are copied
+   \endcode
+
+// In order to be bound, the stored array must have exactly the element type of the custom
+// vector or matrix in native byte order. A custom matrix requires a two-dimensional array in
+// C order (for row-major matrices) or Fortran order (for column-major matrices), a custom vector
+// requires a one-dimensional array. Since the first element of a .npy file written by NumPy or
+// \b Blaze starts at a 64-byte boundary, aligned custom vectors can be bound as well. Since a
+// .npy file does not contain any padding, aligned custom matrices and padded custom vectors and
+// matrices can only be bound in case the number of elements per row (or column) is a multiple
+// of the SIMD width. Any other kind of vector or matrix is read by converting the elements out
+// of the mapped file (see readNpy()).
+//
+// The file is mapped copy-on-write, i.e. modifications of bound vectors and matrices are never
+// written back to the file. The mapping is released when the MappedNpy instance is destroyed.
+// Thus all custom vectors and matrices bound to it must not be used beyond its lifetime.
+*/
+class MappedNpy
+   : private NonCopyable
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MappedNpy( const std::string& filename );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline const std::vector<size_t>& shape() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Deserialization functions*******************************************************************
+   /*!\name Deserialization functions */
+   //@{
+   template< typename Type, AlignmentFlag AF, PaddingFlag PF, bool TF, typename Tag, typename RT >
+   MappedNpy& operator>>( CustomVector<Type,AF,PF,TF,Tag,RT>& vec );
+
+   template< typename Type, AlignmentFlag AF, PaddingFlag PF, bool SO, typename Tag, typename RT >
+   MappedNpy& operator>>( CustomMatrix<Type,AF,PF,SO,Tag,RT>& mat );
+
+   template< typename VT, bool TF >
+   MappedNpy& operator>>( Vector<VT,TF>& vec );
+
+   template< typename MT, bool SO >
+   MappedNpy& operator>>( Matrix<MT,SO>& mat );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   Type* payload() const;
+
+   template< typename Type, AlignmentFlag AF, bool TF, typename Tag, typename RT >
+   static void bind( CustomVector<Type,AF,unpadded,TF,Tag,RT>& vec, Type* ptr, size_t n );
+
+   template< typename Type, AlignmentFlag AF, bool TF, typename Tag, typename RT >
+   static void bind( CustomVector<Type,AF,padded,TF,Tag,RT>& vec, Type* ptr, size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MappedFile file_;   //!< The mapped .npy file.
+   NpyArray   array_;  //!< The description of the stored array.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Maps the given .npy file into memory.
+//
+// \param filename The name of the .npy file.
+// \exception std::runtime_error File could not be mapped.
+// \exception std::runtime_error Invalid .npy file detected.
+*/
+inline MappedNpy::MappedNpy( const std::string& filename )
+   : file_ ( filename )                                // The mapped .npy file
+   , array_( parseNpy( file_.data(), file_.size() ) )  // The description of the stored array
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the shape of the stored array.
+//
+// \return The extents of all dimensions of the stored array.
+*/
+inline const std::vector<size_t>& MappedNpy::shape() const noexcept
+{
+   return array_.shape;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a pointer to the stored elements for a custom vector or matrix.
+//
+// \return Pointer to the first stored element.
+// \exception std::runtime_error Invalid element type detected.
+// \exception std::runtime_error Invalid payload alignment detected.
+*/
+template< typename Type >  // Data type of the elements
+Type* MappedNpy::payload() const
+{
+   using ET = RemoveConst_t<Type>;
+
+   const std::string descr( array_.kind + std::to_string( array_.size ) );
+
+   if( array_.swap || npyDescr<ET>().substr( 1UL ) != descr ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element type detected" );
+   }
+
+   byte_t* const ptr( file_.data() + array_.offset );
+
+   if( reinterpret_cast<size_t>( ptr ) % alignof( ET ) != 0UL ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid payload alignment detected" );
+   }
+
+   return reinterpret_cast<Type*>( ptr );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Binds the given unpadded custom vector to the given array of elements.
+//
+// \param vec The custom vector to be bound.
+// \param ptr The array of elements.
+// \param n The number of elements.
+// \return void
+*/
+template< typename Type     // Data type of the vector
+        , AlignmentFlag AF  // Alignment flag
+        , bool TF           // Transpose flag
+        , typename Tag      // Type tag
+        , typename RT >     // Result type
+void MappedNpy::bind( CustomVector<Type,AF,unpadded,TF,Tag,RT>& vec, Type* ptr, size_t n )
+{
+   vec.reset( ptr, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Binds the given padded custom vector to the given array of elements.
+//
+// \param vec The custom vector to be bound.
+// \param ptr The array of elements.
+// \param n The number of elements.
+// \return void
+// \exception std::invalid_argument Invalid setup of custom vector.
+//
+// Since the stored array does not contain any padding elements, the number of elements has to
+// be a multiple of the SIMD width.
+*/
+template< typename Type     // Data type of the vector
+        , AlignmentFlag AF  // Alignment flag
+        , bool TF           // Transpose flag
+        , typename Tag      // Type tag
+        , typename RT >     // Result type
+void MappedNpy::bind( CustomVector<Type,AF,padded,TF,Tag,RT>& vec, Type* ptr, size_t n )
+{
+   vec.reset( ptr, n, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESERIALIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Binds the given custom vector to the stored array.
+//
+// \param vec The custom vector to be bound to the mapped file.
+// \return Reference to the mapped file.
+// \exception std::runtime_error Invalid number of dimensions detected.
+// \exception std::runtime_error Invalid element type detected.
+// \exception std::invalid_argument Invalid alignment or padding of the stored array.
+*/
+template< typename Type     // Data type of the vector
+        , AlignmentFlag AF  // Alignment flag
+        , PaddingFlag PF    // Padding flag
+        , bool TF           // Transpose flag
+        , typename Tag      // Type tag
+        , typename RT >     // Result type
+MappedNpy& MappedNpy::operator>>( CustomVector<Type,AF,PF,TF,Tag,RT>& vec )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+
+   if( array_.shape.size() != 1UL ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of dimensions detected" );
+   }
+
+   bind( vec, payload<Type>(), array_.shape[0] );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Binds the given custom matrix to the stored array.
+//
+// \param mat The custom matrix to be bound to the mapped file.
+// \return Reference to the mapped file.
+// \exception std::runtime_error Invalid number of dimensions detected.
+// \exception std::runtime_error Invalid element type detected.
+// \exception std::runtime_error Invalid storage order detected.
+// \exception std::invalid_argument Invalid alignment or padding of the stored array.
+*/
+template< typename Type     // Data type of the matrix
+        , AlignmentFlag AF  // Alignment flag
+        , PaddingFlag PF    // Padding flag
+        , bool SO           // Storage order
+        , typename Tag      // Type tag
+        , typename RT >     // Result type
+MappedNpy& MappedNpy::operator>>( CustomMatrix<Type,AF,PF,SO,Tag,RT>& mat )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+
+   if( array_.shape.size() != 2UL ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of dimensions detected" );
+   }
+   else if( array_.fortran != ( SO == columnMajor ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid storage order detected" );
+   }
+
+   const size_t m( array_.shape[0] );
+   const size_t n( array_.shape[1] );
+
+   mat.reset( payload<Type>(), m, n, SO == rowMajor ? n : m );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads the stored array into the given vector.
+//
+// \param vec The vector to be read.
+// \return Reference to the mapped file.
+// \exception std::runtime_error Error while reading the stored array.
+//
+// This function converts the elements of the stored one-dimensional array out of the mapped
+// file into the given vector (see readNpy()).
+*/
+template< typename VT  // Type of the vector
+        , bool TF >    // Transpose flag
+MappedNpy& MappedNpy::operator>>( Vector<VT,TF>& vec )
+{
+   readNpyArray( file_.data(), array_, *vec );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads the stored array into the given matrix.
+//
+// \param mat The matrix to be read.
+// \return Reference to the mapped file.
+// \exception std::runtime_error Error while reading the stored array.
+//
+// This function converts the elements of the stored two-dimensional array out of the mapped
+// file into the given matrix (see readNpy()).
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+MappedNpy& MappedNpy::operator>>( Matrix<MT,SO>& mat )
+{
+   readNpyArray( file_.data(), array_, *mat );
+
+   return *this;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,996 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/Npz.h
+//  \brief Header file for the NumPy .npz file format
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SERIALIZATION_NPZ_H_
+#define _BLAZE_MATH_SERIALIZATION_NPZ_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <fstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/serialization/Inflater.h>
+#include <blaze/math/serialization/Npy.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/serialization/MappedFile.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ZIP UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Updates the CRC-32 checksum (as used by the ZIP format) with the given data.
+// \ingroup math_serialization
+//
+// \param crc The current checksum (0 for the initial checksum).
+// \param data The data to be added to the checksum.
+// \param size The size of the data in bytes.
+// \return The updated checksum.
+//
+// The checksum is computed by means of the slicing-by-8 algorithm, which processes eight bytes
+// per step.
+*/
+inline uint32_t crc32( uint32_t crc, const byte_t* data, size_t size ) noexcept
+{
+   struct Table {
+      Table() noexcept {
+         for( uint32_t i=0U; i<256U; ++i ) {
+            uint32_t value( i );
+            for( size_t k=0UL; k<8UL; ++k ) {
+               value = ( value & 1U ) ? ( 0xEDB88320U ^ ( value >> 1U ) ) : ( value >> 1U );
+            }
+            entries[0][i] = value;
+         }
+         for( uint32_t i=0U; i<256U; ++i ) {
+            for( size_t k=1UL; k<8UL; ++k ) {
+               entries[k][i] = ( entries[k-1UL][i] >> 8U ) ^ entries[0][entries[k-1UL][i] & 0xFFU];
+            }
+         }
+      }
+      uint32_t entries[8][256];
+   };
+
+   static const Table table;
+   const auto& t( table.entries );
+
+   crc = ~crc;
+
+   for( ; size >= 8UL; data += 8UL, size -= 8UL ) {
+      const uint32_t low ( crc ^ ( uint32_t( data[0] )         | uint32_t( data[1] ) <<  8U |
+                                   uint32_t( data[2] ) << 16U  | uint32_t( data[3] ) << 24U ) );
+      const uint32_t high( uint32_t( data[4] )         | uint32_t( data[5] ) <<  8U |
+                           uint32_t( data[6] ) << 16U  | uint32_t( data[7] ) << 24U );
+      crc = t[7][ low         & 0xFFU] ^ t[6][( low  >>  8U ) & 0xFFU] ^
+            t[5][( low >> 16U ) & 0xFFU] ^ t[4][  low  >> 24U          ] ^
+            t[3][ high        & 0xFFU] ^ t[2][( high >>  8U ) & 0xFFU] ^
+            t[1][( high >> 16U ) & 0xFFU] ^ t[0][  high >> 24U          ];
+   }
+
+   for( ; size > 0UL; ++data, --size ) {
+      crc = ( crc >> 8U ) ^ t[0][( crc ^ *data ) & 0xFFU];
+   }
+
+   return ~crc;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads a little endian value of the ZIP format.
+// \ingroup math_serialization
+//
+// \param data The first byte of the value.
+// \return The value.
+*/
+template< typename T >  // Type of the value
+inline T zipValue( const byte_t* data ) noexcept
+{
+   T value( 0 );
+   for( size_t k=0UL; k<sizeof( T ); ++k ) {
+      value |= static_cast<T>( static_cast<T>( data[k] ) << ( 8UL*k ) );
+   }
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes a little endian value of the ZIP format.
+// \ingroup math_serialization
+//
+// \param os The output stream.
+// \param value The value to be written.
+// \return void
+*/
+template< typename T >  // Type of the value
+inline void writeZipValue( std::ostream& os, T value )
+{
+   char bytes[sizeof( T )];
+   for( size_t k=0UL; k<sizeof( T ); ++k ) {
+      bytes[k] = static_cast<char>( ( static_cast<uint64_t>( value ) >> ( 8UL*k ) ) & 0xFFU );
+   }
+   os.write( bytes, sizeof( T ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS NPZWRITER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writer for NumPy .npz files.
+// \ingroup math_serialization
+//
+// The NpzWriter class writes a collection of named vectors and matrices to a NumPy .npz file,
+// i.e. a ZIP archive that contains one .npy file per array (see writeNpy()). The resulting file
+// can be loaded via \c numpy.load():
+
+   \code
+   blaze::DynamicMatrix<double> W( 100UL, 50UL );
+   blaze::DynamicVector<double> b( 100UL );
+   // ... Initialization
+
+   blaze::NpzWriter npz( "model.npz" );
+   npz.write( "W", W );
+   npz.write( "b", b );
+   npz.close();
+   \endcode
+
+// The arrays are stored uncompressed, such that each of them can be read directly out of the
+// archive (see NpzReader). The ZIP64 extensions are used for archives and arrays larger than
+// 4 GiB. The archive is only complete after a call to close(), which is also called by the
+// destructor.
+*/
+class NpzWriter
+   : private NonCopyable
+{
+ private:
+   //**Private struct Entry************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Directory entry of a written array.
+   */
+   struct Entry
+   {
+      std::string name;    //!< The file name of the array.
+      uint32_t    crc;     //!< The CRC-32 checksum of the .npy file.
+      uint64_t    size;    //!< The size of the .npy file in bytes.
+      uint64_t    offset;  //!< The offset of the local header within the archive.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Private class ChecksumBuffer****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Stream buffer computing the checksum and size of all data passed to another buffer.
+   */
+   class ChecksumBuffer
+      : public std::streambuf
+   {
+    public:
+      explicit ChecksumBuffer( std::streambuf* sink ) : sink_( sink ), crc_( 0U ), size_( 0UL ) {}
+
+      uint32_t crc () const noexcept { return crc_;  }
+      uint64_t size() const noexcept { return size_; }
+
+    protected:
+      std::streamsize xsputn( const char* s, std::streamsize n ) override {
+         crc_   = crc32( crc_, reinterpret_cast<const byte_t*>( s ), static_cast<size_t>( n ) );
+         size_ += static_cast<uint64_t>( n );
+         return sink_->sputn( s, n );
+      }
+
+      int_type overflow( int_type c ) override {
+         if( traits_type::eq_int_type( c, traits_type::eof() ) ) return traits_type::not_eof( c );
+         const char ch( traits_type::to_char_type( c ) );
+         return ( xsputn( &ch, 1 ) == 1 ) ? c : traits_type::eof();
+      }
+
+    private:
+      std::streambuf* sink_;  //!< The stream buffer receiving the data.
+      uint32_t        crc_;   //!< The checksum of the data.
+      uint64_t        size_;  //!< The size of the data in bytes.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline NpzWriter( const std::string& filename );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~NpzWriter();
+   //@}
+   //**********************************************************************************************
+
+   //**Write functions*****************************************************************************
+   /*!\name Write functions */
+   //@{
+   template< typename VT, bool TF >
+   void write( const std::string& name, const Vector<VT,TF>& vec );
+
+   template< typename MT, bool SO >
+   void write( const std::string& name, const Matrix<MT,SO>& mat );
+
+   inline void close();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename T >
+   void writeEntry( const std::string& name, const T& obj );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::ofstream      os_;       //!< The output stream of the archive.
+   std::vector<Entry> entries_;  //!< The directory entries of all written arrays.
+   bool               closed_;   //!< Flag for a closed archive.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a new .npz file.
+//
+// \param filename The name of the .npz file.
+// \exception std::runtime_error File could not be opened.
+//
+// An existing file of the given name is replaced.
+*/
+inline NpzWriter::NpzWriter( const std::string& filename )
+   : os_     ( filename, std::ofstream::binary | std::ofstream::trunc )  // The output stream
+   , entries_()                                                          // The directory entries
+   , closed_ ( false )                                                   // Flag for closed archive
+{
+   if( !os_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be opened" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor of the NpzWriter class.
+//
+// The destructor completes the archive in case close() has not been called explicitly. Since
+// errors cannot be reported by the destructor, calling close() explicitly is recommended.
+*/
+inline NpzWriter::~NpzWriter()
+{
+   try {
+      close();
+   }
+   catch( ... ) {}
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  WRITE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writes the given vector as one-dimensional array to the archive.
+//
+// \param name The name of the array.
+// \param vec The vector to be written.
+// \return void
+// \exception std::runtime_error File could not be written.
+//
+// The vector is stored as the file \a name.npy within the archive and can be accessed via
+// \c numpy.load( ... )[name].
+*/
+template< typename VT  // Type of the vector
+        , bool TF >    // Transpose flag
+void NpzWriter::write( const std::string& name, const Vector<VT,TF>& vec )
+{
+   writeEntry( name, *vec );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given matrix as two-dimensional array to the archive.
+//
+// \param name The name of the array.
+// \param mat The matrix to be written.
+// \return void
+// \exception std::runtime_error File could not be written.
+//
+// The matrix is stored as the file \a name.npy within the archive and can be accessed via
+// \c numpy.load( ... )[name]. Row-major matrices are stored in C order, column-major matrices
+// are stored in Fortran order.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+void NpzWriter::write( const std::string& name, const Matrix<MT,SO>& mat )
+{
+   writeEntry( name, *mat );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Completes the archive by writing the central directory.
+//
+// \return void
+// \exception std::runtime_error File could not be written.
+//
+// After the archive has been closed, no more arrays can be written. Subsequent calls of close()
+// have no effect.
+*/
+inline void NpzWriter::close()
+{
+   if( closed_ ) return;
+
+   closed_ = true;
+
+   const uint64_t start( static_cast<uint64_t>( os_.tellp() ) );
+
+   for( const Entry& entry : entries_ )
+   {
+      const bool large( entry.size   >= 0xFFFFFFFFULL );
+      const bool far  ( entry.offset >= 0xFFFFFFFFULL );
+      const uint16_t extra( ( large || far ) ? 4U + ( large ? 16U : 0U ) + ( far ? 8U : 0U ) : 0U );
+
+      writeZipValue<uint32_t>( os_, 0x02014B50U );  // Central directory signature
+      writeZipValue<uint16_t>( os_, 45U );          // Version made by
+      writeZipValue<uint16_t>( os_, 45U );          // Version needed to extract
+      writeZipValue<uint16_t>( os_, 0U );           // General purpose flags
+      writeZipValue<uint16_t>( os_, 0U );           // Compression method (stored)
+      writeZipValue<uint16_t>( os_, 0U );           // Modification time
+      writeZipValue<uint16_t>( os_, 0x21U );        // Modification date (1980-01-01)
+      writeZipValue<uint32_t>( os_, entry.crc );
+      writeZipValue<uint32_t>( os_, large ? 0xFFFFFFFFU : static_cast<uint32_t>( entry.size ) );
+      writeZipValue<uint32_t>( os_, large ? 0xFFFFFFFFU : static_cast<uint32_t>( entry.size ) );
+      writeZipValue<uint16_t>( os_, static_cast<uint16_t>( entry.name.size() ) );
+      writeZipValue<uint16_t>( os_, extra );
+      writeZipValue<uint16_t>( os_, 0U );           // File comment length
+      writeZipValue<uint16_t>( os_, 0U );           // Disk number start
+      writeZipValue<uint16_t>( os_, 0U );           // Internal file attributes
+      writeZipValue<uint32_t>( os_, 0x01800000U );  // External file attributes (rw-------)
+      writeZipValue<uint32_t>( os_, far ? 0xFFFFFFFFU : static_cast<uint32_t>( entry.offset ) );
+      os_.write( entry.name.data(), static_cast<std::streamsize>( entry.name.size() ) );
+
+      if( extra > 0U ) {
+         writeZipValue<uint16_t>( os_, 0x0001U );   // ZIP64 extended information
+         writeZipValue<uint16_t>( os_, static_cast<uint16_t>( extra - 4U ) );
+         if( large ) {
+            writeZipValue<uint64_t>( os_, entry.size );
+            writeZipValue<uint64_t>( os_, entry.size );
+         }
+         if( far ) {
+            writeZipValue<uint64_t>( os_, entry.offset );
+         }
+      }
+   }
+
+   const uint64_t end   ( static_cast<uint64_t>( os_.tellp() ) );
+   const uint64_t number( entries_.size() );
+   const uint16_t count ( static_cast<uint16_t>( std::min<uint64_t>( number, 0xFFFFU ) ) );
+   const uint32_t length( static_cast<uint32_t>( std::min<uint64_t>( end - start, 0xFFFFFFFFU ) ) );
+   const uint32_t offset( static_cast<uint32_t>( std::min<uint64_t>( start, 0xFFFFFFFFU ) ) );
+
+   if( number >= 0xFFFFULL || start >= 0xFFFFFFFFULL || end - start >= 0xFFFFFFFFULL )
+   {
+      writeZipValue<uint32_t>( os_, 0x06064B50U );  // ZIP64 end of central directory signature
+      writeZipValue<uint64_t>( os_, 44U );          // Size of the remaining record
+      writeZipValue<uint16_t>( os_, 45U );          // Version made by
+      writeZipValue<uint16_t>( os_, 45U );          // Version needed to extract
+      writeZipValue<uint32_t>( os_, 0U );           // Number of this disk
+      writeZipValue<uint32_t>( os_, 0U );           // Disk of the central directory
+      writeZipValue<uint64_t>( os_, number );
+      writeZipValue<uint64_t>( os_, number );
+      writeZipValue<uint64_t>( os_, end - start );
+      writeZipValue<uint64_t>( os_, start );
+
+      writeZipValue<uint32_t>( os_, 0x07064B50U );  // ZIP64 end of central directory locator
+      writeZipValue<uint32_t>( os_, 0U );           // Disk of the ZIP64 end of central directory
+      writeZipValue<uint64_t>( os_, end );
+      writeZipValue<uint32_t>( os_, 1U );           // Total number of disks
+   }
+
+   writeZipValue<uint32_t>( os_, 0x06054B50U );     // End of central directory signature
+   writeZipValue<uint16_t>( os_, 0U );              // Number of this disk
+   writeZipValue<uint16_t>( os_, 0U );              // Disk of the central directory
+   writeZipValue<uint16_t>( os_, count );
+   writeZipValue<uint16_t>( os_, count );
+   writeZipValue<uint32_t>( os_, length );
+   writeZipValue<uint32_t>( os_, offset );
+   writeZipValue<uint16_t>( os_, 0U );              // Comment length
+
+   os_.close();
+
+   if( !os_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be written" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the given vector or matrix as .npy file to the archive.
+//
+// \param name The name of the array.
+// \param obj The vector or matrix to be written.
+// \return void
+// \exception std::logic_error Archive has already been closed.
+// \exception std::runtime_error File could not be written.
+//
+// The local header always contains the ZIP64 extended information, since the size of the .npy
+// file is not known in advance. The checksum and the size are determined while writing the
+// .npy file and are filled in afterwards.
+*/
+template< typename T >  // Type of the vector or matrix
+void NpzWriter::writeEntry( const std::string& name, const T& obj )
+{
+   if( closed_ ) {
+      BLAZE_THROW_LOGIC_ERROR( "Archive has already been closed" );
+   }
+
+   Entry entry{ name + ".npy", 0U, 0UL, static_cast<uint64_t>( os_.tellp() ) };
+
+   writeZipValue<uint32_t>( os_, 0x04034B50U );  // Local file header signature
+   writeZipValue<uint16_t>( os_, 45U );          // Version needed to extract
+   writeZipValue<uint16_t>( os_, 0U );           // General purpose flags
+   writeZipValue<uint16_t>( os_, 0U );           // Compression method (stored)
+   writeZipValue<uint16_t>( os_, 0U );           // Modification time
+   writeZipValue<uint16_t>( os_, 0x21U );        // Modification date (1980-01-01)
+   writeZipValue<uint32_t>( os_, 0U );           // CRC-32 (filled in afterwards)
+   writeZipValue<uint32_t>( os_, 0xFFFFFFFFU );  // Compressed size (see ZIP64 information)
+   writeZipValue<uint32_t>( os_, 0xFFFFFFFFU );  // Uncompressed size (see ZIP64 information)
+   writeZipValue<uint16_t>( os_, static_cast<uint16_t>( entry.name.size() ) );
+   writeZipValue<uint16_t>( os_, 20U );          // Extra field length
+   os_.write( entry.name.data(), static_cast<std::streamsize>( entry.name.size() ) );
+   writeZipValue<uint16_t>( os_, 0x0001U );      // ZIP64 extended information
+   writeZipValue<uint16_t>( os_, 16U );
+   writeZipValue<uint64_t>( os_, 0U );           // Uncompressed size (filled in afterwards)
+   writeZipValue<uint64_t>( os_, 0U );           // Compressed size (filled in afterwards)
+
+   ChecksumBuffer buffer( os_.rdbuf() );
+   std::ostream stream( &buffer );
+   writeNpyArray( stream, obj );
+
+   if( !stream || !os_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be written" );
+   }
+
+   entry.crc  = buffer.crc();
+   entry.size = buffer.size();
+
+   const std::streamoff end( os_.tellp() );
+
+   os_.seekp( static_cast<std::streamoff>( entry.offset + 14UL ) );
+   writeZipValue<uint32_t>( os_, entry.crc );
+   os_.seekp( static_cast<std::streamoff>( entry.offset + 34UL + entry.name.size() ) );
+   writeZipValue<uint64_t>( os_, entry.size );
+   writeZipValue<uint64_t>( os_, entry.size );
+   os_.seekp( end );
+
+   if( !os_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be written" );
+   }
+
+   entries_.push_back( entry );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS NPZREADER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reader for NumPy .npz files.
+// \ingroup math_serialization
+//
+// The NpzReader class provides access to the named arrays of a NumPy .npz file, as created by
+// \c numpy.savez(), \c numpy.savez_compressed(), or the NpzWriter class:
+
+   \code
+   blaze::NpzReader npz( "model.npz" );
+
+   blaze::DynamicMatrix<double> W;
+   blaze::DynamicVector<double> b;
+
+   npz.read( "W", W );
+   npz.read( "b", b );
+   \endcode
+
+// The archive is mapped into memory. Uncompressed arrays are converted directly out of the
+// mapped file, compressed arrays are decompressed into a temporary buffer first. The checksums
+// of all arrays are validated. The conversion of the elements follows the rules of readNpy().
+*/
+class NpzReader
+   : private NonCopyable
+{
+ private:
+   //**Private struct Entry************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Directory entry of a stored array.
+   */
+   struct Entry
+   {
+      std::string name;    //!< The name of the array.
+      uint16_t    method;  //!< The compression method (0 for stored, 8 for deflated).
+      uint32_t    crc;     //!< The CRC-32 checksum of the .npy file.
+      uint64_t    csize;   //!< The compressed size of the .npy file in bytes.
+      uint64_t    size;    //!< The uncompressed size of the .npy file in bytes.
+      uint64_t    offset;  //!< The offset of the (compressed) .npy file within the archive.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline NpzReader( const std::string& filename );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t             size    () const noexcept;
+   inline const std::string& name    ( size_t index ) const;
+   inline bool               contains( const std::string& name ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Read functions******************************************************************************
+   /*!\name Read functions */
+   //@{
+   template< typename VT, bool TF >
+   void read( const std::string& name, Vector<VT,TF>& vec ) const;
+
+   template< typename MT, bool SO >
+   void read( const std::string& name, Matrix<MT,SO>& mat ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void         readDirectory();
+   inline const Entry& find( const std::string& name ) const;
+
+   template< typename T >
+   void readEntry( const Entry& entry, T& obj ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MappedFile         file_;     //!< The mapped .npz file.
+   std::vector<Entry> entries_;  //!< The directory entries of all stored arrays.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Opens the given .npz file.
+//
+// \param filename The name of the .npz file.
+// \exception std::runtime_error File could not be mapped.
+// \exception std::runtime_error Corrupt archive detected.
+*/
+inline NpzReader::NpzReader( const std::string& filename )
+   : file_   ( filename )  // The mapped .npz file
+   , entries_()            // The directory entries of all stored arrays
+{
+   readDirectory();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of arrays in the archive.
+//
+// \return The number of arrays.
+*/
+inline size_t NpzReader::size() const noexcept
+{
+   return entries_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the name of the array with the given index.
+//
+// \param index The index of the array \f$[0..size())\f$.
+// \return The name of the array.
+// \exception std::invalid_argument Invalid array index.
+*/
+inline const std::string& NpzReader::name( size_t index ) const
+{
+   if( index >= entries_.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid array index" );
+   }
+
+   return entries_[index].name;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the archive contains an array of the given name.
+//
+// \param name The name of the array.
+// \return \a true in case the array exists, \a false if not.
+*/
+inline bool NpzReader::contains( const std::string& name ) const noexcept
+{
+   for( const Entry& entry : entries_ ) {
+      if( entry.name == name ) return true;
+   }
+
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads the central directory of the mapped archive.
+//
+// \return void
+// \exception std::runtime_error Corrupt archive detected.
+//
+// This function locates the end of central directory record (and the ZIP64 end of central
+// directory record, if present) and creates a directory entry for every file in the archive.
+// The \c .npy suffix is removed from all file names.
+*/
+inline void NpzReader::readDirectory()
+{
+   const byte_t* const data( file_.data() );
+   const size_t bytes( file_.size() );
+
+   if( bytes < 22UL ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+
+   // Locating the end of central directory record
+   size_t eocd( bytes - 22UL );
+   const size_t limit( eocd > 0xFFFFUL ? eocd - 0xFFFFUL : 0UL );
+
+   while( zipValue<uint32_t>( data + eocd ) != 0x06054B50U ) {
+      if( eocd == limit ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+      }
+      --eocd;
+   }
+
+   uint64_t number( zipValue<uint16_t>( data + eocd + 10UL ) );
+   uint64_t start ( zipValue<uint32_t>( data + eocd + 16UL ) );
+
+   // Locating the ZIP64 end of central directory record
+   if( eocd >= 20UL && zipValue<uint32_t>( data + eocd - 20UL ) == 0x07064B50U )
+   {
+      const uint64_t pos( zipValue<uint64_t>( data + eocd - 12UL ) );
+
+      if( bytes < 56UL || pos > bytes - 56UL || zipValue<uint32_t>( data + pos ) != 0x06064B50U ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+      }
+
+      number = zipValue<uint64_t>( data + pos + 32UL );
+      start  = zipValue<uint64_t>( data + pos + 48UL );
+   }
+
+   if( start > eocd || number > ( eocd - start ) / 46UL ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+
+   entries_.reserve( number );
+
+   // Reading the central directory entries
+   size_t pos( start );
+
+   for( uint64_t i=0UL; i<number; ++i )
+   {
+      if( pos > eocd - 46UL || zipValue<uint32_t>( data + pos ) != 0x02014B50U ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+      }
+
+      const size_t nameLength   ( zipValue<uint16_t>( data + pos + 28UL ) );
+      const size_t extraLength  ( zipValue<uint16_t>( data + pos + 30UL ) );
+      const size_t commentLength( zipValue<uint16_t>( data + pos + 32UL ) );
+
+      if( nameLength + extraLength + commentLength > eocd - pos - 46UL ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+      }
+
+      Entry entry;
+      entry.name   = std::string( reinterpret_cast<const char*>( data + pos + 46UL ), nameLength );
+      entry.method = zipValue<uint16_t>( data + pos + 10UL );
+      entry.crc    = zipValue<uint32_t>( data + pos + 16UL );
+      entry.csize  = zipValue<uint32_t>( data + pos + 20UL );
+      entry.size   = zipValue<uint32_t>( data + pos + 24UL );
+      entry.offset = zipValue<uint32_t>( data + pos + 42UL );
+
+      // Evaluating the ZIP64 extended information
+      const byte_t* extra( data + pos + 46UL + nameLength );
+      const byte_t* const extraEnd( extra + extraLength );
+
+      while( extraEnd - extra >= 4 )
+      {
+         const uint16_t id    ( zipValue<uint16_t>( extra ) );
+         const uint16_t length( zipValue<uint16_t>( extra + 2UL ) );
+         const byte_t*  value ( extra + 4UL );
+
+         if( length > extraEnd - value ) {
+            BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+         }
+
+         if( id == 0x0001U ) {
+            uint64_t* const fields[] = { &entry.size, &entry.csize, &entry.offset };
+            for( uint64_t* field : fields ) {
+               if( *field != 0xFFFFFFFFULL ) continue;
+               if( value + 8L > extra + 4UL + length ) {
+                  BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+               }
+               *field = zipValue<uint64_t>( value );
+               value += 8UL;
+            }
+         }
+
+         extra += 4UL + length;
+      }
+
+      // Locating the data behind the local header
+      if( entry.offset > bytes - 30UL ||
+          zipValue<uint32_t>( data + entry.offset ) != 0x04034B50U ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+      }
+
+      entry.offset += 30UL + zipValue<uint16_t>( data + entry.offset + 26UL )
+                           + zipValue<uint16_t>( data + entry.offset + 28UL );
+
+      if( entry.offset > bytes || entry.csize > bytes - entry.offset ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+      }
+
+      const size_t suffix( entry.name.size() > 4UL ? entry.name.size()-4UL : 0UL );
+
+      if( suffix > 0UL && entry.name.compare( suffix, 4UL, ".npy" ) == 0 ) {
+         entry.name.erase( suffix );
+      }
+
+      entries_.push_back( entry );
+      pos += 46UL + nameLength + extraLength + commentLength;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the directory entry of the array with the given name.
+//
+// \param name The name of the array.
+// \return The directory entry.
+// \exception std::invalid_argument Invalid array name.
+*/
+inline const NpzReader::Entry& NpzReader::find( const std::string& name ) const
+{
+   for( const Entry& entry : entries_ ) {
+      if( entry.name == name ) return entry;
+   }
+
+   BLAZE_THROW_INVALID_ARGUMENT( "Invalid array name" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads the given directory entry into the given vector or matrix.
+//
+// \param entry The directory entry.
+// \param obj The vector or matrix to be read.
+// \return void
+// \exception std::runtime_error Invalid compression method detected.
+// \exception std::runtime_error Corrupt archive detected.
+// \exception std::runtime_error Error while reading the stored array.
+*/
+template< typename T >  // Type of the vector or matrix
+void NpzReader::readEntry( const Entry& entry, T& obj ) const
+{
+   const byte_t* data( file_.data() + entry.offset );
+   std::vector<byte_t> buffer;
+
+   if( entry.method == 8U ) {
+      buffer.resize( entry.size );
+      if( !Inflater::decode( data, entry.csize, buffer.data(), buffer.size() ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+      }
+      data = buffer.data();
+   }
+   else if( entry.method != 0U ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid compression method detected" );
+   }
+   else if( entry.csize != entry.size ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+
+   if( crc32( 0U, data, entry.size ) != entry.crc ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+
+   readNpyArray( data, parseNpy( data, entry.size ), obj );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  READ FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reads the array of the given name into the given vector.
+//
+// \param name The name of the array.
+// \param vec The vector to be read.
+// \return void
+// \exception std::invalid_argument Invalid array name.
+// \exception std::runtime_error Error while reading the stored array.
+*/
+template< typename VT  // Type of the vector
+        , bool TF >    // Transpose flag
+void NpzReader::read( const std::string& name, Vector<VT,TF>& vec ) const
+{
+   readEntry( find( name ), *vec );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads the array of the given name into the given matrix.
+//
+// \param name The name of the array.
+// \param mat The matrix to be read.
+// \return void
+// \exception std::invalid_argument Invalid array name.
+// \exception std::runtime_error Error while reading the stored array.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+void NpzReader::read( const std::string& name, Matrix<MT,SO>& mat ) const
+{
+   readEntry( find( name ), *mat );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,18 +40,29 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Vector.h>
+#include <blaze/math/dense/DynamicVector.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/expressions/Vector.h>
+#include <blaze/math/serialization/BlockCodec.h>
 #include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/shims/NextMultiple.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsContiguous.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/MaybeUnused.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
 
 
 namespace blaze {
@@ -148,6 +159,23 @@ namespace blaze {
 //
 // In case an error is encountered during (de-)serialization, a \a std::runtime_exception is
 // thrown.
+//
+// Vectors are written in version 3 of the format. In this format the payload of each vector
+// starts at a 64-byte boundary relative to the beginning of the archive. The elements of dense
+// vectors with numeric elements are padded with zeros to a multiple of 64 bytes. For sparse
+// vectors the array of all indices is followed by the array of all values, both of which start
+// at a 64-byte boundary. The spacing of dense vectors and the offsets of all payload arrays are
+// stored in the header, which enables a direct access to the data of a vector (see for instance
+// the MappedArchive class). Archives written in version 1 (index/value pairs) or version 2
+// (block of indices and block of values) of the format can still be deserialized.
+//
+// In case compression is enabled for the archive (see Archive::setCompression()), vectors with
+// numeric elements are written in compressed format instead, which is marked by an additional
+// type flag in the header. For sparse vectors the distances between consecutive indices are
+// stored as variable-length integers, followed by the values of all non-zero elements. The data
+// is compressed in independent blocks by the BlockCodec, which allows a parallel compression
+// and decompression. Compressed vectors are detected and decompressed automatically during
+// deserialization, but cannot be accessed directly via the MappedArchive class.
 */
 class VectorSerializer
 {
@@ -164,6 +192,7 @@ class VectorSerializer
       0x01 - Vector/Matrix flag
       0x02 - Dense/Sparse flag
       0x04 - Row-/Column-major flag
+      0x08 - Compression flag
       \endcode
    */
    template< bool IsDenseVector >
@@ -188,6 +217,19 @@ class VectorSerializer
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! The maximum number of sparse vector elements that are buffered for a single block write.
+   static constexpr size_t blockSize = 1024UL;
+
+   //! The alignment in bytes of the payload of a vector in version 3 of the format.
+   static constexpr size_t alignment = 64UL;
+
+   //! The size in bytes of the header of a vector in version 3 of the format.
+   static constexpr size_t headerSize = 36UL;
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Constructor*********************************************************************************
    /*!\name Constructor */
@@ -220,10 +262,41 @@ class VectorSerializer
    void serializeHeader( Archive& archive, const VT& vec );
 
    template< typename Archive, typename VT, bool TF >
-   void serializeVector( Archive& archive, const DenseVector<VT,TF>& vec );
+   DisableIf_t< IsContiguous_v<VT> && HasConstDataAccess_v<VT> && IsNumeric_v< ElementType_t<VT> > >
+      serializeVector( Archive& archive, const DenseVector<VT,TF>& vec );
+
+   template< typename Archive, typename VT, bool TF >
+   EnableIf_t< IsContiguous_v<VT> && HasConstDataAccess_v<VT> && IsNumeric_v< ElementType_t<VT> > >
+      serializeVector( Archive& archive, const DenseVector<VT,TF>& vec );
 
    template< typename Archive, typename VT, bool TF >
    void serializeVector( Archive& archive, const SparseVector<VT,TF>& vec );
+
+   template< typename Archive, typename VT, bool TF >
+   EnableIf_t< IsNumeric_v< ElementType_t<VT> > >
+      serializeSparseValues( Archive& archive, const SparseVector<VT,TF>& vec );
+
+   template< typename Archive, typename VT, bool TF >
+   DisableIf_t< IsNumeric_v< ElementType_t<VT> > >
+      serializeSparseValues( Archive& archive, const SparseVector<VT,TF>& vec );
+
+   template< typename Archive >
+   void serializePadding( Archive& archive, size_t bytes );
+
+   template< typename Archive, typename VT >
+   DisableIf_t< IsNumeric_v< ElementType_t<VT> > >
+      serializeCompressed( Archive& archive, const VT& vec );
+
+   template< typename Archive, typename VT, bool TF >
+   EnableIf_t< IsNumeric_v< ElementType_t<VT> > >
+      serializeCompressed( Archive& archive, const DenseVector<VT,TF>& vec );
+
+   template< typename Archive, typename VT, bool TF >
+   EnableIf_t< IsNumeric_v< ElementType_t<VT> > >
+      serializeCompressed( Archive& archive, const SparseVector<VT,TF>& vec );
+
+   template< typename Archive, typename VT >
+   void serializeCompressedHeader( Archive& archive, const VT& vec );
    //@}
    //**********************************************************************************************
 
@@ -261,6 +334,63 @@ class VectorSerializer
 
    template< typename Archive, typename VT, bool TF >
    void deserializeSparseVector( Archive& archive, SparseVector<VT,TF>& vec );
+
+   template< typename Archive, typename ET >
+   void deserializeSparseElements( Archive& archive,
+                                   DynamicVector<uint64_t>& indices, DynamicVector<ET>& values );
+
+   template< typename Archive, typename ET >
+   EnableIf_t< IsNumeric_v<ET> >
+      deserializeSparseValues( Archive& archive, DynamicVector<ET>& values );
+
+   template< typename Archive, typename ET >
+   DisableIf_t< IsNumeric_v<ET> >
+      deserializeSparseValues( Archive& archive, DynamicVector<ET>& values );
+
+   template< typename Archive >
+   void skipPadding( Archive& archive, size_t bytes );
+
+   template< typename Archive, typename VT >
+   EnableIf_t< IsDenseVector_v<VT> && IsContiguous_v<VT> && HasMutableDataAccess_v<VT> &&
+               IsNumeric_v< ElementType_t<VT> > >
+      deserializeCompressedDense( Archive& archive, VT& vec );
+
+   template< typename Archive, typename VT >
+   EnableIf_t< !( IsDenseVector_v<VT> && IsContiguous_v<VT> && HasMutableDataAccess_v<VT> ) &&
+               IsNumeric_v< ElementType_t<VT> > >
+      deserializeCompressedDense( Archive& archive, VT& vec );
+
+   template< typename Archive, typename VT >
+   DisableIf_t< IsNumeric_v< ElementType_t<VT> > >
+      deserializeCompressedDense( Archive& archive, VT& vec );
+
+   template< typename Archive, typename ET >
+   EnableIf_t< IsNumeric_v<ET> >
+      deserializeCompressedElements( Archive& archive,
+                                     DynamicVector<uint64_t>& indices, DynamicVector<ET>& values );
+
+   template< typename Archive, typename ET >
+   DisableIf_t< IsNumeric_v<ET> >
+      deserializeCompressedElements( Archive& archive,
+                                     DynamicVector<uint64_t>& indices, DynamicVector<ET>& values );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename ET >
+   static inline size_t paddedSize( size_t n ) noexcept;
+
+   static inline size_t alignedOffset( size_t start, size_t offset ) noexcept;
+
+   template< typename VT, bool TF >
+   static inline EnableIf_t< IsContiguous_v<VT> && HasConstDataAccess_v<VT> >
+      gatherElements( const DenseVector<VT,TF>& vec, size_t first, size_t count, byte_t* dst );
+
+   template< typename VT, bool TF >
+   static inline DisableIf_t< IsContiguous_v<VT> && HasConstDataAccess_v<VT> >
+      gatherElements( const DenseVector<VT,TF>& vec, size_t first, size_t count, byte_t* dst );
    //@}
    //**********************************************************************************************
 
@@ -273,6 +403,9 @@ class VectorSerializer
    uint8_t  elementSize_;  //!< The size in bytes of a single element of the vector.
    uint64_t size_;         //!< The size of the vector.
    uint64_t number_;       //!< The total number of elements contained in the vector.
+   uint64_t spacing_;      //!< The number of serialized elements of a dense vector.
+   uint64_t offsets_[2];   //!< The offsets of the payload arrays relative to the header.
+   bool     compressed_;   //!< Compression flag of the vector.
    //@}
    //**********************************************************************************************
 };
@@ -297,6 +430,9 @@ VectorSerializer::VectorSerializer()
    , elementSize_( 0U  )  // The size in bytes of a single element of the vector
    , size_       ( 0UL )  // The size of the vector
    , number_     ( 0UL )  // The total number of elements contained in the vector
+   , spacing_    ( 0UL )  // The number of serialized elements of a dense vector
+   , offsets_    ()       // The offsets of the payload arrays relative to the header
+   , compressed_ ( false )  // Compression flag of the vector
 {}
 //*************************************************************************************************
 
@@ -329,8 +465,13 @@ void VectorSerializer::serialize( Archive& archive, const Vector<VT,TF>& vec )
       BLAZE_THROW_RUNTIME_ERROR( "Faulty archive detected" );
    }
 
-   serializeHeader( archive, *vec );
-   serializeVector( archive, *vec );
+   if( archive.getCompression() ) {
+      serializeCompressed( archive, *vec );
+   }
+   else {
+      serializeHeader( archive, *vec );
+      serializeVector( archive, *vec );
+   }
 }
 //*************************************************************************************************
 
@@ -342,6 +483,12 @@ void VectorSerializer::serialize( Archive& archive, const Vector<VT,TF>& vec )
 // \param vec The vector to be serialized.
 // \return void
 // \exception std::runtime_error File header could not be serialized.
+//
+// In addition to the type and size information, the header contains the layout of the payload.
+// For dense vectors this is the number of serialized elements including padding and the offset
+// of the first element, for sparse vectors it is the offset of the indices and of the values.
+// All offsets are relative to the beginning of the header and are chosen such that each array
+// starts at a 64-byte boundary relative to the beginning of the archive.
 */
 template< typename Archive  // Type of the archive
         , typename VT >     // Type of the vector
@@ -349,12 +496,31 @@ void VectorSerializer::serializeHeader( Archive& archive, const VT& vec )
 {
    using ET = ElementType_t<VT>;
 
-   archive << uint8_t ( 1U );
+   const size_t start( archive.bytesWritten() );
+
+   number_     = IsDenseVector_v<VT> ? vec.size() : vec.nonZeros();
+   offsets_[0] = alignedOffset( start, headerSize );
+
+   if( IsDenseVector_v<VT> ) {
+      spacing_ = paddedSize<ET>( vec.size() );
+   }
+   else {
+      offsets_[1] = alignedOffset( start, offsets_[0] + number_*sizeof( uint64_t ) );
+   }
+
+   archive << uint8_t ( 3U );
    archive << uint8_t ( VectorValueMapping<VT>::value );
    archive << uint8_t ( TypeValueMapping<ET>::value );
    archive << uint8_t ( sizeof( ET ) );
    archive << uint64_t( vec.size() );
-   archive << uint64_t( IsDenseVector_v<VT> ? vec.size() : vec.nonZeros() );
+   archive << number_;
+
+   if( IsDenseVector_v<VT> ) {
+      archive << spacing_ << offsets_[0];
+   }
+   else {
+      archive << offsets_[0] << offsets_[1];
+   }
 
    if( !archive ) {
       BLAZE_THROW_RUNTIME_ERROR( "File header could not be serialized" );
@@ -374,13 +540,50 @@ void VectorSerializer::serializeHeader( Archive& archive, const VT& vec )
 template< typename Archive  // Type of the archive
         , typename VT       // Type of the vector
         , bool TF >         // Transpose flag
-void VectorSerializer::serializeVector( Archive& archive, const DenseVector<VT,TF>& vec )
+DisableIf_t< IsContiguous_v<VT> && HasConstDataAccess_v<VT> && IsNumeric_v< ElementType_t<VT> > >
+   VectorSerializer::serializeVector( Archive& archive, const DenseVector<VT,TF>& vec )
 {
+   serializePadding( archive, offsets_[0] - headerSize );
+
    size_t i( 0UL );
    while( ( i < (*vec).size() ) && ( archive << (*vec)[i] ) ) {
       ++i;
    }
 
+   serializePadding( archive, ( spacing_ - (*vec).size() )*sizeof( ElementType_t<VT> ) );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense vector could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the elements of a dense vector with contiguous elements.
+//
+// \param archive The archive to be written.
+// \param vec The vector to be serialized.
+// \return void
+// \exception std::runtime_error Dense vector could not be serialized.
+//
+// This function writes all elements of the given dense vector by means of a single block write.
+// The resulting representation is the same as the one of the elementwise serialization.
+*/
+template< typename Archive  // Type of the archive
+        , typename VT       // Type of the vector
+        , bool TF >         // Transpose flag
+EnableIf_t< IsContiguous_v<VT> && HasConstDataAccess_v<VT> && IsNumeric_v< ElementType_t<VT> > >
+   VectorSerializer::serializeVector( Archive& archive, const DenseVector<VT,TF>& vec )
+{
+   serializePadding( archive, offsets_[0] - headerSize );
+
+   if( (*vec).size() != 0UL ) {
+      archive.write( (*vec).data(), (*vec).size() );
+   }
+
+   serializePadding( archive, ( spacing_ - (*vec).size() )*sizeof( ElementType_t<VT> ) );
+
    if( !archive ) {
       BLAZE_THROW_RUNTIME_ERROR( "Dense vector could not be serialized" );
    }
@@ -403,11 +606,203 @@ void VectorSerializer::serializeVector( Archive& archive, const SparseVector<VT,
 {
    using ConstIterator = ConstIterator_t<VT>;
 
+   uint64_t indices[blockSize];
+
+   ConstIterator element( (*vec).begin() );
+   const ConstIterator end( (*vec).end() );
+
+   serializePadding( archive, offsets_[0] - headerSize );
+
+   while( element != end && archive ) {
+      size_t k( 0UL );
+      for( ; element!=end && k<blockSize; ++element, ++k ) {
+         indices[k] = element->index();
+      }
+      archive.write( indices, k );
+   }
+
+   serializePadding( archive, offsets_[1] - offsets_[0] - number_*sizeof( uint64_t ) );
+   serializeSparseValues( archive, *vec );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Sparse vector could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the values of numeric non-zero elements of a sparse vector.
+//
+// \param archive The archive to be written.
+// \param vec The sparse vector to be serialized.
+// \return void
+*/
+template< typename Archive  // Type of the archive
+        , typename VT       // Type of the vector
+        , bool TF >         // Transpose flag
+EnableIf_t< IsNumeric_v< ElementType_t<VT> > >
+   VectorSerializer::serializeSparseValues( Archive& archive, const SparseVector<VT,TF>& vec )
+{
+   using ConstIterator = ConstIterator_t<VT>;
+
+   ElementType_t<VT> values[blockSize];
+
    ConstIterator element( (*vec).begin() );
-   while( ( element != (*vec).end() ) &&
-          ( archive << element->index() << element->value() ) ) {
-      ++element;
+   const ConstIterator end( (*vec).end() );
+
+   while( element != end && archive ) {
+      size_t k( 0UL );
+      for( ; element!=end && k<blockSize; ++element, ++k ) {
+         values[k] = element->value();
+      }
+      archive.write( values, k );
    }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the values of non-numeric non-zero elements of a sparse vector.
+//
+// \param archive The archive to be written.
+// \param vec The sparse vector to be serialized.
+// \return void
+*/
+template< typename Archive  // Type of the archive
+        , typename VT       // Type of the vector
+        , bool TF >         // Transpose flag
+DisableIf_t< IsNumeric_v< ElementType_t<VT> > >
+   VectorSerializer::serializeSparseValues( Archive& archive, const SparseVector<VT,TF>& vec )
+{
+   for( auto element=(*vec).begin(); element!=(*vec).end() && archive; ++element ) {
+      archive << element->value();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given number of padding bytes to the archive.
+//
+// \param archive The archive to be written.
+// \param bytes The number of padding bytes \f$[0..alignment)\f$.
+// \return void
+*/
+template< typename Archive >  // Type of the archive
+void VectorSerializer::serializePadding( Archive& archive, size_t bytes )
+{
+   BLAZE_INTERNAL_ASSERT( bytes < alignment, "Invalid number of padding bytes" );
+
+   const uint8_t padding[alignment] = {};
+   archive.write( padding, bytes );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes a vector with non-numeric elements in case compression is requested.
+//
+// \param archive The archive to be written.
+// \param vec The vector to be serialized.
+// \return void
+//
+// Vectors with non-numeric elements are never compressed. Therefore this function serializes
+// the given vector in the default format. Note that numeric vector elements are nevertheless
+// compressed individually.
+*/
+template< typename Archive  // Type of the archive
+        , typename VT >     // Type of the vector
+DisableIf_t< IsNumeric_v< ElementType_t<VT> > >
+   VectorSerializer::serializeCompressed( Archive& archive, const VT& vec )
+{
+   serializeHeader( archive, vec );
+   serializeVector( archive, vec );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the elements of a dense vector in compressed format.
+//
+// \param archive The archive to be written.
+// \param vec The vector to be serialized.
+// \return void
+// \exception std::runtime_error Dense vector could not be serialized.
+*/
+template< typename Archive  // Type of the archive
+        , typename VT       // Type of the vector
+        , bool TF >         // Transpose flag
+EnableIf_t< IsNumeric_v< ElementType_t<VT> > >
+   VectorSerializer::serializeCompressed( Archive& archive, const DenseVector<VT,TF>& vec )
+{
+   using ET = ElementType_t<VT>;
+
+   number_ = (*vec).size();
+
+   serializeCompressedHeader( archive, *vec );
+
+   BlockCodec::compress( archive, number_*sizeof( ET ), sizeof( ET ),
+                         [&vec]( byte_t* dst, size_t first, size_t count ) {
+      gatherElements( *vec, first, count, dst );
+   } );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense vector could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the elements of a sparse vector in compressed format.
+//
+// \param archive The archive to be written.
+// \param vec The vector to be serialized.
+// \return void
+// \exception std::runtime_error Sparse vector could not be serialized.
+//
+// This function writes the distances between the indices of consecutive non-zero elements as
+// variable-length integers, preceded by their size in bytes and followed by the values of all
+// non-zero elements. Both parts are compressed by the BlockCodec.
+*/
+template< typename Archive  // Type of the archive
+        , typename VT       // Type of the vector
+        , bool TF >         // Transpose flag
+EnableIf_t< IsNumeric_v< ElementType_t<VT> > >
+   VectorSerializer::serializeCompressed( Archive& archive, const SparseVector<VT,TF>& vec )
+{
+   using ET = ElementType_t<VT>;
+
+   number_ = (*vec).nonZeros();
+
+   serializeCompressedHeader( archive, *vec );
+
+   std::vector<byte_t> structure;
+   DynamicVector<ET> values( number_ );
+
+   structure.reserve( number_ );
+
+   size_t k( 0UL );
+   size_t next( 0UL );
+
+   for( auto element=(*vec).begin(); element!=(*vec).end(); ++element, ++k ) {
+      BlockCodec::encodeVarint( structure, element->index() - next );
+      next = element->index() + 1UL;
+      values[k] = element->value();
+   }
+
+   archive << uint64_t( structure.size() );
+
+   BlockCodec::compress( archive, structure.size(), 1UL,
+                         [&structure]( byte_t* dst, size_t first, size_t count ) {
+      std::copy( structure.data() + first, structure.data() + first + count, dst );
+   } );
+
+   BlockCodec::compress( archive, number_*sizeof( ET ), sizeof( ET ),
+                         [&values]( byte_t* dst, size_t first, size_t count ) {
+      std::memcpy( dst, values.data() + first, count*sizeof( ET ) );
+   } );
 
    if( !archive ) {
       BLAZE_THROW_RUNTIME_ERROR( "Sparse vector could not be serialized" );
@@ -416,6 +811,37 @@ void VectorSerializer::serializeVector( Archive& archive, const SparseVector<VT,
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Serializes all meta information about the given compressed vector.
+//
+// \param archive The archive to be written.
+// \param vec The vector to be serialized.
+// \return void
+// \exception std::runtime_error File header could not be serialized.
+//
+// The header of a compressed vector consists of the type and size information only. The type
+// of the vector is marked by the compression flag.
+*/
+template< typename Archive  // Type of the archive
+        , typename VT >     // Type of the vector
+void VectorSerializer::serializeCompressedHeader( Archive& archive, const VT& vec )
+{
+   using ET = ElementType_t<VT>;
+
+   archive << uint8_t ( 3U );
+   archive << uint8_t ( VectorValueMapping<VT>::value | 8U );
+   archive << uint8_t ( TypeValueMapping<ET>::value );
+   archive << uint8_t ( sizeof( ET ) );
+   archive << uint64_t( vec.size() );
+   archive << number_;
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File header could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -459,7 +885,8 @@ void VectorSerializer::deserialize( Archive& archive, Vector<VT,TF>& vec )
 // This function deserializes all meta information about the given vector contained in the
 // header of the given archive. In case any error is detected during the deserialization
 // process (for instance an invalid type of vector, element type, element size, or vector
-// size) a \a std::runtime_error is thrown.
+// size) a \a std::runtime_error is thrown. In case of archives of version 3 the function also
+// reads and validates the layout of the payload.
 */
 template< typename Archive  // Type of the archive
         , typename VT >     // Type of the vector
@@ -470,10 +897,11 @@ void VectorSerializer::deserializeHeader( Archive& archive, const VT& vec )
    if( !( archive >> version_ >> type_ >> elementType_ >> elementSize_ >> size_ >> number_ ) ) {
       BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
    }
-   else if( version_ != 1UL ) {
+   else if( version_ < 1U || version_ > 3U ) {
       BLAZE_THROW_RUNTIME_ERROR( "Invalid version detected" );
    }
-   else if( ( type_ & 1U ) != 0U || ( type_ & (~3U) ) != 0U ) {
+   else if( ( type_ & 1U ) != 0U || ( type_ & (~11U) ) != 0U ||
+            ( version_ < 3U && ( type_ & 8U ) != 0U ) ) {
       BLAZE_THROW_RUNTIME_ERROR( "Invalid vector type detected" );
    }
    else if( elementType_ != TypeValueMapping<ET>::value ) {
@@ -488,6 +916,33 @@ void VectorSerializer::deserializeHeader( Archive& archive, const VT& vec )
    else if( number_ > size_ ) {
       BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
    }
+
+   compressed_ = ( ( type_ & 8U ) != 0U );
+   type_ &= 3U;
+
+   if( version_ < 3U || compressed_ ) {
+      spacing_ = size_;
+   }
+   else if( type_ == 0U ) {
+      if( !( archive >> spacing_ >> offsets_[0] ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+      }
+      else if( spacing_ < size_ ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid spacing detected" );
+      }
+      else if( offsets_[0] < headerSize ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid payload offset detected" );
+      }
+   }
+   else {
+      if( !( archive >> offsets_[0] >> offsets_[1] ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+      }
+      else if( offsets_[0] < headerSize || offsets_[1] < offsets_[0] ||
+               ( offsets_[1] - offsets_[0] ) / sizeof( uint64_t ) < number_ ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid payload offset detected" );
+      }
+   }
 }
 //*************************************************************************************************
 
@@ -548,14 +1003,23 @@ EnableIf_t< IsResizable_v<VT> > VectorSerializer::prepareVector( VT& vec )
 // \exception std::runtime_error Error during deserialization.
 //
 // This function deserializes the contents of the vector from the archive and reconstitutes the
-// given vector.
+// given vector. In case of archives of version 3, the padding around the elements of a dense
+// vector is skipped. Compressed dense vectors are handled by deserializeCompressedDense(), the
+// elements of compressed sparse vectors by deserializeCompressedElements().
 */
 template< typename Archive  // Type of the archive
         , typename VT >     // Type of the vector
 void VectorSerializer::deserializeVector( Archive& archive, VT& vec )
 {
-   if( type_ == 0U ) {
+   if( type_ == 0U && compressed_ ) {
+      deserializeCompressedDense( archive, vec );
+   }
+   else if( type_ == 0U ) {
+      if( version_ > 2U ) {
+         skipPadding( archive, offsets_[0] - headerSize );
+      }
       deserializeDenseVector( archive, vec );
+      skipPadding( archive, ( spacing_ - size_ )*sizeof( ElementType_t<VT> ) );
    }
    else if( type_ == 2U ) {
       deserializeSparseVector( archive, vec );
@@ -683,13 +1147,13 @@ void VectorSerializer::deserializeSparseVector( Archive& archive, DenseVector<VT
 {
    using ET = ElementType_t<VT>;
 
-   size_t i    ( 0UL );
-   size_t index( 0UL );
-   ET     value{};
+   DynamicVector<uint64_t> indices;
+   DynamicVector<ET> values;
 
-   while( ( i != number_ ) && ( archive >> index >> value ) ) {
-      (*vec)[index] = value;
-      ++i;
+   deserializeSparseElements( archive, indices, values );
+
+   for( size_t i=0UL; i<indices.size() && archive; ++i ) {
+      (*vec)[indices[i]] = values[i];
    }
 
    if( !archive ) {
@@ -718,13 +1182,13 @@ void VectorSerializer::deserializeSparseVector( Archive& archive, SparseVector<V
 {
    using ET = ElementType_t<VT>;
 
-   size_t i    ( 0UL );
-   size_t index( 0UL );
-   ET     value{};
+   DynamicVector<uint64_t> indices;
+   DynamicVector<ET> values;
 
-   while( ( i != number_ ) && ( archive >> index >> value ) ) {
-      (*vec).append( index, value, false );
-      ++i;
+   deserializeSparseElements( archive, indices, values );
+
+   for( size_t i=0UL; i<indices.size() && archive; ++i ) {
+      (*vec).append( indices[i], values[i], false );
    }
 
    if( !archive ) {
@@ -734,6 +1198,381 @@ void VectorSerializer::deserializeSparseVector( Archive& archive, SparseVector<V
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Deserializes the non-zero elements of a sparse vector.
+//
+// \param archive The archive to be read from.
+// \param indices The buffer for the indices of the non-zero elements.
+// \param values The buffer for the values of the non-zero elements.
+// \return void
+// \exception std::runtime_error Invalid element index detected.
+//
+// This function reads the indices and values of all non-zero elements of a sparse vector into
+// the two given buffers. Archives of version 1 contain index/value pairs, archives of version 2
+// and 3 contain a block of indices followed by a block of values, which in version 3 are both
+// preceded by padding. In case the archive fails during the read operations, the function
+// returns without any further checks. Otherwise a \a std::runtime_error is thrown in case any
+// index exceeds the size of the vector. The elements of compressed sparse vectors are read by
+// deserializeCompressedElements().
+*/
+template< typename Archive  // Type of the archive
+        , typename ET >     // Type of the elements
+void VectorSerializer::deserializeSparseElements( Archive& archive,
+                                                  DynamicVector<uint64_t>& indices,
+                                                  DynamicVector<ET>& values )
+{
+   indices.resize( number_, false );
+   values.resize ( number_, false );
+
+   if( compressed_ ) {
+      deserializeCompressedElements( archive, indices, values );
+      return;
+   }
+
+   if( version_ == 1U ) {
+      size_t index( 0UL );
+      for( size_t i=0UL; i<number_ && ( archive >> index >> values[i] ); ++i ) {
+         indices[i] = index;
+      }
+   }
+   else if( version_ == 2U ) {
+      archive.read( indices.data(), number_ );
+      deserializeSparseValues( archive, values );
+   }
+   else {
+      skipPadding( archive, offsets_[0] - headerSize );
+      archive.read( indices.data(), number_ );
+      skipPadding( archive, offsets_[1] - offsets_[0] - number_*sizeof( uint64_t ) );
+      deserializeSparseValues( archive, values );
+   }
+
+   if( !archive ) return;
+
+   for( size_t i=0UL; i<number_; ++i ) {
+      if( indices[i] >= size_ ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid element index detected" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a block of numeric values of sparse vector elements.
+//
+// \param archive The archive to be read from.
+// \param values The buffer for the values of the non-zero elements.
+// \return void
+*/
+template< typename Archive  // Type of the archive
+        , typename ET >     // Type of the elements
+EnableIf_t< IsNumeric_v<ET> >
+   VectorSerializer::deserializeSparseValues( Archive& archive, DynamicVector<ET>& values )
+{
+   archive.read( values.data(), values.size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a block of non-numeric values of sparse vector elements.
+//
+// \param archive The archive to be read from.
+// \param values The buffer for the values of the non-zero elements.
+// \return void
+*/
+template< typename Archive  // Type of the archive
+        , typename ET >     // Type of the elements
+DisableIf_t< IsNumeric_v<ET> >
+   VectorSerializer::deserializeSparseValues( Archive& archive, DynamicVector<ET>& values )
+{
+   for( size_t i=0UL; i<values.size() && ( archive >> values[i] ); ++i ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Skips the given number of padding bytes in the archive.
+//
+// \param archive The archive to be read from.
+// \param bytes The number of padding bytes to be skipped.
+// \return void
+*/
+template< typename Archive >  // Type of the archive
+void VectorSerializer::skipPadding( Archive& archive, size_t bytes )
+{
+   uint8_t padding[alignment];
+
+   while( bytes > 0UL && archive ) {
+      const size_t k( ( bytes < alignment )?( bytes ):( alignment ) );
+      archive.read( padding, k );
+      bytes -= k;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Decompresses the elements of a dense vector directly into the given dense vector.
+//
+// \param archive The archive to be read from.
+// \param vec The dense vector to be reconstituted.
+// \return void
+// \exception std::runtime_error Dense vector could not be deserialized.
+//
+// This function decompresses the elements of a dense vector into the given contiguous dense
+// vector. The decompressed blocks are copied in parallel into the vector.
+*/
+template< typename Archive  // Type of the archive
+        , typename VT >     // Type of the vector
+EnableIf_t< IsDenseVector_v<VT> && IsContiguous_v<VT> && HasMutableDataAccess_v<VT> &&
+            IsNumeric_v< ElementType_t<VT> > >
+   VectorSerializer::deserializeCompressedDense( Archive& archive, VT& vec )
+{
+   using ET = ElementType_t<VT>;
+
+   BlockCodec::decompress( archive, size_*sizeof( ET ), sizeof( ET ),
+                           [&vec]( const byte_t* src, size_t first, size_t count ) {
+      std::memcpy( vec.data() + first, src, count*sizeof( ET ) );
+   } );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense vector could not be deserialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Decompresses the elements of a dense vector into the given vector.
+//
+// \param archive The archive to be read from.
+// \param vec The vector to be reconstituted.
+// \return void
+//
+// This function decompresses the elements of a dense vector into a temporary dense vector,
+// which is subsequently assigned to the given vector.
+*/
+template< typename Archive  // Type of the archive
+        , typename VT >     // Type of the vector
+EnableIf_t< !( IsDenseVector_v<VT> && IsContiguous_v<VT> && HasMutableDataAccess_v<VT> ) &&
+            IsNumeric_v< ElementType_t<VT> > >
+   VectorSerializer::deserializeCompressedDense( Archive& archive, VT& vec )
+{
+   DynamicVector< ElementType_t<VT> > tmp( size_ );
+   deserializeCompressedDense( archive, tmp );
+   vec = tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Decompresses the elements of a dense vector with non-numeric elements.
+//
+// \param archive The archive to be read from.
+// \param vec The vector to be reconstituted.
+// \return void
+// \exception std::runtime_error Invalid vector type detected.
+//
+// Since vectors with non-numeric elements are never compressed, this function always throws
+// a \a std::runtime_error exception.
+*/
+template< typename Archive  // Type of the archive
+        , typename VT >     // Type of the vector
+DisableIf_t< IsNumeric_v< ElementType_t<VT> > >
+   VectorSerializer::deserializeCompressedDense( Archive& archive, VT& vec )
+{
+   MAYBE_UNUSED( archive, vec );
+
+   BLAZE_THROW_RUNTIME_ERROR( "Invalid vector type detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Decompresses the non-zero elements of a sparse vector.
+//
+// \param archive The archive to be read from.
+// \param indices The buffer for the indices of the non-zero elements.
+// \param values The buffer for the values of the non-zero elements.
+// \return void
+// \exception std::runtime_error Corrupt archive detected.
+// \exception std::runtime_error Invalid element index detected.
+//
+// This function decompresses the distances between the indices of consecutive non-zero elements
+// and the values of all non-zero elements of a sparse vector into the two given buffers. In case
+// the archive fails during the read operations, the function returns without any further checks.
+// Otherwise a \a std::runtime_error is thrown in case the data is inconsistent or any index
+// exceeds the size of the vector.
+*/
+template< typename Archive  // Type of the archive
+        , typename ET >     // Type of the elements
+EnableIf_t< IsNumeric_v<ET> >
+   VectorSerializer::deserializeCompressedElements( Archive& archive,
+                                                    DynamicVector<uint64_t>& indices,
+                                                    DynamicVector<ET>& values )
+{
+   uint64_t size( 0UL );
+
+   if( !( archive >> size ) ) return;
+
+   if( size > number_*10UL ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+
+   std::vector<byte_t> structure( size );
+
+   BlockCodec::decompress( archive, size, 1UL,
+                           [&structure]( const byte_t* src, size_t first, size_t count ) {
+      std::copy( src, src + count, structure.data() + first );
+   } );
+
+   BlockCodec::decompress( archive, number_*sizeof( ET ), sizeof( ET ),
+                           [&values]( const byte_t* src, size_t first, size_t count ) {
+      std::memcpy( values.data() + first, src, count*sizeof( ET ) );
+   } );
+
+   if( !archive ) return;
+
+   const byte_t* pos( structure.data() );
+   const byte_t* const end( pos + size );
+
+   size_t next( 0UL );
+
+   for( size_t i=0UL; i<number_; ++i )
+   {
+      uint64_t delta( 0UL );
+
+      if( !BlockCodec::decodeVarint( pos, end, delta ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+      }
+      else if( delta >= size_ - next ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid element index detected" );
+      }
+
+      indices[i] = next + delta;
+      next = indices[i] + 1UL;
+   }
+
+   if( pos != end ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Decompresses the non-zero elements of a sparse vector with non-numeric elements.
+//
+// \param archive The archive to be read from.
+// \param indices The buffer for the indices of the non-zero elements.
+// \param values The buffer for the values of the non-zero elements.
+// \return void
+// \exception std::runtime_error Invalid vector type detected.
+//
+// Since vectors with non-numeric elements are never compressed, this function always throws
+// a \a std::runtime_error exception.
+*/
+template< typename Archive  // Type of the archive
+        , typename ET >     // Type of the elements
+DisableIf_t< IsNumeric_v<ET> >
+   VectorSerializer::deserializeCompressedElements( Archive& archive,
+                                                    DynamicVector<uint64_t>& indices,
+                                                    DynamicVector<ET>& values )
+{
+   MAYBE_UNUSED( archive, indices, values );
+
+   BLAZE_THROW_RUNTIME_ERROR( "Invalid vector type detected" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the number of serialized elements of a dense vector.
+//
+// \param n The size of the vector.
+// \return The number of elements including padding.
+//
+// In version 3 of the format dense vectors with numeric elements are padded to a multiple of
+// \a alignment bytes. For all other element types no padding is used.
+*/
+template< typename ET >  // Type of the elements
+inline size_t VectorSerializer::paddedSize( size_t n ) noexcept
+{
+   return ( IsNumeric_v<ET> && alignment % sizeof( ET ) == 0UL )
+          ?( nextMultiple( n, alignment / sizeof( ET ) ) )
+          :( n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the next aligned offset relative to the header of a vector.
+//
+// \param start The position of the header relative to the beginning of the archive.
+// \param offset The minimum offset relative to the header.
+// \return The smallest offset that is aligned relative to the beginning of the archive.
+*/
+inline size_t VectorSerializer::alignedOffset( size_t start, size_t offset ) noexcept
+{
+   return nextMultiple( start + offset, alignment ) - start;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copies a range of elements of a contiguous dense vector.
+//
+// \param vec The dense vector.
+// \param first The index of the first element to be copied.
+// \param count The number of elements to be copied.
+// \param dst The destination of the elements.
+// \return void
+*/
+template< typename VT  // Type of the vector
+        , bool TF >    // Transpose flag
+inline EnableIf_t< IsContiguous_v<VT> && HasConstDataAccess_v<VT> >
+   VectorSerializer::gatherElements( const DenseVector<VT,TF>& vec, size_t first,
+                                     size_t count, byte_t* dst )
+{
+   std::memcpy( dst, (*vec).data() + first, count*sizeof( ElementType_t<VT> ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copies a range of elements of a dense vector.
+//
+// \param vec The dense vector.
+// \param first The index of the first element to be copied.
+// \param count The number of elements to be copied.
+// \param dst The destination of the elements.
+// \return void
+*/
+template< typename VT  // Type of the vector
+        , bool TF >    // Transpose flag
+inline DisableIf_t< IsContiguous_v<VT> && HasConstDataAccess_v<VT> >
+   VectorSerializer::gatherElements( const DenseVector<VT,TF>& vec, size_t first,
+                                     size_t count, byte_t* dst )
+{
+   using ET = ElementType_t<VT>;
+
+   for( size_t i=0UL; i<count; ++i ) {
+      const ET value( (*vec)[first+i] );
+      std::memcpy( dst + i*sizeof( ET ), &value, sizeof( ET ) );
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
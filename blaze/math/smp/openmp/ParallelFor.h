@@ -0,0 +1,132 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/openmp/ParallelFor.h
+//  \brief Header file for the OpenMP-based SMP parallel loop
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_OPENMP_PARALLELFOR_H_
+#define _BLAZE_MATH_SMP_OPENMP_PARALLELFOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <omp.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SMP loop functions */
+//@{
+template< typename Task >
+void smpFor( size_t tasks, Task&& task );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief OpenMP-based SMP loop over a range of independent tasks.
+// \ingroup smp
+//
+// \param tasks The total number of tasks.
+// \param task The task to be executed for every index in the range \f$[0..tasks)\f$.
+// \return void
+//
+// This function executes the given task for every index in the range \f$[0..tasks)\f$. The
+// tasks are distributed dynamically among the available OpenMP threads. Therefore the tasks
+// must be independent of each other, i.e. they must not write to the same memory locations.
+// In case the function is called inside a serial section or inside another parallel section
+// (i.e. during an SMP assignment) the tasks are executed serially by the calling thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the parallel
+// execution of the Blaze compute kernels.
+*/
+template< typename Task >  // Type of the task
+void smpFor( size_t tasks, Task&& task )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( tasks < 2UL || isSerialSectionActive() || isParallelSectionActive() ) {
+      for( size_t t=0UL; t<tasks; ++t ) {
+         task( t );
+      }
+      return;
+   }
+
+   const long n( static_cast<long>( tasks ) );
+
+   BLAZE_PARALLEL_SECTION
+   {
+#pragma omp parallel for schedule(dynamic,1) shared(task)
+      for( long t=0L; t<n; ++t ) {
+         task( static_cast<size_t>( t ) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_OPENMP_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
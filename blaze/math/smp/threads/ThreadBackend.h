@@ -100,6 +100,9 @@ class ThreadBackend
    //@{
    template< typename Target, typename Source, typename OP >
    static inline void schedule( Target& target, const Source& source, OP op );
+
+   template< typename Task >
+   static inline void schedule( Task task );
    //@}
    //**********************************************************************************************
 
@@ -297,6 +300,29 @@ inline void ThreadBackend<TT,MT,LT,CT>::schedule( Target& target, const Source&
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling a general task for execution.
+//
+// \param task The task to be executed.
+// \return void
+//
+// This function schedules the given task (i.e. a function or functor without arguments) for
+// execution by the thread pool.
+*/
+template< typename TT      // Type of the encapsulated thread
+        , typename MT      // Type of the synchronization mutex
+        , typename LT      // Type of the mutex lock
+        , typename CT >    // Type of the condition variable
+template< typename Task >  // Type of the task
+inline void ThreadBackend<TT,MT,LT,CT>::schedule( Task task )
+{
+   threadpool_.schedule( task );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -0,0 +1,240 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/Arnoldi.h
+//  \brief Header file for the restarted Arnoldi eigensolver
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_ARNOLDI_H_
+#define _BLAZE_MATH_SOLVERS_ARNOLDI_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/solvers/ConvergenceMonitor.h>
+#include <blaze/math/solvers/EigenTarget.h>
+#include <blaze/math/solvers/KrylovSchur.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ARNOLDI FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes a few eigenpairs of a general linear operator by the restarted Arnoldi
+//        method.
+// \ingroup solvers
+//
+// \param op The linear operator, called as \c op(y,x) to compute \f$ y = Ax \f$.
+// \param v0 The start vector.
+// \param w The resulting vector of the \a nev complex eigenvalues.
+// \param X The resulting \a n-by-\a nev matrix of complex, normalized eigenvectors.
+// \param nev The number of requested eigenpairs.
+// \param target The selected part of the spectrum.
+// \param monitor The convergence monitor.
+// \param ncv The maximum dimension of the Krylov subspace (default: max(2*nev+1,20)).
+// \return \a true in case all requested eigenpairs have converged, \a false if not.
+// \exception std::invalid_argument Invalid number of eigenvalues requested.
+// \exception std::invalid_argument Invalid subspace dimension provided.
+// \exception std::invalid_argument Invalid start vector provided.
+//
+// This function computes the \a nev eigenvalues of the selected part of the spectrum and the
+// corresponding eigenvectors of the general \a n-by-\a n linear operator \a op by means of the
+// Arnoldi method. The operator is only accessed via matrix/vector products \c op(y,x), where
+// \c y is a \c DynamicVector and \c x is a dense column vector of size \a n. This allows to use
+// arbitrary Blaze expressions as well as spectral transformations. The Krylov basis is extended
+// up to the dimension \a ncv with full orthogonalization by dense matrix/vector products with
+// the complete basis (see krylovOrthogonalize()). Afterwards the basis is truncated to the
+// invariant subspace of the most wanted Ritz values by means of the Krylov-Schur restart
+// (Stewart, 2001), which is mathematically equivalent to the implicit restart with exact shifts
+// (Sorensen, 1992) but does not require any bulge chasing. In case of a real operator the
+// computation is performed in real arithmetic and complex conjugate pairs of Ritz values are
+// always kept together. The \a monitor counts the number of restarts and is fed with the
+// largest residual norm \f$ \|Ax-\theta x\| \f$ of the \a nev wanted Ritz pairs relative to
+// the largest Ritz value in magnitude. The (complex) eigenvalues are stored in \a w in the
+// order of preference given by \a target, the (complex) eigenvectors are stored in the
+// corresponding columns of \a X. Both are resized to the correct dimensions (if possible and
+// necessary). The Krylov basis requires \f$ n \cdot (ncv+1) \f$ elements of memory.
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Resizing and initialization
+
+   blaze::DynamicVector<double> v0( A.rows(), 1.0 );
+   blaze::DynamicVector< blaze::complex<double> > w;
+   blaze::DynamicMatrix< blaze::complex<double>, blaze::columnMajor > X;
+
+   blaze::ConvergenceMonitor monitor( 500UL, 1E-10 );
+
+   // Computation of the 6 eigenvalues of largest real part of A^T
+   arnoldi( [&]( auto& y, const auto& x ) { y = trans( A ) * x; },
+            v0, w, X, 6UL, blaze::largestReal, monitor );
+   \endcode
+
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename OP     // Type of the linear operator
+        , typename VT0    // Type of the start vector
+        , typename VT     // Type of the vector of eigenvalues
+        , bool TF         // Transpose flag of the vector of eigenvalues
+        , typename MT     // Type of the matrix of eigenvectors
+        , bool SO         // Storage order of the matrix of eigenvectors
+        , typename MON >  // Type of the convergence monitor
+bool arnoldi( const OP& op, const DenseVector<VT0,false>& v0, DenseVector<VT,TF>& w,
+              DenseMatrix<MT,SO>& X, size_t nev, EigenTarget target, MON& monitor,
+              size_t ncv = 0UL )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<VT0> );
+
+   return krylovSchur<false>( op, *v0, *w, *X, nev, target, monitor, ncv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a few eigenpairs of a general square matrix by the restarted Arnoldi method.
+// \ingroup solvers
+//
+// \param A The general dense or sparse square matrix.
+// \param w The resulting vector of the \a nev complex eigenvalues.
+// \param X The resulting \a n-by-\a nev matrix of complex, normalized eigenvectors.
+// \param nev The number of requested eigenpairs.
+// \param target The selected part of the spectrum.
+// \param monitor The convergence monitor.
+// \param ncv The maximum dimension of the Krylov subspace (default: max(2*nev+1,20)).
+// \return \a true in case all requested eigenpairs have converged, \a false if not.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid number of eigenvalues requested.
+// \exception std::invalid_argument Invalid subspace dimension provided.
+//
+// This function computes the \a nev eigenvalues of the selected part of the spectrum and the
+// corresponding eigenvectors of the given general matrix or matrix expression \a A by means of
+// the restarted Arnoldi method (see the operator-based arnoldi() function for details). The
+// random start vector is drawn from the random number generator of the Blaze library, i.e. the
+// result is reproducible for a fixed seed (see setSeed()).
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Resizing and initialization
+
+   blaze::DynamicVector< blaze::complex<double> > w;
+   blaze::DynamicMatrix< blaze::complex<double>, blaze::columnMajor > X;
+
+   blaze::ConvergenceMonitor monitor( 500UL, 1E-10 );
+   arnoldi( A, w, X, 10UL, blaze::largestMagnitude, monitor );
+   \endcode
+
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT1    // Type of the matrix
+        , bool SO1        // Storage order of the matrix
+        , typename VT     // Type of the vector of eigenvalues
+        , bool TF         // Transpose flag of the vector of eigenvalues
+        , typename MT2    // Type of the matrix of eigenvectors
+        , bool SO2        // Storage order of the matrix of eigenvectors
+        , typename MON >  // Type of the convergence monitor
+bool arnoldi( const Matrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& X,
+              size_t nev, EigenTarget target, MON& monitor, size_t ncv = 0UL )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = ElementType_t<MT1>;
+   using BT = UnderlyingBuiltin_t<ET>;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ET );
+
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   DynamicVector<ET> v0( (*A).rows() );
+
+   if( nev > 0UL && nev <= v0.size() ) {
+      randomize( v0, BT(-1), BT(1) );
+   }
+
+   return krylovSchur<false>( [&A]( auto& y, const auto& x ) { y = (*A) * x; },
+                             v0, *w, *X, nev, target, monitor, ncv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a few eigenpairs of a general square matrix by the restarted Arnoldi method.
+// \ingroup solvers
+//
+// \param A The general dense or sparse square matrix.
+// \param w The resulting vector of the \a nev complex eigenvalues.
+// \param X The resulting \a n-by-\a nev matrix of complex, normalized eigenvectors.
+// \param nev The number of requested eigenpairs.
+// \param target The selected part of the spectrum (default: largestMagnitude).
+// \return \a true in case all requested eigenpairs have converged, \a false if not.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid number of eigenvalues requested.
+//
+// This function computes the \a nev eigenpairs with a default constructed ConvergenceMonitor.
+*/
+template< typename MT1   // Type of the matrix
+        , bool SO1       // Storage order of the matrix
+        , typename VT    // Type of the vector of eigenvalues
+        , bool TF        // Transpose flag of the vector of eigenvalues
+        , typename MT2   // Type of the matrix of eigenvectors
+        , bool SO2 >     // Storage order of the matrix of eigenvectors
+bool arnoldi( const Matrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& X,
+              size_t nev, EigenTarget target = largestMagnitude )
+{
+   ConvergenceMonitor monitor;
+   return arnoldi( *A, *w, *X, nev, target, monitor );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,206 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/BiCGSTAB.h
+//  \brief Header file for the preconditioned BiCGSTAB method
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_BICGSTAB_H_
+#define _BLAZE_MATH_SOLVERS_BICGSTAB_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/solvers/ConvergenceMonitor.h>
+#include <blaze/math/solvers/IdentityPreconditioner.h>
+#include <blaze/math/solvers/Kernels.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BICGSTAB FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves a general linear system by the right-preconditioned BiCGSTAB method.
+// \ingroup solvers
+//
+// \param A The system matrix.
+// \param x The initial guess on entry, the approximate solution on exit.
+// \param b The right-hand side vector.
+// \param M The preconditioner.
+// \param monitor The convergence monitor.
+// \return \a true in case the iteration has converged, \a false if not.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::invalid_argument Invalid solution vector provided.
+//
+// This function solves the linear system \f$ Ax = b \f$ for an arbitrary dense or sparse
+// non-singular matrix \a A by the stabilized bi-conjugate gradient method of van der Vorst.
+// Since the preconditioner is applied from the right, the monitored residual norms are the
+// norms of the true residual \f$ b - Ax \f$. Each iteration requires two matrix/vector
+// multiplications and two applications of the preconditioner. The function returns \a false
+// in case the iteration breaks down before convergence.
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::ConvergenceMonitor monitor( 1000UL, 1E-10 );
+   bicgstab( A, x, b, blaze::ILU0Preconditioner<double>( A ), monitor );
+   \endcode
+*/
+template< typename MT     // Type of the system matrix
+        , bool SO         // Storage order of the system matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2    // Type of the right-hand side vector
+        , typename PC     // Type of the preconditioner
+        , typename MON >  // Type of the convergence monitor
+bool bicgstab( const Matrix<MT,SO>& A, DenseVector<VT1,false>& x,
+               const DenseVector<VT2,false>& b, const PC& M, MON& monitor )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = ElementType_t<VT1>;
+
+   checkKrylovArguments( *A, *x, *b );
+
+   const size_t n( (*x).size() );
+
+   const auto bnorm( krylovNorm( *b ) );
+
+   if( isDefault<strict>( bnorm ) ) {
+      reset( *x );
+      return monitor.start( 0.0, 0.0 );
+   }
+
+   DynamicVector<ET> r( *b - (*A) * (*x) );
+
+   if( monitor.start( bnorm, krylovNorm( r ) ) ) {
+      return monitor.converged();
+   }
+
+   const DynamicVector<ET> rhat( r );
+   DynamicVector<ET> p( n, ET() ), v( n, ET() ), phat( n ), s( n ), shat( n ), t( n );
+
+   ET rho( 1 ), alpha( 1 ), omega( 1 );
+
+   while( true )
+   {
+      const ET rhoNew( krylovDot( rhat, r ) );
+
+      if( isDefault<strict>( rhoNew ) ) break;
+
+      const ET beta( ( rhoNew / rho ) * ( alpha / omega ) );
+      rho = rhoNew;
+
+      p = r + beta * ( p - omega * v );
+      M.apply( phat, p );
+      v = (*A) * phat;
+
+      const ET rv( krylovDot( rhat, v ) );
+
+      if( isDefault<strict>( rv ) ) break;
+
+      alpha = rho / rv;
+
+      const auto ss( std::sqrt( krylovSubNorm( s, r, alpha, v ) ) );
+
+      if( ss <= monitor.threshold() ) {
+         (*x) += alpha * phat;
+         monitor.step( ss );
+         break;
+      }
+
+      M.apply( shat, s );
+      t = (*A) * shat;
+
+      const auto ts( krylovDot2( t, s ) );
+
+      if( isDefault<strict>( ts[1] ) ) break;
+
+      omega = ts[0] / ts[1];
+      (*x) += alpha * phat + omega * shat;
+
+      const auto rr( std::sqrt( krylovSubNorm( r, s, omega, t ) ) );
+
+      if( monitor.step( rr ) || isDefault<strict>( omega ) ) break;
+   }
+
+   return monitor.converged();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves a general linear system by the BiCGSTAB method.
+// \ingroup solvers
+//
+// \param A The system matrix.
+// \param x The initial guess on entry, the approximate solution on exit.
+// \param b The right-hand side vector.
+// \return \a true in case the iteration has converged, \a false if not.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::invalid_argument Invalid solution vector provided.
+//
+// This function solves \f$ Ax = b \f$ without preconditioner and with a default constructed
+// ConvergenceMonitor.
+*/
+template< typename MT    // Type of the system matrix
+        , bool SO        // Storage order of the system matrix
+        , typename VT1   // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+bool bicgstab( const Matrix<MT,SO>& A, DenseVector<VT1,false>& x,
+               const DenseVector<VT2,false>& b )
+{
+   ConvergenceMonitor monitor;
+   return bicgstab( *A, *x, *b, IdentityPreconditioner(), monitor );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
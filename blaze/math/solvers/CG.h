@@ -0,0 +1,203 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/CG.h
+//  \brief Header file for the preconditioned conjugate gradient method
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_CG_H_
+#define _BLAZE_MATH_SOLVERS_CG_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/solvers/ConvergenceMonitor.h>
+#include <blaze/math/solvers/IdentityPreconditioner.h>
+#include <blaze/math/solvers/Kernels.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CG FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves a symmetric (Hermitian) positive definite linear system by the preconditioned
+//        conjugate gradient method.
+// \ingroup solvers
+//
+// \param A The symmetric (Hermitian) positive definite system matrix.
+// \param x The initial guess on entry, the approximate solution on exit.
+// \param b The right-hand side vector.
+// \param M The symmetric (Hermitian) positive definite preconditioner.
+// \param monitor The convergence monitor.
+// \return \a true in case the iteration has converged, \a false if not.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::invalid_argument Invalid solution vector provided.
+//
+// This function solves the linear system \f$ Ax = b \f$ for an arbitrary dense or sparse
+// symmetric (Hermitian) positive definite matrix \a A. The iteration stops as soon as the
+// given \a monitor reports convergence or the maximum number of iterations. Per iteration the
+// function performs one matrix/vector multiplication, one application of the preconditioner
+// and three passes over the vectors: The updates of the solution and the residual are fused
+// with the computation of the residual norm and the inner products are computed in parallel.
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::ConvergenceMonitor monitor( 1000UL, 1E-10 );
+   cg( A, x, b, blaze::IC0Preconditioner<double>( A ), monitor );
+   \endcode
+*/
+template< typename MT     // Type of the system matrix
+        , bool SO         // Storage order of the system matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2    // Type of the right-hand side vector
+        , typename PC     // Type of the preconditioner
+        , typename MON >  // Type of the convergence monitor
+bool cg( const Matrix<MT,SO>& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+         const PC& M, MON& monitor )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = ElementType_t<VT1>;
+
+   constexpr bool identity( IsSame_v<PC,IdentityPreconditioner> );
+
+   checkKrylovArguments( *A, *x, *b );
+
+   const size_t n( (*x).size() );
+
+   const auto bnorm( krylovNorm( *b ) );
+
+   if( isDefault<strict>( bnorm ) ) {
+      reset( *x );
+      return monitor.start( 0.0, 0.0 );
+   }
+
+   DynamicVector<ET> r( *b - (*A) * (*x) ), z( identity ? 0UL : n ), q( n );
+
+   if( monitor.start( bnorm, krylovNorm( r ) ) ) {
+      return monitor.converged();
+   }
+
+   ET rz;
+
+   if( identity ) {
+      rz = krylovDot( r, r );
+   }
+   else {
+      M.apply( z, r );
+      rz = krylovDot( r, z );
+   }
+
+   DynamicVector<ET> p( identity ? r : z );
+
+   while( true )
+   {
+      q = (*A) * p;
+
+      const ET pq( krylovDot( p, q ) );
+
+      if( isDefault<strict>( pq ) ) break;
+
+      const ET alpha( rz / pq );
+      const auto rr( krylovUpdate( *x, alpha, p, r, q ) );
+
+      if( monitor.step( std::sqrt( rr ) ) ) break;
+
+      ET rzNew;
+
+      if( identity ) {
+         rzNew = rr;
+         p = r + ( rzNew / rz ) * p;
+      }
+      else {
+         M.apply( z, r );
+         rzNew = krylovDot( r, z );
+         p = z + ( rzNew / rz ) * p;
+      }
+
+      rz = rzNew;
+   }
+
+   return monitor.converged();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves a symmetric (Hermitian) positive definite linear system by the conjugate
+//        gradient method.
+// \ingroup solvers
+//
+// \param A The symmetric (Hermitian) positive definite system matrix.
+// \param x The initial guess on entry, the approximate solution on exit.
+// \param b The right-hand side vector.
+// \return \a true in case the iteration has converged, \a false if not.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::invalid_argument Invalid solution vector provided.
+//
+// This function solves \f$ Ax = b \f$ without preconditioner and with a default constructed
+// ConvergenceMonitor.
+*/
+template< typename MT    // Type of the system matrix
+        , bool SO        // Storage order of the system matrix
+        , typename VT1   // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+bool cg( const Matrix<MT,SO>& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b )
+{
+   ConvergenceMonitor monitor;
+   return cg( *A, *x, *b, IdentityPreconditioner(), monitor );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,371 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/ConvergenceMonitor.h
+//  \brief Header file for the ConvergenceMonitor class
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_CONVERGENCEMONITOR_H_
+#define _BLAZE_MATH_SOLVERS_CONVERGENCEMONITOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <functional>
+#include <utility>
+#include <vector>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Convergence monitor for the iterative solvers.
+// \ingroup solvers
+//
+// The ConvergenceMonitor class controls the termination of the iterative solvers (cg(),
+// bicgstab(), gmres(), and minres()) and records their progress. An iteration is considered
+// to be converged as soon as the residual norm satisfies
+
+                  \f[ \|r\| \leq \max( relTol \cdot \|b\|, absTol ), \f]
+
+// where \f$ b \f$ is the right-hand side of the linear system. The solver stops at the latest
+// after the given maximum number of iterations:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::ConvergenceMonitor monitor( 500UL, 1E-10 );  // At most 500 iterations, rel. tol. 1E-10
+   monitor.recordHistory( true );                     // Record all residual norms
+   monitor.setCallback( []( size_t it, double res ) { std::cout << it << ": " << res << "\n"; } );
+
+   cg( A, x, b, blaze::IdentityPreconditioner(), monitor );
+
+   if( !monitor.converged() ) { ... }
+   \endcode
+
+// All solvers are templates on the type of the monitor, i.e. any class providing the
+// \c start(), \c step() and \c converged() member functions with the same semantics can be
+// used as convergence monitor.
+*/
+class ConvergenceMonitor
+{
+ public:
+   //**Type definitions****************************************************************************
+   using Callback = std::function<void(size_t,double)>;  //!< Type of the progress callback.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline ConvergenceMonitor( size_t maxIterations = 1000UL,
+                                       double relTol = 1E-8, double absTol = 0.0 );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void recordHistory( bool record ) noexcept;
+   inline void setCallback( Callback callback );
+
+   inline size_t maxIterations() const noexcept;
+   inline double relTol       () const noexcept;
+   inline double absTol       () const noexcept;
+   inline double threshold    () const noexcept;
+   inline size_t iterations   () const noexcept;
+   inline double residual     () const noexcept;
+   inline bool   converged    () const noexcept;
+
+   inline const std::vector<double>& history() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Monitoring functions************************************************************************
+   /*!\name Monitoring functions */
+   //@{
+   inline bool start( double reference, double residual );
+   inline bool step ( double residual );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t maxIterations_;         //!< The maximum number of iterations.
+   double relTol_;                //!< The relative tolerance.
+   double absTol_;                //!< The absolute tolerance.
+   double threshold_;             //!< The residual threshold of the current solve.
+   size_t iterations_;            //!< The number of performed iterations.
+   double residual_;              //!< The most recent residual norm.
+   bool converged_;               //!< Convergence flag of the current solve.
+   bool record_;                  //!< Flag for the recording of the residual history.
+   std::vector<double> history_;  //!< The history of residual norms.
+   Callback callback_;            //!< The progress callback.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor for ConvergenceMonitor.
+//
+// \param maxIterations The maximum number of iterations.
+// \param relTol The relative tolerance with respect to the norm of the right-hand side.
+// \param absTol The absolute tolerance.
+*/
+inline ConvergenceMonitor::ConvergenceMonitor( size_t maxIterations, double relTol, double absTol )
+   : maxIterations_( maxIterations )  // The maximum number of iterations
+   , relTol_       ( relTol )         // The relative tolerance
+   , absTol_       ( absTol )         // The absolute tolerance
+   , threshold_    ( 0.0 )            // The residual threshold of the current solve
+   , iterations_   ( 0UL )            // The number of performed iterations
+   , residual_     ( 0.0 )            // The most recent residual norm
+   , converged_    ( false )          // Convergence flag of the current solve
+   , record_       ( false )          // Flag for the recording of the residual history
+   , history_      ()                 // The history of residual norms
+   , callback_     ()                 // The progress callback
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Enables or disables the recording of the residual history.
+//
+// \param record \a true to record all residual norms, \a false to disable the recording.
+// \return void
+*/
+inline void ConvergenceMonitor::recordHistory( bool record ) noexcept
+{
+   record_ = record;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets a callback that is invoked with the iteration count and residual of every step.
+//
+// \param callback The progress callback.
+// \return void
+*/
+inline void ConvergenceMonitor::setCallback( Callback callback )
+{
+   callback_ = std::move( callback );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum number of iterations.
+//
+// \return The maximum number of iterations.
+*/
+inline size_t ConvergenceMonitor::maxIterations() const noexcept
+{
+   return maxIterations_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the relative tolerance.
+//
+// \return The relative tolerance.
+*/
+inline double ConvergenceMonitor::relTol() const noexcept
+{
+   return relTol_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the absolute tolerance.
+//
+// \return The absolute tolerance.
+*/
+inline double ConvergenceMonitor::absTol() const noexcept
+{
+   return absTol_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the residual threshold of the current solve.
+//
+// \return The residual threshold \f$ \max( relTol \cdot \|b\|, absTol ) \f$.
+*/
+inline double ConvergenceMonitor::threshold() const noexcept
+{
+   return threshold_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of iterations performed by the last solve.
+//
+// \return The number of iterations.
+*/
+inline size_t ConvergenceMonitor::iterations() const noexcept
+{
+   return iterations_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the final residual norm of the last solve.
+//
+// \return The residual norm.
+*/
+inline double ConvergenceMonitor::residual() const noexcept
+{
+   return residual_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the last solve has converged.
+//
+// \return \a true in case the last solve has converged, \a false if not.
+*/
+inline bool ConvergenceMonitor::converged() const noexcept
+{
+   return converged_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the recorded residual norms of the last solve (including the initial residual).
+//
+// \return The history of residual norms.
+*/
+inline const std::vector<double>& ConvergenceMonitor::history() const noexcept
+{
+   return history_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MONITORING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Starts the monitoring of a new solve.
+//
+// \param reference The reference norm for the relative tolerance (usually \f$ \|b\| \f$).
+// \param residual The initial residual norm.
+// \return \a true in case the initial guess already satisfies the tolerance, \a false if not.
+*/
+inline bool ConvergenceMonitor::start( double reference, double residual )
+{
+   threshold_  = ( relTol_ * reference > absTol_ ) ? relTol_ * reference : absTol_;
+   iterations_ = 0UL;
+   residual_   = residual;
+   converged_  = ( residual <= threshold_ );
+
+   history_.clear();
+   if( record_ ) {
+      history_.push_back( residual );
+   }
+
+   if( callback_ ) {
+      callback_( 0UL, residual );
+   }
+
+   return converged_ || maxIterations_ == 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the residual norm of a single iteration.
+//
+// \param residual The current residual norm.
+// \return \a true in case the solver should terminate, \a false if not.
+*/
+inline bool ConvergenceMonitor::step( double residual )
+{
+   ++iterations_;
+   residual_  = residual;
+   converged_ = ( residual <= threshold_ );
+
+   if( record_ ) {
+      history_.push_back( residual );
+   }
+
+   if( callback_ ) {
+      callback_( iterations_, residual );
+   }
+
+   return converged_ || iterations_ >= maxIterations_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
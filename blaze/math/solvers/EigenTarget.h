@@ -0,0 +1,74 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/EigenTarget.h
+//  \brief Header file for the selection of eigenvalues of the iterative eigensolvers
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_EIGENTARGET_H_
+#define _BLAZE_MATH_SOLVERS_EIGENTARGET_H_
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  EIGEN TARGET VALUES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Selection of the eigenvalues computed by the iterative eigensolvers.
+// \ingroup solvers
+//
+// The EigenTarget type enumeration represents the part of the spectrum that is computed by the
+// lanczos() and arnoldi() eigensolvers. The following flags are available:
+//
+//  - \c largestMagnitude: The eigenvalues of largest magnitude.
+//  - \c smallestMagnitude: The eigenvalues of smallest magnitude. Note that the convergence to
+//          interior eigenvalues is usually slow; in this case it is advisable to compute the
+//          eigenvalues of largest magnitude of a shifted and inverted operator.
+//  - \c largestReal: The eigenvalues of largest real part (i.e. the largest eigenvalues in case
+//          of a symmetric or Hermitian matrix).
+//  - \c smallestReal: The eigenvalues of smallest real part (i.e. the smallest eigenvalues in
+//          case of a symmetric or Hermitian matrix).
+*/
+enum EigenTarget
+{
+   largestMagnitude  = 0,  //!< Eigenvalues of largest magnitude.
+   smallestMagnitude = 1,  //!< Eigenvalues of smallest magnitude.
+   largestReal       = 2,  //!< Eigenvalues of largest real part.
+   smallestReal      = 3   //!< Eigenvalues of smallest real part.
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,262 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/GMRES.h
+//  \brief Header file for the restarted GMRES method
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_GMRES_H_
+#define _BLAZE_MATH_SOLVERS_GMRES_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/solvers/ConvergenceMonitor.h>
+#include <blaze/math/solvers/IdentityPreconditioner.h>
+#include <blaze/math/solvers/Kernels.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GMRES FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves a general linear system by the right-preconditioned restarted GMRES method.
+// \ingroup solvers
+//
+// \param A The system matrix.
+// \param x The initial guess on entry, the approximate solution on exit.
+// \param b The right-hand side vector.
+// \param M The preconditioner.
+// \param monitor The convergence monitor.
+// \param restart The maximum dimension of the Krylov subspace before a restart (default: 30).
+// \return \a true in case the iteration has converged, \a false if not.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::invalid_argument Invalid solution vector provided.
+// \exception std::invalid_argument Invalid restart length provided.
+//
+// This function solves the linear system \f$ Ax = b \f$ for an arbitrary dense or sparse
+// non-singular matrix \a A by the generalized minimal residual method GMRES(\a restart). The
+// Arnoldi basis is orthogonalized by the modified Gram-Schmidt process, in which each
+// subtraction of a projection is fused with the inner product of the following one. The
+// Hessenberg matrix is reduced by Givens rotations, which makes the residual norm available
+// in every iteration without additional cost. Since the preconditioner is applied from the
+// right, the monitored residual norms are the norms of the true residual \f$ b - Ax \f$ (up to
+// rounding errors). The Krylov basis requires \f$ n \cdot (restart+1) \f$ elements of memory.
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::ConvergenceMonitor monitor( 1000UL, 1E-10 );
+   gmres( A, x, b, blaze::ILU0Preconditioner<double>( A ), monitor, 50UL );
+   \endcode
+*/
+template< typename MT     // Type of the system matrix
+        , bool SO         // Storage order of the system matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2    // Type of the right-hand side vector
+        , typename PC     // Type of the preconditioner
+        , typename MON >  // Type of the convergence monitor
+bool gmres( const Matrix<MT,SO>& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+            const PC& M, MON& monitor, size_t restart = 30UL )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = ElementType_t<VT1>;
+   using BT = UnderlyingBuiltin_t<ET>;
+
+   checkKrylovArguments( *A, *x, *b );
+
+   if( restart == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid restart length provided" );
+   }
+
+   const size_t n( (*x).size() );
+   const size_t m( min( restart, n ) );
+
+   const BT bnorm( krylovNorm( *b ) );
+
+   if( isDefault<strict>( bnorm ) ) {
+      reset( *x );
+      return monitor.start( 0.0, 0.0 );
+   }
+
+   DynamicVector<ET> r( *b - (*A) * (*x) );
+   BT beta( krylovNorm( r ) );
+
+   if( monitor.start( bnorm, beta ) ) {
+      return monitor.converged();
+   }
+
+   DynamicVector<ET> w( n ), z( n ), g( m+1UL ), s( m ), y( m );
+   DynamicVector<BT> c( m );
+   DynamicMatrix<ET,columnMajor> V( n, m+1UL );
+   DynamicMatrix<ET,columnMajor> H( m+1UL, m );
+
+   bool stop( false );
+
+   while( !stop )
+   {
+      column( V, 0UL ) = r * ( BT(1) / beta );
+      reset( g );
+      g[0UL] = beta;
+
+      size_t k( 0UL );
+
+      for( ; k<m && !stop; ++k )
+      {
+         // Arnoldi step with fused modified Gram-Schmidt orthogonalization
+         M.apply( z, column( V, k ) );
+         w = (*A) * z;
+
+         H(0UL,k) = krylovDot( column( V, 0UL ), w );
+         for( size_t i=0UL; i<k; ++i ) {
+            const auto vi( column( V, i ) );
+            const auto vn( column( V, i+1UL ) );
+            H(i+1UL,k) = krylovSubDot( w, H(i,k), vi, vn );
+         }
+
+         const auto vk( column( V, k ) );
+         const BT hn( std::sqrt( krylovSubNorm( w, w, H(k,k), vk ) ) );
+         H(k+1UL,k) = hn;
+
+         if( !isDefault<strict>( hn ) ) {
+            column( V, k+1UL ) = w * ( BT(1) / hn );
+         }
+
+         // Application of the previous Givens rotations
+         for( size_t i=0UL; i<k; ++i ) {
+            const ET tmp( c[i] * H(i,k) + s[i] * H(i+1UL,k) );
+            H(i+1UL,k) = c[i] * H(i+1UL,k) - conj( s[i] ) * H(i,k);
+            H(i,k) = tmp;
+         }
+
+         // Computation and application of the new Givens rotation
+         const BT ha( abs( H(k,k) ) );
+         const BT t ( std::sqrt( ha*ha + hn*hn ) );
+
+         if( isDefault<strict>( ha ) ) {
+            c[k] = BT(0);
+            s[k] = ET(1);
+            H(k,k) = hn;
+         }
+         else {
+            c[k] = ha / t;
+            s[k] = ( H(k,k) / ha ) * ( hn / t );
+            H(k,k) = ( H(k,k) / ha ) * t;
+         }
+         H(k+1UL,k) = ET();
+
+         g[k+1UL] = -conj( s[k] ) * g[k];
+         g[k] *= c[k];
+
+         stop = monitor.step( abs( g[k+1UL] ) ) || isDefault<strict>( hn );
+      }
+
+      // Solution of the upper triangular least squares system
+      for( size_t i=k; i-- > 0UL; ) {
+         ET tmp( g[i] );
+         for( size_t j=i+1UL; j<k; ++j ) {
+            tmp -= H(i,j) * y[j];
+         }
+         y[i] = tmp / H(i,i);
+      }
+
+      w = submatrix( V, 0UL, 0UL, n, k ) * subvector( y, 0UL, k );
+      M.apply( z, w );
+      (*x) += z;
+
+      if( stop ) break;
+
+      r = *b - (*A) * (*x);
+      beta = krylovNorm( r );
+   }
+
+   return monitor.converged();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves a general linear system by the restarted GMRES method.
+// \ingroup solvers
+//
+// \param A The system matrix.
+// \param x The initial guess on entry, the approximate solution on exit.
+// \param b The right-hand side vector.
+// \return \a true in case the iteration has converged, \a false if not.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::invalid_argument Invalid solution vector provided.
+//
+// This function solves \f$ Ax = b \f$ by GMRES(30) without preconditioner and with a default
+// constructed ConvergenceMonitor.
+*/
+template< typename MT    // Type of the system matrix
+        , bool SO        // Storage order of the system matrix
+        , typename VT1   // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+bool gmres( const Matrix<MT,SO>& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b )
+{
+   ConvergenceMonitor monitor;
+   return gmres( *A, *x, *b, IdentityPreconditioner(), monitor );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
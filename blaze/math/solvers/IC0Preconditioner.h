@@ -0,0 +1,306 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/IC0Preconditioner.h
+//  \brief Header file for the IC0Preconditioner class
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_IC0PRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_IC0PRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <vector>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Incomplete Cholesky preconditioner without fill-in (IC(0)) for the iterative solvers.
+// \ingroup solvers
+//
+// The IC0Preconditioner class computes an incomplete Cholesky decomposition
+// \f$ M = LL^H \approx A \f$ of a symmetric (Hermitian) positive definite system matrix, where
+// \f$ L \f$ has the same sparsity pattern as the lower part of \a A. Only the lower part of
+// \a A is accessed. The preconditioner is symmetric (Hermitian) positive definite and can
+// therefore be used with cg() and minres():
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::ConvergenceMonitor monitor;
+   cg( A, x, b, blaze::IC0Preconditioner<double>( A ), monitor );
+   \endcode
+
+// Note that the incomplete factorization might break down for positive definite matrices that
+// are not M-matrices. In this case a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Data type of the preconditioner
+class IC0Preconditioner
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;  //!< Data type of the preconditioner.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   IC0Preconditioner() = default;
+
+   template< typename MT, bool SO >
+   explicit inline IC0Preconditioner( const Matrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, bool SO >
+   void compute( const Matrix<MT,SO>& A );
+
+   template< typename VT1, typename VT2 >
+   void apply( DenseVector<VT1,false>& z, const DenseVector<VT2,false>& r ) const;
+
+   inline const CompressedMatrix<Type,rowMajor>& factor() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   CompressedMatrix<Type,rowMajor> L_;  //!< The incomplete Cholesky factor.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the IC0Preconditioner.
+//
+// \param A The square, symmetric (Hermitian) positive definite system matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error IC(0) factorization of non-positive-definite matrix failed.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+inline IC0Preconditioner<Type>::IC0Preconditioner( const Matrix<MT,SO>& A )
+{
+   compute( *A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the IC(0) factorization of the given system matrix.
+//
+// \param A The square, symmetric (Hermitian) positive definite system matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error IC(0) factorization of non-positive-definite matrix failed.
+//
+// The factor is computed row by row: The off-diagonal elements of row \a i are computed in
+// ascending column order from the already computed rows of \f$ L \f$, followed by the diagonal
+// element. Contributions outside the sparsity pattern of the lower part of \a A are dropped.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+void IC0Preconditioner<Type>::compute( const Matrix<MT,SO>& A )
+{
+   using BT = UnderlyingBuiltin_t<Type>;
+
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const CompressedMatrix<Type,rowMajor> tmp( *A );
+   const size_t n( tmp.rows() );
+
+   size_t nonzeros( 0UL );
+   for( size_t i=0UL; i<n; ++i ) {
+      for( auto element=tmp.begin(i); element!=tmp.end(i) && element->index()<=i; ++element ) {
+         ++nonzeros;
+      }
+   }
+
+   L_.reset();
+   L_.resize( n, n, false );
+   L_.reserve( nonzeros + n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      bool diagonal( false );
+      for( auto element=tmp.begin(i); element!=tmp.end(i) && element->index()<=i; ++element ) {
+         L_.append( i, element->index(), element->value(), false );
+         diagonal = ( element->index() == i );
+      }
+      if( !diagonal ) {
+         L_.append( i, i, Type(), false );
+      }
+      L_.finalize( i );
+   }
+
+   std::vector<Type*> marker( n, nullptr );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const auto begin( L_.begin(i) );
+      const auto diag ( L_.end(i) - 1 );
+
+      for( auto element=begin; element!=diag; ++element ) {
+         marker[element->index()] = &element->value();
+      }
+
+      for( auto element=begin; element!=diag; ++element )
+      {
+         const size_t k( element->index() );
+         const auto kdiag( L_.end(k) - 1 );
+
+         Type sum( element->value() );
+         for( auto kj=L_.begin(k); kj!=kdiag; ++kj ) {
+            if( marker[kj->index()] != nullptr ) {
+               sum -= (*marker[kj->index()]) * conj( kj->value() );
+            }
+         }
+         element->value() = sum / kdiag->value();
+      }
+
+      BT d( real( diag->value() ) );
+      for( auto element=begin; element!=diag; ++element ) {
+         d -= real( conj( element->value() ) * element->value() );
+         marker[element->index()] = nullptr;
+      }
+
+      if( !( d > BT(0) ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "IC(0) factorization of non-positive-definite matrix failed" );
+      }
+
+      diag->value() = Type( std::sqrt( d ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Applies the preconditioner to the given vector (\f$ z = L^{-H} L^{-1} r \f$).
+//
+// \param z The resulting vector.
+// \param r The vector to be preconditioned.
+// \return void
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename VT1     // Type of the resulting vector
+        , typename VT2 >   // Type of the vector to be preconditioned
+void IC0Preconditioner<Type>::apply( DenseVector<VT1,false>& z,
+                                     const DenseVector<VT2,false>& r ) const
+{
+   const size_t n( L_.rows() );
+
+   BLAZE_INTERNAL_ASSERT( (*r).size() == n, "Invalid vector size" );
+
+   *z = *r;
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const auto diag( L_.end(i) - 1 );
+      Type sum( (*z)[i] );
+      for( auto element=L_.begin(i); element!=diag; ++element ) {
+         sum -= element->value() * (*z)[element->index()];
+      }
+      (*z)[i] = sum / diag->value();
+   }
+
+   for( size_t i=n; i-- > 0UL; ) {
+      const auto diag( L_.end(i) - 1 );
+      (*z)[i] /= diag->value();
+      const auto zi( (*z)[i] );
+      for( auto element=L_.begin(i); element!=diag; ++element ) {
+         (*z)[element->index()] -= conj( element->value() ) * zi;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the incomplete Cholesky factor \f$ L \f$.
+//
+// \return The lower triangular incomplete Cholesky factor.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline const CompressedMatrix<Type,rowMajor>& IC0Preconditioner<Type>::factor() const noexcept
+{
+   return L_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,284 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/ILU0Preconditioner.h
+//  \brief Header file for the ILU0Preconditioner class
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_ILU0PRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_ILU0PRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Incomplete LU preconditioner without fill-in (ILU(0)) for the iterative solvers.
+// \ingroup solvers
+//
+// The ILU0Preconditioner class computes an incomplete LU decomposition \f$ M = LU \approx A \f$,
+// where \f$ L \f$ (with unit diagonal) and \f$ U \f$ have the same sparsity pattern as the lower
+// and upper part of the system matrix \a A. Both factors are stored in a single row-major
+// compressed matrix. The application consists of a forward and a backward substitution:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::ConvergenceMonitor monitor;
+   bicgstab( A, x, b, blaze::ILU0Preconditioner<double>( A ), monitor );
+   \endcode
+
+// Note that all diagonal elements of \a A must be contained in its sparsity pattern.
+*/
+template< typename Type >  // Data type of the preconditioner
+class ILU0Preconditioner
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;  //!< Data type of the preconditioner.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   ILU0Preconditioner() = default;
+
+   template< typename MT, bool SO >
+   explicit inline ILU0Preconditioner( const Matrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, bool SO >
+   void compute( const Matrix<MT,SO>& A );
+
+   template< typename VT1, typename VT2 >
+   void apply( DenseVector<VT1,false>& z, const DenseVector<VT2,false>& r ) const;
+
+   inline const CompressedMatrix<Type,rowMajor>& factors() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   CompressedMatrix<Type,rowMajor> LU_;  //!< The combined incomplete LU factors.
+   std::vector<size_t> diag_;            //!< The positions of the diagonal elements in each row.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ILU0Preconditioner.
+//
+// \param A The square system matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid matrix with zero diagonal element provided.
+// \exception std::runtime_error ILU(0) factorization of singular matrix failed.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+inline ILU0Preconditioner<Type>::ILU0Preconditioner( const Matrix<MT,SO>& A )
+{
+   compute( *A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the ILU(0) factorization of the given system matrix.
+//
+// \param A The square system matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid matrix with zero diagonal element provided.
+// \exception std::runtime_error ILU(0) factorization of singular matrix failed.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+void ILU0Preconditioner<Type>::compute( const Matrix<MT,SO>& A )
+{
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   LU_ = *A;
+
+   const size_t n( LU_.rows() );
+
+   diag_.assign( n, 0UL );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const auto element( LU_.find( i, i ) );
+      if( element == LU_.end(i) || isDefault<strict>( element->value() ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid matrix with zero diagonal element provided" );
+      }
+      diag_[i] = element - LU_.begin(i);
+   }
+
+   std::vector<Type*> marker( n, nullptr );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const auto begin( LU_.begin(i) );
+      const auto end  ( LU_.end(i)   );
+
+      for( auto element=begin; element!=end; ++element ) {
+         marker[element->index()] = &element->value();
+      }
+
+      for( auto element=begin; element!=begin+diag_[i]; ++element )
+      {
+         const size_t k( element->index() );
+         const auto pivot( LU_.begin(k) + diag_[k] );
+
+         element->value() /= pivot->value();
+         const Type lik( element->value() );
+
+         for( auto kj=pivot+1; kj!=LU_.end(k); ++kj ) {
+            if( marker[kj->index()] != nullptr ) {
+               *marker[kj->index()] -= lik * kj->value();
+            }
+         }
+      }
+
+      for( auto element=begin; element!=end; ++element ) {
+         marker[element->index()] = nullptr;
+      }
+
+      if( isDefault<strict>( ( begin + diag_[i] )->value() ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "ILU(0) factorization of singular matrix failed" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Applies the preconditioner to the given vector (\f$ z = U^{-1} L^{-1} r \f$).
+//
+// \param z The resulting vector.
+// \param r The vector to be preconditioned.
+// \return void
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename VT1     // Type of the resulting vector
+        , typename VT2 >   // Type of the vector to be preconditioned
+void ILU0Preconditioner<Type>::apply( DenseVector<VT1,false>& z,
+                                      const DenseVector<VT2,false>& r ) const
+{
+   const size_t n( LU_.rows() );
+
+   BLAZE_INTERNAL_ASSERT( (*r).size() == n, "Invalid vector size" );
+
+   *z = *r;
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const auto diag( LU_.begin(i) + diag_[i] );
+      Type sum( (*z)[i] );
+      for( auto element=LU_.begin(i); element!=diag; ++element ) {
+         sum -= element->value() * (*z)[element->index()];
+      }
+      (*z)[i] = sum;
+   }
+
+   for( size_t i=n; i-- > 0UL; ) {
+      const auto diag( LU_.begin(i) + diag_[i] );
+      Type sum( (*z)[i] );
+      for( auto element=diag+1; element!=LU_.end(i); ++element ) {
+         sum -= element->value() * (*z)[element->index()];
+      }
+      (*z)[i] = sum / diag->value();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the combined incomplete LU factors.
+//
+// \return The strictly lower part of \f$ L \f$ and the upper part of \f$ U \f$.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline const CompressedMatrix<Type,rowMajor>& ILU0Preconditioner<Type>::factors() const noexcept
+{
+   return LU_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
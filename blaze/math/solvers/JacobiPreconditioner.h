@@ -0,0 +1,202 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/JacobiPreconditioner.h
+//  \brief Header file for the JacobiPreconditioner class
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_JACOBIPRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_JACOBIPRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/views/Band.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Jacobi (diagonal) preconditioner for the iterative solvers.
+// \ingroup solvers
+//
+// The JacobiPreconditioner class represents the preconditioner \f$ M = diag(A) \f$. It stores
+// the inverse of the diagonal of the system matrix and applies it by a single elementwise
+// (and potentially parallel) vector multiplication:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::ConvergenceMonitor monitor;
+   cg( A, x, b, blaze::JacobiPreconditioner<double>( A ), monitor );
+   \endcode
+*/
+template< typename Type >  // Data type of the preconditioner
+class JacobiPreconditioner
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;  //!< Data type of the preconditioner.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   JacobiPreconditioner() = default;
+
+   template< typename MT, bool SO >
+   explicit inline JacobiPreconditioner( const Matrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, bool SO >
+   inline void compute( const Matrix<MT,SO>& A );
+
+   template< typename VT1, typename VT2 >
+   inline void apply( DenseVector<VT1,false>& z, const DenseVector<VT2,false>& r ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   DynamicVector<Type> inv_;  //!< The inverse of the diagonal of the system matrix.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the JacobiPreconditioner.
+//
+// \param A The square system matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid matrix with zero diagonal element provided.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+inline JacobiPreconditioner<Type>::JacobiPreconditioner( const Matrix<MT,SO>& A )
+{
+   compute( *A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the preconditioner for the given system matrix.
+//
+// \param A The square system matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid matrix with zero diagonal element provided.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+inline void JacobiPreconditioner<Type>::compute( const Matrix<MT,SO>& A )
+{
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   inv_ = diagonal( *A );
+
+   for( size_t i=0UL; i<inv_.size(); ++i ) {
+      if( isDefault<strict>( inv_[i] ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid matrix with zero diagonal element provided" );
+      }
+      inv_[i] = Type(1) / inv_[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Applies the preconditioner to the given vector (\f$ z = M^{-1} r \f$).
+//
+// \param z The resulting vector.
+// \param r The vector to be preconditioned.
+// \return void
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename VT1     // Type of the resulting vector
+        , typename VT2 >   // Type of the vector to be preconditioned
+inline void JacobiPreconditioner<Type>::apply( DenseVector<VT1,false>& z,
+                                               const DenseVector<VT2,false>& r ) const
+{
+   BLAZE_INTERNAL_ASSERT( (*r).size() == inv_.size(), "Invalid vector size" );
+
+   *z = inv_ * (*r);
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
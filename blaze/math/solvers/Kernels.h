@@ -0,0 +1,386 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/Kernels.h
+//  \brief Header file for the fused vector kernels of the iterative solvers
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_KERNELS_H_
+#define _BLAZE_MATH_SOLVERS_KERNELS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <cmath>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  REDUCTION FRAMEWORK
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel, fused loop with \a K simultaneous reductions over the range \f$[0..n)\f$.
+// \ingroup solvers
+//
+// \param n The size of the iteration range.
+// \param kernel The kernel to be executed for every subrange.
+// \return The \a K accumulated results.
+//
+// The given kernel is called as \c kernel(begin,end,acc) for disjoint subranges and accumulates
+// its contributions into the \a K elements of \a acc. In case \a n is larger than or equal to the
+// SMP_DVECASSIGN_THRESHOLD, the subranges are processed in parallel. The partial results are
+// summed up in a fixed order, i.e. the result only depends on the number of threads.
+*/
+template< size_t K         // Number of reductions
+        , typename T       // Type of the reduction results
+        , typename Kernel >  // Type of the kernel
+std::array<T,K> krylovReduce( size_t n, Kernel&& kernel )
+{
+   std::array<T,K> result{};
+
+   const size_t parts( ( n < SMP_DVECASSIGN_THRESHOLD ) ? 1UL : min( getNumThreads(), n ) );
+
+   if( parts == 1UL ) {
+      kernel( 0UL, n, result );
+      return result;
+   }
+
+   std::vector< std::array<T,K> > partial( parts );
+
+   smpFor( parts, [&]( size_t part ) {
+      partial[part].fill( T() );
+      kernel( n*part/parts, n*(part+1UL)/parts, partial[part] );
+   } );
+
+   for( size_t part=0UL; part<parts; ++part ) {
+      for( size_t k=0UL; k<K; ++k ) {
+         result[k] += partial[part][k];
+      }
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FUSED VECTOR KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the inner product \f$ x^H y \f$ of two dense vectors.
+// \ingroup solvers
+//
+// \param x The left-hand side dense vector.
+// \param y The right-hand side dense vector.
+// \return The inner product (conjugating the left-hand side vector).
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+auto krylovDot( const DenseVector<VT1,false>& x, const DenseVector<VT2,false>& y )
+{
+   using ET = ElementType_t<VT1>;
+
+   BLAZE_INTERNAL_ASSERT( (*x).size() == (*y).size(), "Invalid vector sizes" );
+
+   return krylovReduce<1UL,ET>( (*x).size(), [&]( size_t begin, size_t end, auto& acc ) {
+      for( size_t i=begin; i<end; ++i ) {
+         acc[0] += conj( (*x)[i] ) * (*y)[i];
+      }
+   } )[0];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the Euclidean norm of a dense vector.
+// \ingroup solvers
+//
+// \param x The dense vector.
+// \return The Euclidean norm of the vector.
+*/
+template< typename VT >  // Type of the dense vector
+auto krylovNorm( const DenseVector<VT,false>& x )
+{
+   using BT = UnderlyingBuiltin_t< ElementType_t<VT> >;
+
+   return std::sqrt( krylovReduce<1UL,BT>( (*x).size(), [&]( size_t begin, size_t end, auto& acc ) {
+      for( size_t i=begin; i<end; ++i ) {
+         acc[0] += real( conj( (*x)[i] ) * (*x)[i] );
+      }
+   } )[0] );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the inner products \f$ x^H y \f$ and \f$ x^H x \f$ in a single pass.
+// \ingroup solvers
+//
+// \param x The left-hand side dense vector.
+// \param y The right-hand side dense vector.
+// \return The two inner products.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+auto krylovDot2( const DenseVector<VT1,false>& x, const DenseVector<VT2,false>& y )
+{
+   using ET = ElementType_t<VT1>;
+
+   BLAZE_INTERNAL_ASSERT( (*x).size() == (*y).size(), "Invalid vector sizes" );
+
+   return krylovReduce<2UL,ET>( (*x).size(), [&]( size_t begin, size_t end, auto& acc ) {
+      for( size_t i=begin; i<end; ++i ) {
+         const ET xi( conj( (*x)[i] ) );
+         acc[0] += xi * (*y)[i];
+         acc[1] += xi * (*x)[i];
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused CG update \f$ x += \alpha p, r -= \alpha q \f$ with computation of \f$ \|r\|^2 \f$.
+// \ingroup solvers
+//
+// \param x The solution vector.
+// \param alpha The step length.
+// \param p The search direction.
+// \param r The residual vector.
+// \param q The product of the system matrix and the search direction.
+// \return The squared Euclidean norm of the updated residual.
+*/
+template< typename VT1   // Type of the solution vector
+        , typename ST    // Type of the step length
+        , typename VT2   // Type of the search direction
+        , typename VT3   // Type of the residual vector
+        , typename VT4 >  // Type of the matrix/direction product
+auto krylovUpdate( DenseVector<VT1,false>& x, ST alpha, const DenseVector<VT2,false>& p,
+                   DenseVector<VT3,false>& r, const DenseVector<VT4,false>& q )
+{
+   using BT = UnderlyingBuiltin_t< ElementType_t<VT3> >;
+
+   return krylovReduce<1UL,BT>( (*x).size(), [&]( size_t begin, size_t end, auto& acc ) {
+      for( size_t i=begin; i<end; ++i ) {
+         (*x)[i] += alpha * (*p)[i];
+         (*r)[i] -= alpha * (*q)[i];
+         acc[0] += real( conj( (*r)[i] ) * (*r)[i] );
+      }
+   } )[0];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused update \f$ y = x - \alpha v \f$ with computation of \f$ \|y\|^2 \f$.
+// \ingroup solvers
+//
+// \param y The target vector (may be identical to \a x).
+// \param x The source vector.
+// \param alpha The scaling factor.
+// \param v The update vector.
+// \return The squared Euclidean norm of the updated vector.
+*/
+template< typename VT1   // Type of the target vector
+        , typename VT2   // Type of the source vector
+        , typename ST    // Type of the scaling factor
+        , typename VT3 >  // Type of the update vector
+auto krylovSubNorm( DenseVector<VT1,false>& y, const DenseVector<VT2,false>& x,
+                    ST alpha, const DenseVector<VT3,false>& v )
+{
+   using BT = UnderlyingBuiltin_t< ElementType_t<VT1> >;
+
+   return krylovReduce<1UL,BT>( (*y).size(), [&]( size_t begin, size_t end, auto& acc ) {
+      for( size_t i=begin; i<end; ++i ) {
+         (*y)[i] = (*x)[i] - alpha * (*v)[i];
+         acc[0] += real( conj( (*y)[i] ) * (*y)[i] );
+      }
+   } )[0];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused update \f$ y -= \alpha v \f$ with computation of the inner product \f$ u^H y \f$.
+// \ingroup solvers
+//
+// \param y The target vector.
+// \param alpha The scaling factor.
+// \param v The update vector.
+// \param u The vector for the inner product.
+// \return The inner product of \a u and the updated vector \a y.
+*/
+template< typename VT1   // Type of the target vector
+        , typename ST    // Type of the scaling factor
+        , typename VT2   // Type of the update vector
+        , typename VT3 >  // Type of the vector for the inner product
+auto krylovSubDot( DenseVector<VT1,false>& y, ST alpha, const DenseVector<VT2,false>& v,
+                   const DenseVector<VT3,false>& u )
+{
+   using ET = ElementType_t<VT1>;
+
+   return krylovReduce<1UL,ET>( (*y).size(), [&]( size_t begin, size_t end, auto& acc ) {
+      for( size_t i=begin; i<end; ++i ) {
+         (*y)[i] -= alpha * (*v)[i];
+         acc[0] += conj( (*u)[i] ) * (*y)[i];
+      }
+   } )[0];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Orthogonalization of a vector against an orthonormal basis (CGS2).
+// \ingroup solvers
+//
+// \param V The \a n-by-\a k matrix with orthonormal columns.
+// \param w The vector to be orthogonalized.
+// \param h The resulting \a k projection coefficients \f$ V^H w \f$.
+// \return The Euclidean norm of the orthogonalized vector.
+//
+// This function orthogonalizes \a w against the columns of \a V by means of the classical
+// Gram-Schmidt process with one step of reorthogonalization. In contrast to the modified
+// Gram-Schmidt process, all projections are computed by dense matrix/vector multiplications
+// with the complete basis, which are executed by the (parallel) dense kernels.
+*/
+template< typename MT     // Type of the basis
+        , typename VT1    // Type of the vector to be orthogonalized
+        , typename VT2 >  // Type of the projection coefficients
+auto krylovOrthogonalize( const DenseMatrix<MT,columnMajor>& V, DenseVector<VT1,false>& w,
+                          DenseVector<VT2,false>& h )
+{
+   using ET = ElementType_t<VT1>;
+
+   BLAZE_INTERNAL_ASSERT( (*V).rows() == (*w).size(), "Invalid vector size detected" );
+   BLAZE_INTERNAL_ASSERT( (*V).columns() == (*h).size(), "Invalid number of coefficients" );
+
+   (*h) = ctrans( *V ) * (*w);
+   (*w) -= (*V) * (*h);
+
+   const DynamicVector<ET> c( ctrans( *V ) * (*w) );
+   (*w) -= (*V) * c;
+   (*h) += c;
+
+   return krylovNorm( *w );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the arguments of an iterative solver.
+// \ingroup solvers
+//
+// \param A The system matrix.
+// \param x The solution vector.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::invalid_argument Invalid solution vector provided.
+*/
+template< typename MT    // Type of the system matrix
+        , bool SO        // Storage order of the system matrix
+        , typename VT1   // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+void checkKrylovArguments( const Matrix<MT,SO>& A, const DenseVector<VT1,false>& x,
+                           const DenseVector<VT2,false>& b )
+{
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (*b).size() != (*A).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   if( (*x).size() != (*A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid solution vector provided" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
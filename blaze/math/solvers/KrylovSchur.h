@@ -0,0 +1,581 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/KrylovSchur.h
+//  \brief Header file for the Krylov-Schur restart of the iterative eigensolvers
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_KRYLOVSCHUR_H_
+#define _BLAZE_MATH_SOLVERS_KRYLOVSCHUR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/QR.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/lapack/geev.h>
+#include <blaze/math/lapack/heevd.h>
+#include <blaze/math/lapack/syevd.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/shims/Imaginary.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/solvers/EigenTarget.h>
+#include <blaze/math/solvers/Kernels.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Row.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the Ritz value \a a precedes the Ritz value \a b for the given target.
+// \ingroup solvers
+//
+// \param target The selected part of the spectrum.
+// \param a The first Ritz value.
+// \param b The second Ritz value.
+// \return \a true if \a a is preferred to \a b, \a false if not.
+*/
+template< typename T >  // Type of the Ritz values
+bool ritzPrecedes( EigenTarget target, const T& a, const T& b )
+{
+   switch( target ) {
+      case largestMagnitude : return abs( a ) > abs( b );
+      case smallestMagnitude: return abs( a ) < abs( b );
+      case largestReal      : return real( a ) > real( b );
+      default               : return real( a ) < real( b );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the Ritz pairs of a real symmetric projected matrix.
+// \ingroup solvers
+//
+// \param H The projected matrix (only the upper part is referenced).
+// \param theta The resulting Ritz values.
+// \param Y The resulting orthonormal Ritz vectors of \a H.
+// \return void
+*/
+template< typename ET >  // Element type of the projected matrix
+EnableIf_t< !IsComplex_v<ET> >
+   ritzPairs( TrueType, const DynamicMatrix<ET,columnMajor>& H, DynamicVector<ET>& theta,
+              DynamicMatrix<ET,columnMajor>& Y )
+{
+   Y = H;
+   syevd( Y, theta, 'V', 'U' );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the Ritz pairs of a complex Hermitian projected matrix.
+// \ingroup solvers
+//
+// \param H The projected matrix (only the upper part is referenced).
+// \param theta The resulting Ritz values.
+// \param Y The resulting orthonormal Ritz vectors of \a H.
+// \return void
+*/
+template< typename ET >  // Element type of the projected matrix
+EnableIf_t< IsComplex_v<ET> >
+   ritzPairs( TrueType, const DynamicMatrix<ET,columnMajor>& H,
+              DynamicVector< UnderlyingBuiltin_t<ET> >& theta, DynamicMatrix<ET,columnMajor>& Y )
+{
+   Y = H;
+   heevd( Y, theta, 'V', 'U' );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the Ritz pairs of a general projected matrix.
+// \ingroup solvers
+//
+// \param H The projected matrix.
+// \param theta The resulting (complex) Ritz values.
+// \param Y The resulting (complex) normalized Ritz vectors of \a H.
+// \return void
+*/
+template< typename ET    // Element type of the projected matrix
+        , typename CT >  // Complex element type
+void ritzPairs( FalseType, const DynamicMatrix<ET,columnMajor>& H, DynamicVector<CT>& theta,
+                DynamicMatrix<CT,columnMajor>& Y )
+{
+   DynamicMatrix<ET,columnMajor> A( H );
+   geev( A, theta, Y );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of an orthonormal basis of the selected invariant subspace of \a H.
+// \ingroup solvers
+//
+// \param Y The Ritz vectors of the projected matrix.
+// \param theta The Ritz values of the projected matrix.
+// \param index The indices of the Ritz pairs in the order of preference.
+// \param k The number of selected Ritz pairs.
+// \param Q The resulting orthonormal basis.
+// \return void
+//
+// This function computes an orthonormal basis of the space spanned by the first \a k Ritz
+// vectors of a real general projected matrix. Complex conjugate pairs of Ritz vectors are
+// represented by their real and imaginary parts, i.e. the resulting basis is real and has
+// \a k or \a k+1 columns.
+*/
+template< typename CT    // Complex element type
+        , typename ET >  // Element type of the basis
+EnableIf_t< !IsComplex_v<ET> >
+   ritzBasis( FalseType, const DynamicMatrix<CT,columnMajor>& Y, const DynamicVector<CT>& theta,
+              const std::vector<size_t>& index, size_t k, DynamicMatrix<ET,columnMajor>& Q )
+{
+   const size_t m( Y.rows() );
+
+   DynamicMatrix<ET,columnMajor> Z( m, k+1UL ), R;
+   std::vector<bool> used( m, false );
+   size_t cols( 0UL );
+
+   for( size_t i=0UL; cols<k; ++i )
+   {
+      const size_t j( index[i] );
+
+      if( used[j] ) continue;
+      used[j] = true;
+
+      column( Z, cols++ ) = real( column( Y, j ) );
+
+      if( !isDefault<strict>( imag( theta[j] ) ) ) {
+         used[ imag( theta[j] ) > ET(0) ? j+1UL : j-1UL ] = true;
+         column( Z, cols++ ) = imag( column( Y, j ) );
+      }
+   }
+
+   qr( submatrix( Z, 0UL, 0UL, m, cols ), Q, R );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of an orthonormal basis of the selected invariant subspace of \a H.
+// \ingroup solvers
+//
+// \param Y The Ritz vectors of the projected matrix.
+// \param theta The Ritz values of the projected matrix.
+// \param index The indices of the Ritz pairs in the order of preference.
+// \param k The number of selected Ritz pairs.
+// \param Q The resulting orthonormal basis.
+// \return void
+//
+// This function computes an orthonormal basis of the space spanned by the first \a k Ritz
+// vectors of a complex general projected matrix.
+*/
+template< typename CT    // Complex element type
+        , typename ET >  // Element type of the basis
+EnableIf_t< IsComplex_v<ET> >
+   ritzBasis( FalseType, const DynamicMatrix<CT,columnMajor>& Y, const DynamicVector<CT>& theta,
+              const std::vector<size_t>& index, size_t k, DynamicMatrix<ET,columnMajor>& Q )
+{
+   MAYBE_UNUSED( theta );
+
+   const size_t m( Y.rows() );
+
+   DynamicMatrix<ET,columnMajor> Z( m, k ), R;
+
+   for( size_t i=0UL; i<k; ++i ) {
+      column( Z, i ) = column( Y, index[i] );
+   }
+
+   qr( Z, Q, R );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of an orthonormal basis of the selected invariant subspace of \a H.
+// \ingroup solvers
+//
+// \param Y The orthonormal Ritz vectors of the Hermitian projected matrix.
+// \param theta The Ritz values of the projected matrix.
+// \param index The indices of the Ritz pairs in the order of preference.
+// \param k The number of selected Ritz pairs.
+// \param Q The resulting orthonormal basis.
+// \return void
+//
+// This function selects the first \a k Ritz vectors of a Hermitian projected matrix, which
+// are already orthonormal.
+*/
+template< typename ET    // Element type of the basis
+        , typename RT >  // Type of the Ritz values
+void ritzBasis( TrueType, const DynamicMatrix<ET,columnMajor>& Y, const DynamicVector<RT>& theta,
+                const std::vector<size_t>& index, size_t k, DynamicMatrix<ET,columnMajor>& Q )
+{
+   MAYBE_UNUSED( theta );
+
+   Q.resize( Y.rows(), k, false );
+
+   for( size_t i=0UL; i<k; ++i ) {
+      column( Q, i ) = column( Y, index[i] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Restriction of a Hermitian projected matrix to the selected invariant subspace.
+// \ingroup solvers
+//
+// \param H The projected matrix.
+// \param Q The orthonormal basis of the selected invariant subspace.
+// \param theta The Ritz values of the projected matrix.
+// \param index The indices of the Ritz pairs in the order of preference.
+// \param S The resulting restricted matrix \f$ Q^H H Q \f$.
+// \return void
+//
+// Since the basis consists of Ritz vectors, the restricted matrix is the diagonal matrix of
+// the selected Ritz values.
+*/
+template< typename ET    // Element type of the projected matrix
+        , typename RT >  // Type of the Ritz values
+void ritzRestrict( TrueType, const DynamicMatrix<ET,columnMajor>& H,
+                   const DynamicMatrix<ET,columnMajor>& Q, const DynamicVector<RT>& theta,
+                   const std::vector<size_t>& index, DynamicMatrix<ET,columnMajor>& S )
+{
+   MAYBE_UNUSED( H );
+
+   const size_t k( Q.columns() );
+
+   S.resize( k, k, false );
+   reset( S );
+
+   for( size_t i=0UL; i<k; ++i ) {
+      S(i,i) = theta[index[i]];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Restriction of a general projected matrix to the selected invariant subspace.
+// \ingroup solvers
+//
+// \param H The projected matrix.
+// \param Q The orthonormal basis of the selected invariant subspace.
+// \param theta The Ritz values of the projected matrix.
+// \param index The indices of the Ritz pairs in the order of preference.
+// \param S The resulting restricted matrix \f$ Q^H H Q \f$.
+// \return void
+*/
+template< typename ET    // Element type of the projected matrix
+        , typename RT >  // Type of the Ritz values
+void ritzRestrict( FalseType, const DynamicMatrix<ET,columnMajor>& H,
+                   const DynamicMatrix<ET,columnMajor>& Q, const DynamicVector<RT>& theta,
+                   const std::vector<size_t>& index, DynamicMatrix<ET,columnMajor>& S )
+{
+   MAYBE_UNUSED( theta, index );
+
+   S = ctrans( Q ) * H * Q;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of a random unit vector orthogonal to the given orthonormal basis.
+// \ingroup solvers
+//
+// \param V The \a n-by-\a k matrix with orthonormal columns.
+// \param v The resulting unit vector.
+// \return \a true if a new direction has been found, \a false if the basis spans the full space.
+*/
+template< typename MT    // Type of the basis
+        , typename VT >  // Type of the resulting vector
+bool ritzDeflate( const DenseMatrix<MT,columnMajor>& V, DenseVector<VT,false>& v )
+{
+   using ET = ElementType_t<VT>;
+   using BT = UnderlyingBuiltin_t<ET>;
+
+   DynamicVector<ET> w( (*V).rows() ), h( (*V).columns() );
+
+   for( size_t trial=0UL; trial<3UL; ++trial )
+   {
+      randomize( w, BT(-1), BT(1) );
+
+      const BT norm( krylovNorm( w ) );
+      const BT beta( krylovOrthogonalize( *V, w, h ) );
+
+      if( beta > BT(0.5) * norm ) {
+         (*v) = w * ( BT(1) / beta );
+         return true;
+      }
+   }
+
+   reset( *v );
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KRYLOV-SCHUR ITERATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Restarted Krylov subspace iteration for a few eigenpairs of a linear operator.
+// \ingroup solvers
+//
+// \param op The linear operator, called as \c op(y,x) to compute \f$ y = Ax \f$.
+// \param v0 The start vector.
+// \param w The resulting eigenvalues.
+// \param X The resulting eigenvectors.
+// \param nev The number of requested eigenpairs.
+// \param target The selected part of the spectrum.
+// \param monitor The convergence monitor.
+// \param ncv The maximum dimension of the Krylov subspace (0 for the default).
+// \return \a true in case all requested eigenpairs have converged, \a false if not.
+// \exception std::invalid_argument Invalid number of eigenvalues requested.
+// \exception std::invalid_argument Invalid subspace dimension provided.
+// \exception std::invalid_argument Invalid start vector provided.
+//
+// This function implements the Krylov-Schur method (Stewart, 2001). The Krylov basis \a V is
+// extended by Arnoldi steps with full orthogonalization (see krylovOrthogonalize()) up to the
+// dimension \a m. Afterwards the Ritz pairs of the projected matrix \f$ H = V^H A V \f$ are
+// computed and the basis is truncated to the invariant subspace belonging to the \a k most
+// wanted Ritz values, which is equivalent to an implicit restart with exact shifts. In case
+// \a HF is \a true, the operator is assumed to be Hermitian and the method reduces to the
+// thick-restart Lanczos method (Wu and Simon, 2000) with real Ritz values. The residual norm
+// of every Ritz pair \f$ (\theta,Vy) \f$ is given by \f$ \beta |e_m^T y| \f$; the monitor is
+// fed with the largest residual of the \a nev wanted Ritz pairs relative to the largest Ritz
+// value in magnitude once per restart.
+*/
+template< bool HF        // Hermitian flag
+        , typename OP    // Type of the linear operator
+        , typename VT0   // Type of the start vector
+        , typename VT    // Type of the vector of eigenvalues
+        , bool TF        // Transpose flag of the vector of eigenvalues
+        , typename MT    // Type of the matrix of eigenvectors
+        , bool SO        // Storage order of the matrix of eigenvectors
+        , typename MON >  // Type of the convergence monitor
+bool krylovSchur( const OP& op, const DenseVector<VT0,false>& v0, DenseVector<VT,TF>& w,
+                  DenseMatrix<MT,SO>& X, size_t nev, EigenTarget target, MON& monitor,
+                  size_t ncv )
+{
+   using ET = ElementType_t<VT0>;
+   using BT = UnderlyingBuiltin_t<ET>;
+   using CT = complex<BT>;
+   using RT = If_t< HF, BT, CT >;  // Type of the Ritz values
+   using YT = If_t< HF, ET, CT >;  // Element type of the Ritz vectors
+
+   const size_t n( (*v0).size() );
+   const size_t minSize( HF ? nev+1UL : nev+2UL );
+
+   if( nev > n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of eigenvalues requested" );
+   }
+
+   if( ncv != 0UL && ncv < minSize && ncv < n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid subspace dimension provided" );
+   }
+
+   resize( *w, nev, false );
+   resize( *X, n, nev, false );
+
+   if( nev == 0UL ) {
+      return monitor.start( 0.0, 0.0 );
+   }
+
+   const BT v0norm( krylovNorm( *v0 ) );
+
+   if( isDefault<strict>( v0norm ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid start vector provided" );
+   }
+
+   const size_t m( min( n, ( ncv == 0UL )?( max( 2UL*nev+1UL, 20UL ) ):( ncv ) ) );
+
+   DynamicMatrix<ET,columnMajor> V( n, m+1UL ), H( m, m, ET(0) ), Q, S;
+   DynamicMatrix<YT,columnMajor> Y;
+   DynamicVector<RT> theta;
+   DynamicVector<ET> f( n );
+   std::vector<size_t> index( m );
+
+   column( V, 0UL ) = (*v0) * ( BT(1) / v0norm );
+
+   size_t k( 0UL );
+   BT beta( 0 );
+   bool started( false );
+
+   while( true )
+   {
+      // Extension of the Krylov basis by Arnoldi steps
+      for( size_t j=k; j<m; ++j )
+      {
+         op( f, column( V, j ) );
+
+         auto h( subvector( column( H, j ), 0UL, j+1UL ) );
+         beta = krylovOrthogonalize( submatrix( V, 0UL, 0UL, n, j+1UL ), f, h );
+
+         const BT hnorm( std::sqrt( real( sqrNorm( h ) ) + beta*beta ) );
+
+         if( beta > std::numeric_limits<BT>::epsilon() * hnorm ) {
+            column( V, j+1UL ) = f * ( BT(1) / beta );
+         }
+         else {
+            auto v( column( V, j+1UL ) );
+            beta = BT(0);
+            ritzDeflate( submatrix( V, 0UL, 0UL, n, j+1UL ), v );
+         }
+
+         if( j+1UL < m ) {
+            H(j+1UL,j) = beta;
+         }
+      }
+
+      // Computation and selection of the Ritz pairs
+      ritzPairs( BoolConstant<HF>(), H, theta, Y );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         index[i] = i;
+      }
+
+      std::stable_sort( index.begin(), index.end(), [&]( size_t a, size_t b ) {
+         return ritzPrecedes( target, theta[a], theta[b] );
+      } );
+
+      BT anorm( 0 ), residual( 0 );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         anorm = max( anorm, BT( abs( theta[i] ) ) );
+      }
+
+      for( size_t i=0UL; i<nev; ++i ) {
+         residual = max( residual, BT( beta * abs( Y(m-1UL,index[i]) ) ) );
+      }
+
+      const double relResidual( ( anorm > BT(0) )?( residual / anorm ):( residual ) );
+      const bool stop( started ? monitor.step( relResidual ) : monitor.start( 1.0, relResidual ) );
+
+      started = true;
+
+      if( stop || m == n ) break;
+
+      // Truncation of the Krylov basis to the wanted invariant subspace
+      const size_t keep( min( nev + ( m - nev ) / 2UL, m - ( HF ? 1UL : 2UL ) ) );
+
+      ritzBasis( BoolConstant<HF>(), Y, theta, index, keep, Q );
+      ritzRestrict( BoolConstant<HF>(), H, Q, theta, index, S );
+
+      k = Q.columns();
+
+      const DynamicVector<ET,rowVector> b( beta * row( Q, m-1UL ) );
+
+      submatrix( V, 0UL, 0UL, n, k ) = evaluate( submatrix( V, 0UL, 0UL, n, m ) * Q );
+      column( V, k ) = column( V, m );
+
+      reset( H );
+      submatrix( H, 0UL, 0UL, k, k ) = S;
+      subvector( row( H, k ), 0UL, k ) = b;
+   }
+
+   // Computation of the wanted Ritz pairs
+   DynamicMatrix<YT,columnMajor> Z( m, nev );
+
+   for( size_t i=0UL; i<nev; ++i ) {
+      (*w)[i] = theta[index[i]];
+      column( Z, i ) = column( Y, index[i] );
+   }
+
+   (*X) = submatrix( V, 0UL, 0UL, n, m ) * Z;
+
+   return monitor.converged();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,240 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/Lanczos.h
+//  \brief Header file for the thick-restart Lanczos eigensolver
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_LANCZOS_H_
+#define _BLAZE_MATH_SOLVERS_LANCZOS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/solvers/ConvergenceMonitor.h>
+#include <blaze/math/solvers/EigenTarget.h>
+#include <blaze/math/solvers/KrylovSchur.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LANCZOS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes a few eigenpairs of a symmetric (Hermitian) linear operator by the
+//        thick-restart Lanczos method.
+// \ingroup solvers
+//
+// \param op The symmetric (Hermitian) linear operator, called as \c op(y,x) for \f$ y = Ax \f$.
+// \param v0 The start vector.
+// \param w The resulting vector of the \a nev (real) eigenvalues.
+// \param X The resulting \a n-by-\a nev matrix of orthonormal eigenvectors.
+// \param nev The number of requested eigenpairs.
+// \param target The selected part of the spectrum.
+// \param monitor The convergence monitor.
+// \param ncv The maximum dimension of the Krylov subspace (default: max(2*nev+1,20)).
+// \return \a true in case all requested eigenpairs have converged, \a false if not.
+// \exception std::invalid_argument Invalid number of eigenvalues requested.
+// \exception std::invalid_argument Invalid subspace dimension provided.
+// \exception std::invalid_argument Invalid start vector provided.
+//
+// This function computes the \a nev eigenvalues of the selected part of the spectrum and the
+// corresponding eigenvectors of the symmetric (Hermitian) \a n-by-\a n linear operator \a op
+// by means of the thick-restart Lanczos method (Wu and Simon, 2000). The operator is only
+// accessed via matrix/vector products \c op(y,x), where \c y is a \c DynamicVector and \c x is
+// a dense column vector of size \a n. This allows to use arbitrary Blaze expressions as well
+// as spectral transformations, for instance a shift-and-invert operator based on a sparse
+// decomposition for the eigenvalues closest to a given shift. The Krylov basis is extended up
+// to the dimension \a ncv with full orthogonalization by dense matrix/vector products with the
+// complete basis (see krylovOrthogonalize()). Afterwards the basis is truncated to the most
+// wanted Ritz vectors and the iteration is restarted. The \a monitor counts the number of
+// restarts and is fed with the largest residual norm \f$ \|Ax-\theta x\| \f$ of the \a nev
+// wanted Ritz pairs relative to the largest Ritz value in magnitude. The eigenvalues are
+// stored in \a w in the order of preference given by \a target, the eigenvectors are stored in
+// the corresponding columns of \a X. Both are resized to the correct dimensions (if possible
+// and necessary). The Krylov basis requires \f$ n \cdot (ncv+1) \f$ elements of memory.
+
+   \code
+   blaze::CompressedMatrix<double> L;  // The symmetric graph Laplacian
+   // ... Resizing and initialization
+
+   blaze::DynamicVector<double> v0( L.rows(), 1.0 );
+   blaze::DynamicVector<double> w;
+   blaze::DynamicMatrix<double,blaze::columnMajor> X;
+
+   blaze::ConvergenceMonitor monitor( 500UL, 1E-10 );
+
+   // Computation of the 20 smallest eigenpairs of the shifted Laplacian
+   lanczos( [&]( auto& y, const auto& x ) { y = L * x - 0.1 * x; },
+            v0, w, X, 20UL, blaze::smallestReal, monitor );
+   \endcode
+
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename OP     // Type of the linear operator
+        , typename VT0    // Type of the start vector
+        , typename VT     // Type of the vector of eigenvalues
+        , bool TF         // Transpose flag of the vector of eigenvalues
+        , typename MT     // Type of the matrix of eigenvectors
+        , bool SO         // Storage order of the matrix of eigenvectors
+        , typename MON >  // Type of the convergence monitor
+bool lanczos( const OP& op, const DenseVector<VT0,false>& v0, DenseVector<VT,TF>& w,
+              DenseMatrix<MT,SO>& X, size_t nev, EigenTarget target, MON& monitor,
+              size_t ncv = 0UL )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<VT0> );
+
+   return krylovSchur<true>( op, *v0, *w, *X, nev, target, monitor, ncv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a few eigenpairs of a symmetric (Hermitian) matrix by the thick-restart
+//        Lanczos method.
+// \ingroup solvers
+//
+// \param A The symmetric (Hermitian) dense or sparse matrix.
+// \param w The resulting vector of the \a nev (real) eigenvalues.
+// \param X The resulting \a n-by-\a nev matrix of orthonormal eigenvectors.
+// \param nev The number of requested eigenpairs.
+// \param target The selected part of the spectrum.
+// \param monitor The convergence monitor.
+// \param ncv The maximum dimension of the Krylov subspace (default: max(2*nev+1,20)).
+// \return \a true in case all requested eigenpairs have converged, \a false if not.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid number of eigenvalues requested.
+// \exception std::invalid_argument Invalid subspace dimension provided.
+//
+// This function computes the \a nev eigenvalues of the selected part of the spectrum and the
+// corresponding eigenvectors of the given symmetric (Hermitian) matrix or matrix expression
+// \a A by means of the thick-restart Lanczos method (see the operator-based lanczos() function
+// for details). The random start vector is drawn from the random number generator of the Blaze
+// library, i.e. the result is reproducible for a fixed seed (see setSeed()).
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Resizing and initialization
+
+   blaze::DynamicVector<double> w;
+   blaze::DynamicMatrix<double,blaze::columnMajor> X;
+
+   blaze::ConvergenceMonitor monitor( 500UL, 1E-10 );
+   lanczos( A, w, X, 10UL, blaze::largestReal, monitor );
+   \endcode
+
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT1    // Type of the matrix
+        , bool SO1        // Storage order of the matrix
+        , typename VT     // Type of the vector of eigenvalues
+        , bool TF         // Transpose flag of the vector of eigenvalues
+        , typename MT2    // Type of the matrix of eigenvectors
+        , bool SO2        // Storage order of the matrix of eigenvectors
+        , typename MON >  // Type of the convergence monitor
+bool lanczos( const Matrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& X,
+              size_t nev, EigenTarget target, MON& monitor, size_t ncv = 0UL )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = ElementType_t<MT1>;
+   using BT = UnderlyingBuiltin_t<ET>;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ET );
+
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   DynamicVector<ET> v0( (*A).rows() );
+
+   if( nev > 0UL && nev <= v0.size() ) {
+      randomize( v0, BT(-1), BT(1) );
+   }
+
+   return krylovSchur<true>( [&A]( auto& y, const auto& x ) { y = (*A) * x; },
+                             v0, *w, *X, nev, target, monitor, ncv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a few eigenpairs of a symmetric (Hermitian) matrix by the thick-restart
+//        Lanczos method.
+// \ingroup solvers
+//
+// \param A The symmetric (Hermitian) dense or sparse matrix.
+// \param w The resulting vector of the \a nev (real) eigenvalues.
+// \param X The resulting \a n-by-\a nev matrix of orthonormal eigenvectors.
+// \param nev The number of requested eigenpairs.
+// \param target The selected part of the spectrum (default: largestMagnitude).
+// \return \a true in case all requested eigenpairs have converged, \a false if not.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid number of eigenvalues requested.
+//
+// This function computes the \a nev eigenpairs with a default constructed ConvergenceMonitor.
+*/
+template< typename MT1   // Type of the matrix
+        , bool SO1       // Storage order of the matrix
+        , typename VT    // Type of the vector of eigenvalues
+        , bool TF        // Transpose flag of the vector of eigenvalues
+        , typename MT2   // Type of the matrix of eigenvectors
+        , bool SO2 >     // Storage order of the matrix of eigenvectors
+bool lanczos( const Matrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& X,
+              size_t nev, EigenTarget target = largestMagnitude )
+{
+   ConvergenceMonitor monitor;
+   return lanczos( *A, *w, *X, nev, target, monitor );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,246 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/MINRES.h
+//  \brief Header file for the preconditioned MINRES method
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_MINRES_H_
+#define _BLAZE_MATH_SOLVERS_MINRES_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <limits>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/solvers/ConvergenceMonitor.h>
+#include <blaze/math/solvers/IdentityPreconditioner.h>
+#include <blaze/math/solvers/Kernels.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  MINRES FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the \f$ M^{-1} \f$-norm \f$ \sqrt{r^H z} \f$ of a residual for MINRES.
+// \ingroup solvers
+//
+// \param r The residual vector.
+// \param z The preconditioned residual vector.
+// \return The \f$ M^{-1} \f$-norm of the residual.
+// \exception std::runtime_error Indefinite preconditioner detected.
+*/
+template< typename VT1    // Type of the residual vector
+        , typename VT2 >  // Type of the preconditioned residual vector
+auto minresNorm( const DenseVector<VT1,false>& r, const DenseVector<VT2,false>& z )
+{
+   const auto rz( real( krylovDot( *r, *z ) ) );
+
+   if( rz < decltype(rz)(0) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Indefinite preconditioner detected" );
+   }
+
+   return std::sqrt( rz );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves a symmetric (Hermitian) linear system by the preconditioned MINRES method.
+// \ingroup solvers
+//
+// \param A The symmetric (Hermitian) system matrix.
+// \param x The initial guess on entry, the approximate solution on exit.
+// \param b The right-hand side vector.
+// \param M The symmetric (Hermitian) positive definite preconditioner.
+// \param monitor The convergence monitor.
+// \return \a true in case the iteration has converged, \a false if not.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::invalid_argument Invalid solution vector provided.
+// \exception std::runtime_error Indefinite preconditioner detected.
+//
+// This function solves the linear system \f$ Ax = b \f$ for an arbitrary dense or sparse
+// symmetric (Hermitian) matrix \a A, which in contrast to cg() may be indefinite, by the
+// minimal residual method of Paige and Saunders. The preconditioner \a M has to be positive
+// definite. The residual norms reported to the \a monitor are measured in the norm induced
+// by the inverse preconditioner, i.e. \f$ \|r\|_{M^{-1}} = \sqrt{r^H M^{-1} r} \f$, and are
+// estimated by the recurrence of the method without any additional cost. Without
+// preconditioner this norm is the Euclidean norm of the residual.
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::ConvergenceMonitor monitor( 1000UL, 1E-10 );
+   minres( A, x, b, blaze::JacobiPreconditioner<double>( A ), monitor );
+   \endcode
+*/
+template< typename MT     // Type of the system matrix
+        , bool SO         // Storage order of the system matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2    // Type of the right-hand side vector
+        , typename PC     // Type of the preconditioner
+        , typename MON >  // Type of the convergence monitor
+bool minres( const Matrix<MT,SO>& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+             const PC& M, MON& monitor )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = ElementType_t<VT1>;
+   using BT = UnderlyingBuiltin_t<ET>;
+
+   checkKrylovArguments( *A, *x, *b );
+
+   const size_t n( (*x).size() );
+
+   DynamicVector<ET> r1( *b - (*A) * (*x) ), y( n );
+
+   M.apply( y, *b );
+   const BT bnorm( minresNorm( *b, y ) );
+
+   if( isDefault<strict>( bnorm ) ) {
+      reset( *x );
+      return monitor.start( 0.0, 0.0 );
+   }
+
+   M.apply( y, r1 );
+   const BT beta1( minresNorm( r1, y ) );
+
+   if( monitor.start( bnorm, beta1 ) ) {
+      return monitor.converged();
+   }
+
+   DynamicVector<ET> r2( r1 ), v( n ), w( n, ET() ), w1( n ), w2( n, ET() );
+
+   BT beta( beta1 ), oldb( 0 ), dbar( 0 ), epsln( 0 ), phibar( beta1 ), cs( -1 ), sn( 0 );
+   bool first( true );
+
+   while( true )
+   {
+      v = y * ( BT(1) / beta );
+      y = (*A) * v;
+
+      if( !first ) {
+         y -= ( beta / oldb ) * r1;
+      }
+      first = false;
+
+      const BT alpha( real( krylovDot( v, y ) ) );
+      y -= ( alpha / beta ) * r2;
+      swap( r1, r2 );
+      r2 = y;
+      M.apply( y, r2 );
+
+      oldb = beta;
+      beta = minresNorm( r2, y );
+
+      // Application of the previous and computation of the new rotation
+      const BT oldeps( epsln );
+      const BT delta( cs*dbar + sn*alpha );
+      const BT gbar ( sn*dbar - cs*alpha );
+      epsln = sn*beta;
+      dbar  = -cs*beta;
+
+      BT gamma( std::sqrt( gbar*gbar + beta*beta ) );
+      if( gamma < std::numeric_limits<BT>::epsilon() ) {
+         gamma = std::numeric_limits<BT>::epsilon();
+      }
+
+      cs = gbar / gamma;
+      sn = beta / gamma;
+
+      const BT phi( cs * phibar );
+      phibar *= sn;
+
+      // Update of the search direction and the solution
+      swap( w1, w2 );
+      swap( w2, w );
+      w = ( v - oldeps*w1 - delta*w2 ) * ( BT(1) / gamma );
+      (*x) += phi * w;
+
+      if( monitor.step( phibar ) || isDefault<strict>( beta ) ) break;
+   }
+
+   return monitor.converged();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves a symmetric (Hermitian) linear system by the MINRES method.
+// \ingroup solvers
+//
+// \param A The symmetric (Hermitian) system matrix.
+// \param x The initial guess on entry, the approximate solution on exit.
+// \param b The right-hand side vector.
+// \return \a true in case the iteration has converged, \a false if not.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::invalid_argument Invalid solution vector provided.
+//
+// This function solves \f$ Ax = b \f$ without preconditioner and with a default constructed
+// ConvergenceMonitor.
+*/
+template< typename MT    // Type of the system matrix
+        , bool SO        // Storage order of the system matrix
+        , typename VT1   // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+bool minres( const Matrix<MT,SO>& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b )
+{
+   ConvergenceMonitor monitor;
+   return minres( *A, *x, *b, IdentityPreconditioner(), monitor );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
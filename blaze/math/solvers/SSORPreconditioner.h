@@ -0,0 +1,237 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/SSORPreconditioner.h
+//  \brief Header file for the SSORPreconditioner class
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_SSORPRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_SSORPRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Band.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Symmetric successive over-relaxation (SSOR) preconditioner for the iterative solvers.
+// \ingroup solvers
+//
+// The SSORPreconditioner class represents the preconditioner
+
+         \f[ M = \frac{1}{\omega(2-\omega)} (D + \omega L) D^{-1} (D + \omega U), \f]
+
+// where \f$ D \f$, \f$ L \f$, and \f$ U \f$ are the diagonal, the strictly lower and the strictly
+// upper part of the system matrix and \f$ \omega \in (0,2) \f$ is the relaxation parameter. For
+// a symmetric (Hermitian) positive definite system matrix the preconditioner is symmetric
+// (Hermitian) positive definite and can therefore be used with cg() and minres(). The
+// application consists of a forward and a backward triangular sweep, which are inherently
+// sequential.
+*/
+template< typename Type >  // Data type of the preconditioner
+class SSORPreconditioner
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;                       //!< Data type of the preconditioner.
+   using BuiltinType = UnderlyingBuiltin_t<Type>;  //!< Builtin type of the preconditioner.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   SSORPreconditioner() = default;
+
+   template< typename MT, bool SO >
+   explicit inline SSORPreconditioner( const Matrix<MT,SO>& A, BuiltinType omega = 1 );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, bool SO >
+   inline void compute( const Matrix<MT,SO>& A, BuiltinType omega = 1 );
+
+   template< typename VT1, typename VT2 >
+   inline void apply( DenseVector<VT1,false>& z, const DenseVector<VT2,false>& r ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   CompressedMatrix<Type,rowMajor> A_;  //!< The row-major copy of the system matrix.
+   DynamicVector<Type> diag_;           //!< The diagonal of the system matrix.
+   BuiltinType omega_{ 1 };             //!< The relaxation parameter.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SSORPreconditioner.
+//
+// \param A The square system matrix.
+// \param omega The relaxation parameter \f$ \omega \in (0,2) \f$.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid relaxation parameter provided.
+// \exception std::invalid_argument Invalid matrix with zero diagonal element provided.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+inline SSORPreconditioner<Type>::SSORPreconditioner( const Matrix<MT,SO>& A, BuiltinType omega )
+{
+   compute( *A, omega );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the preconditioner for the given system matrix.
+//
+// \param A The square system matrix.
+// \param omega The relaxation parameter \f$ \omega \in (0,2) \f$.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid relaxation parameter provided.
+// \exception std::invalid_argument Invalid matrix with zero diagonal element provided.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+inline void SSORPreconditioner<Type>::compute( const Matrix<MT,SO>& A, BuiltinType omega )
+{
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( !( omega > BuiltinType(0) && omega < BuiltinType(2) ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid relaxation parameter provided" );
+   }
+
+   A_     = *A;
+   diag_  = diagonal( A_ );
+   omega_ = omega;
+
+   for( size_t i=0UL; i<diag_.size(); ++i ) {
+      if( isDefault<strict>( diag_[i] ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid matrix with zero diagonal element provided" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Applies the preconditioner to the given vector (\f$ z = M^{-1} r \f$).
+//
+// \param z The resulting vector.
+// \param r The vector to be preconditioned.
+// \return void
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename VT1     // Type of the resulting vector
+        , typename VT2 >   // Type of the vector to be preconditioned
+inline void SSORPreconditioner<Type>::apply( DenseVector<VT1,false>& z,
+                                             const DenseVector<VT2,false>& r ) const
+{
+   const size_t n( diag_.size() );
+
+   BLAZE_INTERNAL_ASSERT( (*r).size() == n, "Invalid vector size" );
+
+   const BuiltinType scale( omega_ * ( BuiltinType(2) - omega_ ) );
+
+   *z = *r;
+
+   for( size_t i=0UL; i<n; ++i ) {
+      Type sum( scale * (*z)[i] );
+      for( auto element=A_.begin(i); element!=A_.end(i) && element->index()<i; ++element ) {
+         sum -= omega_ * element->value() * (*z)[element->index()];
+      }
+      (*z)[i] = sum / diag_[i];
+   }
+
+   for( size_t i=n; i-- > 0UL; ) {
+      Type sum( diag_[i] * (*z)[i] );
+      for( auto element=A_.end(i); element!=A_.begin(i); ) {
+         --element;
+         if( element->index() <= i ) break;
+         sum -= omega_ * element->value() * (*z)[element->index()];
+      }
+      (*z)[i] = sum / diag_[i];
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
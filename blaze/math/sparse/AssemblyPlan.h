@@ -0,0 +1,454 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/AssemblyPlan.h
+//  \brief Header file for the AssemblyPlan class
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_ASSEMBLYPLAN_H_
+#define _BLAZE_MATH_SPARSE_ASSEMBLYPLAN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/SparsePattern.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Symbolic plan for the repeated assembly of a compressed matrix from coordinates.
+// \ingroup compressed_matrix
+//
+// The AssemblyPlan class accelerates the repeated assembly of a compressed matrix from a fixed
+// list of (possibly duplicate) coordinates, as for instance in the assembly of finite element
+// stiffness matrices. Instead of inserting or accumulating every single value via the function
+// call operator (which requires a search and potentially a reallocation for every element),
+// the analyze() function computes the sparsity pattern of the given coordinates once and stores
+// the position of every coordinate within the target matrix. All subsequent calls of the
+// assemble() function accumulate the given values in-place (in the order of the coordinates)
+// without any allocation or search:
+
+   \code
+   using blaze::AssemblyPlan;
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+
+   std::vector<size_t> rows, columns;
+   // ... Setup of the coordinates of all element contributions
+
+   CompressedMatrix<double> K;
+   AssemblyPlan plan;
+   plan.analyze( K, N, N, rows, columns );  // Symbolic phase: Computation of the pattern of K
+
+   DynamicVector<double> values( rows.size() );
+
+   for( ... )
+   {
+      // ... Computation of all element contributions in the order of the coordinates
+
+      plan.assemble( K, values );  // Numeric phase: K(rows[k],columns[k]) += values[k]
+   }
+   \endcode
+
+// The numeric phase is executed in parallel (in case the shared memory parallelization is
+// enabled) based on a partitioning of the target matrix that balances the number of assembled
+// values per thread. Note that the plan is only valid as long as the sparsity pattern of the
+// target matrix is not modified. The assemble() function only verifies the size and the number
+// of non-zero elements of every row/column of the target matrix and throws a
+// \a std::invalid_argument exception in case of a mismatch. Changes of the sparsity pattern that
+// preserve these numbers are the responsibility of the caller. For debugging purposes, the
+// verification of all indices can be requested on construction (see AssemblyPlan(bool)).
+*/
+class AssemblyPlan
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline AssemblyPlan( bool verify = false );
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool   isAnalyzed () const noexcept;
+   inline bool   isVerifying() const noexcept;
+   inline size_t size       () const noexcept;
+   inline size_t chunks     () const noexcept;
+   inline void   reset      ();
+   //@}
+   //**********************************************************************************************
+
+   //**Plan functions******************************************************************************
+   /*!\name Plan functions */
+   //@{
+   template< typename Type, bool SO, typename Tag >
+   void analyze( CompressedMatrix<Type,SO,Tag>& lhs, size_t m, size_t n,
+                 const std::vector<size_t>& rows, const std::vector<size_t>& columns );
+
+   template< typename Type, bool SO, typename Tag, typename VT, bool TF >
+   void assemble( CompressedMatrix<Type,SO,Tag>& lhs, const DenseVector<VT,TF>& values ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t rows_;                  //!< The number of rows of the target matrix.
+   size_t columns_;               //!< The number of columns of the target matrix.
+   size_t nonzeros_;              //!< The number of non-zero elements of the target matrix.
+   std::vector<size_t> chunks_;   //!< Balanced partitioning of the target matrix.
+   std::vector<size_t> start_;    //!< Start of the coordinates of each row/column.
+   std::vector<size_t> order_;    //!< Coordinates sorted by rows/columns.
+   std::vector<size_t> offsets_;  //!< Positions of the sorted coordinates within their row/column.
+   SparsePattern pattern_;        //!< Sparsity pattern of the target matrix.
+   bool analyzed_;                //!< Flag for a completed symbolic phase.
+   bool verify_;                  //!< Flag for the verification of all indices.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for AssemblyPlan.
+//
+// \param verify \a true to verify the indices of all non-zero elements in the numeric phase.
+//
+// By default, the numeric phase only verifies the number of non-zero elements of every row or
+// column of the target matrix. In case \a verify is \a true, the plan also records the indices
+// of all non-zero elements of the target matrix in the symbolic phase and compares them in every
+// call of the assemble() function. This should only be used for debugging.
+*/
+inline AssemblyPlan::AssemblyPlan( bool verify )
+   : rows_    ( 0UL )     // The number of rows of the target matrix
+   , columns_ ( 0UL )     // The number of columns of the target matrix
+   , nonzeros_( 0UL )     // The number of non-zero elements of the target matrix
+   , chunks_  ()          // Balanced partitioning of the target matrix
+   , start_   ()          // Start of the coordinates of each row/column
+   , order_   ()          // Coordinates sorted by rows/columns
+   , offsets_ ()          // Positions of the sorted coordinates
+   , pattern_ ()          // Sparsity pattern of the target matrix
+   , analyzed_( false )   // Flag for a completed symbolic phase
+   , verify_  ( verify )  // Flag for the verification of all indices
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the symbolic phase of the plan has been completed.
+//
+// \return \a true in case the plan has been analyzed, \a false if not.
+*/
+inline bool AssemblyPlan::isAnalyzed() const noexcept
+{
+   return analyzed_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the plan verifies the indices of all non-zero elements.
+//
+// \return \a true in case all indices are verified, \a false if not.
+*/
+inline bool AssemblyPlan::isVerifying() const noexcept
+{
+   return verify_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of planned coordinates.
+//
+// \return The number of coordinates (including duplicates).
+*/
+inline size_t AssemblyPlan::size() const noexcept
+{
+   return order_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of independent chunks of the numeric phase.
+//
+// \return The number of chunks the target matrix is partitioned into.
+*/
+inline size_t AssemblyPlan::chunks() const noexcept
+{
+   return chunks_.empty() ? 0UL : chunks_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial state.
+//
+// \return void
+*/
+inline void AssemblyPlan::reset()
+{
+   rows_     = 0UL;
+   columns_  = 0UL;
+   nonzeros_ = 0UL;
+   chunks_.clear();
+   start_.clear();
+   order_.clear();
+   offsets_.clear();
+   pattern_.clear();
+   analyzed_ = false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PLAN FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Symbolic phase of the assembly.
+//
+// \param lhs The target compressed matrix.
+// \param m The number of rows of the target matrix.
+// \param n The number of columns of the target matrix.
+// \param rows The row indices of all coordinates.
+// \param columns The column indices of all coordinates.
+// \return void
+// \exception std::invalid_argument Invalid coordinates.
+//
+// This function resizes the target matrix to \f$ m \times n \f$ and restructures it such that
+// it contains exactly the given coordinates (duplicate coordinates are merged). All values of
+// the target matrix are reset to zero. In case the number of row and column indices doesn't
+// match or in case any index is out of bounds, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the target matrix
+        , bool SO        // Storage order
+        , typename Tag > // Type tag of the target matrix
+void AssemblyPlan::analyze( CompressedMatrix<Type,SO,Tag>& lhs, size_t m, size_t n,
+                            const std::vector<size_t>& rows, const std::vector<size_t>& columns )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( rows.size() != columns.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of coordinates" );
+   }
+
+   const std::vector<size_t>& majors( SO ? columns : rows );
+   const std::vector<size_t>& minors( SO ? rows : columns );
+   const size_t major( SO ? n : m );
+
+   for( size_t k=0UL; k<rows.size(); ++k ) {
+      if( rows[k] >= m || columns[k] >= n ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid coordinate index" );
+      }
+   }
+
+   reset();
+
+   // Counting sort of the coordinates by rows/columns
+   start_.assign( major+1UL, 0UL );
+   for( size_t k=0UL; k<majors.size(); ++k ) {
+      ++start_[majors[k]+1UL];
+   }
+   for( size_t i=0UL; i<major; ++i ) {
+      start_[i+1UL] += start_[i];
+   }
+
+   order_.resize( majors.size() );
+   {
+      std::vector<size_t> next( start_.begin(), start_.end()-1 );
+      for( size_t k=0UL; k<majors.size(); ++k ) {
+         order_[next[majors[k]]++] = k;
+      }
+   }
+
+   // Computation of the sparsity pattern
+   std::vector<size_t> indices;
+   std::vector<size_t> ptr( major+1UL, 0UL );
+
+   for( size_t i=0UL; i<major; ++i ) {
+      const size_t first( indices.size() );
+      for( size_t p=start_[i]; p<start_[i+1UL]; ++p ) {
+         indices.push_back( minors[order_[p]] );
+      }
+      std::sort( indices.begin()+first, indices.end() );
+      indices.erase( std::unique( indices.begin()+first, indices.end() ), indices.end() );
+      ptr[i+1UL] = indices.size();
+   }
+
+   CompressedMatrix<Type,SO,Tag> tmp( m, n, indices.size() );
+   for( size_t i=0UL; i<major; ++i ) {
+      for( size_t k=ptr[i]; k<ptr[i+1UL]; ++k ) {
+         tmp.append( SO ? indices[k] : i, SO ? i : indices[k], Type() );
+      }
+      tmp.finalize( i );
+   }
+   lhs.swap( tmp );
+   pattern_.record( lhs, verify_ );
+
+   // Computation of the positions of all coordinates within their row/column
+   offsets_.resize( order_.size() );
+
+   for( size_t i=0UL; i<major; ++i ) {
+      for( size_t p=start_[i]; p<start_[i+1UL]; ++p ) {
+         const auto pos( std::lower_bound( indices.begin()+ptr[i], indices.begin()+ptr[i+1UL],
+                                           minors[order_[p]] ) );
+         offsets_[p] = pos - ( indices.begin()+ptr[i] );
+      }
+   }
+
+   // Balanced partitioning of the target matrix
+   const size_t total( order_.size() + indices.size() );
+   const size_t threads( ( indices.size() < SMP_SMATASSIGN_THRESHOLD || major == 0UL )
+                         ? 1UL : min( getNumThreads(), major ) );
+
+   chunks_.push_back( 0UL );
+   for( size_t i=0UL; i<major; ++i ) {
+      const size_t sum( start_[i+1UL] + ptr[i+1UL] );
+      if( chunks_.size() < threads && sum * threads >= total * chunks_.size() ) {
+         chunks_.push_back( i+1UL );
+      }
+   }
+   chunks_.push_back( major );
+   chunks_.erase( std::unique( chunks_.begin(), chunks_.end() ), chunks_.end() );
+
+   rows_     = m;
+   columns_  = n;
+   nonzeros_ = indices.size();
+   analyzed_ = true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Numeric phase of the assembly.
+//
+// \param lhs The target compressed matrix.
+// \param values The values of all coordinates (in the order of the analyzed coordinates).
+// \return void
+// \exception std::invalid_argument Invalid assembly.
+//
+// This function resets all values of the target matrix to zero and accumulates the given values
+// at the positions of the analyzed coordinates. In case the plan has not been analyzed, in case
+// the size or the number of non-zero elements of any row/column of the target matrix has
+// changed, or in case the number of values doesn't match the number of coordinates, a
+// \a std::invalid_argument exception is thrown. In case the plan has been constructed with
+// enabled verification, the same holds for any change of the indices of the non-zero elements.
+*/
+template< typename Type  // Data type of the target matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag of the target matrix
+        , typename VT    // Type of the dense vector of values
+        , bool TF >      // Transpose flag of the dense vector of values
+void AssemblyPlan::assemble( CompressedMatrix<Type,SO,Tag>& lhs, const DenseVector<VT,TF>& values ) const
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !analyzed_ || lhs.rows() != rows_ || lhs.columns() != columns_ ||
+       lhs.nonZeros() != nonzeros_ || (*values).size() != order_.size() ||
+       !pattern_.matches( lhs ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assembly for assembly plan" );
+   }
+
+   if( nonzeros_ == 0UL )
+      return;
+
+   using Iterator = typename CompressedMatrix<Type,SO,Tag>::Iterator;
+
+   smpFor( chunks(), [&]( size_t c )
+   {
+      for( size_t i=chunks_[c]; i<chunks_[c+1UL]; ++i )
+      {
+         const Iterator first( lhs.begin(i) );
+
+         for( Iterator element=first; element!=lhs.end(i); ++element ) {
+            element->value() = Type();
+         }
+
+         for( size_t p=start_[i]; p<start_[i+1UL]; ++p ) {
+            first[offsets_[p]].value() += (*values)[order_[p]];
+         }
+      }
+   } );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -54,8 +54,11 @@
 #include <blaze/math/RelaxationFlag.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
 #include <blaze/math/sparse/Forward.h>
 #include <blaze/math/sparse/MatrixAccessProxy.h>
+#include <blaze/math/sparse/SDDMM.h>
 #include <blaze/math/sparse/ValueIndexPair.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/ColumnsTrait.h>
@@ -531,6 +534,8 @@ class CompressedMatrix
 
    inline Iterator     castDown( IteratorBase it ) const noexcept;
    inline IteratorBase castUp  ( Iterator     it ) const noexcept;
+
+   template< typename MT > void transposeAssign( const MT& rhs, size_t parts );
    //@}
    //**********************************************************************************************
 
@@ -1427,7 +1432,9 @@ inline CompressedMatrix<Type,SO,Tag>&
 // \exception std::invalid_argument Matrix sizes do not match.
 //
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
-// is thrown.
+// is thrown. In case the right-hand side dense matrix is a multiplication of two dense matrices,
+// the multiplication is only evaluated at the positions of the non-zero elements of the matrix
+// (sampled dense-dense matrix multiplication).
 */
 template< typename Type   // Data type of the matrix
         , bool SO         // Storage order
@@ -1449,6 +1456,9 @@ inline CompressedMatrix<Type,SO,Tag>&
       CompressedMatrix tmp( *this % (*rhs) );
       swap( tmp );
    }
+   else if( IsSDDMMCompatible_v<MT> ) {
+      sddmm( *this, *rhs );
+   }
    else {
       CompositeType_t<MT> tmp( *rhs );
       schurAssign( *this, tmp );
@@ -2932,6 +2942,19 @@ inline void CompressedMatrix<Type,SO,Tag>::assign( const SparseMatrix<MT,!SO>& r
    BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
    BLAZE_INTERNAL_ASSERT( capacity() >= (*rhs).nonZeros(), "Invalid capacity detected" );
 
+   if( m_ == 0UL || begin_[0] == nullptr )
+      return;
+
+   // Parallel transposition of large matrices
+   const size_t nonzeros( (*rhs).nonZeros() );
+   const size_t parts( ( nonzeros < SMP_SMATASSIGN_THRESHOLD )
+                       ? 1UL : min( getNumThreads(), n_, nonzeros / m_ ) );
+
+   if( parts > 1UL ) {
+      transposeAssign( *rhs, parts );
+      return;
+   }
+
    // Counting the number of elements per row
    std::vector<size_t> rowLengths( m_, 0UL );
    for( size_t j=0UL; j<n_; ++j ) {
@@ -2953,6 +2976,100 @@ inline void CompressedMatrix<Type,SO,Tag>::assign( const SparseMatrix<MT,!SO>& r
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel assignment of a column-major sparse matrix to a row-major compressed matrix.
+//
+// \param rhs The right-hand side column-major sparse matrix to be assigned.
+// \param parts The number of parts to be processed in parallel.
+// \return void
+//
+// This function implements a parallel counting sort of the non-zero elements of the given
+// column-major matrix. The columns of the matrix are split into \a parts ranges with approximately
+// equal numbers of non-zero elements. In a first pass, each part counts its elements per
+// row, which are then converted into write positions per row and part. In a second
+// pass, each part scatters its elements directly to their final positions. Since the parts
+// are processed in ascending order of their column indices, the elements of each row are
+// stored in ascending order without any additional sorting.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+template< typename MT >   // Type of the right-hand side sparse matrix
+void CompressedMatrix<Type,SO,Tag>::transposeAssign( const MT& rhs, size_t parts )
+{
+   BLAZE_INTERNAL_ASSERT( parts > 0UL, "Invalid number of parts" );
+
+   // Non-zero balanced partitioning of the columns of the right-hand side matrix
+   const size_t nonzeros( rhs.nonZeros() );
+
+   std::vector<size_t> bounds( 1UL, 0UL );
+   for( size_t j=0UL, sum=0UL; j<n_; ++j ) {
+      sum += rhs.nonZeros( j );
+      if( bounds.size() < parts && sum * parts >= nonzeros * bounds.size() ) {
+         bounds.push_back( j+1UL );
+      }
+   }
+   bounds.push_back( n_ );
+   parts = bounds.size() - 1UL;
+
+   // Counting the number of elements per row and part
+   std::vector<size_t> offsets( parts*m_, 0UL );
+
+   smpFor( parts, [&]( size_t part ) {
+      size_t* const counts( offsets.data() + part*m_ );
+      for( size_t j=bounds[part]; j<bounds[part+1UL]; ++j ) {
+         const auto end( rhs.end(j) );
+         for( auto element=rhs.begin(j); element!=end; ++element )
+            ++counts[element->index()];
+      }
+   } );
+
+   // Converting the counts into write positions per row and part
+   std::vector<size_t> rowLengths( m_ );
+   const size_t block( ( m_ + parts - 1UL ) / parts );
+
+   smpFor( parts, [&]( size_t part ) {
+      const size_t end( min( m_, ( part+1UL ) * block ) );
+      for( size_t i=part*block; i<end; ++i ) {
+         size_t pos( 0UL );
+         for( size_t k=0UL; k<parts; ++k ) {
+            size_t& count( offsets[k*m_+i] );
+            const size_t tmp( count );
+            count = pos;
+            pos += tmp;
+         }
+         rowLengths[i] = pos;
+      }
+   } );
+
+   // Resizing the compressed matrix
+   for( size_t i=0UL; i<m_; ++i ) {
+      begin_[i+1UL] = end_[i+1UL] = begin_[i] + rowLengths[i];
+   }
+
+   // Scattering the elements to the rows of the compressed matrix
+   smpFor( parts, [&]( size_t part ) {
+      size_t* const positions( offsets.data() + part*m_ );
+      for( size_t j=bounds[part]; j<bounds[part+1UL]; ++j ) {
+         const auto end( rhs.end(j) );
+         for( auto element=rhs.begin(j); element!=end; ++element ) {
+            const size_t i( element->index() );
+            const Iterator pos( begin_[i] + positions[i]++ );
+            pos->value_ = element->value();
+            pos->index_ = j;
+         }
+      }
+   } );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      end_[i] = begin_[i+1UL];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the addition assignment of a dense matrix.
 //
@@ -3408,6 +3525,8 @@ class CompressedMatrix<Type,true,Tag>
 
    inline Iterator     castDown( IteratorBase it ) const noexcept;
    inline IteratorBase castUp  ( Iterator     it ) const noexcept;
+
+   template< typename MT > void transposeAssign( const MT& rhs, size_t parts );
    //@}
    //**********************************************************************************************
 
@@ -4310,7 +4429,9 @@ inline CompressedMatrix<Type,true,Tag>&
 // \exception std::invalid_argument Matrix sizes do not match.
 //
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
-// is thrown.
+// is thrown. In case the right-hand side dense matrix is a multiplication of two dense matrices,
+// the multiplication is only evaluated at the positions of the non-zero elements of the matrix
+// (sampled dense-dense matrix multiplication).
 */
 template< typename Type   // Data type of the matrix
         , typename Tag >  // Type tag
@@ -4331,6 +4452,9 @@ inline CompressedMatrix<Type,true,Tag>&
       CompressedMatrix tmp( *this % (*rhs) );
       swap( tmp );
    }
+   else if( IsSDDMMCompatible_v<MT> ) {
+      sddmm( *this, *rhs );
+   }
    else {
       CompositeType_t<MT> tmp( *rhs );
       schurAssign( *this, tmp );
@@ -5821,6 +5945,19 @@ inline void CompressedMatrix<Type,true,Tag>::assign( const SparseMatrix<MT,false
    BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
    BLAZE_INTERNAL_ASSERT( capacity() >= (*rhs).nonZeros(), "Invalid capacity detected" );
 
+   if( n_ == 0UL || begin_[0] == nullptr )
+      return;
+
+   // Parallel transposition of large matrices
+   const size_t nonzeros( (*rhs).nonZeros() );
+   const size_t parts( ( nonzeros < SMP_SMATASSIGN_THRESHOLD )
+                       ? 1UL : min( getNumThreads(), m_, nonzeros / n_ ) );
+
+   if( parts > 1UL ) {
+      transposeAssign( *rhs, parts );
+      return;
+   }
+
    // Counting the number of elements per column
    std::vector<size_t> columnLengths( n_, 0UL );
    for( size_t i=0UL; i<m_; ++i ) {
@@ -5843,6 +5980,99 @@ inline void CompressedMatrix<Type,true,Tag>::assign( const SparseMatrix<MT,false
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel assignment of a row-major sparse matrix to a column-major compressed matrix.
+//
+// \param rhs The right-hand side row-major sparse matrix to be assigned.
+// \param parts The number of parts to be processed in parallel.
+// \return void
+//
+// This function implements a parallel counting sort of the non-zero elements of the given
+// row-major matrix. The rows of the matrix are split into \a parts ranges with approximately
+// equal numbers of non-zero elements. In a first pass, each part counts its elements per
+// column, which are then converted into write positions per column and part. In a second
+// pass, each part scatters its elements directly to their final positions. Since the parts
+// are processed in ascending order of their row indices, the elements of each column are
+// stored in ascending order without any additional sorting.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+template< typename MT >   // Type of the right-hand side sparse matrix
+void CompressedMatrix<Type,true,Tag>::transposeAssign( const MT& rhs, size_t parts )
+{
+   BLAZE_INTERNAL_ASSERT( parts > 0UL, "Invalid number of parts" );
+
+   // Non-zero balanced partitioning of the rows of the right-hand side matrix
+   const size_t nonzeros( rhs.nonZeros() );
+
+   std::vector<size_t> bounds( 1UL, 0UL );
+   for( size_t i=0UL, sum=0UL; i<m_; ++i ) {
+      sum += rhs.nonZeros( i );
+      if( bounds.size() < parts && sum * parts >= nonzeros * bounds.size() ) {
+         bounds.push_back( i+1UL );
+      }
+   }
+   bounds.push_back( m_ );
+   parts = bounds.size() - 1UL;
+
+   // Counting the number of elements per column and part
+   std::vector<size_t> offsets( parts*n_, 0UL );
+
+   smpFor( parts, [&]( size_t part ) {
+      size_t* const counts( offsets.data() + part*n_ );
+      for( size_t i=bounds[part]; i<bounds[part+1UL]; ++i ) {
+         const auto end( rhs.end(i) );
+         for( auto element=rhs.begin(i); element!=end; ++element )
+            ++counts[element->index()];
+      }
+   } );
+
+   // Converting the counts into write positions per column and part
+   std::vector<size_t> columnLengths( n_ );
+   const size_t block( ( n_ + parts - 1UL ) / parts );
+
+   smpFor( parts, [&]( size_t part ) {
+      const size_t end( min( n_, ( part+1UL ) * block ) );
+      for( size_t j=part*block; j<end; ++j ) {
+         size_t pos( 0UL );
+         for( size_t k=0UL; k<parts; ++k ) {
+            size_t& count( offsets[k*n_+j] );
+            const size_t tmp( count );
+            count = pos;
+            pos += tmp;
+         }
+         columnLengths[j] = pos;
+      }
+   } );
+
+   // Resizing the compressed matrix
+   for( size_t j=0UL; j<n_; ++j ) {
+      begin_[j+1UL] = end_[j+1UL] = begin_[j] + columnLengths[j];
+   }
+
+   // Scattering the elements to the columns of the compressed matrix
+   smpFor( parts, [&]( size_t part ) {
+      size_t* const positions( offsets.data() + part*n_ );
+      for( size_t i=bounds[part]; i<bounds[part+1UL]; ++i ) {
+         const auto end( rhs.end(i) );
+         for( auto element=rhs.begin(i); element!=end; ++element ) {
+            const size_t j( element->index() );
+            const Iterator pos( begin_[j] + positions[j]++ );
+            pos->value_ = element->value();
+            pos->index_ = i;
+         }
+      }
+   } );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      end_[j] = begin_[j+1UL];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the addition assignment of a dense matrix.
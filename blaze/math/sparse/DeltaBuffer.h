@@ -0,0 +1,627 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/DeltaBuffer.h
+//  \brief Header file for the DeltaBuffer class template
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_DELTABUFFER_H_
+#define _BLAZE_MATH_SPARSE_DELTABUFFER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <blaze/math/Exception.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Buffer for the incremental modification of a compressed matrix.
+// \ingroup compressed_matrix
+//
+// The DeltaBuffer class template accelerates long sequences of small modifications of a
+// compressed matrix, as for instance the insertion and removal of edges of a dynamic graph.
+// Setting or erasing a single element of a compressed matrix requires to shift all subsequent
+// elements of the matrix (or even a reallocation of the entire element array). Instead, the
+// DeltaBuffer records all modifications in a hash map of pending updates, which requires an
+// amortized constant effort per modification. As soon as the number of pending updates reaches
+// the configured threshold, all updates are merged into the compressed matrix in a single pass:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::DeltaBuffer;
+
+   CompressedMatrix<double> G( N, N );
+   // ... Initialization of the graph
+
+   DeltaBuffer<double> delta( G );  // Buffer for the modifications of G
+
+   delta.set( 2UL, 5UL, 1.5 );  // Buffered insertion of the edge (2,5)
+   delta.erase( 3UL, 1UL );     // Buffered removal of the edge (3,1)
+
+   const double w( delta( 2UL, 5UL ) );  // Access to the merged view of G and all updates
+
+   DynamicVector<double> x( N ), y;
+   y = delta.matrix() * x;  // Merging all pending updates into G before the multiplication
+   \endcode
+
+// Element accesses via the function call operator see the merged view of the matrix and all
+// pending updates. The matrix() function merges all pending updates and returns a reference to
+// the updated compressed matrix, which can be used in arbitrary expressions. The merge of all
+// pending updates is executed in parallel (in case the shared memory parallelization is enabled)
+// based on a partitioning of the matrix that balances the number of elements and updates per
+// thread. Note that the compressed matrix must not be modified directly (and in particular must
+// not be resized) as long as there are pending updates.
+*/
+template< typename Type                  // Data type of the matrix
+        , bool SO = defaultStorageOrder  // Storage order
+        , typename Tag = Group0 >        // Type tag
+class DeltaBuffer
+{
+ public:
+   //**Type definitions****************************************************************************
+   using MatrixType = CompressedMatrix<Type,SO,Tag>;  //!< Type of the buffered compressed matrix.
+   using ElementType = Type;                          //!< Type of the matrix elements.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline DeltaBuffer( MatrixType& matrix, size_t threshold = 0UL );
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Type              operator()( size_t i, size_t j ) const;
+   inline const MatrixType& matrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows        () const noexcept;
+   inline size_t columns     () const noexcept;
+   inline size_t pending     () const noexcept;
+   inline size_t threshold   () const noexcept;
+   inline void   setThreshold( size_t threshold ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Modification functions**********************************************************************
+   /*!\name Modification functions */
+   //@{
+   inline void set  ( size_t i, size_t j, const Type& value );
+   inline void erase( size_t i, size_t j );
+          void flush();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Representation of a single pending update.
+   struct Update {
+      Type value;  //!< The new value of the element.
+      bool erase;  //!< Flag for the removal of the element.
+   };
+
+   //! Pending update in combination with its position within the matrix.
+   using Entry = std::pair<size_t,Update>;
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t key  ( size_t i, size_t j ) const noexcept;
+   inline size_t limit() const noexcept;
+   inline void   apply();
+
+   template< typename Emit >
+   size_t merge( size_t i, const Entry* first, const Entry* last, Emit emit ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MatrixType& matrix_;                         //!< The buffered compressed matrix.
+   size_t threshold_;                           //!< The configured threshold for a merge.
+   size_t nonzeros_;                            //!< The number of non-zeros at the last merge.
+   std::unordered_map<size_t,Update> updates_;  //!< The pending updates.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor for DeltaBuffer.
+//
+// \param matrix The compressed matrix to be modified.
+// \param threshold The number of pending updates that triggers a merge (0 for automatic).
+// \exception std::invalid_argument Matrix is too large for a delta buffer.
+//
+// In case the given \a threshold is 0, the number of pending updates that triggers a merge is
+// adapted to the number of non-zero elements of the matrix (1/16 of the non-zero elements, but
+// at least 1024 updates). In case the total number of elements of the given matrix exceeds the
+// range of \a size_t, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline DeltaBuffer<Type,SO,Tag>::DeltaBuffer( MatrixType& matrix, size_t threshold )
+   : matrix_   ( matrix )             // The buffered compressed matrix
+   , threshold_( threshold )          // The configured threshold for a merge
+   , nonzeros_ ( matrix.nonZeros() )  // The number of non-zeros at the last merge
+   , updates_  ()                     // The pending updates
+{
+   if( matrix.rows() != 0UL &&
+       matrix.columns() > std::numeric_limits<size_t>::max() / matrix.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix is too large for a delta buffer" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the elements of the merged view of the matrix and all pending updates.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The current value of the accessed element.
+//
+// This function returns the value of the element \f$(i,j)\f$ including all pending updates.
+// The access requires a hash map lookup and, in case the element has not been updated, a binary
+// search within row \a i (column \a j) of the compressed matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline Type DeltaBuffer<Type,SO,Tag>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const auto pos( updates_.find( key( i, j ) ) );
+
+   if( pos == updates_.end() )
+      return static_cast<const MatrixType&>( matrix_ )( i, j );
+   else if( pos->second.erase )
+      return Type();
+   else
+      return pos->second.value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the compressed matrix including all pending updates.
+//
+// \return Reference to the updated compressed matrix.
+//
+// This function merges all pending updates into the compressed matrix and returns a reference
+// to the updated matrix, which can be used in arbitrary expressions.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline const CompressedMatrix<Type,SO,Tag>& DeltaBuffer<Type,SO,Tag>::matrix()
+{
+   flush();
+   return matrix_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the buffered matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline size_t DeltaBuffer<Type,SO,Tag>::rows() const noexcept
+{
+   return matrix_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the buffered matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline size_t DeltaBuffer<Type,SO,Tag>::columns() const noexcept
+{
+   return matrix_.columns();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of pending updates.
+//
+// \return The number of pending updates.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline size_t DeltaBuffer<Type,SO,Tag>::pending() const noexcept
+{
+   return updates_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the configured threshold for a merge of the pending updates.
+//
+// \return The configured threshold (0 in case of an automatic threshold).
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline size_t DeltaBuffer<Type,SO,Tag>::threshold() const noexcept
+{
+   return threshold_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the threshold for a merge of the pending updates.
+//
+// \param threshold The number of pending updates that triggers a merge (0 for automatic).
+// \return void
+//
+// The new threshold is considered by the next modification of the buffer.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void DeltaBuffer<Type,SO,Tag>::setThreshold( size_t threshold ) noexcept
+{
+   threshold_ = threshold;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the unique key of the element \f$(i,j)\f$.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return The key of the element.
+//
+// The keys are ordered by rows (columns) and within each row (column) by columns (rows).
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline size_t DeltaBuffer<Type,SO,Tag>::key( size_t i, size_t j ) const noexcept
+{
+   return ( SO ) ? ( j*matrix_.rows() + i ) : ( i*matrix_.columns() + j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of pending updates that triggers a merge.
+//
+// \return The effective threshold for a merge.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline size_t DeltaBuffer<Type,SO,Tag>::limit() const noexcept
+{
+   return ( threshold_ != 0UL ) ? threshold_ : max( nonzeros_ / 16UL, 1024UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Merges all pending updates in case the threshold has been reached.
+//
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void DeltaBuffer<Type,SO,Tag>::apply()
+{
+   if( updates_.size() >= limit() ) {
+      flush();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Merges the elements of a single row/column with its pending updates.
+//
+// \param i The index of the row/column.
+// \param first Pointer to the first pending update of the row/column.
+// \param last Pointer one past the last pending update of the row/column.
+// \param emit The function to be called for every resulting element.
+// \return The number of resulting elements.
+//
+// The resulting elements are passed to the given function in ascending order of their column
+// (row) indices.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+template< typename Emit >  // Type of the emit function
+size_t DeltaBuffer<Type,SO,Tag>::merge( size_t i, const Entry* first, const Entry* last,
+                                        Emit emit ) const
+{
+   const size_t minor( SO ? matrix_.rows() : matrix_.columns() );
+   const MatrixType& A( matrix_ );
+
+   auto element( A.begin(i) );
+   const auto end( A.end(i) );
+
+   size_t count( 0UL );
+
+   for( ; first!=last; ++first )
+   {
+      const size_t j( first->first % minor );
+
+      for( ; element!=end && element->index() < j; ++element, ++count ) {
+         emit( element->index(), element->value() );
+      }
+
+      if( element!=end && element->index() == j ) {
+         ++element;
+      }
+
+      if( !first->second.erase ) {
+         emit( j, first->second.value );
+         ++count;
+      }
+   }
+
+   for( ; element!=end; ++element, ++count ) {
+      emit( element->index(), element->value() );
+   }
+
+   return count;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MODIFICATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setting the value of an element of the matrix.
+//
+// \param i The row index of the element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be set.
+// \return void
+//
+// This function records the insertion or the modification of the element \f$(i,j)\f$. In case
+// the number of pending updates reaches the threshold, all pending updates are merged into the
+// compressed matrix. Note that, as for the set() function of the compressed matrix, the element
+// is stored even in case the given value is a default value.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void DeltaBuffer<Type,SO,Tag>::set( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   updates_[key( i, j )] = Update{ value, false };
+   apply();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element of the matrix.
+//
+// \param i The row index of the element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the element. The index has to be in the range \f$[0..N-1]\f$.
+// \return void
+//
+// This function records the removal of the element \f$(i,j)\f$. In case the number of pending
+// updates reaches the threshold, all pending updates are merged into the compressed matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void DeltaBuffer<Type,SO,Tag>::erase( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   updates_[key( i, j )] = Update{ Type(), true };
+   apply();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Merges all pending updates into the compressed matrix.
+//
+// \return void
+//
+// This function merges all pending updates into the compressed matrix. The pending updates are
+// sorted and the resulting matrix is assembled in two parallel passes: The first pass computes
+// the number of elements of each row (column), the second pass merges the elements of the matrix
+// with the pending updates. The effort of the merge is linear in the number of elements of the
+// matrix and therefore amortized over the number of updates given by the threshold.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+void DeltaBuffer<Type,SO,Tag>::flush()
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( updates_.empty() )
+      return;
+
+   const size_t m( matrix_.rows() );
+   const size_t n( matrix_.columns() );
+   const size_t major( SO ? n : m );
+   const size_t minor( SO ? m : n );
+
+   // Sorting the pending updates by rows (columns)
+   std::vector<Entry> log( updates_.begin(), updates_.end() );
+   std::sort( log.begin(), log.end(), []( const Entry& a, const Entry& b ) {
+      return a.first < b.first;
+   } );
+
+   std::vector<size_t> start( major+1UL, 0UL );
+   for( const Entry& entry : log ) {
+      ++start[entry.first/minor+1UL];
+   }
+   for( size_t i=0UL; i<major; ++i ) {
+      start[i+1UL] += start[i];
+   }
+
+   // Balanced partitioning of the matrix
+   const size_t total( nonzeros_ + log.size() );
+   const size_t threads( ( total < SMP_SMATASSIGN_THRESHOLD || major == 0UL )
+                         ? 1UL : min( getNumThreads(), major ) );
+
+   std::vector<size_t> chunks( 1UL, 0UL );
+   for( size_t i=0UL, sum=0UL; i<major; ++i ) {
+      sum += matrix_.nonZeros(i) + start[i+1UL] - start[i];
+      if( chunks.size() < threads && sum * threads >= total * chunks.size() ) {
+         chunks.push_back( i+1UL );
+      }
+   }
+   chunks.push_back( major );
+   chunks.erase( std::unique( chunks.begin(), chunks.end() ), chunks.end() );
+
+   // Computing the number of elements per row (column)
+   std::vector<size_t> lengths( major );
+
+   smpFor( chunks.size()-1UL, [&]( size_t c ) {
+      for( size_t i=chunks[c]; i<chunks[c+1UL]; ++i ) {
+         lengths[i] = merge( i, log.data()+start[i], log.data()+start[i+1UL],
+                             []( size_t, const Type& ) {} );
+      }
+   } );
+
+   // Merging the elements of the matrix with the pending updates
+   MatrixType tmp( m, n, lengths );
+
+   smpFor( chunks.size()-1UL, [&]( size_t c ) {
+      for( size_t i=chunks[c]; i<chunks[c+1UL]; ++i ) {
+         merge( i, log.data()+start[i], log.data()+start[i+1UL],
+                [&]( size_t j, const Type& value ) {
+                   tmp.append( SO ? j : i, SO ? i : j, value );
+                } );
+      }
+   } );
+
+   matrix_.swap( tmp );
+   updates_.clear();
+   nonzeros_ = matrix_.nonZeros();
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,863 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/PatternPlan.h
+//  \brief Header file for the PatternPlan class
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_PATTERNPLAN_H_
+#define _BLAZE_MATH_SPARSE_PATTERNPLAN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/SparsePattern.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsMatMatAddExpr.h>
+#include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsMatMatSubExpr.h>
+#include <blaze/math/typetraits/IsMatScalarDivExpr.h>
+#include <blaze/math/typetraits/IsMatScalarMultExpr.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/math/typetraits/StorageOrder.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveCV.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Symbolic plan for the pattern-reusing assignment to a compressed matrix.
+// \ingroup compressed_matrix
+//
+// In many applications (as for instance in Newton iterations or time stepping schemes) a sparse
+// matrix is repeatedly assembled from an expression whose sparsity pattern never changes, while
+// the values of the operands change in every iteration. A regular assignment of such an
+// expression to a CompressedMatrix repeats the complete symbolic work (i.e. the merging of the
+// sparsity patterns of the operands and the (re-)allocation of the target matrix) in every
+// single iteration. The PatternPlan class separates this symbolic work from the numeric work:
+// The analyze() function computes the sparsity pattern of the given expression once and stores
+// the position of every non-zero element of every operand within the target matrix (scatter
+// maps). All subsequent calls of the assign() function only update the values of the target
+// matrix in-place, without any allocation, any search or any merging of indices:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::PatternPlan;
+
+   CompressedMatrix<double> A, B, C, S;
+   // ... Resizing and initialization
+
+   PatternPlan plan;
+   plan.analyze( S, A + dt * ( B * C ) );  // Symbolic phase: Computation of the pattern of S
+
+   for( ... )
+   {
+      // ... Update of the values of A, B, and C without modifying their sparsity pattern
+
+      plan.assign( S, A + dt * ( B * C ) );  // Numeric phase: In-place update of the values of S
+   }
+   \endcode
+
+// The PatternPlan class supports all expressions that represent a linear combination of sparse
+// matrices and of products of two sparse matrices, i.e. all expressions composed of additions,
+// subtractions, scalings (multiplications or divisions by a scalar) and multiplications of
+// non-expression sparse matrices (as for instance CompressedMatrix). All sparse matrix operands
+// must have the same storage order as the target matrix. The values of the scalar factors may
+// change between two assignments. The numeric phase is executed in parallel (in case the shared
+// memory parallelization is enabled) based on a partitioning of the target matrix that balances
+// the number of non-zero elements per thread.
+//
+// Note that the sparsity pattern computed in the symbolic phase is purely structural, i.e. all
+// elements that may become non-zero are stored, even if their value is zero in a particular
+// iteration. Also note that the plan is only valid as long as neither the sparsity pattern of
+// the target matrix nor the sparsity pattern of any operand is modified. The assign() function
+// only verifies the size and the number of non-zero elements of every row/column of the target
+// matrix and of all operands and throws a \a std::invalid_argument exception in case of a
+// mismatch. Changes of the sparsity pattern that preserve these numbers are the responsibility
+// of the caller, since comparing all indices would be as expensive as the numeric phase itself.
+// For debugging purposes, this complete verification can be requested on construction:
+
+   \code
+   PatternPlan plan( true );  // Additionally verifies the indices of all non-zero elements
+   \endcode
+*/
+class PatternPlan
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline PatternPlan( bool verify = false );
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool   isAnalyzed () const noexcept;
+   inline bool   isVerifying() const noexcept;
+   inline size_t terms      () const noexcept;
+   inline size_t chunks     () const noexcept;
+   inline void   reset      ();
+   //@}
+   //**********************************************************************************************
+
+   //**Plan functions******************************************************************************
+   /*!\name Plan functions */
+   //@{
+   template< typename Type, bool SO, typename Tag, typename MT >
+   void analyze( CompressedMatrix<Type,SO,Tag>& lhs, const SparseMatrix<MT,SO>& rhs );
+
+   template< typename Type, bool SO, typename Tag, typename MT >
+   void assign( CompressedMatrix<Type,SO,Tag>& lhs, const SparseMatrix<MT,SO>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Private class Term**************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Symbolic information about a single term of the planned expression.
+   */
+   struct Term
+   {
+      bool product;                 //!< Flag for a product of two sparse matrices.
+      SparsePattern lhs;            //!< Sparsity pattern of the (left-hand side) operand.
+      SparsePattern rhs;            //!< Sparsity pattern of the right-hand side product operand.
+      std::vector<size_t> start;    //!< Start of each row/column within the scatter map.
+      std::vector<size_t> offsets;  //!< Scatter map into the rows/columns of the target matrix.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Private class Setup*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Term visitor for the initialization of the terms of the plan.
+   */
+   struct Setup
+   {
+      template< typename MT, typename ST >
+      void plain( const MT& mat, const ST& ) {
+         Term& term( terms[t++] );
+         term.product = false;
+         term.lhs.record( mat, verify );
+         term.start.assign( major+1UL, 0UL );
+         term.offsets.reserve( mat.nonZeros() );
+      }
+
+      template< typename MT1, typename MT2, typename ST >
+      void product( const MT1& lhs, const MT2& rhs, const ST& ) {
+         Term& term( terms[t++] );
+         term.product = true;
+         term.lhs.record( lhs, verify );
+         term.rhs.record( rhs, verify );
+      }
+
+      size_t t;                  //!< The index of the current term.
+      size_t major;              //!< The number of rows/columns of the target matrix.
+      bool verify;               //!< Flag for the recording of the indices of the operands.
+      std::vector<Term>& terms;  //!< The terms of the plan.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Private class Collector*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Term visitor for the computation of the sparsity pattern of a single row/column.
+   */
+   template< bool SO >  // Storage order of the target matrix
+   struct Collector
+   {
+      template< typename MT, typename ST >
+      void plain( const MT& mat, const ST& ) {
+         for( auto element=mat.begin(i); element!=mat.end(i); ++element ) {
+            add( element->index() );
+         }
+      }
+
+      template< typename MT1, typename MT2, typename ST >
+      void product( const MT1& lhs, const MT2& rhs, const ST& ) {
+         const auto& outer( SO ? rhs : lhs );
+         const auto& inner( SO ? lhs : rhs );
+         for( auto o=outer.begin(i); o!=outer.end(i); ++o ) {
+            work += inner.nonZeros( o->index() );
+            for( auto element=inner.begin( o->index() ); element!=inner.end( o->index() ); ++element ) {
+               add( element->index() );
+            }
+         }
+      }
+
+      void add( size_t j ) {
+         if( marker[j] != i ) {
+            marker[j] = i;
+            indices.push_back( j );
+         }
+      }
+
+      size_t i;                     //!< The current row/column of the target matrix.
+      size_t work;                  //!< The number of multiplications of the current row/column.
+      std::vector<size_t>& marker;  //!< Marker for the indices of the current row/column.
+      std::vector<size_t>& indices; //!< The indices of the current row/column.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Private class Mapper************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Term visitor for the computation of the scatter maps of a single row/column.
+   */
+   template< typename IT >  // Type of the iterator over the target row/column
+   struct Mapper
+   {
+      template< typename MT, typename ST >
+      void plain( const MT& mat, const ST& ) {
+         Term& term( terms[t++] );
+         IT pos( first );
+         for( auto element=mat.begin(i); element!=mat.end(i); ++element ) {
+            while( pos->index() < element->index() ) ++pos;
+            term.offsets.push_back( pos - first );
+         }
+         term.start[i+1UL] = term.offsets.size();
+      }
+
+      template< typename MT1, typename MT2, typename ST >
+      void product( const MT1&, const MT2&, const ST& ) {
+         ++t;
+      }
+
+      size_t i;                  //!< The current row/column of the target matrix.
+      size_t t;                  //!< The index of the current term.
+      IT first;                  //!< The first element of the current row/column.
+      std::vector<Term>& terms;  //!< The terms of the plan.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Private class Checker***********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Term visitor for the validation of the structure of an expression.
+   */
+   struct Checker
+   {
+      template< typename MT, typename ST >
+      void plain( const MT& mat, const ST& ) {
+         valid = valid && t < terms.size() && !terms[t].product && terms[t].lhs.matches( mat );
+         ++t;
+      }
+
+      template< typename MT1, typename MT2, typename ST >
+      void product( const MT1& lhs, const MT2& rhs, const ST& ) {
+         valid = valid && t < terms.size() && terms[t].product &&
+                 terms[t].lhs.matches( lhs ) && terms[t].rhs.matches( rhs );
+         ++t;
+      }
+
+      size_t t;                        //!< The index of the current term.
+      bool valid;                      //!< Validity of the structure.
+      const std::vector<Term>& terms;  //!< The terms of the plan.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Private class Updater***********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Term visitor for the numeric update of a single row/column.
+   */
+   template< bool SO       // Storage order of the target matrix
+           , typename IT > // Type of the iterator over the target row/column
+   struct Updater
+   {
+      template< typename MT, typename ST >
+      void plain( const MT& mat, const ST& scalar ) {
+         const Term& term( terms[t++] );
+         const size_t* offset( term.offsets.data() + term.start[i] );
+         for( auto element=mat.begin(i); element!=mat.end(i); ++element, ++offset ) {
+            first[*offset].value() += scalar * element->value();
+         }
+      }
+
+      template< typename MT1, typename MT2, typename ST >
+      void product( const MT1& lhs, const MT2& rhs, const ST& scalar ) {
+         ++t;
+         if( !mapped ) {
+            for( IT pos=first; pos!=last; ++pos ) {
+               positions[pos->index()] = pos - first;
+            }
+            mapped = true;
+         }
+         if( SO ) {
+            for( auto r=rhs.begin(i); r!=rhs.end(i); ++r ) {
+               const auto factor( scalar * r->value() );
+               for( auto l=lhs.begin( r->index() ); l!=lhs.end( r->index() ); ++l ) {
+                  first[positions[l->index()]].value() += l->value() * factor;
+               }
+            }
+         }
+         else {
+            for( auto l=lhs.begin(i); l!=lhs.end(i); ++l ) {
+               const auto factor( scalar * l->value() );
+               for( auto r=rhs.begin( l->index() ); r!=rhs.end( l->index() ); ++r ) {
+                  first[positions[r->index()]].value() += factor * r->value();
+               }
+            }
+         }
+      }
+
+      size_t i;                        //!< The current row/column of the target matrix.
+      size_t t;                        //!< The index of the current term.
+      bool mapped;                     //!< Flag for the initialized position workspace.
+      IT first;                        //!< The first element of the current row/column.
+      IT last;                         //!< One past the last element of the current row/column.
+      size_t* positions;               //!< The position workspace of the current thread.
+      const std::vector<Term>& terms;  //!< The terms of the plan.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Term traversal functions********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   template< typename MT, typename ST, typename Visitor >
+   static auto visit( const MT& mat, const ST& scalar, Visitor& visitor )
+      -> EnableIf_t< IsMatMatAddExpr_v<MT> >;
+
+   template< typename MT, typename ST, typename Visitor >
+   static auto visit( const MT& mat, const ST& scalar, Visitor& visitor )
+      -> EnableIf_t< IsMatMatSubExpr_v<MT> >;
+
+   template< typename MT, typename ST, typename Visitor >
+   static auto visit( const MT& mat, const ST& scalar, Visitor& visitor )
+      -> EnableIf_t< IsMatScalarMultExpr_v<MT> >;
+
+   template< typename MT, typename ST, typename Visitor >
+   static auto visit( const MT& mat, const ST& scalar, Visitor& visitor )
+      -> EnableIf_t< IsMatScalarDivExpr_v<MT> >;
+
+   template< typename MT, typename ST, typename Visitor >
+   static auto visit( const MT& mat, const ST& scalar, Visitor& visitor )
+      -> EnableIf_t< IsMatMatMultExpr_v<MT> >;
+
+   template< typename MT, typename ST, typename Visitor >
+   static auto visit( const MT& mat, const ST& scalar, Visitor& visitor )
+      -> EnableIf_t< !IsExpression_v<MT> >;
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t rows_;                     //!< The number of rows of the target matrix.
+   size_t columns_;                  //!< The number of columns of the target matrix.
+   size_t nonzeros_;                 //!< The number of non-zero elements of the target matrix.
+   std::vector<size_t> chunks_;      //!< Non-zero balanced partitioning of the target matrix.
+   std::vector<Term> terms_;         //!< The terms of the planned expression.
+   std::vector<size_t> positions_;   //!< Position workspace for products (one per chunk).
+   SparsePattern pattern_;           //!< Sparsity pattern of the target matrix.
+   bool analyzed_;                   //!< Flag for a completed symbolic phase.
+   bool verify_;                     //!< Flag for the verification of all indices.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for PatternPlan.
+//
+// \param verify \a true to verify the indices of all non-zero elements in the numeric phase.
+//
+// By default, the numeric phase only verifies the number of non-zero elements of every row or
+// column of the target matrix and of all operands. In case \a verify is \a true, the plan also
+// records the indices of all non-zero elements in the symbolic phase and compares them in every
+// call of the assign() function. This detects all changes of the sparsity patterns, but is as
+// expensive as the numeric update itself and should therefore only be used for debugging.
+*/
+inline PatternPlan::PatternPlan( bool verify )
+   : rows_     ( 0UL )     // The number of rows of the target matrix
+   , columns_  ( 0UL )     // The number of columns of the target matrix
+   , nonzeros_ ( 0UL )     // The number of non-zero elements of the target matrix
+   , chunks_   ()          // Non-zero balanced partitioning of the target matrix
+   , terms_    ()          // The terms of the planned expression
+   , positions_()          // Position workspace for products
+   , pattern_  ()          // Sparsity pattern of the target matrix
+   , analyzed_ ( false )   // Flag for a completed symbolic phase
+   , verify_   ( verify )  // Flag for the verification of all indices
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the symbolic phase of the plan has been completed.
+//
+// \return \a true in case the plan has been analyzed, \a false if not.
+*/
+inline bool PatternPlan::isAnalyzed() const noexcept
+{
+   return analyzed_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the plan verifies the indices of all non-zero elements.
+//
+// \return \a true in case all indices are verified, \a false if not.
+*/
+inline bool PatternPlan::isVerifying() const noexcept
+{
+   return verify_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of terms of the planned expression.
+//
+// \return The number of sparse matrix operands and sparse matrix products of the expression.
+*/
+inline size_t PatternPlan::terms() const noexcept
+{
+   return terms_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of independent chunks of the numeric phase.
+//
+// \return The number of chunks the target matrix is partitioned into.
+*/
+inline size_t PatternPlan::chunks() const noexcept
+{
+   return chunks_.empty() ? 0UL : chunks_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial state.
+//
+// \return void
+*/
+inline void PatternPlan::reset()
+{
+   rows_     = 0UL;
+   columns_  = 0UL;
+   nonzeros_ = 0UL;
+   chunks_.clear();
+   terms_.clear();
+   positions_.clear();
+   pattern_.clear();
+   analyzed_ = false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PLAN FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Symbolic phase of the pattern-reusing assignment.
+//
+// \param lhs The target compressed matrix.
+// \param rhs The right-hand side sparse matrix expression to be planned and assigned.
+// \return void
+//
+// This function computes the sparsity pattern of the given expression, restructures the target
+// matrix accordingly and computes the scatter maps of all operands. Afterwards the expression is
+// assigned to the target matrix via the numeric phase. Note that the sparsity pattern of the
+// target matrix is completely replaced.
+*/
+template< typename Type  // Data type of the target matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag of the target matrix
+        , typename MT >  // Type of the right-hand side sparse matrix
+void PatternPlan::analyze( CompressedMatrix<Type,SO,Tag>& lhs, const SparseMatrix<MT,SO>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   reset();
+
+   const size_t m( (*rhs).rows() );
+   const size_t n( (*rhs).columns() );
+   const size_t major( SO ? n : m );
+   const size_t minor( SO ? m : n );
+
+   // Setup of the terms
+   Checker counter{ 0UL, true, terms_ };
+   visit( *rhs, Type(1), counter );
+   terms_.resize( counter.t );
+
+   Setup setup{ 0UL, major, verify_, terms_ };
+   visit( *rhs, Type(1), setup );
+
+   // Computation of the sparsity pattern
+   std::vector<size_t> marker( minor, major );
+   std::vector<size_t> indices;
+   std::vector<size_t> ptr( major+1UL, 0UL );
+   std::vector<size_t> work( major, 0UL );
+
+   for( size_t i=0UL; i<major; ++i ) {
+      const size_t first( indices.size() );
+      Collector<SO> collector{ i, 0UL, marker, indices };
+      visit( *rhs, Type(1), collector );
+      std::sort( indices.begin()+first, indices.end() );
+      ptr[i+1UL] = indices.size();
+      work[i]    = collector.work;
+   }
+
+   CompressedMatrix<Type,SO,Tag> tmp( m, n, indices.size() );
+   for( size_t i=0UL; i<major; ++i ) {
+      for( size_t k=ptr[i]; k<ptr[i+1UL]; ++k ) {
+         tmp.append( SO ? indices[k] : i, SO ? i : indices[k], Type() );
+      }
+      tmp.finalize( i );
+   }
+   lhs.swap( tmp );
+
+   pattern_.record( lhs, verify_ );
+
+   // Computation of the scatter maps
+   if( major > 0UL )
+   {
+      using Iterator = typename CompressedMatrix<Type,SO,Tag>::Iterator;
+
+      for( size_t i=0UL; i<major; ++i ) {
+         Mapper<Iterator> mapper{ i, 0UL, lhs.begin(i), terms_ };
+         visit( *rhs, Type(1), mapper );
+         work[i] += lhs.nonZeros(i);
+      }
+
+      for( const Term& term : terms_ ) {
+         if( !term.product ) {
+            for( size_t i=0UL; i<major; ++i ) {
+               work[i] += term.start[i+1UL] - term.start[i];
+            }
+         }
+      }
+   }
+
+   // Non-zero balanced partitioning of the target matrix
+   size_t total( 0UL );
+   for( size_t i=0UL; i<major; ++i ) {
+      total += work[i];
+   }
+
+   const size_t threads( ( lhs.nonZeros() < SMP_SMATASSIGN_THRESHOLD || major == 0UL )
+                         ? 1UL : min( getNumThreads(), major ) );
+
+   chunks_.push_back( 0UL );
+   for( size_t i=0UL, sum=0UL; i<major; ++i ) {
+      sum += work[i];
+      if( chunks_.size() < threads && sum * threads >= total * chunks_.size() ) {
+         chunks_.push_back( i+1UL );
+      }
+   }
+   chunks_.push_back( major );
+   chunks_.erase( std::unique( chunks_.begin(), chunks_.end() ), chunks_.end() );
+
+   if( std::any_of( terms_.begin(), terms_.end(), []( const Term& term ){ return term.product; } ) ) {
+      positions_.resize( chunks() * minor );
+   }
+
+   rows_     = m;
+   columns_  = n;
+   nonzeros_ = lhs.nonZeros();
+   analyzed_ = true;
+
+   assign( lhs, rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Numeric phase of the pattern-reusing assignment.
+//
+// \param lhs The target compressed matrix.
+// \param rhs The right-hand side sparse matrix expression to be assigned.
+// \return void
+// \exception std::invalid_argument Invalid structure of the assignment.
+//
+// This function assigns the given expression to the target matrix by means of the previously
+// computed scatter maps. The values of the target matrix are updated in-place, no memory is
+// allocated and the sparsity pattern of the target matrix is not modified. In case the plan has
+// not been analyzed, in case the size or the number of non-zero elements of any row/column of
+// the target matrix or of any operand has changed, or in case the structure of the given
+// expression doesn't match the structure of the analyzed expression, a \a std::invalid_argument
+// exception is thrown. In case the plan has been constructed with enabled verification, the
+// same holds for any change of the indices of the non-zero elements. Note that all checks are
+// performed before any value of the target matrix is modified.
+*/
+template< typename Type  // Data type of the target matrix
+        , bool SO        // Storage order
+        , typename Tag   // Type tag of the target matrix
+        , typename MT >  // Type of the right-hand side sparse matrix
+void PatternPlan::assign( CompressedMatrix<Type,SO,Tag>& lhs, const SparseMatrix<MT,SO>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !analyzed_ ||
+       lhs.rows()     != rows_    || (*rhs).rows()    != rows_    ||
+       lhs.columns()  != columns_ || (*rhs).columns() != columns_ ||
+       lhs.nonZeros() != nonzeros_ || !pattern_.matches( lhs ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid target matrix for pattern plan" );
+   }
+
+   Checker checker{ 0UL, true, terms_ };
+   visit( *rhs, Type(1), checker );
+
+   if( !checker.valid || checker.t != terms_.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid expression structure for pattern plan" );
+   }
+
+   if( nonzeros_ == 0UL )
+      return;
+
+   using Iterator = typename CompressedMatrix<Type,SO,Tag>::Iterator;
+
+   const size_t minor( SO ? rows_ : columns_ );
+
+   smpFor( chunks(), [&]( size_t c )
+   {
+      size_t* positions( positions_.empty() ? nullptr : positions_.data() + c*minor );
+
+      for( size_t i=chunks_[c]; i<chunks_[c+1UL]; ++i )
+      {
+         const Iterator first( lhs.begin(i) );
+         const Iterator last ( lhs.end(i) );
+
+         for( Iterator element=first; element!=last; ++element ) {
+            element->value() = Type();
+         }
+
+         Updater<SO,Iterator> updater{ i, 0UL, false, first, last, positions, terms_ };
+         visit( *rhs, Type(1), updater );
+      }
+   } );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TERM TRAVERSAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Traversal of a sparse matrix addition.
+//
+// \param mat The sparse matrix addition.
+// \param scalar The scalar factor of the addition.
+// \param visitor The term visitor.
+// \return void
+*/
+template< typename MT         // Type of the sparse matrix addition
+        , typename ST         // Type of the scalar factor
+        , typename Visitor >  // Type of the term visitor
+inline auto PatternPlan::visit( const MT& mat, const ST& scalar, Visitor& visitor )
+   -> EnableIf_t< IsMatMatAddExpr_v<MT> >
+{
+   visit( mat.leftOperand() , scalar, visitor );
+   visit( mat.rightOperand(), scalar, visitor );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Traversal of a sparse matrix subtraction.
+//
+// \param mat The sparse matrix subtraction.
+// \param scalar The scalar factor of the subtraction.
+// \param visitor The term visitor.
+// \return void
+*/
+template< typename MT         // Type of the sparse matrix subtraction
+        , typename ST         // Type of the scalar factor
+        , typename Visitor >  // Type of the term visitor
+inline auto PatternPlan::visit( const MT& mat, const ST& scalar, Visitor& visitor )
+   -> EnableIf_t< IsMatMatSubExpr_v<MT> >
+{
+   visit( mat.leftOperand() ,  scalar, visitor );
+   visit( mat.rightOperand(), -scalar, visitor );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Traversal of a sparse matrix/scalar multiplication.
+//
+// \param mat The sparse matrix/scalar multiplication.
+// \param scalar The scalar factor of the multiplication.
+// \param visitor The term visitor.
+// \return void
+*/
+template< typename MT         // Type of the sparse matrix/scalar multiplication
+        , typename ST         // Type of the scalar factor
+        , typename Visitor >  // Type of the term visitor
+inline auto PatternPlan::visit( const MT& mat, const ST& scalar, Visitor& visitor )
+   -> EnableIf_t< IsMatScalarMultExpr_v<MT> >
+{
+   visit( mat.leftOperand(), ST( scalar * mat.rightOperand() ), visitor );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Traversal of a sparse matrix/scalar division.
+//
+// \param mat The sparse matrix/scalar division.
+// \param scalar The scalar factor of the division.
+// \param visitor The term visitor.
+// \return void
+*/
+template< typename MT         // Type of the sparse matrix/scalar division
+        , typename ST         // Type of the scalar factor
+        , typename Visitor >  // Type of the term visitor
+inline auto PatternPlan::visit( const MT& mat, const ST& scalar, Visitor& visitor )
+   -> EnableIf_t< IsMatScalarDivExpr_v<MT> >
+{
+   visit( mat.leftOperand(), ST( scalar / mat.rightOperand() ), visitor );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Traversal of a sparse matrix/sparse matrix multiplication.
+//
+// \param mat The sparse matrix/sparse matrix multiplication.
+// \param scalar The scalar factor of the multiplication.
+// \param visitor The term visitor.
+// \return void
+*/
+template< typename MT         // Type of the sparse matrix/sparse matrix multiplication
+        , typename ST         // Type of the scalar factor
+        , typename Visitor >  // Type of the term visitor
+inline auto PatternPlan::visit( const MT& mat, const ST& scalar, Visitor& visitor )
+   -> EnableIf_t< IsMatMatMultExpr_v<MT> >
+{
+   using MT1 = RemoveCV_t< RemoveReference_t< decltype( mat.leftOperand() ) > >;
+   using MT2 = RemoveCV_t< RemoveReference_t< decltype( mat.rightOperand() ) > >;
+
+   BLAZE_STATIC_ASSERT_MSG( IsSparseMatrix_v<MT1> && IsSparseMatrix_v<MT2> &&
+                            !IsExpression_v<MT1> && !IsExpression_v<MT2>,
+                            "Non-sparse or expression operand of planned multiplication detected" );
+   BLAZE_STATIC_ASSERT_MSG( StorageOrder_v<MT1> == StorageOrder_v<MT> &&
+                            StorageOrder_v<MT2> == StorageOrder_v<MT>,
+                            "Mismatching storage order of planned multiplication detected" );
+
+   visitor.product( mat.leftOperand(), mat.rightOperand(), scalar );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Traversal of a non-expression sparse matrix.
+//
+// \param mat The sparse matrix.
+// \param scalar The scalar factor of the sparse matrix.
+// \param visitor The term visitor.
+// \return void
+*/
+template< typename MT         // Type of the sparse matrix
+        , typename ST         // Type of the scalar factor
+        , typename Visitor >  // Type of the term visitor
+inline auto PatternPlan::visit( const MT& mat, const ST& scalar, Visitor& visitor )
+   -> EnableIf_t< !IsExpression_v<MT> >
+{
+   BLAZE_STATIC_ASSERT_MSG( IsSparseMatrix_v<MT>, "Non-sparse operand of planned expression detected" );
+
+   visitor.plain( mat, scalar );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
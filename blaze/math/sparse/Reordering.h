@@ -0,0 +1,694 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/Reordering.h
+//  \brief Header file for the bandwidth-reducing reordering of sparse matrices
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_REORDERING_H_
+#define _BLAZE_MATH_SPARSE_REORDERING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Adjacency graph of the symmetrized sparsity pattern of a square sparse matrix.
+// \ingroup compressed_matrix
+//
+// The ReorderingGraph class stores the adjacency lists of the undirected graph of the sparsity
+// pattern \f$ A+A^T \f$ (without self-loops) in compressed form. It is the basis of all
+// bandwidth-reducing reorderings.
+*/
+class ReorderingGraph
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the ReorderingGraph class.
+   //
+   // \param A The square sparse matrix.
+   */
+   template< typename MT, bool SO >
+   explicit ReorderingGraph( const SparseMatrix<MT,SO>& A )
+      : start_( (*A).rows()+1UL, 0UL )
+      , adjacent_()
+   {
+      CompositeType_t<MT> a( *A );  // Evaluation of the sparse matrix
+
+      const size_t n( a.rows() );
+
+      // Counting the number of edges per vertex (both directions)
+      for( size_t i=0UL; i<n; ++i ) {
+         for( auto element=a.begin(i); element!=a.end(i); ++element ) {
+            if( element->index() != i ) {
+               ++start_[i+1UL];
+               ++start_[element->index()+1UL];
+            }
+         }
+      }
+      for( size_t i=0UL; i<n; ++i ) {
+         start_[i+1UL] += start_[i];
+      }
+
+      // Scattering the edges
+      adjacent_.resize( start_[n] );
+      std::vector<size_t> pos( start_.begin(), start_.end()-1 );
+      for( size_t i=0UL; i<n; ++i ) {
+         for( auto element=a.begin(i); element!=a.end(i); ++element ) {
+            if( element->index() != i ) {
+               adjacent_[pos[i]++] = element->index();
+               adjacent_[pos[element->index()]++] = i;
+            }
+         }
+      }
+
+      // Removing duplicate edges
+      size_t end( 0UL );
+      for( size_t i=0UL; i<n; ++i ) {
+         const auto first( adjacent_.begin()+start_[i] );
+         const auto last ( adjacent_.begin()+start_[i+1UL] );
+         std::sort( first, last );
+         const auto unique( std::unique( first, last ) );
+         start_[i] = end;
+         end = std::copy( first, unique, adjacent_.begin()+end ) - adjacent_.begin();
+      }
+      start_[n] = end;
+      adjacent_.resize( end );
+   }
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Returns the number of vertices of the graph.
+   //
+   // \return The number of vertices.
+   */
+   inline size_t size() const noexcept { return start_.size()-1UL; }
+
+   /*!\brief Returns the degree of the given vertex.
+   //
+   // \param v The index of the vertex.
+   // \return The number of adjacent vertices.
+   */
+   inline size_t degree( size_t v ) const noexcept { return start_[v+1UL] - start_[v]; }
+
+   /*!\brief Returns a pointer to the first adjacent vertex of the given vertex.
+   //
+   // \param v The index of the vertex.
+   // \return Pointer to the first adjacent vertex.
+   */
+   inline const size_t* begin( size_t v ) const noexcept { return adjacent_.data() + start_[v]; }
+
+   /*!\brief Returns a pointer one past the last adjacent vertex of the given vertex.
+   //
+   // \param v The index of the vertex.
+   // \return Pointer one past the last adjacent vertex.
+   */
+   inline const size_t* end( size_t v ) const noexcept { return adjacent_.data() + start_[v+1UL]; }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   std::vector<size_t> start_;     //!< Start of the adjacency list of each vertex.
+   std::vector<size_t> adjacent_;  //!< The adjacency lists of all vertices.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  REORDERING KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Breadth-first search within a labeled subset of the vertices of a graph.
+// \ingroup compressed_matrix
+//
+// \param G The adjacency graph.
+// \param root The root vertex of the search.
+// \param label The labels of all vertices.
+// \param id The label of the vertices that can be visited.
+// \param level The levels of all visited vertices (must be \a size_t(-1) for unvisited vertices).
+// \param order The vertices in the order of the search.
+// \return The number of levels of the level structure.
+//
+// This function computes the rooted level structure of the given root vertex within the subset
+// of all vertices labeled with \a id. The visited vertices are appended to \a order, their level
+// is stored in \a level. In case \a sorted is \a true, the unvisited neighbors of each vertex are
+// visited in the order of increasing degree (as required by the Cuthill-McKee algorithm).
+*/
+template< bool sorted >  // Flag for the degree-sorted search
+size_t reorderingBFS( const ReorderingGraph& G, size_t root, const std::vector<size_t>& label,
+                      size_t id, std::vector<size_t>& level, std::vector<size_t>& order )
+{
+   const size_t first( order.size() );
+   size_t levels( 0UL );
+
+   level[root] = 0UL;
+   order.push_back( root );
+
+   for( size_t k=first; k<order.size(); ++k )
+   {
+      const size_t v( order[k] );
+      const size_t next( order.size() );
+
+      levels = max( levels, level[v]+1UL );
+
+      for( const size_t* w=G.begin(v); w!=G.end(v); ++w ) {
+         if( label[*w] == id && level[*w] == size_t(-1) ) {
+            level[*w] = level[v] + 1UL;
+            order.push_back( *w );
+         }
+      }
+
+      if( sorted ) {
+         std::stable_sort( order.begin()+next, order.end(), [&G]( size_t a, size_t b ) {
+            return G.degree( a ) < G.degree( b );
+         } );
+      }
+   }
+
+   return levels;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes a pseudo-peripheral vertex within a labeled subset of the vertices of a graph.
+// \ingroup compressed_matrix
+//
+// \param G The adjacency graph.
+// \param start The initial vertex of the search.
+// \param label The labels of all vertices.
+// \param id The label of the vertices that can be visited.
+// \param level Auxiliary level vector (\a size_t(-1) for all vertices of the subset).
+// \return The pseudo-peripheral vertex.
+//
+// This function implements the algorithm by Gibbs, Poole, and Stockmeyer (in the formulation
+// of George and Liu): Starting from the given vertex, the vertex of minimum degree within the
+// last level of the rooted level structure is selected as new root as long as the number of
+// levels increases. On return, \a level is reset to \a size_t(-1) for all visited vertices.
+*/
+inline size_t pseudoPeripheral( const ReorderingGraph& G, size_t start,
+                                const std::vector<size_t>& label, size_t id,
+                                std::vector<size_t>& level )
+{
+   std::vector<size_t> order;
+   size_t root( start );
+   size_t levels( 0UL );
+
+   while( true )
+   {
+      order.clear();
+      const size_t current( reorderingBFS<false>( G, root, label, id, level, order ) );
+
+      size_t candidate( root );
+      size_t degree( size_t(-1) );
+      for( size_t v : order ) {
+         if( level[v]+1UL == current && G.degree( v ) < degree ) {
+            candidate = v;
+            degree = G.degree( v );
+         }
+      }
+
+      for( size_t v : order ) {
+         level[v] = size_t(-1);
+      }
+
+      if( current <= levels )
+         return root;
+
+      levels = current;
+      root = candidate;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Recursive nested dissection of a labeled subset of the vertices of a graph.
+// \ingroup compressed_matrix
+//
+// \param G The adjacency graph.
+// \param vertices The vertices of the subset (all labeled with \a id).
+// \param label The labels of all vertices.
+// \param id The label of the vertices of the subset.
+// \param next The next unused label.
+// \param level Auxiliary level vector (\a size_t(-1) for all vertices of the subset).
+// \param leafSize The maximum number of vertices of an undivided subset.
+// \param perm The resulting ordering.
+// \return void
+//
+// The subset is split by the middle level of the rooted level structure of a pseudo-peripheral
+// vertex. Both halves are ordered recursively, followed by the separator vertices.
+*/
+inline void nestedDissection( const ReorderingGraph& G, std::vector<size_t> vertices,
+                              std::vector<size_t>& label, size_t id, size_t& next,
+                              std::vector<size_t>& level, size_t leafSize,
+                              std::vector<size_t>& perm )
+{
+   if( vertices.size() <= leafSize ) {
+      for( size_t v : vertices ) {
+         if( level[v] != size_t(-1) ) continue;
+         const size_t first( perm.size() );
+         const size_t root( pseudoPeripheral( G, v, label, id, level ) );
+         reorderingBFS<true>( G, root, label, id, level, perm );
+         std::reverse( perm.begin()+first, perm.end() );
+      }
+      return;
+   }
+
+   // Computation of the level structure of a pseudo-peripheral vertex
+   std::vector<size_t> order;
+   const size_t root( pseudoPeripheral( G, vertices.front(), label, id, level ) );
+   const size_t levels( reorderingBFS<false>( G, root, label, id, level, order ) );
+
+   // Splitting the subset at the middle level (unreached vertices form a separate subset)
+   const size_t middle( levels / 2UL );
+   std::vector<size_t> lower, upper, separator;
+
+   for( size_t v : vertices ) {
+      if( level[v] == size_t(-1) || level[v] > middle ) upper.push_back( v );
+      else if( level[v] < middle ) lower.push_back( v );
+      else separator.push_back( v );
+   }
+
+   for( size_t v : order ) {
+      level[v] = size_t(-1);
+   }
+
+   if( lower.empty() && upper.empty() ) {
+      nestedDissection( G, std::move( separator ), label, id, next, level, vertices.size(), perm );
+      return;
+   }
+
+   const size_t lowerId( next++ );
+   const size_t upperId( next++ );
+   for( size_t v : lower ) label[v] = lowerId;
+   for( size_t v : upper ) label[v] = upperId;
+
+   nestedDissection( G, std::move( lower ), label, lowerId, next, level, leafSize, perm );
+   nestedDissection( G, std::move( upper ), label, upperId, next, level, leafSize, perm );
+
+   perm.insert( perm.end(), separator.begin(), separator.end() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Reordering functions */
+//@{
+template< typename MT, bool SO >
+std::vector<size_t> rcm( const SparseMatrix<MT,SO>& A );
+
+template< typename MT, bool SO >
+std::vector<size_t> nestedDissection( const SparseMatrix<MT,SO>& A, size_t leafSize = 64UL );
+
+inline std::vector<size_t> invertPermutation( const std::vector<size_t>& perm );
+
+template< typename Type, bool SO, typename Tag >
+CompressedMatrix<Type,SO,Tag>
+   permute( const CompressedMatrix<Type,SO,Tag>& A, const std::vector<size_t>& perm );
+
+template< typename VT, bool TF >
+ResultType_t<VT> permute( const DenseVector<VT,TF>& x, const std::vector<size_t>& perm );
+
+template< typename MT, bool SO >
+size_t bandwidth( const SparseMatrix<MT,SO>& A );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the reverse Cuthill-McKee ordering of a square sparse matrix.
+// \ingroup compressed_matrix
+//
+// \param A The square sparse matrix.
+// \return The permutation of the rows/columns (\a perm[k] is the original index of row \a k).
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes a bandwidth-reducing ordering of the rows and columns of the given
+// square sparse matrix by means of the reverse Cuthill-McKee algorithm. The algorithm is based
+// on the symmetrized sparsity pattern \f$ A+A^T \f$, i.e. it can also be applied to matrices
+// with an unsymmetric pattern. Each connected component is ordered by a breadth-first search
+// starting at a pseudo-peripheral vertex. The resulting permutation can be applied to the
+// matrix and to all according vectors via the permute() functions:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+
+   CompressedMatrix<double> A;  // Matrix of a mesh with random node numbering
+   DynamicVector<double> x, y;
+   // ... Resizing and initialization
+
+   const std::vector<size_t> perm( blaze::rcm( A ) );
+
+   const CompressedMatrix<double> B( blaze::permute( A, perm ) );  // B(i,j) = A(perm[i],perm[j])
+   const DynamicVector<double> z( blaze::permute( x, perm ) );     // z[i] = x[perm[i]]
+
+   y = blaze::permute( B * z, blaze::invertPermutation( perm ) );  // y = A * x
+   \endcode
+
+// In case the given matrix is not a square matrix, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+std::vector<size_t> rcm( const SparseMatrix<MT,SO>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*A).rows() != (*A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const ReorderingGraph G( *A );
+   const size_t n( G.size() );
+
+   const std::vector<size_t> label( n, 0UL );
+   std::vector<size_t> level( n, size_t(-1) );
+   std::vector<size_t> perm;
+   perm.reserve( n );
+
+   // Processing the connected components in the order of increasing minimum degree
+   std::vector<size_t> vertices( n );
+   for( size_t v=0UL; v<n; ++v ) {
+      vertices[v] = v;
+   }
+   std::stable_sort( vertices.begin(), vertices.end(), [&G]( size_t a, size_t b ) {
+      return G.degree( a ) < G.degree( b );
+   } );
+
+   for( size_t v : vertices ) {
+      if( level[v] != size_t(-1) ) continue;
+      const size_t root( pseudoPeripheral( G, v, label, 0UL, level ) );
+      reorderingBFS<true>( G, root, label, 0UL, level, perm );
+   }
+
+   std::reverse( perm.begin(), perm.end() );
+
+   BLAZE_INTERNAL_ASSERT( perm.size() == n, "Invalid permutation detected" );
+
+   return perm;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a nested dissection ordering of a square sparse matrix.
+// \ingroup compressed_matrix
+//
+// \param A The square sparse matrix.
+// \param leafSize The maximum number of vertices of an undivided subgraph.
+// \return The permutation of the rows/columns (\a perm[k] is the original index of row \a k).
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes a fill-reducing and locality-improving ordering of the rows and
+// columns of the given square sparse matrix by means of a simple nested dissection. The graph
+// of the symmetrized sparsity pattern \f$ A+A^T \f$ is recursively bisected by the middle level
+// of the rooted level structure of a pseudo-peripheral vertex. Both halves are ordered first,
+// followed by the separator vertices. Subgraphs with at most \a leafSize vertices are ordered
+// by the reverse Cuthill-McKee algorithm. The resulting permutation can be applied via the
+// permute() functions (see the rcm() function).
+//
+// In case the given matrix is not a square matrix, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+std::vector<size_t> nestedDissection( const SparseMatrix<MT,SO>& A, size_t leafSize )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*A).rows() != (*A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const ReorderingGraph G( *A );
+   const size_t n( G.size() );
+
+   std::vector<size_t> label( n, 0UL );
+   std::vector<size_t> level( n, size_t(-1) );
+   std::vector<size_t> perm;
+   perm.reserve( n );
+
+   std::vector<size_t> vertices( n );
+   for( size_t v=0UL; v<n; ++v ) {
+      vertices[v] = v;
+   }
+
+   size_t next( 1UL );
+   nestedDissection( G, std::move( vertices ), label, 0UL, next, level,
+                     max( leafSize, 1UL ), perm );
+
+   BLAZE_INTERNAL_ASSERT( perm.size() == n, "Invalid permutation detected" );
+
+   return perm;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the inverse of the given permutation.
+// \ingroup compressed_matrix
+//
+// \param perm The permutation to be inverted.
+// \return The inverse permutation.
+// \exception std::invalid_argument Invalid permutation provided.
+//
+// In case the given vector is not a permutation of the indices \f$[0..N-1]\f$, a
+// \a std::invalid_argument exception is thrown.
+*/
+inline std::vector<size_t> invertPermutation( const std::vector<size_t>& perm )
+{
+   std::vector<size_t> inverse( perm.size(), perm.size() );
+
+   for( size_t k=0UL; k<perm.size(); ++k ) {
+      if( perm[k] >= perm.size() || inverse[perm[k]] != perm.size() ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid permutation provided" );
+      }
+      inverse[perm[k]] = k;
+   }
+
+   return inverse;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Symmetric permutation of a square compressed matrix (\f$ B=PAP^T \f$).
+// \ingroup compressed_matrix
+//
+// \param A The square compressed matrix to be permuted.
+// \param perm The permutation of the rows/columns (\a perm[k] is the original index of row \a k).
+// \return The permuted compressed matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid permutation provided.
+//
+// This function returns the compressed matrix \f$ B \f$ with \f$ B(i,j) = A(perm[i],perm[j]) \f$.
+// The resulting matrix is assembled directly (without any element insertion) with the exact
+// capacity per row/column. In case the number of non-zero elements of \a A exceeds the
+// SMP_SMATASSIGN_THRESHOLD, the rows/columns are permuted in parallel. In case the given matrix
+// is not a square matrix or the given vector is not a permutation of the row/column indices, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+CompressedMatrix<Type,SO,Tag>
+   permute( const CompressedMatrix<Type,SO,Tag>& A, const std::vector<size_t>& perm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( A.rows() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( perm.size() != A.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid permutation provided" );
+   }
+
+   const size_t n( A.rows() );
+   const std::vector<size_t> inverse( invertPermutation( perm ) );
+
+   std::vector<size_t> nonzeros( n );
+   for( size_t i=0UL; i<n; ++i ) {
+      nonzeros[i] = A.nonZeros( perm[i] );
+   }
+
+   CompressedMatrix<Type,SO,Tag> B( n, n, nonzeros );
+
+   const size_t total( A.nonZeros() );
+   const size_t parts( ( total < SMP_SMATASSIGN_THRESHOLD || n == 0UL )
+                       ? 1UL : min( getNumThreads(), n ) );
+
+   smpFor( parts, [&]( size_t part )
+   {
+      std::vector< std::pair<size_t,Type> > row;
+
+      for( size_t i=n*part/parts; i<n*(part+1UL)/parts; ++i )
+      {
+         row.clear();
+         for( auto element=A.begin(perm[i]); element!=A.end(perm[i]); ++element ) {
+            row.emplace_back( inverse[element->index()], element->value() );
+         }
+
+         std::sort( row.begin(), row.end(), []( const auto& a, const auto& b ) {
+            return a.first < b.first;
+         } );
+
+         for( const auto& element : row ) {
+            B.append( SO ? element.first : i, SO ? i : element.first, element.second );
+         }
+      }
+   } );
+
+   return B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Permutation of a dense vector (\f$ \vec{y}=P\vec{x} \f$).
+// \ingroup compressed_matrix
+//
+// \param x The dense vector to be permuted.
+// \param perm The permutation of the elements (\a perm[k] is the original index of element \a k).
+// \return The permuted dense vector.
+// \exception std::invalid_argument Invalid permutation provided.
+//
+// This function returns the dense vector \f$ \vec{y} \f$ with \f$ y[k] = x[perm[k]] \f$. In
+// case the size of the given permutation doesn't match the size of the vector, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag of the dense vector
+ResultType_t<VT> permute( const DenseVector<VT,TF>& x, const std::vector<size_t>& perm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( perm.size() != (*x).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid permutation provided" );
+   }
+
+   CompositeType_t<VT> v( *x );  // Evaluation of the dense vector
+
+   ResultType_t<VT> y( perm.size() );
+   for( size_t k=0UL; k<perm.size(); ++k ) {
+      y[k] = v[perm[k]];
+   }
+
+   return y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the bandwidth of a sparse matrix.
+// \ingroup compressed_matrix
+//
+// \param A The sparse matrix.
+// \return The bandwidth of the matrix.
+//
+// This function returns the bandwidth of the given sparse matrix, i.e. the maximum distance
+// \f$ |i-j| \f$ of all non-zero elements \f$ A(i,j) \f$ from the diagonal.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+size_t bandwidth( const SparseMatrix<MT,SO>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   CompositeType_t<MT> a( *A );  // Evaluation of the sparse matrix
+
+   const size_t major( SO ? a.columns() : a.rows() );
+   size_t result( 0UL );
+
+   for( size_t i=0UL; i<major; ++i ) {
+      if( a.begin(i) == a.end(i) ) continue;
+      const size_t first( a.begin(i)->index() );
+      const size_t last ( ( a.end(i)-1 )->index() );
+      result = max( result, ( first < i ? i-first : first-i ), ( last < i ? i-last : last-i ) );
+   }
+
+   return result;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
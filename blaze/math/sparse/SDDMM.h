@@ -0,0 +1,407 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SDDMM.h
+//  \brief Header file for the sampled dense matrix multiplication kernels
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SDDMM_H_
+#define _BLAZE_MATH_SPARSE_SDDMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/sparse/SMVM.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/IsTriangular.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveCVRef.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  TYPE TRAITS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the IsSDDMMCompatible_v and IsSDDMMVectorizable_v variable
+//        templates.
+// \ingroup sparse_matrix
+*/
+template< typename MT, typename = void >
+struct SDDMMHelper
+{
+   static constexpr bool compatible   = false;
+   static constexpr bool vectorizable = false;
+};
+
+template< typename MT >
+struct SDDMMHelper< MT, EnableIf_t< IsDenseMatrix_v<MT> && IsMatMatMultExpr_v<MT> > >
+{
+   using LT = RemoveCVRef_t< LeftOperand_t<MT> >;
+   using RT = RemoveCVRef_t< RightOperand_t<MT> >;
+
+   static constexpr bool compatible =
+      ( IsDenseMatrix_v<LT> && IsDenseMatrix_v<RT> &&
+        !RequiresEvaluation_v<LT> && !RequiresEvaluation_v<RT> );
+
+   static constexpr bool vectorizable =
+      ( compatible &&
+        IsRowMajorMatrix_v<LT> && IsColumnMajorMatrix_v<RT> &&
+        HasConstDataAccess_v<LT> && HasConstDataAccess_v<RT> &&
+        !IsTriangular_v<LT> && !IsTriangular_v<RT> &&
+        IsSame_v< ElementType_t<LT>, ElementType_t<RT> > &&
+        HasSIMDAdd_v< ElementType_t<LT>, ElementType_t<LT> > &&
+        HasSIMDMult_v< ElementType_t<LT>, ElementType_t<LT> > );
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compile time check for dense matrix multiplications suited for the SDDMM kernels.
+// \ingroup sparse_matrix
+//
+// This variable template evaluates to \a true in case the given type \a MT is a dense matrix
+// multiplication expression whose two operands are dense matrices that do not require an
+// intermediate evaluation. In this case a Schur product between a sparse matrix and \a MT can
+// be computed as a sampled dense-dense matrix multiplication (SDDMM), i.e. the multiplication
+// is only evaluated at the positions of the non-zero elements of the sparse matrix. Otherwise
+// it evaluates to \a false.
+*/
+template< typename MT >
+constexpr bool IsSDDMMCompatible_v = SDDMMHelper<MT>::compatible;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compile time check for dense matrix multiplications suited for the vectorized SDDMM
+//        kernel.
+// \ingroup sparse_matrix
+//
+// This variable template evaluates to \a true in case the given SDDMM compatible dense matrix
+// multiplication \a MT has a row-major left-hand side operand and a column-major right-hand side
+// operand (as for instance \f$ A*B^T \f$ with two row-major matrices \a A and \a B), both
+// operands provide direct access to their data, are not declared triangular, have the same
+// element type, and the element type supports vectorized additions and multiplications. In this
+// case all inner products are computed on contiguous memory. Otherwise it evaluates to \a false.
+*/
+template< typename MT >
+constexpr bool IsSDDMMVectorizable_v = SDDMMHelper<MT>::vectorizable;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SAMPLED DENSE MATRIX MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compute kernel for the inner product of two contiguous dense vectors.
+// \ingroup sparse_matrix
+//
+// \param a Pointer to the first element of the first dense vector.
+// \param b Pointer to the first element of the second dense vector.
+// \param n The number of elements of the two dense vectors.
+// \return The result of the inner product.
+//
+// This function uses four independent SIMD accumulators in order to hide the latency of the
+// vectorized multiply-add operations. The remaining elements are handled by a scalar loop.
+*/
+template< typename Type >  // Data type of the vector elements
+inline Type sddmmDot( const Type* a, const Type* b, size_t n ) noexcept
+{
+   using SIMDType = SIMDTrait_t<Type>;
+
+   constexpr size_t SIMDSIZE( SIMDType::size );
+
+   SIMDType xmm1, xmm2, xmm3, xmm4;
+   size_t k( 0UL );
+
+   for( ; (k+SIMDSIZE*4UL) <= n; k+=SIMDSIZE*4UL ) {
+      xmm1 = xmm1 + loadu( a+k             ) * loadu( b+k             );
+      xmm2 = xmm2 + loadu( a+k+SIMDSIZE    ) * loadu( b+k+SIMDSIZE    );
+      xmm3 = xmm3 + loadu( a+k+SIMDSIZE*2UL ) * loadu( b+k+SIMDSIZE*2UL );
+      xmm4 = xmm4 + loadu( a+k+SIMDSIZE*3UL ) * loadu( b+k+SIMDSIZE*3UL );
+   }
+
+   for( ; (k+SIMDSIZE) <= n; k+=SIMDSIZE ) {
+      xmm1 = xmm1 + loadu( a+k ) * loadu( b+k );
+   }
+
+   Type value( sum( ( xmm1 + xmm2 ) + ( xmm3 + xmm4 ) ) );
+
+   for( ; k<n; ++k ) {
+      value += a[k] * b[k];
+   }
+
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Estimates the costs for computing a single element of an SDDMM compatible dense matrix
+//        multiplication.
+// \ingroup sparse_matrix
+//
+// \param P The dense matrix multiplication.
+// \return The inner dimension of the dense matrix multiplication.
+*/
+template< typename MT >  // Type of the dense matrix
+inline auto sddmmCosts( const MT& P )
+   -> EnableIf_t< IsSDDMMCompatible_v<MT>, size_t >
+{
+   return P.leftOperand().columns();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Estimates the costs for accessing a single element of a general dense matrix.
+// \ingroup sparse_matrix
+//
+// \param P The dense matrix.
+// \return 1.
+*/
+template< typename MT >  // Type of the dense matrix
+inline auto sddmmCosts( const MT& P )
+   -> DisableIf_t< IsSDDMMCompatible_v<MT>, size_t >
+{
+   MAYBE_UNUSED( P );
+
+   return 1UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default SDDMM kernel for a range of rows/columns of a compressed matrix
+//        (\f$ C_{ij}*=(A*B)_{ij} \f$ for all non-zero elements \f$ C_{ij} \f$).
+// \ingroup sparse_matrix
+//
+// \param C The target compressed matrix.
+// \param P The dense matrix multiplication to be sampled.
+// \param first The first row/column of the range.
+// \param last One past the last row/column of the range.
+// \return void
+//
+// This function scales all non-zero elements of the rows (in case of a row-major matrix) or
+// columns (in case of a column-major matrix) \f$[first..last)\f$ of \a C by the according
+// elements of the dense matrix multiplication \a P. Each element of \a P is computed via the
+// function call operator of the multiplication expression.
+*/
+template< typename MT1    // Type of the target compressed matrix
+        , typename MT2 >  // Type of the dense matrix multiplication
+inline auto sddmm( MT1& C, const MT2& P, size_t first, size_t last )
+   -> DisableIf_t< IsSDDMMVectorizable_v<MT2> >
+{
+   BLAZE_INTERNAL_ASSERT( C.rows()    == P.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( C.columns() == P.columns(), "Invalid number of columns" );
+
+   constexpr bool SO( IsColumnMajorMatrix_v<MT1> );
+
+   for( size_t i=first; i<last; ++i ) {
+      const auto end( C.end(i) );
+      for( auto element=C.begin(i); element!=end; ++element ) {
+         element->value() *= ( SO ? P(element->index(),i) : P(i,element->index()) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized SDDMM kernel for a range of rows/columns of a compressed matrix
+//        (\f$ C_{ij}*=(A*B)_{ij} \f$ for all non-zero elements \f$ C_{ij} \f$).
+// \ingroup sparse_matrix
+//
+// \param C The target compressed matrix.
+// \param P The dense matrix multiplication to be sampled.
+// \param first The first row/column of the range.
+// \param last One past the last row/column of the range.
+// \return void
+//
+// This function scales all non-zero elements of the rows (in case of a row-major matrix) or
+// columns (in case of a column-major matrix) \f$[first..last)\f$ of \a C by the according
+// elements of the dense matrix multiplication \a P. Since the rows of the left-hand side
+// operand and the columns of the right-hand side operand of \a P are contiguous in memory,
+// all inner products are computed by means of the vectorized sddmmDot() kernel. The row (or
+// column) of the operand associated with the current row (or column) of \a C is reused for
+// all its non-zero elements.
+*/
+template< typename MT1    // Type of the target compressed matrix
+        , typename MT2 >  // Type of the dense matrix multiplication
+inline auto sddmm( MT1& C, const MT2& P, size_t first, size_t last )
+   -> EnableIf_t< IsSDDMMVectorizable_v<MT2> >
+{
+   BLAZE_INTERNAL_ASSERT( C.rows()    == P.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( C.columns() == P.columns(), "Invalid number of columns" );
+
+   constexpr bool SO( IsColumnMajorMatrix_v<MT1> );
+
+   decltype(auto) A( P.leftOperand()  );
+   decltype(auto) B( P.rightOperand() );
+
+   const size_t n( A.columns() );
+
+   const auto* const a( A.data() );
+   const auto* const b( B.data() );
+   const size_t lda( A.spacing() );
+   const size_t ldb( B.spacing() );
+
+   for( size_t i=first; i<last; ++i )
+   {
+      const auto end( C.end(i) );
+
+      if( SO ) {
+         const auto* const bj( b + i*ldb );
+         for( auto element=C.begin(i); element!=end; ++element ) {
+            element->value() *= sddmmDot( a + element->index()*lda, bj, n );
+         }
+      }
+      else {
+         const auto* const ai( a + i*lda );
+         for( auto element=C.begin(i); element!=end; ++element ) {
+            element->value() *= sddmmDot( ai, b + element->index()*ldb, n );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sampled dense matrix multiplication (\f$ C_{ij}*=(A*B)_{ij} \f$ for all non-zero
+//        elements \f$ C_{ij} \f$).
+// \ingroup sparse_matrix
+//
+// \param C The target compressed matrix.
+// \param P The dense matrix multiplication to be sampled.
+// \return void
+//
+// This function scales all non-zero elements of the compressed matrix \a C by the according
+// elements of the dense matrix multiplication \a P without evaluating \a P as a whole. In case
+// the number of non-zero elements of \a C times the inner dimension of \a P exceeds the
+// SMP_SDDMM_THRESHOLD, the rows (or columns) of \a C are split into ranges of approximately
+// equal numbers of non-zero elements, which are processed in parallel.
+*/
+template< typename MT1    // Type of the target compressed matrix
+        , typename MT2 >  // Type of the dense matrix multiplication
+inline auto sddmm( MT1& C, const MT2& P )
+   -> EnableIf_t< IsSMVMCompatible_v<MT1> >
+{
+   BLAZE_INTERNAL_ASSERT( C.rows()    == P.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( C.columns() == P.columns(), "Invalid number of columns" );
+
+   const size_t major( IsColumnMajorMatrix_v<MT1> ? C.columns() : C.rows() );
+
+   if( major == 0UL ) return;
+
+   const size_t parts( ( C.nonZeros() * sddmmCosts( P ) >= SMP_SDDMM_THRESHOLD )
+                       ? min( getNumThreads(), major ) : 1UL );
+
+   smpFor( parts, [&]( size_t part ) {
+      sddmm( C, P, smvmSplit( C, part, parts ), smvmSplit( C, part+1UL, parts ) );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sampled dense matrix multiplication (\f$ C_{ij}*=(A*B)_{ij} \f$ for all non-zero
+//        elements \f$ C_{ij} \f$).
+// \ingroup sparse_matrix
+//
+// \param C The target sparse matrix.
+// \param P The dense matrix multiplication to be sampled.
+// \return void
+//
+// This function scales all non-zero elements of the sparse matrix \a C by the according
+// elements of the dense matrix multiplication \a P without evaluating \a P as a whole. Since
+// \a C does not provide direct access to its compressed storage, the operation is performed
+// single-threaded.
+*/
+template< typename MT1    // Type of the target sparse matrix
+        , typename MT2 >  // Type of the dense matrix multiplication
+inline auto sddmm( MT1& C, const MT2& P )
+   -> DisableIf_t< IsSMVMCompatible_v<MT1> >
+{
+   sddmm( C, P, 0UL, ( IsColumnMajorMatrix_v<MT1> ? C.columns() : C.rows() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
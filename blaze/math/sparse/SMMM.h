@@ -0,0 +1,287 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SMMM.h
+//  \brief Header file for the sparse matrix/dense matrix multiplication kernels
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SMMM_H_
+#define _BLAZE_MATH_SPARSE_SMMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/sparse/SMVM.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  TYPE TRAITS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compile time check for data types suited for the SMMM kernels.
+// \ingroup sparse_matrix
+//
+// This variable template evaluates to \a true in case the given sparse matrix type \a MT2 is
+// a row-major matrix that provides direct access to its compressed storage, the dense matrix
+// types \a MT1 (the target matrix) and \a MT3 (the right-hand side operand) provide direct
+// access to their data, \a MT3 is a row-major matrix, all three element types are identical
+// and the element type supports vectorized additions and multiplications. Otherwise it
+// evaluates to \a false.
+*/
+template< typename MT1    // Type of the target dense matrix
+        , typename MT2    // Type of the left-hand side sparse matrix operand
+        , typename MT3 >  // Type of the right-hand side dense matrix operand
+constexpr bool IsSMMMCompatible_v =
+   ( IsRowMajorMatrix_v<MT2> && IsSMVMCompatible_v<MT2> &&
+     IsRowMajorMatrix_v<MT3> &&
+     IsContiguous_v<MT1> && HasMutableDataAccess_v<MT1> &&
+     IsContiguous_v<MT3> && HasConstDataAccess_v<MT3> &&
+     IsSame_v< ElementType_t<MT1>, ElementType_t<MT2> > &&
+     IsSame_v< ElementType_t<MT1>, ElementType_t<MT3> > &&
+     HasSIMDAdd_v< ElementType_t<MT1>, ElementType_t<MT1> > &&
+     HasSIMDMult_v< ElementType_t<MT1>, ElementType_t<MT1> > );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPARSE MATRIX/DENSE MATRIX MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compute kernel for a block of columns of a single row of a sparse matrix/dense matrix
+//        multiplication (\f$ C_{i,j..j+N*SIMDSIZE}=A_{i*}*B_{*,j..j+N*SIMDSIZE} \f$).
+// \ingroup sparse_matrix
+//
+// \param begin Pointer to the first non-zero element of the compressed row.
+// \param end Pointer one past the last non-zero element of the compressed row.
+// \param B Pointer to the first element of the column block of the row-major dense matrix.
+// \param ldb The spacing between two rows of the dense matrix \a B.
+// \param c Pointer to the first element of the column block of the target row.
+// \param ldc The spacing between two columns of a column-major target matrix.
+// \param op The assignment operation (plain, addition, or subtraction assignment).
+// \return void
+//
+// This function computes \a N SIMD vectors of a single row of the target matrix. The partial
+// results are kept in \a N independent SIMD registers such that each non-zero element of the
+// compressed row is loaded only once per column block.
+*/
+template< size_t N          // Number of SIMD vectors per block
+        , bool SO           // Storage order of the target matrix
+        , typename Element  // Type of the sparse elements
+        , typename Type     // Type of the dense matrix elements
+        , typename OP >     // Type of the assignment operation
+BLAZE_ALWAYS_INLINE void smmmBlock( const Element* begin, const Element* end, const Type* B,
+                                    size_t ldb, Type* c, size_t ldc, OP op )
+{
+   using SIMDType = SIMDTrait_t<Type>;
+
+   constexpr size_t SIMDSIZE( SIMDType::size );
+
+   SIMDType xmm[N];
+
+   for( ; begin!=end; ++begin )
+   {
+      const SIMDType a1( set( begin->value() ) );
+      const Type* const b( B + begin->index()*ldb );
+
+      for( size_t k=0UL; k<N; ++k ) {
+         xmm[k] = xmm[k] + a1 * loadu( b+k*SIMDSIZE );
+      }
+   }
+
+   if( SO ) {
+      for( size_t k=0UL; k<N; ++k ) {
+         for( size_t l=0UL; l<SIMDSIZE; ++l ) {
+            op( c[(k*SIMDSIZE+l)*ldc], xmm[k][l] );
+         }
+      }
+   }
+   else {
+      for( size_t k=0UL; k<N; ++k ) {
+         SIMDType tmp( loadu( c+k*SIMDSIZE ) );
+         op( tmp, xmm[k] );
+         storeu( c+k*SIMDSIZE, tmp );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compute kernel for a single row of a sparse matrix/dense matrix multiplication
+//        (\f$ C_{i*}=A_{i*}*B \f$).
+// \ingroup sparse_matrix
+//
+// \param begin Pointer to the first non-zero element of the compressed row.
+// \param end Pointer one past the last non-zero element of the compressed row.
+// \param B Pointer to the first element of the row-major dense matrix.
+// \param ldb The spacing between two rows of the dense matrix \a B.
+// \param n The number of columns of the dense matrix \a B.
+// \param c Pointer to the first element of the target row.
+// \param ldc The spacing between two columns of a column-major target matrix.
+// \param op The assignment operation (plain, addition, or subtraction assignment).
+// \return void
+//
+// This function computes a single row of the target matrix in blocks of 8, 4, 2, and 1 SIMD
+// vectors. The remaining columns are computed by means of scalar accumulators in a single
+// pass over the non-zero elements of the compressed row.
+*/
+template< bool SO           // Storage order of the target matrix
+        , typename Element  // Type of the sparse elements
+        , typename Type     // Type of the dense matrix elements
+        , typename OP >     // Type of the assignment operation
+inline void smmmRow( const Element* begin, const Element* end, const Type* B, size_t ldb,
+                     size_t n, Type* c, size_t ldc, OP op )
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   const size_t inc( SO ? ldc : 1UL );
+
+   size_t j( 0UL );
+
+   for( ; (j+SIMDSIZE*8UL) <= n; j+=SIMDSIZE*8UL ) {
+      smmmBlock<8UL,SO>( begin, end, B+j, ldb, c+j*inc, ldc, op );
+   }
+   if( (j+SIMDSIZE*4UL) <= n ) {
+      smmmBlock<4UL,SO>( begin, end, B+j, ldb, c+j*inc, ldc, op );
+      j += SIMDSIZE*4UL;
+   }
+   if( (j+SIMDSIZE*2UL) <= n ) {
+      smmmBlock<2UL,SO>( begin, end, B+j, ldb, c+j*inc, ldc, op );
+      j += SIMDSIZE*2UL;
+   }
+   if( (j+SIMDSIZE) <= n ) {
+      smmmBlock<1UL,SO>( begin, end, B+j, ldb, c+j*inc, ldc, op );
+      j += SIMDSIZE;
+   }
+
+   if( j < n )
+   {
+      const size_t rest( n - j );
+      BLAZE_INTERNAL_ASSERT( rest < SIMDSIZE, "Invalid number of remaining columns" );
+
+      Type tmp[SIMDSIZE] = {};
+
+      for( ; begin!=end; ++begin ) {
+         const Type* const b( B + begin->index()*ldb + j );
+         for( size_t l=0UL; l<rest; ++l ) {
+            tmp[l] += begin->value() * b[l];
+         }
+      }
+
+      for( size_t l=0UL; l<rest; ++l ) {
+         op( c[(j+l)*inc], tmp[l] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compute kernel for a range of rows of a sparse matrix/dense matrix multiplication
+//        (\f$ C=A*B \f$).
+// \ingroup sparse_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side row-major compressed sparse matrix.
+// \param B The right-hand side row-major dense matrix.
+// \param first The first row of the range.
+// \param last The row one past the end of the range.
+// \param op The assignment operation (plain, addition, or subtraction assignment).
+// \return void
+//
+// This function computes the rows \f$[first..last)\f$ of the sparse matrix/dense matrix
+// multiplication. In contrast to the default kernels, which stream the compressed rows once
+// for every column (block) of \a B, every non-zero element of \a A is loaded only once per
+// block of up to \f$ 8*SIMDSIZE \f$ columns of \a B. Thus this kernel is especially suited
+// for tall and skinny right-hand side matrices.
+*/
+template< typename MT1    // Type of the target dense matrix
+        , typename MT2    // Type of the left-hand side sparse matrix operand
+        , typename MT3    // Type of the right-hand side dense matrix operand
+        , typename OP >   // Type of the assignment operation
+void smmm( MT1& C, const MT2& A, const MT3& B, size_t first, size_t last, OP op )
+{
+   BLAZE_INTERNAL_ASSERT( C.rows()    == A.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( C.columns() == B.columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows()   , "Invalid matrix sizes"      );
+   BLAZE_INTERNAL_ASSERT( first <= last && last <= A.rows(), "Invalid row range" );
+
+   constexpr bool SO( IsColumnMajorMatrix_v<MT1> );
+
+   const size_t n( B.columns() );
+
+   if( n == 0UL ) return;
+
+   auto* const c( C.data() );
+   const size_t ldc( C.spacing() );
+
+   for( size_t i=first; i<last; ++i ) {
+      smmmRow<SO>( A.begin(i), A.end(i), B.data(), B.spacing(), n,
+                   c + ( SO ? i : i*ldc ), ldc, op );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,463 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SMVM.h
+//  \brief Header file for the sparse matrix/dense vector multiplication kernels
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SMVM_H_
+#define _BLAZE_MATH_SPARSE_SMVM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
+#include <blaze/util/typetraits/IsDetected.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsPointer.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  TYPE TRAITS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compile time check for sparse matrices suited for the optimized SMVM kernels.
+// \ingroup sparse_matrix
+//
+// This variable template evaluates to \a true in case the given sparse matrix type \a MT
+// provides direct access to its compressed storage (i.e. its iterators are plain pointers to
+// value-index-pairs) and its elements are of built-in data type. Otherwise it evaluates to
+// \a false.
+*/
+template< typename MT >
+constexpr bool IsSMVMCompatible_v =
+   ( IsPointer_v< typename DetectedOr< NoneSuch, ConstIterator_t, MT >::Type > &&
+     IsBuiltin_v< ElementType_t<MT> > );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Prefetches the cache line containing the given address.
+// \ingroup sparse_matrix
+//
+// \param address The address to be prefetched.
+// \return void
+*/
+BLAZE_ALWAYS_INLINE void smvmPrefetch( const void* address ) noexcept
+{
+#if BLAZE_SSE_MODE
+   _mm_prefetch( static_cast<const char*>( address ), _MM_HINT_T0 );
+#elif defined(__GNUC__)
+   __builtin_prefetch( address, 0, 3 );
+#else
+   MAYBE_UNUSED( address );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the first row/column of a non-zero balanced part of a compressed matrix.
+// \ingroup sparse_matrix
+//
+// \param A The compressed sparse matrix to be partitioned.
+// \param part The index of the part \f$[0..parts]\f$.
+// \param parts The total number of parts.
+// \return The first row/column of the given part.
+//
+// This function splits the rows (in case of a row-major matrix) or columns (in case of a
+// column-major matrix) of the given compressed matrix into \a parts consecutive ranges that
+// contain approximately the same number of non-zero elements. For \a part equal to \a parts
+// the total number of rows/columns is returned.
+*/
+template< typename MT >  // Type of the sparse matrix
+size_t smvmSplit( const MT& A, size_t part, size_t parts )
+{
+   BLAZE_INTERNAL_ASSERT( part <= parts, "Invalid part index" );
+
+   const size_t major( IsRowMajorMatrix_v<MT> ? A.rows() : A.columns() );
+
+   if( part == 0UL || major == 0UL ) return 0UL;
+   if( part >= parts ) return major;
+
+   const auto   base  ( A.begin( 0UL ) );
+   const size_t total ( A.end( major-1UL ) - base );
+   const size_t target( ( total * part ) / parts );
+
+   size_t low( 0UL ), high( major );
+
+   while( low < high ) {
+      const size_t mid( low + ( high - low ) / 2UL );
+      if( static_cast<size_t>( A.end( mid ) - base ) <= target )
+         low = mid + 1UL;
+      else
+         high = mid;
+   }
+
+   return low;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPARSE MATRIX/DENSE VECTOR MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compute kernel for the inner product of a compressed sparse row/column and a dense
+//        vector.
+// \ingroup sparse_matrix
+//
+// \param begin Pointer to the first non-zero element of the compressed row/column.
+// \param end Pointer one past the last non-zero element of the compressed row/column.
+// \param x Pointer to the first element of the dense vector.
+// \return The result of the inner product.
+//
+// This function implements the default kernel for the inner product of a compressed row or
+// column and a contiguous dense vector. The kernel uses four independent accumulators in order
+// to hide the latency of the floating point pipeline and prefetches the dense vector elements
+// that are required \a smvmPrefetchDistance non-zero elements ahead.
+*/
+template< typename Element  // Type of the sparse elements
+        , typename Type >   // Type of the dense vector elements
+BLAZE_ALWAYS_INLINE auto smvmDot( const Element* begin, const Element* end, const Type* x )
+   -> DisableIf_t< IsDouble_v<Type> && ( BLAZE_AVX2_MODE || BLAZE_AVX512F_MODE ) &&
+                   sizeof( Element ) == 2UL*sizeof( Type ) && sizeof( size_t ) == 8UL, Type >
+{
+   constexpr size_t PD( smvmPrefetchDistance );
+
+   Type s0{}, s1{}, s2{}, s3{};
+
+   if( static_cast<size_t>( end - begin ) >= 4UL )
+   {
+      if( PD > 0UL && static_cast<size_t>( end - begin ) > PD+3UL )
+      {
+         const Element* const pend( end - PD - 3UL );
+
+         for( ; begin<pend; begin+=4UL ) {
+            smvmPrefetch( x + begin[PD    ].index() );
+            smvmPrefetch( x + begin[PD+1UL].index() );
+            smvmPrefetch( x + begin[PD+2UL].index() );
+            smvmPrefetch( x + begin[PD+3UL].index() );
+            s0 += begin[0UL].value() * x[begin[0UL].index()];
+            s1 += begin[1UL].value() * x[begin[1UL].index()];
+            s2 += begin[2UL].value() * x[begin[2UL].index()];
+            s3 += begin[3UL].value() * x[begin[3UL].index()];
+         }
+      }
+
+      for( ; end-begin>=4L; begin+=4UL ) {
+         s0 += begin[0UL].value() * x[begin[0UL].index()];
+         s1 += begin[1UL].value() * x[begin[1UL].index()];
+         s2 += begin[2UL].value() * x[begin[2UL].index()];
+         s3 += begin[3UL].value() * x[begin[3UL].index()];
+      }
+   }
+
+   for( ; begin!=end; ++begin ) {
+      s0 += begin->value() * x[begin->index()];
+   }
+
+   return ( s0 + s1 ) + ( s2 + s3 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized compute kernel for the inner product of a compressed sparse row/column and
+//        a dense vector of double precision values.
+// \ingroup sparse_matrix
+//
+// \param begin Pointer to the first non-zero element of the compressed row/column.
+// \param end Pointer one past the last non-zero element of the compressed row/column.
+// \param x Pointer to the first element of the dense vector.
+// \return The result of the inner product.
+//
+// This function implements the AVX2/AVX-512 kernel for the inner product of a compressed row
+// or column and a contiguous dense vector of double precision values. Since the values and
+// indices of the compressed storage are interleaved, two consecutive SIMD loads are unpacked
+// into a vector of values and a vector of 64-bit indices, which is used to gather the required
+// elements of the dense vector. The unpacking permutes the order of the elements, which is
+// irrelevant for the accumulation. Two independent accumulators are used to hide the latency
+// of the FMA operations. Short rows/columns are handled by a scalar loop.
+*/
+template< typename Element  // Type of the sparse elements
+        , typename Type >   // Type of the dense vector elements
+BLAZE_ALWAYS_INLINE auto smvmDot( const Element* begin, const Element* end, const Type* x )
+   -> EnableIf_t< IsDouble_v<Type> && ( BLAZE_AVX2_MODE || BLAZE_AVX512F_MODE ) &&
+                  sizeof( Element ) == 2UL*sizeof( Type ) && sizeof( size_t ) == 8UL, Type >
+{
+   constexpr size_t PD( smvmPrefetchDistance );
+
+   double s( 0.0 );
+
+#if BLAZE_AVX512F_MODE
+   if( static_cast<size_t>( end - begin ) >= 16UL )
+   {
+      const __m512d zero( _mm512_setzero_pd() );
+
+      __m512d a0( zero );
+      __m512d a1( zero );
+
+      for( ; end-begin>=16L; begin+=16UL )
+      {
+         if( PD > 0UL && static_cast<size_t>( end - begin ) > PD+15UL ) {
+            for( size_t l=0UL; l<16UL; ++l )
+               smvmPrefetch( x + begin[PD+l].index() );
+         }
+
+         const double* data( reinterpret_cast<const double*>( begin ) );
+
+         const __m512d e0( _mm512_loadu_pd( data      ) );
+         const __m512d e1( _mm512_loadu_pd( data+ 8UL ) );
+         const __m512d e2( _mm512_loadu_pd( data+16UL ) );
+         const __m512d e3( _mm512_loadu_pd( data+24UL ) );
+
+         const __m512d v0( _mm512_maskz_unpacklo_pd( 0xFF, e0, e1 ) );
+         const __m512d v1( _mm512_maskz_unpacklo_pd( 0xFF, e2, e3 ) );
+         const __m512i i0( _mm512_castpd_si512( _mm512_maskz_unpackhi_pd( 0xFF, e0, e1 ) ) );
+         const __m512i i1( _mm512_castpd_si512( _mm512_maskz_unpackhi_pd( 0xFF, e2, e3 ) ) );
+
+         a0 = _mm512_fmadd_pd( v0, _mm512_mask_i64gather_pd( zero, 0xFF, i0, x, 8 ), a0 );
+         a1 = _mm512_fmadd_pd( v1, _mm512_mask_i64gather_pd( zero, 0xFF, i1, x, 8 ), a1 );
+      }
+
+      const __m512d a( _mm512_add_pd( a0, a1 ) );
+      const __m256d b( _mm256_add_pd( _mm512_maskz_extractf64x4_pd( 0xFF, a, 0 ),
+                                      _mm512_maskz_extractf64x4_pd( 0xFF, a, 1 ) ) );
+      const __m128d h( _mm_add_pd( _mm256_castpd256_pd128( b ), _mm256_extractf128_pd( b, 1 ) ) );
+      s = _mm_cvtsd_f64( _mm_add_sd( h, _mm_unpackhi_pd( h, h ) ) );
+   }
+#elif BLAZE_AVX2_MODE
+   if( static_cast<size_t>( end - begin ) >= 8UL )
+   {
+      __m256d a0( _mm256_setzero_pd() );
+      __m256d a1( _mm256_setzero_pd() );
+
+      for( ; end-begin>=8L; begin+=8UL )
+      {
+         if( PD > 0UL && static_cast<size_t>( end - begin ) > PD+7UL ) {
+            for( size_t l=0UL; l<8UL; ++l )
+               smvmPrefetch( x + begin[PD+l].index() );
+         }
+
+         const double* data( reinterpret_cast<const double*>( begin ) );
+
+         const __m256d e0( _mm256_loadu_pd( data      ) );
+         const __m256d e1( _mm256_loadu_pd( data+ 4UL ) );
+         const __m256d e2( _mm256_loadu_pd( data+ 8UL ) );
+         const __m256d e3( _mm256_loadu_pd( data+12UL ) );
+
+         const __m256d v0( _mm256_unpacklo_pd( e0, e1 ) );
+         const __m256d v1( _mm256_unpacklo_pd( e2, e3 ) );
+         const __m256i i0( _mm256_castpd_si256( _mm256_unpackhi_pd( e0, e1 ) ) );
+         const __m256i i1( _mm256_castpd_si256( _mm256_unpackhi_pd( e2, e3 ) ) );
+
+#if BLAZE_FMA_MODE
+         a0 = _mm256_fmadd_pd( v0, _mm256_i64gather_pd( x, i0, 8 ), a0 );
+         a1 = _mm256_fmadd_pd( v1, _mm256_i64gather_pd( x, i1, 8 ), a1 );
+#else
+         a0 = _mm256_add_pd( _mm256_mul_pd( v0, _mm256_i64gather_pd( x, i0, 8 ) ), a0 );
+         a1 = _mm256_add_pd( _mm256_mul_pd( v1, _mm256_i64gather_pd( x, i1, 8 ) ), a1 );
+#endif
+      }
+
+      const __m256d a( _mm256_add_pd( a0, a1 ) );
+      const __m128d h( _mm_add_pd( _mm256_castpd256_pd128( a ), _mm256_extractf128_pd( a, 1 ) ) );
+      s = _mm_cvtsd_f64( _mm_add_sd( h, _mm_unpackhi_pd( h, h ) ) );
+   }
+#else
+   MAYBE_UNUSED( PD );
+#endif
+
+   for( ; begin!=end; ++begin ) {
+      s += begin->value() * x[begin->index()];
+   }
+
+   return s;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compute kernel for the scaled scatter of a compressed sparse row/column into a dense
+//        vector (\f$ \vec{y}[A_{i*}]+=\alpha*A_{i*} \f$).
+// \ingroup sparse_matrix
+//
+// \param begin Pointer to the first non-zero element of the compressed row/column.
+// \param end Pointer one past the last non-zero element of the compressed row/column.
+// \param alpha The scaling factor for the compressed row/column.
+// \param y Pointer to the first element of the target dense vector.
+// \return void
+//
+// This function implements the default kernel for the scatter of a scaled compressed row or
+// column into a contiguous dense vector. For long rows/columns the kernel is unrolled by a
+// factor of four and prefetches the target elements that are updated \a smvmPrefetchDistance
+// non-zero elements ahead. Since the indices of a single row/column are unique, the updates
+// are independent.
+*/
+template< typename Element  // Type of the sparse elements
+        , typename Type >   // Type of the dense vector elements
+BLAZE_ALWAYS_INLINE auto smvmScatter( const Element* begin, const Element* end,
+                                      Type alpha, Type* y )
+   -> DisableIf_t< IsDouble_v<Type> && BLAZE_AVX512F_MODE &&
+                   sizeof( Element ) == 2UL*sizeof( Type ) && sizeof( size_t ) == 8UL >
+{
+   constexpr size_t PD( smvmPrefetchDistance );
+
+   if( PD > 0UL && static_cast<size_t>( end - begin ) > PD+3UL )
+   {
+      const Element* const pend( end - PD - 3UL );
+
+      for( ; begin<pend; begin+=4UL ) {
+         smvmPrefetch( y + begin[PD    ].index() );
+         smvmPrefetch( y + begin[PD+1UL].index() );
+         smvmPrefetch( y + begin[PD+2UL].index() );
+         smvmPrefetch( y + begin[PD+3UL].index() );
+         y[begin[0UL].index()] += begin[0UL].value() * alpha;
+         y[begin[1UL].index()] += begin[1UL].value() * alpha;
+         y[begin[2UL].index()] += begin[2UL].value() * alpha;
+         y[begin[3UL].index()] += begin[3UL].value() * alpha;
+      }
+   }
+
+   for( ; begin!=end; ++begin ) {
+      y[begin->index()] += begin->value() * alpha;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized compute kernel for the scaled scatter of a compressed sparse row/column into
+//        a dense vector of double precision values (\f$ \vec{y}[A_{i*}]+=\alpha*A_{i*} \f$).
+// \ingroup sparse_matrix
+//
+// \param begin Pointer to the first non-zero element of the compressed row/column.
+// \param end Pointer one past the last non-zero element of the compressed row/column.
+// \param alpha The scaling factor for the compressed row/column.
+// \param y Pointer to the first element of the target dense vector.
+// \return void
+//
+// This function implements the AVX-512 kernel for the scatter of a scaled compressed row or
+// column into a contiguous dense vector of double precision values. The target elements are
+// gathered, updated via FMA operations and scattered back. This is only possible since the
+// indices of a single row/column are unique and therefore no write conflicts can occur. Short
+// rows/columns are handled by a scalar loop.
+*/
+template< typename Element  // Type of the sparse elements
+        , typename Type >   // Type of the dense vector elements
+BLAZE_ALWAYS_INLINE auto smvmScatter( const Element* begin, const Element* end,
+                                      Type alpha, Type* y )
+   -> EnableIf_t< IsDouble_v<Type> && BLAZE_AVX512F_MODE &&
+                  sizeof( Element ) == 2UL*sizeof( Type ) && sizeof( size_t ) == 8UL >
+{
+   constexpr size_t PD( smvmPrefetchDistance );
+
+#if BLAZE_AVX512F_MODE
+   if( static_cast<size_t>( end - begin ) >= 8UL )
+   {
+      const __m512d factor( _mm512_set1_pd( alpha ) );
+      const __m512d zero( _mm512_setzero_pd() );
+
+      for( ; end-begin>=8L; begin+=8UL )
+      {
+         if( PD > 0UL && static_cast<size_t>( end - begin ) > PD+7UL ) {
+            for( size_t l=0UL; l<8UL; ++l )
+               smvmPrefetch( y + begin[PD+l].index() );
+         }
+
+         const double* data( reinterpret_cast<const double*>( begin ) );
+
+         const __m512d e0( _mm512_loadu_pd( data     ) );
+         const __m512d e1( _mm512_loadu_pd( data+8UL ) );
+         const __m512d v0( _mm512_maskz_unpacklo_pd( 0xFF, e0, e1 ) );
+         const __m512i i0( _mm512_castpd_si512( _mm512_maskz_unpackhi_pd( 0xFF, e0, e1 ) ) );
+         const __m512d y0( _mm512_mask_i64gather_pd( zero, 0xFF, i0, y, 8 ) );
+
+         _mm512_i64scatter_pd( y, i0, _mm512_fmadd_pd( v0, factor, y0 ), 8 );
+      }
+   }
+#else
+   MAYBE_UNUSED( PD );
+#endif
+
+   for( ; begin!=end; ++begin ) {
+      y[begin->index()] += begin->value() * alpha;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1594 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/Semiring.h
+//  \brief Header file for the semiring multiplications of sparse matrices
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SEMIRING_H_
+#define _BLAZE_MATH_SPARSE_SEMIRING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/constraints/SparseMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/And.h>
+#include <blaze/math/functors/Max.h>
+#include <blaze/math/functors/Min.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/math/functors/Or.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/SMVM.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/IsDenseVector.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsMatrix.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveCVRef.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SEMIRINGS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The conventional \f$ (+,\times) \f$ semiring.
+// \ingroup compressed_matrix
+//
+// The PlusTimes semiring represents the conventional arithmetic of a matrix multiplication.
+// Its additive identity is the default value (i.e. zero) of the element type.
+*/
+struct PlusTimes
+{
+   using AddOp  = Add;   //!< The additive operation of the semiring.
+   using MultOp = Mult;  //!< The multiplicative operation of the semiring.
+
+   //**********************************************************************************************
+   /*!\brief Returns the additive identity of the semiring for the given element type.
+   //
+   // \return The additive identity of the semiring.
+   */
+   template< typename T >
+   static constexpr T zero() { return T(); }
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The tropical \f$ (\min,+) \f$ semiring.
+// \ingroup compressed_matrix
+//
+// The MinPlus semiring is used for shortest path computations. Its additive identity is
+// positive infinity (or the largest representable value in case the element type cannot
+// represent infinity).
+*/
+struct MinPlus
+{
+   using AddOp  = Min;  //!< The additive operation of the semiring.
+   using MultOp = Add;  //!< The multiplicative operation of the semiring.
+
+   //**********************************************************************************************
+   /*!\brief Returns the additive identity of the semiring for the given element type.
+   //
+   // \return The additive identity of the semiring.
+   */
+   template< typename T >
+   static constexpr T zero() {
+      return std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                  : std::numeric_limits<T>::max();
+   }
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The tropical \f$ (\max,+) \f$ semiring.
+// \ingroup compressed_matrix
+//
+// The MaxPlus semiring is used for longest (critical) path computations. Its additive identity
+// is negative infinity (or the lowest representable value in case the element type cannot
+// represent infinity).
+*/
+struct MaxPlus
+{
+   using AddOp  = Max;  //!< The additive operation of the semiring.
+   using MultOp = Add;  //!< The multiplicative operation of the semiring.
+
+   //**********************************************************************************************
+   /*!\brief Returns the additive identity of the semiring for the given element type.
+   //
+   // \return The additive identity of the semiring.
+   */
+   template< typename T >
+   static constexpr T zero() {
+      return std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity()
+                                                  : std::numeric_limits<T>::lowest();
+   }
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The bottleneck \f$ (\max,\min) \f$ semiring.
+// \ingroup compressed_matrix
+//
+// The MaxMin semiring is used for widest path (maximum capacity) computations. Its additive
+// identity is negative infinity (or the lowest representable value in case the element type
+// cannot represent infinity).
+*/
+struct MaxMin
+{
+   using AddOp  = Max;  //!< The additive operation of the semiring.
+   using MultOp = Min;  //!< The multiplicative operation of the semiring.
+
+   //**********************************************************************************************
+   /*!\brief Returns the additive identity of the semiring for the given element type.
+   //
+   // \return The additive identity of the semiring.
+   */
+   template< typename T >
+   static constexpr T zero() {
+      return std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity()
+                                                  : std::numeric_limits<T>::lowest();
+   }
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The Boolean \f$ (\lor,\land) \f$ semiring.
+// \ingroup compressed_matrix
+//
+// The OrAnd semiring is used for reachability computations as for instance a breadth-first
+// search. Its additive identity is \a false.
+*/
+struct OrAnd
+{
+   using AddOp  = Or;   //!< The additive operation of the semiring.
+   using MultOp = And;  //!< The multiplicative operation of the semiring.
+
+   //**********************************************************************************************
+   /*!\brief Returns the additive identity of the semiring for the given element type.
+   //
+   // \return The additive identity of the semiring.
+   */
+   template< typename T >
+   static constexpr T zero() { return T( false ); }
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MASKS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Wrapper for a complemented output mask of a semiring multiplication.
+// \ingroup compressed_matrix
+//
+// The Complement class template represents the complement of an output mask of a semiring
+// multiplication, i.e. all elements that are not selected by the given mask are computed. It
+// is created by the complement() function and is passed to one of the mult() functions.
+// Analogous to the operands of expression templates, mask expressions (as for instance the
+// result of the map() function) are stored by value, whereas vectors and matrices are stored
+// by reference.
+*/
+template< typename T >  // Type of the mask
+class Complement
+{
+ public:
+   //**Type definitions****************************************************************************
+   //! Composite type of the mask.
+   using Operand = If_t< IsExpression_v<T>, const T, const T& >;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Constructor for the Complement class template.
+   //
+   // \param mask The mask to be complemented.
+   */
+   explicit inline Complement( const T& mask ) noexcept
+      : mask_( mask )  // The complemented mask
+   {}
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the complemented mask.
+   //
+   // \return The complemented mask.
+   */
+   inline Operand operand() const noexcept { return mask_; }
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   Operand mask_;  //!< The complemented mask.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Complements the given dense vector mask of a semiring multiplication.
+// \ingroup compressed_matrix
+//
+// \param mask The dense vector mask to be complemented.
+// \return The complemented mask.
+*/
+template< typename VT >  // Type of the dense vector mask
+inline Complement<VT> complement( const DenseVector<VT,false>& mask ) noexcept
+{
+   return Complement<VT>( *mask );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Complements the given sparse matrix mask of a semiring multiplication.
+// \ingroup compressed_matrix
+//
+// \param mask The sparse matrix mask to be complemented.
+// \return The complemented mask.
+*/
+template< typename MT  // Type of the sparse matrix mask
+        , bool SO >    // Storage order of the sparse matrix mask
+inline Complement<MT> complement( const SparseMatrix<MT,SO>& mask ) noexcept
+{
+   return Complement<MT>( *mask );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Placeholder for a missing output mask of a semiring multiplication.
+// \ingroup compressed_matrix
+*/
+struct SemiringNoMask
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Resulting element type of a semiring multiplication.
+// \ingroup compressed_matrix
+//
+// This type alias represents the element type that results from the multiplicative and the
+// additive operation of the semiring \a SR applied to elements of type \a T1 and \a T2.
+*/
+template< typename SR     // Type of the semiring
+        , typename T1     // Type of the left-hand side elements
+        , typename T2 >   // Type of the right-hand side elements
+using SemiringElement_t =
+   RemoveCVRef_t< decltype( std::declval<typename SR::AddOp>()(
+      std::declval< RemoveCVRef_t< decltype( std::declval<typename SR::MultOp>()(
+         std::declval<T1>(), std::declval<T2>() ) ) > >(),
+      std::declval< RemoveCVRef_t< decltype( std::declval<typename SR::MultOp>()(
+         std::declval<T1>(), std::declval<T2>() ) ) > >() ) ) >;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the given element is selected by a missing output mask.
+// \ingroup compressed_matrix
+//
+// \return \a true.
+*/
+template< bool CM >  // Complement flag
+inline bool semiringSelect( const SemiringNoMask&, size_t ) noexcept
+{
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the given element is selected by a dense vector output mask.
+// \ingroup compressed_matrix
+//
+// \param mask The dense vector output mask.
+// \param i The index of the element.
+// \return \a true in case the element is selected, \a false if not.
+//
+// An element is selected by a dense vector mask in case the according element of the mask is
+// not a default value (i.e. not zero or \a false). In case \a CM is set to \a true the mask is
+// complemented.
+*/
+template< bool CM          // Complement flag
+        , typename VT >    // Type of the dense vector mask
+inline bool semiringSelect( const VT& mask, size_t i )
+{
+   return isDefault( mask[i] ) == CM;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the first row/column of a non-zero balanced part of a compressed matrix.
+// \ingroup compressed_matrix
+//
+// \param A The compressed sparse matrix to be partitioned.
+// \param part The index of the part \f$[0..parts]\f$.
+// \param parts The total number of parts.
+// \return The first row/column of the given part.
+*/
+template< typename MT >  // Type of the sparse matrix
+inline auto semiringSplit( const MT& A, size_t part, size_t parts )
+   -> EnableIf_t< IsSMVMCompatible_v<MT>, size_t >
+{
+   return smvmSplit( A, part, parts );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the first row/column of an equally sized part of a sparse matrix.
+// \ingroup compressed_matrix
+//
+// \param A The sparse matrix to be partitioned.
+// \param part The index of the part \f$[0..parts]\f$.
+// \param parts The total number of parts.
+// \return The first row/column of the given part.
+//
+// This function is used for sparse matrices that don't provide direct access to their
+// compressed storage.
+*/
+template< typename MT >  // Type of the sparse matrix
+inline auto semiringSplit( const MT& A, size_t part, size_t parts )
+   -> DisableIf_t< IsSMVMCompatible_v<MT>, size_t >
+{
+   const size_t major( IsRowMajorMatrix_v<MT> ? A.rows() : A.columns() );
+
+   return ( part >= parts ) ? major : ( major * part ) / parts;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scatters a single scaled column of a column-major sparse matrix.
+// \ingroup compressed_matrix
+//
+// \param tmp The dense accumulator.
+// \param A The column-major sparse matrix.
+// \param j The index of the column.
+// \param xj The scaling factor of the column.
+// \return void
+//
+// Scaling factors that are equal to the additive identity of the semiring are skipped.
+*/
+template< typename SR     // Type of the semiring
+        , typename VT     // Type of the dense accumulator
+        , typename MT     // Type of the sparse matrix
+        , typename ET >   // Type of the scaling factor
+void semiringScatter( VT& tmp, const MT& A, size_t j, const ET& xj )
+{
+   const typename SR::AddOp  add {};
+   const typename SR::MultOp mult{};
+
+   if( xj == SR::template zero<ET>() ) return;
+
+   const auto end( A.end(j) );
+   for( auto element=A.begin(j); element!=end; ++element ) {
+      const size_t i( element->index() );
+      tmp[i] = add( tmp[i], mult( element->value(), xj ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scatters the columns of a column-major sparse matrix selected by a dense vector.
+// \ingroup compressed_matrix
+//
+// \param tmp The dense accumulator.
+// \param A The column-major sparse matrix.
+// \param x The dense vector.
+// \return void
+*/
+template< typename SR     // Type of the semiring
+        , typename VT1    // Type of the dense accumulator
+        , typename MT     // Type of the sparse matrix
+        , typename VT2 >  // Type of the dense vector
+auto semiringScatter( VT1& tmp, const MT& A, const VT2& x )
+   -> EnableIf_t< IsDenseVector_v<VT2> >
+{
+   for( size_t j=0UL; j<x.size(); ++j ) {
+      semiringScatter<SR>( tmp, A, j, x[j] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scatters the columns of a column-major sparse matrix selected by a sparse vector.
+// \ingroup compressed_matrix
+//
+// \param tmp The dense accumulator.
+// \param A The column-major sparse matrix.
+// \param x The sparse vector.
+// \return void
+*/
+template< typename SR     // Type of the semiring
+        , typename VT1    // Type of the dense accumulator
+        , typename MT     // Type of the sparse matrix
+        , typename VT2 >  // Type of the sparse vector
+auto semiringScatter( VT1& tmp, const MT& A, const VT2& x )
+   -> DisableIf_t< IsDenseVector_v<VT2> >
+{
+   const auto end( x.end() );
+   for( auto element=x.begin(); element!=end; ++element ) {
+      semiringScatter<SR>( tmp, A, element->index(), element->value() );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//=================================================================================================
+//
+//  SPARSE MATRIX/VECTOR SEMIRING MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Semiring multiplication kernel for a range of rows of a row-major sparse matrix and a
+//        dense vector.
+// \ingroup compressed_matrix
+//
+// \param y The target dense vector.
+// \param A The row-major sparse matrix.
+// \param x The dense vector.
+// \param mask The output mask.
+// \param first The first row of the range.
+// \param last One past the last row of the range.
+// \return void
+//
+// This kernel computes the selected elements of the range \f$[first..last)\f$ of \a y as the
+// semiring inner product of the according row of \a A and \a x (pull direction). Elements of
+// \a x that are equal to the additive identity of the semiring are skipped.
+*/
+template< typename SR     // Type of the semiring
+        , bool CM         // Complement flag
+        , typename VT1    // Type of the target dense vector
+        , typename MT     // Type of the sparse matrix
+        , typename VT2    // Type of the dense vector
+        , typename VT3 >  // Type of the output mask
+void smvmSemiring( VT1& y, const MT& A, const VT2& x, const VT3& mask,
+                   size_t first, size_t last )
+{
+   using ET1 = ElementType_t<VT1>;
+   using ET2 = ElementType_t<VT2>;
+
+   const typename SR::AddOp  add {};
+   const typename SR::MultOp mult{};
+
+   const ET2 xzero( SR::template zero<ET2>() );
+
+   for( size_t i=first; i<last; ++i )
+   {
+      if( !semiringSelect<CM>( mask, i ) ) continue;
+
+      ET1 acc( SR::template zero<ET1>() );
+
+      const auto end( A.end(i) );
+      for( auto element=A.begin(i); element!=end; ++element ) {
+         const ET2& xj( x[element->index()] );
+         if( xj == xzero ) continue;
+         acc = add( acc, mult( element->value(), xj ) );
+      }
+
+      y[i] = acc;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Semiring multiplication of a row-major sparse matrix and a dense vector
+//        (\f$ \vec{y}=A\oplus.\otimes\vec{x} \f$).
+// \ingroup compressed_matrix
+//
+// \param y The target dense vector.
+// \param A The row-major sparse matrix.
+// \param x The dense vector.
+// \param mask The output mask.
+// \return void
+//
+// In case the number of non-zero elements of \a A exceeds the SMP_SEMIRINGMULT_THRESHOLD, the
+// rows of \a A are split into ranges of approximately equal numbers of non-zero elements (or
+// of equal numbers of rows in case \a A does not provide direct access to its compressed
+// storage), which are processed in parallel.
+*/
+template< typename SR     // Type of the semiring
+        , bool CM         // Complement flag
+        , typename VT1    // Type of the target dense vector
+        , typename MT     // Type of the sparse matrix
+        , typename VT2    // Type of the dense vector
+        , typename VT3 >  // Type of the output mask
+auto semiringMult( VT1& y, const MT& A, const VT2& x, const VT3& mask )
+   -> EnableIf_t< IsRowMajorMatrix_v<MT> && IsDenseVector_v<VT2> >
+{
+   const size_t m( A.rows() );
+
+   if( m == 0UL ) return;
+
+   const size_t parts( ( A.nonZeros() >= SMP_SEMIRINGMULT_THRESHOLD )
+                       ? min( getNumThreads(), m ) : 1UL );
+
+   smpFor( parts, [&]( size_t part ) {
+      smvmSemiring<SR,CM>( y, A, x, mask, semiringSplit( A, part, parts ),
+                          semiringSplit( A, part+1UL, parts ) );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Semiring multiplication of a row-major sparse matrix and a sparse vector
+//        (\f$ \vec{y}=A\oplus.\otimes\vec{x} \f$).
+// \ingroup compressed_matrix
+//
+// \param y The target dense vector.
+// \param A The row-major sparse matrix.
+// \param x The sparse vector.
+// \param mask The output mask.
+// \return void
+//
+// The sparse vector is scattered into a dense vector, whose remaining elements are initialized
+// with the additive identity of the semiring.
+*/
+template< typename SR     // Type of the semiring
+        , bool CM         // Complement flag
+        , typename VT1    // Type of the target dense vector
+        , typename MT     // Type of the sparse matrix
+        , typename VT2    // Type of the sparse vector
+        , typename VT3 >  // Type of the output mask
+auto semiringMult( VT1& y, const MT& A, const VT2& x, const VT3& mask )
+   -> EnableIf_t< IsRowMajorMatrix_v<MT> && !IsDenseVector_v<VT2> >
+{
+   using ET2 = ElementType_t<VT2>;
+
+   DynamicVector<ET2> tmp( x.size(), SR::template zero<ET2>() );
+
+   const auto end( x.end() );
+   for( auto element=x.begin(); element!=end; ++element ) {
+      tmp[element->index()] = element->value();
+   }
+
+   semiringMult<SR,CM>( y, A, tmp, mask );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Semiring multiplication of a column-major sparse matrix and a vector
+//        (\f$ \vec{y}=A\oplus.\otimes\vec{x} \f$).
+// \ingroup compressed_matrix
+//
+// \param y The target dense vector.
+// \param A The column-major sparse matrix.
+// \param x The dense or sparse vector.
+// \param mask The output mask.
+// \return void
+//
+// This kernel scatters the columns of \a A that belong to the non-zero elements of \a x into
+// a temporary accumulator (push direction). In case \a x is a sparse vector only the columns
+// of its non-zero elements are visited. Due to the scattered updates this kernel is executed
+// single-threaded.
+*/
+template< typename SR     // Type of the semiring
+        , bool CM         // Complement flag
+        , typename VT1    // Type of the target dense vector
+        , typename MT     // Type of the sparse matrix
+        , typename VT2    // Type of the vector
+        , typename VT3 >  // Type of the output mask
+auto semiringMult( VT1& y, const MT& A, const VT2& x, const VT3& mask )
+   -> DisableIf_t< IsRowMajorMatrix_v<MT> >
+{
+   using ET1 = ElementType_t<VT1>;
+
+   DynamicVector<ET1> tmp( A.rows(), SR::template zero<ET1>() );
+
+   semiringScatter<SR>( tmp, A, x );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      if( semiringSelect<CM>( mask, i ) )
+         y[i] = tmp[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPARSE MATRIX/SPARSE MATRIX SEMIRING MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Result of a range of rows of a sparse matrix/sparse matrix semiring multiplication.
+// \ingroup compressed_matrix
+*/
+template< typename Type >  // Data type of the elements
+struct SemiringRows
+{
+   std::vector<size_t> nonzeros;  //!< The number of non-zero elements per row.
+   std::vector<size_t> indices;   //!< The column indices of the non-zero elements.
+   std::vector<Type>   values;    //!< The values of the non-zero elements.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Marks the non-zero elements of a row of a missing output mask.
+// \ingroup compressed_matrix
+//
+// \return void
+*/
+inline void semiringMark( std::vector<size_t>&, const SemiringNoMask&, size_t, size_t ) noexcept
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Marks the non-zero elements of a row of a sparse matrix output mask.
+// \ingroup compressed_matrix
+//
+// \param marks The marks of all columns.
+// \param mask The row-major sparse matrix output mask.
+// \param i The index of the row.
+// \param stamp The stamp of the current row.
+// \return void
+*/
+template< typename MT >  // Type of the sparse matrix mask
+inline void semiringMark( std::vector<size_t>& marks, const MT& mask, size_t i, size_t stamp )
+{
+   const auto end( mask.end(i) );
+   for( auto element=mask.begin(i); element!=end; ++element ) {
+      marks[element->index()] = stamp;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Semiring multiplication kernel for a range of rows of two row-major sparse matrices
+//        with a sparse matrix output mask.
+// \ingroup compressed_matrix
+//
+// \param rows The resulting rows.
+// \param A The left-hand side row-major sparse matrix.
+// \param B The right-hand side row-major sparse matrix.
+// \param mask The row-major sparse matrix output mask.
+// \param first The first row of the range.
+// \param last One past the last row of the range.
+// \return void
+//
+// This kernel implements Gustavson's algorithm with a dense accumulator. Only the elements
+// selected by the mask are accumulated and rows with an empty mask row are skipped. Since the
+// resulting elements are collected in the order of the mask, no sorting is required.
+*/
+template< typename SR     // Type of the semiring
+        , bool CM         // Complement flag
+        , typename Type   // Data type of the resulting elements
+        , typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2    // Type of the right-hand side sparse matrix
+        , typename MT3 >  // Type of the output mask
+auto smmmSemiring( SemiringRows<Type>& rows, const MT1& A, const MT2& B, const MT3& mask,
+                   size_t first, size_t last )
+   -> EnableIf_t< !CM >
+{
+   const typename SR::AddOp  add {};
+   const typename SR::MultOp mult{};
+
+   const size_t n( B.columns() );
+
+   std::vector<size_t> marks( n, 0UL );
+   std::vector<size_t> hits ( n, 0UL );
+   DynamicVector<Type> acc  ( n );
+
+   for( size_t i=first; i<last; ++i )
+   {
+      const size_t stamp( i+1UL );
+      size_t nonzeros( 0UL );
+
+      if( mask.begin(i) != mask.end(i) )
+      {
+         semiringMark( marks, mask, i, stamp );
+
+         const auto aend( A.end(i) );
+         for( auto a=A.begin(i); a!=aend; ++a )
+         {
+            const size_t k( a->index() );
+            const auto bend( B.end(k) );
+
+            for( auto b=B.begin(k); b!=bend; ++b )
+            {
+               const size_t j( b->index() );
+
+               if( marks[j] != stamp ) continue;
+
+               if( hits[j] != stamp ) {
+                  hits[j] = stamp;
+                  acc[j]  = mult( a->value(), b->value() );
+               }
+               else {
+                  acc[j] = add( acc[j], mult( a->value(), b->value() ) );
+               }
+            }
+         }
+
+         const auto mend( mask.end(i) );
+         for( auto element=mask.begin(i); element!=mend; ++element ) {
+            const size_t j( element->index() );
+            if( hits[j] == stamp ) {
+               rows.indices.push_back( j );
+               rows.values.push_back( acc[j] );
+               ++nonzeros;
+            }
+         }
+      }
+
+      rows.nonzeros.push_back( nonzeros );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Semiring multiplication kernel for a range of rows of two row-major sparse matrices
+//        without or with a complemented output mask.
+// \ingroup compressed_matrix
+//
+// \param rows The resulting rows.
+// \param A The left-hand side row-major sparse matrix.
+// \param B The right-hand side row-major sparse matrix.
+// \param mask The row-major sparse matrix output mask to be complemented (or no mask).
+// \param first The first row of the range.
+// \param last One past the last row of the range.
+// \return void
+//
+// This kernel implements Gustavson's algorithm with a dense accumulator. Elements selected by
+// the (complemented) mask are skipped. The column indices of each resulting row are sorted.
+*/
+template< typename SR     // Type of the semiring
+        , bool CM         // Complement flag
+        , typename Type   // Data type of the resulting elements
+        , typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2    // Type of the right-hand side sparse matrix
+        , typename MT3 >  // Type of the output mask
+auto smmmSemiring( SemiringRows<Type>& rows, const MT1& A, const MT2& B, const MT3& mask,
+                   size_t first, size_t last )
+   -> EnableIf_t< CM >
+{
+   const typename SR::AddOp  add {};
+   const typename SR::MultOp mult{};
+
+   const size_t n( B.columns() );
+
+   std::vector<size_t> marks( n, 0UL );
+   std::vector<size_t> hits ( n, 0UL );
+   DynamicVector<Type> acc  ( n );
+   std::vector<size_t> columns;
+
+   for( size_t i=first; i<last; ++i )
+   {
+      const size_t stamp( i+1UL );
+
+      semiringMark( marks, mask, i, stamp );
+
+      columns.clear();
+
+      const auto aend( A.end(i) );
+      for( auto a=A.begin(i); a!=aend; ++a )
+      {
+         const size_t k( a->index() );
+         const auto bend( B.end(k) );
+
+         for( auto b=B.begin(k); b!=bend; ++b )
+         {
+            const size_t j( b->index() );
+
+            if( marks[j] == stamp ) continue;
+
+            if( hits[j] != stamp ) {
+               hits[j] = stamp;
+               acc[j]  = mult( a->value(), b->value() );
+               columns.push_back( j );
+            }
+            else {
+               acc[j] = add( acc[j], mult( a->value(), b->value() ) );
+            }
+         }
+      }
+
+      std::sort( columns.begin(), columns.end() );
+
+      for( size_t j : columns ) {
+         rows.indices.push_back( j );
+         rows.values.push_back( acc[j] );
+      }
+
+      rows.nonzeros.push_back( columns.size() );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Semiring multiplication of two row-major sparse matrices
+//        (\f$ C=A\oplus.\otimes B \f$).
+// \ingroup compressed_matrix
+//
+// \param C The target row-major sparse matrix.
+// \param A The left-hand side row-major sparse matrix.
+// \param B The right-hand side row-major sparse matrix.
+// \param mask The row-major sparse matrix output mask (or no mask).
+// \return void
+//
+// In case the number of required multiply-add operations exceeds the SMP_SEMIRINGMULT_THRESHOLD,
+// the rows of \a A are split into ranges of approximately equal numbers of multiply-add
+// operations, which are processed in parallel. The resulting rows are collected per range and
+// appended to the target matrix only after all ranges have been computed.
+*/
+template< typename SR     // Type of the semiring
+        , bool CM         // Complement flag
+        , typename MT1    // Type of the target sparse matrix
+        , typename MT2    // Type of the left-hand side sparse matrix
+        , typename MT3    // Type of the right-hand side sparse matrix
+        , typename MT4 >  // Type of the output mask
+void smmmSemiring( MT1& C, const MT2& A, const MT3& B, const MT4& mask )
+{
+   using ET = ElementType_t<MT1>;
+
+   const size_t m( A.rows() );
+
+   std::vector<size_t> work( m+1UL, 0UL );
+   for( size_t i=0UL; i<m; ++i ) {
+      size_t ops( 0UL );
+      const auto end( A.end(i) );
+      for( auto element=A.begin(i); element!=end; ++element ) {
+         ops += B.nonZeros( element->index() );
+      }
+      work[i+1UL] = work[i] + ops;
+   }
+
+   const size_t parts( ( work[m] >= SMP_SEMIRINGMULT_THRESHOLD && m > 0UL )
+                       ? min( getNumThreads(), m ) : 1UL );
+
+   std::vector<size_t> bounds( parts+1UL, m );
+   for( size_t part=0UL; part<parts; ++part ) {
+      const size_t target( ( work[m] * part ) / parts );
+      bounds[part] = std::lower_bound( work.begin(), work.begin()+m, target ) - work.begin();
+   }
+
+   std::vector< SemiringRows<ET> > results( parts );
+
+   smpFor( parts, [&]( size_t part ) {
+      smmmSemiring<SR,CM>( results[part], A, B, mask, bounds[part], bounds[part+1UL] );
+   } );
+
+   size_t nonzeros( 0UL );
+   for( const auto& rows : results ) {
+      nonzeros += rows.values.size();
+   }
+
+   resize( C, m, B.columns(), false );
+   C.reset();
+   C.reserve( nonzeros );
+
+   size_t i( 0UL );
+
+   for( const auto& rows : results )
+   {
+      size_t pos( 0UL );
+
+      for( size_t count : rows.nonzeros ) {
+         for( const size_t end( pos+count ); pos<end; ++pos ) {
+            C.append( i, rows.indices[pos], rows.values[pos] );
+         }
+         C.finalize( i );
+         ++i;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the row-major evaluation of the operands of a sparse
+//        matrix/sparse matrix semiring multiplication.
+// \ingroup compressed_matrix
+*/
+template< typename MT, typename = void >
+struct SemiringOperand
+{
+   using Type = const MT&;
+};
+
+template< typename MT >
+struct SemiringOperand< MT, EnableIf_t< IsMatrix_v<MT> > >
+{
+   using Type = If_t< IsRowMajorMatrix_v<MT>
+                    , CompositeType_t<MT>
+                    , const OppositeType_t< ResultType_t<MT> > >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Semiring multiplication of two sparse matrices with a row-major target matrix
+//        (\f$ C=A\oplus.\otimes B \f$).
+// \ingroup compressed_matrix
+//
+// \param C The target row-major sparse matrix.
+// \param A The left-hand side sparse matrix.
+// \param B The right-hand side sparse matrix.
+// \param mask The sparse matrix output mask (or no mask).
+// \return void
+//
+// Column-major operands are converted to row-major matrices before the multiplication.
+*/
+template< typename SR     // Type of the semiring
+        , bool CM         // Complement flag
+        , typename MT1    // Type of the target sparse matrix
+        , typename MT2    // Type of the left-hand side sparse matrix
+        , typename MT3    // Type of the right-hand side sparse matrix
+        , typename MT4 >  // Type of the output mask
+auto smmmSemiringAssign( MT1& C, const MT2& A, const MT3& B, const MT4& mask )
+   -> EnableIf_t< IsRowMajorMatrix_v<MT1> >
+{
+   typename SemiringOperand<MT2>::Type a( A );     // Row-major evaluation of the left-hand side
+   typename SemiringOperand<MT3>::Type b( B );     // Row-major evaluation of the right-hand side
+   typename SemiringOperand<MT4>::Type m( mask );  // Row-major evaluation of the mask
+
+   smmmSemiring<SR,CM>( C, a, b, m );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Semiring multiplication of two sparse matrices with a column-major target matrix
+//        (\f$ C=A\oplus.\otimes B \f$).
+// \ingroup compressed_matrix
+//
+// \param C The target column-major sparse matrix.
+// \param A The left-hand side sparse matrix.
+// \param B The right-hand side sparse matrix.
+// \param mask The sparse matrix output mask (or no mask).
+// \return void
+//
+// The multiplication is computed in a row-major temporary, which is assigned to the target.
+*/
+template< typename SR     // Type of the semiring
+        , bool CM         // Complement flag
+        , typename MT1    // Type of the target sparse matrix
+        , typename MT2    // Type of the left-hand side sparse matrix
+        , typename MT3    // Type of the right-hand side sparse matrix
+        , typename MT4 >  // Type of the output mask
+auto smmmSemiringAssign( MT1& C, const MT2& A, const MT3& B, const MT4& mask )
+   -> DisableIf_t< IsRowMajorMatrix_v<MT1> >
+{
+   CompressedMatrix<ElementType_t<MT1>,rowMajor> tmp;
+   smmmSemiringAssign<SR,CM>( tmp, A, B, mask );
+   C = tmp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Semiring multiplication of a sparse matrix and a vector (\f$ \vec{y}=A\oplus.\otimes
+//        \vec{x} \f$).
+// \ingroup compressed_matrix
+//
+// \param y The target dense vector.
+// \param A The sparse matrix.
+// \param x The dense or sparse vector.
+// \param mask The dense vector output mask (or no mask).
+// \return void
+//
+// In case the vector \a x is aliased with the target vector, \a x is evaluated before the
+// multiplication.
+*/
+template< typename SR     // Type of the semiring
+        , bool CM         // Complement flag
+        , typename VT1    // Type of the target dense vector
+        , typename MT     // Type of the sparse matrix
+        , typename VT2    // Type of the vector
+        , typename VT3 >  // Type of the output mask
+void smvmSemiringAssign( VT1& y, const MT& A, const VT2& x, const VT3& mask )
+{
+   CompositeType_t<MT> a( A );  // Evaluation of the sparse matrix operand
+
+   if( x.isAliased( &y ) ) {
+      const ResultType_t<VT2> tmp( x );
+      resize( y, A.rows(), false );
+      semiringMult<SR,CM>( y, a, tmp, mask );
+   }
+   else {
+      CompositeType_t<VT2> b( x );  // Evaluation of the vector operand
+      resize( y, A.rows(), false );
+      semiringMult<SR,CM>( y, a, b, mask );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Semiring multiplication functions */
+//@{
+template< typename SR, typename VT1, typename MT, bool SO, typename VT2 >
+void mult( DenseVector<VT1,false>& y, const SparseMatrix<MT,SO>& A, const Vector<VT2,false>& x );
+
+template< typename SR, typename VT1, typename MT, bool SO, typename VT2, typename VT3 >
+void mult( DenseVector<VT1,false>& y, const SparseMatrix<MT,SO>& A, const Vector<VT2,false>& x,
+           const DenseVector<VT3,false>& mask );
+
+template< typename SR, typename VT1, typename MT, bool SO, typename VT2, typename VT3 >
+void mult( DenseVector<VT1,false>& y, const SparseMatrix<MT,SO>& A, const Vector<VT2,false>& x,
+           const Complement<VT3>& mask );
+
+template< typename SR, typename MT, bool SO, typename VT >
+DynamicVector< SemiringElement_t< SR, ElementType_t<MT>, ElementType_t<VT> > >
+   mult( const SparseMatrix<MT,SO>& A, const Vector<VT,false>& x );
+
+template< typename SR, typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3 >
+void mult( SparseMatrix<MT1,SO1>& C, const SparseMatrix<MT2,SO2>& A,
+           const SparseMatrix<MT3,SO3>& B );
+
+template< typename SR, typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3
+        , typename MT4, bool SO4 >
+void mult( SparseMatrix<MT1,SO1>& C, const SparseMatrix<MT2,SO2>& A,
+           const SparseMatrix<MT3,SO3>& B, const SparseMatrix<MT4,SO4>& mask );
+
+template< typename SR, typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3
+        , typename MT4 >
+void mult( SparseMatrix<MT1,SO1>& C, const SparseMatrix<MT2,SO2>& A,
+           const SparseMatrix<MT3,SO3>& B, const Complement<MT4>& mask );
+
+template< typename SR, typename MT1, bool SO1, typename MT2, bool SO2 >
+CompressedMatrix< SemiringElement_t< SR, ElementType_t<MT1>, ElementType_t<MT2> >, rowMajor >
+   mult( const SparseMatrix<MT1,SO1>& A, const SparseMatrix<MT2,SO2>& B );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Semiring multiplication of a sparse matrix and a vector (\f$ \vec{y}=A\oplus.\otimes
+//        \vec{x} \f$).
+// \ingroup compressed_matrix
+//
+// \param y The target dense vector.
+// \param A The sparse matrix.
+// \param x The dense or sparse vector.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function computes the multiplication of the sparse matrix \a A and the vector \a x in
+// the semiring \a SR, i.e. with the additive operation \a SR::AddOp and the multiplicative
+// operation \a SR::MultOp instead of the conventional addition and multiplication. Blaze
+// provides the PlusTimes, MinPlus, MaxPlus, MaxMin, and OrAnd semirings. The following
+// example demonstrates a single step of the Bellman-Ford algorithm for the single-source
+// shortest path problem:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::MinPlus;
+   using blaze::columnMajor;
+
+   CompressedMatrix<double,columnMajor> G;  // G(i,j) is the weight of the edge from j to i
+   DynamicVector<double> d, tmp;            // Tentative distances
+   // ... Resizing and initialization
+
+   blaze::mult<MinPlus>( tmp, G, d );  // tmp[i] = min_j ( G(i,j) + d[j] )
+   d = min( d, tmp );
+   \endcode
+
+// Each element of \a y that doesn't receive any contribution is set to the additive identity
+// of the semiring (i.e. \a SR::zero()). Elements of \a x that are equal to the additive identity
+// of the semiring don't contribute to the result. In case \a A is a row-major matrix, the rows
+// of \a A are processed in parallel (in case the shared memory parallelization is enabled and
+// the number of non-zero elements of \a A exceeds the SMP_SEMIRINGMULT_THRESHOLD), based on a
+// partitioning that balances the number of non-zero elements per thread. In case \a A is a
+// column-major matrix, the columns of \a A selected by the non-zero elements of \a x are
+// scattered single-threaded. In case \a x is a sparse vector, only the columns of its non-zero
+// elements are visited, which makes column-major matrices well suited for frontier-based graph
+// algorithms.
+//
+// In case the number of columns of \a A doesn't match the size of \a x, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename SR     // Type of the semiring
+        , typename VT1    // Type of the target dense vector
+        , typename MT     // Type of the sparse matrix
+        , bool SO         // Storage order of the sparse matrix
+        , typename VT2 >  // Type of the vector
+inline void mult( DenseVector<VT1,false>& y, const SparseMatrix<MT,SO>& A,
+                  const Vector<VT2,false>& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*A).columns() != (*x).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   smvmSemiringAssign<SR,false>( *y, *A, *x, SemiringNoMask() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked semiring multiplication of a sparse matrix and a vector (\f$ \vec{y}\langle
+//        \vec{m}\rangle=A\oplus.\otimes\vec{x} \f$).
+// \ingroup compressed_matrix
+//
+// \param y The target dense vector.
+// \param A The sparse matrix.
+// \param x The dense or sparse vector.
+// \param mask The dense vector output mask.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Invalid target vector size.
+// \exception std::invalid_argument Invalid mask size.
+//
+// This function computes the multiplication of the sparse matrix \a A and the vector \a x in
+// the semiring \a SR (see the unmasked mult() function), but only for the elements of \a y
+// that are selected by the given output mask. An element is selected in case the according
+// element of \a mask is not a default value (i.e. not zero or \a false). All other elements
+// of \a y remain unchanged and, in case \a A is a row-major matrix, are not computed at all.
+// In order to select all elements that are NOT selected by a mask, the mask can be complemented
+// via the complement() function:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::OrAnd;
+
+   CompressedMatrix<bool> G;            // Adjacency matrix (G(i,j) == true for an edge i -> j)
+   DynamicVector<bool> visited, front;  // Visited vertices and current frontier of a BFS
+   // ... Resizing and initialization
+
+   DynamicVector<bool> next( front.size(), false );
+   blaze::mult<OrAnd>( next, G, front, blaze::complement( visited ) );  // Pull step
+   \endcode
+
+// In case the number of columns of \a A doesn't match the size of \a x or the number of rows
+// of \a A doesn't match the size of \a y or \a mask, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename SR     // Type of the semiring
+        , typename VT1    // Type of the target dense vector
+        , typename MT     // Type of the sparse matrix
+        , bool SO         // Storage order of the sparse matrix
+        , typename VT2    // Type of the vector
+        , typename VT3 >  // Type of the dense vector mask
+inline void mult( DenseVector<VT1,false>& y, const SparseMatrix<MT,SO>& A,
+                  const Vector<VT2,false>& x, const DenseVector<VT3,false>& mask )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*A).columns() != (*x).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   if( (*A).rows() != (*y).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid target vector size" );
+   }
+
+   if( (*A).rows() != (*mask).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid mask size" );
+   }
+
+   smvmSemiringAssign<SR,false>( *y, *A, *x, *mask );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Semiring multiplication of a sparse matrix and a vector with a complemented mask
+//        (\f$ \vec{y}\langle\neg\vec{m}\rangle=A\oplus.\otimes\vec{x} \f$).
+// \ingroup compressed_matrix
+//
+// \param y The target dense vector.
+// \param A The sparse matrix.
+// \param x The dense or sparse vector.
+// \param mask The complemented dense vector output mask.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Invalid target vector size.
+// \exception std::invalid_argument Invalid mask size.
+//
+// This function computes all elements of \a y that are NOT selected by the given mask (see the
+// masked mult() function). All other elements of \a y remain unchanged.
+*/
+template< typename SR     // Type of the semiring
+        , typename VT1    // Type of the target dense vector
+        , typename MT     // Type of the sparse matrix
+        , bool SO         // Storage order of the sparse matrix
+        , typename VT2    // Type of the vector
+        , typename VT3 >  // Type of the dense vector mask
+inline void mult( DenseVector<VT1,false>& y, const SparseMatrix<MT,SO>& A,
+                  const Vector<VT2,false>& x, const Complement<VT3>& mask )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( VT3 );
+
+   if( (*A).columns() != (*x).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   if( (*A).rows() != (*y).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid target vector size" );
+   }
+
+   if( (*A).rows() != mask.operand().size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid mask size" );
+   }
+
+   smvmSemiringAssign<SR,true>( *y, *A, *x, mask.operand() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Semiring multiplication of a sparse matrix and a vector (\f$ \vec{y}=A\oplus.\otimes
+//        \vec{x} \f$).
+// \ingroup compressed_matrix
+//
+// \param A The sparse matrix.
+// \param x The dense or sparse vector.
+// \return The resulting dense vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function returns the multiplication of the sparse matrix \a A and the vector \a x in the
+// semiring \a SR as a new dense vector (see the mult() function with explicit target vector):
+
+   \code
+   blaze::CompressedMatrix<double> G;
+   blaze::DynamicVector<double> d;
+   // ... Resizing and initialization
+
+   const auto tmp( blaze::mult<blaze::MinPlus>( G, d ) );
+   \endcode
+*/
+template< typename SR    // Type of the semiring
+        , typename MT    // Type of the sparse matrix
+        , bool SO        // Storage order of the sparse matrix
+        , typename VT >  // Type of the vector
+inline DynamicVector< SemiringElement_t< SR, ElementType_t<MT>, ElementType_t<VT> > >
+   mult( const SparseMatrix<MT,SO>& A, const Vector<VT,false>& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   DynamicVector< SemiringElement_t< SR, ElementType_t<MT>, ElementType_t<VT> > > y;
+   mult<SR>( y, A, x );
+   return y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Semiring multiplication of two sparse matrices (\f$ C=A\oplus.\otimes B \f$).
+// \ingroup compressed_matrix
+//
+// \param C The target sparse matrix.
+// \param A The left-hand side sparse matrix.
+// \param B The right-hand side sparse matrix.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes the multiplication of the two sparse matrices \a A and \a B in the
+// semiring \a SR, i.e. with the additive operation \a SR::AddOp and the multiplicative operation
+// \a SR::MultOp instead of the conventional addition and multiplication. The target matrix is
+// resized accordingly. The resulting sparsity pattern is purely structural, i.e. all elements
+// that receive at least one contribution are stored, independent of their value.
+//
+// The multiplication is based on Gustavson's algorithm. Column-major operands are converted to
+// row-major matrices before the multiplication. The rows of \a A are processed in parallel (in
+// case the shared memory parallelization is enabled and the number of multiply-add operations
+// exceeds the SMP_SEMIRINGMULT_THRESHOLD), based on a partitioning that balances the number of
+// multiply-add operations per thread.
+//
+// In case the number of columns of \a A doesn't match the number of rows of \a B, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename SR     // Type of the semiring
+        , typename MT1    // Type of the target sparse matrix
+        , bool SO1        // Storage order of the target sparse matrix
+        , typename MT2    // Type of the left-hand side sparse matrix
+        , bool SO2        // Storage order of the left-hand side sparse matrix
+        , typename MT3    // Type of the right-hand side sparse matrix
+        , bool SO3 >      // Storage order of the right-hand side sparse matrix
+inline void mult( SparseMatrix<MT1,SO1>& C, const SparseMatrix<MT2,SO2>& A,
+                  const SparseMatrix<MT3,SO3>& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*A).columns() != (*B).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   smmmSemiringAssign<SR,true>( *C, *A, *B, SemiringNoMask() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked semiring multiplication of two sparse matrices (\f$ C\langle M\rangle=A\oplus.
+//        \otimes B \f$).
+// \ingroup compressed_matrix
+//
+// \param C The target sparse matrix.
+// \param A The left-hand side sparse matrix.
+// \param B The right-hand side sparse matrix.
+// \param mask The sparse matrix output mask.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid mask size.
+//
+// This function computes the multiplication of the two sparse matrices \a A and \a B in the
+// semiring \a SR (see the unmasked mult() function), but only for the elements that are
+// selected by the given output mask. The mask is structural, i.e. all non-zero elements of the
+// mask select the according element, independent of their value. Elements that are not
+// selected are neither computed nor stored in \a C. The following example demonstrates the
+// counting of triangles in an undirected graph via its strictly lower part \a L:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::PlusTimes;
+
+   CompressedMatrix<int> L, C;
+   // ... Resizing and initialization
+
+   blaze::mult<PlusTimes>( C, L, L, L );  // C<L> = L*L
+   const int triangles( sum( C ) );
+   \endcode
+
+// In order to compute all elements that are NOT selected by a mask, the mask can be
+// complemented via the complement() function. In case the number of columns of \a A doesn't
+// match the number of rows of \a B or the size of the mask doesn't match the size of the
+// result, a \a std::invalid_argument exception is thrown.
+*/
+template< typename SR     // Type of the semiring
+        , typename MT1    // Type of the target sparse matrix
+        , bool SO1        // Storage order of the target sparse matrix
+        , typename MT2    // Type of the left-hand side sparse matrix
+        , bool SO2        // Storage order of the left-hand side sparse matrix
+        , typename MT3    // Type of the right-hand side sparse matrix
+        , bool SO3        // Storage order of the right-hand side sparse matrix
+        , typename MT4    // Type of the sparse matrix mask
+        , bool SO4 >      // Storage order of the sparse matrix mask
+inline void mult( SparseMatrix<MT1,SO1>& C, const SparseMatrix<MT2,SO2>& A,
+                  const SparseMatrix<MT3,SO3>& B, const SparseMatrix<MT4,SO4>& mask )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*A).columns() != (*B).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (*mask).rows() != (*A).rows() || (*mask).columns() != (*B).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid mask size" );
+   }
+
+   smmmSemiringAssign<SR,false>( *C, *A, *B, *mask );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Semiring multiplication of two sparse matrices with a complemented mask
+//        (\f$ C\langle\neg M\rangle=A\oplus.\otimes B \f$).
+// \ingroup compressed_matrix
+//
+// \param C The target sparse matrix.
+// \param A The left-hand side sparse matrix.
+// \param B The right-hand side sparse matrix.
+// \param mask The complemented sparse matrix output mask.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid mask size.
+//
+// This function computes all elements of the multiplication that are NOT selected by the given
+// structural mask (see the masked mult() function). Elements that are selected by the mask are
+// neither computed nor stored in \a C.
+*/
+template< typename SR     // Type of the semiring
+        , typename MT1    // Type of the target sparse matrix
+        , bool SO1        // Storage order of the target sparse matrix
+        , typename MT2    // Type of the left-hand side sparse matrix
+        , bool SO2        // Storage order of the left-hand side sparse matrix
+        , typename MT3    // Type of the right-hand side sparse matrix
+        , bool SO3        // Storage order of the right-hand side sparse matrix
+        , typename MT4 >  // Type of the sparse matrix mask
+inline void mult( SparseMatrix<MT1,SO1>& C, const SparseMatrix<MT2,SO2>& A,
+                  const SparseMatrix<MT3,SO3>& B, const Complement<MT4>& mask )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( MT4 );
+
+   if( (*A).columns() != (*B).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( mask.operand().rows() != (*A).rows() || mask.operand().columns() != (*B).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid mask size" );
+   }
+
+   smmmSemiringAssign<SR,true>( *C, *A, *B, mask.operand() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Semiring multiplication of two sparse matrices (\f$ C=A\oplus.\otimes B \f$).
+// \ingroup compressed_matrix
+//
+// \param A The left-hand side sparse matrix.
+// \param B The right-hand side sparse matrix.
+// \return The resulting row-major compressed matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function returns the multiplication of the two sparse matrices \a A and \a B in the
+// semiring \a SR as a new row-major compressed matrix (see the mult() function with explicit
+// target matrix).
+*/
+template< typename SR     // Type of the semiring
+        , typename MT1    // Type of the left-hand side sparse matrix
+        , bool SO1        // Storage order of the left-hand side sparse matrix
+        , typename MT2    // Type of the right-hand side sparse matrix
+        , bool SO2 >      // Storage order of the right-hand side sparse matrix
+inline CompressedMatrix< SemiringElement_t< SR, ElementType_t<MT1>, ElementType_t<MT2> >, rowMajor >
+   mult( const SparseMatrix<MT1,SO1>& A, const SparseMatrix<MT2,SO2>& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   CompressedMatrix< SemiringElement_t< SR, ElementType_t<MT1>, ElementType_t<MT2> >, rowMajor > C;
+   mult<SR>( C, A, B );
+   return C;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
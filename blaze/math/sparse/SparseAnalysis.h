@@ -0,0 +1,736 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SparseAnalysis.h
+//  \brief Header file for the symbolic analysis of the sparse direct solvers
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SPARSEANALYSIS_H_
+#define _BLAZE_MATH_SPARSE_SPARSEANALYSIS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/sparse/Reordering.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ORDERING FLAGS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Fill-reducing orderings of the sparse direct solvers.
+// \ingroup compressed_matrix
+//
+// The SparseOrdering enumeration selects the symmetric permutation that is applied to the
+// rows and columns of a sparse matrix before its factorization within the SparseCholesky and
+// SparseLU classes.
+*/
+enum SparseOrdering
+{
+   naturalOrdering          = 0,  //!< No reordering of the rows and columns.
+   rcmOrdering              = 1,  //!< Reverse Cuthill-McKee ordering (see rcm()).
+   nestedDissectionOrdering = 2   //!< Nested dissection ordering (see nestedDissection()).
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Symbolic analysis of the supernodal sparse direct solvers.
+// \ingroup compressed_matrix
+//
+// The SparseAnalysis class contains all information of a supernodal factorization that only
+// depends on the sparsity pattern of the factorized matrix: the fill-reducing permutation, the
+// supernodes and their row structures, the supernodal elimination tree, a schedule of the
+// supernodes by levels of the tree, and the assembly map of the nonzero elements of the matrix
+// into the frontal matrices of the supernodes. The analysis is based on the symmetrized pattern
+// \f$ A+A^T \f$. In case of a symmetric analysis only the lower part of the permuted matrix is
+// assembled, otherwise all elements are assembled.
+//
+// The columns of the permuted matrix are numbered in a postorder of the elimination tree, such
+// that each supernode consists of a contiguous range of columns and all descendants of a
+// supernode precede it. Small supernodes are merged with their parents in case this results in
+// a limited number of explicitly stored zeros (relaxed supernodal amalgamation).
+*/
+class SparseAnalysis
+{
+ public:
+   //**Type definitions****************************************************************************
+   /*!\brief Assembly information of a single nonzero element of the analyzed matrix.
+   */
+   struct Entry {
+      size_t row;    //!< The row index within the frontal matrix.
+      size_t col;    //!< The column index within the frontal matrix.
+      size_t index;  //!< The index of the element in the traversal of the matrix.
+   };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline SparseAnalysis();
+
+   template< typename MT, bool SO >
+   SparseAnalysis( const SparseMatrix<MT,SO>& A, bool symmetric, SparseOrdering ordering );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   /*!\brief Returns the number of rows/columns of the analyzed matrix.
+   */
+   inline size_t size() const noexcept
+   {
+      return perm_.size();
+   }
+
+   /*!\brief Returns the number of supernodes.
+   */
+   inline size_t supernodes() const noexcept
+   {
+      return super_.size()-1UL;
+   }
+
+   /*!\brief Returns the number of levels of the supernodal elimination tree.
+   */
+   inline size_t levels() const noexcept
+   {
+      return levelStart_.size()-1UL;
+   }
+
+   /*!\brief Returns whether the analysis is symmetric (i.e. assembles only the lower part).
+   */
+   inline bool symmetric() const noexcept
+   {
+      return symmetric_;
+   }
+
+   /*!\brief Returns the number of nonzero elements of the analyzed matrix.
+   */
+   inline size_t nonZeros() const noexcept
+   {
+      return entryIndex_.size();
+   }
+
+   /*!\brief Returns the number of elements of all frontal matrix panels.
+   */
+   inline size_t factorSize() const noexcept
+   {
+      return factorSize_;
+   }
+
+   /*!\brief Returns the fill-reducing permutation (\a perm[k] is the original index of row \a k).
+   */
+   inline const std::vector<size_t>& permutation() const noexcept
+   {
+      return perm_;
+   }
+
+   /*!\brief Returns the first column of the given supernode.
+   */
+   inline size_t first( size_t s ) const noexcept
+   {
+      return super_[s];
+   }
+
+   /*!\brief Returns the number of columns of the given supernode.
+   */
+   inline size_t columns( size_t s ) const noexcept
+   {
+      return super_[s+1UL] - super_[s];
+   }
+
+   /*!\brief Returns the number of rows of the given supernode (size of its frontal matrix).
+   */
+   inline size_t rows( size_t s ) const noexcept
+   {
+      return rowStart_[s+1UL] - rowStart_[s];
+   }
+
+   /*!\brief Returns the sorted row indices of the given supernode.
+   */
+   inline const size_t* rowIndices( size_t s ) const noexcept
+   {
+      return rows_.data() + rowStart_[s];
+   }
+
+   /*!\brief Returns the positions of the update rows of the given supernode within its parent.
+   */
+   inline const size_t* relativeMap( size_t s ) const noexcept
+   {
+      return relmap_.data() + relStart_[s];
+   }
+
+   /*!\brief Returns a pointer to the first child of the given supernode.
+   */
+   inline const size_t* childBegin( size_t s ) const noexcept
+   {
+      return children_.data() + childStart_[s];
+   }
+
+   /*!\brief Returns a pointer one past the last child of the given supernode.
+   */
+   inline const size_t* childEnd( size_t s ) const noexcept
+   {
+      return children_.data() + childStart_[s+1UL];
+   }
+
+   /*!\brief Returns a pointer to the first supernode of the given level.
+   */
+   inline const size_t* levelBegin( size_t l ) const noexcept
+   {
+      return levelNodes_.data() + levelStart_[l];
+   }
+
+   /*!\brief Returns a pointer one past the last supernode of the given level.
+   */
+   inline const size_t* levelEnd( size_t l ) const noexcept
+   {
+      return levelNodes_.data() + levelStart_[l+1UL];
+   }
+
+   /*!\brief Returns a pointer to the first assembly entry of the given supernode.
+   */
+   inline const Entry* entryBegin( size_t s ) const noexcept
+   {
+      return entries_.data() + entryStart_[s];
+   }
+
+   /*!\brief Returns a pointer one past the last assembly entry of the given supernode.
+   */
+   inline const Entry* entryEnd( size_t s ) const noexcept
+   {
+      return entries_.data() + entryStart_[s+1UL];
+   }
+
+   template< typename MT, bool SO >
+   bool matches( const SparseMatrix<MT,SO>& A ) const;
+
+   template< typename MT, bool SO, typename Type >
+   void gather( const SparseMatrix<MT,SO>& A, std::vector<Type>& values ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   bool symmetric_;                  //!< Flag for a symmetric analysis (lower part only).
+   bool rowMajor_;                   //!< Storage order of the analyzed matrix.
+   size_t factorSize_;               //!< Total number of elements of all supernode panels.
+   std::vector<size_t> perm_;        //!< The fill-reducing permutation (new to old index).
+   std::vector<size_t> super_;       //!< The first column of each supernode.
+   std::vector<size_t> rowStart_;    //!< Start of the row structure of each supernode.
+   std::vector<size_t> rows_;        //!< The row structures of all supernodes.
+   std::vector<size_t> relStart_;    //!< Start of the relative map of each supernode.
+   std::vector<size_t> relmap_;      //!< Positions of the update rows within the parent.
+   std::vector<size_t> childStart_;  //!< Start of the children of each supernode.
+   std::vector<size_t> children_;    //!< The children of all supernodes.
+   std::vector<size_t> levelStart_;  //!< Start of each level of the supernodal tree.
+   std::vector<size_t> levelNodes_;  //!< The supernodes sorted by level.
+   std::vector<size_t> entryStart_;  //!< Start of the assembly entries of each supernode.
+   std::vector<Entry> entries_;      //!< The assembly entries of all supernodes.
+   std::vector<size_t> majorStart_;  //!< Start of each row/column of the analyzed pattern.
+   std::vector<size_t> entryIndex_;  //!< Column/row indices of the analyzed pattern.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for the SparseAnalysis class.
+*/
+inline SparseAnalysis::SparseAnalysis()
+   : symmetric_ ( false )  // Flag for a symmetric analysis
+   , rowMajor_  ( true )   // Storage order of the analyzed matrix
+   , factorSize_( 0UL )    // Total number of elements of all supernode panels
+   , perm_      ()         // The fill-reducing permutation
+   , super_     ( 1UL )    // The first column of each supernode
+   , rowStart_  ( 1UL )    // Start of the row structure of each supernode
+   , rows_      ()         // The row structures of all supernodes
+   , relStart_  ( 1UL )    // Start of the relative map of each supernode
+   , relmap_    ()         // Positions of the update rows within the parent
+   , childStart_( 1UL )    // Start of the children of each supernode
+   , children_  ()         // The children of all supernodes
+   , levelStart_( 1UL )    // Start of each level of the supernodal tree
+   , levelNodes_()         // The supernodes sorted by level
+   , entryStart_( 1UL )    // Start of the assembly entries of each supernode
+   , entries_   ()         // The assembly entries of all supernodes
+   , majorStart_( 1UL )    // Start of each row/column of the analyzed pattern
+   , entryIndex_()         // Column/row indices of the analyzed pattern
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Symbolic analysis of the given square sparse matrix.
+//
+// \param A The square sparse matrix to be analyzed.
+// \param symmetric \a true for a symmetric (Cholesky) analysis, \a false for an LU analysis.
+// \param ordering The fill-reducing ordering.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+SparseAnalysis::SparseAnalysis( const SparseMatrix<MT,SO>& A, bool symmetric,
+                                SparseOrdering ordering )
+   : SparseAnalysis()
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*A).rows() != (*A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   CompositeType_t<MT> a( *A );  // Evaluation of the sparse matrix
+
+   const size_t n( a.rows() );
+   const size_t none( size_t(-1) );
+
+   symmetric_ = symmetric;
+   rowMajor_  = ( SO == rowMajor );
+
+   if( n == 0UL ) return;
+
+
+   // Computation of the fill-reducing ordering
+   if( ordering == rcmOrdering ) {
+      perm_ = rcm( a );
+   }
+   else if( ordering == nestedDissectionOrdering ) {
+      perm_ = nestedDissection( a );
+   }
+   else {
+      perm_.resize( n );
+      for( size_t k=0UL; k<n; ++k ) perm_[k] = k;
+   }
+
+   const ReorderingGraph G( a );
+   std::vector<size_t> iperm( invertPermutation( perm_ ) );
+
+
+   // Computation of the elimination tree (Liu's algorithm with path compression)
+   std::vector<size_t> parent( n, none ), ancestor( n, none );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      for( const size_t* u=G.begin( perm_[k] ); u!=G.end( perm_[k] ); ++u ) {
+         size_t i( iperm[*u] );
+         while( i != none && i < k ) {
+            const size_t next( ancestor[i] );
+            ancestor[i] = k;
+            if( next == none ) parent[i] = k;
+            i = next;
+         }
+      }
+   }
+
+
+   // Renumbering of the columns in a postorder of the elimination tree
+   {
+      std::vector<size_t> head( n, none ), sibling( n, none ), stack, post;
+      post.reserve( n );
+
+      for( size_t k=n; k-- > 0UL; ) {
+         if( parent[k] != none ) {
+            sibling[k] = head[parent[k]];
+            head[parent[k]] = k;
+         }
+      }
+
+      for( size_t root=0UL; root<n; ++root ) {
+         if( parent[root] != none ) continue;
+         stack.push_back( root );
+         while( !stack.empty() ) {
+            const size_t v( stack.back() );
+            if( head[v] != none ) {
+               const size_t c( head[v] );
+               head[v] = sibling[c];
+               stack.push_back( c );
+            }
+            else {
+               stack.pop_back();
+               post.push_back( v );
+            }
+         }
+      }
+
+      const std::vector<size_t> ipost( invertPermutation( post ) );
+      std::vector<size_t> perm( n ), par( n );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         perm[k] = perm_[post[k]];
+         par[k]  = ( parent[post[k]] == none )?( none ):( ipost[parent[post[k]]] );
+      }
+
+      perm_.swap( perm );
+      parent.swap( par );
+      iperm = invertPermutation( perm_ );
+   }
+
+
+   // Computation of the column counts of the Cholesky factor (row subtrees)
+   std::vector<size_t> colcount( n, 1UL ), mark( n, none ), nchildren( n, 0UL );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      mark[i] = i;
+      if( parent[i] != none ) ++nchildren[parent[i]];
+      for( const size_t* u=G.begin( perm_[i] ); u!=G.end( perm_[i] ); ++u ) {
+         for( size_t j=iperm[*u]; j<i && mark[j]!=i; j=parent[j] ) {
+            mark[j] = i;
+            ++colcount[j];
+         }
+      }
+   }
+
+
+   // Detection of the fundamental supernodes
+   std::vector<size_t> fsuper( 1UL, 0UL );
+
+   for( size_t j=1UL; j<n; ++j ) {
+      if( parent[j-1UL] != j || colcount[j-1UL] != colcount[j]+1UL || nchildren[j] != 1UL ) {
+         fsuper.push_back( j );
+      }
+   }
+   fsuper.push_back( n );
+
+   const size_t nfs( fsuper.size()-1UL );
+
+
+   // Relaxed supernodal amalgamation
+   {
+      std::vector<size_t> fnode( n ), ncol( nfs ), nrow( nfs ), exact( nfs );
+      std::vector<bool> merge( nfs, false );
+
+      const auto entries = []( size_t c, size_t r ) { return c*r - c*(c-1UL)/2UL; };
+
+      for( size_t s=0UL; s<nfs; ++s ) {
+         for( size_t j=fsuper[s]; j<fsuper[s+1UL]; ++j ) fnode[j] = s;
+         ncol[s]  = fsuper[s+1UL] - fsuper[s];
+         nrow[s]  = colcount[fsuper[s]];
+         exact[s] = entries( ncol[s], nrow[s] );
+      }
+
+      for( size_t s=nfs-1UL; s-- > 0UL; )
+      {
+         const size_t p( parent[fsuper[s+1UL]-1UL] );
+         if( p == none || fnode[p] != s+1UL ) continue;
+
+         const size_t c( ncol[s] + ncol[s+1UL] );
+         const size_t r( ncol[s] + nrow[s+1UL] );
+         const size_t e( exact[s] + exact[s+1UL] );
+         const double z( 1.0 - double( e ) / double( entries( c, r ) ) );
+
+         if( c <= 4UL || ( c <= 16UL && z < 0.8 ) || ( c <= 48UL && z < 0.1 ) || z < 0.05 ) {
+            merge[s]  = true;
+            ncol[s]   = c;
+            nrow[s]   = r;
+            exact[s]  = e;
+         }
+      }
+
+      super_.assign( 1UL, 0UL );
+      for( size_t s=0UL; s<nfs; ++s ) {
+         if( !merge[s] ) super_.push_back( fsuper[s+1UL] );
+      }
+   }
+
+   const size_t ns( super_.size()-1UL );
+
+   std::vector<size_t> snode( n );
+   for( size_t s=0UL; s<ns; ++s ) {
+      for( size_t j=super_[s]; j<super_[s+1UL]; ++j ) snode[j] = s;
+   }
+
+
+   // Computation of the supernodal elimination tree
+   std::vector<size_t> sparent( ns, none );
+   childStart_.assign( ns+1UL, 0UL );
+
+   for( size_t s=0UL; s<ns; ++s ) {
+      const size_t p( parent[super_[s+1UL]-1UL] );
+      if( p != none ) {
+         sparent[s] = snode[p];
+         ++childStart_[sparent[s]+1UL];
+      }
+   }
+   for( size_t s=0UL; s<ns; ++s ) {
+      childStart_[s+1UL] += childStart_[s];
+   }
+   children_.resize( childStart_[ns] );
+   {
+      std::vector<size_t> pos( childStart_.begin(), childStart_.end()-1 );
+      for( size_t s=0UL; s<ns; ++s ) {
+         if( sparent[s] != none ) children_[pos[sparent[s]]++] = s;
+      }
+   }
+
+
+   // Computation of the row structures of the supernodes
+   rowStart_.assign( 1UL, 0UL );
+   rows_.clear();
+   std::fill( mark.begin(), mark.end(), none );
+
+   for( size_t s=0UL; s<ns; ++s )
+   {
+      const size_t first( super_[s] ), last( super_[s+1UL] );
+
+      for( size_t j=first; j<last; ++j ) {
+         rows_.push_back( j );
+      }
+
+      const size_t begin( rows_.size() );
+
+      for( size_t j=first; j<last; ++j ) {
+         for( const size_t* u=G.begin( perm_[j] ); u!=G.end( perm_[j] ); ++u ) {
+            const size_t i( iperm[*u] );
+            if( i >= last && mark[i] != s ) {
+               mark[i] = s;
+               rows_.push_back( i );
+            }
+         }
+      }
+
+      for( const size_t* c=childBegin( s ); c!=childEnd( s ); ++c ) {
+         for( size_t k=rowStart_[*c]+columns( *c ); k<rowStart_[*c+1UL]; ++k ) {
+            const size_t i( rows_[k] );
+            if( i >= last && mark[i] != s ) {
+               mark[i] = s;
+               rows_.push_back( i );
+            }
+         }
+      }
+
+      std::sort( rows_.begin()+begin, rows_.end() );
+      rowStart_.push_back( rows_.size() );
+   }
+
+   const auto position = [this]( size_t s, size_t i ) {
+      if( i < super_[s+1UL] ) return i - super_[s];
+      const size_t* begin( rowIndices( s ) + columns( s ) );
+      const size_t* end  ( rowIndices( s ) + rows( s ) );
+      BLAZE_INTERNAL_ASSERT( std::binary_search( begin, end, i ),
+                             "Invalid row structure detected" );
+      return size_t( std::lower_bound( begin, end, i ) - rowIndices( s ) );
+   };
+
+
+   // Computation of the relative maps of the update matrices
+   relStart_.assign( 1UL, 0UL );
+   relmap_.clear();
+   factorSize_ = 0UL;
+
+   for( size_t s=0UL; s<ns; ++s ) {
+      factorSize_ += columns( s ) * rows( s );
+      if( sparent[s] != none ) {
+         for( size_t k=rowStart_[s]+columns( s ); k<rowStart_[s+1UL]; ++k ) {
+            relmap_.push_back( position( sparent[s], rows_[k] ) );
+         }
+      }
+      relStart_.push_back( relmap_.size() );
+   }
+
+
+   // Scheduling of the supernodes by levels of the supernodal elimination tree
+   {
+      std::vector<size_t> level( ns, 0UL );
+      size_t nlevels( 0UL );
+
+      for( size_t s=0UL; s<ns; ++s ) {
+         nlevels = max( nlevels, level[s]+1UL );
+         if( sparent[s] != none ) {
+            level[sparent[s]] = max( level[sparent[s]], level[s]+1UL );
+         }
+      }
+
+      levelStart_.assign( nlevels+1UL, 0UL );
+      for( size_t s=0UL; s<ns; ++s ) {
+         ++levelStart_[level[s]+1UL];
+      }
+      for( size_t l=0UL; l<nlevels; ++l ) {
+         levelStart_[l+1UL] += levelStart_[l];
+      }
+
+      levelNodes_.resize( ns );
+      std::vector<size_t> pos( levelStart_.begin(), levelStart_.end()-1 );
+      for( size_t s=0UL; s<ns; ++s ) {
+         levelNodes_[pos[level[s]]++] = s;
+      }
+   }
+
+
+   // Computation of the assembly map of the matrix elements
+   majorStart_.assign( 1UL, 0UL );
+   entryIndex_.clear();
+   entryIndex_.reserve( a.nonZeros() );
+
+   std::vector<Entry> entries;
+   entries.reserve( a.nonZeros() );
+   std::vector<size_t> owner;
+   owner.reserve( a.nonZeros() );
+   entryStart_.assign( ns+1UL, 0UL );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( auto element=a.begin(i); element!=a.end(i); ++element )
+      {
+         const size_t index( entryIndex_.size() );
+         entryIndex_.push_back( element->index() );
+
+         const size_t r( iperm[ SO ? element->index() : i ] );
+         const size_t c( iperm[ SO ? i : element->index() ] );
+
+         if( symmetric && r < c ) continue;
+
+         const size_t s( snode[ r < c ? r : c ] );
+         entries.push_back( Entry{ position( s, r ), position( s, c ), index } );
+         owner.push_back( s );
+         ++entryStart_[s+1UL];
+      }
+      majorStart_.push_back( entryIndex_.size() );
+   }
+
+   for( size_t s=0UL; s<ns; ++s ) {
+      entryStart_[s+1UL] += entryStart_[s];
+   }
+
+   entries_.resize( entries.size() );
+   {
+      std::vector<size_t> pos( entryStart_.begin(), entryStart_.end()-1 );
+      for( size_t k=0UL; k<entries.size(); ++k ) {
+         entries_[pos[owner[k]]++] = entries[k];
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the given matrix has the sparsity pattern of the analyzed matrix.
+//
+// \param A The sparse matrix to be checked.
+// \return \a true in case the pattern matches the analyzed pattern, \a false if not.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+bool SparseAnalysis::matches( const SparseMatrix<MT,SO>& A ) const
+{
+   if( (*A).rows() != size() || (*A).columns() != size() || rowMajor_ != ( SO == rowMajor ) ) {
+      return false;
+   }
+
+   CompositeType_t<MT> a( *A );  // Evaluation of the sparse matrix
+
+   for( size_t i=0UL; i<size(); ++i ) {
+      size_t k( majorStart_[i] );
+      for( auto element=a.begin(i); element!=a.end(i); ++element, ++k ) {
+         if( k == majorStart_[i+1UL] || entryIndex_[k] != element->index() ) {
+            return false;
+         }
+      }
+      if( k != majorStart_[i+1UL] ) {
+         return false;
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathering the values of all nonzero elements of the given matrix.
+//
+// \param A The sparse matrix with the analyzed sparsity pattern.
+// \param values The values of all nonzero elements in the order of the analyzed pattern.
+// \return void
+*/
+template< typename MT    // Type of the sparse matrix
+        , bool SO        // Storage order of the sparse matrix
+        , typename Type > // Data type of the values
+void SparseAnalysis::gather( const SparseMatrix<MT,SO>& A, std::vector<Type>& values ) const
+{
+   CompositeType_t<MT> a( *A );  // Evaluation of the sparse matrix
+
+   values.resize( nonZeros() );
+
+   size_t k( 0UL );
+   for( size_t i=0UL; i<size(); ++i ) {
+      for( auto element=a.begin(i); element!=a.end(i); ++element ) {
+         values[k++] = element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,705 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SparseLU.h
+//  \brief Header file for the supernodal sparse LU decomposition
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SPARSELU_H_
+#define _BLAZE_MATH_SPARSE_SPARSELU_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/sparse/SparseAnalysis.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Supernodal LU decomposition of general sparse matrices.
+// \ingroup compressed_matrix
+//
+// The SparseLU class template computes the decomposition \f$ QPAP^T = LU \f$ of a general square
+// sparse matrix \a A, where \a P is a fill-reducing permutation, \a Q is a row permutation due
+// to pivoting, \a L is a lower unitriangular matrix, and \a U is an upper triangular matrix,
+// and uses it to solve linear systems \f$ Ax = b \f$. The template argument specifies the
+// element type of the factors, which has to be \c float, \c double, \c complex<float>, or
+// \c complex<double>.
+//
+// As the SparseCholesky class template, SparseLU separates the symbolic analysis (see analyze())
+// from the numeric factorization (see factorize()). The analysis is based on the symmetrized
+// pattern \f$ A+A^T \f$, which makes it suitable for matrices with a (nearly) symmetric
+// sparsity pattern as for instance resulting from the discretization of partial differential
+// equations. The numeric factorization uses the multifrontal method, where the frontal matrix
+// of every supernode is partially factorized by means of dense matrix multiplications. In order
+// to preserve the precomputed structure, partial pivoting is restricted to the fully summed
+// rows of each frontal matrix, i.e. to the rows belonging to the columns of the supernode. In
+// case no nonzero pivot can be found within these rows, a \a std::runtime_error exception is
+// thrown. Diagonally dominant matrices and most well-conditioned matrices with a nonzero
+// diagonal are always decomposed successfully.
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+
+   CompressedMatrix<double> A;
+   DynamicVector<double> b, x;
+   // ... Resizing and initialization
+
+   blaze::SparseLU<double> lu( A );  // Analysis and factorization
+   x = lu.solve( b );                // Solution of the system A*x=b
+   \endcode
+*/
+template< typename Type >  // Data type of the factors
+class SparseLU
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;  //!< Data type of the factors.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline SparseLU();
+
+   template< typename MT, bool SO >
+   explicit SparseLU( const SparseMatrix<MT,SO>& A,
+                      SparseOrdering ordering = nestedDissectionOrdering );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows      () const noexcept;
+   inline size_t supernodes() const noexcept;
+   inline size_t nonZeros  () const noexcept;
+   inline bool   factorized() const noexcept;
+
+   inline const std::vector<size_t>& permutation() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Decomposition functions*********************************************************************
+   /*!\name Decomposition functions */
+   //@{
+   template< typename MT, bool SO >
+   void analyze( const SparseMatrix<MT,SO>& A, SparseOrdering ordering = nestedDissectionOrdering );
+
+   template< typename MT, bool SO >
+   void factorize( const SparseMatrix<MT,SO>& A );
+
+   template< typename MT, bool SO >
+   void compute( const SparseMatrix<MT,SO>& A, SparseOrdering ordering = nestedDissectionOrdering );
+   //@}
+   //**********************************************************************************************
+
+   //**Solve functions*****************************************************************************
+   /*!\name Solve functions */
+   //@{
+   template< typename VT, bool TF >
+   DynamicVector<Type,TF> solve( const DenseVector<VT,TF>& b ) const;
+
+   template< typename MT, bool SO >
+   DynamicMatrix<Type,SO> solve( const DenseMatrix<MT,SO>& B ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using Front = DynamicMatrix<Type,columnMajor>;  //!< Type of the frontal matrices.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< bool SERIAL >
+   size_t factorizeSupernode( size_t s, const std::vector<Type>& values,
+                              std::vector<Front>& updates );
+
+   void substitute( DynamicVector<Type>& y ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   SparseAnalysis analysis_;     //!< The symbolic analysis.
+   std::vector<Front> panels_;   //!< The panels (L and the diagonal blocks of U) of the supernodes.
+   std::vector<Front> upper_;    //!< The off-diagonal blocks of U of the supernodes.
+   std::vector<size_t> pivots_;  //!< The pivot rows of all columns.
+   bool factorized_;             //!< Flag for a valid factorization.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SparseLU.
+*/
+template< typename Type >  // Data type of the factors
+inline SparseLU<Type>::SparseLU()
+   : analysis_  ()         // The symbolic analysis
+   , panels_    ()         // The panels of the supernodes
+   , upper_     ()         // The off-diagonal blocks of U of the supernodes
+   , pivots_    ()         // The pivot rows of all columns
+   , factorized_( false )  // Flag for a valid factorization
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the LU decomposition of the given sparse matrix.
+//
+// \param A The square sparse matrix.
+// \param ordering The fill-reducing ordering (default: nested dissection).
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Decomposition of singular matrix failed.
+*/
+template< typename Type >  // Data type of the factors
+template< typename MT      // Type of the sparse matrix
+        , bool SO >        // Storage order of the sparse matrix
+SparseLU<Type>::SparseLU( const SparseMatrix<MT,SO>& A, SparseOrdering ordering )
+   : SparseLU()
+{
+   compute( *A, ordering );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the decomposed matrix.
+//
+// \return The number of rows of the decomposed matrix.
+*/
+template< typename Type >  // Data type of the factors
+inline size_t SparseLU<Type>::rows() const noexcept
+{
+   return analysis_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of supernodes of the decomposition.
+//
+// \return The number of supernodes.
+*/
+template< typename Type >  // Data type of the factors
+inline size_t SparseLU<Type>::supernodes() const noexcept
+{
+   return analysis_.supernodes();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements of the factors \a L and \a U.
+//
+// \return The number of stored elements of the factors (including explicitly stored zeros).
+*/
+template< typename Type >  // Data type of the factors
+inline size_t SparseLU<Type>::nonZeros() const noexcept
+{
+   size_t nonzeros( 0UL );
+   for( size_t s=0UL; s<analysis_.supernodes(); ++s ) {
+      const size_t n( analysis_.columns( s ) );
+      nonzeros += n * ( 2UL*analysis_.rows( s ) - n );
+   }
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether a valid numeric factorization is available.
+//
+// \return \a true in case a valid factorization is available, \a false if not.
+*/
+template< typename Type >  // Data type of the factors
+inline bool SparseLU<Type>::factorized() const noexcept
+{
+   return factorized_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the fill-reducing permutation.
+//
+// \return The permutation of the rows/columns (\a perm[k] is the original index of row \a k).
+*/
+template< typename Type >  // Data type of the factors
+inline const std::vector<size_t>& SparseLU<Type>::permutation() const noexcept
+{
+   return analysis_.permutation();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Symbolic analysis of the given sparse matrix.
+//
+// \param A The square sparse matrix.
+// \param ordering The fill-reducing ordering (default: nested dissection).
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes the symbolic analysis of the given matrix, which only depends on its
+// sparsity pattern. Any previous factorization is discarded.
+*/
+template< typename Type >  // Data type of the factors
+template< typename MT      // Type of the sparse matrix
+        , bool SO >        // Storage order of the sparse matrix
+void SparseLU<Type>::analyze( const SparseMatrix<MT,SO>& A, SparseOrdering ordering )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   analysis_ = SparseAnalysis( *A, false, ordering );
+   panels_.clear();
+   upper_.clear();
+   pivots_.clear();
+   factorized_ = false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Numeric factorization of the given sparse matrix.
+//
+// \param A The square sparse matrix.
+// \return void
+// \exception std::invalid_argument Matrix pattern does not match the symbolic analysis.
+// \exception std::runtime_error Decomposition of singular matrix failed.
+//
+// This function computes the numeric factorization of the given matrix based on the current
+// symbolic analysis. In case the sparsity pattern of the given matrix does not match the
+// analyzed pattern, a \a std::invalid_argument exception is thrown. In case no nonzero pivot
+// can be found for any column, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Data type of the factors
+template< typename MT      // Type of the sparse matrix
+        , bool SO >        // Storage order of the sparse matrix
+void SparseLU<Type>::factorize( const SparseMatrix<MT,SO>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !analysis_.matches( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix pattern does not match the symbolic analysis" );
+   }
+
+   factorized_ = false;
+
+   std::vector<Type> values;
+   analysis_.gather( *A, values );
+
+   const size_t ns( analysis_.supernodes() );
+
+   panels_.resize( ns );
+   upper_.resize( ns );
+   pivots_.resize( analysis_.size() );
+   std::vector<Front> updates( ns );
+   std::vector<size_t> info( ns, 0UL );
+
+   for( size_t l=0UL; l<analysis_.levels(); ++l )
+   {
+      const size_t* nodes( analysis_.levelBegin( l ) );
+      const size_t count( analysis_.levelEnd( l ) - nodes );
+
+      if( count == 1UL ) {
+         info[*nodes] = factorizeSupernode<false>( *nodes, values, updates );
+      }
+      else {
+         smpFor( count, [&]( size_t t ) {
+            info[nodes[t]] = factorizeSupernode<true>( nodes[t], values, updates );
+         } );
+      }
+
+      for( size_t t=0UL; t<count; ++t ) {
+         if( info[nodes[t]] > 0UL ) {
+            BLAZE_THROW_RUNTIME_ERROR( "Decomposition of singular matrix failed" );
+         }
+      }
+   }
+
+   factorized_ = true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Symbolic analysis and numeric factorization of the given sparse matrix.
+//
+// \param A The square sparse matrix.
+// \param ordering The fill-reducing ordering (default: nested dissection).
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Decomposition of singular matrix failed.
+*/
+template< typename Type >  // Data type of the factors
+template< typename MT      // Type of the sparse matrix
+        , bool SO >        // Storage order of the sparse matrix
+void SparseLU<Type>::compute( const SparseMatrix<MT,SO>& A, SparseOrdering ordering )
+{
+   analyze( *A, ordering );
+   factorize( *A );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multifrontal factorization of a single supernode.
+//
+// \param s The index of the supernode.
+// \param values The values of the nonzero elements of the factorized matrix.
+// \param updates The update matrices of all supernodes.
+// \return 0 in case of success, \a j in case no nonzero pivot is found for column \a j.
+//
+// This function assembles the frontal matrix of the given supernode from the elements of the
+// factorized matrix and the update matrices of its children and computes the partial LU
+// decomposition of the frontal matrix. The decomposition is blocked, i.e. for each block of
+// columns the panel is decomposed by an unblocked right-looking algorithm, whereas the update
+// of the trailing matrix is performed by a dense matrix multiplication. In case \a SERIAL is
+// \a true, this multiplication is executed serially.
+*/
+template< typename Type >  // Data type of the factors
+template< bool SERIAL >    // Flag for the serial computation
+size_t SparseLU<Type>::factorizeSupernode( size_t s, const std::vector<Type>& values,
+                                           std::vector<Front>& updates )
+{
+   using std::abs;
+   using std::swap;
+
+   const size_t m( analysis_.rows( s ) );
+   const size_t n( analysis_.columns( s ) );
+   const size_t first( analysis_.first( s ) );
+
+   Front F( m, m, Type() );
+
+   // Assembly of the matrix elements
+   for( auto entry=analysis_.entryBegin( s ); entry!=analysis_.entryEnd( s ); ++entry ) {
+      F(entry->row,entry->col) += values[entry->index];
+   }
+
+   // Assembly of the update matrices of the children (extend-add)
+   for( const size_t* c=analysis_.childBegin( s ); c!=analysis_.childEnd( s ); ++c )
+   {
+      const Front& U( updates[*c] );
+      const size_t* map( analysis_.relativeMap( *c ) );
+
+      for( size_t j=0UL; j<U.columns(); ++j ) {
+         for( size_t i=0UL; i<U.rows(); ++i ) {
+            F(map[i],map[j]) += U(i,j);
+         }
+      }
+
+      updates[*c].clear();
+   }
+
+   // Partial LU decomposition of the frontal matrix
+   for( size_t k=0UL; k<n; k+=LU_BLOCK_SIZE )
+   {
+      const size_t kb( min( LU_BLOCK_SIZE, n-k ) );
+
+      for( size_t j=k; j<k+kb; ++j )
+      {
+         size_t p( j );
+         auto pmax( abs( F(j,j) ) );
+         for( size_t i=j+1UL; i<n; ++i ) {
+            if( abs( F(i,j) ) > pmax ) {
+               p = i;
+               pmax = abs( F(i,j) );
+            }
+         }
+
+         if( isDefault<strict>( F(p,j) ) ) {
+            return first + j + 1UL;
+         }
+
+         pivots_[first+j] = first + p;
+
+         if( p != j ) {
+            for( size_t l=0UL; l<m; ++l ) {
+               swap( F(j,l), F(p,l) );
+            }
+         }
+
+         const Type pivot( F(j,j) );
+         for( size_t i=j+1UL; i<m; ++i ) {
+            F(i,j) /= pivot;
+         }
+
+         for( size_t l=j+1UL; l<k+kb; ++l ) {
+            const Type u( F(j,l) );
+            for( size_t i=j+1UL; i<m; ++i ) {
+               F(i,l) -= F(i,j) * u;
+            }
+         }
+      }
+
+      if( k+kb < m )
+      {
+         for( size_t l=k+kb; l<m; ++l ) {
+            for( size_t j=k; j<k+kb; ++j ) {
+               const Type u( F(j,l) );
+               for( size_t i=j+1UL; i<k+kb; ++i ) {
+                  F(i,l) -= F(i,j) * u;
+               }
+            }
+         }
+
+         auto C( submatrix( F, k+kb, k+kb, m-k-kb, m-k-kb ) );
+         const auto P( submatrix( F, k+kb, k, m-k-kb, kb ) );
+         const auto Q( submatrix( F, k, k+kb, kb, m-k-kb ) );
+
+         if( SERIAL ) C -= serial( P * Q );
+         else C -= P * Q;
+      }
+   }
+
+   panels_[s] = serial( submatrix( F, 0UL, 0UL, m, n ) );
+
+   if( m > n ) {
+      upper_[s] = serial( submatrix( F, 0UL, n, n, m-n ) );
+      updates[s] = serial( submatrix( F, n, n, m-n, m-n ) );
+   }
+   else {
+      upper_[s].clear();
+   }
+
+   return 0UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solution of the linear system \f$ Ax = b \f$.
+//
+// \param b The right-hand side vector.
+// \return The solution vector \a x.
+// \exception std::logic_error Invalid solve without factorization.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+*/
+template< typename Type >  // Data type of the factors
+template< typename VT      // Type of the right-hand side vector
+        , bool TF >        // Transpose flag of the right-hand side vector
+DynamicVector<Type,TF> SparseLU<Type>::solve( const DenseVector<VT,TF>& b ) const
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !factorized_ ) {
+      BLAZE_THROW_LOGIC_ERROR( "Invalid solve without factorization" );
+   }
+
+   if( (*b).size() != rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   const std::vector<size_t>& perm( analysis_.permutation() );
+   const size_t n( rows() );
+
+   DynamicVector<Type> y( n );
+   for( size_t k=0UL; k<n; ++k ) {
+      y[k] = (*b)[perm[k]];
+   }
+
+   substitute( y );
+
+   DynamicVector<Type,TF> x( n );
+   for( size_t k=0UL; k<n; ++k ) {
+      x[perm[k]] = y[k];
+   }
+
+   return x;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solution of the linear system \f$ AX = B \f$ with multiple right-hand sides.
+//
+// \param B The right-hand side matrix (one right-hand side per column).
+// \return The solution matrix \a X.
+// \exception std::logic_error Invalid solve without factorization.
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+*/
+template< typename Type >  // Data type of the factors
+template< typename MT      // Type of the right-hand side matrix
+        , bool SO >        // Storage order of the right-hand side matrix
+DynamicMatrix<Type,SO> SparseLU<Type>::solve( const DenseMatrix<MT,SO>& B ) const
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*B).rows() != rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   DynamicMatrix<Type,SO> X( (*B).rows(), (*B).columns() );
+
+   for( size_t j=0UL; j<(*B).columns(); ++j ) {
+      column( X, j ) = solve( column( *B, j ) );
+   }
+
+   return X;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Forward and backward substitution with the supernodal factors.
+//
+// \param y The permuted right-hand side on entry, the permuted solution on exit.
+// \return void
+//
+// The row interchanges of each supernode are applied right before its forward substitution,
+// since the panels of the preceding supernodes are not affected by the interchanges.
+*/
+template< typename Type >  // Data type of the factors
+void SparseLU<Type>::substitute( DynamicVector<Type>& y ) const
+{
+   using std::swap;
+
+   const size_t ns( analysis_.supernodes() );
+
+   // Forward substitution (L*z=Q*y)
+   for( size_t s=0UL; s<ns; ++s )
+   {
+      const Front& L( panels_[s] );
+      const size_t* rows( analysis_.rowIndices( s ) );
+      const size_t first( analysis_.first( s ) );
+
+      for( size_t j=0UL; j<L.columns(); ++j ) {
+         swap( y[first+j], y[pivots_[first+j]] );
+      }
+
+      for( size_t j=0UL; j<L.columns(); ++j ) {
+         const Type yj( y[first+j] );
+         for( size_t i=j+1UL; i<L.rows(); ++i ) {
+            y[rows[i]] -= L(i,j) * yj;
+         }
+      }
+   }
+
+   // Backward substitution (U*x=z)
+   for( size_t s=ns; s-- > 0UL; )
+   {
+      const Front& U11( panels_[s] );
+      const Front& U12( upper_[s] );
+      const size_t* rows( analysis_.rowIndices( s ) + U11.columns() );
+      const size_t first( analysis_.first( s ) );
+
+      for( size_t j=U11.columns(); j-- > 0UL; ) {
+         Type yj( y[first+j] );
+         for( size_t l=0UL; l<U12.columns(); ++l ) {
+            yj -= U12(j,l) * y[rows[l]];
+         }
+         for( size_t l=j+1UL; l<U11.columns(); ++l ) {
+            yj -= U11(j,l) * y[first+l];
+         }
+         y[first+j] = yj / U11(j,j);
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
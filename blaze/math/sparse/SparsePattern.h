@@ -0,0 +1,248 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SparsePattern.h
+//  \brief Header file for the SparsePattern class
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SPARSEPATTERN_H_
+#define _BLAZE_MATH_SPARSE_SPARSEPATTERN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <vector>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Snapshot of the sparsity pattern of a sparse matrix.
+// \ingroup sparse_matrix
+//
+// The SparsePattern class stores the number of non-zero elements of every row (for row-major
+// matrices) or column (for column-major matrices) of a sparse matrix and optionally the indices
+// of all non-zero elements. It is used by the PatternPlan and AssemblyPlan classes to verify
+// that the structure of a matrix has not been modified since the symbolic phase of the plan.
+// Since the comparison of the indices is as expensive as the numeric phase of the plans, the
+// indices are only recorded and compared on request.
+*/
+class SparsePattern
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline SparsePattern();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   void record( const MT& mat, bool indices );
+
+   template< typename MT >
+   bool matches( const MT& mat ) const;
+
+   inline void clear();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::vector<size_t> start_;    //!< Start of each row/column within the index array.
+   std::vector<size_t> indices_;  //!< The indices of all non-zero elements (optional).
+   bool verify_;                  //!< Flag for the recording and comparison of the indices.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The default constructor for SparsePattern.
+*/
+inline SparsePattern::SparsePattern()
+   : start_  ()         // Start of each row/column within the index array
+   , indices_()         // The indices of all non-zero elements
+   , verify_ ( false )  // Flag for the recording and comparison of the indices
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Records the sparsity pattern of the given sparse matrix.
+//
+// \param mat The sparse matrix.
+// \param indices \a true to record the indices of all non-zero elements, \a false if not.
+// \return void
+*/
+template< typename MT >  // Type of the sparse matrix
+void SparsePattern::record( const MT& mat, bool indices )
+{
+   const size_t major( IsRowMajorMatrix_v<MT> ? mat.rows() : mat.columns() );
+
+   start_.assign( major+1UL, 0UL );
+   indices_.clear();
+   verify_ = indices;
+
+   if( verify_ ) {
+      indices_.reserve( mat.nonZeros() );
+   }
+
+   for( size_t i=0UL; i<major; ++i )
+   {
+      if( verify_ ) {
+         for( auto element=mat.begin(i); element!=mat.end(i); ++element ) {
+            indices_.push_back( element->index() );
+         }
+      }
+
+      start_[i+1UL] = start_[i] + mat.nonZeros(i);
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks whether the sparsity pattern of the given sparse matrix matches the recorded
+//        sparsity pattern.
+//
+// \param mat The sparse matrix.
+// \return \a true in case the sparsity patterns match, \a false if not.
+//
+// This function compares the number of non-zero elements of all rows (or columns) and, in case
+// they have been recorded, the indices of all non-zero elements. The rows (or columns) of large
+// matrices are compared in parallel.
+*/
+template< typename MT >  // Type of the sparse matrix
+bool SparsePattern::matches( const MT& mat ) const
+{
+   const size_t major( IsRowMajorMatrix_v<MT> ? mat.rows() : mat.columns() );
+
+   if( start_.size() != major+1UL || mat.nonZeros() != start_[major] )
+      return false;
+
+   const size_t blocks( ( start_[major] < SMP_SMATASSIGN_THRESHOLD || major == 0UL )
+                        ? 1UL : min( getNumThreads(), major ) );
+
+   std::atomic<bool> valid( true );
+
+   smpFor( blocks, [&]( size_t b )
+   {
+      const size_t begin( ( major * b ) / blocks );
+      const size_t end  ( ( major * ( b+1UL ) ) / blocks );
+
+      for( size_t i=begin; i<end && valid; ++i )
+      {
+         if( mat.nonZeros(i) != start_[i+1UL] - start_[i] ) {
+            valid = false;
+            return;
+         }
+
+         if( !verify_ )
+            continue;
+
+         const size_t* index( indices_.data() + start_[i] );
+         for( auto element=mat.begin(i); element!=mat.end(i); ++element, ++index ) {
+            if( element->index() != *index ) {
+               valid = false;
+               return;
+            }
+         }
+      }
+   } );
+
+   return valid;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reset to the default initial state.
+//
+// \return void
+*/
+inline void SparsePattern::clear()
+{
+   start_.clear();
+   indices_.clear();
+   verify_ = false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -59,6 +59,17 @@ constexpr size_t DEFAULT_BLOCK_SIZE = 256UL;
 
 constexpr size_t MMM_DEFAULT_OUTER_BLOCK_SIZE = 112UL;
 constexpr size_t MMM_DEFAULT_INNER_BLOCK_SIZE =  96UL;
+
+constexpr size_t LU_DEFAULT_BLOCK_SIZE = 128UL;
+constexpr size_t LU_DEFAULT_LEAF_SIZE  =  16UL;
+
+constexpr size_t LLH_DEFAULT_BLOCK_SIZE = 128UL;
+constexpr size_t LLH_DEFAULT_LEAF_SIZE  =  16UL;
+constexpr size_t LLH_DEFAULT_TILE_SIZE  = 256UL;
+
+constexpr size_t LDLT_DEFAULT_BLOCK_SIZE = 64UL;
+
+constexpr size_t BATCH_DEFAULT_CHUNK_SIZE = 128UL;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -69,6 +80,17 @@ constexpr size_t DEBUG_BLOCK_SIZE = 8UL;
 
 constexpr size_t MMM_DEBUG_OUTER_BLOCK_SIZE = 16UL;
 constexpr size_t MMM_DEBUG_INNER_BLOCK_SIZE = 16UL;
+
+constexpr size_t LU_DEBUG_BLOCK_SIZE = 8UL;
+constexpr size_t LU_DEBUG_LEAF_SIZE  = 2UL;
+
+constexpr size_t LLH_DEBUG_BLOCK_SIZE =  8UL;
+constexpr size_t LLH_DEBUG_LEAF_SIZE  =  2UL;
+constexpr size_t LLH_DEBUG_TILE_SIZE  = 16UL;
+
+constexpr size_t LDLT_DEBUG_BLOCK_SIZE = 8UL;
+
+constexpr size_t BATCH_DEBUG_CHUNK_SIZE = 3UL;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -79,6 +101,17 @@ constexpr size_t BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? DEBUG_BLOCK_SIZE : DEFAULT_BL
 
 constexpr size_t MMM_OUTER_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? MMM_DEBUG_OUTER_BLOCK_SIZE : MMM_DEFAULT_OUTER_BLOCK_SIZE );
 constexpr size_t MMM_INNER_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? MMM_DEBUG_INNER_BLOCK_SIZE : MMM_DEFAULT_INNER_BLOCK_SIZE );
+
+constexpr size_t LU_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? LU_DEBUG_BLOCK_SIZE : LU_DEFAULT_BLOCK_SIZE );
+constexpr size_t LU_LEAF_SIZE  = ( BLAZE_DEBUG_MODE ? LU_DEBUG_LEAF_SIZE  : LU_DEFAULT_LEAF_SIZE  );
+
+constexpr size_t LLH_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? LLH_DEBUG_BLOCK_SIZE : LLH_DEFAULT_BLOCK_SIZE );
+constexpr size_t LLH_LEAF_SIZE  = ( BLAZE_DEBUG_MODE ? LLH_DEBUG_LEAF_SIZE  : LLH_DEFAULT_LEAF_SIZE  );
+constexpr size_t LLH_TILE_SIZE  = ( BLAZE_DEBUG_MODE ? LLH_DEBUG_TILE_SIZE  : LLH_DEFAULT_TILE_SIZE  );
+
+constexpr size_t LDLT_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? LDLT_DEBUG_BLOCK_SIZE : LDLT_DEFAULT_BLOCK_SIZE );
+
+constexpr size_t BATCH_CHUNK_SIZE = ( BLAZE_DEBUG_MODE ? BATCH_DEBUG_CHUNK_SIZE : BATCH_DEFAULT_CHUNK_SIZE );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -102,6 +135,15 @@ BLAZE_STATIC_ASSERT( blaze::BLOCK_SIZE >= 4UL );
 BLAZE_STATIC_ASSERT( blaze::MMM_OUTER_BLOCK_SIZE >= 16UL && blaze::MMM_OUTER_BLOCK_SIZE % 16UL == 0UL );
 BLAZE_STATIC_ASSERT( blaze::MMM_INNER_BLOCK_SIZE >= 16UL && blaze::MMM_INNER_BLOCK_SIZE % 16UL == 0UL );
 
+BLAZE_STATIC_ASSERT( blaze::LU_LEAF_SIZE >= 1UL && blaze::LU_BLOCK_SIZE >= blaze::LU_LEAF_SIZE );
+
+BLAZE_STATIC_ASSERT( blaze::LLH_LEAF_SIZE >= 1UL && blaze::LLH_BLOCK_SIZE >= blaze::LLH_LEAF_SIZE );
+BLAZE_STATIC_ASSERT( blaze::LLH_TILE_SIZE >= 1UL );
+
+BLAZE_STATIC_ASSERT( blaze::LDLT_BLOCK_SIZE >= 2UL );
+
+BLAZE_STATIC_ASSERT( blaze::BATCH_CHUNK_SIZE >= 1UL );
+
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/config/Optimizations.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -57,6 +58,8 @@ constexpr bool usePadding               = BLAZE_USE_PADDING;
 constexpr bool useStreaming             = BLAZE_USE_STREAMING;
 constexpr bool useOptimizedKernels      = BLAZE_USE_OPTIMIZED_KERNELS;
 constexpr bool useDefaultInitialization = BLAZE_USE_DEFAULT_INITIALIZATION;
+
+constexpr size_t smvmPrefetchDistance = BLAZE_SMVM_PREFETCH_DISTANCE;
 /*! \endcond */
 //*************************************************************************************************
 
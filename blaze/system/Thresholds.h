@@ -967,6 +967,51 @@ constexpr size_t SMP_SMATREDUCE_DEBUG_THRESHOLD = 16UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP sparse matrix assignment threshold.
+// \ingroup system
+//
+// This debug value is used instead of the BLAZE_SMP_SMATASSIGN_THRESHOLD while the Blaze debug mode
+// is active. It specifies when an assignment to a sparse matrix that is evaluated by one of the
+// dedicated sparse matrix kernels can be executed in parallel. In case the number of non-zero
+// elements of the target matrix is larger or equal to this threshold, the operation is executed in
+// parallel. If the number of non-zero elements is below this threshold the operation is executed
+// single-threaded.
+*/
+constexpr size_t SMP_SMATASSIGN_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sampled dense matrix multiplication threshold.
+// \ingroup system
+//
+// This debug value is used instead of the BLAZE_SMP_SDDMM_THRESHOLD while the Blaze debug mode is
+// active. It specifies when the Schur product between a sparse matrix and a dense matrix
+// multiplication can be executed in parallel. In case the number of non-zero elements of the
+// sparse matrix times the inner dimension of the dense matrix multiplication is larger or equal to
+// this threshold, the operation is executed in parallel. If the product is below this threshold
+// the operation is executed single-threaded.
+*/
+constexpr size_t SMP_SDDMM_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP semiring multiplication threshold.
+// \ingroup system
+//
+// This debug value is used instead of the BLAZE_SMP_SEMIRINGMULT_THRESHOLD while the Blaze debug
+// mode is active. It specifies when a semiring multiplication between a sparse matrix and a vector
+// or between two sparse matrices can be executed in parallel. In case the number of required
+// multiply-add operations is larger or equal to this threshold, the operation is executed in
+// parallel. If the number of operations is below this threshold the operation is executed
+// single-threaded.
+*/
+constexpr size_t SMP_SEMIRINGMULT_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 constexpr size_t SMP_DVECASSIGN_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECASSIGN_DEBUG_THRESHOLD     : BLAZE_SMP_DVECASSIGN_THRESHOLD     );
@@ -1018,6 +1063,9 @@ constexpr size_t SMP_TSMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATSM
 constexpr size_t SMP_TSMATTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATTSMATMULT_THRESHOLD );
 constexpr size_t SMP_DMATREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DMATREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_DMATREDUCE_THRESHOLD     );
 constexpr size_t SMP_SMATREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_SMATREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_SMATREDUCE_THRESHOLD     );
+constexpr size_t SMP_SMATASSIGN_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_SMATASSIGN_DEBUG_THRESHOLD     : BLAZE_SMP_SMATASSIGN_THRESHOLD     );
+constexpr size_t SMP_SDDMM_THRESHOLD          = ( BLAZE_DEBUG_MODE ? SMP_SDDMM_DEBUG_THRESHOLD          : BLAZE_SMP_SDDMM_THRESHOLD          );
+constexpr size_t SMP_SEMIRINGMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SEMIRINGMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SEMIRINGMULT_THRESHOLD   );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -41,5 +41,6 @@
 //*************************************************************************************************
 
 #include <blaze/util/serialization/Archive.h>
+#include <blaze/util/serialization/MappedFile.h>
 
 #endif
@@ -41,13 +41,33 @@
 //*************************************************************************************************
 
 #include <memory>
+#include <vector>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/Exception.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 
 
 namespace blaze {
 
+//=================================================================================================
+//
+//  GLOBAL CONSTANTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Tag marking the end of the object index of an archive.
+// \ingroup serialization
+//
+// The object index written by Archive::writeIndex() is terminated by this 64-bit tag, which
+// corresponds to the character sequence "BLZINDEX" when stored in little-endian byte order.
+*/
+constexpr uint64_t archiveIndexTag = 0x5845444E495A4C42UL;
+//*************************************************************************************************
+
+
+
 
 //=================================================================================================
 //
@@ -134,6 +154,34 @@ namespace blaze {
 // iostream) that supports the standard write or read functions, respectively. Therefore
 // the serialization of a C++ data structure is not restricted to binary files, but allows
 // for any possible destination.
+//
+// In case indexing is enabled via the setIndexing() function, the archive keeps track of the
+// position of all objects that are subsequently written via the output operator. Via the
+// writeIndex() function this information can be appended to the archive in form of an index,
+// which enables random access to the objects of an archive (see for instance the MappedArchive
+// class):
+
+   \code
+   Archive<std::ofstream> archive( "filename", std::ofstream::trunc );
+   archive.setIndexing( true );
+   archive << A << B << C;
+   archive.writeIndex();  // Appending the positions of A, B, and C to the archive
+   \endcode
+
+// The index consists of the 64-bit offsets of all top-level objects, followed by the number of
+// objects and the \c archiveIndexTag. Note that an archive with an index should only be read
+// sequentially up to the last object, since the index itself cannot be deserialized.
+//
+// Additionally, the archive can request the compression of all subsequently written vectors and
+// matrices with numeric elements via the setCompression() function. The serializers query this
+// setting and store the according objects in a compressed format, which is detected and handled
+// automatically during deserialization:
+
+   \code
+   Archive<std::ofstream> archive( "filename", std::ofstream::trunc );
+   archive.setCompression( true );
+   archive << A << B;  // A and B are stored in compressed format
+   \endcode
 */
 template< typename Stream >  // Type of the bound stream
 class Archive
@@ -195,6 +243,8 @@ class Archive
 
    template< typename Type >
    inline EnableIf_t< IsNumeric_v<Type>, Archive& > read ( Type* array, size_t count );
+
+   inline Archive& writeIndex();
    //@}
    //**********************************************************************************************
 
@@ -203,6 +253,14 @@ class Archive
    //@{
    inline typename Stream::int_type peek() const;
 
+   inline size_t bytesWritten() const noexcept;
+
+   inline void setCompression( bool compression ) noexcept;
+   inline bool getCompression() const noexcept;
+
+   inline void setIndexing( bool indexing ) noexcept;
+   inline bool getIndexing() const noexcept;
+
    inline bool good() const;
    inline bool eof () const;
    inline bool fail() const;
@@ -223,6 +281,11 @@ class Archive
                                        this smart pointer handles the internally allocated stream
                                        resource. */
    Stream& stream_;               //!< Reference to the bound stream.
+   size_t written_;               //!< The number of bytes written to the archive.
+   size_t depth_;                 //!< The current nesting depth of serialized objects.
+   std::vector<uint64_t> index_;  //!< The offsets of all serialized top-level objects.
+   bool compression_;             //!< Compression flag for vectors and matrices.
+   bool indexing_;                //!< Indexing flag for top-level objects.
    //@}
    //**********************************************************************************************
 };
@@ -248,8 +311,13 @@ class Archive
 template< typename Stream >   // Type of the bound stream
 template< typename... Args >  // Types of the optional arguments
 inline Archive<Stream>::Archive( Args&&... args )
-   : ptr_   ( new Stream( std::forward<Args>( args )... ) )  // The dynamically allocated stream resource
-   , stream_( *ptr_.get() )                                  // Reference to the bound stream
+   : ptr_        ( new Stream( std::forward<Args>( args )... ) )  // The internally allocated stream
+   , stream_     ( *ptr_.get() )                                  // Reference to the bound stream
+   , written_    ( 0UL )                                          // The number of written bytes
+   , depth_      ( 0UL )                                          // The current nesting depth
+   , index_      ()                                               // The top-level object offsets
+   , compression_( false )                                        // The compression flag
+   , indexing_   ( false )                                        // The indexing flag
 {}
 //*************************************************************************************************
 
@@ -264,8 +332,13 @@ inline Archive<Stream>::Archive( Args&&... args )
 */
 template< typename Stream >  // Type of the bound stream
 inline Archive<Stream>::Archive( Stream& stream )
-   : ptr_   ()          // The dynamically allocated stream resource
-   , stream_( stream )  // Reference to the bound stream
+   : ptr_        ()          // The dynamically allocated stream resource
+   , stream_     ( stream )  // Reference to the bound stream
+   , written_    ( 0UL )     // The number of written bytes
+   , depth_      ( 0UL )     // The current nesting depth
+   , index_      ()          // The offsets of all top-level objects
+   , compression_( false )   // Compression flag for vectors and matrices
+   , indexing_   ( false )   // Indexing flag for top-level objects
 {}
 //*************************************************************************************************
 
@@ -332,6 +405,7 @@ EnableIf_t< IsNumeric_v<T>, Archive<Stream>& > Archive<Stream>::operator<<( cons
 {
    using CharType = typename Stream::char_type;
    stream_.write( reinterpret_cast<const CharType*>( &value ), sizeof( T ) );
+   written_ += sizeof( T );
    return *this;
 }
 //*************************************************************************************************
@@ -342,12 +416,30 @@ EnableIf_t< IsNumeric_v<T>, Archive<Stream>& > Archive<Stream>::operator<<( cons
 //
 // \param value The user-defined object to be serialized.
 // \return Reference to the archive.
+//
+// In case indexing is enabled and the object is not nested within another serialized object,
+// its position within the archive is recorded for the object index (see writeIndex()).
 */
 template< typename Stream >  // Type of the bound stream
 template< typename T >       // Type of the object to be serialized
 DisableIf_t< IsNumeric_v<T>, Archive<Stream>& > Archive<Stream>::operator<<( const T& value )
 {
-   serialize( *this, value );
+   if( indexing_ && depth_ == 0UL ) {
+      index_.push_back( written_ );
+   }
+
+   ++depth_;
+
+   try {
+      serialize( *this, value );
+   }
+   catch( ... ) {
+      --depth_;
+      throw;
+   }
+
+   --depth_;
+
    return *this;
 }
 //*************************************************************************************************
@@ -402,6 +494,7 @@ inline EnableIf_t< IsNumeric_v<Type>, Archive<Stream>& >
 {
    using CharType = typename Stream::char_type;
    stream_.write( reinterpret_cast<const CharType*>( array ), count*sizeof(Type) );
+   written_ += count*sizeof(Type);
    return *this;
 }
 //*************************************************************************************************
@@ -430,6 +523,37 @@ inline EnableIf_t< IsNumeric_v<Type>, Archive<Stream>& >
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Appending the object index to the archive.
+//
+// \return Reference to the archive.
+// \exception std::logic_error Indexing is not enabled.
+//
+// This function appends the index of all top-level objects that have been written to the
+// archive since indexing has been enabled (see setIndexing()). The index consists of the 64-bit
+// offsets of the objects relative to the beginning of the archive, the 64-bit number of objects,
+// and the \c archiveIndexTag. The index enables random access to the objects of the archive via
+// the MappedArchive class. Note that the function should only be called once, after the last
+// object has been written. In case indexing is not enabled, a \a std::logic_error exception is
+// thrown.
+*/
+template< typename Stream >  // Type of the bound stream
+inline Archive<Stream>& Archive<Stream>::writeIndex()
+{
+   if( !indexing_ ) {
+      BLAZE_THROW_LOGIC_ERROR( "Indexing is not enabled" );
+   }
+
+   const uint64_t number( index_.size() );
+
+   write( index_.data(), index_.size() );
+   *this << number << archiveIndexTag;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -451,6 +575,86 @@ inline typename Stream::int_type Archive<Stream>::peek() const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns the number of bytes written to the archive.
+//
+// \return The number of bytes written to the archive.
+//
+// This function returns the number of bytes that have been written via the archive since its
+// construction. Serialization functions can use this information to align their data relative
+// to the beginning of the archive.
+*/
+template< typename Stream >  // Type of the bound stream
+inline size_t Archive<Stream>::bytesWritten() const noexcept
+{
+   return written_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Enables or disables the compression of vectors and matrices.
+//
+// \param compression \a true to enable the compression, \a false to disable it.
+// \return void
+//
+// This function specifies whether all subsequently serialized vectors and matrices with numeric
+// elements are written in compressed format. By default, compression is disabled. The setting
+// has no effect on deserialization, since compressed objects are detected automatically.
+*/
+template< typename Stream >  // Type of the bound stream
+inline void Archive<Stream>::setCompression( bool compression ) noexcept
+{
+   compression_ = compression;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether vectors and matrices are written in compressed format.
+//
+// \return \a true in case compression is enabled, \a false if not.
+*/
+template< typename Stream >  // Type of the bound stream
+inline bool Archive<Stream>::getCompression() const noexcept
+{
+   return compression_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Enables or disables the indexing of top-level objects.
+//
+// \param indexing \a true to enable the indexing, \a false to disable it.
+// \return void
+//
+// This function specifies whether the offsets of all subsequently written top-level objects are
+// recorded for the object index (see writeIndex()). By default, indexing is disabled, in which
+// case no memory is spent on the offsets. In order to index all objects of an archive, indexing
+// has to be enabled before the first object is written.
+*/
+template< typename Stream >  // Type of the bound stream
+inline void Archive<Stream>::setIndexing( bool indexing ) noexcept
+{
+   indexing_ = indexing;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the offsets of top-level objects are recorded.
+//
+// \return \a true in case indexing is enabled, \a false if not.
+*/
+template< typename Stream >  // Type of the bound stream
+inline bool Archive<Stream>::getIndexing() const noexcept
+{
+   return indexing_;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Checks if no error has occurred, i.e. I/O operations are available.
 //
@@ -0,0 +1,255 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/serialization/MappedFile.h
+//  \brief Header file for the MappedFile class
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_SERIALIZATION_MAPPEDFILE_H_
+#define _BLAZE_UTIL_SERIALIZATION_MAPPEDFILE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <string>
+#include <blaze/system/Platform.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+#if BLAZE_WIN32_PLATFORM || BLAZE_WIN64_PLATFORM || BLAZE_MINGW32_PLATFORM || BLAZE_MINGW64_PLATFORM
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Memory mapping of an entire file.
+// \ingroup serialization
+//
+// The MappedFile class maps a file into memory for the lifetime of the MappedFile instance. The
+// file is mapped copy-on-write: pages are shared with other processes as long as they are only
+// read, and modifications of the mapped memory are private to the process and never written
+// back to the file.
+
+   \code
+   blaze::MappedFile file( "data.bin" );
+
+   const blaze::byte_t* first( file.data() );
+   const blaze::byte_t* last ( file.data() + file.size() );
+   \endcode
+
+// The MappedFile class is the common basis of all readers that work directly on the contents of
+// a file (as for instance the MappedArchive class).
+*/
+class MappedFile
+   : private NonCopyable
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MappedFile( const std::string& filename );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~MappedFile();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline byte_t* data() const noexcept;
+   inline size_t  size() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   byte_t* data_;  //!< The first byte of the mapped file.
+   size_t  size_;  //!< The size of the mapped file in bytes.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Maps the given file into memory.
+//
+// \param filename The name of the file to be mapped.
+// \exception std::runtime_error File could not be opened.
+// \exception std::runtime_error File could not be mapped.
+*/
+inline MappedFile::MappedFile( const std::string& filename )
+   : data_( nullptr )  // The first byte of the mapped file
+   , size_( 0UL )      // The size of the mapped file in bytes
+{
+#if BLAZE_WIN32_PLATFORM || BLAZE_WIN64_PLATFORM || BLAZE_MINGW32_PLATFORM || BLAZE_MINGW64_PLATFORM
+   HANDLE file( CreateFileA( filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                             OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr ) );
+   LARGE_INTEGER bytes;
+
+   if( file == INVALID_HANDLE_VALUE || !GetFileSizeEx( file, &bytes ) ) {
+      if( file != INVALID_HANDLE_VALUE ) CloseHandle( file );
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be opened" );
+   }
+
+   size_ = static_cast<size_t>( bytes.QuadPart );
+
+   if( size_ > 0UL ) {
+      HANDLE mapping( CreateFileMappingA( file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr ) );
+      void* view( mapping != nullptr ? MapViewOfFile( mapping, FILE_MAP_COPY, 0, 0, 0 ) : nullptr );
+      if( mapping != nullptr ) CloseHandle( mapping );
+      if( view == nullptr ) {
+         CloseHandle( file );
+         BLAZE_THROW_RUNTIME_ERROR( "File could not be mapped" );
+      }
+      data_ = static_cast<byte_t*>( view );
+   }
+
+   CloseHandle( file );
+#else
+   const int fd( ::open( filename.c_str(), O_RDONLY ) );
+   struct stat info;
+
+   if( fd == -1 || ::fstat( fd, &info ) != 0 ) {
+      if( fd != -1 ) ::close( fd );
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be opened" );
+   }
+
+   size_ = static_cast<size_t>( info.st_size );
+
+   if( size_ > 0UL ) {
+      void* view( ::mmap( nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 ) );
+      if( view == MAP_FAILED ) {
+         ::close( fd );
+         BLAZE_THROW_RUNTIME_ERROR( "File could not be mapped" );
+      }
+      data_ = static_cast<byte_t*>( view );
+   }
+
+   ::close( fd );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor of the MappedFile class.
+//
+// The destructor unmaps the file. All pointers into the mapped memory become invalid.
+*/
+inline MappedFile::~MappedFile()
+{
+   if( data_ == nullptr ) return;
+
+#if BLAZE_WIN32_PLATFORM || BLAZE_WIN64_PLATFORM || BLAZE_MINGW32_PLATFORM || BLAZE_MINGW64_PLATFORM
+   UnmapViewOfFile( data_ );
+#else
+   ::munmap( data_, size_ );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first byte of the mapped file.
+//
+// \return Pointer to the mapped memory (\c nullptr in case of an empty file).
+*/
+inline byte_t* MappedFile::data() const noexcept
+{
+   return data_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the mapped file.
+//
+// \return The size of the mapped file in bytes.
+*/
+inline size_t MappedFile::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,119 @@
+//=================================================================================================
+/*!
+//  \file src/blaze/MixedSolve.cpp
+//  \brief Source file for the Blaze mixed-precision LSE kernel
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iostream>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Timing.h>
+#include <blazemark/blaze/MixedSolve.h>
+#include <blazemark/system/Config.h>
+
+namespace blazemark {
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  KERNEL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Blaze mixed-precision LSE kernel.
+//
+// \param N The number of rows and columns of the system matrix.
+// \param steps The number of iteration steps to perform.
+// \param mixed \a true for the mixed-precision solver, \a false for the double precision solver.
+// \return Minimum runtime of the kernel function.
+//
+// This kernel function solves a diagonally dominant \f$ N \times N \f$ double precision LSE
+// either by means of the mixed-precision solveMixed() function (single precision LU
+// decomposition and iterative refinement) or by means of the double precision solve()
+// function.
+*/
+double mixedsolve( size_t N, size_t steps, bool mixed )
+{
+   using ::blaze::columnVector;
+   using ::blaze::columnMajor;
+
+   ::blaze::setSeed( seed );
+
+   ::blaze::DynamicMatrix<double,columnMajor> A( N, N );
+   ::blaze::DynamicVector<double,columnVector> b( N ), x( N );
+   ::blaze::timing::WcTimer timer;
+
+   randomize( A );
+   randomize( b );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      A(i,i) += N;
+   }
+
+   for( size_t rep=0UL; rep<reps; ++rep )
+   {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         if( mixed )
+            ::blaze::solveMixed( A, x, b );
+         else
+            ::blaze::solve( A, x, b );
+      }
+      timer.end();
+
+      if( x.size() != N )
+         std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+
+      if( timer.last() > maxtime )
+         break;
+   }
+
+   const double minTime( timer.min()     );
+   const double avgTime( timer.average() );
+
+   if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
+      std::cerr << " Blaze kernel 'mixedsolve': Time deviation too large!!!\n";
+
+   return minTime;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+} // namespace blazemark
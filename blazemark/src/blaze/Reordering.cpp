@@ -0,0 +1,158 @@
+//=================================================================================================
+/*!
+//  \file src/blaze/Reordering.cpp
+//  \brief Source file for the Blaze reordered sparse matrix/dense vector multiplication kernel
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Timing.h>
+#include <blazemark/blaze/init/DynamicVector.h>
+#include <blazemark/blaze/Reordering.h>
+#include <blazemark/system/Config.h>
+
+namespace blazemark {
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  KERNEL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Blaze reordered sparse matrix/dense vector multiplication kernel.
+//
+// \param N The number of grid points in x- and y-direction of the 2D discretized grid.
+// \param steps The number of iteration steps to perform.
+// \param ordering The numbering of the grid points.
+// \return Minimum runtime of the kernel function.
+//
+// This kernel function implements the sparse matrix/dense vector multiplication with the 5-point
+// stencil matrix of a 2D grid with randomly numbered grid points, optionally after reordering
+// the matrix by means of a bandwidth-reducing ordering.
+*/
+double reordering( size_t N, size_t steps, Ordering ordering )
+{
+   using ::blazemark::element_t;
+   using ::blaze::columnVector;
+   using ::blaze::rowMajor;
+
+   ::blaze::setSeed( seed );
+
+   const size_t NN( N*N );
+
+   std::vector<size_t> label( NN ), point( NN );
+   for( size_t k=0UL; k<NN; ++k ) {
+      label[k] = k;
+   }
+   for( size_t k=NN; k>1UL; --k ) {
+      std::swap( label[k-1UL], label[::blaze::rand<size_t>( 0UL, k-1UL )] );
+   }
+   for( size_t k=0UL; k<NN; ++k ) {
+      point[label[k]] = k;
+   }
+
+   std::vector<size_t> nnz( NN, 5UL );
+   for( size_t i=0UL; i<N; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         if( i == 0UL || i == N-1UL ) --nnz[label[i*N+j]];
+         if( j == 0UL || j == N-1UL ) --nnz[label[i*N+j]];
+      }
+   }
+
+   ::blaze::CompressedMatrix<element_t,rowMajor> A( NN, NN, nnz );
+   ::blaze::DynamicVector<element_t,columnVector> a( NN ), b( NN );
+   ::blaze::timing::WcTimer timer;
+   std::vector<size_t> neighbors;
+
+   for( size_t k=0UL; k<NN; ++k ) {
+      const size_t i( point[k] / N );
+      const size_t j( point[k] % N );
+      neighbors.clear();
+      if( i > 0UL   ) neighbors.push_back( label[(i-1UL)*N+j] );  // Top neighbor
+      if( j > 0UL   ) neighbors.push_back( label[i*N+j-1UL]   );  // Left neighbor
+      neighbors.push_back( k );
+      if( j < N-1UL ) neighbors.push_back( label[i*N+j+1UL]   );  // Right neighbor
+      if( i < N-1UL ) neighbors.push_back( label[(i+1UL)*N+j] );  // Bottom neighbor
+      std::sort( neighbors.begin(), neighbors.end() );
+      for( size_t neighbor : neighbors ) {
+         A.append( k, neighbor, ( neighbor == k ) ? 4.0 : -1.0 );
+      }
+   }
+
+   if( ordering == rcmOrdering ) {
+      A = ::blaze::permute( A, ::blaze::rcm( A ) );
+   }
+   else if( ordering == ndOrdering ) {
+      A = ::blaze::permute( A, ::blaze::nestedDissection( A ) );
+   }
+
+   init( a );
+
+   for( size_t rep=0UL; rep<reps; ++rep )
+   {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         b = A * a;
+      }
+      timer.end();
+
+      if( b.size() != NN )
+         std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+
+      if( timer.last() > maxtime )
+         break;
+   }
+
+   const double minTime( timer.min()     );
+   const double avgTime( timer.average() );
+
+   if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
+      std::cerr << " Blaze kernel 'reordering': Time deviation too large!!!\n";
+
+   return minTime;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+} // namespace blazemark
@@ -0,0 +1,631 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/lapack/BatchTest.h
+//  \brief Header file for the batch decomposition, inversion and solver test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_LAPACK_BATCHTEST_H_
+#define _BLAZETEST_MATHTEST_LAPACK_BATCHTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+#include <blaze/math/dense/Batch.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/IdentityMatrix.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/SymmetricMatrix.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace lapack {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the batch decomposition, inversion and solver functions.
+//
+// This class represents a test suite for the batched functions for small dense matrices.
+*/
+class BatchTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit BatchTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type > void testLU();
+   template< typename Type > void testLLH();
+   template< typename Type > void testInvert();
+   template< typename Type > void testDet();
+   template< typename Type > void testSolve();
+   template< typename Type > void testEigen();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   static blaze::DynamicMatrix<Type>
+      extract( const blaze::DynamicMatrix<Type,blaze::rowMajor>& A, size_t m, size_t n, size_t b );
+
+   template< typename Type >
+   static blaze::DynamicMatrix<Type,blaze::rowMajor> createBatch( size_t n, size_t count );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   //! Combinations of matrix sizes and batch sizes used in all tests.
+   using Sizes = std::vector< std::pair<size_t,size_t> >;
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   const Sizes sizes_{ { 1UL, 1UL }, { 4UL, 37UL }, { 9UL, 300UL } };  //!< Tested sizes.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the batched LU decomposition (batchLU).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the batched LU decomposition for various data types. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void BatchTest::testLU()
+{
+   test_ = "Batched LU decomposition";
+
+   for( const auto& size : sizes_ )
+   {
+      const size_t n    ( size.first  );
+      const size_t count( size.second );
+
+      const blaze::DynamicMatrix<Type,blaze::rowMajor> A( createBatch<Type>( n, count ) );
+
+      blaze::DynamicMatrix<Type,blaze::rowMajor> LU( A );
+      blaze::DynamicMatrix<int,blaze::rowMajor> P( n, count );
+
+      blaze::batchLU( LU, P );
+
+      for( size_t b=0UL; b<count; ++b )
+      {
+         const blaze::DynamicMatrix<Type> F( extract( LU, n, n, b ) );
+         blaze::DynamicMatrix<Type> L( n, n, Type() ), U( n, n, Type() );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            for( size_t j=0UL; j<n; ++j ) {
+               if( i > j ) L(i,j) = F(i,j);
+               else        U(i,j) = F(i,j);
+            }
+            L(i,i) = Type(1);
+         }
+
+         blaze::DynamicMatrix<Type> B( L * U );
+
+         for( size_t k=n; k-- > 0UL; ) {
+            const size_t p( P(k,b) );
+            for( size_t j=0UL; p != k && j<n; ++j ) {
+               std::swap( B(k,j), B(p,j) );
+            }
+         }
+
+         if( blaze::maxNorm( B - extract( A, n, n, b ) ) > 1E-8 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: LU decomposition failed\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Matrix size: " << n << "x" << n << "\n"
+                << "   Matrix index: " << b << " of " << count << "\n"
+                << "   Maximum reconstruction error: "
+                << blaze::maxNorm( B - extract( A, n, n, b ) ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched Cholesky decomposition (batchLLH).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the batched Cholesky decomposition for various data types.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void BatchTest::testLLH()
+{
+   test_ = "Batched Cholesky decomposition";
+
+   for( const auto& size : sizes_ )
+   {
+      const size_t n    ( size.first  );
+      const size_t count( size.second );
+
+      const blaze::DynamicMatrix<Type,blaze::rowMajor> R( createBatch<Type>( n, count ) );
+      blaze::DynamicMatrix<Type,blaze::rowMajor> A( n*n, count );
+
+      for( size_t b=0UL; b<count; ++b ) {
+         const blaze::DynamicMatrix<Type> Rb( extract( R, n, n, b ) );
+         const blaze::DynamicMatrix<Type> Ab( Rb * ctrans( Rb ) );
+         for( size_t i=0UL; i<n*n; ++i ) {
+            A(i,b) = Ab(i/n,i%n);
+         }
+      }
+
+      blaze::DynamicMatrix<Type,blaze::rowMajor> L( A );
+      blaze::batchLLH( L );
+
+      for( size_t b=0UL; b<count; ++b )
+      {
+         blaze::DynamicMatrix<Type> Lb( extract( L, n, n, b ) );
+         for( size_t i=0UL; i<n; ++i ) {
+            for( size_t j=i+1UL; j<n; ++j ) {
+               Lb(i,j) = Type();
+            }
+         }
+
+         if( blaze::maxNorm( Lb * ctrans( Lb ) - extract( A, n, n, b ) ) > 1E-8 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Cholesky decomposition failed\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Matrix size: " << n << "x" << n << "\n"
+                << "   Matrix index: " << b << " of " << count << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      blaze::DynamicMatrix<Type,blaze::rowMajor> A( 9UL, 10UL, Type(1) );
+
+      bool detected( false );
+
+      try {
+         blaze::batchLLH( A );
+      }
+      catch( std::runtime_error& ) {
+         detected = true;
+      }
+
+      if( !detected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Detection of non-positive-definite matrix failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched matrix inversion (batchInvert).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the batched matrix inversion for various data types. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void BatchTest::testInvert()
+{
+   test_ = "Batched matrix inversion";
+
+   for( const auto& size : sizes_ )
+   {
+      const size_t n    ( size.first  );
+      const size_t count( size.second );
+
+      const blaze::DynamicMatrix<Type,blaze::rowMajor> A( createBatch<Type>( n, count ) );
+
+      blaze::DynamicMatrix<Type,blaze::rowMajor> X( A );
+      blaze::batchInvert( X );
+
+      for( size_t b=0UL; b<count; ++b )
+      {
+         const blaze::DynamicMatrix<Type> I( extract( A, n, n, b ) * extract( X, n, n, b ) );
+
+         if( blaze::maxNorm( I - blaze::IdentityMatrix<Type>( n ) ) > 1E-8 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Matrix inversion failed\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Matrix size: " << n << "x" << n << "\n"
+                << "   Matrix index: " << b << " of " << count << "\n"
+                << "   Result:\n" << I << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      blaze::DynamicMatrix<Type,blaze::rowMajor> A( createBatch<Type>( 3UL, 10UL ) );
+      submatrix( A, 3UL, 0UL, 3UL, 10UL ) = Type();
+
+      bool detected( false );
+
+      try {
+         blaze::batchInvert( A );
+      }
+      catch( std::runtime_error& ) {
+         detected = true;
+      }
+
+      if( !detected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Detection of singular matrix failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched determinant computation (batchDet).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the batched determinant computation for various data types.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void BatchTest::testDet()
+{
+   test_ = "Batched determinant computation";
+
+   for( const auto& size : sizes_ )
+   {
+      const size_t n    ( size.first  );
+      const size_t count( size.second );
+
+      const blaze::DynamicMatrix<Type,blaze::rowMajor> A( createBatch<Type>( n, count ) );
+      const blaze::DynamicMatrix<Type,blaze::rowMajor> B( A );
+
+      blaze::DynamicVector<Type,blaze::rowVector> d( count );
+      blaze::batchDet( A, d );
+
+      for( size_t b=0UL; b<count; ++b )
+      {
+         const Type ref( det( extract( A, n, n, b ) ) );
+
+         if( abs( d[b] - ref ) > 1E-8 * blaze::max( 1.0, abs( ref ) ) || A != B ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Determinant computation failed\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Matrix size: " << n << "x" << n << "\n"
+                << "   Matrix index: " << b << " of " << count << "\n"
+                << "   Result: " << d[b] << "\n"
+                << "   Expected result: " << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched linear system solver (batchSolve).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the batched linear system solver for various data types. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void BatchTest::testSolve()
+{
+   test_ = "Batched linear system solver";
+
+   for( const auto& size : sizes_ )
+   {
+      const size_t n    ( size.first  );
+      const size_t count( size.second );
+      const size_t m    ( 2UL );
+
+      const blaze::DynamicMatrix<Type,blaze::rowMajor> A( createBatch<Type>( n, count ) );
+
+      blaze::DynamicMatrix<Type,blaze::rowMajor> B( n*m, count );
+      randomize( B );
+
+      blaze::DynamicMatrix<Type,blaze::rowMajor> LU( A ), X( B );
+      blaze::batchSolve( LU, X );
+
+      for( size_t b=0UL; b<count; ++b )
+      {
+         const blaze::DynamicMatrix<Type> R( extract( A, n, n, b ) * extract( X, n, m, b ) );
+
+         if( blaze::maxNorm( R - extract( B, n, m, b ) ) > 1E-8 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Solving the linear system failed\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Matrix size: " << n << "x" << n << "\n"
+                << "   Matrix index: " << b << " of " << count << "\n"
+                << "   Maximum residual: " << blaze::maxNorm( R - extract( B, n, m, b ) ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched symmetric eigenvalue computation (batchEigen).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the batched symmetric eigenvalue computation for various
+// data types. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void BatchTest::testEigen()
+{
+   test_ = "Batched symmetric eigenvalue computation";
+
+   for( const auto& size : sizes_ )
+   {
+      const size_t n    ( size.first  );
+      const size_t count( size.second );
+
+      const blaze::DynamicMatrix<Type,blaze::rowMajor> A( createBatch<Type>( n, count ) );
+
+      blaze::DynamicMatrix<Type,blaze::rowMajor> W1( n, count ), W2( n, count ), V( n*n, count );
+      blaze::batchEigen( A, W1 );
+      blaze::batchEigen( A, W2, V );
+
+      for( size_t b=0UL; b<count; ++b )
+      {
+         const blaze::DynamicMatrix<Type> L( extract( A, n, n, b ) );
+
+         blaze::SymmetricMatrix< blaze::DynamicMatrix<Type> > S( n );
+         for( size_t i=0UL; i<n; ++i ) {
+            for( size_t j=0UL; j<=i; ++j ) {
+               S(i,j) = L(i,j);
+            }
+         }
+
+         blaze::DynamicVector<Type,blaze::columnVector> ref;
+         eigen( S, ref );
+
+         blaze::DynamicMatrix<Type> D( n, n, Type(0) );
+         for( size_t i=0UL; i<n; ++i ) {
+            D(i,i) = W2(i,b);
+         }
+
+         const blaze::DynamicMatrix<Type> X( extract( V, n, n, b ) );
+         const blaze::DynamicMatrix<Type> R( S*X - X*D );
+         const blaze::DynamicMatrix<Type> I( trans( X ) * X );
+
+         if( blaze::maxNorm( column( W1, b ) - ref ) > 1E-8 * blaze::max( 1.0, maxNorm( ref ) ) ||
+             column( W1, b ) != column( W2, b ) || blaze::maxNorm( R ) > 1E-8 * Type( n ) ||
+             blaze::maxNorm( I - blaze::IdentityMatrix<Type>( n ) ) > 1E-8 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Eigenvalue computation failed\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Matrix size: " << n << "x" << n << "\n"
+                << "   Matrix index: " << b << " of " << count << "\n"
+                << "   Result:\n" << column( W1, b ) << "\n"
+                << "   Expected result:\n" << ref << "\n"
+                << "   Maximum residual: " << blaze::maxNorm( R ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Extraction of a single matrix from a batch of interleaved matrices.
+//
+// \param A The batch of interleaved matrices.
+// \param m The number of rows of the matrices.
+// \param n The number of columns of the matrices.
+// \param b The index of the matrix to be extracted.
+// \return The extracted matrix.
+*/
+template< typename Type >
+blaze::DynamicMatrix<Type>
+   BatchTest::extract( const blaze::DynamicMatrix<Type,blaze::rowMajor>& A,
+                       size_t m, size_t n, size_t b )
+{
+   blaze::DynamicMatrix<Type> M( m, n );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         M(i,j) = A(i*n+j,b);
+      }
+   }
+
+   return M;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creation of a batch of random, well-conditioned matrices.
+//
+// \param n The number of rows/columns of the matrices.
+// \param count The number of matrices.
+// \return The batch of interleaved matrices.
+*/
+template< typename Type >
+blaze::DynamicMatrix<Type,blaze::rowMajor> BatchTest::createBatch( size_t n, size_t count )
+{
+   blaze::DynamicMatrix<Type,blaze::rowMajor> A( n*n, count );
+   randomize( A );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      row( A, i*n+i ) += Type( n );
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the batch decomposition, inversion and solver functions.
+//
+// \return void
+*/
+void runTest()
+{
+   BatchTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the batch decomposition, inversion and solver test.
+*/
+#define RUN_LAPACK_BATCH_TEST \
+   blazetest::mathtest::lapack::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace lapack
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -44,6 +44,16 @@
 #include <stdexcept>
 #include <string>
 #include <typeinfo>
+#include <utility>
+#include <vector>
+#include <blaze/math/dense/BlockedLDLT.h>
+#include <blaze/math/dense/BlockedLLH.h>
+#include <blaze/math/dense/BlockedLU.h>
+#include <blaze/math/dense/DenseCholesky.h>
+#include <blaze/math/dense/DenseLU.h>
+#include <blaze/math/dense/DenseQR.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
 #include <blaze/math/HermitianMatrix.h>
 #include <blaze/math/LAPACK.h>
 #include <blaze/math/LowerMatrix.h>
@@ -95,9 +105,13 @@ class DecompositionTest
    /*!\name Test functions */
    //@{
    template< typename Type > void testGetrf();
+   template< typename Type > void testGetrfBlocked();
    template< typename Type > void testSytrf();
    template< typename Type > void testHetrf();
    template< typename Type > void testPotrf();
+   template< typename Type > void testSytrfBlocked();
+   template< typename Type > void testHetrfBlocked();
+   template< typename Type > void testPotrfBlocked();
 
    template< typename Type > void testGeqrf();
    template< typename Type > void testOrgqr();
@@ -130,6 +144,10 @@ class DecompositionTest
    template< typename Type > void testUngl2();
    template< typename Type > void testOrmlq();
    template< typename Type > void testUnmlq();
+
+   template< typename Type > void testDenseCholesky();
+   template< typename Type > void testDenseLU();
+   template< typename Type > void testDenseQR();
    //@}
    //**********************************************************************************************
 
@@ -226,6 +244,335 @@ void DecompositionTest::testGetrf()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the native blocked LU decomposition functions (getrfBlocked).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the native blocked LU decomposition functions for various
+// data types. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DecompositionTest::testGetrfBlocked()
+{
+   test_ = "Native blocked LU decomposition";
+
+   const std::vector< std::pair<size_t,size_t> > sizes{
+      { 1UL, 1UL }, { 7UL, 7UL }, { 150UL, 150UL }, { 170UL, 90UL }, { 90UL, 170UL } };
+
+   for( const auto& size : sizes )
+   {
+      const size_t m( size.first  );
+      const size_t n( size.second );
+      const size_t mindim( blaze::min( m, n ) );
+
+      blaze::DynamicMatrix<Type,blaze::columnMajor> A( m, n );
+      randomize( A );
+
+      blaze::DynamicMatrix<Type,blaze::columnMajor> LU( A );
+      blaze::DynamicMatrix<Type,blaze::rowMajor> LUT( trans( A ) );
+
+      std::vector<blaze::blas_int_t> ipiv ( mindim );
+      std::vector<blaze::blas_int_t> ipivT( mindim );
+
+      const blaze::blas_int_t info ( blaze::getrfBlocked( LU , ipiv.data()  ) );
+      const blaze::blas_int_t infoT( blaze::getrfBlocked( LUT, ipivT.data() ) );
+
+      blaze::DynamicMatrix<Type,blaze::columnMajor> L( m, mindim, Type() );
+      blaze::DynamicMatrix<Type,blaze::columnMajor> U( mindim, n, Type() );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            if( i > j && j < mindim ) L(i,j) = LU(i,j);
+            else if( i <= j && i < mindim ) U(i,j) = LU(i,j);
+         }
+         if( i < mindim ) L(i,i) = Type(1);
+      }
+
+      blaze::DynamicMatrix<Type,blaze::columnMajor> B( L * U );
+
+      for( size_t k=mindim; k-- > 0UL; ) {
+         const size_t p( ipiv[k] - 1 );
+         if( p != k ) {
+            const blaze::DynamicVector<Type,blaze::rowVector> tmp( row( B, k ) );
+            row( B, k ) = row( B, p );
+            row( B, p ) = tmp;
+         }
+      }
+
+      if( info != 0 || infoT != 0 || ipiv != ipivT ||
+          blaze::maxNorm( B - A ) > 1E-8 || blaze::maxNorm( LU - trans( LUT ) ) > 1E-8 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: LU decomposition failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Matrix size: " << m << "x" << n << "\n"
+             << "   Maximum reconstruction error: " << blaze::maxNorm( B - A ) << "\n"
+             << "   Maximum storage order error : " << blaze::maxNorm( LU - trans( LUT ) ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( m == n )
+      {
+         blaze::DynamicVector<Type,blaze::columnVector> b( n ), x;
+         randomize( b );
+         x = b;
+
+         blaze::getrsBlocked( LU, x, ipiv.data() );
+
+         blaze::DynamicMatrix<Type,blaze::columnMajor> X( LU );
+         blaze::getriBlocked( X, ipiv.data() );
+
+         if( blaze::maxNorm( A * x - b ) > 1E-8 ||
+             blaze::maxNorm( A * X - blaze::IdentityMatrix<Type>( n ) ) > 1E-8 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Solving LSE based on LU decomposition failed\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Matrix size: " << m << "x" << n << "\n"
+                << "   Maximum residual: " << blaze::maxNorm( A * x - b ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      blaze::DynamicMatrix<Type,blaze::rowMajor> A( 40UL, 40UL );
+      randomize( A );
+      row( A, 17UL ) = Type(0);
+
+      std::vector<blaze::blas_int_t> ipiv( 40UL );
+
+      const blaze::blas_int_t info( blaze::getrfBlocked( A, ipiv.data() ) );
+
+      if( info != 18 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Detection of singular matrix failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Result: " << info << "\n"
+             << "   Expected result: 18\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native blocked Bunch-Kaufman decomposition functions (sytrfBlocked).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the native blocked Bunch-Kaufman decomposition functions for
+// symmetric indefinite matrices for various data types. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DecompositionTest::testSytrfBlocked()
+{
+   test_ = "Native blocked symmetric matrix decomposition";
+
+   for( size_t n : { 1UL, 7UL, 150UL } )
+   {
+      blaze::DynamicMatrix<Type,blaze::columnMajor> A( n, n );
+      randomize( A );
+      A += trans( A );
+      diagonal( A ) *= Type( 0.01 );
+
+      blaze::DynamicMatrix<Type,blaze::columnMajor> LDLT( A );
+      blaze::DynamicMatrix<Type,blaze::rowMajor> LDLTT( A );
+
+      std::vector<blaze::blas_int_t> ipiv ( n );
+      std::vector<blaze::blas_int_t> ipivT( n );
+
+      blaze::sytrfBlocked( LDLT , ipiv.data()  );
+      blaze::sytrfBlocked( LDLTT, ipivT.data() );
+
+      blaze::DynamicVector<Type,blaze::columnVector> b( n ), x;
+      randomize( b );
+      x = b;
+
+      blaze::sytrsBlocked( LDLT, x, ipiv.data() );
+
+      blaze::DynamicMatrix<Type,blaze::columnMajor> X( LDLT );
+      blaze::sytriBlocked( X, ipiv.data() );
+
+      if( ipiv != ipivT ||
+          blaze::maxNorm( A * x - b ) > 1E-8 ||
+          blaze::maxNorm( A * X - blaze::IdentityMatrix<Type>( n ) ) > 1E-8 ||
+          blaze::maxNorm( blaze::band( LDLT, 0L ) - blaze::band( LDLTT, 0L ) ) > 1E-8 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving LSE based on Bunch-Kaufman decomposition failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Matrix size: " << n << "x" << n << "\n"
+             << "   Maximum residual: " << blaze::maxNorm( A * x - b ) << "\n"
+             << "   Maximum inversion error: "
+             << blaze::maxNorm( A * X - blaze::IdentityMatrix<Type>( n ) ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native blocked Bunch-Kaufman decomposition functions (hetrfBlocked).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the native blocked Bunch-Kaufman decomposition functions for
+// Hermitian indefinite matrices for various data types. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DecompositionTest::testHetrfBlocked()
+{
+   test_ = "Native blocked Hermitian matrix decomposition";
+
+   for( size_t n : { 1UL, 7UL, 150UL } )
+   {
+      blaze::DynamicMatrix<Type,blaze::columnMajor> A( n, n );
+      randomize( A );
+      A += ctrans( A );
+      diagonal( A ) *= 0.01;
+
+      blaze::DynamicMatrix<Type,blaze::columnMajor> LDLH( A );
+      blaze::DynamicMatrix<Type,blaze::rowMajor> LDLHT( trans( A ) );
+
+      std::vector<blaze::blas_int_t> ipiv ( n );
+      std::vector<blaze::blas_int_t> ipivT( n );
+
+      blaze::hetrfBlocked( LDLH , ipiv.data()  );
+      blaze::hetrfBlocked( LDLHT, ipivT.data() );
+
+      blaze::DynamicMatrix<Type,blaze::columnMajor> B( n, 3UL ), X;
+      randomize( B );
+      X = B;
+
+      blaze::hetrsBlocked( LDLH, X, ipiv.data() );
+
+      blaze::DynamicMatrix<Type,blaze::columnMajor> Y( A );
+      blaze::DynamicVector<Type,blaze::columnVector> y( column( B, 0UL ) );
+      blaze::hesvBlocked( Y, y, ipivT.data() );
+
+      if( ipiv != ipivT ||
+          blaze::maxNorm( A * X - B ) > 1E-8 ||
+          blaze::maxNorm( A * y - column( B, 0UL ) ) > 1E-8 ||
+          blaze::maxNorm( LDLH - trans( LDLHT ) ) > 1E-8 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving LSE based on Bunch-Kaufman decomposition failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Matrix size: " << n << "x" << n << "\n"
+             << "   Maximum residual: " << blaze::maxNorm( A * X - B ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native blocked Cholesky decomposition functions (potrfBlocked).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the native blocked and tiled Cholesky decomposition functions
+// for various data types. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Type >
+void DecompositionTest::testPotrfBlocked()
+{
+   test_ = "Native blocked Cholesky decomposition";
+
+   for( size_t n : { 1UL, 7UL, 150UL } )
+   {
+      blaze::DynamicMatrix<Type,blaze::columnMajor> A( n, n );
+      randomize( A );
+      A = A * ctrans( A );
+      diagonal( A ) += Type( n );
+
+      blaze::DynamicMatrix<Type,blaze::columnMajor> L1( A ), L2( A );
+      blaze::DynamicMatrix<Type,blaze::rowMajor> L3( A );
+
+      blaze::potrfBlocked( L1, 'L' );
+      blaze::potrfTiled  ( L2, 'L' );
+      blaze::potrfBlocked( L3, 'L' );
+
+      blaze::DynamicMatrix<Type,blaze::columnMajor> L( n, n, Type() );
+      Type diff{};
+
+      for( size_t j=0UL; j<n; ++j ) {
+         for( size_t i=j; i<n; ++i ) {
+            L(i,j) = L1(i,j);
+            diff += abs( L1(i,j) - L2(i,j) ) + abs( L1(i,j) - L3(i,j) );
+         }
+      }
+
+      blaze::DynamicMatrix<Type,blaze::columnMajor> X( L1 );
+      blaze::potriBlocked( X, 'L' );
+
+      if( blaze::maxNorm( L * ctrans( L ) - A ) > 1E-8 || abs( diff ) > 1E-8 ||
+          blaze::maxNorm( A * X - blaze::IdentityMatrix<Type>( n ) ) > 1E-8 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Cholesky decomposition failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Matrix size: " << n << "x" << n << "\n"
+             << "   Maximum reconstruction error: " << blaze::maxNorm( L * ctrans( L ) - A ) << "\n"
+             << "   Maximum inversion error: "
+             << blaze::maxNorm( A * X - blaze::IdentityMatrix<Type>( n ) ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::DynamicMatrix<Type,blaze::rowMajor> A( 40UL, 40UL, Type() );
+      diagonal( A ) = Type( 1 );
+      A(17,17) = Type( -1 );
+
+      bool detected( false );
+
+      try {
+         blaze::potrfBlocked( A, 'U' );
+      }
+      catch( std::runtime_error& ) {
+         detected = true;
+      }
+
+      if( !detected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Detection of non-positive-definite matrix failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of the Bunch-Kaufman decomposition functions for symmetric matrices (sytrf).
 //
@@ -3317,6 +3664,331 @@ void DecompositionTest::testUnmlq()
 
 
 
+//*************************************************************************************************
+/*!\brief Test of the updatable Cholesky decomposition (DenseCholesky).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the rank-k updates and downdates as well as the insertion
+// and removal of rows/columns of the updatable Cholesky decomposition for various data types.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DecompositionTest::testDenseCholesky()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   test_ = "Updatable Cholesky decomposition";
+
+   const size_t n( 12UL );
+
+   blaze::DynamicMatrix<Type,blaze::rowMajor> A( n, n ), X( n, 2UL );
+   randomize( A );
+   randomize( X );
+   A = A * ctrans( A );
+   diagonal( A ) += Type( n );
+
+   blaze::DenseCholesky<Type> chol( A );
+
+   const auto check = [&]( const blaze::DynamicMatrix<Type,blaze::rowMajor>& B, const char* error )
+   {
+      if( chol.rows() != B.rows() || blaze::maxNorm( chol.L() * ctrans( chol.L() ) - B ) > 1E-8 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: " << error << "\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Expected matrix:\n" << B << "\n"
+             << "   Result factor:\n" << chol.L() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   };
+
+   chol.update( column( X, 0UL ) );
+   chol.update( column( X, 1UL ) );
+   A += X * ctrans( X );
+   check( A, "Rank-1 update failed" );
+
+   chol.downdate( X );
+   A -= X * ctrans( X );
+   check( A, "Rank-2 downdate failed" );
+
+   {
+      const blaze::DynamicVector<Type> x( Type( 100 ) * column( A, 0UL ) );
+      bool detected( false );
+
+      try {
+         chol.downdate( x );
+      }
+      catch( std::runtime_error& ) {
+         detected = true;
+      }
+
+      if( !detected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Detection of non-positive-definite downdate failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      check( A, "Failed downdate changed the factor" );
+   }
+
+   {
+      blaze::DynamicMatrix<Type,blaze::rowMajor> B( n+1UL, n+1UL ), C( n+1UL, 1UL );
+      randomize( B );
+      B = B * ctrans( B );
+      diagonal( B ) += Type( n+1UL );
+      submatrix( B, 0UL, 0UL, 4UL, 4UL ) = submatrix( A, 0UL, 0UL, 4UL, 4UL );
+      submatrix( B, 0UL, 5UL, 4UL, n-4UL ) = submatrix( A, 0UL, 4UL, 4UL, n-4UL );
+      submatrix( B, 5UL, 0UL, n-4UL, 4UL ) = submatrix( A, 4UL, 0UL, n-4UL, 4UL );
+      submatrix( B, 5UL, 5UL, n-4UL, n-4UL ) = submatrix( A, 4UL, 4UL, n-4UL, n-4UL );
+
+      chol.insert( 4UL, column( B, 4UL ) );
+      check( B, "Insertion of row/column failed" );
+
+      chol.remove( 4UL );
+      check( A, "Removal of row/column failed" );
+   }
+
+   {
+      blaze::DynamicVector<Type> b( n );
+      randomize( b );
+
+      const blaze::DynamicVector<Type> x( chol.solve( b ) );
+
+      if( blaze::maxNorm( A * x - b ) > 1E-8 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving LSE failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Residual:\n" << ( A * x - b ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the updatable LU decomposition (DenseLU).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the rank-k updates as well as the replacement of rows and
+// columns of the updatable LU decomposition for various data types. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DecompositionTest::testDenseLU()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   test_ = "Updatable LU decomposition";
+
+   const size_t n( 12UL );
+
+   blaze::DynamicMatrix<Type,blaze::rowMajor> A( n, n ), X( n, 3UL ), Y( n, 3UL );
+   randomize( A );
+   randomize( X );
+   randomize( Y );
+
+   blaze::DenseLU<Type> lu( A );
+
+   const auto check = [&]( const char* error )
+   {
+      blaze::DynamicMatrix<Type,blaze::rowMajor> P( n, n, Type() );
+      for( size_t i=0UL; i<n; ++i ) {
+         P(i,lu.permutation()[i]) = Type( 1 );
+      }
+
+      if( blaze::maxNorm( P * A - lu.L() * lu.U() ) > 1E-8 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: " << error << "\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Expected matrix:\n" << A << "\n"
+             << "   Result L:\n" << lu.L() << "\n"
+             << "   Result U:\n" << lu.U() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   };
+
+   lu.update( column( X, 0UL ), column( Y, 0UL ) );
+   A += submatrix( X, 0UL, 0UL, n, 1UL ) * ctrans( submatrix( Y, 0UL, 0UL, n, 1UL ) );
+   check( "Rank-1 update failed" );
+
+   lu.update( X, Y );
+   A += X * ctrans( Y );
+   check( "Rank-3 update failed" );
+
+   for( size_t k=0UL; k<n; k+=5UL )
+   {
+      blaze::DynamicVector<Type,blaze::columnVector> c( n );
+      blaze::DynamicVector<Type,blaze::rowVector> r( n );
+      randomize( c );
+      randomize( r );
+
+      lu.replaceColumn( k, c );
+      column( A, k ) = c;
+      check( "Replacement of column failed" );
+
+      lu.replaceRow( n-k-1UL, r );
+      row( A, n-k-1UL ) = r;
+      check( "Replacement of row failed" );
+   }
+
+   {
+      blaze::DynamicMatrix<Type,blaze::rowMajor> B( n, 2UL );
+      randomize( B );
+
+      const blaze::DynamicMatrix<Type,blaze::rowMajor> Z( lu.solve( B ) );
+
+      if( blaze::maxNorm( A * Z - B ) > 1E-8 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving LSE failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Residual:\n" << ( A * Z - B ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the updatable QR decomposition (DenseQR).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the rank-k updates as well as the insertion and removal of
+// rows and columns of the updatable QR decomposition for various data types. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DecompositionTest::testDenseQR()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   test_ = "Updatable QR decomposition";
+
+   for( const auto& dims : { std::make_pair( 9UL, 9UL ), std::make_pair( 11UL, 6UL ),
+                             std::make_pair( 5UL, 8UL ) } )
+   {
+      const size_t m( dims.first );
+      const size_t n( dims.second );
+
+      blaze::DynamicMatrix<Type,blaze::rowMajor> A( m, n ), U( m, 2UL ), V( n, 2UL );
+      randomize( A );
+      randomize( U );
+      randomize( V );
+
+      blaze::DenseQR<Type> qr( A );
+
+      const auto check = [&]( const char* error )
+      {
+         const size_t k( qr.rows() );
+         const size_t l( blaze::min( k, qr.columns() ) );
+         const blaze::IdentityMatrix<Type> I( k );
+
+         if( k != A.rows() || qr.columns() != A.columns() ||
+             blaze::maxNorm( qr.Q() * qr.R() - A ) > 1E-8 ||
+             blaze::maxNorm( ctrans( qr.Q() ) * qr.Q() - I ) > 1E-8 ||
+             !isUpper( submatrix( qr.R(), 0UL, 0UL, l, l ) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: " << error << "\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Expected matrix:\n" << A << "\n"
+                << "   Result Q:\n" << qr.Q() << "\n"
+                << "   Result R:\n" << qr.R() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      };
+
+      check( "QR decomposition failed" );
+
+      qr.update( U, V );
+      A += U * ctrans( V );
+      check( "Rank-2 update failed" );
+
+      {
+         blaze::DynamicMatrix<Type,blaze::rowMajor> B( m, n+1UL );
+         randomize( B );
+         submatrix( B, 0UL, 0UL, m, 2UL ) = submatrix( A, 0UL, 0UL, m, 2UL );
+         submatrix( B, 0UL, 3UL, m, n-2UL ) = submatrix( A, 0UL, 2UL, m, n-2UL );
+
+         qr.insertColumn( 2UL, column( B, 2UL ) );
+         swap( A, B );
+         check( "Insertion of column failed" );
+
+         qr.removeColumn( 2UL );
+         swap( A, B );
+         check( "Removal of column failed" );
+      }
+
+      {
+         blaze::DynamicMatrix<Type,blaze::rowMajor> B( m+1UL, n );
+         randomize( B );
+         submatrix( B, 0UL, 0UL, 3UL, n ) = submatrix( A, 0UL, 0UL, 3UL, n );
+         submatrix( B, 4UL, 0UL, m-3UL, n ) = submatrix( A, 3UL, 0UL, m-3UL, n );
+
+         qr.insertRow( 3UL, row( B, 3UL ) );
+         swap( A, B );
+         check( "Insertion of row failed" );
+
+         qr.removeRow( 3UL );
+         swap( A, B );
+         check( "Removal of row failed" );
+      }
+
+      if( m >= n )
+      {
+         blaze::DynamicVector<Type> b( m );
+         randomize( b );
+
+         const blaze::DynamicVector<Type> x( qr.solve( b ) );
+
+         if( blaze::maxNorm( ctrans( A ) * ( A * x - b ) ) > 1E-8 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Solving least squares problem failed\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Normal equation residual:\n" << ( ctrans( A ) * ( A * x - b ) ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  GLOBAL TEST FUNCTIONS
@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <algorithm>
+#include <cmath>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -48,9 +49,13 @@
 #include <blaze/math/Accuracy.h>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/Column.h>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
 #include <blaze/math/HermitianMatrix.h>
 #include <blaze/math/LAPACK.h>
 #include <blaze/math/Row.h>
+#include <blaze/math/Solvers.h>
 #include <blaze/math/StaticMatrix.h>
 #include <blaze/math/StaticVector.h>
 #include <blaze/math/SymmetricMatrix.h>
@@ -107,6 +112,8 @@ class EigenvalueTest
    template< typename Type > void testHeev();
    template< typename Type > void testHeevd();
    template< typename Type > void testHeevx();
+   template< typename Type > void testLanczos();
+   template< typename Type > void testArnoldi();
    //@}
    //**********************************************************************************************
 
@@ -120,6 +127,10 @@ class EigenvalueTest
    template< typename VT, typename MT, bool SO, typename ST >
    void checkEigenvector( const blaze::DenseVector<VT,true>& u,
                           const blaze::DenseMatrix<MT,SO>& A, ST w );
+
+   template< typename MT, bool SO1, typename VT, typename XT, bool SO2, typename RT >
+   void checkEigenpairs( const blaze::Matrix<MT,SO1>& A, const blaze::DenseVector<VT,false>& w,
+                         const blaze::DenseMatrix<XT,SO2>& X, RT tol );
    //@}
    //**********************************************************************************************
 
@@ -1359,6 +1370,294 @@ void EigenvalueTest::testHeevx()
 
 
 
+//*************************************************************************************************
+/*!\brief Test of the thick-restart Lanczos eigensolver (lanczos).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the thick-restart Lanczos eigensolver for symmetric and
+// Hermitian matrices for various data types. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void EigenvalueTest::testLanczos()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   using blaze::columnMajor;
+   using blaze::rowMajor;
+
+   using RT = blaze::UnderlyingElement_t<Type>;
+
+
+   //=====================================================================================
+   // lanczos( SparseMatrix, DenseVector, DenseMatrix, size_t, EigenTarget, ... )
+   //=====================================================================================
+
+   {
+      test_ = "lanczos( SparseMatrix, ... ) (1D Laplacian, 6 smallest eigenvalues)";
+
+      const size_t n( 100UL );
+
+      blaze::CompressedMatrix<Type,rowMajor> L( n, n );
+      L.reserve( 3UL*n );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         if( i > 0UL ) L.append( i, i-1UL, Type(-1) );
+         L.append( i, i, Type(2) );
+         if( i+1UL < n ) L.append( i, i+1UL, Type(-1) );
+         L.finalize( i );
+      }
+
+      blaze::DynamicVector<RT,blaze::columnVector> w;
+      blaze::DynamicMatrix<Type,columnMajor> X;
+      blaze::ConvergenceMonitor monitor( 1000UL, 1E-12 );
+
+      const bool converged( blaze::lanczos( L, w, X, 6UL, blaze::smallestReal, monitor, 40UL ) );
+
+      const RT pi( std::acos( RT(-1) ) );
+      RT error( 0 );
+
+      for( size_t i=0UL; i<w.size(); ++i ) {
+         const RT lambda( RT(2) - RT(2)*std::cos( RT(i+1UL)*pi/RT(n+1UL) ) );
+         error = blaze::max( error, std::abs( w[i] - lambda ) );
+      }
+
+      if( !converged || w.size() != 6UL || X.rows() != n || X.columns() != 6UL || error > 1E-10 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Lanczos eigenvalue computation failed\n"
+             << " Details:\n"
+             << "   Random seed = " << blaze::getSeed() << "\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Number of restarts = " << monitor.iterations() << "\n"
+             << "   Computed eigenvalues:\n" << w << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkEigenpairs( L, w, X, RT(1E-8) );
+   }
+
+
+   //=====================================================================================
+   // lanczos( DenseMatrix, DenseVector, DenseMatrix, size_t, EigenTarget )
+   //=====================================================================================
+
+   {
+      test_ = "lanczos( DenseMatrix, ... ) (80x80, 5 largest eigenvalues in magnitude)";
+
+      blaze::HermitianMatrix< blaze::DynamicMatrix<Type,rowMajor> > H( 80UL );
+      randomize( H );
+
+      const blaze::DynamicMatrix<Type,rowMajor>    A1( H );
+      const blaze::DynamicMatrix<Type,columnMajor> A2( H );
+
+      blaze::DynamicVector<RT,blaze::columnVector> w, w1, w2;
+      blaze::DynamicMatrix<Type,columnMajor> X1, X2;
+
+      blaze::eigen( H, w );
+      std::sort( w.begin(), w.end(), []( RT a, RT b ) {
+         return std::abs( a ) > std::abs( b );
+      } );
+
+      const bool converged1( blaze::lanczos( A1, w1, X1, 5UL ) );
+      const bool converged2( blaze::lanczos( A2, w2, X2, 5UL ) );
+
+      if( !converged1 || !converged2 ||
+          max( abs( w1 - subvector( w, 0UL, 5UL ) ) ) > 1E-8 * std::abs( w[0] ) ||
+          max( abs( w2 - subvector( w, 0UL, 5UL ) ) ) > 1E-8 * std::abs( w[0] ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Lanczos eigenvalue computation failed\n"
+             << " Details:\n"
+             << "   Random seed = " << blaze::getSeed() << "\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Eigenvalues of the full decomposition:\n" << w << "\n"
+             << "   Row-major eigenvalues:\n" << w1 << "\n"
+             << "   Column-major eigenvalues:\n" << w2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkEigenpairs( A1, w1, X1, RT(1E-6) );
+      checkEigenpairs( A2, w2, X2, RT(1E-6) );
+   }
+
+
+   //=====================================================================================
+   // lanczos( Operator, DenseVector, DenseVector, DenseMatrix, size_t, EigenTarget, ... )
+   //=====================================================================================
+
+   {
+      test_ = "lanczos( Operator, ... ) (shift-and-invert, 3 eigenvalues closest to 0.5)";
+
+      blaze::HermitianMatrix< blaze::DynamicMatrix<Type,rowMajor> > H( 60UL );
+      randomize( H );
+
+      blaze::DynamicMatrix<Type,rowMajor> S( H );
+      for( size_t i=0UL; i<S.rows(); ++i ) {
+         S(i,i) -= Type(0.5);
+      }
+      invert( S );
+
+      const blaze::DynamicVector<Type,blaze::columnVector> v0( 60UL, Type(1) );
+      blaze::DynamicVector<RT,blaze::columnVector> w;
+      blaze::DynamicMatrix<Type,columnMajor> X;
+      blaze::ConvergenceMonitor monitor( 100UL, 1E-12 );
+
+      const bool converged( blaze::lanczos( [&S]( auto& y, const auto& x ) { y = S * x; },
+                                            v0, w, X, 3UL, blaze::largestMagnitude, monitor ) );
+
+      for( size_t i=0UL; i<w.size(); ++i ) {
+         w[i] = RT(1) / w[i] + RT(0.5);
+      }
+
+      if( !converged || w.size() != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Lanczos eigenvalue computation failed\n"
+             << " Details:\n"
+             << "   Random seed = " << blaze::getSeed() << "\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Computed eigenvalues:\n" << w << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkEigenpairs( H, w, X, RT(1E-8) );
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the restarted Arnoldi eigensolver (arnoldi).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the restarted Arnoldi eigensolver for general matrices
+// for various data types. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Type >
+void EigenvalueTest::testArnoldi()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   using blaze::columnMajor;
+   using blaze::rowMajor;
+
+   using RT = blaze::UnderlyingElement_t<Type>;
+   using CT = blaze::complex<RT>;
+
+
+   //=====================================================================================
+   // arnoldi( SparseMatrix, DenseVector, DenseMatrix, size_t, EigenTarget, ... )
+   //=====================================================================================
+
+   {
+      test_ = "arnoldi( SparseMatrix, ... ) (convection-diffusion, 4 largest eigenvalues)";
+
+      const size_t n( 60UL );
+      const RT c( 0.1 );
+
+      blaze::CompressedMatrix<Type,rowMajor> A( n, n );
+      A.reserve( 3UL*n );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         if( i > 0UL ) A.append( i, i-1UL, Type(-1) - c );
+         A.append( i, i, Type(2) );
+         if( i+1UL < n ) A.append( i, i+1UL, Type(-1) + c );
+         A.finalize( i );
+      }
+
+      blaze::DynamicVector<CT,blaze::columnVector> w;
+      blaze::DynamicMatrix<CT,columnMajor> X;
+      blaze::ConvergenceMonitor monitor( 1000UL, 1E-12 );
+
+      const bool converged( blaze::arnoldi( A, w, X, 4UL, blaze::largestReal, monitor, 30UL ) );
+
+      const RT pi( std::acos( RT(-1) ) );
+      const RT r( std::sqrt( ( RT(1) + c ) * ( RT(1) - c ) ) );
+      RT error( 0 );
+
+      for( size_t i=0UL; i<w.size(); ++i ) {
+         const RT lambda( RT(2) + RT(2)*r*std::cos( RT(i+1UL)*pi/RT(n+1UL) ) );
+         error = blaze::max( error, RT( abs( w[i] - lambda ) ) );
+      }
+
+      if( !converged || w.size() != 4UL || X.rows() != n || X.columns() != 4UL || error > 1E-8 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Arnoldi eigenvalue computation failed\n"
+             << " Details:\n"
+             << "   Random seed = " << blaze::getSeed() << "\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Number of restarts = " << monitor.iterations() << "\n"
+             << "   Computed eigenvalues:\n" << w << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkEigenpairs( A, w, X, RT(1E-8) );
+   }
+
+
+   //=====================================================================================
+   // arnoldi( DenseMatrix, DenseVector, DenseMatrix, size_t, EigenTarget )
+   //=====================================================================================
+
+   {
+      test_ = "arnoldi( DenseMatrix, ... ) (100x100, 6 largest eigenvalues in magnitude)";
+
+      blaze::DynamicMatrix<Type,rowMajor> A1( 100UL, 100UL );
+      randomize( A1 );
+
+      const blaze::DynamicMatrix<Type,columnMajor> A2( A1 );
+
+      blaze::DynamicMatrix<Type,columnMajor> B( A1 );
+      blaze::DynamicVector<CT,blaze::columnVector> w, w1, w2;
+      blaze::DynamicMatrix<CT,columnMajor> X1, X2;
+
+      blaze::geev( B, w );
+      std::sort( w.begin(), w.end(), []( const CT& a, const CT& b ) {
+         return abs( a ) > abs( b );
+      } );
+
+      const bool converged1( blaze::arnoldi( A1, w1, X1, 6UL ) );
+      const bool converged2( blaze::arnoldi( A2, w2, X2, 6UL ) );
+
+      if( !converged1 || !converged2 ||
+          std::abs( abs( w1[0] ) - abs( w[0] ) ) > 1E-8 * abs( w[0] ) ||
+          std::abs( abs( w2[0] ) - abs( w[0] ) ) > 1E-8 * abs( w[0] ) ||
+          std::abs( abs( w1[5] ) - abs( w[5] ) ) > 1E-8 * abs( w[0] ) ||
+          std::abs( abs( w2[5] ) - abs( w[5] ) ) > 1E-8 * abs( w[0] ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Arnoldi eigenvalue computation failed\n"
+             << " Details:\n"
+             << "   Random seed = " << blaze::getSeed() << "\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Eigenvalues of the full decomposition:\n" << w << "\n"
+             << "   Row-major eigenvalues:\n" << w1 << "\n"
+             << "   Column-major eigenvalues:\n" << w2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkEigenpairs( A1, w1, X1, RT(1E-6) );
+      checkEigenpairs( A2, w2, X2, RT(1E-6) );
+   }
+
+#endif
+}
+//*************************************************************************************************
+
 
 //=================================================================================================
 //
@@ -1446,6 +1745,54 @@ void EigenvalueTest::checkEigenvector( const blaze::DenseVector<VT,true>& u,
 
 
 
+//*************************************************************************************************
+/*!\brief Checking the given eigenpairs of an iterative eigensolver.
+//
+// \param A The corresponding dense or sparse matrix.
+// \param w The eigenvalues to be checked.
+// \param X The corresponding right eigenvectors.
+// \param tol The relative tolerance of the residual norms.
+// \return void
+// \exception std::runtime_error Invalid eigenpair detected.
+//
+// This function checks the given eigenpairs by testing if the residual norms satisfy
+
+                    \f[ \|A * x[j] - lambda[j] * x[j]\| \leq tol * \max(1,|lambda[j]|), \f]
+
+// where \f$x[j]\f$ is the j-th column of \a X.
+*/
+template< typename MT    // Type of the matrix A
+        , bool SO1       // Storage order of the matrix A
+        , typename VT    // Type of the vector of eigenvalues
+        , typename XT    // Type of the matrix of eigenvectors
+        , bool SO2       // Storage order of the matrix of eigenvectors
+        , typename RT >  // Type of the tolerance
+void EigenvalueTest::checkEigenpairs( const blaze::Matrix<MT,SO1>& A,
+                                      const blaze::DenseVector<VT,false>& w,
+                                      const blaze::DenseMatrix<XT,SO2>& X, RT tol )
+{
+   for( size_t j=0UL; j<(*w).size(); ++j )
+   {
+      const auto x( column( *X, j ) );
+      const RT residual( blaze::real( blaze::norm( (*A) * x - (*w)[j] * x ) ) );
+
+      if( residual > tol * blaze::max( RT(1), RT( abs( (*w)[j] ) ) ) ||
+          std::abs( blaze::real( blaze::norm( x ) ) - RT(1) ) > RT(1E-10) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid eigenpair detected\n"
+             << " Details:\n"
+             << "   Random seed = " << blaze::getSeed() << "\n"
+             << "   Eigenvalue = " << (*w)[j] << "\n"
+             << "   Residual norm = " << residual << "\n"
+             << "   Eigenvector:\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 //=================================================================================================
 //
 //  GLOBAL TEST FUNCTIONS
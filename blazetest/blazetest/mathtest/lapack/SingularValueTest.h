@@ -40,10 +40,14 @@
 // Includes
 //*************************************************************************************************
 
+#include <cmath>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
 #include <blaze/math/LAPACK.h>
 #include <blaze/math/StaticMatrix.h>
 #include <blaze/math/StaticVector.h>
@@ -91,6 +95,7 @@ class SingularValueTest
    template< typename Type > void testGesvd();
    template< typename Type > void testGesdd();
    template< typename Type > void testGesvdx();
+   template< typename Type > void testRsvd();
    //@}
    //**********************************************************************************************
 
@@ -2586,6 +2591,193 @@ void SingularValueTest::testGesvdx()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the randomized truncated singular value decomposition functions (rsvd).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the randomized truncated singular value decomposition
+// functions for various data types. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >
+void SingularValueTest::testRsvd()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   using blaze::columnMajor;
+   using blaze::rowMajor;
+
+   using RT = blaze::UnderlyingElement_t<Type>;
+
+
+   //=====================================================================================
+   // rsvd( DenseMatrix, DenseVector, size_t )
+   //=====================================================================================
+
+   {
+      test_ = "rsvd( DenseMatrix, DenseVector, size_t ) (20x12, rank 3)";
+
+      blaze::DynamicMatrix<Type,columnMajor> X( 20UL, 3UL ), Y( 3UL, 12UL );
+      randomize( X );
+      randomize( Y );
+
+      const blaze::DynamicMatrix<Type,rowMajor>    A1( X * Y );
+      const blaze::DynamicMatrix<Type,columnMajor> A2( X * Y );
+
+      blaze::DynamicVector<RT,blaze::columnVector> s, s1, s2;
+
+      blaze::svd( A2, s );
+      blaze::rsvd( A1, s1, 3UL );
+      blaze::rsvd( A2, s2, 3UL );
+
+      if( s1.size() != 3UL || s2.size() != 3UL ||
+          max( abs( s1 - subvector( s, 0UL, 3UL ) ) ) > 1E-10 * s[0] ||
+          max( abs( s2 - subvector( s, 0UL, 3UL ) ) ) > 1E-10 * s[0] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Randomized singular value decomposition failed\n"
+             << " Details:\n"
+             << "   Random seed = " << blaze::getSeed() << "\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Singular values of the full decomposition:\n" << s << "\n"
+             << "   Row-major singular values:\n" << s1 << "\n"
+             << "   Column-major singular values:\n" << s2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // rsvd( DenseMatrix, DenseMatrix, DenseVector, DenseMatrix, size_t )
+   //=====================================================================================
+
+   {
+      test_ = "rsvd( DenseMatrix, DenseMatrix, DenseVector, DenseMatrix, size_t ) (12x20, rank 4)";
+
+      blaze::DynamicMatrix<Type,columnMajor> X( 12UL, 4UL ), Y( 4UL, 20UL );
+      randomize( X );
+      randomize( Y );
+
+      const blaze::DynamicMatrix<Type,rowMajor>    A1( X * Y );
+      const blaze::DynamicMatrix<Type,columnMajor> A2( X * Y );
+
+      blaze::DynamicMatrix<Type,rowMajor>    U1, V1;
+      blaze::DynamicMatrix<Type,columnMajor> U2, V2;
+      blaze::DynamicVector<RT,blaze::columnVector> s1, s2;
+
+      blaze::rsvd( A1, U1, s1, V1, 4UL, 5UL, 1UL );
+      blaze::rsvd( A2, U2, s2, V2, 4UL, 5UL, 1UL );
+
+      blaze::DynamicMatrix<Type,columnMajor> US1( U1 ), US2( U2 );
+
+      for( size_t j=0UL; j<4UL; ++j ) {
+         column( US1, j ) *= s1[j];
+         column( US2, j ) *= s2[j];
+      }
+
+      if( U1.rows() != 12UL || U1.columns() != 4UL || V1.rows() != 4UL || V1.columns() != 20UL ||
+          max( abs( US1 * V1 - A1 ) ) > 1E-10 * s1[0] ||
+          max( abs( US2 * V2 - A2 ) ) > 1E-10 * s2[0] ||
+          max( abs( ctrans( U1 ) * U1 - blaze::IdentityMatrix<Type>( 4UL ) ) ) > 1E-12 ||
+          max( abs( V2 * ctrans( V2 ) - blaze::IdentityMatrix<Type>( 4UL ) ) ) > 1E-12 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Randomized singular value decomposition failed\n"
+             << " Details:\n"
+             << "   Random seed = " << blaze::getSeed() << "\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Row-major matrix (A1):\n" << A1 << "\n"
+             << "   Row-major left singular vectors (U1):\n" << U1 << "\n"
+             << "   Row-major singular values (s1):\n" << s1 << "\n"
+             << "   Row-major right singular vectors (V1):\n" << V1 << "\n"
+             << "   Column-major left singular vectors (U2):\n" << U2 << "\n"
+             << "   Column-major singular values (s2):\n" << s2 << "\n"
+             << "   Column-major right singular vectors (V2):\n" << V2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // rsvd( SparseMatrix, DenseMatrix, DenseVector, DenseMatrix, size_t )
+   //=====================================================================================
+
+   {
+      test_ = "rsvd( SparseMatrix, DenseMatrix, DenseVector, DenseMatrix, size_t ) (40x30)";
+
+      blaze::CompressedMatrix<Type,rowMajor> A( 40UL, 30UL );
+
+      for( size_t i=0UL; i<40UL; ++i ) {
+         A(i,i%30UL)       += Type( std::pow( 0.5, double( i%30UL ) ) );
+         A(i,(i*7UL)%30UL) += Type( 0.5*std::pow( 0.5, double( (i*7UL)%30UL ) ) );
+      }
+
+      const blaze::DynamicMatrix<Type,columnMajor> B( A );
+
+      blaze::DynamicMatrix<Type,columnMajor> U1, V1, U2, V2;
+      blaze::DynamicVector<RT,blaze::columnVector> s, s1, s2;
+
+      blaze::svd( B, s );
+
+      blaze::setSeed( 5U );
+      blaze::rsvd( A, U1, s1, V1, 5UL );
+      blaze::setSeed( 5U );
+      blaze::rsvd( B, U2, s2, V2, 5UL );
+
+      if( max( abs( s1 - subvector( s, 0UL, 5UL ) ) ) > 1E-10 * s[0] ||
+          max( abs( s1 - s2 ) ) > 1E-12 * s[0] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Randomized singular value decomposition failed\n"
+             << " Details:\n"
+             << "   Random seed = " << blaze::getSeed() << "\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Singular values of the full decomposition:\n" << s << "\n"
+             << "   Sparse singular values:\n" << s1 << "\n"
+             << "   Dense singular values:\n" << s2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Invalid number of singular values
+   //=====================================================================================
+
+   {
+      test_ = "rsvd( DenseMatrix, DenseVector, size_t ) (invalid number of singular values)";
+
+      blaze::DynamicMatrix<Type,rowMajor> A( 5UL, 3UL );
+      randomize( A );
+
+      blaze::DynamicVector<RT,blaze::columnVector> s;
+
+      try {
+         blaze::rsvd( A, s, 4UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Randomized singular value decomposition succeeded\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Matrix:\n" << A << "\n"
+             << "   Singular values:\n" << s << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -0,0 +1,279 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/matrices/compressedmatrix/KrylovTest.h
+//  \brief Header file for the CompressedMatrix Krylov solver test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_MATRICES_COMPRESSEDMATRIX_KRYLOVTEST_H_
+#define _BLAZETEST_MATHTEST_MATRICES_COMPRESSEDMATRIX_KRYLOVTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Solvers.h>
+#include <blaze/math/shims/Real.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace compressedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the Krylov solvers with compressed matrices.
+//
+// This class represents a test suite for the iterative solution of linear systems with the
+// blaze::CompressedMatrix class template via the cg(), bicgstab(), gmres(), and minres()
+// functions in combination with the available preconditioners.
+*/
+class KrylovTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit KrylovTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testCG();
+   void testBiCGSTAB();
+   void testGMRES();
+   void testMINRES();
+   void testComplex();
+   void testMonitor();
+   void testErrors();
+
+   template< typename Type >
+   blaze::CompressedMatrix<Type,blaze::rowMajor>
+      createGrid( size_t size, Type shift, Type convection ) const;
+
+   template< typename Type >
+   blaze::DynamicVector<Type> createRhs( size_t size ) const;
+
+   template< typename MT, typename VT1, typename VT2 >
+   void checkSolution( bool converged, const blaze::ConvergenceMonitor& monitor,
+                       const MT& A, const VT1& x, const VT2& b, double tolerance ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creation of the matrix of a 2D convection-diffusion problem.
+//
+// \param size The number of grid points in each dimension.
+// \param shift The shift of the diagonal elements.
+// \param convection The convection coefficient.
+// \return The matrix of the grid.
+//
+// This function creates the matrix of a 5-point stencil on a \a size x \a size grid with
+// diagonal elements \f$ 4+shift \f$ and off-diagonal elements \f$ -1-convection \f$ (lower
+// part) and \f$ -1+\overline{convection} \f$ (upper part). A real \a convection results in
+// an unsymmetric matrix, an imaginary \a convection in a Hermitian matrix.
+*/
+template< typename Type >  // Data type of the matrix elements
+blaze::CompressedMatrix<Type,blaze::rowMajor>
+   KrylovTest::createGrid( size_t size, Type shift, Type convection ) const
+{
+   const size_t n( size*size );
+
+   blaze::CompressedMatrix<Type,blaze::rowMajor> A( n, n );
+   A.reserve( 5UL*n );
+
+   for( size_t i=0UL; i<size; ++i ) {
+      for( size_t j=0UL; j<size; ++j ) {
+         const size_t row( i*size+j );
+         if( i > 0UL      ) A.append( row, row-size, Type(-1) - convection );
+         if( j > 0UL      ) A.append( row, row-1UL , Type(-1) - convection );
+         A.append( row, row, Type(4) + shift );
+         if( j+1UL < size ) A.append( row, row+1UL , Type(-1) + blaze::conj( convection ) );
+         if( i+1UL < size ) A.append( row, row+size, Type(-1) + blaze::conj( convection ) );
+         A.finalize( row );
+      }
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creation of a deterministic right-hand side vector.
+//
+// \param size The size of the vector.
+// \return The right-hand side vector.
+*/
+template< typename Type >  // Data type of the vector elements
+blaze::DynamicVector<Type> KrylovTest::createRhs( size_t size ) const
+{
+   blaze::DynamicVector<Type> b( size );
+
+   for( size_t i=0UL; i<size; ++i ) {
+      b[i] = Type( 1.0 + std::sin( double( i ) ) );
+   }
+
+   return b;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the solution of a linear system.
+//
+// \param converged The result of the solver.
+// \param monitor The convergence monitor of the solve.
+// \param A The system matrix.
+// \param x The computed solution.
+// \param b The right-hand side vector.
+// \param tolerance The maximum relative residual.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks whether the solver has reported convergence and whether the relative
+// residual \f$ \|b-Ax\| / \|b\| \f$ of the computed solution is below the given tolerance. In
+// case any check fails, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT    // Type of the system matrix
+        , typename VT1   // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+void KrylovTest::checkSolution( bool converged, const blaze::ConvergenceMonitor& monitor,
+                                const MT& A, const VT1& x, const VT2& b, double tolerance ) const
+{
+   const double residual( blaze::real( blaze::norm( b - A * x ) ) /
+                          blaze::real( blaze::norm( b ) ) );
+
+   if( !converged || !monitor.converged() || residual > tolerance ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid solution of linear system\n"
+          << " Details:\n"
+          << "   Converged        : " << converged << "\n"
+          << "   Iterations       : " << monitor.iterations() << "\n"
+          << "   Relative residual: " << residual << "\n"
+          << "   Tolerance        : " << tolerance << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the Krylov solvers with compressed matrices.
+//
+// \return void
+*/
+void runTest()
+{
+   KrylovTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the CompressedMatrix Krylov solver test.
+*/
+#define RUN_COMPRESSEDMATRIX_KRYLOV_TEST \
+   blazetest::mathtest::matrices::compressedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace compressedmatrix
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
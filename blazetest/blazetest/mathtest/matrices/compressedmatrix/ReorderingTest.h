@@ -0,0 +1,291 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/matrices/compressedmatrix/ReorderingTest.h
+//  \brief Header file for the CompressedMatrix reordering test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_MATRICES_COMPRESSEDMATRIX_REORDERINGTEST_H_
+#define _BLAZETEST_MATHTEST_MATRICES_COMPRESSEDMATRIX_REORDERINGTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/IsEqual.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace compressedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the bandwidth-reducing reordering functionality.
+//
+// This class represents a test suite for the reordering of the blaze::CompressedMatrix class
+// template via the rcm(), nestedDissection(), and permute() functions.
+*/
+class ReorderingTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ReorderingTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testRowMajor();
+   void testColumnMajor();
+
+   template< typename MT >
+   MT createGrid( size_t size ) const;
+
+   void checkPermutation( const std::vector<size_t>& perm, size_t size ) const;
+
+   template< typename MT >
+   void checkPermuted( const MT& result, const MT& matrix, const std::vector<size_t>& perm ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creation of the matrix of a 2D grid with a random numbering of the grid points.
+//
+// \param size The number of grid points in each dimension.
+// \return The matrix of the grid.
+//
+// This function creates the matrix of a 5-point stencil on a \a size x \a size grid. The grid
+// points are numbered randomly and the values of the off-diagonal elements are unsymmetric.
+*/
+template< typename MT >  // Type of the matrix
+MT ReorderingTest::createGrid( size_t size ) const
+{
+   const size_t n( size*size );
+
+   std::vector<size_t> label( n );
+   for( size_t k=0UL; k<n; ++k ) {
+      label[k] = k;
+   }
+   for( size_t k=n; k>1UL; --k ) {
+      std::swap( label[k-1UL], label[blaze::rand<size_t>( 0UL, k-1UL )] );
+   }
+
+   MT A( n, n );
+
+   for( size_t i=0UL; i<size; ++i ) {
+      for( size_t j=0UL; j<size; ++j ) {
+         const size_t v( label[i*size+j] );
+         A(v,v) = 4.0;
+         if( i > 0UL      ) A(v,label[(i-1UL)*size+j]) = -1.0;
+         if( i+1UL < size ) A(v,label[(i+1UL)*size+j]) = -2.0;
+         if( j > 0UL      ) A(v,label[i*size+j-1UL]  ) = -1.0;
+         if( j+1UL < size ) A(v,label[i*size+j+1UL]  ) = -2.0;
+      }
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the validity of the given permutation.
+//
+// \param perm The permutation to be checked.
+// \param size The expected size of the permutation.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks whether the given vector is a permutation of the indices
+// \f$[0..size-1]\f$. In case it is not, a \a std::runtime_error exception is thrown.
+*/
+void ReorderingTest::checkPermutation( const std::vector<size_t>& perm, size_t size ) const
+{
+   std::vector<bool> found( size, false );
+   bool valid( perm.size() == size );
+
+   for( size_t k=0UL; valid && k<perm.size(); ++k ) {
+      valid = ( perm[k] < size && !found[perm[k]] );
+      if( valid ) found[perm[k]] = true;
+   }
+
+   if( !valid ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid permutation\n"
+          << " Details:\n"
+          << "   Size of the permutation: " << perm.size() << "\n"
+          << "   Expected size          : " << size << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a symmetric permutation.
+//
+// \param result The result of the symmetric permutation.
+// \param matrix The original matrix.
+// \param perm The applied permutation.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks whether \f$ result(i,j) = matrix(perm[i],perm[j]) \f$ holds for all
+// elements. In case an element differs, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the matrix
+void ReorderingTest::checkPermuted( const MT& result, const MT& matrix,
+                                    const std::vector<size_t>& perm ) const
+{
+   const blaze::DynamicMatrix<double> A( matrix ), B( result );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         if( !isEqual( B(i,j), A(perm[i],perm[j]) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid result of symmetric permutation\n"
+                << " Details:\n"
+                << "   Index       : (" << i << "," << j << ")\n"
+                << "   Result      : " << B(i,j) << "\n"
+                << "   Expected    : " << A(perm[i],perm[j]) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   if( result.nonZeros() != matrix.nonZeros() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements\n"
+          << " Details:\n"
+          << "   Number of non-zeros         : " << result.nonZeros() << "\n"
+          << "   Expected number of non-zeros: " << matrix.nonZeros() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the bandwidth-reducing reordering of compressed matrices.
+//
+// \return void
+*/
+void runTest()
+{
+   ReorderingTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the CompressedMatrix reordering test.
+*/
+#define RUN_COMPRESSEDMATRIX_REORDERING_TEST \
+   blazetest::mathtest::matrices::compressedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace compressedmatrix
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,630 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/matrices/compressedmatrix/SemiringTest.h
+//  \brief Header file for the CompressedMatrix semiring multiplication test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_MATRICES_COMPRESSEDMATRIX_SEMIRINGTEST_H_
+#define _BLAZETEST_MATHTEST_MATRICES_COMPRESSEDMATRIX_SEMIRINGTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace compressedmatrix {
+
+//=================================================================================================
+//
+//  SEMIRINGS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The \f$ (\max,\times) \f$ semiring for non-negative values.
+//
+// The MaxTimes semiring is used to test user-defined semirings. Its additive identity is the
+// default value (i.e. zero) of the element type, which is only valid for non-negative values.
+*/
+struct MaxTimes
+{
+   using AddOp  = blaze::Max;   //!< The additive operation of the semiring.
+   using MultOp = blaze::Mult;  //!< The multiplicative operation of the semiring.
+
+   //**********************************************************************************************
+   /*!\brief Returns the additive identity of the semiring for the given element type.
+   //
+   // \return The additive identity of the semiring.
+   */
+   template< typename T >
+   static constexpr T zero() { return T(); }
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the semiring multiplications of CompressedMatrix.
+//
+// This class represents a test suite for the unmasked, masked, and complemented semiring
+// multiplications of the blaze::CompressedMatrix class template with vectors and sparse
+// matrices. All results are compared to a dense reference implementation. All values are
+// small integral values, such that the results are exact independent of the order of the
+// accumulation.
+*/
+class SemiringTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SemiringTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename SR, typename Type, bool SO >
+   void testMatVecMult( const std::string& name, size_t m, size_t n, size_t nonzeros );
+
+   template< typename SR, typename Type, bool SO >
+   void testMatMatMult( const std::string& name, size_t m, size_t k, size_t n, size_t nonzeros );
+
+   template< typename VT1, typename VT2 >
+   void checkResult( const VT1& result, const VT2& expected ) const;
+
+   template< typename MT, typename Type >
+   void checkResult( const MT& result, const blaze::DynamicMatrix<Type>& expected,
+                     const blaze::DynamicMatrix<bool>& pattern ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type, bool SO >
+   void initialize( blaze::CompressedMatrix<Type,SO>& A, size_t m, size_t n, size_t nonzeros );
+
+   template< typename SR, typename Type, typename MT >
+   blaze::DynamicVector<Type>
+      reference( const MT& A, const blaze::DynamicVector<Type>& x,
+                 const blaze::DynamicVector<bool>& xpattern );
+
+   template< typename SR, typename Type, typename MT1, typename MT2 >
+   blaze::DynamicMatrix<Type>
+      reference( const MT1& A, const MT2& B, blaze::DynamicMatrix<bool>& pattern );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the semiring multiplication of a sparse matrix and a vector.
+//
+// \param name The name of the semiring.
+// \param m The number of rows of the sparse matrix.
+// \param n The number of columns of the sparse matrix.
+// \param nonzeros The number of non-zero elements per row of the sparse matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the unmasked, masked, and complemented semiring multiplication of a
+// compressed matrix with storage order \a SO with a dense and a sparse vector. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename SR    // Type of the semiring
+        , typename Type  // Element type of the operands
+        , bool SO >      // Storage order of the sparse matrix
+void SemiringTest::testMatVecMult( const std::string& name, size_t m, size_t n, size_t nonzeros )
+{
+   const Type zero( SR::template zero<Type>() );
+
+   blaze::CompressedMatrix<Type,SO> A;
+   initialize( A, m, n, nonzeros );
+
+   blaze::DynamicVector<Type> x( n );
+   blaze::DynamicVector<bool> xpattern( n );
+   blaze::CompressedVector<Type> sx( n );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      x[j] = ( j % 7UL == 3UL ) ? zero : static_cast<Type>( blaze::rand<int>( 1, 9 ) );
+      xpattern[j] = ( x[j] != zero );
+      if( j % 3UL == 1UL ) {
+         sx[j] = x[j];
+      }
+   }
+
+   blaze::DynamicVector<bool> spattern( n, false );
+   for( auto element=sx.begin(); element!=sx.end(); ++element ) {
+      spattern[element->index()] = ( element->value() != zero );
+   }
+
+   blaze::DynamicVector<int> mask( m );
+   for( size_t i=0UL; i<m; ++i ) {
+      mask[i] = blaze::rand<int>( 0, 2 );
+   }
+
+   blaze::DynamicVector<Type> init( m );
+   for( size_t i=0UL; i<m; ++i ) {
+      init[i] = static_cast<Type>( blaze::rand<int>( 1, 9 ) );
+   }
+
+   const blaze::DynamicVector<Type> ref ( reference<SR>( A, x, xpattern ) );
+   const blaze::DynamicVector<Type> sref( reference<SR>( A, x, spattern ) );
+
+   const std::string label( name + " " + ( SO ? "column" : "row" ) + "-major matrix/vector" );
+
+   // Unmasked multiplication with a dense vector
+   {
+      test_ = label + " multiplication (dense vector)";
+
+      blaze::DynamicVector<Type> y;
+      blaze::mult<SR>( y, A, x );
+      checkResult( y, ref );
+
+      checkResult( blaze::mult<SR>( A, x ), ref );
+   }
+
+   // Unmasked multiplication with a sparse vector
+   {
+      test_ = label + " multiplication (sparse vector)";
+
+      blaze::DynamicVector<Type> y;
+      blaze::mult<SR>( y, A, sx );
+      checkResult( y, sref );
+   }
+
+   // Masked multiplication
+   {
+      test_ = label + " multiplication (mask)";
+
+      blaze::DynamicVector<Type> y( init ), expected( init );
+      for( size_t i=0UL; i<m; ++i ) {
+         if( mask[i] != 0 ) expected[i] = ref[i];
+      }
+
+      blaze::mult<SR>( y, A, x, mask );
+      checkResult( y, expected );
+   }
+
+   // Complemented multiplication
+   {
+      test_ = label + " multiplication (complemented mask)";
+
+      blaze::DynamicVector<Type> y( init ), expected( init );
+      for( size_t i=0UL; i<m; ++i ) {
+         if( mask[i] == 0 ) expected[i] = sref[i];
+      }
+
+      blaze::mult<SR>( y, A, sx, blaze::complement( mask ) );
+      checkResult( y, expected );
+   }
+
+   // Complemented multiplication with a stored mask expression
+   {
+      test_ = label + " multiplication (complemented mask expression)";
+
+      blaze::DynamicVector<Type> y( init ), expected( init );
+      for( size_t i=0UL; i<m; ++i ) {
+         if( mask[i] != 2 ) expected[i] = ref[i];
+      }
+
+      const auto cmask( blaze::complement( blaze::map( mask, []( int v ){ return v == 2; } ) ) );
+      blaze::mult<SR>( y, A, x, cmask );
+      checkResult( y, expected );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the semiring multiplication of two sparse matrices.
+//
+// \param name The name of the semiring.
+// \param m The number of rows of the left-hand side sparse matrix.
+// \param k The number of columns of the left-hand side sparse matrix.
+// \param n The number of columns of the right-hand side sparse matrix.
+// \param nonzeros The number of non-zero elements per row of the sparse matrices.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the unmasked, masked, and complemented semiring multiplication of a
+// compressed matrix with storage order \a SO with a row-major and a column-major compressed
+// matrix for both row-major and column-major target matrices. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename SR    // Type of the semiring
+        , typename Type  // Element type of the operands
+        , bool SO >      // Storage order of the left-hand side sparse matrix
+void SemiringTest::testMatMatMult( const std::string& name, size_t m, size_t k, size_t n,
+                                   size_t nonzeros )
+{
+   blaze::CompressedMatrix<Type,SO> A;
+   blaze::CompressedMatrix<Type,blaze::rowMajor> B;
+   blaze::CompressedMatrix<int,blaze::rowMajor> M;
+
+   initialize( A, m, k, nonzeros );
+   initialize( B, k, n, nonzeros );
+   initialize( M, m, n, nonzeros );
+
+   const blaze::CompressedMatrix<Type,blaze::columnMajor> TB( B );
+   const blaze::CompressedMatrix<int,blaze::columnMajor> TM( trans( M ) );
+
+   blaze::DynamicMatrix<bool> pattern;
+   const blaze::DynamicMatrix<Type> ref( reference<SR,Type>( A, B, pattern ) );
+
+   blaze::DynamicMatrix<bool> masked( pattern ), complemented( pattern );
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         const bool selected( M.find( i, j ) != M.end( i ) );
+         masked(i,j)       = pattern(i,j) &&  selected;
+         complemented(i,j) = pattern(i,j) && !selected;
+      }
+   }
+
+   const std::string label( name + " " + ( SO ? "column" : "row" ) + "-major matrix/matrix" );
+
+   // Unmasked multiplication
+   {
+      test_ = label + " multiplication";
+
+      blaze::CompressedMatrix<Type,blaze::rowMajor> C;
+      blaze::mult<SR>( C, A, B );
+      checkResult( C, ref, pattern );
+
+      blaze::CompressedMatrix<Type,blaze::columnMajor> TC;
+      blaze::mult<SR>( TC, A, TB );
+      checkResult( TC, ref, pattern );
+
+      checkResult( blaze::mult<SR>( A, TB ), ref, pattern );
+   }
+
+   // Masked multiplication
+   {
+      test_ = label + " multiplication (mask)";
+
+      blaze::CompressedMatrix<Type,blaze::rowMajor> C;
+      blaze::mult<SR>( C, A, B, M );
+      checkResult( C, ref, masked );
+
+      blaze::CompressedMatrix<Type,blaze::columnMajor> TC;
+      blaze::mult<SR>( TC, A, TB, trans( TM ) );
+      checkResult( TC, ref, masked );
+   }
+
+   // Complemented multiplication
+   {
+      test_ = label + " multiplication (complemented mask)";
+
+      blaze::CompressedMatrix<Type,blaze::rowMajor> C;
+      blaze::mult<SR>( C, A, B, blaze::complement( M ) );
+      checkResult( C, ref, complemented );
+
+      blaze::CompressedMatrix<Type,blaze::columnMajor> TC;
+      blaze::mult<SR>( TC, A, TB, blaze::complement( M ) );
+      checkResult( TC, ref, complemented );
+   }
+
+   // Complemented multiplication with a stored mask expression
+   {
+      test_ = label + " multiplication (complemented mask expression)";
+
+      const auto cmask( blaze::complement( trans( TM ) ) );
+
+      blaze::CompressedMatrix<Type,blaze::rowMajor> C;
+      blaze::mult<SR>( C, A, B, cmask );
+      checkResult( C, ref, complemented );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking and comparing the computed result vector.
+//
+// \param result The computed result vector.
+// \param expected The expected result vector.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// In case the two vectors differ, a \a std::runtime_error exception is thrown.
+*/
+template< typename VT1    // Type of the result vector
+        , typename VT2 >  // Type of the expected vector
+void SemiringTest::checkResult( const VT1& result, const VT2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of semiring multiplication\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking and comparing the computed result matrix.
+//
+// \param result The computed result matrix.
+// \param expected The expected values of the result matrix.
+// \param pattern The expected sparsity pattern of the result matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the result matrix stores exactly the elements of the given
+// sparsity pattern (independent of their value) and that all stored elements match the
+// expected values. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT      // Type of the result matrix
+        , typename Type >  // Element type of the expected matrix
+void SemiringTest::checkResult( const MT& result, const blaze::DynamicMatrix<Type>& expected,
+                                const blaze::DynamicMatrix<bool>& pattern ) const
+{
+   size_t nonzeros( 0UL );
+   bool   valid( result.rows() == expected.rows() && result.columns() == expected.columns() );
+
+   for( size_t i=0UL; valid && i<result.rows(); ++i ) {
+      for( size_t j=0UL; valid && j<result.columns(); ++j )
+      {
+         const auto element( result.find( i, j ) );
+         const bool stored( element != result.end( blaze::IsRowMajorMatrix_v<MT> ? i : j ) );
+
+         if( stored != pattern(i,j) || ( stored && element->value() != expected(i,j) ) ) {
+            valid = false;
+         }
+
+         if( stored ) ++nonzeros;
+      }
+   }
+
+   if( !valid || nonzeros != result.nonZeros() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of semiring multiplication\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n"
+          << "   Expected sparsity pattern:\n" << pattern << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given compressed matrix.
+//
+// \param A The compressed matrix to be initialized.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The maximum number of non-zero elements per row.
+// \return void
+//
+// Each row of the matrix is initialized with up to \a nonzeros randomly placed non-zero
+// elements with random integral values in the range \f$ [1..9] \f$.
+*/
+template< typename Type  // Element type of the compressed matrix
+        , bool SO >      // Storage order of the compressed matrix
+void SemiringTest::initialize( blaze::CompressedMatrix<Type,SO>& A, size_t m, size_t n,
+                               size_t nonzeros )
+{
+   A.resize( m, n, false );
+   A.reset();
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t l=0UL; l<nonzeros; ++l ) {
+         A( i, blaze::rand<size_t>( 0UL, n-1UL ) ) = static_cast<Type>( blaze::rand<int>( 1, 9 ) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Dense reference implementation of the semiring matrix/vector multiplication.
+//
+// \param A The sparse matrix.
+// \param x The dense vector.
+// \param xpattern The contributing elements of the vector.
+// \return The result of the semiring multiplication.
+*/
+template< typename SR    // Type of the semiring
+        , typename Type  // Element type of the operands
+        , typename MT >  // Type of the sparse matrix
+blaze::DynamicVector<Type>
+   SemiringTest::reference( const MT& A, const blaze::DynamicVector<Type>& x,
+                            const blaze::DynamicVector<bool>& xpattern )
+{
+   const typename SR::AddOp  add {};
+   const typename SR::MultOp mult{};
+
+   const blaze::DynamicMatrix<Type> D( A );
+   blaze::DynamicVector<Type> y( A.rows(), SR::template zero<Type>() );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         if( !blaze::isDefault( D(i,j) ) && xpattern[j] ) {
+            y[i] = add( y[i], mult( D(i,j), x[j] ) );
+         }
+      }
+   }
+
+   return y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Dense reference implementation of the semiring matrix/matrix multiplication.
+//
+// \param A The left-hand side sparse matrix.
+// \param B The right-hand side sparse matrix.
+// \param pattern The resulting sparsity pattern.
+// \return The result of the semiring multiplication.
+*/
+template< typename SR     // Type of the semiring
+        , typename Type   // Element type of the operands
+        , typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+blaze::DynamicMatrix<Type>
+   SemiringTest::reference( const MT1& A, const MT2& B, blaze::DynamicMatrix<bool>& pattern )
+{
+   const typename SR::AddOp  add {};
+   const typename SR::MultOp mult{};
+
+   const blaze::DynamicMatrix<Type> DA( A );
+   const blaze::DynamicMatrix<Type> DB( B );
+   blaze::DynamicMatrix<Type> C( A.rows(), B.columns(), SR::template zero<Type>() );
+
+   pattern.resize( A.rows(), B.columns(), false );
+   pattern = false;
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<B.columns(); ++j ) {
+         for( size_t l=0UL; l<A.columns(); ++l ) {
+            if( !blaze::isDefault( DA(i,l) ) && !blaze::isDefault( DB(l,j) ) ) {
+               C(i,j) = add( C(i,j), mult( DA(i,l), DB(l,j) ) );
+               pattern(i,j) = true;
+            }
+         }
+      }
+   }
+
+   return C;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the semiring multiplications of CompressedMatrix.
+//
+// \return void
+*/
+void runTest()
+{
+   SemiringTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the CompressedMatrix semiring multiplication test.
+*/
+#define RUN_COMPRESSEDMATRIX_SEMIRING_TEST \
+   blazetest::mathtest::matrices::compressedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace compressedmatrix
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
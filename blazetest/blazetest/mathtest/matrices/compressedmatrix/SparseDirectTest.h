@@ -0,0 +1,258 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/matrices/compressedmatrix/SparseDirectTest.h
+//  \brief Header file for the CompressedMatrix sparse direct solver test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_MATRICES_COMPRESSEDMATRIX_SPARSEDIRECTTEST_H_
+#define _BLAZETEST_MATHTEST_MATRICES_COMPRESSEDMATRIX_SPARSEDIRECTTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace compressedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the supernodal sparse direct solvers.
+//
+// This class represents a test suite for the blaze::SparseCholesky and blaze::SparseLU class
+// templates, which solve linear systems with a blaze::CompressedMatrix by means of a supernodal
+// sparse decomposition.
+*/
+class SparseDirectTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SparseDirectTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testCholesky();
+   void testLU();
+   void testComplex();
+   void testErrors();
+
+   template< typename MT >
+   MT createGrid( size_t size, double offdiag ) const;
+
+   template< typename MT, typename VT1, typename VT2 >
+   void checkSolution( const MT& A, const VT1& x, const VT2& b ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creation of the matrix of a 2D grid with a random numbering of the grid points.
+//
+// \param size The number of grid points in each dimension.
+// \param offdiag The value of the upper off-diagonal elements.
+// \return The matrix of the grid.
+//
+// This function creates the matrix of a 5-point stencil on a \a size x \a size grid with a
+// random numbering of the grid points. The lower off-diagonal elements are -1, the upper
+// off-diagonal elements are \a offdiag, i.e. the matrix is symmetric positive definite for
+// \a offdiag equal to -1.
+*/
+template< typename MT >  // Type of the matrix
+MT SparseDirectTest::createGrid( size_t size, double offdiag ) const
+{
+   const size_t n( size*size );
+
+   std::vector<size_t> label( n );
+   for( size_t k=0UL; k<n; ++k ) {
+      label[k] = k;
+   }
+   for( size_t k=n; k>1UL; --k ) {
+      std::swap( label[k-1UL], label[blaze::rand<size_t>( 0UL, k-1UL )] );
+   }
+
+   MT A( n, n );
+
+   for( size_t i=0UL; i<size; ++i ) {
+      for( size_t j=0UL; j<size; ++j ) {
+         const size_t v( label[i*size+j] );
+         A(v,v) = 4.5;
+         if( i > 0UL      ) A(v,label[(i-1UL)*size+j]) = -1.0;
+         if( i+1UL < size ) A(v,label[(i+1UL)*size+j]) = offdiag;
+         if( j > 0UL      ) A(v,label[i*size+j-1UL]  ) = -1.0;
+         if( j+1UL < size ) A(v,label[i*size+j+1UL]  ) = offdiag;
+      }
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the residual of the solution of a linear system.
+//
+// \param A The system matrix.
+// \param x The computed solution.
+// \param b The right-hand side.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks whether the maximum norm of the residual \f$ b-Ax \f$ is small compared
+// to the maximum norm of the right-hand side. In case it is not, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename MT     // Type of the system matrix
+        , typename VT1    // Type of the solution
+        , typename VT2 >  // Type of the right-hand side
+void SparseDirectTest::checkSolution( const MT& A, const VT1& x, const VT2& b ) const
+{
+   using std::abs;
+
+   double residual( 0.0 ), bound( 0.0 );
+
+   const auto r( blaze::evaluate( b - A*x ) );
+   for( size_t i=0UL; i<r.size(); ++i ) {
+      residual = std::max<double>( residual, abs( r[i] ) );
+      bound    = std::max<double>( bound, abs( b[i] ) );
+   }
+
+   if( x.size() != b.size() || residual > 1E-10 * bound ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Inaccurate solution of the linear system\n"
+          << " Details:\n"
+          << "   Size of the solution: " << x.size() << "\n"
+          << "   Residual            : " << residual << "\n"
+          << "   Right-hand side     : " << bound << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the supernodal sparse direct solvers.
+//
+// \return void
+*/
+void runTest()
+{
+   SparseDirectTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the CompressedMatrix sparse direct solver test.
+*/
+#define RUN_COMPRESSEDMATRIX_SPARSEDIRECT_TEST \
+   blazetest::mathtest::matrices::compressedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace compressedmatrix
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,331 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/matrices/compressedmatrix/TransposeTest.h
+//  \brief Header file for the CompressedMatrix storage order conversion test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_MATRICES_COMPRESSEDMATRIX_TRANSPOSETEST_H_
+#define _BLAZETEST_MATHTEST_MATRICES_COMPRESSEDMATRIX_TRANSPOSETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace compressedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the storage order conversion tests of CompressedMatrix.
+//
+// This class represents a test suite for the assignment of sparse matrices with opposite
+// storage order to the blaze::CompressedMatrix class template (i.e. the conversion between the
+// CSR and CSC formats, the evaluation of trans() expressions, and the in-place transpose()).
+// The matrices are large enough to exceed the SMP_SMATASSIGN_THRESHOLD, such that the parallel
+// counting sort is used in case the shared memory parallelization is enabled.
+*/
+class TransposeTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit TransposeTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< bool SO >
+   void testConversion( size_t m, size_t n, size_t nonzeros );
+
+   template< typename MT >
+   void checkResult( const MT& result, const blaze::DynamicMatrix<int>& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< bool SO >
+   void initialize( blaze::CompressedMatrix<int,SO>& A, size_t m, size_t n, size_t nonzeros );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the conversion of a compressed matrix to the opposite storage order.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The average number of non-zero elements per row (or column).
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment of a compressed matrix with storage order \a SO to a
+// compressed matrix with opposite storage order, the evaluation of the transpose of the matrix,
+// and the in-place transposition. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< bool SO >  // Storage order of the source matrix
+void TransposeTest::testConversion( size_t m, size_t n, size_t nonzeros )
+{
+   std::ostringstream oss;
+   oss << ( SO ? "Column" : "Row" ) << "-major " << m << "x" << n << " matrix";
+   const std::string label( oss.str() );
+
+   blaze::CompressedMatrix<int,SO> A;
+   initialize( A, m, n, nonzeros );
+
+   const blaze::DynamicMatrix<int> ref( A );
+
+   {
+      test_ = label + " (conversion to the opposite storage order)";
+
+      const blaze::CompressedMatrix<int,!SO> B( A );
+      checkResult( B, ref );
+
+      blaze::CompressedMatrix<int,!SO> C( 2UL, 3UL, 4UL );
+      C = A;
+      checkResult( C, ref );
+   }
+
+   {
+      test_ = label + " (evaluation of the transpose)";
+
+      const blaze::CompressedMatrix<int,SO> B( trans( A ) );
+      checkResult( B, blaze::DynamicMatrix<int>( trans( ref ) ) );
+   }
+
+   {
+      test_ = label + " (in-place transpose)";
+
+      blaze::CompressedMatrix<int,SO> B( A );
+      transpose( B );
+      checkResult( B, blaze::DynamicMatrix<int>( trans( ref ) ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking and comparing the computed result.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the computed result contains the same elements as the expected
+// result, that the number of non-zero elements matches, and that the indices of all rows (or
+// columns) are stored in strictly ascending order. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the computed result
+void TransposeTest::checkResult( const MT& result,
+                                 const blaze::DynamicMatrix<int>& expected ) const
+{
+   const size_t major( blaze::IsRowMajorMatrix_v<MT> ? result.rows() : result.columns() );
+
+   bool sorted( true );
+
+   for( size_t i=0UL; i<major; ++i ) {
+      for( auto element=result.begin(i); element!=result.end(i); ++element ) {
+         if( element != result.begin(i) && std::prev( element )->index() >= element->index() ) {
+            sorted = false;
+         }
+      }
+   }
+
+   if( !sorted || result != expected || result.nonZeros() != nonZeros( expected ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid storage order conversion\n"
+          << " Details:\n"
+          << "   Sorted indices              : " << ( sorted ? "yes" : "no" ) << "\n"
+          << "   Number of non-zeros         : " << result.nonZeros() << "\n"
+          << "   Expected number of non-zeros: " << nonZeros( expected ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given compressed matrix.
+//
+// \param A The compressed matrix to be initialized.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The average number of non-zero elements per row (or column).
+// \return void
+//
+// The rows (or columns) of the matrix are initialized with a strongly varying number of
+// non-zero elements (including empty rows/columns) with random non-zero values. Every
+// row (or column) reserves additional capacity, such that the matrix is not stored
+// contiguously.
+*/
+template< bool SO >  // Storage order of the compressed matrix
+void TransposeTest::initialize( blaze::CompressedMatrix<int,SO>& A, size_t m, size_t n,
+                                size_t nonzeros )
+{
+   const size_t major( SO ? n : m );
+   const size_t minor( SO ? m : n );
+
+   A.resize( m, n, false );
+   A.reset();
+   A.reserve( major * 2UL * nonzeros );
+
+   for( size_t i=0UL; i<major; ++i )
+   {
+      const size_t length( ( i % 5UL == 0UL )
+                           ? 0UL
+                           : blaze::min( blaze::rand<size_t>( 0UL, 2UL*nonzeros ), minor ) );
+      const size_t step  ( length > 0UL ? minor / length : 1UL );
+      const size_t offset( length > 0UL
+                           ? blaze::rand<size_t>( 0UL, minor - (length-1UL)*step - 1UL )
+                           : 0UL );
+
+      for( size_t l=0UL; l<length; ++l ) {
+         const int value( blaze::rand<int>( -9, 9 ) );
+         if( SO ) A.append( offset+l*step, i, value != 0 ? value : 10 );
+         else     A.append( i, offset+l*step, value != 0 ? value : 10 );
+      }
+
+      A.finalize( i );
+   }
+
+   for( size_t i=0UL; i<major; i+=3UL ) {
+      A.reserve( i, A.capacity( i ) + 2UL );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the storage order conversions of CompressedMatrix.
+//
+// \return void
+*/
+void runTest()
+{
+   TransposeTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the CompressedMatrix storage order conversion test.
+*/
+#define RUN_COMPRESSEDMATRIX_TRANSPOSE_TEST \
+   blazetest::mathtest::matrices::compressedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace compressedmatrix
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -94,9 +94,16 @@ class ClassTest
    //**Test functions******************************************************************************
    /*!\name Test functions */
    //@{
-   void testEmptyMatrices ();
-   void testRandomMatrices();
-   void testFailures      ();
+   void testEmptyMatrices     ();
+   void testRandomMatrices    ();
+   void testVersion1Archives  ();
+   void testVersion2Archives  ();
+   void testMappedArchives    ();
+   void testIndexedArchives   ();
+   void testCompressedArchives();
+   void testMatrixMarket      ();
+   void testNumPy             ();
+   void testFailures          ();
 
    template< size_t M, size_t N, typename MT >
    void runAllTests( const MT& src );
@@ -133,7 +140,8 @@ class ClassTest
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   std::string test_;  //!< Label of the currently performed test.
+   std::string test_;         //!< Label of the currently performed test.
+   bool        compression_;  //!< Compression flag for the archives of all tests.
    //@}
    //**********************************************************************************************
 };
@@ -395,6 +403,7 @@ void ClassTest::runTest( const MT1& src, MT2& dst )
    BLAZE_CONSTRAINT_MUST_BE_MATRIX_TYPE( MT2 );
 
    blaze::Archive<std::stringstream> archive;
+   archive.setCompression( compression_ );
 
    testSerialization  ( archive, src );
    testDeserialization( archive, dst );
@@ -0,0 +1,358 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/operations/dmatsmatmult/KernelTest.h
+//  \brief Header file for the dense matrix/sparse matrix multiplication kernel test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_OPERATIONS_DMATSMATMULT_KERNELTEST_H_
+#define _BLAZETEST_MATHTEST_OPERATIONS_DMATSMATMULT_KERNELTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace operations {
+
+namespace dmatsmatmult {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the dense matrix/sparse matrix multiplication kernel test.
+//
+// This class represents a test suite for the compute kernels of the multiplication of a dense
+// matrix and a compressed matrix. The matrices have column counts that are not a multiple of
+// the SIMD width, such that all remainder loops are covered. All combinations of storage orders
+// are tested. All values are small integral values, such that the results are exact independent
+// of the order of the accumulation.
+*/
+class KernelTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit KernelTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type, bool SO1, bool SO2 >
+   void testDMatSMatMult( size_t m, size_t k, size_t n );
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& computedResult, const T2& expectedResult );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type, bool SO >
+   void initialize( blaze::CompressedMatrix<Type,SO>& B, size_t m, size_t n );
+
+   template< typename Type, bool SO >
+   void initialize( blaze::DynamicMatrix<Type,SO>& A, size_t m, size_t n );
+
+   template< typename MT1, typename MT2 >
+   blaze::DynamicMatrix< blaze::ElementType_t<MT1> > multiply( const MT1& A, const MT2& B );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the dense matrix/sparse matrix multiplication kernels.
+//
+// \param m The number of rows of the dense matrix.
+// \param k The number of columns of the dense matrix.
+// \param n The number of columns of the sparse matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication of a dense matrix with storage order \a SO1 and a
+// compressed matrix with storage order \a SO2 for both row-major and column-major target
+// matrices. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Element type of the operands
+        , bool SO1       // Storage order of the dense matrix operand
+        , bool SO2 >     // Storage order of the sparse matrix operand
+void KernelTest::testDMatSMatMult( size_t m, size_t k, size_t n )
+{
+   std::ostringstream oss;
+   oss << ( SO1 ? "Column" : "Row" ) << "-major dense matrix/"
+       << ( SO2 ? "column" : "row" ) << "-major sparse matrix multiplication"
+       << " (" << m << "x" << k << " * " << k << "x" << n << ")";
+   test_ = oss.str();
+
+   blaze::DynamicMatrix<Type,SO1> A;
+   blaze::CompressedMatrix<Type,SO2> B;
+
+   initialize( A, m, k );
+   initialize( B, k, n );
+
+   const blaze::DynamicMatrix<Type,blaze::rowMajor> ref( multiply( A, B ) );
+
+   {
+      blaze::DynamicMatrix<Type,blaze::rowMajor> C;
+
+      C = A * B;
+      checkResult( C, ref );
+
+      C += A * B;
+      checkResult( C, Type(2) * ref );
+
+      C -= A * B;
+      checkResult( C, ref );
+   }
+
+   {
+      blaze::DynamicMatrix<Type,blaze::columnMajor> C;
+
+      C = A * B;
+      checkResult( C, ref );
+
+      C += A * B;
+      checkResult( C, Type(2) * ref );
+
+      C -= A * B;
+      checkResult( C, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking and comparing the computed result.
+//
+// \param computedResult The computed result.
+// \param expectedResult The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// This function is called after each test case to check and compare the computed result.
+// In case the computed and the expected result differ in any way, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename T1    // Matrix type of the computed result
+        , typename T2 >  // Matrix type of the expected result
+void KernelTest::checkResult( const T1& computedResult, const T2& expectedResult )
+{
+   if( computedResult != expectedResult ) {
+      std::ostringstream oss;
+      oss.precision( 20 );
+      oss << " Test : " << test_ << "\n"
+          << " Error: Incorrect result detected\n"
+          << " Details:\n"
+          << "   Computed result:\n" << computedResult << "\n"
+          << "   Expected result:\n" << expectedResult << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given compressed matrix.
+//
+// \param B The compressed matrix to be initialized.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+//
+// The i-th row of the matrix is initialized with \f$ i \bmod 19 \f$ non-zero elements
+// (limited by the number of columns) with random integral values.
+*/
+template< typename Type  // Element type of the compressed matrix
+        , bool SO >      // Storage order of the compressed matrix
+void KernelTest::initialize( blaze::CompressedMatrix<Type,SO>& B, size_t m, size_t n )
+{
+   B.resize( m, n, false );
+   B.reset();
+
+   for( size_t i=0UL; i<m; ++i )
+   {
+      const size_t nonzeros( blaze::min( i % 19UL, n ) );
+      const size_t offset  ( blaze::rand<size_t>( 0UL, n-nonzeros ) );
+
+      for( size_t j=offset; j<offset+nonzeros; ++j ) {
+         B(i,j) = static_cast<Type>( blaze::rand<int>( -9, 9 ) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given dense matrix.
+//
+// \param A The dense matrix to be initialized.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+*/
+template< typename Type  // Element type of the dense matrix
+        , bool SO >      // Storage order of the dense matrix
+void KernelTest::initialize( blaze::DynamicMatrix<Type,SO>& A, size_t m, size_t n )
+{
+   A.resize( m, n, false );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         A(i,j) = static_cast<Type>( blaze::rand<int>( -9, 9 ) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Unblocked reference implementation of the matrix multiplication.
+//
+// \param A The left-hand side matrix operand.
+// \param B The right-hand side matrix operand.
+// \return The result of the multiplication.
+*/
+template< typename MT1    // Type of the left-hand side matrix operand
+        , typename MT2 >  // Type of the right-hand side matrix operand
+blaze::DynamicMatrix< blaze::ElementType_t<MT1> >
+   KernelTest::multiply( const MT1& A, const MT2& B )
+{
+   blaze::DynamicMatrix< blaze::ElementType_t<MT1> > C( A.rows(), B.columns(), 0 );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<B.columns(); ++j ) {
+         for( size_t l=0UL; l<A.columns(); ++l ) {
+            C(i,j) += A(i,l) * B(l,j);
+         }
+      }
+   }
+
+   return C;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the dense matrix/sparse matrix multiplication kernels.
+//
+// \return void
+*/
+void runTest()
+{
+   KernelTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the dense matrix/sparse matrix multiplication kernel test.
+*/
+#define RUN_DMATSMATMULT_KERNEL_TEST \
+   blazetest::mathtest::operations::dmatsmatmult::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dmatsmatmult
+
+} // namespace operations
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
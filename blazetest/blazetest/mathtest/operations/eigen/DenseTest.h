@@ -94,6 +94,7 @@ class DenseTest
    void testLower();
    void testUpper();
    void testDiagonal();
+   void testTiny();
    //@}
    //**********************************************************************************************
 
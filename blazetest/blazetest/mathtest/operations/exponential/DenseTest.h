@@ -93,6 +93,8 @@ class DenseTest
    /*!\name Test functions */
    //@{
    void testSpecific();
+   void testExpmv();
+   void testMatrixFunctions();
 
    template< typename Type >
    void testRandom( size_t N );
@@ -105,6 +105,7 @@ class DenseTest
    template< typename Type > void testUpper    ( size_t N );
    template< typename Type > void testUniUpper ( size_t N );
    template< typename Type > void testDiagonal ( size_t N );
+   template< typename Type > void testMixed    ( size_t N );
    //@}
    //**********************************************************************************************
 
@@ -3596,6 +3597,220 @@ void DenseTest::testDiagonal( size_t N )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the mixed-precision LSE kernels with random \f$ N \times N \f$ general matrices.
+//
+// \param N The number of rows and columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the mixed-precision LSE kernels (i.e. the solveMixed() functions) for
+// random, diagonally dominant \f$ N \times N \f$ general matrices and for an ill-conditioned
+// matrix that requires the fallback to the double precision solver. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DenseTest::testMixed( size_t N )
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+   using blaze::rowVector;
+   using blaze::solveMixed;
+
+
+   //=====================================================================================
+   // Single right-hand side
+   //=====================================================================================
+
+   {
+      test_ = "Mixed-precision LSE (single rhs)";
+
+      DynamicMatrix<Type> A( N, N );
+      DynamicVector<Type> b( N );
+
+      randomize( A );
+      randomize( b );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         A(i,i) += Type( 2*N );
+      }
+
+      const DynamicMatrix<Type,rowMajor>    A1( A );
+      const DynamicMatrix<Type,columnMajor> A2( A );
+
+      DynamicVector<Type> x1;
+      DynamicVector<Type> x2;
+
+      const int it1( solveMixed( A1, x1, b ) );
+      const int it2( solveMixed( A2, x2, b ) );
+
+      if( it1 < 0 || it2 < 0 || A*x1 != b || A*x2 != b ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving LSE failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   System matrix (A):\n" << A << "\n"
+             << "   Right-hand side (b):\n" << b << "\n"
+             << "   Row-major solution (x1, " << it1 << " iterations):\n" << x1 << "\n"
+             << "   Column-major solution (x2, " << it2 << " iterations):\n" << x2 << "\n"
+             << "   A * x1 =\n" << ( A * x1 ) << "\n"
+             << "   A * x2 =\n" << ( A * x2 ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Mixed-precision LSE (single rhs, row vector)";
+
+      DynamicMatrix<Type> A( N, N );
+      DynamicVector<Type,rowVector> b( N );
+
+      randomize( A );
+      randomize( b );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         A(i,i) += Type( 2*N );
+      }
+
+      DynamicVector<Type,rowVector> x;
+
+      const int it( solveMixed( A, x, b ) );
+
+      if( it < 0 || A*trans(x) != trans(b) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving LSE failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   System matrix (A):\n" << A << "\n"
+             << "   Right-hand side (b):\n" << b << "\n"
+             << "   Solution (x, " << it << " iterations):\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Multiple right-hand sides
+   //=====================================================================================
+
+   {
+      test_ = "Mixed-precision LSE (multiple rhs)";
+
+      DynamicMatrix<Type> A( N, N );
+      DynamicMatrix<Type> B( N, 3UL );
+
+      randomize( A );
+      randomize( B );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         A(i,i) += Type( 2*N );
+      }
+
+      const DynamicMatrix<Type,rowMajor>    A1( A );
+      const DynamicMatrix<Type,columnMajor> A2( A );
+
+      DynamicMatrix<Type,rowMajor>    X1;
+      DynamicMatrix<Type,columnMajor> X2;
+
+      const int it1( solveMixed( A1, X1, B ) );
+      const int it2( solveMixed( A2, X2, B ) );
+
+      if( it1 < 0 || it2 < 0 || A*X1 != B || A*X2 != B ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving LSE failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   System matrix (A):\n" << A << "\n"
+             << "   Right-hand side (B):\n" << B << "\n"
+             << "   Row-major solution (X1, " << it1 << " iterations):\n" << X1 << "\n"
+             << "   Column-major solution (X2, " << it2 << " iterations):\n" << X2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Fallback to the double precision solver
+   //=====================================================================================
+
+   if( N >= 12UL )
+   {
+      test_ = "Mixed-precision LSE (ill-conditioned system)";
+
+      DynamicMatrix<Type> A( N, N );
+      DynamicVector<Type> b( N, Type( 1 ) );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         for( size_t j=0UL; j<N; ++j ) {
+            A(i,j) = Type( 1 ) / Type( i+j+1UL );
+         }
+      }
+
+      DynamicVector<Type> x;
+
+      const int it( solveMixed( A, x, b ) );
+
+      if( it != -1 || x.size() != N ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Missing fallback to the double precision solver\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Number of iterations: " << it << "\n"
+             << "   System matrix (A):\n" << A << "\n"
+             << "   Solution (x):\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Invalid system dimensions
+   //=====================================================================================
+
+   {
+      test_ = "Mixed-precision LSE (non-square system)";
+
+      DynamicMatrix<Type> A( N, N+1UL );
+      DynamicVector<Type> b( N );
+      DynamicVector<Type> x;
+
+      randomize( A );
+      randomize( b );
+
+      try {
+         solveMixed( A, x, b );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving the LSE succeeded\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   System matrix (A):\n" << A << "\n"
+             << "   Right-hand side (b):\n" << b << "\n"
+             << "   Solution (x):\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -0,0 +1,467 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/operations/smatdmatschur/KernelTest.h
+//  \brief Header file for the sparse matrix/dense matrix Schur product kernel test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_OPERATIONS_SMATDMATSCHUR_KERNELTEST_H_
+#define _BLAZETEST_MATHTEST_OPERATIONS_SMATDMATSCHUR_KERNELTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace operations {
+
+namespace smatdmatschur {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the sparse matrix/dense matrix Schur product kernel test.
+//
+// This class represents a test suite for the sampled dense-dense matrix multiplication (SDDMM)
+// kernels, which are used for Schur products between a sparse matrix and a dense matrix
+// multiplication. All results are compared to the unfused evaluation, i.e. to the Schur product
+// with the explicitly evaluated dense matrix multiplication. All values are small integral
+// values, such that the results are exact independent of the order of the accumulation.
+*/
+class KernelTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit KernelTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type, bool SO, bool SOA, bool SOB >
+   void testSDDMM( size_t m, size_t k, size_t n );
+
+   template< typename Type, bool SO >
+   void testAliasing( size_t n );
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& computedResult, const T2& expectedResult );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type, bool SO >
+   void initialize( blaze::CompressedMatrix<Type,SO>& S, size_t m, size_t n );
+
+   template< typename Type, bool SO >
+   void initialize( blaze::DynamicMatrix<Type,SO>& A, size_t m, size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the sampled dense-dense matrix multiplication kernels.
+//
+// \param m The number of rows of the sparse matrix.
+// \param k The inner dimension of the dense matrix multiplication.
+// \param n The number of columns of the sparse matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the Schur product \f$ S \circ (A*B^T) \f$ between a compressed matrix
+// with storage order \a SO and the multiplication of two dense matrices with storage orders
+// \a SOA and \a SOB for row-major and column-major dense and sparse target matrices. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Element type of the operands
+        , bool SO        // Storage order of the sparse matrix operand
+        , bool SOA       // Storage order of the left-hand side dense matrix operand
+        , bool SOB >     // Storage order of the right-hand side dense matrix operand
+void KernelTest::testSDDMM( size_t m, size_t k, size_t n )
+{
+   std::ostringstream oss;
+   oss << ( SO ? "Column" : "Row" ) << "-major sparse matrix/("
+       << ( SOA ? "column" : "row" ) << "-major dense matrix * "
+       << ( SOB ? "column" : "row" ) << "-major dense matrix) Schur product"
+       << " (" << m << "x" << n << ", inner dimension " << k << ")";
+   test_ = oss.str();
+
+   blaze::CompressedMatrix<Type,SO> S;
+   blaze::DynamicMatrix<Type,SOA> A;
+   blaze::DynamicMatrix<Type,SOB> B;
+
+   initialize( S, m, n );
+   initialize( A, m, k );
+   initialize( B, n, k );
+
+   const blaze::DynamicMatrix<Type,blaze::rowMajor> P( A * trans( B ) );
+   const blaze::CompressedMatrix<Type,SO> ref( S % P );
+
+   // Assignment to sparse matrices
+   {
+      blaze::CompressedMatrix<Type,blaze::rowMajor> C;
+
+      C = S % ( A * trans( B ) );
+      checkResult( C, ref );
+
+      C = ( A * trans( B ) ) % S;
+      checkResult( C, ref );
+   }
+
+   {
+      blaze::CompressedMatrix<Type,blaze::columnMajor> C;
+
+      C = S % ( A * trans( B ) );
+      checkResult( C, ref );
+
+      C = ( A * trans( B ) ) % S;
+      checkResult( C, ref );
+   }
+
+   // Schur product assignment to sparse matrices
+   {
+      blaze::CompressedMatrix<Type,SO> C( S );
+
+      C %= A * trans( B );
+      checkResult( C, ref );
+   }
+
+   {
+      blaze::CompressedMatrix<Type,!SO> C( S );
+
+      C %= A * trans( B );
+      checkResult( C, ref );
+   }
+
+   // Assignment to dense matrices
+   {
+      blaze::DynamicMatrix<Type,blaze::rowMajor> C;
+
+      C = S % ( A * trans( B ) );
+      checkResult( C, ref );
+
+      C += S % ( A * trans( B ) );
+      checkResult( C, Type(2) * ref );
+
+      C -= S % ( A * trans( B ) );
+      checkResult( C, ref );
+
+      C = P;
+      C %= S % ( A * trans( B ) );
+      checkResult( C, ref % P );
+   }
+
+   {
+      blaze::DynamicMatrix<Type,blaze::columnMajor> C;
+
+      C = S % ( A * trans( B ) );
+      checkResult( C, ref );
+
+      C += S % ( A * trans( B ) );
+      checkResult( C, Type(2) * ref );
+
+      C -= S % ( A * trans( B ) );
+      checkResult( C, ref );
+
+      C = P;
+      C %= S % ( A * trans( B ) );
+      checkResult( C, ref % P );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Aliasing test of the sampled dense-dense matrix multiplication kernels.
+//
+// \param n The number of rows and columns of the square operands.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests Schur products \f$ S \circ (A*B^T) \f$ where the target matrix is also
+// an operand of the expression. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type  // Element type of the operands
+        , bool SO >      // Storage order of the operands
+void KernelTest::testAliasing( size_t n )
+{
+   std::ostringstream oss;
+   oss << ( SO ? "Column" : "Row" ) << "-major sparse matrix/dense matrix multiplication"
+       << " Schur product aliasing (" << n << "x" << n << ")";
+   test_ = oss.str();
+
+   blaze::CompressedMatrix<Type,SO> S;
+   blaze::DynamicMatrix<Type,SO> A, B;
+
+   initialize( S, n, n );
+   initialize( A, n, n );
+   initialize( B, n, n );
+
+   const blaze::DynamicMatrix<Type,SO> P( A * trans( B ) );
+   const blaze::CompressedMatrix<Type,SO> ref( S % P );
+
+   // Assignment to the sparse matrix operand
+   {
+      blaze::CompressedMatrix<Type,SO> C( S );
+
+      C = C % ( A * trans( B ) );
+      checkResult( C, ref );
+   }
+
+   {
+      blaze::CompressedMatrix<Type,SO> C( S );
+
+      C = ( A * trans( B ) ) % C;
+      checkResult( C, ref );
+   }
+
+   // Assignment to the left-hand side dense matrix operand
+   {
+      blaze::DynamicMatrix<Type,SO> C( A );
+
+      C = S % ( C * trans( B ) );
+      checkResult( C, ref );
+   }
+
+   {
+      blaze::DynamicMatrix<Type,SO> C( A );
+
+      C += S % ( C * trans( B ) );
+      checkResult( C, A + ref );
+   }
+
+   // Assignment to the right-hand side dense matrix operand
+   {
+      blaze::DynamicMatrix<Type,SO> C( B );
+
+      C = S % ( A * trans( C ) );
+      checkResult( C, ref );
+   }
+
+   {
+      blaze::DynamicMatrix<Type,SO> C( B );
+
+      C -= S % ( A * trans( C ) );
+      checkResult( C, B - ref );
+   }
+
+   {
+      blaze::DynamicMatrix<Type,SO> C( B );
+
+      C %= S % ( A * trans( C ) );
+      checkResult( C, B % ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking and comparing the computed result.
+//
+// \param computedResult The computed result.
+// \param expectedResult The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// This function is called after each test case to check and compare the computed result.
+// In case the computed and the expected result differ in any way, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename T1    // Matrix type of the computed result
+        , typename T2 >  // Matrix type of the expected result
+void KernelTest::checkResult( const T1& computedResult, const T2& expectedResult )
+{
+   if( computedResult != expectedResult ) {
+      std::ostringstream oss;
+      oss.precision( 20 );
+      oss << " Test : " << test_ << "\n"
+          << " Error: Incorrect result detected\n"
+          << " Details:\n"
+          << "   Computed result:\n" << computedResult << "\n"
+          << "   Expected result:\n" << expectedResult << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given compressed matrix.
+//
+// \param S The compressed matrix to be initialized.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+//
+// The i-th row of the matrix is initialized with \f$ i \bmod 23 \f$ non-zero elements
+// (limited by the number of columns) with random integral values.
+*/
+template< typename Type  // Element type of the compressed matrix
+        , bool SO >      // Storage order of the compressed matrix
+void KernelTest::initialize( blaze::CompressedMatrix<Type,SO>& S, size_t m, size_t n )
+{
+   S.resize( m, n, false );
+   S.reset();
+
+   for( size_t i=0UL; i<m; ++i )
+   {
+      const size_t nonzeros( blaze::min( i % 23UL, n ) );
+      const size_t offset  ( blaze::rand<size_t>( 0UL, n-nonzeros ) );
+
+      for( size_t j=offset; j<offset+nonzeros; ++j ) {
+         S(i,j) = static_cast<Type>( blaze::rand<int>( 1, 9 ) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given dense matrix.
+//
+// \param A The dense matrix to be initialized.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+*/
+template< typename Type  // Element type of the dense matrix
+        , bool SO >      // Storage order of the dense matrix
+void KernelTest::initialize( blaze::DynamicMatrix<Type,SO>& A, size_t m, size_t n )
+{
+   A.resize( m, n, false );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         A(i,j) = static_cast<Type>( blaze::rand<int>( -9, 9 ) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the sparse matrix/dense matrix Schur product kernels.
+//
+// \return void
+*/
+void runTest()
+{
+   KernelTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the sparse matrix/dense matrix Schur product kernel test.
+*/
+#define RUN_SMATDMATSCHUR_KERNEL_TEST \
+   blazetest::mathtest::operations::smatdmatschur::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smatdmatschur
+
+} // namespace operations
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,472 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/operations/smatdvecmult/KernelTest.h
+//  \brief Header file for the sparse matrix/dense vector multiplication kernel test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_OPERATIONS_SMATDVECMULT_KERNELTEST_H_
+#define _BLAZETEST_MATHTEST_OPERATIONS_SMATDVECMULT_KERNELTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace operations {
+
+namespace smatdvecmult {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the sparse matrix/dense vector multiplication kernel test.
+//
+// This class represents a test suite for the optimized compute kernels of the multiplication
+// of a compressed matrix and a dense vector. The rows (or columns) of the sparse matrices
+// contain between 0 and 52 non-zero elements, i.e. the tests cover all remainders of the SIMD
+// widths, rows (or columns) shorter and longer than the prefetch distance, and the non-zero
+// balanced partitioning of the shared memory parallelization. All values are small integral
+// values, such that the results are exact independent of the order of the accumulation.
+*/
+class KernelTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit KernelTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type > void testSMatDVecMult ( size_t m, size_t n );
+   template< typename Type > void testTSMatDVecMult( size_t m, size_t n );
+   template< typename Type > void testTDVecSMatMult( size_t m, size_t n );
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& computedResult, const T2& expectedResult );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   void initialize( MT& A, size_t m, size_t n );
+
+   template< typename VT >
+   void initialize( VT& x, size_t n );
+
+   template< typename MT, typename VT >
+   VT matVecMult( const MT& A, const VT& x );
+
+   template< typename VT, typename MT >
+   VT vecMatMult( const VT& x, const MT& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the row-major sparse matrix/dense vector multiplication.
+//
+// \param m The number of rows of the sparse matrix.
+// \param n The number of columns of the sparse matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the inner product kernels of the row-major sparse matrix/dense vector
+// multiplication. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Element type of the operands
+void KernelTest::testSMatDVecMult( size_t m, size_t n )
+{
+   test_ = "Row-major sparse matrix/dense vector multiplication kernels";
+
+   blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+   blaze::DynamicVector<Type,blaze::columnVector> x, y;
+
+   initialize( A, m, n );
+   initialize( x, n );
+
+   const blaze::DynamicVector<Type,blaze::columnVector> ref( matVecMult( A, x ) );
+
+   y = A * x;
+   checkResult( y, ref );
+
+   y += A * x;
+   checkResult( y, Type(2) * ref );
+
+   y -= A * x;
+   checkResult( y, ref );
+
+   y = A * x * Type(3);
+   checkResult( y, Type(3) * ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the column-major sparse matrix/dense vector multiplication.
+//
+// \param m The number of rows of the sparse matrix.
+// \param n The number of columns of the sparse matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the scatter kernels of the column-major sparse matrix/dense vector
+// multiplication. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Element type of the operands
+void KernelTest::testTSMatDVecMult( size_t m, size_t n )
+{
+   test_ = "Column-major sparse matrix/dense vector multiplication kernels";
+
+   blaze::CompressedMatrix<Type,blaze::columnMajor> A;
+   blaze::DynamicVector<Type,blaze::columnVector> x, y;
+
+   initialize( A, m, n );
+   initialize( x, n );
+
+   const blaze::DynamicVector<Type,blaze::columnVector> ref( matVecMult( A, x ) );
+
+   y = A * x;
+   checkResult( y, ref );
+
+   y += A * x;
+   checkResult( y, Type(2) * ref );
+
+   y -= A * x;
+   checkResult( y, ref );
+
+   y = A * x * Type(3);
+   checkResult( y, Type(3) * ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dense vector/sparse matrix multiplication.
+//
+// \param m The number of rows of the sparse matrix.
+// \param n The number of columns of the sparse matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the scatter kernels (row-major matrices) and the inner product kernels
+// (column-major matrices) of the transpose dense vector/sparse matrix multiplication. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Element type of the operands
+void KernelTest::testTDVecSMatMult( size_t m, size_t n )
+{
+   test_ = "Dense vector/sparse matrix multiplication kernels";
+
+   blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+   blaze::CompressedMatrix<Type,blaze::columnMajor> B;
+   blaze::DynamicVector<Type,blaze::rowVector> x, y;
+
+   initialize( A, m, n );
+   initialize( x, m );
+   B = A;
+
+   const blaze::DynamicVector<Type,blaze::rowVector> ref( vecMatMult( x, A ) );
+
+   y = x * A;
+   checkResult( y, ref );
+
+   y += x * A;
+   checkResult( y, Type(2) * ref );
+
+   y = x * B;
+   checkResult( y, ref );
+
+   y -= x * B;
+   checkResult( y, Type(0) * ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking and comparing the computed result.
+//
+// \param computedResult The computed result.
+// \param expectedResult The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// This function is called after each test case to check and compare the computed result.
+// In case the computed and the expected result differ in any way, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename T1    // Vector type of the computed result
+        , typename T2 >  // Vector type of the expected result
+void KernelTest::checkResult( const T1& computedResult, const T2& expectedResult )
+{
+   if( computedResult != expectedResult ) {
+      std::ostringstream oss;
+      oss.precision( 20 );
+      oss << " Test : " << test_ << "\n"
+          << " Error: Incorrect result detected\n"
+          << " Details:\n"
+          << "   Computed result:\n" << computedResult << "\n"
+          << "   Expected result:\n" << expectedResult << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given compressed matrix.
+//
+// \param A The compressed matrix to be initialized.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+//
+// The i-th row (or column) of the matrix is initialized with \f$ i \bmod 53 \f$ randomly placed
+// non-zero elements (limited by the number of columns (or rows)) with random integral values.
+*/
+template< typename MT >  // Type of the compressed matrix
+void KernelTest::initialize( MT& A, size_t m, size_t n )
+{
+   using ET = blaze::ElementType_t<MT>;
+
+   const bool   rowMajor( blaze::IsRowMajorMatrix_v<MT> );
+   const size_t major( rowMajor ? m : n );
+   const size_t minor( rowMajor ? n : m );
+
+   A.resize( m, n, false );
+   A.reset();
+   A.reserve( major * 26UL );
+
+   std::vector<bool> marker( minor );
+
+   for( size_t i=0UL; i<major; ++i )
+   {
+      const size_t nonzeros( blaze::min( i % 53UL, minor ) );
+
+      std::fill( marker.begin(), marker.end(), false );
+
+      for( size_t k=0UL; k<nonzeros; ) {
+         const size_t j( blaze::rand<size_t>( 0UL, minor-1UL ) );
+         if( !marker[j] ) {
+            marker[j] = true;
+            ++k;
+         }
+      }
+
+      for( size_t j=0UL; j<minor; ++j ) {
+         if( marker[j] ) {
+            const ET value( static_cast<ET>( blaze::rand<int>( -9, 9 ) ) );
+            if( rowMajor ) A.append( i, j, value );
+            else           A.append( j, i, value );
+         }
+      }
+
+      A.finalize( i );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given dense vector.
+//
+// \param x The dense vector to be initialized.
+// \param n The size of the vector.
+// \return void
+*/
+template< typename VT >  // Type of the dense vector
+void KernelTest::initialize( VT& x, size_t n )
+{
+   using ET = blaze::ElementType_t<VT>;
+
+   x.resize( n, false );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      x[i] = static_cast<ET>( blaze::rand<int>( -9, 9 ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reference implementation of the sparse matrix/dense vector multiplication.
+//
+// \param A The left-hand side sparse matrix.
+// \param x The right-hand side dense vector.
+// \return The result of the multiplication.
+*/
+template< typename MT    // Type of the sparse matrix
+        , typename VT >  // Type of the dense vector
+VT KernelTest::matVecMult( const MT& A, const VT& x )
+{
+   const bool rowMajor( blaze::IsRowMajorMatrix_v<MT> );
+
+   VT y( A.rows(), blaze::ElementType_t<VT>() );
+
+   for( size_t i=0UL; i<( rowMajor ? A.rows() : A.columns() ); ++i ) {
+      for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+         if( rowMajor ) y[i] += element->value() * x[element->index()];
+         else           y[element->index()] += element->value() * x[i];
+      }
+   }
+
+   return y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reference implementation of the dense vector/sparse matrix multiplication.
+//
+// \param x The left-hand side dense vector.
+// \param A The right-hand side sparse matrix.
+// \return The result of the multiplication.
+*/
+template< typename VT    // Type of the dense vector
+        , typename MT >  // Type of the sparse matrix
+VT KernelTest::vecMatMult( const VT& x, const MT& A )
+{
+   const bool rowMajor( blaze::IsRowMajorMatrix_v<MT> );
+
+   VT y( A.columns(), blaze::ElementType_t<VT>() );
+
+   for( size_t i=0UL; i<( rowMajor ? A.rows() : A.columns() ); ++i ) {
+      for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+         if( rowMajor ) y[element->index()] += x[i] * element->value();
+         else           y[i] += x[element->index()] * element->value();
+      }
+   }
+
+   return y;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the sparse matrix/dense vector multiplication kernels.
+//
+// \return void
+*/
+void runTest()
+{
+   KernelTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the sparse matrix/dense vector multiplication kernel test.
+*/
+#define RUN_SMATDVECMULT_KERNEL_TEST \
+   blazetest::mathtest::operations::smatdvecmult::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smatdvecmult
+
+} // namespace operations
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -91,6 +91,7 @@ class DenseTest
    void testMatrixRandomSingle(size_t m, size_t n, bool square);
 
    void testGeneral();
+   void testTiny();
    //@}
    //**********************************************************************************************
 
@@ -94,9 +94,12 @@ class ClassTest
    //**Test functions******************************************************************************
    /*!\name Test functions */
    //@{
-   void testEmptyVectors ();
-   void testRandomVectors();
-   void testFailures     ();
+   void testEmptyVectors      ();
+   void testRandomVectors     ();
+   void testVersion1Archives  ();
+   void testCompressedArchives();
+   void testNumPy             ();
+   void testFailures          ();
 
    template< size_t N, typename VT >
    void runAllTests( const VT& src );
@@ -133,7 +136,8 @@ class ClassTest
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   std::string test_;  //!< Label of the currently performed test.
+   std::string test_;         //!< Label of the currently performed test.
+   bool        compression_;  //!< Compression flag for the archives of all tests.
    //@}
    //**********************************************************************************************
 };
@@ -364,6 +368,7 @@ void ClassTest::runTest( const VT1& src, VT2& dst )
    BLAZE_CONSTRAINT_MUST_BE_VECTOR_TYPE( VT2 );
 
    blaze::Archive<std::stringstream> archive;
+   archive.setCompression( compression_ );
 
    testSerialization  ( archive, src );
    testDeserialization( archive, dst );
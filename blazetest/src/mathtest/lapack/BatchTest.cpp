@@ -0,0 +1,140 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/lapack/BatchTest.cpp
+//  \brief Source file for the batch decomposition, inversion and solver test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/util/Complex.h>
+#include <blazetest/mathtest/lapack/BatchTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace lapack {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the BatchTest class test.
+//
+// \exception std::runtime_error Inversion error detected.
+*/
+BatchTest::BatchTest()
+{
+   using blaze::complex;
+
+
+   //=====================================================================================
+   // Single precision tests
+   //=====================================================================================
+
+   //testLU< float >();
+   //testLLH< float >();
+   //testInvert< float >();
+   //testDet< float >();
+   //testSolve< float >();
+   //testEigen< float >();
+
+
+   //=====================================================================================
+   // Double precision tests
+   //=====================================================================================
+
+   testLU< double >();
+   testLLH< double >();
+   testInvert< double >();
+   testDet< double >();
+   testSolve< double >();
+   testEigen< double >();
+
+
+   //=====================================================================================
+   // Double precision complex tests
+   //=====================================================================================
+
+   testLU< complex<double> >();
+   testLLH< complex<double> >();
+   testInvert< complex<double> >();
+   testDet< complex<double> >();
+   testSolve< complex<double> >();
+}
+//*************************************************************************************************
+
+} // namespace lapack
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running LAPACK batch test..." << std::endl;
+
+   try
+   {
+      RUN_LAPACK_BATCH_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during LAPACK batch test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
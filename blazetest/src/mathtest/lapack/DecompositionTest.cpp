@@ -74,8 +74,11 @@ DecompositionTest::DecompositionTest()
    //=====================================================================================
 
    //testGetrf< float >();
+   //testGetrfBlocked< float >();
    //testSytrf< float >();
    //testPotrf< float >();
+   //testSytrfBlocked< float >();
+   //testPotrfBlocked< float >();
    //testGeqrf< float >();
    //testOrgqr< float >();
    //testOrg2r< float >();
@@ -92,6 +95,9 @@ DecompositionTest::DecompositionTest()
    //testOrglq< float >();
    //testOrgl2< float >();
    //testOrmlq< float >();
+   //testDenseCholesky< float >();
+   //testDenseLU< float >();
+   //testDenseQR< float >();
 
 
    //=====================================================================================
@@ -99,8 +105,11 @@ DecompositionTest::DecompositionTest()
    //=====================================================================================
 
    testGetrf< double >();
+   testGetrfBlocked< double >();
    testSytrf< double >();
    testPotrf< double >();
+   testSytrfBlocked< double >();
+   testPotrfBlocked< double >();
    testGeqrf< double >();
    testOrgqr< double >();
    testOrg2r< double >();
@@ -117,6 +126,9 @@ DecompositionTest::DecompositionTest()
    testOrglq< double >();
    testOrgl2< double >();
    testOrmlq< double >();
+   testDenseCholesky< double >();
+   testDenseLU< double >();
+   testDenseQR< double >();
 
 
    //=====================================================================================
@@ -124,9 +136,13 @@ DecompositionTest::DecompositionTest()
    //=====================================================================================
 
    //testGetrf< complex<float> >();
+   //testGetrfBlocked< complex<float> >();
    //testSytrf< complex<float> >();
    //testHetrf< complex<float> >();
    //testPotrf< complex<float> >();
+   //testSytrfBlocked< complex<float> >();
+   //testHetrfBlocked< complex<float> >();
+   //testPotrfBlocked< complex<float> >();
    //testGeqrf< complex<float> >();
    //testUngqr< complex<float> >();
    //testUng2r< complex<float> >();
@@ -143,6 +159,9 @@ DecompositionTest::DecompositionTest()
    //testUnglq< complex<float> >();
    //testUngl2< complex<float> >();
    //testUnmlq< complex<float> >();
+   //testDenseCholesky< complex<float> >();
+   //testDenseLU< complex<float> >();
+   //testDenseQR< complex<float> >();
 
 
    //=====================================================================================
@@ -150,9 +169,13 @@ DecompositionTest::DecompositionTest()
    //=====================================================================================
 
    testGetrf< complex<double> >();
+   testGetrfBlocked< complex<double> >();
    testSytrf< complex<double> >();
    testHetrf< complex<double> >();
    testPotrf< complex<double> >();
+   testSytrfBlocked< complex<double> >();
+   testHetrfBlocked< complex<double> >();
+   testPotrfBlocked< complex<double> >();
    testGeqrf< complex<double> >();
    testUngqr< complex<double> >();
    testUng2r< complex<double> >();
@@ -169,6 +192,9 @@ DecompositionTest::DecompositionTest()
    testUnglq< complex<double> >();
    testUngl2< complex<double> >();
    testUnmlq< complex<double> >();
+   testDenseCholesky< complex<double> >();
+   testDenseLU< complex<double> >();
+   testDenseQR< complex<double> >();
 }
 //*************************************************************************************************
 
@@ -77,6 +77,8 @@ EigenvalueTest::EigenvalueTest()
    //testSyev < float >();
    //testSyevd< float >();
    //testSyevx< float >();
+   //testLanczos< float >();
+   //testArnoldi< float >();
 
 
    //=====================================================================================
@@ -88,6 +90,8 @@ EigenvalueTest::EigenvalueTest()
    testSyev < double >();
    testSyevd< double >();
    testSyevx< double >();
+   testLanczos< double >();
+   testArnoldi< double >();
 
 
    //=====================================================================================
@@ -99,6 +103,8 @@ EigenvalueTest::EigenvalueTest()
    //testHeev < complex<float> >();
    //testHeevd< complex<float> >();
    //testHeevx< complex<float> >();
+   //testLanczos< complex<float> >();
+   //testArnoldi< complex<float> >();
 
 
    //=====================================================================================
@@ -110,6 +116,8 @@ EigenvalueTest::EigenvalueTest()
    testHeev < complex<double> >();
    testHeevd< complex<double> >();
    testHeevx< complex<double> >();
+   testLanczos< complex<double> >();
+   testArnoldi< complex<double> >();
 }
 //*************************************************************************************************
 
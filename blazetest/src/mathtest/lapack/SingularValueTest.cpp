@@ -76,6 +76,7 @@ SingularValueTest::SingularValueTest()
    //testGesvd < float >();
    //testGesdd < float >();
    //testGesvdx< float >();
+   //testRsvd  < float >();
 
 
    //=====================================================================================
@@ -85,6 +86,7 @@ SingularValueTest::SingularValueTest()
    testGesvd < double >();
    testGesdd < double >();
    testGesvdx< double >();
+   testRsvd  < double >();
 
 
    //=====================================================================================
@@ -94,6 +96,7 @@ SingularValueTest::SingularValueTest()
    //testGesvd < complex<float> >();
    //testGesdd < complex<float> >();
    //testGesvdx< complex<float> >();
+   //testRsvd  < complex<float> >();
 
 
    //=====================================================================================
@@ -103,6 +106,7 @@ SingularValueTest::SingularValueTest()
    testGesvd < complex<double> >();
    testGesdd < complex<double> >();
    testGesvdx< complex<double> >();
+   testRsvd  < complex<double> >();
 }
 //*************************************************************************************************
 
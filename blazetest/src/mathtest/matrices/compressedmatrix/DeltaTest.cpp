@@ -0,0 +1,264 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrices/compressedmatrix/DeltaTest.cpp
+//  \brief Source file for the CompressedMatrix delta buffer test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/matrices/compressedmatrix/DeltaTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace compressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CompressedMatrix delta buffer test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+DeltaTest::DeltaTest()
+{
+   testRowMajor();
+   testColumnMajor();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the DeltaBuffer class template with a row-major compressed matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the buffered modification of a row-major compressed matrix.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void DeltaTest::testRowMajor()
+{
+   //=====================================================================================
+   // Row-major insertion, modification and removal
+   //=====================================================================================
+
+   {
+      test_ = "Row-major DeltaBuffer insertion, modification and removal";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> A{ { 1, 0, 2, 0 }, { 0, 0, 0, 0 }, { 3, 0, 0, 4 } };
+      blaze::DeltaBuffer<int,blaze::rowMajor> delta( A, 100UL );
+
+      delta.set( 1UL, 1UL, 5 );
+      delta.set( 0UL, 2UL, 6 );
+      delta.erase( 2UL, 0UL );
+      delta.erase( 1UL, 3UL );
+      delta.set( 2UL, 1UL, 7 );
+      delta.erase( 2UL, 1UL );
+      delta.set( 0UL, 3UL, 0 );
+
+      checkNonZeros( A, 4UL );
+
+      if( delta.pending() != 6UL || delta( 1UL, 1UL ) != 5 || delta( 0UL, 2UL ) != 6 ||
+          delta( 2UL, 0UL ) != 0 || delta( 2UL, 1UL ) != 0 || delta( 2UL, 3UL ) != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid merged view\n"
+             << " Details:\n"
+             << "   Number of pending updates: " << delta.pending() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkResult( delta.matrix(), blaze::DynamicMatrix<int>{ { 1, 0, 6, 0 }, { 0, 5, 0, 0 }, { 0, 0, 0, 4 } } );
+      checkNonZeros( A, 5UL );
+   }
+
+
+   //=====================================================================================
+   // Row-major automatic merge
+   //=====================================================================================
+
+   {
+      test_ = "Row-major DeltaBuffer automatic merge";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 20UL, 30UL );
+      blaze::randomize( A, 100UL );
+      blaze::DynamicMatrix<double,blaze::rowMajor> B( A );
+
+      blaze::DeltaBuffer<double,blaze::rowMajor> delta( A, 7UL );
+
+      for( size_t k=0UL; k<500UL; ++k ) {
+         const size_t i( blaze::rand<size_t>( 0UL, 19UL ) );
+         const size_t j( blaze::rand<size_t>( 0UL, 29UL ) );
+         if( k % 3UL == 0UL ) {
+            delta.erase( i, j );
+            B(i,j) = 0.0;
+         }
+         else {
+            const double value( blaze::rand<double>( 1.0, 2.0 ) );
+            delta.set( i, j, value );
+            B(i,j) = value;
+         }
+      }
+
+      checkResult( delta.matrix(), B );
+      checkNonZeros( A, blaze::nonZeros( B ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the DeltaBuffer class template with a column-major compressed matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the buffered modification of a column-major compressed
+// matrix. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void DeltaTest::testColumnMajor()
+{
+   //=====================================================================================
+   // Column-major insertion, modification and removal
+   //=====================================================================================
+
+   {
+      test_ = "Column-major DeltaBuffer insertion, modification and removal";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> A{ { 1, 0, 2, 0 }, { 0, 0, 0, 0 }, { 3, 0, 0, 4 } };
+      blaze::DeltaBuffer<int,blaze::columnMajor> delta( A, 100UL );
+
+      delta.set( 1UL, 1UL, 5 );
+      delta.set( 0UL, 2UL, 6 );
+      delta.erase( 2UL, 0UL );
+      delta.erase( 1UL, 3UL );
+
+      checkResult( delta.matrix(), blaze::DynamicMatrix<int>{ { 1, 0, 6, 0 }, { 0, 5, 0, 0 }, { 0, 0, 0, 4 } } );
+      checkNonZeros( A, 4UL );
+   }
+
+
+   //=====================================================================================
+   // Column-major automatic merge
+   //=====================================================================================
+
+   {
+      test_ = "Column-major DeltaBuffer automatic merge";
+
+      blaze::CompressedMatrix<double,blaze::columnMajor> A( 30UL, 20UL );
+      blaze::randomize( A, 100UL );
+      blaze::DynamicMatrix<double,blaze::columnMajor> B( A );
+
+      blaze::DeltaBuffer<double,blaze::columnMajor> delta( A, 7UL );
+
+      for( size_t k=0UL; k<500UL; ++k ) {
+         const size_t i( blaze::rand<size_t>( 0UL, 29UL ) );
+         const size_t j( blaze::rand<size_t>( 0UL, 19UL ) );
+         if( k % 3UL == 0UL ) {
+            delta.erase( i, j );
+            B(i,j) = 0.0;
+         }
+         else {
+            const double value( blaze::rand<double>( 1.0, 2.0 ) );
+            delta.set( i, j, value );
+            B(i,j) = value;
+         }
+      }
+
+      checkResult( delta.matrix(), B );
+      checkNonZeros( A, blaze::nonZeros( B ) );
+   }
+}
+//*************************************************************************************************
+
+} // namespace compressedmatrix
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CompressedMatrix delta buffer test..." << std::endl;
+
+   try
+   {
+      RUN_COMPRESSEDMATRIX_DELTA_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CompressedMatrix delta buffer test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
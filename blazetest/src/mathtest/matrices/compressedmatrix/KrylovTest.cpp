@@ -0,0 +1,529 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrices/compressedmatrix/KrylovTest.cpp
+//  \brief Source file for the CompressedMatrix Krylov solver test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <complex>
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/matrices/compressedmatrix/KrylovTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace compressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CompressedMatrix Krylov solver test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+KrylovTest::KrylovTest()
+{
+   testCG();
+   testBiCGSTAB();
+   testGMRES();
+   testMINRES();
+   testComplex();
+   testMonitor();
+   testErrors();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the cg() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the conjugate gradient method with all preconditioners.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void KrylovTest::testCG()
+{
+   const blaze::CompressedMatrix<double,blaze::rowMajor> A( createGrid( 16UL, 0.0, 0.0 ) );
+   const blaze::DynamicVector<double> b( createRhs<double>( A.rows() ) );
+
+   {
+      test_ = "CG without preconditioner";
+
+      blaze::DynamicVector<double> x( A.rows(), 0.0 );
+      blaze::ConvergenceMonitor monitor( 1000UL, 1E-10 );
+      const bool converged( blaze::cg( A, x, b, blaze::IdentityPreconditioner(), monitor ) );
+
+      checkSolution( converged, monitor, A, x, b, 1E-8 );
+   }
+
+   {
+      test_ = "CG with Jacobi preconditioner";
+
+      blaze::DynamicVector<double> x( A.rows(), 0.0 );
+      blaze::ConvergenceMonitor monitor( 1000UL, 1E-10 );
+      const blaze::JacobiPreconditioner<double> M( A );
+      const bool converged( blaze::cg( A, x, b, M, monitor  ) );
+
+      checkSolution( converged, monitor, A, x, b, 1E-8 );
+   }
+
+   {
+      test_ = "CG with SSOR preconditioner";
+
+      blaze::DynamicVector<double> x( A.rows(), 0.0 );
+      blaze::ConvergenceMonitor monitor( 1000UL, 1E-10 );
+      const blaze::SSORPreconditioner<double> M( A, 1.5 );
+      const bool converged( blaze::cg( A, x, b, M, monitor  ) );
+
+      checkSolution( converged, monitor, A, x, b, 1E-8 );
+   }
+
+   {
+      test_ = "CG with IC(0) preconditioner";
+
+      blaze::DynamicVector<double> x( A.rows(), 0.0 );
+      blaze::ConvergenceMonitor monitor( 1000UL, 1E-10 );
+      const bool converged( blaze::cg( A, x, b, blaze::IC0Preconditioner<double>( A ), monitor ) );
+
+      checkSolution( converged, monitor, A, x, b, 1E-8 );
+   }
+
+   {
+      test_ = "CG with dense system matrix";
+
+      const blaze::DynamicMatrix<double,blaze::columnMajor> D( A );
+
+      blaze::DynamicVector<double> x( A.rows(), 0.0 );
+      blaze::ConvergenceMonitor monitor( 1000UL, 1E-10 );
+      const bool converged( blaze::cg( D, x, b, blaze::IC0Preconditioner<double>( D ), monitor ) );
+
+      checkSolution( converged, monitor, A, x, b, 1E-8 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the bicgstab() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the BiCGSTAB method with an unsymmetric system matrix. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void KrylovTest::testBiCGSTAB()
+{
+   const blaze::CompressedMatrix<double,blaze::rowMajor> A( createGrid( 16UL, 0.0, 0.4 ) );
+   const blaze::DynamicVector<double> b( createRhs<double>( A.rows() ) );
+
+   {
+      test_ = "BiCGSTAB without preconditioner";
+
+      blaze::DynamicVector<double> x( A.rows(), 0.0 );
+      blaze::ConvergenceMonitor monitor( 1000UL, 1E-10 );
+      const bool converged( blaze::bicgstab( A, x, b, blaze::IdentityPreconditioner(), monitor ) );
+
+      checkSolution( converged, monitor, A, x, b, 1E-8 );
+   }
+
+   {
+      test_ = "BiCGSTAB with ILU(0) preconditioner";
+
+      blaze::DynamicVector<double> x( A.rows(), 0.0 );
+      blaze::ConvergenceMonitor monitor( 1000UL, 1E-10 );
+      const blaze::ILU0Preconditioner<double> M( A );
+      const bool converged( blaze::bicgstab( A, x, b, M, monitor  ) );
+
+      checkSolution( converged, monitor, A, x, b, 1E-8 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the gmres() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the restarted GMRES method with an unsymmetric system
+// matrix. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void KrylovTest::testGMRES()
+{
+   const blaze::CompressedMatrix<double,blaze::rowMajor> A( createGrid( 16UL, 0.0, 0.4 ) );
+   const blaze::DynamicVector<double> b( createRhs<double>( A.rows() ) );
+
+   {
+      test_ = "GMRES(10) without preconditioner";
+
+      blaze::DynamicVector<double> x( A.rows(), 0.0 );
+      blaze::ConvergenceMonitor monitor( 2000UL, 1E-10 );
+      const blaze::IdentityPreconditioner M;
+      const bool converged( blaze::gmres( A, x, b, M, monitor, 10UL ) );
+
+      checkSolution( converged, monitor, A, x, b, 1E-8 );
+   }
+
+   {
+      test_ = "GMRES(30) with ILU(0) preconditioner";
+
+      blaze::DynamicVector<double> x( A.rows(), 0.0 );
+      blaze::ConvergenceMonitor monitor( 1000UL, 1E-10 );
+      const blaze::ILU0Preconditioner<double> M( A );
+      const bool converged( blaze::gmres( A, x, b, M, monitor  ) );
+
+      checkSolution( converged, monitor, A, x, b, 1E-8 );
+   }
+
+   {
+      test_ = "GMRES with restart length exceeding the system size";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> B( createGrid( 3UL, 0.0, 0.4 ) );
+      const blaze::DynamicVector<double> c( createRhs<double>( B.rows() ) );
+
+      blaze::DynamicVector<double> x( B.rows(), 0.0 );
+      blaze::ConvergenceMonitor monitor( 100UL, 1E-12 );
+      const blaze::IdentityPreconditioner M;
+      const bool converged( blaze::gmres( B, x, c, M, monitor, 50UL ) );
+
+      checkSolution( converged, monitor, B, x, c, 1E-10 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the minres() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the MINRES method with a symmetric indefinite system matrix.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void KrylovTest::testMINRES()
+{
+   {
+      test_ = "MINRES with indefinite system matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( createGrid( 16UL, -0.3, 0.0 ) );
+      const blaze::DynamicVector<double> b( createRhs<double>( A.rows() ) );
+
+      blaze::DynamicVector<double> x( A.rows(), 0.0 );
+      blaze::ConvergenceMonitor monitor( 2000UL, 1E-10 );
+      const bool converged( blaze::minres( A, x, b, blaze::IdentityPreconditioner(), monitor ) );
+
+      checkSolution( converged, monitor, A, x, b, 1E-8 );
+   }
+
+   {
+      test_ = "MINRES with IC(0) preconditioner";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( createGrid( 16UL, 0.0, 0.0 ) );
+      const blaze::DynamicVector<double> b( createRhs<double>( A.rows() ) );
+
+      blaze::DynamicVector<double> x( A.rows(), 0.0 );
+      blaze::ConvergenceMonitor monitor( 1000UL, 1E-11 );
+      const blaze::IC0Preconditioner<double> M( A );
+      const bool converged( blaze::minres( A, x, b, M, monitor  ) );
+
+      checkSolution( converged, monitor, A, x, b, 1E-8 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Krylov solvers with complex system matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all Krylov solvers with complex Hermitian and non-Hermitian
+// system matrices. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void KrylovTest::testComplex()
+{
+   using cplx = std::complex<double>;
+   using MT   = blaze::CompressedMatrix<cplx,blaze::rowMajor>;
+
+   const MT H( createGrid( 12UL, cplx(), cplx( 0.0, 0.3 ) ) );
+   const MT N( createGrid( 12UL, cplx(), cplx( 0.3, 0.2 ) ) );
+   const blaze::DynamicVector<cplx> b( createRhs<cplx>( H.rows() ) );
+
+   {
+      test_ = "Complex CG with IC(0) preconditioner";
+
+      blaze::DynamicVector<cplx> x( H.rows() );
+      blaze::ConvergenceMonitor monitor( 1000UL, 1E-10 );
+      const bool converged( blaze::cg( H, x, b, blaze::IC0Preconditioner<cplx>( H ), monitor ) );
+
+      checkSolution( converged, monitor, H, x, b, 1E-8 );
+   }
+
+   {
+      test_ = "Complex MINRES with Jacobi preconditioner";
+
+      blaze::DynamicVector<cplx> x( H.rows() );
+      blaze::ConvergenceMonitor monitor( 1000UL, 1E-10 );
+      const blaze::JacobiPreconditioner<cplx> M( H );
+      const bool converged( blaze::minres( H, x, b, M, monitor  ) );
+
+      checkSolution( converged, monitor, H, x, b, 1E-8 );
+   }
+
+   {
+      test_ = "Complex BiCGSTAB with SSOR preconditioner";
+
+      blaze::DynamicVector<cplx> x( N.rows() );
+      blaze::ConvergenceMonitor monitor( 1000UL, 1E-10 );
+      const blaze::SSORPreconditioner<cplx> M( N );
+      const bool converged( blaze::bicgstab( N, x, b, M, monitor  ) );
+
+      checkSolution( converged, monitor, N, x, b, 1E-8 );
+   }
+
+   {
+      test_ = "Complex GMRES with ILU(0) preconditioner";
+
+      blaze::DynamicVector<cplx> x( N.rows() );
+      blaze::ConvergenceMonitor monitor( 1000UL, 1E-10 );
+      const blaze::ILU0Preconditioner<cplx> M( N );
+      const bool converged( blaze::gmres( N, x, b, M, monitor  ) );
+
+      checkSolution( converged, monitor, N, x, b, 1E-8 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the ConvergenceMonitor class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the convergence monitoring of the Krylov solvers. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void KrylovTest::testMonitor()
+{
+   const blaze::CompressedMatrix<double,blaze::rowMajor> A( createGrid( 16UL, 0.0, 0.0 ) );
+   const blaze::DynamicVector<double> b( createRhs<double>( A.rows() ) );
+
+   {
+      test_ = "Residual history and callback";
+
+      size_t calls( 0UL );
+
+      blaze::ConvergenceMonitor monitor( 1000UL, 1E-10 );
+      monitor.recordHistory( true );
+      monitor.setCallback( [&calls]( size_t, double ) { ++calls; } );
+
+      blaze::DynamicVector<double> x( A.rows(), 0.0 );
+      blaze::cg( A, x, b, blaze::IdentityPreconditioner(), monitor );
+
+      if( monitor.history().size() != monitor.iterations() + 1UL ||
+          calls != monitor.iterations() + 1UL ||
+          monitor.history().back() != monitor.residual() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid residual history\n"
+             << " Details:\n"
+             << "   Iterations          : " << monitor.iterations() << "\n"
+             << "   Size of the history : " << monitor.history().size() << "\n"
+             << "   Number of callbacks : " << calls << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Maximum number of iterations";
+
+      blaze::ConvergenceMonitor monitor( 5UL, 1E-10 );
+
+      blaze::DynamicVector<double> x( A.rows(), 0.0 );
+
+      if( blaze::cg( A, x, b, blaze::IdentityPreconditioner(), monitor ) ||
+          monitor.converged() || monitor.iterations() != 5UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iteration limit not respected\n"
+             << " Details:\n"
+             << "   Iterations: " << monitor.iterations() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Zero right-hand side";
+
+      const blaze::DynamicVector<double> zero( A.rows(), 0.0 );
+      blaze::DynamicVector<double> x( A.rows(), 1.0 );
+
+      if( !blaze::gmres( A, x, zero ) || x != zero ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid solution for zero right-hand side\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the Krylov solvers and preconditioners.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that invalid arguments are rejected by the Krylov solvers and the
+// preconditioners. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void KrylovTest::testErrors()
+{
+   {
+      test_ = "Non-square system matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( 3UL, 4UL );
+      const blaze::DynamicVector<double> b( 3UL, 1.0 );
+      blaze::DynamicVector<double> x( 4UL, 0.0 );
+
+      try {
+         blaze::bicgstab( A, x, b );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving a system with non-square matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "IC(0) of an indefinite matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( createGrid( 4UL, -6.0, 0.0 ) );
+
+      try {
+         blaze::IC0Preconditioner<double> M( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: IC(0) factorization of an indefinite matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ) {}
+   }
+
+   {
+      test_ = "Invalid SSOR relaxation parameter";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( createGrid( 4UL, 0.0, 0.0 ) );
+
+      try {
+         blaze::SSORPreconditioner<double> M( A, 2.0 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: SSOR preconditioner with invalid relaxation parameter succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+} // namespace compressedmatrix
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CompressedMatrix Krylov solver test..." << std::endl;
+
+   try
+   {
+      RUN_COMPRESSEDMATRIX_KRYLOV_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CompressedMatrix Krylov solver test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
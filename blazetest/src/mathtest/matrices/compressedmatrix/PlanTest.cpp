@@ -0,0 +1,506 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrices/compressedmatrix/PlanTest.cpp
+//  \brief Source file for the CompressedMatrix plan test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/matrices/compressedmatrix/PlanTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace compressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CompressedMatrix plan test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+PlanTest::PlanTest()
+{
+   testPatternPlan();
+   testAssemblyPlan();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the PatternPlan class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the pattern-reusing assignment via the PatternPlan class.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void PlanTest::testPatternPlan()
+{
+   //=====================================================================================
+   // Row-major linear combination
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PatternPlan linear combination";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 3UL, 4UL ), B( 3UL, 4UL ), S;
+      A(0,0) = 1.0; A(1,2) = 2.0; A(2,3) = 3.0;
+      B(0,0) = 4.0; B(0,1) = 5.0; B(2,2) = 6.0;
+
+      blaze::PatternPlan plan;
+      plan.analyze( S, A - 2.0 * B );
+
+      checkNonZeros( S, 5UL );
+      checkResult( S, blaze::DynamicMatrix<double>( A - 2.0 * B ) );
+
+      A(0,0) = -1.0; A(1,2) = 7.0;
+      B(0,0) =  0.5; B(2,2) = 1.0;
+
+      plan.assign( S, A - 3.0 * B );
+
+      checkNonZeros( S, 5UL );
+      checkResult( S, blaze::DynamicMatrix<double>( A - 3.0 * B ) );
+   }
+
+
+   //=====================================================================================
+   // Row-major product
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PatternPlan product";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 12UL, 10UL ), B( 10UL, 14UL ), C( 12UL, 14UL ), S;
+      blaze::randomize( A, 30UL );
+      blaze::randomize( B, 35UL );
+      blaze::randomize( C, 20UL );
+
+      blaze::PatternPlan plan;
+      plan.analyze( S, C + A * B );
+
+      checkResult( S, blaze::DynamicMatrix<double>( C + A * B ) );
+
+      const size_t nonzeros( S.nonZeros() );
+
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+            element->value() = blaze::rand<double>();
+         }
+      }
+
+      plan.assign( S, C + A * B / 2.0 );
+
+      checkNonZeros( S, nonzeros );
+      checkResult( S, blaze::DynamicMatrix<double>( C + A * B / 2.0 ) );
+   }
+
+
+   //=====================================================================================
+   // Column-major product
+   //=====================================================================================
+
+   {
+      test_ = "Column-major PatternPlan product";
+
+      blaze::CompressedMatrix<double,blaze::columnMajor> A( 9UL, 7UL ), B( 7UL, 8UL ), S;
+      blaze::randomize( A, 20UL );
+      blaze::randomize( B, 25UL );
+
+      blaze::PatternPlan plan;
+      plan.analyze( S, A * B - A * B );
+
+      checkResult( S, blaze::DynamicMatrix<double>( 9UL, 8UL, 0.0 ) );
+
+      plan.assign( S, 3.0 * ( A * B ) - A * B );
+
+      checkResult( S, blaze::DynamicMatrix<double,blaze::columnMajor>( 2.0 * ( A * B ) ) );
+   }
+
+
+   //=====================================================================================
+   // Invalid assignments
+   //=====================================================================================
+
+   {
+      test_ = "PatternPlan invalid assignment";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 3UL, 3UL ), B( 3UL, 3UL ), S;
+      A(0,0) = 1.0; A(1,1) = 2.0;
+      B(0,1) = 3.0;
+
+      blaze::PatternPlan plan;
+      plan.analyze( S, A + B );
+
+      try {
+         plan.assign( S, A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of mismatching expression succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      B(2,2) = 4.0;
+
+      try {
+         plan.assign( S, A + B );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of modified operand succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Modified number of non-zero elements per row
+   //=====================================================================================
+
+   {
+      test_ = "PatternPlan modified number of non-zero elements per row";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 3UL, 3UL ), B( 3UL, 3UL ), S;
+      A(0,0) = 1.0; A(1,1) = 2.0;
+      B(0,1) = 3.0; B(2,0) = 4.0;
+
+      blaze::PatternPlan plan;
+      plan.analyze( S, A + A * B );
+
+      B.erase( 0UL, 1UL );
+      B(1,2) = 5.0;
+
+      try {
+         plan.assign( S, A + A * B );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of modified product operand succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      B.erase( 1UL, 2UL );
+      B(0,1) = 3.0;
+      A.erase( 1UL, 1UL );
+      A(2,2) = 2.0;
+
+      try {
+         plan.assign( S, A + A * B );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of modified operand succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Modified sparsity patterns with unchanged number of non-zero elements
+   //=====================================================================================
+
+   {
+      test_ = "PatternPlan modified sparsity pattern";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 3UL, 3UL ), B( 3UL, 3UL ), S;
+      A(0,0) = 1.0; A(1,1) = 2.0;
+      B(0,1) = 3.0; B(2,0) = 4.0;
+
+      blaze::PatternPlan plan( true );
+      plan.analyze( S, A + A * B );
+
+      B.erase( 0UL, 1UL );
+      B(0,2) = 5.0;
+
+      try {
+         plan.assign( S, A + A * B );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of modified product operand succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      B.erase( 0UL, 2UL );
+      B(0,1) = 3.0;
+      A.erase( 1UL, 1UL );
+      A(1,2) = 2.0;
+
+      try {
+         plan.assign( S, A + A * B );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of modified operand succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      A.erase( 1UL, 2UL );
+      A(1,1) = 2.0;
+      S.erase( 0UL, 0UL );
+      S(2,2) = 0.0;
+
+      try {
+         plan.assign( S, A + A * B );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment to modified target matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Target matrix with unused capacity between the rows
+   //=====================================================================================
+
+   {
+      test_ = "PatternPlan unpacked target matrix";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 6UL, 5UL ), B( 5UL, 7UL ), S;
+      blaze::randomize( A, 12UL );
+      blaze::randomize( B, 15UL );
+
+      blaze::PatternPlan plan;
+      plan.analyze( S, A * B );
+
+      S.reserve( 0UL, S.capacity( 0UL ) + 5UL );
+      S.reserve( 3UL, S.capacity( 3UL ) + 2UL );
+
+      plan.assign( S, 2.0 * ( A * B ) );
+
+      checkResult( S, blaze::DynamicMatrix<double>( 2.0 * ( A * B ) ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the AssemblyPlan class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the coordinate-based assembly via the AssemblyPlan class.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void PlanTest::testAssemblyPlan()
+{
+   //=====================================================================================
+   // Row-major assembly
+   //=====================================================================================
+
+   {
+      test_ = "Row-major AssemblyPlan";
+
+      const std::vector<size_t> rows   { 0UL, 2UL, 0UL, 1UL, 2UL, 0UL };
+      const std::vector<size_t> columns{ 1UL, 2UL, 1UL, 0UL, 2UL, 3UL };
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> K;
+      blaze::AssemblyPlan plan;
+      plan.analyze( K, 3UL, 4UL, rows, columns );
+
+      checkNonZeros( K, 4UL );
+
+      plan.assemble( K, blaze::DynamicVector<int>{ 1, 2, 3, 4, 5, 6 } );
+
+      checkResult( K, blaze::DynamicMatrix<int>{ { 0, 4, 0, 6 }, { 4, 0, 0, 0 }, { 0, 0, 7, 0 } } );
+
+      plan.assemble( K, blaze::DynamicVector<int>{ 2, 2, 2, 2, 2, 2 } );
+
+      checkResult( K, blaze::DynamicMatrix<int>{ { 0, 4, 0, 2 }, { 2, 0, 0, 0 }, { 0, 0, 4, 0 } } );
+   }
+
+
+   //=====================================================================================
+   // Column-major assembly
+   //=====================================================================================
+
+   {
+      test_ = "Column-major AssemblyPlan";
+
+      const std::vector<size_t> rows   { 0UL, 2UL, 0UL, 1UL, 2UL, 0UL };
+      const std::vector<size_t> columns{ 1UL, 2UL, 1UL, 0UL, 2UL, 3UL };
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> K;
+      blaze::AssemblyPlan plan;
+      plan.analyze( K, 3UL, 4UL, rows, columns );
+      plan.assemble( K, blaze::DynamicVector<int>{ 1, 2, 3, 4, 5, 6 } );
+
+      checkNonZeros( K, 4UL );
+      checkResult( K, blaze::DynamicMatrix<int>{ { 0, 4, 0, 6 }, { 4, 0, 0, 0 }, { 0, 0, 7, 0 } } );
+   }
+
+
+   //=====================================================================================
+   // Target matrix with unused capacity between the rows
+   //=====================================================================================
+
+   {
+      test_ = "AssemblyPlan unpacked target matrix";
+
+      const std::vector<size_t> rows   { 0UL, 2UL, 0UL, 1UL, 2UL, 0UL };
+      const std::vector<size_t> columns{ 1UL, 2UL, 1UL, 0UL, 2UL, 3UL };
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> K;
+      blaze::AssemblyPlan plan;
+      plan.analyze( K, 3UL, 4UL, rows, columns );
+
+      K.reserve( 0UL, K.capacity( 0UL ) + 3UL );
+      K.reserve( 1UL, K.capacity( 1UL ) + 1UL );
+
+      plan.assemble( K, blaze::DynamicVector<int>{ 1, 2, 3, 4, 5, 6 } );
+
+      checkNonZeros( K, 4UL );
+      checkResult( K, blaze::DynamicMatrix<int>{ { 0, 4, 0, 6 }, { 4, 0, 0, 0 }, { 0, 0, 7, 0 } } );
+   }
+
+
+   //=====================================================================================
+   // Modified sparsity pattern with unchanged number of non-zero elements
+   //=====================================================================================
+
+   {
+      test_ = "AssemblyPlan modified sparsity pattern";
+
+      const std::vector<size_t> rows   { 0UL, 1UL, 2UL };
+      const std::vector<size_t> columns{ 0UL, 1UL, 2UL };
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> K;
+      blaze::AssemblyPlan plan;
+      plan.analyze( K, 3UL, 3UL, rows, columns );
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> L;
+      blaze::AssemblyPlan verifyingPlan( true );
+      verifyingPlan.analyze( L, 3UL, 3UL, rows, columns );
+
+      K.erase( 2UL, 2UL );
+      K(0,2) = 0;
+
+      try {
+         plan.assemble( K, blaze::DynamicVector<int>{ 1, 2, 3 } );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assembly into modified target matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      L.erase( 2UL, 2UL );
+      L(2,0) = 0;
+
+      try {
+         verifyingPlan.assemble( L, blaze::DynamicVector<int>{ 1, 2, 3 } );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assembly into modified target matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+} // namespace compressedmatrix
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CompressedMatrix plan test..." << std::endl;
+
+   try
+   {
+      RUN_COMPRESSEDMATRIX_PLAN_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CompressedMatrix plan test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
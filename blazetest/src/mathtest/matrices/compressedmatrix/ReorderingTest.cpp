@@ -0,0 +1,403 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrices/compressedmatrix/ReorderingTest.cpp
+//  \brief Source file for the CompressedMatrix reordering test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/matrices/compressedmatrix/ReorderingTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace compressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CompressedMatrix reordering test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ReorderingTest::ReorderingTest()
+{
+   testRowMajor();
+   testColumnMajor();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the reordering functionality with a row-major compressed matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the bandwidth-reducing reordering of a row-major compressed
+// matrix. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ReorderingTest::testRowMajor()
+{
+   using MT = blaze::CompressedMatrix<double,blaze::rowMajor>;
+
+
+   //=====================================================================================
+   // Row-major reverse Cuthill-McKee ordering
+   //=====================================================================================
+
+   {
+      test_ = "Row-major reverse Cuthill-McKee ordering";
+
+      const MT A( createGrid<MT>( 12UL ) );
+      const std::vector<size_t> perm( blaze::rcm( A ) );
+
+      checkPermutation( perm, A.rows() );
+
+      const MT B( blaze::permute( A, perm ) );
+
+      checkPermuted( B, A, perm );
+
+      if( blaze::bandwidth( B ) > 12UL || blaze::bandwidth( B ) >= blaze::bandwidth( A ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Insufficient bandwidth reduction\n"
+             << " Details:\n"
+             << "   Original bandwidth : " << blaze::bandwidth( A ) << "\n"
+             << "   Reordered bandwidth: " << blaze::bandwidth( B ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major nested dissection ordering
+   //=====================================================================================
+
+   {
+      test_ = "Row-major nested dissection ordering";
+
+      const MT A( createGrid<MT>( 12UL ) );
+      const std::vector<size_t> perm( blaze::nestedDissection( A, 8UL ) );
+
+      checkPermutation( perm, A.rows() );
+      checkPermuted( blaze::permute( A, perm ), A, perm );
+   }
+
+
+   //=====================================================================================
+   // Row-major permuted matrix/vector multiplication
+   //=====================================================================================
+
+   {
+      test_ = "Row-major permuted matrix/vector multiplication";
+
+      const MT A( createGrid<MT>( 10UL ) );
+      blaze::DynamicVector<double> x( A.columns() );
+      blaze::randomize( x );
+
+      const std::vector<size_t> perm( blaze::rcm( A ) );
+      const MT B( blaze::permute( A, perm ) );
+      const blaze::DynamicVector<double> y( B * blaze::permute( x, perm ) );
+
+      if( !isEqual( blaze::permute( y, blaze::invertPermutation( perm ) ), A * x ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid result of permuted matrix/vector multiplication\n"
+             << " Details:\n"
+             << "   Result:\n" << blaze::permute( y, blaze::invertPermutation( perm ) ) << "\n"
+             << "   Expected result:\n" << ( A * x ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major disconnected and empty matrices
+   //=====================================================================================
+
+   {
+      test_ = "Row-major disconnected and empty matrices";
+
+      MT A( 7UL, 7UL );
+      A(0,5) = 1.0;
+      A(5,3) = 2.0;
+      A(6,6) = 3.0;
+
+      const std::vector<size_t> perm1( blaze::rcm( A ) );
+      checkPermutation( perm1, 7UL );
+      checkPermuted( blaze::permute( A, perm1 ), A, perm1 );
+
+      const std::vector<size_t> perm2( blaze::nestedDissection( A, 1UL ) );
+      checkPermutation( perm2, 7UL );
+      checkPermuted( blaze::permute( A, perm2 ), A, perm2 );
+
+      checkPermutation( blaze::rcm( MT() ), 0UL );
+      checkPermutation( blaze::nestedDissection( MT() ), 0UL );
+   }
+
+
+   //=====================================================================================
+   // Row-major invalid permutations
+   //=====================================================================================
+
+   {
+      test_ = "Row-major invalid permutations";
+
+      const MT A( createGrid<MT>( 3UL ) );
+
+      try {
+         blaze::permute( A, std::vector<size_t>( 9UL, 0UL ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Permutation with duplicate indices succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         blaze::rcm( MT( 3UL, 4UL ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reordering of a non-square matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reordering functionality with a column-major compressed matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the bandwidth-reducing reordering of a column-major compressed
+// matrix. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ReorderingTest::testColumnMajor()
+{
+   using MT = blaze::CompressedMatrix<double,blaze::columnMajor>;
+
+
+   //=====================================================================================
+   // Column-major reverse Cuthill-McKee ordering
+   //=====================================================================================
+
+   {
+      test_ = "Column-major reverse Cuthill-McKee ordering";
+
+      const MT A( createGrid<MT>( 12UL ) );
+      const std::vector<size_t> perm( blaze::rcm( A ) );
+
+      checkPermutation( perm, A.rows() );
+
+      const MT B( blaze::permute( A, perm ) );
+
+      checkPermuted( B, A, perm );
+
+      if( blaze::bandwidth( B ) > 12UL || blaze::bandwidth( B ) >= blaze::bandwidth( A ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Insufficient bandwidth reduction\n"
+             << " Details:\n"
+             << "   Original bandwidth : " << blaze::bandwidth( A ) << "\n"
+             << "   Reordered bandwidth: " << blaze::bandwidth( B ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major nested dissection ordering
+   //=====================================================================================
+
+   {
+      test_ = "Column-major nested dissection ordering";
+
+      const MT A( createGrid<MT>( 12UL ) );
+      const std::vector<size_t> perm( blaze::nestedDissection( A, 8UL ) );
+
+      checkPermutation( perm, A.rows() );
+      checkPermuted( blaze::permute( A, perm ), A, perm );
+   }
+
+
+   //=====================================================================================
+   // Column-major permuted matrix/vector multiplication
+   //=====================================================================================
+
+   {
+      test_ = "Column-major permuted matrix/vector multiplication";
+
+      const MT A( createGrid<MT>( 10UL ) );
+      blaze::DynamicVector<double> x( A.columns() );
+      blaze::randomize( x );
+
+      const std::vector<size_t> perm( blaze::rcm( A ) );
+      const MT B( blaze::permute( A, perm ) );
+      const blaze::DynamicVector<double> y( B * blaze::permute( x, perm ) );
+
+      if( !isEqual( blaze::permute( y, blaze::invertPermutation( perm ) ), A * x ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid result of permuted matrix/vector multiplication\n"
+             << " Details:\n"
+             << "   Result:\n" << blaze::permute( y, blaze::invertPermutation( perm ) ) << "\n"
+             << "   Expected result:\n" << ( A * x ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major disconnected and empty matrices
+   //=====================================================================================
+
+   {
+      test_ = "Column-major disconnected and empty matrices";
+
+      MT A( 7UL, 7UL );
+      A(0,5) = 1.0;
+      A(5,3) = 2.0;
+      A(6,6) = 3.0;
+
+      const std::vector<size_t> perm1( blaze::rcm( A ) );
+      checkPermutation( perm1, 7UL );
+      checkPermuted( blaze::permute( A, perm1 ), A, perm1 );
+
+      const std::vector<size_t> perm2( blaze::nestedDissection( A, 1UL ) );
+      checkPermutation( perm2, 7UL );
+      checkPermuted( blaze::permute( A, perm2 ), A, perm2 );
+
+      checkPermutation( blaze::rcm( MT() ), 0UL );
+      checkPermutation( blaze::nestedDissection( MT() ), 0UL );
+   }
+
+
+   //=====================================================================================
+   // Column-major invalid permutations
+   //=====================================================================================
+
+   {
+      test_ = "Column-major invalid permutations";
+
+      const MT A( createGrid<MT>( 3UL ) );
+
+      try {
+         blaze::permute( A, std::vector<size_t>( 9UL, 0UL ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Permutation with duplicate indices succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         blaze::rcm( MT( 3UL, 4UL ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reordering of a non-square matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+} // namespace compressedmatrix
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CompressedMatrix reordering test..." << std::endl;
+
+   try
+   {
+      RUN_COMPRESSEDMATRIX_REORDERING_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CompressedMatrix reordering test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
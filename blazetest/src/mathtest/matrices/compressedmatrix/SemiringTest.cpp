@@ -0,0 +1,136 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrices/compressedmatrix/SemiringTest.cpp
+//  \brief Source file for the CompressedMatrix semiring multiplication test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/matrices/compressedmatrix/SemiringTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace compressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CompressedMatrix semiring multiplication test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+SemiringTest::SemiringTest()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+   using blaze::PlusTimes;
+   using blaze::MinPlus;
+   using blaze::OrAnd;
+
+   testMatVecMult<PlusTimes,int,rowMajor>      ( "PlusTimes", 37UL, 29UL, 5UL );
+   testMatVecMult<PlusTimes,int,columnMajor>   ( "PlusTimes", 37UL, 29UL, 5UL );
+   testMatVecMult<PlusTimes,double,rowMajor>   ( "PlusTimes", 1531UL, 1511UL, 31UL );
+   testMatVecMult<PlusTimes,double,columnMajor>( "PlusTimes", 1531UL, 1511UL, 31UL );
+   testMatVecMult<MinPlus,int,rowMajor>        ( "MinPlus", 37UL, 29UL, 5UL );
+   testMatVecMult<MinPlus,int,columnMajor>     ( "MinPlus", 37UL, 29UL, 5UL );
+   testMatVecMult<MinPlus,double,rowMajor>     ( "MinPlus", 1531UL, 1511UL, 31UL );
+   testMatVecMult<MinPlus,double,columnMajor>  ( "MinPlus", 1531UL, 1511UL, 31UL );
+   testMatVecMult<MaxTimes,double,rowMajor>    ( "MaxTimes", 37UL, 29UL, 5UL );
+   testMatVecMult<MaxTimes,double,columnMajor> ( "MaxTimes", 37UL, 29UL, 5UL );
+   testMatVecMult<OrAnd,bool,rowMajor>         ( "OrAnd", 37UL, 29UL, 5UL );
+   testMatVecMult<OrAnd,bool,columnMajor>      ( "OrAnd", 37UL, 29UL, 5UL );
+
+   testMatMatMult<PlusTimes,int,rowMajor>      ( "PlusTimes", 37UL, 23UL, 29UL, 4UL );
+   testMatMatMult<PlusTimes,int,columnMajor>   ( "PlusTimes", 37UL, 23UL, 29UL, 4UL );
+   testMatMatMult<PlusTimes,double,rowMajor>   ( "PlusTimes", 311UL, 307UL, 293UL, 15UL );
+   testMatMatMult<MinPlus,int,rowMajor>        ( "MinPlus", 37UL, 23UL, 29UL, 4UL );
+   testMatMatMult<MinPlus,double,columnMajor>  ( "MinPlus", 37UL, 23UL, 29UL, 4UL );
+   testMatMatMult<MinPlus,double,rowMajor>     ( "MinPlus", 311UL, 307UL, 293UL, 15UL );
+   testMatMatMult<MaxTimes,double,rowMajor>    ( "MaxTimes", 37UL, 23UL, 29UL, 4UL );
+   testMatMatMult<MaxTimes,double,columnMajor> ( "MaxTimes", 37UL, 23UL, 29UL, 4UL );
+   testMatMatMult<OrAnd,bool,rowMajor>         ( "OrAnd", 37UL, 23UL, 29UL, 4UL );
+   testMatMatMult<OrAnd,bool,columnMajor>      ( "OrAnd", 37UL, 23UL, 29UL, 4UL );
+}
+//*************************************************************************************************
+
+} // namespace compressedmatrix
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CompressedMatrix semiring multiplication test..." << std::endl;
+
+   try
+   {
+      RUN_COMPRESSEDMATRIX_SEMIRING_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CompressedMatrix semiring multiplication test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,424 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrices/compressedmatrix/SparseDirectTest.cpp
+//  \brief Source file for the CompressedMatrix sparse direct solver test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <complex>
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blazetest/mathtest/matrices/compressedmatrix/SparseDirectTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace compressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CompressedMatrix sparse direct solver test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+SparseDirectTest::SparseDirectTest()
+{
+   testCholesky();
+   testLU();
+   testComplex();
+   testErrors();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SparseCholesky class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the supernodal sparse Cholesky decomposition. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SparseDirectTest::testCholesky()
+{
+   //=====================================================================================
+   // Row-major matrix with all orderings
+   //=====================================================================================
+
+   {
+      test_ = "Row-major sparse Cholesky decomposition";
+
+      using MT = blaze::CompressedMatrix<double,blaze::rowMajor>;
+
+      const MT A( createGrid<MT>( 20UL, -1.0 ) );
+
+      blaze::DynamicVector<double> b( A.rows() );
+      randomize( b );
+
+      const blaze::SparseOrdering orderings[] = {
+         blaze::naturalOrdering, blaze::rcmOrdering, blaze::nestedDissectionOrdering };
+
+      for( blaze::SparseOrdering ordering : orderings ) {
+         blaze::SparseCholesky<double> chol( A, ordering );
+         checkSolution( A, chol.solve( b ), b );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix with multiple right-hand sides
+   //=====================================================================================
+
+   {
+      test_ = "Column-major sparse Cholesky decomposition";
+
+      using MT = blaze::CompressedMatrix<double,blaze::columnMajor>;
+
+      const MT A( createGrid<MT>( 17UL, -1.0 ) );
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> B( A.rows(), 3UL );
+      randomize( B );
+
+      blaze::SparseCholesky<double> chol( A );
+      const blaze::DynamicMatrix<double,blaze::columnMajor> X( chol.solve( B ) );
+
+      for( size_t j=0UL; j<B.columns(); ++j ) {
+         checkSolution( A, column( X, j ), column( B, j ) );
+      }
+   }
+
+
+   //=====================================================================================
+   // Symmetric matrix adaptor with refactorization
+   //=====================================================================================
+
+   {
+      test_ = "Sparse Cholesky decomposition of a symmetric matrix";
+
+      using MT = blaze::CompressedMatrix<double,blaze::rowMajor>;
+
+      blaze::SymmetricMatrix<MT> A( createGrid<MT>( 16UL, -1.0 ) );
+
+      blaze::DynamicVector<double> b( A.rows() );
+      randomize( b );
+
+      blaze::SparseCholesky<double> chol( A );
+      checkSolution( A, chol.solve( b ), b );
+
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         A(i,i) = 8.0;
+      }
+
+      chol.factorize( A );
+      checkSolution( A, chol.solve( b ), b );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SparseLU class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the supernodal sparse LU decomposition. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void SparseDirectTest::testLU()
+{
+   //=====================================================================================
+   // Row-major unsymmetric matrix
+   //=====================================================================================
+
+   {
+      test_ = "Row-major sparse LU decomposition";
+
+      using MT = blaze::CompressedMatrix<double,blaze::rowMajor>;
+
+      const MT A( createGrid<MT>( 20UL, 2.0 ) );
+
+      blaze::DynamicVector<double> b( A.rows() );
+      randomize( b );
+
+      blaze::SparseLU<double> lu( A );
+      checkSolution( A, lu.solve( b ), b );
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix requiring row interchanges
+   //=====================================================================================
+
+   {
+      test_ = "Column-major sparse LU decomposition with pivoting";
+
+      using MT = blaze::CompressedMatrix<double,blaze::columnMajor>;
+
+      MT A( createGrid<MT>( 15UL, 3.0 ) );
+      for( size_t i=0UL; i<A.rows(); i+=3UL ) {
+         A(i,i) = 1E-3;
+      }
+
+      blaze::DynamicVector<double> b( A.rows() );
+      randomize( b );
+
+      blaze::SparseLU<double> lu( A, blaze::rcmOrdering );
+      checkSolution( A, lu.solve( b ), b );
+
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         A(i,i) = 2.0;
+      }
+
+      lu.factorize( A );
+      checkSolution( A, lu.solve( b ), b );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the sparse direct solvers for complex matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the supernodal sparse decompositions of complex Hermitian
+// and unsymmetric matrices. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void SparseDirectTest::testComplex()
+{
+   using cplx = std::complex<double>;
+   using MT = blaze::CompressedMatrix<cplx,blaze::rowMajor>;
+
+   const size_t n( 200UL );
+
+   MT A( n, n );
+   for( size_t i=0UL; i<n; ++i ) {
+      A(i,i) = cplx( 8.0, 0.0 );
+      if( i+1UL < n ) {
+         A(i,i+1UL) = cplx( 1.0, 2.0 );
+         A(i+1UL,i) = cplx( 1.0, -2.0 );
+      }
+      if( i+13UL < n ) {
+         A(i,i+13UL) = cplx( 0.0, 1.0 );
+         A(i+13UL,i) = cplx( 0.0, -1.0 );
+      }
+   }
+
+   blaze::DynamicVector<cplx> b( n );
+   randomize( b );
+
+
+   //=====================================================================================
+   // Complex Hermitian Cholesky decomposition
+   //=====================================================================================
+
+   {
+      test_ = "Sparse Cholesky decomposition of a complex Hermitian matrix";
+
+      blaze::SparseCholesky<cplx> chol( A );
+      checkSolution( A, chol.solve( b ), b );
+   }
+
+
+   //=====================================================================================
+   // Complex LU decomposition
+   //=====================================================================================
+
+   {
+      test_ = "Sparse LU decomposition of a complex matrix";
+
+      MT B( A );
+      for( size_t i=0UL; i+1UL<n; ++i ) {
+         B(i,i+1UL) = cplx( 3.0, 1.0 );
+      }
+
+      blaze::SparseLU<cplx> lu( B );
+      checkSolution( B, lu.solve( b ), b );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the sparse direct solvers.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the detection of invalid matrices, non-matching sparsity patterns,
+// failed decompositions, and invalid solves. In case an error is not detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void SparseDirectTest::testErrors()
+{
+   using MT = blaze::CompressedMatrix<double,blaze::rowMajor>;
+
+   test_ = "Error handling of the sparse direct solvers";
+
+   auto fail = [this]( const std::string& error ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error << "\n";
+      throw std::runtime_error( oss.str() );
+   };
+
+   try {
+      blaze::SparseCholesky<double> chol( MT( 4UL, 5UL ) );
+      fail( "Non-square matrix not detected" );
+   }
+   catch( std::invalid_argument& ) {}
+
+   blaze::SparseCholesky<double> chol;
+
+   try {
+      chol.solve( blaze::DynamicVector<double>( 4UL ) );
+      fail( "Solve without factorization not detected" );
+   }
+   catch( std::logic_error& ) {}
+
+   MT A( createGrid<MT>( 8UL, -1.0 ) );
+   chol.compute( A );
+
+   try {
+      MT B( A );
+      B(0UL,A.rows()-1UL) = 1.0;
+      B(A.rows()-1UL,0UL) = 1.0;
+      chol.factorize( B );
+      fail( "Non-matching sparsity pattern not detected" );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      chol.solve( blaze::DynamicVector<double>( A.rows()+1UL ) );
+      fail( "Invalid right-hand side not detected" );
+   }
+   catch( std::invalid_argument& ) {}
+
+   bool detected( false );
+
+   try {
+      A(5UL,5UL) = -4.0;
+      chol.factorize( A );
+   }
+   catch( std::runtime_error& ) {
+      detected = true;
+   }
+
+   if( !detected || chol.factorized() ) {
+      fail( "Non-positive-definite matrix not detected" );
+   }
+
+   detected = false;
+
+   try {
+      MT B( 3UL, 3UL );
+      B(0UL,0UL) = 1.0;
+      B(0UL,1UL) = 1.0;
+      B(1UL,0UL) = 1.0;
+      B(1UL,1UL) = 1.0;
+      B(2UL,2UL) = 1.0;
+      blaze::SparseLU<double> lu( B );
+   }
+   catch( std::runtime_error& ) {
+      detected = true;
+   }
+
+   if( !detected ) {
+      fail( "Singular matrix not detected" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace compressedmatrix
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CompressedMatrix sparse direct solver test..." << std::endl;
+
+   try
+   {
+      RUN_COMPRESSEDMATRIX_SPARSEDIRECT_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CompressedMatrix sparse direct solver test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -37,12 +37,21 @@
 // Includes
 //*************************************************************************************************
 
+#include <cstdio>
 #include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include <blaze/math/CustomMatrix.h>
+#include <blaze/math/CustomVector.h>
 #include <blaze/math/DynamicVector.h>
+#include <blaze/math/serialization/MappedArchive.h>
+#include <blaze/math/serialization/MatrixMarket.h>
 #include <blaze/math/serialization/MatrixSerializer.h>
+#include <blaze/math/serialization/Npy.h>
+#include <blaze/math/serialization/Npz.h>
 #include <blaze/math/serialization/VectorSerializer.h>
 #include <blaze/math/StaticVector.h>
+#include <blaze/math/SymmetricMatrix.h>
 #include <blaze/util/Complex.h>
 #include <blazetest/mathtest/matrices/matrixserializer/ClassTest.h>
 
@@ -71,9 +80,18 @@ namespace matrixserializer {
 // \exception std::runtime_error Operation error detected.
 */
 ClassTest::ClassTest()
+   : test_()
+   , compression_( false )
 {
    testEmptyMatrices();
    testRandomMatrices();
+   testVersion1Archives();
+   testVersion2Archives();
+   testMappedArchives();
+   testIndexedArchives();
+   testCompressedArchives();
+   testMatrixMarket();
+   testNumPy();
    testFailures();
 }
 //*************************************************************************************************
@@ -323,6 +341,640 @@ void ClassTest::testRandomMatrices()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Deserialization test with archives written in version 1 of the file format.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the deserialization of sparse matrices from archives written in version 1
+// of the file format, which stores the non-zero elements as index/value pairs. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testVersion1Archives()
+{
+   test_ = "Version 1 archives";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> src( 3UL, 4UL );
+   src(0,1) = 1;
+   src(0,3) = -2;
+   src(2,0) = 3;
+
+   const auto writeArchive = [&src]( blaze::Archive<std::stringstream>& archive )
+   {
+      archive << uint8_t( 1U ) << uint8_t( 3U )
+              << uint8_t( blaze::TypeValueMapping<int>::value ) << uint8_t( sizeof( int ) )
+              << uint64_t( 3UL ) << uint64_t( 4UL ) << uint64_t( src.nonZeros() );
+
+      for( size_t i=0UL; i<src.rows(); ++i ) {
+         archive << uint64_t( src.nonZeros( i ) );
+         for( auto element=src.begin(i); element!=src.end(i); ++element ) {
+            archive << size_t( element->index() ) << element->value();
+         }
+      }
+   };
+
+   {
+      blaze::CompressedMatrix<int,blaze::rowMajor> dst;
+
+      blaze::Archive<std::stringstream> archive;
+      writeArchive( archive );
+      testDeserialization( archive, dst );
+      compareMatrices( src, dst );
+   }
+
+   {
+      blaze::CompressedMatrix<int,blaze::columnMajor> dst;
+
+      blaze::Archive<std::stringstream> archive;
+      writeArchive( archive );
+      testDeserialization( archive, dst );
+      compareMatrices( src, dst );
+   }
+
+   {
+      blaze::DynamicMatrix<int,blaze::rowMajor> dst;
+
+      blaze::Archive<std::stringstream> archive;
+      writeArchive( archive );
+      testDeserialization( archive, dst );
+      compareMatrices( src, dst );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserialization test with archives written in version 2 of the file format.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the deserialization of dense and sparse matrices from archives written in
+// version 2 of the file format, which stores neither padding nor row pointers. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testVersion2Archives()
+{
+   test_ = "Version 2 archives";
+
+   blaze::DynamicMatrix<int,blaze::rowMajor> src1( 3UL, 5UL );
+   randomize( src1 );
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> src2( 3UL, 4UL );
+   src2(0,1) = 1;
+   src2(0,3) = -2;
+   src2(2,0) = 3;
+
+   const auto writeHeader = []( blaze::Archive<std::stringstream>& archive, uint8_t type,
+                                size_t m, size_t n, size_t nonzeros )
+   {
+      archive << uint8_t( 2U ) << type
+              << uint8_t( blaze::TypeValueMapping<int>::value ) << uint8_t( sizeof( int ) )
+              << uint64_t( m ) << uint64_t( n ) << uint64_t( nonzeros );
+   };
+
+   {
+      blaze::DynamicMatrix<int,blaze::columnMajor> dst;
+
+      blaze::Archive<std::stringstream> archive;
+      writeHeader( archive, 1U, 3UL, 5UL, 15UL );
+      archive.write( src1.data(0), 5UL );
+      archive.write( src1.data(1), 5UL );
+      archive.write( src1.data(2), 5UL );
+      testDeserialization( archive, dst );
+      compareMatrices( src1, dst );
+   }
+
+   {
+      blaze::CompressedMatrix<int,blaze::rowMajor> dst;
+
+      blaze::Archive<std::stringstream> archive;
+      writeHeader( archive, 3U, 3UL, 4UL, src2.nonZeros() );
+
+      for( size_t i=0UL; i<src2.rows(); ++i ) {
+         archive << uint64_t( src2.nonZeros( i ) );
+         for( auto element=src2.begin(i); element!=src2.end(i); ++element ) {
+            archive << uint64_t( element->index() );
+         }
+         for( auto element=src2.begin(i); element!=src2.end(i); ++element ) {
+            archive << element->value();
+         }
+      }
+
+      testDeserialization( archive, dst );
+      compareMatrices( src2, dst );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserialization test with memory-mapped archives.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the deserialization of matrices and vectors by means of the MappedArchive
+// class. Dense matrices and vectors are bound to the mapped file as custom matrices and vectors,
+// all other matrices are deserialized by copying. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMappedArchives()
+{
+   test_ = "Memory-mapped archives";
+
+   const std::string filename( "mappedarchive.blaze" );
+
+   blaze::DynamicMatrix<float,blaze::rowMajor> src1( 7UL, 13UL );
+   blaze::DynamicMatrix<float,blaze::columnMajor> src2( 5UL, 3UL );
+   blaze::CompressedMatrix<int,blaze::rowMajor> src3( 9UL, 4UL );
+   blaze::DynamicVector<float,blaze::columnVector> src4( 11UL );
+
+   randomize( src1 );
+   randomize( src2 );
+   randomize( src3, 10UL );
+   randomize( src4 );
+
+   {
+      blaze::Archive<std::ofstream> archive( filename, std::ofstream::trunc );
+      archive << src1 << src2 << src3 << src4;
+   }
+
+   {
+      blaze::MappedArchive archive( filename );
+
+      blaze::CustomMatrix<const float,blaze::unaligned,blaze::unpadded,blaze::rowMajor> dst1;
+      blaze::CustomMatrix<float,blaze::unaligned,blaze::unpadded,blaze::columnMajor> dst2;
+      blaze::CompressedMatrix<int,blaze::columnMajor> dst3;
+      blaze::CustomVector<const float,blaze::unaligned,blaze::unpadded> dst4;
+
+      archive >> dst1 >> dst2 >> dst3 >> dst4;
+
+      compareMatrices( src1, dst1 );
+      compareMatrices( src2, dst2 );
+      compareMatrices( src3, dst3 );
+
+      if( dst4 != src4 || archive.position() != archive.size() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Vector reconstitution failed\n"
+             << " Details:\n"
+             << "   Position: " << archive.position() << "\n"
+             << "   Size: " << archive.size() << "\n"
+             << "   Source:\n" << src4 << "\n"
+             << "   Destination:\n" << dst4 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         blaze::CustomMatrix<const float,blaze::unaligned,blaze::unpadded,blaze::columnMajor> dst;
+
+         archive.seek( 0UL );
+         archive >> dst;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Binding to matrix with different storage order succeeded\n"
+             << " Details:\n"
+             << "   Destination:\n" << dst << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& )
+      {}
+   }
+
+   std::remove( filename.c_str() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the random access to archives with object index.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the random access to the objects of an archive with object index by means
+// of the MappedArchive class. This includes the binding of aligned and padded custom matrices
+// to the aligned payload and the access to ranges of rows of dense and sparse matrices. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIndexedArchives()
+{
+   test_ = "Indexed archives";
+
+   const std::string filename( "indexedarchive.blaze" );
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> src1( 17UL, 13UL );
+   blaze::CompressedMatrix<double,blaze::rowMajor> src2( 25UL, 20UL );
+   blaze::DynamicMatrix<double,blaze::columnMajor> src3( 6UL, 5UL );
+
+   randomize( src1 );
+   randomize( src2, 60UL );
+   randomize( src3 );
+
+   {
+      blaze::Archive<std::ofstream> archive( filename, std::ofstream::trunc );
+      archive.setIndexing( true );
+      archive << src1 << src2 << src3;
+      archive.writeIndex();
+   }
+
+   {
+      blaze::MappedArchive archive( filename );
+
+      if( archive.objects() != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of indexed objects\n"
+             << " Details:\n"
+             << "   Number of objects: " << archive.objects() << "\n"
+             << "   Expected number of objects: 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      {
+         blaze::CustomMatrix<double,blaze::aligned,blaze::padded,blaze::columnMajor> dst;
+
+         archive.seekObject( 2UL );
+         archive >> dst;
+
+         compareMatrices( src3, dst );
+      }
+
+      {
+         blaze::CustomMatrix<const double,blaze::aligned,blaze::unpadded,blaze::rowMajor> dst;
+
+         archive.seekObject( 0UL );
+         archive >> dst;
+
+         compareMatrices( src1, dst );
+      }
+
+      {
+         blaze::DynamicMatrix<double,blaze::rowMajor> dst;
+
+         archive.seekObject( 0UL );
+         archive.readRows( dst, 4UL, 9UL );
+
+         compareMatrices( submatrix( src1, 4UL, 0UL, 9UL, 13UL ), dst );
+      }
+
+      {
+         blaze::CompressedMatrix<double,blaze::rowMajor> dst;
+
+         archive.seekObject( 1UL );
+         archive.readRows( dst, 10UL, 15UL );
+
+         compareMatrices( submatrix( src2, 10UL, 0UL, 15UL, 20UL ), dst );
+      }
+
+      try {
+         blaze::DynamicMatrix<double,blaze::rowMajor> dst;
+
+         archive.seekObject( 0UL );
+         archive.readRows( dst, 10UL, 8UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reading an invalid range of rows succeeded\n"
+             << " Details:\n"
+             << "   Destination:\n" << dst << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& )
+      {}
+
+      try {
+         archive.seekObject( 3UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Seeking an invalid object succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& )
+      {}
+   }
+
+   {
+      blaze::Archive<std::ofstream> archive( filename, std::ofstream::trunc );
+      archive << src1;
+
+      try {
+         archive.writeIndex();
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Writing an index without indexing succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::logic_error& )
+      {}
+   }
+
+   std::remove( filename.c_str() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the (de-)serialization of matrices in compressed format.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function repeats the tests with empty and random matrices with enabled compression and
+// additionally tests large dense and sparse matrices, whose payload spans several blocks, the
+// size of the compressed representation, and the detection of corrupt data. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testCompressedArchives()
+{
+   compression_ = true;
+   testEmptyMatrices();
+   testRandomMatrices();
+   compression_ = false;
+
+   test_ = "Compressed archives";
+
+   {
+      blaze::DynamicMatrix<double,blaze::rowMajor> src( 300UL, 500UL );
+      blaze::DynamicMatrix<double,blaze::columnMajor> dst;
+
+      randomize( src );
+      submatrix( src, 0UL, 0UL, 150UL, 500UL ) = 0.0;
+
+      blaze::Archive<std::stringstream> archive;
+      archive.setCompression( true );
+
+      testSerialization  ( archive, src );
+      testDeserialization( archive, dst );
+      compareMatrices    ( src, dst );
+
+      if( archive.bytesWritten() >= 300UL*500UL*sizeof( double ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Compression of a dense matrix failed\n"
+             << " Details:\n"
+             << "   Compressed size: " << archive.bytesWritten() << "\n"
+             << "   Uncompressed size: " << 300UL*500UL*sizeof( double ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::CompressedMatrix<double,blaze::columnMajor> src( 1000UL, 800UL );
+      blaze::CompressedMatrix<double,blaze::rowMajor> dst;
+
+      randomize( src, 150000UL );
+
+      blaze::Archive<std::stringstream> archive;
+      archive.setCompression( true );
+
+      testSerialization  ( archive, src );
+      testDeserialization( archive, dst );
+      compareMatrices    ( src, dst );
+   }
+
+   {
+      blaze::CompressedMatrix<int,blaze::rowMajor> src( 20UL, 30UL );
+      blaze::DynamicMatrix<int,blaze::rowMajor> dst;
+
+      randomize( src, 100UL );
+
+      std::stringstream stream;
+      blaze::Archive<std::stringstream> archive( stream );
+      archive.setCompression( true );
+      archive << src;
+
+      const std::string data( stream.str() );
+
+      for( size_t test=0UL; test<2UL; ++test )
+      {
+         std::string corrupt( data );
+
+         if( test == 0UL ) {
+            corrupt.resize( corrupt.size() - 10UL );  // Truncation of the values
+         }
+         else {
+            corrupt.replace( 36UL, 8UL, 8UL, '\0' );  // Invalid block size of the structure
+         }
+
+         bool failed( false );
+
+         try {
+            blaze::Archive<std::stringstream> corruptArchive( corrupt );
+            corruptArchive >> dst;
+         }
+         catch( std::runtime_error& ) {
+            failed = true;
+         }
+
+         if( !failed ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Deserialization of corrupt data succeeded\n"
+                << " Details:\n"
+                << "   Source:\n" << src << "\n"
+                << "   Destination:\n" << dst << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Matrix Market reader and writer.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the writing of dense and sparse matrices to Matrix Market files and the
+// reading of Matrix Market files into dense and sparse matrices of both storage orders. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMatrixMarket()
+{
+   test_ = "Matrix Market files";
+
+   const std::string filename( "matrixmarket.mtx" );
+
+   {
+      blaze::DynamicMatrix<double,blaze::columnMajor> src( 7UL, 13UL );
+      randomize( src );
+
+      blaze::writeMatrixMarket( filename, src );
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> dst1;
+      blaze::CompressedMatrix<double,blaze::columnMajor> dst2;
+
+      blaze::readMatrixMarket( filename, dst1 );
+      blaze::readMatrixMarket( filename, dst2 );
+
+      compareMatrices( src, dst1 );
+      compareMatrices( src, dst2 );
+   }
+
+   {
+      blaze::CompressedMatrix<blaze::complex<float>,blaze::rowMajor> src( 9UL, 4UL );
+      randomize( src, 10UL );
+
+      blaze::writeMatrixMarket( filename, src );
+
+      blaze::CompressedMatrix<blaze::complex<float>,blaze::rowMajor> dst1;
+      blaze::CompressedMatrix<blaze::complex<float>,blaze::columnMajor> dst2;
+      blaze::DynamicMatrix<blaze::complex<float>,blaze::rowMajor> dst3;
+
+      blaze::readMatrixMarket( filename, dst1 );
+      blaze::readMatrixMarket( filename, dst2 );
+      blaze::readMatrixMarket( filename, dst3 );
+
+      compareMatrices( src, dst1 );
+      compareMatrices( src, dst2 );
+      compareMatrices( src, dst3 );
+   }
+
+   {
+      blaze::SymmetricMatrix< blaze::CompressedMatrix<int,blaze::rowMajor> > src( 6UL );
+      src(0,0) = 1;
+      src(3,1) = 2;
+      src(5,4) = 3;
+
+      blaze::writeMatrixMarket( filename, src );
+
+      blaze::SymmetricMatrix< blaze::CompressedMatrix<int,blaze::columnMajor> > dst1;
+      blaze::DynamicMatrix<int,blaze::rowMajor> dst2;
+
+      blaze::readMatrixMarket( filename, dst1 );
+      blaze::readMatrixMarket( filename, dst2 );
+
+      compareMatrices( src, dst1 );
+      compareMatrices( src, dst2 );
+   }
+
+   {
+      std::ofstream ofs( filename.c_str(), std::ofstream::trunc );
+      ofs << "%%MatrixMarket matrix coordinate real skew-symmetric\n"
+          << "% Comment line\n"
+          << "3 3 3\n"
+          << "2 1 1.5\n"
+          << "3 1 -2\n"
+          << "3 1 -1\n";
+   }
+
+   {
+      const blaze::DynamicMatrix<double,blaze::rowMajor> ref{ {  0.0, -1.5, 3.0 },
+                                                              {  1.5,  0.0, 0.0 },
+                                                              { -3.0,  0.0, 0.0 } };
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> dst;
+      blaze::readMatrixMarket( filename, dst );
+
+      compareMatrices( ref, dst );
+
+      if( dst.nonZeros() != 4UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Duplicate entries have not been combined\n"
+             << " Details:\n"
+             << "   Number of non-zeros: " << dst.nonZeros() << "\n"
+             << "   Expected number of non-zeros: 4\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   std::remove( filename.c_str() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the NumPy .npy and .npz readers and writers.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the writing of dense matrices to NumPy .npy and .npz files and the reading
+// of these files, including the binding of custom matrices by means of the MappedNpy class. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNumPy()
+{
+   test_ = "NumPy files";
+
+   const std::string npyname( "numpy.npy" );
+   const std::string npzname( "numpy.npz" );
+
+   blaze::DynamicMatrix<float,blaze::rowMajor> src1( 7UL, 13UL );
+   blaze::DynamicMatrix<double,blaze::columnMajor> src2( 5UL, 3UL );
+
+   randomize( src1 );
+   randomize( src2 );
+
+   {
+      blaze::writeNpy( npyname, src1 );
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> dst1;
+      blaze::readNpy( npyname, dst1 );
+
+      compareMatrices( src1, dst1 );
+
+      blaze::MappedNpy npy( npyname );
+      blaze::CustomMatrix<const float,blaze::unaligned,blaze::unpadded,blaze::rowMajor> dst2;
+      npy >> dst2;
+
+      compareMatrices( src1, dst2 );
+   }
+
+   {
+      blaze::writeNpy( npyname, src2 );
+
+      blaze::MappedNpy npy( npyname );
+      blaze::CustomMatrix<const double,blaze::unaligned,blaze::unpadded,blaze::columnMajor> dst;
+      npy >> dst;
+
+      compareMatrices( src2, dst );
+   }
+
+   {
+      blaze::NpzWriter npz( npzname );
+      npz.write( "src1", src1 );
+      npz.write( "src2", src2 );
+   }
+
+   {
+      blaze::NpzReader npz( npzname );
+
+      blaze::DynamicMatrix<float,blaze::columnMajor> dst1;
+      blaze::DynamicMatrix<double,blaze::rowMajor> dst2;
+
+      npz.read( "src2", dst2 );
+      npz.read( "src1", dst1 );
+
+      compareMatrices( src1, dst1 );
+      compareMatrices( src2, dst2 );
+
+      if( npz.size() != 2UL || !npz.contains( "src1" ) || npz.contains( "src3" ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid archive directory\n"
+             << " Details:\n"
+             << "   Number of arrays: " << npz.size() << "\n"
+             << "   Expected number of arrays: 2\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   std::remove( npyname.c_str() );
+   std::remove( npzname.c_str() );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of failing serialization attempts.
 //
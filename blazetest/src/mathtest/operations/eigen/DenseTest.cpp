@@ -45,10 +45,13 @@
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/DiagonalMatrix.h>
 #include <blaze/math/HermitianMatrix.h>
+#include <blaze/math/HybridMatrix.h>
 #include <blaze/math/LowerMatrix.h>
 #include <blaze/math/UpperMatrix.h>
 #include <blaze/math/Row.h>
 #include <blaze/math/shims/Equal.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/math/StaticVector.h>
 #include <blaze/math/SymmetricMatrix.h>
 #include <blaze/util/Complex.h>
 #include <blazetest/mathtest/operations/eigen/DenseTest.h>
@@ -86,6 +89,7 @@ DenseTest::DenseTest()
    testLower();
    testUpper();
    testDiagonal();
+   testTiny();
 }
 //*************************************************************************************************
 
@@ -1734,6 +1738,195 @@ void DenseTest::testDiagonal()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the eigenvalue/eigenvector evaluation for tiny fixed-size symmetric matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the dense matrix eigenvalue/eigenvector evaluation for symmetric
+// StaticMatrix and HybridMatrix instances with up to 4 rows and columns, which are decomposed
+// by the Jacobi kernels instead of LAPACK. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void DenseTest::testTiny()
+{
+   using blaze::SymmetricMatrix;
+   using blaze::StaticMatrix;
+   using blaze::StaticVector;
+   using blaze::HybridMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::eigen;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+   using blaze::rowVector;
+   using blaze::columnVector;
+
+
+   //=====================================================================================
+   // eigen( DenseMatrix, DenseVector, DenseMatrix )
+   //=====================================================================================
+
+   {
+      test_ = "eigen( DenseMatrix, DenseVector, DenseMatrix ) (tiny symmetric, StaticMatrix)";
+
+      SymmetricMatrix< StaticMatrix<double,3UL,3UL,rowMajor> > A;
+      randomize( A );
+
+      SymmetricMatrix< StaticMatrix<double,3UL,3UL,rowMajor> >    A1( A );
+      SymmetricMatrix< StaticMatrix<double,3UL,3UL,columnMajor> > A2( A );
+
+      StaticVector<double,3UL,rowVector> w1;
+      StaticVector<double,3UL,rowVector> w2;
+
+      StaticMatrix<double,3UL,3UL,rowMajor>    V1;
+      StaticMatrix<double,3UL,3UL,columnMajor> V2;
+
+      eigen( A1, w1, V1 );
+      eigen( A2, w2, V2 );
+
+      if( w1 != w2 || !std::is_sorted( w1.begin(), w1.end() ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Eigenvalue computation failed\n"
+             << " Details:\n"
+             << "   Random seed = " << blaze::getSeed() << "\n"
+             << "   Row-major eigenvalues:\n" << w1 << "\n"
+             << "   Column-major eigenvalues:\n" << w2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t i=0UL; i<V1.rows(); ++i ) {
+         checkEigenvector( row( V1, i ), A, w1[i] );
+      }
+
+      for( size_t i=0UL; i<V2.columns(); ++i ) {
+         checkEigenvector( column( V2, i ), A, w2[i] );
+      }
+
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+      SymmetricMatrix< DynamicMatrix<double,rowMajor> > A3( A );
+      DynamicVector<double,rowVector> w3;
+
+      eigen( A3, w3 );
+
+      if( w1 != w3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Eigenvalue computation failed\n"
+             << " Details:\n"
+             << "   Random seed = " << blaze::getSeed() << "\n"
+             << "   Jacobi eigenvalues:\n" << w1 << "\n"
+             << "   LAPACK eigenvalues:\n" << w3 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+#endif
+   }
+
+   {
+      test_ = "eigen( DenseMatrix, DenseVector, DenseMatrix ) (tiny symmetric, HybridMatrix)";
+
+      for( size_t n=1UL; n<=4UL; ++n )
+      {
+         SymmetricMatrix< HybridMatrix<double,4UL,4UL,rowMajor> > A( n );
+         randomize( A );
+
+         SymmetricMatrix< HybridMatrix<double,4UL,4UL,rowMajor> >    A1( A );
+         SymmetricMatrix< HybridMatrix<double,4UL,4UL,columnMajor> > A2( A );
+
+         DynamicVector<double,columnVector> w1;
+         DynamicVector<double,columnVector> w2;
+
+         HybridMatrix<double,4UL,4UL,rowMajor>    V1;
+         HybridMatrix<double,4UL,4UL,columnMajor> V2;
+
+         eigen( A1, w1, V1 );
+         eigen( A2, w2, V2 );
+
+         if( w1.size() != n || w1 != w2 || !std::is_sorted( w1.begin(), w1.end() ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Eigenvalue computation failed\n"
+                << " Details:\n"
+                << "   Random seed = " << blaze::getSeed() << "\n"
+                << "   Row-major eigenvalues:\n" << w1 << "\n"
+                << "   Column-major eigenvalues:\n" << w2 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         for( size_t i=0UL; i<V1.rows(); ++i ) {
+            checkEigenvector( row( V1, i ), A, w1[i] );
+         }
+
+         for( size_t i=0UL; i<V2.columns(); ++i ) {
+            checkEigenvector( column( V2, i ), A, w2[i] );
+         }
+      }
+   }
+
+   {
+      test_ = "eigen( DenseMatrix, DenseVector ) (tiny symmetric, non-contiguous eigenvalues)";
+
+      SymmetricMatrix< StaticMatrix<double,3UL,3UL,rowMajor> > A;
+      randomize( A );
+
+      StaticVector<double,3UL,columnVector> w1;
+      eigen( A, w1 );
+
+      DynamicMatrix<double,rowMajor> W( 3UL, 2UL, 0.0 );
+      auto w2 = column( W, 1UL );
+      eigen( A, w2 );
+
+      DynamicMatrix<double,rowMajor> X( 5UL, 2UL, 0.0 );
+      auto w3 = subvector( column( X, 0UL ), 1UL, 3UL );
+      eigen( A, w3 );
+
+      if( w1 != w2 || w1 != w3 || !isZero( column( W, 0UL ) ) ||
+          X(0,0) != 0.0 || X(4,0) != 0.0 || !isZero( column( X, 1UL ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Eigenvalue computation failed\n"
+             << " Details:\n"
+             << "   Random seed = " << blaze::getSeed() << "\n"
+             << "   Contiguous eigenvalues:\n" << w1 << "\n"
+             << "   Column eigenvalues:\n" << W << "\n"
+             << "   Subvector eigenvalues:\n" << X << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "eigen( DenseMatrix, DenseVector, DenseMatrix ) "
+              "(tiny symmetric, non-contiguous eigenvalues)";
+
+      SymmetricMatrix< StaticMatrix<double,3UL,3UL,columnMajor> > A;
+      randomize( A );
+
+      DynamicMatrix<double,rowMajor> W( 3UL, 2UL, 0.0 );
+      auto w = column( W, 0UL );
+      StaticMatrix<double,3UL,3UL,columnMajor> V;
+
+      eigen( A, w, V );
+
+      if( !std::is_sorted( w.begin(), w.end() ) || !isZero( column( W, 1UL ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Eigenvalue computation failed\n"
+             << " Details:\n"
+             << "   Random seed = " << blaze::getSeed() << "\n"
+             << "   Eigenvalues:\n" << W << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t i=0UL; i<V.columns(); ++i ) {
+         checkEigenvector( column( V, i ), A, w[i] );
+      }
+   }
+}
+//*************************************************************************************************
+
 } // namespace eigen
 
 } // namespace operations
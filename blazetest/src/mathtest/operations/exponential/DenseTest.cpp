@@ -39,8 +39,10 @@
 
 #include <cstdlib>
 #include <iostream>
+#include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/DiagonalMatrix.h>
 #include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
 #include <blaze/math/HermitianMatrix.h>
 #include <blaze/math/IdentityMatrix.h>
 #include <blaze/math/LowerMatrix.h>
@@ -101,6 +103,20 @@ DenseTest::DenseTest()
    testSpecific();
 
 
+   //=====================================================================================
+   // Matrix exponential/vector tests
+   //=====================================================================================
+
+   testExpmv();
+
+
+   //=====================================================================================
+   // Matrix function tests
+   //=====================================================================================
+
+   testMatrixFunctions();
+
+
    //=====================================================================================
    // Random matrix tests
    //=====================================================================================
@@ -567,6 +583,192 @@ void DenseTest::testSpecific()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the action of the matrix exponential on a vector (expmv).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the result of the expmv() function for dense and sparse matrices with
+// the explicitly formed matrix exponential. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void DenseTest::testExpmv()
+{
+   test_ = "Matrix exponential/vector product ( expmv(A,v,t) == matexp(t*A)*v )";
+
+   for( size_t n : { 0UL, 1UL, 7UL, 33UL } )
+   {
+      for( double t : { 0.0, 0.1, -2.0, 10.0 } )
+      {
+         blaze::DynamicMatrix<double,blaze::rowMajor> A( n, n );
+         randomize( A, -1.0, 1.0 );
+         for( size_t i=0UL; i<n; ++i ) {
+            A(i,i) -= 1.0;
+         }
+
+         const blaze::DynamicMatrix<double,blaze::columnMajor> B( A );
+         const blaze::CompressedMatrix<double,blaze::rowMajor> C( A );
+         const blaze::DynamicMatrix<complex<double>,blaze::rowMajor> D(
+            A * complex<double>( 1.0, 0.5 ) );
+
+         blaze::DynamicVector<double,blaze::columnVector> v( n );
+         randomize( v );
+
+         const blaze::DynamicVector<double,blaze::columnVector> ref( matexp( t*A ) * v );
+         const blaze::DynamicVector<complex<double>,blaze::columnVector> cref( matexp( t*D ) * v );
+
+         const blaze::DynamicVector<double,blaze::columnVector> x( expmv( A, v, t ) );
+         const blaze::DynamicVector<double,blaze::columnVector> y( expmv( B, v, t ) );
+         const blaze::DynamicVector<double,blaze::columnVector> z( expmv( C, v, t ) );
+         const blaze::DynamicVector<complex<double>,blaze::columnVector> w( expmv( D, v, t ) );
+
+         if( x != ref || y != ref || z != ref || w != cref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Matrix exponential/vector product failed\n"
+                << " Details:\n"
+                << "   t = " << t << "\n"
+                << "   A:\n" << A << "\n"
+                << "   v:\n" << v << "\n"
+                << "   Row-major dense result:\n" << x << "\n"
+                << "   Column-major dense result:\n" << y << "\n"
+                << "   Sparse result:\n" << z << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "Matrix exponential/vector product (non-square)";
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> A( 2UL, 3UL );
+      blaze::DynamicVector<double,blaze::columnVector> v( 3UL );
+
+      try {
+         expmv( A, v );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Exponential/vector product of a non-square matrix succeeded\n"
+             << " Details:\n"
+             << "   Matrix:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Test of the dense matrix square root, logarithm, and power functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the sqrtm(), logm(), powm(), and funm() functions for general and for
+// Hermitian matrices by means of the defining identities. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void DenseTest::testMatrixFunctions()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   using cplx = complex<double>;
+
+   using blaze::maxNorm;
+
+   for( size_t n : { 1UL, 2UL, 9UL, 40UL } )
+   {
+      const blaze::IdentityMatrix<cplx> I( n );
+
+      test_ = "Matrix functions of general matrices";
+
+      blaze::DynamicMatrix<cplx,blaze::rowMajor> A( n, n ), S( n, n );
+      randomize( A, -1.0, 1.0 );
+      randomize( S, -1.0, 1.0 );
+      for( size_t i=0UL; i<n; ++i ) {
+         A(i,i) += cplx( 2.0, 0.5 );
+      }
+      S *= 0.5 / n;
+
+      const blaze::DynamicMatrix<cplx,blaze::rowMajor> X( sqrtm( A ) );
+      const blaze::DynamicMatrix<cplx,blaze::rowMajor> L( logm( matexp( S ) ) );
+      const blaze::DynamicMatrix<cplx,blaze::rowMajor> P( powm( A, 1.5 ) );
+      const blaze::DynamicMatrix<cplx,blaze::rowMajor> Q( powm( A, -2 ) );
+
+      if( maxNorm( X*X - A ) > 1E-10 || maxNorm( L - S ) > 1E-10 ||
+          maxNorm( P*P - A*A*A ) > 1E-8 || maxNorm( Q*A*A - I ) > 1E-8 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Matrix function failed\n"
+             << " Details:\n"
+             << "   A:\n" << A << "\n"
+             << "   Square root error: " << maxNorm( X*X - A ) << "\n"
+             << "   Logarithm error: " << maxNorm( L - S ) << "\n"
+             << "   Power error: " << maxNorm( P*P - A*A*A ) << "\n"
+             << "   Inverse power error: "
+             << maxNorm( Q*A*A - I ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      test_ = "Matrix functions of Hermitian matrices";
+
+      blaze::HermitianMatrix< blaze::DynamicMatrix<cplx,blaze::rowMajor> > H;
+      H = declherm( A * ctrans( A ) );
+
+      const blaze::DynamicMatrix<cplx,blaze::rowMajor> G( H );
+
+      const blaze::DynamicMatrix<cplx,blaze::rowMajor> Y( sqrtm( H ) );
+      const blaze::DynamicMatrix<cplx,blaze::rowMajor> M( logm( H ) );
+      const blaze::DynamicMatrix<cplx,blaze::rowMajor> R( powm( H, -0.5 ) );
+      const blaze::DynamicMatrix<cplx,blaze::rowMajor> E(
+         funm( H, []( double x ){ return std::exp( -x ); } ) );
+
+      if( maxNorm( Y - sqrtm( G ) ) > 1E-10 || maxNorm( M - logm( G ) ) > 1E-10 ||
+          maxNorm( R*Y - I ) > 1E-10 ||
+          maxNorm( E - matexp( -G ) ) > 1E-10 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Matrix function failed\n"
+             << " Details:\n"
+             << "   H:\n" << H << "\n"
+             << "   Square root error: " << maxNorm( Y - sqrtm( G ) ) << "\n"
+             << "   Logarithm error: " << maxNorm( M - logm( G ) ) << "\n"
+             << "   Power error: " << maxNorm( R*Y - I ) << "\n"
+             << "   Function error: " << maxNorm( E - matexp( -G ) ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Matrix square root of matrix with negative eigenvalues";
+
+      blaze::SymmetricMatrix< blaze::DynamicMatrix<double,blaze::rowMajor> > A( 3UL );
+      A(0,0) = 1.0;
+      A(1,1) = -2.0;
+      A(2,2) = 3.0;
+      A(0,2) = 0.5;
+
+      try {
+         sqrtm( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Square root of indefinite matrix succeeded\n"
+             << " Details:\n"
+             << "   Matrix:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+#endif
+}
+//*************************************************************************************************
+
 } // namespace exponential
 
 } // namespace operations
@@ -87,6 +87,7 @@ DenseTest::DenseTest()
       testUpper    < double >( i );
       testUniUpper < double >( i );
       testDiagonal < double >( i );
+      testMixed    < double >( i );
 
       //testGeneral  < complex<float> >( i );
       //testSymmetric< complex<float> >( i );
@@ -105,6 +106,7 @@ DenseTest::DenseTest()
       testUpper    < complex<double> >( i );
       testUniUpper < complex<double> >( i );
       testDiagonal < complex<double> >( i );
+      testMixed    < complex<double> >( i );
    }
 }
 //*************************************************************************************************
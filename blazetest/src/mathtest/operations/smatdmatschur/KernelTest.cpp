@@ -0,0 +1,131 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/operations/smatdmatschur/KernelTest.cpp
+//  \brief Source file for the sparse matrix/dense matrix Schur product kernel test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/operations/smatdmatschur/KernelTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace operations {
+
+namespace smatdmatschur {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the kernel test class.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+KernelTest::KernelTest()
+   : test_()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   const size_t inner[] = { 1UL, 3UL, 7UL, 9UL, 17UL, 33UL, 67UL };
+
+   for( size_t k : inner ) {
+      testSDDMM<double,rowMajor,rowMajor,rowMajor>      ( 53UL, k, 41UL );
+      testSDDMM<double,columnMajor,rowMajor,rowMajor>   ( 41UL, k, 53UL );
+      testSDDMM<double,rowMajor,columnMajor,columnMajor>( 53UL, k, 41UL );
+      testSDDMM<double,columnMajor,columnMajor,rowMajor>( 41UL, k, 53UL );
+      testSDDMM<float,rowMajor,rowMajor,rowMajor>       ( 53UL, k, 41UL );
+      testSDDMM<float,columnMajor,rowMajor,columnMajor> ( 41UL, k, 53UL );
+      testSDDMM<int,rowMajor,rowMajor,rowMajor>         ( 53UL, k, 41UL );
+      testSDDMM<int,columnMajor,columnMajor,columnMajor>( 41UL, k, 53UL );
+   }
+
+   testSDDMM<double,rowMajor,rowMajor,rowMajor>   ( 1031UL, 35UL, 1013UL );
+   testSDDMM<double,columnMajor,rowMajor,rowMajor>( 1013UL, 35UL, 1031UL );
+
+   testAliasing<double,rowMajor>   ( 37UL );
+   testAliasing<double,columnMajor>( 37UL );
+   testAliasing<int,rowMajor>      ( 37UL );
+   testAliasing<int,columnMajor>   ( 37UL );
+}
+//*************************************************************************************************
+
+} // namespace smatdmatschur
+
+} // namespace operations
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running kernel test..." << std::endl;
+
+   try
+   {
+      RUN_SMATDMATSCHUR_KERNEL_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during kernel test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -44,7 +44,12 @@
 #include <stdexcept>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
+#include <blaze/math/HybridMatrix.h>
+#include <blaze/math/IdentityMatrix.h>
+#include <blaze/math/Row.h>
 #include <blaze/math/shims/Equal.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/math/StaticVector.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/Random.h>
 #include <blazetest/mathtest/operations/svd/DenseTest.h>
@@ -77,6 +82,7 @@ namespace svd {
 DenseTest::DenseTest()
 {
    testGeneral();
+   testTiny();
 }
 //*************************************************************************************************
 
@@ -536,6 +542,148 @@ void DenseTest::testGeneral()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the singular value decomposition of tiny fixed-size matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the dense matrix singular value decomposition for StaticMatrix and
+// HybridMatrix instances with up to 4 rows and columns, which are decomposed by the Jacobi
+// kernels instead of LAPACK. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void DenseTest::testTiny()
+{
+   using blaze::StaticMatrix;
+   using blaze::StaticVector;
+   using blaze::HybridMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::svd;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+   using blaze::rowVector;
+
+
+   //=====================================================================================
+   // svd( DenseMatrix, DenseVector )
+   //=====================================================================================
+
+   {
+      test_ = "svd( DenseMatrix, DenseVector ) (tiny, StaticMatrix)";
+
+      StaticMatrix<double,4UL,2UL,columnMajor> A1;
+      randomize( A1 );
+      StaticMatrix<double,4UL,2UL,rowMajor> A2( A1 );
+
+      StaticVector<double,2UL,rowVector> s1;
+      StaticVector<double,2UL,rowVector> s2;
+
+      svd( A1, s1 );
+      svd( A2, s2 );
+
+      if( s1 != s2 || s1[0] < s1[1] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Singular value computation failed\n"
+             << " Details:\n"
+             << "   Random seed = " << blaze::getSeed() << "\n"
+             << "   Row-major singular values:\n" << s1 << "\n"
+             << "   Column-major singular values:\n" << s2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+      DynamicMatrix<double,columnMajor> A3( A1 );
+      DynamicVector<double,rowVector> s3;
+
+      svd( A3, s3 );
+
+      if( s1 != s3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Singular value computation failed\n"
+             << " Details:\n"
+             << "   Random seed = " << blaze::getSeed() << "\n"
+             << "   Jacobi singular values:\n" << s1 << "\n"
+             << "   LAPACK singular values:\n" << s3 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+#endif
+   }
+
+
+   //=====================================================================================
+   // svd( DenseMatrix, DenseMatrix, DenseVector, DenseMatrix )
+   //=====================================================================================
+
+   {
+      test_ = "svd( DenseMatrix, DenseMatrix, DenseVector, DenseMatrix ) (tiny, HybridMatrix)";
+
+      for( size_t m=1UL; m<=4UL; ++m ) {
+         for( size_t n=1UL; n<=4UL; ++n ) {
+            for( bool square : { false, true } )
+            {
+               HybridMatrix<double,4UL,4UL,rowMajor> A( m, n );
+               randomize( A );
+
+               if( m > 1UL ) {
+                  row( A, m-1UL ) = row( A, 0UL );
+               }
+
+               HybridMatrix<double,4UL,4UL,rowMajor> U, V;
+               DynamicVector<double,rowVector> s;
+
+               svd( A, U, s, V, square );
+
+               const size_t k( blaze::min( m, n ) );
+
+               if( s.size() != k || U.rows() != m || U.columns() != ( square ? m : k ) ||
+                   V.rows() != ( square ? n : k ) || V.columns() != n ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Singular value computation failed\n"
+                      << " Details:\n"
+                      << "   Random seed = " << blaze::getSeed() << "\n"
+                      << "   U = " << U.rows() << "x" << U.columns() << "\n"
+                      << "   V = " << V.rows() << "x" << V.columns() << "\n"
+                      << "   Expected U = " << m << "x" << ( square ? m : k ) << "\n"
+                      << "   Expected V = " << ( square ? n : k ) << "x" << n << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+
+               DynamicMatrix<double,rowMajor> S( U.columns(), V.rows(), 0.0 );
+               for( size_t i=0UL; i<k; ++i ) {
+                  S(i,i) = s[i];
+               }
+
+               const DynamicMatrix<double,rowMajor> USV( U * S * V );
+               const DynamicMatrix<double,rowMajor> UTU( trans( U ) * U );
+               const DynamicMatrix<double,rowMajor> VVT( V * trans( V ) );
+
+               if( A != USV || UTU != blaze::IdentityMatrix<double>( U.columns() ) ||
+                   VVT != blaze::IdentityMatrix<double>( V.rows() ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Singular value computation failed\n"
+                      << " Details:\n"
+                      << "   Random seed = " << blaze::getSeed() << "\n"
+                      << "   singular values:\n" << s << "\n"
+                      << "   left singular vectors:\n" << U << "\n"
+                      << "   right singular vectors:\n" << V << "\n"
+                      << "   Product:\n" << USV << "\n"
+                      << "   Expected Result:\n" << A << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
 } // namespace svd
 
 } // namespace operations
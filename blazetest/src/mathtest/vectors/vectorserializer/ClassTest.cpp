@@ -37,10 +37,14 @@
 // Includes
 //*************************************************************************************************
 
+#include <cstdio>
 #include <cstdlib>
 #include <iostream>
+#include <blaze/math/CustomVector.h>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/serialization/MatrixSerializer.h>
+#include <blaze/math/serialization/Npy.h>
+#include <blaze/math/serialization/Npz.h>
 #include <blaze/math/serialization/VectorSerializer.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/Random.h>
@@ -71,9 +75,14 @@ namespace vectorserializer {
 // \exception std::runtime_error Operation error detected.
 */
 ClassTest::ClassTest()
+   : test_()
+   , compression_( false )
 {
    testEmptyVectors();
    testRandomVectors();
+   testVersion1Archives();
+   testCompressedArchives();
+   testNumPy();
    testFailures();
 }
 //*************************************************************************************************
@@ -236,6 +245,217 @@ void ClassTest::testRandomVectors()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Deserialization test with archives written in version 1 of the file format.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the deserialization of sparse vectors from archives written in version 1
+// of the file format, which stores the non-zero elements as index/value pairs. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testVersion1Archives()
+{
+   test_ = "Version 1 archives";
+
+   blaze::CompressedVector<double,blaze::columnVector> src( 7UL );
+   src[1] =  1.5;
+   src[4] = -2.0;
+   src[6] =  3.0;
+
+   const auto writeArchive = [&src]( blaze::Archive<std::stringstream>& archive )
+   {
+      archive << uint8_t( 1U ) << uint8_t( 2U )
+              << uint8_t( blaze::TypeValueMapping<double>::value ) << uint8_t( sizeof( double ) )
+              << uint64_t( 7UL ) << uint64_t( src.nonZeros() );
+
+      for( auto element=src.begin(); element!=src.end(); ++element ) {
+         archive << size_t( element->index() ) << element->value();
+      }
+   };
+
+   {
+      blaze::CompressedVector<double,blaze::columnVector> dst;
+
+      blaze::Archive<std::stringstream> archive;
+      writeArchive( archive );
+      testDeserialization( archive, dst );
+      compareVectors( src, dst );
+   }
+
+   {
+      blaze::DynamicVector<double,blaze::columnVector> dst;
+
+      blaze::Archive<std::stringstream> archive;
+      writeArchive( archive );
+      testDeserialization( archive, dst );
+      compareVectors( src, dst );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the (de-)serialization of vectors in compressed format.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function repeats the tests with empty and random vectors with enabled compression and
+// additionally tests large dense and sparse vectors, whose payload spans several blocks, and
+// the detection of truncated data. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testCompressedArchives()
+{
+   compression_ = true;
+   testEmptyVectors();
+   testRandomVectors();
+   compression_ = false;
+
+   test_ = "Compressed archives";
+
+   {
+      blaze::DynamicVector<double,blaze::columnVector> src( 200000UL );
+      blaze::CompressedVector<double,blaze::columnVector> dst;
+
+      randomize( src );
+      subvector( src, 0UL, 100000UL ) = 0.0;
+
+      blaze::Archive<std::stringstream> archive;
+      archive.setCompression( true );
+
+      testSerialization  ( archive, src );
+      testDeserialization( archive, dst );
+      compareVectors     ( src, dst );
+
+      if( archive.bytesWritten() >= 200000UL*sizeof( double ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Compression of a dense vector failed\n"
+             << " Details:\n"
+             << "   Compressed size: " << archive.bytesWritten() << "\n"
+             << "   Uncompressed size: " << 200000UL*sizeof( double ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::CompressedVector<double,blaze::rowVector> src( 1000000UL );
+      blaze::DynamicVector<double,blaze::rowVector> dst;
+
+      randomize( src, 150000UL );
+
+      blaze::Archive<std::stringstream> archive;
+      archive.setCompression( true );
+
+      testSerialization  ( archive, src );
+      testDeserialization( archive, dst );
+      compareVectors     ( src, dst );
+   }
+
+   {
+      blaze::CompressedVector<int,blaze::columnVector> src( 50UL );
+      blaze::CompressedVector<int,blaze::columnVector> dst;
+
+      randomize( src, 20UL );
+
+      std::stringstream stream;
+      blaze::Archive<std::stringstream> archive( stream );
+      archive.setCompression( true );
+      archive << src;
+
+      std::string data( stream.str() );
+      data.resize( data.size() - 10UL );
+
+      bool failed( false );
+
+      try {
+         blaze::Archive<std::stringstream> corrupt( data );
+         corrupt >> dst;
+      }
+      catch( std::runtime_error& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Deserialization of truncated data succeeded\n"
+             << " Details:\n"
+             << "   Source:\n" << src << "\n"
+             << "   Destination:\n" << dst << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the NumPy .npy and .npz readers and writers.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the writing of dense vectors to NumPy .npy and .npz files and the reading
+// of these files, including the binding of custom vectors by means of the MappedNpy class. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNumPy()
+{
+   test_ = "NumPy files";
+
+   const std::string npyname( "numpy.npy" );
+   const std::string npzname( "numpy.npz" );
+
+   blaze::DynamicVector<int,blaze::columnVector> src1( 23UL );
+   blaze::DynamicVector<blaze::complex<double>,blaze::rowVector> src2( 11UL );
+
+   randomize( src1 );
+   randomize( src2 );
+
+   {
+      blaze::writeNpy( npyname, src1 );
+
+      blaze::DynamicVector<long,blaze::columnVector> dst1;
+      blaze::readNpy( npyname, dst1 );
+
+      compareVectors( src1, dst1 );
+
+      blaze::MappedNpy npy( npyname );
+      blaze::CustomVector<const int,blaze::unaligned,blaze::unpadded,blaze::columnVector> dst2;
+      npy >> dst2;
+
+      compareVectors( src1, dst2 );
+   }
+
+   {
+      blaze::NpzWriter npz( npzname );
+      npz.write( "src1", src1 );
+      npz.write( "src2", src2 );
+   }
+
+   {
+      blaze::NpzReader npz( npzname );
+
+      blaze::DynamicVector<int,blaze::columnVector> dst1;
+      blaze::DynamicVector<blaze::complex<double>,blaze::rowVector> dst2;
+
+      npz.read( "src1", dst1 );
+      npz.read( "src2", dst2 );
+
+      compareVectors( src1, dst1 );
+      compareVectors( src2, dst2 );
+   }
+
+   std::remove( npyname.c_str() );
+   std::remove( npzname.c_str() );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of failing serialization attempts.
 //